@@ -50,6 +50,28 @@ LOG_MODULE_REGISTER(mpu);
 extern K_THREAD_STACK_DEFINE(z_main_stack, CONFIG_MAIN_STACK_SIZE);
 #endif
 
+#if defined(CONFIG_MPU_DYN_REGION_CACHE)
+/* Inputs from which the currently programmed dynamic region set was
+ * derived. The region set is a pure function of these values, so when
+ * they all match a new request the MPU already holds the correct
+ * configuration and reprogramming can be skipped. The domain generation
+ * number detects partition changes made behind an unchanged domain
+ * pointer.
+ */
+static struct {
+	struct k_thread *thread;
+	uint32_t stack_start;
+	uint32_t stack_size;
+#if defined(CONFIG_USERSPACE)
+	struct k_mem_domain *domain;
+	uint32_t domain_generation;
+	uint32_t priv_stack_start;
+#endif
+	uint8_t options;
+	bool valid;
+} dyn_region_cache;
+#endif /* CONFIG_MPU_DYN_REGION_CACHE */
+
 /**
  * @brief Use the HW-specific MPU driver to program
  *        the static MPU regions.
@@ -191,6 +213,26 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 
 	uint8_t region_num = 0U;
 
+#if defined(CONFIG_MPU_DYN_REGION_CACHE)
+	if (dyn_region_cache.valid &&
+	    (dyn_region_cache.thread == thread) &&
+	    (dyn_region_cache.stack_start == thread->stack_info.start) &&
+	    (dyn_region_cache.stack_size == thread->stack_info.size) &&
+#if defined(CONFIG_USERSPACE)
+	    (dyn_region_cache.domain ==
+	     thread->mem_domain_info.mem_domain) &&
+	    ((thread->mem_domain_info.mem_domain == NULL) ||
+	     (dyn_region_cache.domain_generation ==
+	      thread->mem_domain_info.mem_domain->generation)) &&
+	    (dyn_region_cache.priv_stack_start ==
+	     thread->arch.priv_stack_start) &&
+#endif
+	    (dyn_region_cache.options == thread->base.user_options)) {
+		/* The MPU already holds this exact region set. */
+		return;
+	}
+#endif /* CONFIG_MPU_DYN_REGION_CACHE */
+
 #if defined(CONFIG_USERSPACE)
 	struct k_mem_partition thread_stack;
 
@@ -305,6 +347,22 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 	arm_core_mpu_configure_dynamic_mpu_regions(
 		(const struct k_mem_partition **)dynamic_regions,
 		region_num);
+
+#if defined(CONFIG_MPU_DYN_REGION_CACHE)
+	dyn_region_cache.thread = thread;
+	dyn_region_cache.stack_start = thread->stack_info.start;
+	dyn_region_cache.stack_size = thread->stack_info.size;
+#if defined(CONFIG_USERSPACE)
+	dyn_region_cache.domain = thread->mem_domain_info.mem_domain;
+	if (thread->mem_domain_info.mem_domain != NULL) {
+		dyn_region_cache.domain_generation =
+			thread->mem_domain_info.mem_domain->generation;
+	}
+	dyn_region_cache.priv_stack_start = thread->arch.priv_stack_start;
+#endif
+	dyn_region_cache.options = thread->base.user_options;
+	dyn_region_cache.valid = true;
+#endif /* CONFIG_MPU_DYN_REGION_CACHE */
 }
 
 #if defined(CONFIG_USERSPACE)
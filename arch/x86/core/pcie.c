@@ -170,4 +170,25 @@ uint16_t pcie_msi_mdr(unsigned int irq)
 	return 0x4000U | vector;  /* edge triggered */
 }
 
+#ifdef CONFIG_PCIE_MSIX
+
+#if defined(CONFIG_X86_64) && defined(CONFIG_SMP)
+extern uint8_t x86_cpu_loapics[];  /* CPU logical ID -> local APIC ID */
+#endif
+
+uint32_t pcie_msix_map(unsigned int irq, unsigned int cpu)
+{
+	ARG_UNUSED(irq);
+
+#if defined(CONFIG_X86_64) && defined(CONFIG_SMP)
+	/* physical destination mode, directed at the target local APIC */
+	return 0xFEE00000U | ((uint32_t)x86_cpu_loapics[cpu] << 12);
+#else
+	ARG_UNUSED(cpu);
+	return 0xFEE00000U;  /* standard delivery to BSP local APIC */
+#endif
+}
+
+#endif /* CONFIG_PCIE_MSIX */
+
 #endif
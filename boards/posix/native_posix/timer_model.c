@@ -68,6 +68,7 @@ uint64_t hw_timer_timer;
 
 uint64_t hw_timer_tick_timer;
 uint64_t hw_timer_awake_timer;
+uint64_t hw_timer_hires_timer = NEVER;
 
 static uint64_t tick_p; /* Period of the ticker */
 static int64_t silent_ticks;
@@ -127,6 +128,7 @@ void hwtimer_set_real_time_mode(bool new_rt)
 static void hwtimer_update_timer(void)
 {
 	hw_timer_timer = MIN(hw_timer_tick_timer, hw_timer_awake_timer);
+	hw_timer_timer = MIN(hw_timer_timer, hw_timer_hires_timer);
 }
 
 static inline void host_clock_gettime(struct timespec *tv)
@@ -151,6 +153,7 @@ void hwtimer_init(void)
 	silent_ticks = 0;
 	hw_timer_tick_timer = NEVER;
 	hw_timer_awake_timer = NEVER;
+	hw_timer_hires_timer = NEVER;
 	hwtimer_update_timer();
 	if (real_time_mode) {
 		boot_time = get_host_us_time();
@@ -234,6 +237,13 @@ static void hwtimer_awake_timer_reached(void)
 	hw_irq_ctrl_set_irq(PHONY_HARD_IRQ);
 }
 
+static void hwtimer_hires_timer_reached(void)
+{
+	hw_timer_hires_timer = NEVER;
+	hwtimer_update_timer();
+	hw_irq_ctrl_set_irq(TIMER_TICK_IRQ);
+}
+
 void hwtimer_timer_reached(void)
 {
 	uint64_t Now = hw_timer_timer;
@@ -242,6 +252,10 @@ void hwtimer_timer_reached(void)
 		hwtimer_awake_timer_reached();
 	}
 
+	if (hw_timer_hires_timer == Now) {
+		hwtimer_hires_timer_reached();
+	}
+
 	if (hw_timer_tick_timer == Now) {
 		hwtimer_tick_timer_reached();
 	}
@@ -263,6 +277,21 @@ void hwtimer_wake_in_time(uint64_t time)
 	}
 }
 
+/**
+ * The timer HW will raise the timer interrupt when <time> comes, in
+ * addition to (and independently of) the periodic tick interrupt.
+ * Only one such alarm is pending at a time: a new call replaces the
+ * previous one, and passing NEVER cancels it.
+ *
+ * This is meant for sub-tick alarm functionality (CONFIG_HIRES_TIMER)
+ */
+void hwtimer_hires_alarm(uint64_t time)
+{
+	hw_timer_hires_timer = time;
+	hwtimer_update_timer();
+	hwm_find_next_timer();
+}
+
 /**
  * The kernel wants to skip the next sys_ticks tick interrupts
  * If sys_ticks == 0, the next interrupt will be raised.
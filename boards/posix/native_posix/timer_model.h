@@ -19,6 +19,7 @@ void hwtimer_cleanup(void);
 void hwtimer_set_real_time_mode(bool new_rt);
 void hwtimer_timer_reached(void);
 void hwtimer_wake_in_time(uint64_t time);
+void hwtimer_hires_alarm(uint64_t time);
 void hwtimer_set_silent_ticks(int64_t sys_ticks);
 void hwtimer_enable(uint64_t period);
 int64_t hwtimer_get_pending_silent_ticks(void);
@@ -1181,9 +1181,21 @@ function(target_cc_option_ifdef feature_toggle target scope option)
   endif()
 endfunction()
 
+# Record which Kconfig option pulled sources into the build, so the
+# footprint_report target can attribute image size per option. The
+# accumulated map is written out by cmake/reports.
+function(zephyr_footprint_map_sources feature_toggle)
+  foreach(source ${ARGN})
+    get_filename_component(abs_source ${source} ABSOLUTE)
+    set_property(GLOBAL APPEND_STRING PROPERTY footprint_kconfig_map
+                 "${feature_toggle} ${abs_source}\n")
+  endforeach()
+endfunction()
+
 function(zephyr_library_sources_ifdef feature_toggle source)
   if(${${feature_toggle}})
     zephyr_library_sources(${source} ${ARGN})
+    zephyr_footprint_map_sources(${feature_toggle} ${source} ${ARGN})
   endif()
 endfunction()
 
@@ -1196,6 +1208,7 @@ endfunction()
 function(zephyr_sources_ifdef feature_toggle)
   if(${${feature_toggle}})
     zephyr_sources(${ARGN})
+    zephyr_footprint_map_sources(${feature_toggle} ${ARGN})
   endif()
 endfunction()
 
@@ -31,6 +31,9 @@ message("  debug        - Build and debug an application using GDB")
 message("  debugserver  - Build and start a GDB server (port 1234 for Qemu targets)")
 message("  ram_report   - Build and create RAM usage report")
 message("  rom_report   - Build and create ROM usage report")
+message("  footprint_report - Build and create per-directory/per-Kconfig")
+message("                 footprint report (footprint.json)")
+message("  hot_code_report - List functions placed in fast code memory")
 message("  usage        - Display this text")
 message("")
 message("Supported Boards:")
@@ -37,6 +37,18 @@ static void adc_context_update_buffer_pointer(struct adc_context *ctx,
  */
 static void adc_context_enable_timer(struct adc_context *ctx);
 static void adc_context_disable_timer(struct adc_context *ctx);
+/*
+ * A driver that can sustain the continuous capture mode (see the buffer2
+ * field in struct adc_sequence_options) should define the
+ * ADC_CONTEXT_SUPPORTS_STREAM macro and provide an implementation of the
+ * following function, which re-points the driver's sample write position
+ * at the supplied buffer. Sequences requesting continuous capture are
+ * rejected with -ENOTSUP when the macro is not defined.
+ */
+#ifdef ADC_CONTEXT_SUPPORTS_STREAM
+static void adc_context_set_buffer_pointer(struct adc_context *ctx,
+					   void *buffer);
+#endif
 
 
 struct adc_context {
@@ -57,6 +69,12 @@ struct adc_context {
 	struct adc_sequence sequence;
 	struct adc_sequence_options options;
 	uint16_t sampling_index;
+
+#ifdef CONFIG_ADC_STREAM
+	bool streaming;
+	uint8_t stream_idx;
+	void *stream_buffers[2];
+#endif /* CONFIG_ADC_STREAM */
 };
 
 #ifdef ADC_CONTEXT_USES_KERNEL_TIMER
@@ -182,11 +200,29 @@ static inline void adc_context_start_read(struct adc_context *ctx,
 	ctx->sequence = *sequence;
 	ctx->status = 0;
 
+#ifdef CONFIG_ADC_STREAM
+	ctx->streaming = false;
+#endif
+
 	if (sequence->options) {
 		ctx->options = *sequence->options;
 		ctx->sequence.options = &ctx->options;
 		ctx->sampling_index = 0U;
 
+#ifdef CONFIG_ADC_STREAM
+		if (ctx->options.buffer2 != NULL) {
+#ifdef ADC_CONTEXT_SUPPORTS_STREAM
+			ctx->streaming = true;
+			ctx->stream_idx = 0U;
+			ctx->stream_buffers[0] = sequence->buffer;
+			ctx->stream_buffers[1] = ctx->options.buffer2;
+#else
+			adc_context_complete(ctx, -ENOTSUP);
+			return;
+#endif /* ADC_CONTEXT_SUPPORTS_STREAM */
+		}
+#endif /* CONFIG_ADC_STREAM */
+
 		if (ctx->options.interval_us != 0U) {
 			atomic_set(&ctx->sampling_requested, 0);
 			adc_context_enable_timer(ctx);
@@ -197,6 +233,51 @@ static inline void adc_context_start_read(struct adc_context *ctx,
 	adc_context_start_sampling(ctx);
 }
 
+#if defined(CONFIG_ADC_STREAM) && defined(ADC_CONTEXT_SUPPORTS_STREAM)
+/*
+ * Continuous capture counterpart of adc_context_on_sampling_done(). Once a
+ * buffer holds 1 + extra_samplings samplings, sampling switches to the other
+ * buffer before the consumer is notified, so the capture never pauses while
+ * a filled buffer is processed.
+ */
+static inline void adc_context_on_stream_sampling_done(struct adc_context *ctx,
+						       const struct device *dev)
+{
+	if (ctx->sampling_index < ctx->options.extra_samplings) {
+		++ctx->sampling_index;
+		adc_context_update_buffer_pointer(ctx, false);
+	} else {
+		enum adc_action action = ADC_ACTION_CONTINUE;
+		void *filled = ctx->stream_buffers[ctx->stream_idx];
+
+		ctx->stream_idx ^= 1;
+		ctx->sequence.buffer = ctx->stream_buffers[ctx->stream_idx];
+		ctx->sampling_index = 0U;
+		adc_context_set_buffer_pointer(ctx, ctx->sequence.buffer);
+
+		if (ctx->options.stream_callback) {
+			action = ctx->options.stream_callback(dev,
+							      &ctx->sequence,
+							      filled);
+		}
+
+		if (action == ADC_ACTION_FINISH) {
+			if (ctx->options.interval_us != 0U) {
+				adc_context_disable_timer(ctx);
+			}
+			adc_context_complete(ctx, 0);
+			return;
+		}
+	}
+
+	if (ctx->options.interval_us == 0U) {
+		adc_context_start_sampling(ctx);
+	} else if (atomic_dec(&ctx->sampling_requested) > 1) {
+		adc_context_start_sampling(ctx);
+	}
+}
+#endif /* CONFIG_ADC_STREAM && ADC_CONTEXT_SUPPORTS_STREAM */
+
 /*
  * This function should be called after a sampling (of one or more channels,
  * depending on the realized sequence) is done. It calls the defined callback
@@ -206,6 +287,12 @@ static inline void adc_context_on_sampling_done(struct adc_context *ctx,
 						const struct device *dev)
 {
 	if (ctx->sequence.options) {
+#if defined(CONFIG_ADC_STREAM) && defined(ADC_CONTEXT_SUPPORTS_STREAM)
+		if (ctx->streaming) {
+			adc_context_on_stream_sampling_done(ctx, dev);
+			return;
+		}
+#endif
 		adc_sequence_callback callback = ctx->options.callback;
 		enum adc_action action;
 		bool finish = false;
@@ -21,6 +21,9 @@
 LOG_MODULE_REGISTER(adc_mcp320x, CONFIG_ADC_LOG_LEVEL);
 
 #define ADC_CONTEXT_USES_KERNEL_TIMER
+#ifdef CONFIG_ADC_STREAM
+#define ADC_CONTEXT_SUPPORTS_STREAM
+#endif
 #include "adc_context.h"
 
 #define MCP320X_RESOLUTION 12U
@@ -180,6 +183,16 @@ static void adc_context_update_buffer_pointer(struct adc_context *ctx,
 	}
 }
 
+#ifdef ADC_CONTEXT_SUPPORTS_STREAM
+static void adc_context_set_buffer_pointer(struct adc_context *ctx,
+					   void *buffer)
+{
+	struct mcp320x_data *data = CONTAINER_OF(ctx, struct mcp320x_data, ctx);
+
+	data->buffer = buffer;
+}
+#endif
+
 static int mcp320x_read_channel(const struct device *dev, uint8_t channel,
 				uint16_t *result)
 {
@@ -18,6 +18,9 @@
 #include <soc.h>
 
 #define ADC_CONTEXT_USES_KERNEL_TIMER
+#ifdef CONFIG_ADC_STREAM
+#define ADC_CONTEXT_SUPPORTS_STREAM
+#endif
 #include "adc_context.h"
 
 #define LOG_LEVEL CONFIG_ADC_LOG_LEVEL
@@ -386,6 +389,17 @@ static void adc_context_update_buffer_pointer(struct adc_context *ctx,
 	}
 }
 
+#ifdef ADC_CONTEXT_SUPPORTS_STREAM
+static void adc_context_set_buffer_pointer(struct adc_context *ctx,
+					   void *buffer)
+{
+	struct adc_stm32_data *data =
+		CONTAINER_OF(ctx, struct adc_stm32_data, ctx);
+
+	data->buffer = buffer;
+}
+#endif
+
 static void adc_stm32_isr(const struct device *dev)
 {
 	struct adc_stm32_data *data = (struct adc_stm32_data *)dev->data;
@@ -71,6 +71,24 @@ static struct {
 
 static const struct device *h4_dev;
 
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+static struct {
+	uint8_t scratch[33];
+
+	size_t  len;
+	bool    active;
+} rx_async;
+
+static void rx_async_resume(void);
+
+#define h4_rx_resume() rx_async_resume()
+#define h4_rx_pause()
+#else
+#define h4_rx_resume() uart_irq_rx_enable(h4_dev)
+#define h4_rx_pause()  uart_irq_rx_disable(h4_dev)
+#endif
+
+#if !defined(CONFIG_BT_H4_ASYNC_UART)
 static inline void h4_get_type(void)
 {
 	/* Get packet type */
@@ -164,7 +182,7 @@ static inline void get_evt_hdr(void)
 		rx.have_hdr = true;
 	}
 }
-
+#endif /* !CONFIG_BT_H4_ASYNC_UART */
 
 static inline void copy_hdr(struct net_buf *buf)
 {
@@ -228,11 +246,11 @@ static void rx_thread(void *p1, void *p2, void *p3)
 		}
 
 		/* Let the ISR continue receiving new packets */
-		uart_irq_rx_enable(h4_dev);
+		h4_rx_resume();
 
 		buf = net_buf_get(&rx.fifo, K_FOREVER);
 		do {
-			uart_irq_rx_enable(h4_dev);
+			h4_rx_resume();
 
 			BT_DBG("Calling bt_recv(%p)", buf);
 			bt_recv(buf);
@@ -243,7 +261,7 @@ static void rx_thread(void *p1, void *p2, void *p3)
 			 */
 			k_yield();
 
-			uart_irq_rx_disable(h4_dev);
+			h4_rx_pause();
 			buf = net_buf_get(&rx.fifo, K_NO_WAIT);
 		} while (buf);
 	}
@@ -256,6 +274,286 @@ static size_t h4_discard(const struct device *uart, size_t len)
 	return uart_fifo_read(uart, buf, MIN(len, sizeof(buf)));
 }
 
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+static inline void rx_async_get_type(uint8_t type)
+{
+	rx.type = type;
+
+	switch (rx.type) {
+	case H4_EVT:
+		rx.remaining = sizeof(rx.evt);
+		rx.hdr_len = rx.remaining;
+		break;
+	case H4_ACL:
+		rx.remaining = sizeof(rx.acl);
+		rx.hdr_len = rx.remaining;
+		break;
+	case H4_ISO:
+		if (IS_ENABLED(CONFIG_BT_ISO)) {
+			rx.remaining = sizeof(rx.iso);
+			rx.hdr_len = rx.remaining;
+			break;
+		}
+		__fallthrough;
+	default:
+		BT_ERR("Unknown H:4 type 0x%02x", rx.type);
+		rx.type = H4_NONE;
+	}
+}
+
+static void rx_async_hdr_done(void)
+{
+	if (rx.type == H4_EVT) {
+		struct bt_hci_evt_hdr *hdr = &rx.evt;
+
+		if (rx.hdr_len == sizeof(*hdr)) {
+			switch (rx.evt.evt) {
+			case BT_HCI_EVT_LE_META_EVENT:
+				/* Receive the subevent code as part of the
+				 * header, before the buffer is allocated.
+				 */
+				rx.remaining = 1U;
+				rx.hdr_len++;
+				return;
+#if defined(CONFIG_BT_BREDR)
+			case BT_HCI_EVT_INQUIRY_RESULT_WITH_RSSI:
+			case BT_HCI_EVT_EXTENDED_INQUIRY_RESULT:
+				rx.discardable = true;
+				break;
+#endif
+			}
+		}
+
+		if (rx.evt.evt == BT_HCI_EVT_LE_META_EVENT &&
+		    rx.hdr[sizeof(*hdr)] == BT_HCI_EVT_LE_ADVERTISING_REPORT) {
+			BT_DBG("Marking adv report as discardable");
+			rx.discardable = true;
+		}
+
+		rx.remaining = hdr->len - (rx.hdr_len - sizeof(*hdr));
+		BT_DBG("Got event header. Payload %u bytes", hdr->len);
+	} else if (rx.type == H4_ACL) {
+		rx.remaining = sys_le16_to_cpu(rx.acl.len);
+		BT_DBG("Got ACL header. Payload %u bytes", rx.remaining);
+	} else {
+		rx.remaining = sys_le16_to_cpu(rx.iso.len);
+		BT_DBG("Got ISO header. Payload %u bytes", rx.remaining);
+	}
+
+	rx.have_hdr = true;
+}
+
+static void rx_async_complete(void)
+{
+	struct net_buf *buf = rx.buf;
+	uint8_t evt_flags;
+
+	rx.buf = NULL;
+
+	if (rx.type == H4_EVT) {
+		evt_flags = bt_hci_evt_get_flags(rx.evt.evt);
+		bt_buf_set_type(buf, BT_BUF_EVT);
+	} else {
+		evt_flags = BT_HCI_EVT_FLAG_RECV;
+		bt_buf_set_type(buf, BT_BUF_ACL_IN);
+	}
+
+	reset_rx();
+
+	if (evt_flags & BT_HCI_EVT_FLAG_RECV_PRIO) {
+		BT_DBG("Calling bt_recv_prio(%p)", buf);
+		bt_recv_prio(buf);
+	}
+
+	if (evt_flags & BT_HCI_EVT_FLAG_RECV) {
+		BT_DBG("Putting buf %p to rx fifo", buf);
+		net_buf_put(&rx.fifo, buf);
+	}
+}
+
+static void rx_async_start(void)
+{
+	uint8_t *dst;
+	size_t len;
+	int err;
+
+	while (true) {
+		if (rx.discard) {
+			dst = rx_async.scratch;
+			len = MIN(rx.discard, sizeof(rx_async.scratch));
+		} else if (rx.type == H4_NONE) {
+			dst = rx_async.scratch;
+			len = 1U;
+		} else if (!rx.have_hdr) {
+			dst = &rx.hdr[rx.hdr_len - rx.remaining];
+			len = rx.remaining;
+		} else {
+			if (!rx.buf) {
+				rx.buf = get_rx(K_NO_WAIT);
+				if (!rx.buf) {
+					if (rx.discardable) {
+						BT_WARN("Discarding event 0x%02x",
+							rx.evt.evt);
+						rx.discard = rx.remaining;
+						reset_rx();
+						continue;
+					}
+
+					BT_WARN("Failed to allocate, deferring to rx_thread");
+					return;
+				}
+
+				BT_DBG("Allocated rx.buf %p", rx.buf);
+
+				if (rx.remaining > net_buf_tailroom(rx.buf)) {
+					BT_ERR("Not enough space in buffer");
+					rx.discard = rx.remaining;
+					reset_rx();
+					continue;
+				}
+
+				copy_hdr(rx.buf);
+			}
+
+			if (!rx.remaining) {
+				rx_async_complete();
+				continue;
+			}
+
+			dst = net_buf_tail(rx.buf);
+			len = rx.remaining;
+		}
+
+		break;
+	}
+
+	rx_async.len = 0U;
+	rx_async.active = true;
+
+	/* The requested length is always the exact remainder of the
+	 * protocol element being received, so whole packets complete
+	 * with a single transfer completion interrupt.
+	 */
+	err = uart_rx_enable(h4_dev, dst, len, SYS_FOREVER_MS);
+	if (err) {
+		BT_ERR("Unable to enable RX (err %d)", err);
+		rx_async.active = false;
+	}
+}
+
+static void rx_async_process(void)
+{
+	size_t len = rx_async.len;
+
+	BT_DBG("len %u remaining %u discard %u have_hdr %u rx.buf %p",
+	       len, rx.remaining, rx.discard, rx.have_hdr, rx.buf);
+
+	if (rx.discard) {
+		rx.discard -= MIN(rx.discard, len);
+	} else if (rx.type == H4_NONE) {
+		if (len == 1U) {
+			rx_async_get_type(rx_async.scratch[0]);
+		}
+	} else if (!rx.have_hdr) {
+		rx.remaining -= len;
+		if (!rx.remaining) {
+			rx_async_hdr_done();
+		}
+	} else if (rx.buf) {
+		net_buf_add(rx.buf, len);
+		rx.remaining -= len;
+	}
+
+	rx_async_start();
+}
+
+static void rx_async_resume(void)
+{
+	unsigned int key;
+
+	key = irq_lock();
+	if (!rx_async.active) {
+		rx_async_start();
+	}
+	irq_unlock(key);
+}
+
+static void tx_async_start(void)
+{
+	uint8_t type;
+	int err;
+
+	while (!tx.buf) {
+		tx.buf = net_buf_get(&tx.fifo, K_NO_WAIT);
+		if (!tx.buf) {
+			return;
+		}
+
+		switch (bt_buf_get_type(tx.buf)) {
+		case BT_BUF_ACL_OUT:
+			type = H4_ACL;
+			break;
+		case BT_BUF_CMD:
+			type = H4_CMD;
+			break;
+		case BT_BUF_ISO_OUT:
+			if (IS_ENABLED(CONFIG_BT_ISO)) {
+				type = H4_ISO;
+				break;
+			}
+			__fallthrough;
+		default:
+			BT_ERR("Unknown buffer type");
+			net_buf_unref(tx.buf);
+			tx.buf = NULL;
+			continue;
+		}
+
+		/* One transfer covers the packet indicator and the whole
+		 * HCI packet, using the headroom reserved by the host.
+		 */
+		net_buf_push_u8(tx.buf, type);
+
+		err = uart_tx(h4_dev, tx.buf->data, tx.buf->len,
+			      SYS_FOREVER_MS);
+		if (err) {
+			BT_ERR("Unable to start TX (err %d)", err);
+			net_buf_unref(tx.buf);
+			tx.buf = NULL;
+		}
+	}
+}
+
+static void uart_async_cb(const struct device *dev, struct uart_event *evt,
+			  void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		if (tx.buf) {
+			net_buf_unref(tx.buf);
+			tx.buf = NULL;
+		}
+		tx_async_start();
+		break;
+	case UART_RX_RDY:
+		rx_async.len += evt->data.rx.len;
+		break;
+	case UART_RX_DISABLED:
+		rx_async.active = false;
+		rx_async_process();
+		break;
+	case UART_RX_STOPPED:
+		BT_ERR("RX error %d", evt->data.rx_stop.reason);
+		break;
+	default:
+		break;
+	}
+}
+#else /* !CONFIG_BT_H4_ASYNC_UART */
 static inline void read_payload(void)
 {
 	struct net_buf *buf;
@@ -448,13 +746,22 @@ static void bt_uart_isr(const struct device *unused, void *user_data)
 		}
 	}
 }
+#endif /* !CONFIG_BT_H4_ASYNC_UART */
 
 static int h4_send(struct net_buf *buf)
 {
 	BT_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf), buf->len);
 
 	net_buf_put(&tx.fifo, buf);
+
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+	unsigned int key = irq_lock();
+
+	tx_async_start();
+	irq_unlock(key);
+#else
 	uart_irq_tx_enable(h4_dev);
+#endif
 
 	return 0;
 }
@@ -477,15 +784,26 @@ static int h4_open(void)
 
 	BT_DBG("");
 
+#if !defined(CONFIG_BT_H4_ASYNC_UART)
 	uart_irq_rx_disable(h4_dev);
 	uart_irq_tx_disable(h4_dev);
+#endif
 
 	ret = bt_hci_transport_setup(h4_dev);
 	if (ret < 0) {
 		return -EIO;
 	}
 
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+	ret = uart_callback_set(h4_dev, uart_async_cb, NULL);
+	if (ret < 0) {
+		return -EIO;
+	}
+
+	rx_async_resume();
+#else
 	uart_irq_callback_set(h4_dev, bt_uart_isr);
+#endif
 
 	k_thread_create(&rx_thread_data, rx_thread_stack,
 			K_KERNEL_STACK_SIZEOF(rx_thread_stack),
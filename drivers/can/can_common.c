@@ -100,11 +100,40 @@ static inline void can_work_buffer_free_next(struct can_frame_buffer *buffer)
 	buffer->tail = next_tail;
 }
 
+static inline int can_work_buffer_contig(struct can_frame_buffer *buffer)
+{
+	uint16_t head = buffer->head;
+
+	if (head == buffer->tail) {
+		return 0;
+	}
+
+	if (head == WORK_BUF_FULL || head < buffer->tail) {
+		return CONFIG_CAN_WORKQ_FRAMES_BUF_CNT - buffer->tail;
+	}
+
+	return head - buffer->tail;
+}
+
 static void can_work_handler(struct k_work *work)
 {
 	struct zcan_work *can_work = CONTAINER_OF(work, struct zcan_work,
 						  work_item);
 	struct zcan_frame *frame;
+	int count;
+
+	if (can_work->batch_cb != NULL) {
+		while ((count = can_work_buffer_contig(&can_work->buf)) > 0) {
+			can_work->batch_cb(
+				&can_work->buf.buf[can_work->buf.tail],
+				count, can_work->cb_arg);
+			while (count-- > 0) {
+				can_work_buffer_free_next(&can_work->buf);
+			}
+		}
+
+		return;
+	}
 
 	while ((frame = can_work_buffer_get_next(&can_work->buf))) {
 		can_work->cb(frame, can_work->cb_arg);
@@ -138,8 +167,50 @@ int can_attach_workq(const struct device *dev, struct k_work_q *work_q,
 	k_work_init(&work->work_item, can_work_handler);
 	work->work_queue = work_q;
 	work->cb = callback;
+	work->batch_cb = NULL;
 	work->cb_arg = callback_arg;
 	can_work_buffer_init(&work->buf);
 
 	return api->attach_isr(dev, can_work_isr_put, work, filter);
 }
+
+int can_attach_workq_batch(const struct device *dev, struct k_work_q *work_q,
+			   struct zcan_work *work,
+			   can_rx_batch_callback_t callback, void *callback_arg,
+			   const struct zcan_filter *filter)
+{
+	const struct can_driver_api *api = dev->api;
+
+	k_work_init(&work->work_item, can_work_handler);
+	work->work_queue = work_q;
+	work->cb = NULL;
+	work->batch_cb = callback;
+	work->cb_arg = callback_arg;
+	can_work_buffer_init(&work->buf);
+
+	return api->attach_isr(dev, can_work_isr_put, work, filter);
+}
+
+int can_attach_isr_bulk(const struct device *dev, can_rx_callback_t isr,
+			void *callback_arg, const struct zcan_filter *filters,
+			int filter_cnt, int *filter_ids)
+{
+	const struct can_driver_api *api = dev->api;
+	int i, id;
+
+	for (i = 0; i < filter_cnt; i++) {
+		id = api->attach_isr(dev, isr, callback_arg, &filters[i]);
+		if (id == CAN_NO_FREE_FILTER) {
+			/* roll back the filters attached so far */
+			while (--i >= 0) {
+				api->detach(dev, filter_ids[i]);
+			}
+
+			return CAN_NO_FREE_FILTER;
+		}
+
+		filter_ids[i] = id;
+	}
+
+	return 0;
+}
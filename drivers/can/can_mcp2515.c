@@ -486,6 +486,93 @@ static int mcp2515_send(const struct device *dev,
 	return 0;
 }
 
+#ifdef CONFIG_CAN_MCP2515_FILTER_INDEX
+#define MCP2515_FILTER_INDEX_SIZE (CONFIG_CAN_MCP2515_MAX_FILTER * 2)
+#define MCP2515_FILTER_INDEX_EMPTY 0xFF
+
+static uint8_t mcp2515_filter_index_hash(uint32_t id)
+{
+	return (id * 2654435769U) % MCP2515_FILTER_INDEX_SIZE;
+}
+
+/*
+ * A filter qualifies for the exact-match index when its identifier mask
+ * covers the full identifier, so every frame it matches hashes to the
+ * same bucket as the filter itself.
+ */
+static bool mcp2515_filter_is_exact(const struct zcan_filter *filter)
+{
+	if (filter->id_type == CAN_STANDARD_IDENTIFIER) {
+		return filter->std_id_mask == CAN_STD_ID_MASK;
+	}
+
+	return filter->ext_id_mask == CAN_EXT_ID_MASK;
+}
+
+static uint32_t mcp2515_filter_id(const struct zcan_filter *filter)
+{
+	return (filter->id_type == CAN_STANDARD_IDENTIFIER) ?
+		filter->std_id : filter->ext_id;
+}
+
+/*
+ * Rebuild the open-addressed index from scratch. Called with the device
+ * mutex held whenever a filter is attached or detached, which keeps the
+ * probe chains free of stale entries.
+ */
+static void mcp2515_rebuild_filter_index(struct mcp2515_data *dev_data)
+{
+	int filter_idx;
+	uint8_t probe;
+
+	memset(dev_data->filter_index, MCP2515_FILTER_INDEX_EMPTY,
+	       sizeof(dev_data->filter_index));
+	dev_data->filter_wildcard = 0U;
+
+	for (filter_idx = 0; filter_idx < CONFIG_CAN_MCP2515_MAX_FILTER;
+	     filter_idx++) {
+		if (!(BIT(filter_idx) & dev_data->filter_usage)) {
+			continue;
+		}
+
+		if (!mcp2515_filter_is_exact(&dev_data->filter[filter_idx])) {
+			dev_data->filter_wildcard |= BIT(filter_idx);
+			continue;
+		}
+
+		probe = mcp2515_filter_index_hash(
+			mcp2515_filter_id(&dev_data->filter[filter_idx]));
+		while (dev_data->filter_index[probe] !=
+		       MCP2515_FILTER_INDEX_EMPTY) {
+			probe = (probe + 1) % MCP2515_FILTER_INDEX_SIZE;
+		}
+
+		dev_data->filter_index[probe] = filter_idx;
+	}
+}
+
+/*
+ * Candidate filters for a received frame: all wildcard filters plus the
+ * probe chain of the frame identifier's bucket. Every candidate is still
+ * verified with mcp2515_filter_match() before delivery.
+ */
+static uint32_t mcp2515_filter_candidates(struct mcp2515_data *dev_data,
+					  struct zcan_frame *msg)
+{
+	uint32_t candidates = dev_data->filter_wildcard;
+	uint32_t id = (msg->id_type == CAN_STANDARD_IDENTIFIER) ?
+		       msg->std_id : msg->ext_id;
+	uint8_t probe = mcp2515_filter_index_hash(id);
+
+	while (dev_data->filter_index[probe] != MCP2515_FILTER_INDEX_EMPTY) {
+		candidates |= BIT(dev_data->filter_index[probe]);
+		probe = (probe + 1) % MCP2515_FILTER_INDEX_SIZE;
+	}
+
+	return candidates;
+}
+#endif /* CONFIG_CAN_MCP2515_FILTER_INDEX */
+
 static int mcp2515_attach_isr(const struct device *dev,
 			      can_rx_callback_t rx_cb,
 			      void *cb_arg,
@@ -512,6 +599,9 @@ static int mcp2515_attach_isr(const struct device *dev,
 		dev_data->rx_cb[filter_idx] = rx_cb;
 		dev_data->cb_arg[filter_idx] = cb_arg;
 
+#ifdef CONFIG_CAN_MCP2515_FILTER_INDEX
+		mcp2515_rebuild_filter_index(dev_data);
+#endif
 	} else {
 		filter_idx = CAN_NO_FREE_FILTER;
 	}
@@ -527,6 +617,9 @@ static void mcp2515_detach(const struct device *dev, int filter_nr)
 
 	k_mutex_lock(&dev_data->mutex, K_FOREVER);
 	dev_data->filter_usage &= ~BIT(filter_nr);
+#ifdef CONFIG_CAN_MCP2515_FILTER_INDEX
+	mcp2515_rebuild_filter_index(dev_data);
+#endif
 	k_mutex_unlock(&dev_data->mutex);
 }
 
@@ -567,14 +660,21 @@ static void mcp2515_rx_filter(const struct device *dev,
 {
 	struct mcp2515_data *dev_data = DEV_DATA(dev);
 	uint8_t filter_idx = 0U;
+	uint32_t candidates;
 	can_rx_callback_t callback;
 	struct zcan_frame tmp_msg;
 
 	k_mutex_lock(&dev_data->mutex, K_FOREVER);
 
+#ifdef CONFIG_CAN_MCP2515_FILTER_INDEX
+	candidates = mcp2515_filter_candidates(dev_data, msg);
+#else
+	candidates = dev_data->filter_usage;
+#endif
+
 	for (; filter_idx < CONFIG_CAN_MCP2515_MAX_FILTER; filter_idx++) {
-		if (!(BIT(filter_idx) & dev_data->filter_usage)) {
-			continue; /* filter slot empty */
+		if (!(BIT(filter_idx) & candidates)) {
+			continue; /* filter slot empty or not a candidate */
 		}
 
 		if (!mcp2515_filter_match(msg,
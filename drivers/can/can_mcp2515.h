@@ -46,6 +46,10 @@ struct mcp2515_data {
 
 	/* filter data */
 	uint32_t filter_usage;
+#ifdef CONFIG_CAN_MCP2515_FILTER_INDEX
+	uint8_t filter_index[CONFIG_CAN_MCP2515_MAX_FILTER * 2];
+	uint32_t filter_wildcard;
+#endif
 	can_rx_callback_t rx_cb[CONFIG_CAN_MCP2515_MAX_FILTER];
 	void *cb_arg[CONFIG_CAN_MCP2515_MAX_FILTER];
 	struct zcan_filter filter[CONFIG_CAN_MCP2515_MAX_FILTER];
@@ -52,6 +52,16 @@ static int mcux_gpt_get_value(const struct device *dev, uint32_t *ticks)
 	return 0;
 }
 
+static int mcux_gpt_get_value_addr(const struct device *dev,
+				   const volatile uint32_t **addr)
+{
+	const struct mcux_gpt_config *config = dev->config;
+
+	/* CNT holds the running count in ticks and is directly loadable */
+	*addr = &config->base->CNT;
+	return 0;
+}
+
 static int mcux_gpt_set_alarm(const struct device *dev, uint8_t chan_id,
 			      const struct counter_alarm_cfg *alarm_cfg)
 {
@@ -192,6 +202,7 @@ static const struct counter_driver_api mcux_gpt_driver_api = {
 	.start = mcux_gpt_start,
 	.stop = mcux_gpt_stop,
 	.get_value = mcux_gpt_get_value,
+	.get_value_addr = mcux_gpt_get_value_addr,
 	.set_alarm = mcux_gpt_set_alarm,
 	.cancel_alarm = mcux_gpt_cancel_alarm,
 	.set_top_value = mcux_gpt_set_top_value,
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file Alternate mbedTLS AES context routed through the crypto device API.
+ *
+ * Pulled in by mbedtls/aes.h when MBEDTLS_AES_ALT is defined (see
+ * CONFIG_CRYPTO_MBEDTLS_AES_ALT). The implementation lives in
+ * mbedtls_aes_alt.c.
+ */
+
+#ifndef AES_ALT_H
+#define AES_ALT_H
+
+#include <crypto/cipher.h>
+
+typedef struct mbedtls_aes_context {
+	/** Established crypto device session, valid when @a live is set. */
+	struct cipher_ctx session;
+
+	/** Raw key material, retained so sessions can be (re)established
+	 * lazily on first use and when the cipher mode changes.
+	 */
+	unsigned char key[32];
+	unsigned int keybits;
+
+	/** Cipher mode (CRYPTO_CIPHER_MODE_*) of the live session. */
+	enum cipher_mode session_mode;
+
+	/** Operation (CRYPTO_CIPHER_OP_*) of the live session. */
+	enum cipher_op session_op;
+
+	/** Non-zero when @a session is established with the driver. */
+	int live;
+} mbedtls_aes_context;
+
+#if defined(MBEDTLS_CIPHER_MODE_XTS)
+#error "MBEDTLS_CIPHER_MODE_XTS is not supported by the AES ALT glue"
+#endif
+
+#endif /* AES_ALT_H */
@@ -27,7 +27,7 @@
 #include <mbedtls/aes.h>
 
 #define MTLS_SUPPORT (CAP_RAW_KEY | CAP_SEPARATE_IO_BUFS | CAP_SYNC_OPS | \
-		      CAP_NO_IV_PREFIX)
+		      CAP_NO_IV_PREFIX | CAP_MULTIPART_OPS)
 
 #define LOG_LEVEL CONFIG_CRYPTO_LOG_LEVEL
 #include <logging/log.h>
@@ -41,6 +41,8 @@ struct mtls_shim_session {
 #endif
 		mbedtls_aes_context mtls_aes;
 	};
+	/* Running IV for CBC multi-part operations */
+	uint8_t iv_state[16];
 	bool in_use;
 	enum cipher_mode mode;
 };
@@ -58,6 +60,8 @@ struct mtls_shim_session mtls_sessions[CRYPTO_MAX_SESSION];
 #define MTLS_GET_CTX(c, m) \
 	(&((struct mtls_shim_session *)c->drv_sessn_state)->mtls_ ## m)
 
+#define MTLS_GET_SESSION(c) ((struct mtls_shim_session *)c->drv_sessn_state)
+
 int mtls_ecb_encrypt(struct cipher_ctx *ctx, struct cipher_pkt *pkt)
 {
 	int ret;
@@ -114,7 +118,13 @@ int mtls_cbc_encrypt(struct cipher_ctx *ctx, struct cipher_pkt *pkt, uint8_t *iv
 	uint8_t *p_iv, iv_loc[16];
 	mbedtls_aes_context *cbc_ctx = MTLS_GET_CTX(ctx, aes);
 
-	if ((ctx->flags & CAP_NO_IV_PREFIX) == 0U) {
+	if (iv == NULL) {
+		/* Multi-part continuation: chain from the running IV kept in
+		 * the session state; no IV prefix is emitted.
+		 */
+		iv_bytes = 0;
+		p_iv = MTLS_GET_SESSION(ctx)->iv_state;
+	} else if ((ctx->flags & CAP_NO_IV_PREFIX) == 0U) {
 		/* Prefix IV to ciphertext, which is default behavior of Zephyr
 		 * crypto API, unless CAP_NO_IV_PREFIX is requested.
 		 */
@@ -134,6 +144,13 @@ int mtls_cbc_encrypt(struct cipher_ctx *ctx, struct cipher_pkt *pkt, uint8_t *iv
 		return -EINVAL;
 	}
 
+	/* mbedtls updates p_iv with the last ciphertext block; keep it so a
+	 * later call with a NULL IV can continue the chain.
+	 */
+	if (iv != NULL) {
+		memcpy(MTLS_GET_SESSION(ctx)->iv_state, p_iv, 16);
+	}
+
 	pkt->out_len = pkt->in_len + iv_bytes;
 
 	return 0;
@@ -145,7 +162,11 @@ int mtls_cbc_decrypt(struct cipher_ctx *ctx, struct cipher_pkt *pkt, uint8_t *iv
 	uint8_t *p_iv, iv_loc[16];
 	mbedtls_aes_context *cbc_ctx = MTLS_GET_CTX(ctx, aes);
 
-	if ((ctx->flags & CAP_NO_IV_PREFIX) == 0U) {
+	if (iv == NULL) {
+		/* Multi-part continuation, see mtls_cbc_encrypt() */
+		iv_bytes = 0;
+		p_iv = MTLS_GET_SESSION(ctx)->iv_state;
+	} else if ((ctx->flags & CAP_NO_IV_PREFIX) == 0U) {
 		iv_bytes = 16;
 		p_iv = iv;
 	} else {
@@ -161,6 +182,10 @@ int mtls_cbc_decrypt(struct cipher_ctx *ctx, struct cipher_pkt *pkt, uint8_t *iv
 		return -EINVAL;
 	}
 
+	if (iv != NULL) {
+		memcpy(MTLS_GET_SESSION(ctx)->iv_state, p_iv, 16);
+	}
+
 	pkt->out_len = pkt->in_len - iv_bytes;
 
 	return 0;
@@ -53,11 +53,20 @@ static int do_encrypt(struct cipher_ctx *ctx, uint8_t *in_buf, int in_len,
 
 	k_sem_take(&data->device_sem, K_FOREVER);
 
-	status = HAL_CRYP_SetConfig(&data->hcryp, &session->config);
-	if (status != HAL_OK) {
-		LOG_ERR("Configuration error");
-		k_sem_give(&data->device_sem);
-		return -EIO;
+	/* Reloading the full configuration (key schedule included) costs
+	 * more than a short operation itself; skip it when the peripheral
+	 * is still set up for this session and no new IV has to be loaded.
+	 */
+	if ((data->active_session != session) ||
+	    (session->config.pInitVect != NULL)) {
+		status = HAL_CRYP_SetConfig(&data->hcryp, &session->config);
+		if (status != HAL_OK) {
+			LOG_ERR("Configuration error");
+			data->active_session = NULL;
+			k_sem_give(&data->device_sem);
+			return -EIO;
+		}
+		data->active_session = session;
 	}
 
 	status = HAL_CRYP_Encrypt(&data->hcryp, (uint32_t *)in_buf, in_len,
@@ -83,11 +92,17 @@ static int do_decrypt(struct cipher_ctx *ctx, uint8_t *in_buf, int in_len,
 
 	k_sem_take(&data->device_sem, K_FOREVER);
 
-	status = HAL_CRYP_SetConfig(&data->hcryp, &session->config);
-	if (status != HAL_OK) {
-		LOG_ERR("Configuration error");
-		k_sem_give(&data->device_sem);
-		return -EIO;
+	/* See do_encrypt() */
+	if ((data->active_session != session) ||
+	    (session->config.pInitVect != NULL)) {
+		status = HAL_CRYP_SetConfig(&data->hcryp, &session->config);
+		if (status != HAL_OK) {
+			LOG_ERR("Configuration error");
+			data->active_session = NULL;
+			k_sem_give(&data->device_sem);
+			return -EIO;
+		}
+		data->active_session = session;
 	}
 
 	status = HAL_CRYP_Decrypt(&data->hcryp, (uint32_t *)in_buf, in_len,
@@ -392,6 +407,12 @@ static int crypto_stm32_session_free(const struct device *dev,
 
 	session->in_use = false;
 
+	k_sem_take(&data->device_sem, K_FOREVER);
+	if (data->active_session == session) {
+		data->active_session = NULL;
+	}
+	k_sem_give(&data->device_sem);
+
 	k_sem_take(&data->session_sem, K_FOREVER);
 
 	/* Disable peripheral only if there are no more active sessions. */
@@ -19,6 +19,10 @@ struct crypto_stm32_data {
 	CRYP_HandleTypeDef hcryp;
 	struct k_sem device_sem;
 	struct k_sem session_sem;
+	/* Session the peripheral is currently configured for, or NULL.
+	 * Used to skip redundant HAL_CRYP_SetConfig() calls.
+	 */
+	struct crypto_stm32_session *active_session;
 };
 
 struct crypto_stm32_session {
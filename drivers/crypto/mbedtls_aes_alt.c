@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file MBEDTLS_AES_ALT implementation backed by the crypto device API.
+ *
+ * Replaces the mbedTLS software AES with calls into a crypto device
+ * (CONFIG_CRYPTO_MBEDTLS_AES_ALT_DRV_NAME), so that TLS record
+ * processing uses the hardware engine on parts that have one. Driver
+ * sessions are cached in the AES context and only re-established when
+ * the key or the cipher mode changes, keeping the per-record cost to
+ * the crypto ops themselves. AES-GCM and the stream modes are built by
+ * mbedTLS (or here) on top of the single-block ECB primitive; CBC is
+ * handed to the driver as one operation per record when the device can
+ * run without an IV prefix, so DMA-capable engines see whole records.
+ */
+
+#include <kernel.h>
+#include <errno.h>
+#include <string.h>
+#include <crypto/cipher.h>
+
+#if !defined(CONFIG_MBEDTLS_CFG_FILE)
+#include "mbedtls/config.h"
+#else
+#include CONFIG_MBEDTLS_CFG_FILE
+#endif /* CONFIG_MBEDTLS_CFG_FILE */
+
+#include <mbedtls/aes.h>
+
+#if defined(MBEDTLS_AES_ALT)
+
+#define LOG_LEVEL CONFIG_CRYPTO_LOG_LEVEL
+#include <logging/log.h>
+LOG_MODULE_REGISTER(mbedtls_aes_alt);
+
+#define AES_ALT_DRV_NAME CONFIG_CRYPTO_MBEDTLS_AES_ALT_DRV_NAME
+
+static const struct device *aes_alt_dev;
+static int aes_alt_hw_caps;
+
+static int aes_alt_get_device(void)
+{
+	if (aes_alt_dev != NULL) {
+		return 0;
+	}
+
+	aes_alt_dev = device_get_binding(AES_ALT_DRV_NAME);
+	if (aes_alt_dev == NULL) {
+		LOG_ERR("Crypto device %s not found", AES_ALT_DRV_NAME);
+		return -ENODEV;
+	}
+
+	aes_alt_hw_caps = cipher_query_hwcaps(aes_alt_dev);
+
+	return 0;
+}
+
+static void aes_alt_session_drop(mbedtls_aes_context *ctx)
+{
+	if (ctx->live) {
+		(void)cipher_free_session(aes_alt_dev, &ctx->session);
+		ctx->live = 0;
+	}
+}
+
+/* Establishes (or reuses) a driver session for the given mode and
+ * operation. Sessions are cached in the context; a session is only torn
+ * down and re-created when the requested mode or operation differs from
+ * the live one, so back-to-back records reuse the loaded key schedule.
+ */
+static int aes_alt_session_get(mbedtls_aes_context *ctx,
+			       enum cipher_mode mode, enum cipher_op op)
+{
+	int ret;
+
+	if (ctx->live) {
+		if (ctx->session_mode == mode && ctx->session_op == op) {
+			return 0;
+		}
+		aes_alt_session_drop(ctx);
+	}
+
+	ret = aes_alt_get_device();
+	if (ret != 0) {
+		return ret;
+	}
+
+	ctx->session.keylen = ctx->keybits / 8U;
+	ctx->session.key.bit_stream = ctx->key;
+	ctx->session.flags = CAP_RAW_KEY | CAP_SYNC_OPS |
+			     CAP_SEPARATE_IO_BUFS;
+	if ((mode == CRYPTO_CIPHER_MODE_CBC) &&
+	    (aes_alt_hw_caps & CAP_NO_IV_PREFIX)) {
+		ctx->session.flags |= CAP_NO_IV_PREFIX;
+	}
+
+	ret = cipher_begin_session(aes_alt_dev, &ctx->session,
+				   CRYPTO_CIPHER_ALGO_AES, mode, op);
+	if (ret != 0) {
+		LOG_ERR("Failed to begin session (%d)", ret);
+		return ret;
+	}
+
+	ctx->session_mode = mode;
+	ctx->session_op = op;
+	ctx->live = 1;
+
+	return 0;
+}
+
+void mbedtls_aes_init(mbedtls_aes_context *ctx)
+{
+	(void)memset(ctx, 0, sizeof(*ctx));
+}
+
+void mbedtls_aes_free(mbedtls_aes_context *ctx)
+{
+	if (ctx == NULL) {
+		return;
+	}
+
+	aes_alt_session_drop(ctx);
+	(void)memset(ctx, 0, sizeof(*ctx));
+}
+
+static int aes_alt_setkey(mbedtls_aes_context *ctx, const unsigned char *key,
+			  unsigned int keybits)
+{
+	if (keybits != 128U && keybits != 192U && keybits != 256U) {
+		return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+	}
+
+	/* Invalidate any session established with the previous key. */
+	aes_alt_session_drop(ctx);
+
+	memcpy(ctx->key, key, keybits / 8U);
+	ctx->keybits = keybits;
+
+	return 0;
+}
+
+int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key,
+			   unsigned int keybits)
+{
+	return aes_alt_setkey(ctx, key, keybits);
+}
+
+int mbedtls_aes_setkey_dec(mbedtls_aes_context *ctx, const unsigned char *key,
+			   unsigned int keybits)
+{
+	return aes_alt_setkey(ctx, key, keybits);
+}
+
+static int aes_alt_ecb(mbedtls_aes_context *ctx, enum cipher_op op,
+		       const unsigned char input[16], unsigned char output[16])
+{
+	struct cipher_pkt pkt = {
+		.in_buf = (uint8_t *)input,
+		.in_len = 16,
+		.out_buf = output,
+		.out_buf_max = 16,
+	};
+	int ret;
+
+	ret = aes_alt_session_get(ctx, CRYPTO_CIPHER_MODE_ECB, op);
+	if (ret != 0) {
+		return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+	}
+
+	if (cipher_block_op(&ctx->session, &pkt) != 0) {
+		return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+	}
+
+	return 0;
+}
+
+int mbedtls_aes_crypt_ecb(mbedtls_aes_context *ctx, int mode,
+			  const unsigned char input[16],
+			  unsigned char output[16])
+{
+	return aes_alt_ecb(ctx, (mode == MBEDTLS_AES_ENCRYPT) ?
+				CRYPTO_CIPHER_OP_ENCRYPT :
+				CRYPTO_CIPHER_OP_DECRYPT,
+			   input, output);
+}
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+/* Software CBC chaining over the single-block primitive, used when the
+ * device cannot operate without an IV prefix in the IO buffers.
+ */
+static int aes_alt_cbc_by_block(mbedtls_aes_context *ctx, int mode,
+				size_t length, unsigned char iv[16],
+				const unsigned char *input,
+				unsigned char *output)
+{
+	unsigned char tmp[16];
+	int ret;
+
+	while (length > 0) {
+		if (mode == MBEDTLS_AES_DECRYPT) {
+			memcpy(tmp, input, 16);
+			ret = aes_alt_ecb(ctx, CRYPTO_CIPHER_OP_DECRYPT,
+					  input, output);
+			if (ret != 0) {
+				return ret;
+			}
+			for (int i = 0; i < 16; i++) {
+				output[i] ^= iv[i];
+			}
+			memcpy(iv, tmp, 16);
+		} else {
+			for (int i = 0; i < 16; i++) {
+				tmp[i] = input[i] ^ iv[i];
+			}
+			ret = aes_alt_ecb(ctx, CRYPTO_CIPHER_OP_ENCRYPT,
+					  tmp, output);
+			if (ret != 0) {
+				return ret;
+			}
+			memcpy(iv, output, 16);
+		}
+
+		input += 16;
+		output += 16;
+		length -= 16;
+	}
+
+	return 0;
+}
+
+int mbedtls_aes_crypt_cbc(mbedtls_aes_context *ctx, int mode, size_t length,
+			  unsigned char iv[16], const unsigned char *input,
+			  unsigned char *output)
+{
+	enum cipher_op op = (mode == MBEDTLS_AES_ENCRYPT) ?
+			    CRYPTO_CIPHER_OP_ENCRYPT : CRYPTO_CIPHER_OP_DECRYPT;
+	struct cipher_pkt pkt;
+	unsigned char next_iv[16];
+	int ret;
+
+	if (length % 16) {
+		return MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH;
+	}
+
+	if (length == 0) {
+		return 0;
+	}
+
+	ret = aes_alt_get_device();
+	if (ret != 0) {
+		return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+	}
+
+	if (!(aes_alt_hw_caps & CAP_NO_IV_PREFIX)) {
+		return aes_alt_cbc_by_block(ctx, mode, length, iv,
+					    input, output);
+	}
+
+	ret = aes_alt_session_get(ctx, CRYPTO_CIPHER_MODE_CBC, op);
+	if (ret != 0) {
+		return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+	}
+
+	/* Whole record in one driver call; DMA-capable engines process
+	 * it in a single transfer. Save the next chaining IV up front:
+	 * for decryption it is the last input ciphertext block, which an
+	 * in-place operation would overwrite.
+	 */
+	if (mode == MBEDTLS_AES_DECRYPT) {
+		memcpy(next_iv, input + length - 16, 16);
+	}
+
+	pkt.in_buf = (uint8_t *)input;
+	pkt.in_len = length;
+	pkt.out_buf = output;
+	pkt.out_buf_max = length;
+
+	if (cipher_cbc_op(&ctx->session, &pkt, iv) != 0) {
+		return MBEDTLS_ERR_AES_HW_ACCEL_FAILED;
+	}
+
+	if (mode == MBEDTLS_AES_ENCRYPT) {
+		memcpy(next_iv, output + length - 16, 16);
+	}
+	memcpy(iv, next_iv, 16);
+
+	return 0;
+}
+#endif /* MBEDTLS_CIPHER_MODE_CBC */
+
+#if defined(MBEDTLS_CIPHER_MODE_CFB)
+int mbedtls_aes_crypt_cfb128(mbedtls_aes_context *ctx, int mode, size_t length,
+			     size_t *iv_off, unsigned char iv[16],
+			     const unsigned char *input, unsigned char *output)
+{
+	size_t n = *iv_off;
+	int c;
+	int ret;
+
+	while (length--) {
+		if (n == 0) {
+			ret = aes_alt_ecb(ctx, CRYPTO_CIPHER_OP_ENCRYPT,
+					  iv, iv);
+			if (ret != 0) {
+				return ret;
+			}
+		}
+
+		if (mode == MBEDTLS_AES_DECRYPT) {
+			c = *input++;
+			*output++ = (unsigned char)(c ^ iv[n]);
+			iv[n] = (unsigned char)c;
+		} else {
+			iv[n] = *output++ = (unsigned char)(iv[n] ^ *input++);
+		}
+
+		n = (n + 1) & 0x0F;
+	}
+
+	*iv_off = n;
+
+	return 0;
+}
+
+int mbedtls_aes_crypt_cfb8(mbedtls_aes_context *ctx, int mode, size_t length,
+			   unsigned char iv[16], const unsigned char *input,
+			   unsigned char *output)
+{
+	unsigned char c;
+	unsigned char ov[17];
+	int ret;
+
+	while (length--) {
+		memcpy(ov, iv, 16);
+		ret = aes_alt_ecb(ctx, CRYPTO_CIPHER_OP_ENCRYPT, iv, iv);
+		if (ret != 0) {
+			return ret;
+		}
+
+		if (mode == MBEDTLS_AES_DECRYPT) {
+			ov[16] = *input;
+		}
+
+		c = *output++ = (unsigned char)(iv[0] ^ *input++);
+
+		if (mode == MBEDTLS_AES_ENCRYPT) {
+			ov[16] = c;
+		}
+
+		memcpy(iv, ov + 1, 16);
+	}
+
+	return 0;
+}
+#endif /* MBEDTLS_CIPHER_MODE_CFB */
+
+#if defined(MBEDTLS_CIPHER_MODE_OFB)
+int mbedtls_aes_crypt_ofb(mbedtls_aes_context *ctx, size_t length,
+			  size_t *iv_off, unsigned char iv[16],
+			  const unsigned char *input, unsigned char *output)
+{
+	size_t n = *iv_off;
+	int ret;
+
+	while (length--) {
+		if (n == 0) {
+			ret = aes_alt_ecb(ctx, CRYPTO_CIPHER_OP_ENCRYPT,
+					  iv, iv);
+			if (ret != 0) {
+				return ret;
+			}
+		}
+		*output++ = *input++ ^ iv[n];
+
+		n = (n + 1) & 0x0F;
+	}
+
+	*iv_off = n;
+
+	return 0;
+}
+#endif /* MBEDTLS_CIPHER_MODE_OFB */
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+int mbedtls_aes_crypt_ctr(mbedtls_aes_context *ctx, size_t length,
+			  size_t *nc_off, unsigned char nonce_counter[16],
+			  unsigned char stream_block[16],
+			  const unsigned char *input, unsigned char *output)
+{
+	unsigned char c;
+	size_t n = *nc_off;
+	int ret;
+
+	while (length--) {
+		if (n == 0) {
+			ret = aes_alt_ecb(ctx, CRYPTO_CIPHER_OP_ENCRYPT,
+					  nonce_counter, stream_block);
+			if (ret != 0) {
+				return ret;
+			}
+
+			for (int i = 16; i > 0; i--) {
+				if (++nonce_counter[i - 1] != 0) {
+					break;
+				}
+			}
+		}
+		c = *input++;
+		*output++ = (unsigned char)(c ^ stream_block[n]);
+
+		n = (n + 1) & 0x0F;
+	}
+
+	*nc_off = n;
+
+	return 0;
+}
+#endif /* MBEDTLS_CIPHER_MODE_CTR */
+
+#endif /* MBEDTLS_AES_ALT */
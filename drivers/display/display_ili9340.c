@@ -56,6 +56,17 @@ struct ili9340_data {
 	uint8_t bytes_per_pixel;
 	enum display_pixel_format pixel_format;
 	enum display_orientation orientation;
+#ifdef CONFIG_DISPLAY_ASYNC_WRITE
+	const struct device *dev;
+	struct k_work async_work;
+	uint16_t async_x;
+	uint16_t async_y;
+	struct display_buffer_descriptor async_desc;
+	const void *async_buf;
+	display_write_callback_t async_callback;
+	void *async_user_data;
+	atomic_t async_busy;
+#endif
 };
 
 static int ili9340_transmit(const struct device *dev, uint8_t cmd,
@@ -205,6 +216,55 @@ static int ili9340_write(const struct device *dev, const uint16_t x,
 	return 0;
 }
 
+#ifdef CONFIG_DISPLAY_ASYNC_WRITE
+static void ili9340_write_async_handler(struct k_work *work)
+{
+	struct ili9340_data *data =
+		CONTAINER_OF(work, struct ili9340_data, async_work);
+	const struct device *dev = data->dev;
+	display_write_callback_t callback = data->async_callback;
+	void *user_data = data->async_user_data;
+	int r;
+
+	r = ili9340_write(dev, data->async_x, data->async_y,
+			  &data->async_desc, data->async_buf);
+
+	/* Release the slot before the callback so that the next region
+	 * can be submitted from within it.
+	 */
+	atomic_clear(&data->async_busy);
+
+	if (callback != NULL) {
+		callback(dev, r, user_data);
+	}
+}
+
+static int ili9340_write_async(const struct device *dev, const uint16_t x,
+			       const uint16_t y,
+			       const struct display_buffer_descriptor *desc,
+			       const void *buf,
+			       display_write_callback_t callback,
+			       void *user_data)
+{
+	struct ili9340_data *data = (struct ili9340_data *)dev->data;
+
+	if (atomic_set(&data->async_busy, 1) != 0) {
+		return -EBUSY;
+	}
+
+	data->async_x = x;
+	data->async_y = y;
+	data->async_desc = *desc;
+	data->async_buf = buf;
+	data->async_callback = callback;
+	data->async_user_data = user_data;
+
+	k_work_submit(&data->async_work);
+
+	return 0;
+}
+#endif /* CONFIG_DISPLAY_ASYNC_WRITE */
+
 static int ili9340_read(const struct device *dev, const uint16_t x,
 			const uint16_t y,
 			const struct display_buffer_descriptor *desc,
@@ -444,6 +504,11 @@ static int ili9340_init(const struct device *dev)
 		return -ENODEV;
 	}
 
+#ifdef CONFIG_DISPLAY_ASYNC_WRITE
+	data->dev = dev;
+	k_work_init(&data->async_work, ili9340_write_async_handler);
+#endif
+
 	data->spi_config.frequency = config->spi_max_freq;
 	data->spi_config.operation = SPI_OP_MODE_MASTER | SPI_WORD_SET(8U);
 	data->spi_config.slave = config->spi_addr;
@@ -507,6 +572,9 @@ static const struct display_driver_api ili9340_api = {
 	.get_capabilities = ili9340_get_capabilities,
 	.set_pixel_format = ili9340_set_pixel_format,
 	.set_orientation = ili9340_set_orientation,
+#ifdef CONFIG_DISPLAY_ASYNC_WRITE
+	.write_async = ili9340_write_async,
+#endif
 };
 
 #define ILI9340_INIT(index)                                                    \
@@ -45,6 +45,13 @@ LOG_MODULE_REGISTER(dma_stm32, CONFIG_DMA_LOG_LEVEL);
 #endif
 #endif /* DT_NODE_HAS_STATUS(DT_DRV_INST(1), okay) */
 
+#ifdef CONFIG_DMA_STM32_SCATTER_GATHER
+DMA_STM32_EXPORT_API int dma_stm32_reload(const struct device *dev, uint32_t id,
+					  uint32_t src, uint32_t dst,
+					  size_t size);
+DMA_STM32_EXPORT_API int dma_stm32_start(const struct device *dev, uint32_t id);
+#endif /* CONFIG_DMA_STM32_SCATTER_GATHER */
+
 static uint32_t table_m_size[] = {
 	LL_DMA_MDATAALIGN_BYTE,
 	LL_DMA_MDATAALIGN_HALFWORD,
@@ -99,9 +106,34 @@ static void dma_stm32_irq_handler(const struct device *dev, uint32_t id)
 	/* the dma stream id is in range from STREAM_OFFSET..<dma-requests> */
 	if (dma_stm32_is_tc_active(dma, id)) {
 		dma_stm32_clear_tc(dma, id);
+
+#ifdef CONFIG_DMA_STM32_SCATTER_GATHER
+		/* This DMA has no descriptor lists; a block chain is
+		 * walked by reprogramming the stream from the
+		 * transfer-complete interrupt.
+		 */
+		if (stream->next_block != NULL) {
+			struct dma_block_config *next = stream->next_block;
+
+			stream->next_block = next->next_block;
+			stream->busy = true;
+			(void)dma_stm32_reload(dev, id + STREAM_OFFSET,
+					       next->source_address,
+					       next->dest_address,
+					       next->block_size);
+			return;
+		}
+#endif /* CONFIG_DMA_STM32_SCATTER_GATHER */
+
 #ifdef CONFIG_DMAMUX_STM32
 		stream->busy = false;
 #endif
+
+#ifdef CONFIG_DMA_STM32_SCATTER_GATHER
+		if (stream->linked_channel >= 0) {
+			(void)dma_stm32_start(dev, stream->linked_channel);
+		}
+#endif /* CONFIG_DMA_STM32_SCATTER_GATHER */
 		stream->dma_callback(dev, stream->user_data, callback_arg, 0);
 	} else if (dma_stm32_is_ht_active(dma, id)) {
 		dma_stm32_clear_ht(dma, id);
@@ -302,6 +334,16 @@ DMA_STM32_EXPORT_API int dma_stm32_configure(const struct device *dev,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_DMA_STM32_SCATTER_GATHER
+	for (struct dma_block_config *block = config->head_block->next_block;
+	     block != NULL; block = block->next_block) {
+		if (block->block_size > DMA_STM32_MAX_DATA_ITEMS) {
+			LOG_ERR("Data size too big: %d\n", block->block_size);
+			return -EINVAL;
+		}
+	}
+#endif /* CONFIG_DMA_STM32_SCATTER_GATHER */
+
 #ifdef CONFIG_DMA_STM32_V1
 	if ((config->channel_direction == MEMORY_TO_MEMORY) &&
 		(!dev_config->support_m2m)) {
@@ -345,6 +387,19 @@ DMA_STM32_EXPORT_API int dma_stm32_configure(const struct device *dev,
 	stream->src_size	= config->source_data_size;
 	stream->dst_size	= config->dest_data_size;
 
+#ifdef CONFIG_DMA_STM32_SCATTER_GATHER
+	/* The whole chain reuses the head block transfer settings; the
+	 * interrupt handler walks the list, so the blocks must stay
+	 * valid until the completion callback runs.
+	 */
+	stream->next_block = config->head_block->next_block;
+	if (config->source_chaining_en || config->dest_chaining_en) {
+		stream->linked_channel = config->linked_channel;
+	} else {
+		stream->linked_channel = -1;
+	}
+#endif /* CONFIG_DMA_STM32_SCATTER_GATHER */
+
 	/* check dest or source memory address, warn if 0 */
 	if ((config->head_block->source_address == 0)) {
 		LOG_WRN("source_buffer address is null.");
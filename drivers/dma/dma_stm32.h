@@ -25,6 +25,12 @@ struct dma_stm32_stream {
 	uint32_t dst_size;
 	void *user_data; /* holds the client data */
 	dma_callback_t dma_callback;
+#ifdef CONFIG_DMA_STM32_SCATTER_GATHER
+	/* remaining blocks of the configured chain, NULL on last block */
+	struct dma_block_config *next_block;
+	/* stream started when the chain completes, -1 when unused */
+	int linked_channel;
+#endif /* CONFIG_DMA_STM32_SCATTER_GATHER */
 };
 
 struct dma_stm32_data {
@@ -17,6 +17,11 @@
 static uint8_t rx_buffer[256];
 static size_t rx_buffer_len;
 
+/* Driver-owned buffer the framework builds responses into, standing in
+ * for the DMA-capable transmit buffer of a real peripheral.
+ */
+static uint8_t tx_buffer[256];
+
 /* Allow writing to rx buff at startup and block on reading. */
 static K_SEM_DEFINE(handler_owns, 0, 1);
 static K_SEM_DEFINE(dev_owns, 1, 1);
@@ -53,6 +58,15 @@ void ec_host_cmd_periph_sim_install_send_cb(ec_host_cmd_periph_api_send cb)
 	tx = cb;
 }
 
+int ec_host_cmd_periph_sim_get_tx_buf(const struct device *dev, uint8_t **buf,
+				      size_t *size)
+{
+	*buf = tx_buffer;
+	*size = sizeof(tx_buffer);
+
+	return 0;
+}
+
 int ec_host_cmd_periph_sim_data_received(const uint8_t *buffer, size_t len)
 {
 	if (sizeof(rx_buffer) < len) {
@@ -72,6 +86,7 @@ int ec_host_cmd_periph_sim_data_received(const uint8_t *buffer, size_t len)
 static const struct ec_host_cmd_periph_api ec_host_cmd_api = {
 	.init = &ec_host_cmd_periph_sim_init,
 	.send = &ec_host_cmd_periph_sim_send,
+	.get_tx_buf = &ec_host_cmd_periph_sim_get_tx_buf,
 };
 
 static int ec_host_cmd_sim_init(const struct device *dev)
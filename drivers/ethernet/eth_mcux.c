@@ -140,6 +140,12 @@ struct eth_context {
 	void (*generate_mac)(uint8_t *);
 	struct k_work phy_work;
 	struct k_delayed_work delayed_phy_work;
+#if defined(CONFIG_ETH_MCUX_RX_NAPI)
+	struct k_sem rx_sem;
+	struct k_thread rx_thread;
+	K_KERNEL_STACK_MEMBER(rx_thread_stack,
+			      CONFIG_ETH_MCUX_RX_THREAD_STACK_SIZE);
+#endif
 	/* TODO: FIXME. This Ethernet frame sized buffer is used for
 	 * interfacing with MCUX. How it works is that hardware uses
 	 * DMA scatter buffers to receive a frame, and then public
@@ -911,6 +917,51 @@ static inline void ts_register_tx_event(struct eth_context *context)
 }
 #endif /* CONFIG_PTP_CLOCK_MCUX */
 
+#if defined(CONFIG_ETH_MCUX_RX_NAPI)
+#define ETH_MCUX_RX_INT_MASK \
+	((uint32_t)kENET_RxFrameInterrupt | (uint32_t)kENET_RxBufferInterrupt)
+
+/* NAPI-style RX: the ISR masks the RX interrupt and wakes this thread,
+ * which drains the descriptor ring in batches and re-enables the
+ * interrupt once the ring is empty. Under load this turns the one
+ * interrupt-per-frame pattern into one interrupt per burst; frames
+ * arriving while masked keep their event flag pending in EIR, so
+ * unmasking cannot lose a wakeup.
+ */
+static void eth_mcux_rx_thread(void *arg1, void *unused1, void *unused2)
+{
+	struct eth_context *context = arg1;
+	uint32_t frame_length = 0U;
+	int budget;
+
+	ARG_UNUSED(unused1);
+	ARG_UNUSED(unused2);
+
+	while (1) {
+		k_sem_take(&context->rx_sem, K_FOREVER);
+
+		budget = CONFIG_ETH_MCUX_RX_BUDGET;
+
+		while (ENET_GetRxFrameSize(&context->enet_handle,
+					   &frame_length) !=
+		       kStatus_ENET_RxFrameEmpty) {
+			eth_rx(context);
+
+			if (--budget <= 0) {
+				/* Let same-priority threads run between
+				 * batches so a sustained flood cannot
+				 * monopolize the CPU.
+				 */
+				budget = CONFIG_ETH_MCUX_RX_BUDGET;
+				k_yield();
+			}
+		}
+
+		ENET_EnableInterrupts(context->base, ETH_MCUX_RX_INT_MASK);
+	}
+}
+#endif /* CONFIG_ETH_MCUX_RX_NAPI */
+
 static void eth_callback(ENET_Type *base, enet_handle_t *handle,
 			 enet_event_t event, void *param)
 {
@@ -918,7 +969,12 @@ static void eth_callback(ENET_Type *base, enet_handle_t *handle,
 
 	switch (event) {
 	case kENET_RxEvent:
+#if defined(CONFIG_ETH_MCUX_RX_NAPI)
+		ENET_DisableInterrupts(context->base, ETH_MCUX_RX_INT_MASK);
+		k_sem_give(&context->rx_sem);
+#else
 		eth_rx(context);
+#endif
 		break;
 	case kENET_TxEvent:
 #if defined(CONFIG_PTP_CLOCK_MCUX)
@@ -1050,6 +1106,16 @@ static int eth_init(const struct device *dev)
 	k_delayed_work_init(&context->delayed_phy_work,
 			    eth_mcux_delayed_phy_work);
 
+#if defined(CONFIG_ETH_MCUX_RX_NAPI)
+	k_sem_init(&context->rx_sem, 0, 1);
+	k_thread_create(&context->rx_thread, context->rx_thread_stack,
+			K_KERNEL_STACK_SIZEOF(context->rx_thread_stack),
+			eth_mcux_rx_thread, context, NULL, NULL,
+			K_PRIO_COOP(CONFIG_ETH_MCUX_RX_THREAD_PRIO),
+			0, K_NO_WAIT);
+	k_thread_name_set(&context->rx_thread, "mcux_eth_rx");
+#endif
+
 	if (context->generate_mac) {
 		context->generate_mac(context->mac_addr);
 	}
@@ -77,6 +77,24 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #define CACHE
 #endif
 
+#if defined(CONFIG_ETH_STM32_HAL_RX_NAPI)
+/* Mask/unmask the DMA receive interrupt. While masked, a received frame
+ * only sets its status flag; unmasking with the flag pending raises the
+ * interrupt immediately, so no wakeup can be lost.
+ */
+#if defined(CONFIG_SOC_SERIES_STM32H7X)
+#define ETH_RX_IRQ_DISABLE(heth) \
+	__HAL_ETH_DMA_DISABLE_IT(heth, ETH_DMACIER_RIE)
+#define ETH_RX_IRQ_ENABLE(heth) \
+	__HAL_ETH_DMA_ENABLE_IT(heth, ETH_DMACIER_RIE)
+#else
+#define ETH_RX_IRQ_DISABLE(heth) \
+	__HAL_ETH_DMA_DISABLE_IT(heth, ETH_DMA_IT_R)
+#define ETH_RX_IRQ_ENABLE(heth) \
+	__HAL_ETH_DMA_ENABLE_IT(heth, ETH_DMA_IT_R)
+#endif /* CONFIG_SOC_SERIES_STM32H7X */
+#endif /* CONFIG_ETH_STM32_HAL_RX_NAPI */
+
 static ETH_DMADescTypeDef dma_rx_desc_tab[ETH_RXBUFNB] CACHE ETH_DMA_MEM;
 static ETH_DMADescTypeDef dma_tx_desc_tab[ETH_TXBUFNB] CACHE ETH_DMA_MEM;
 static uint8_t dma_rx_buffer[ETH_RXBUFNB][ETH_RX_BUF_SIZE] CACHE ETH_DMA_MEM;
@@ -486,6 +504,9 @@ static void rx_thread(void *arg1, void *unused1, void *unused2)
 				net_eth_carrier_on(get_iface(dev_data,
 							     vlan_tag));
 			}
+#if defined(CONFIG_ETH_STM32_HAL_RX_NAPI)
+			int budget = CONFIG_ETH_STM32_HAL_RX_BUDGET;
+#endif
 			while ((pkt = eth_rx(dev, &vlan_tag)) != NULL) {
 				res = net_recv_data(net_pkt_iface(pkt), pkt);
 				if (res < 0) {
@@ -495,7 +516,22 @@ static void rx_thread(void *arg1, void *unused1, void *unused2)
 						"into RX queue: %d", res);
 					net_pkt_unref(pkt);
 				}
+#if defined(CONFIG_ETH_STM32_HAL_RX_NAPI)
+				if (--budget <= 0) {
+					/* Let same-priority threads run
+					 * between batches while the RX
+					 * interrupt stays masked.
+					 */
+					budget =
+					    CONFIG_ETH_STM32_HAL_RX_BUDGET;
+					k_yield();
+				}
+#endif
 			}
+#if defined(CONFIG_ETH_STM32_HAL_RX_NAPI)
+			/* Ring drained: take interrupts again. */
+			ETH_RX_IRQ_ENABLE(&dev_data->heth);
+#endif
 		} else if (res == -EAGAIN) {
 			/* semaphore timeout period expired, check link status */
 			hal_ret = read_eth_phy_register(&dev_data->heth,
@@ -608,6 +644,13 @@ void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth_handle)
 
 	__ASSERT_NO_MSG(dev_data != NULL);
 
+#if defined(CONFIG_ETH_STM32_HAL_RX_NAPI)
+	/* Stop taking an interrupt per frame: stay masked until the RX
+	 * thread has drained the descriptor ring.
+	 */
+	ETH_RX_IRQ_DISABLE(heth_handle);
+#endif
+
 	k_sem_give(&dev_data->rx_int_sem);
 }
 
@@ -103,6 +103,17 @@ struct spi_nor_data {
 	struct k_sem sem;
 	const struct device *spi;
 	struct spi_config spi_cfg;
+#ifdef CONFIG_FLASH_ASYNC
+	/* Pending asynchronous operation; WIP is polled from a delayed
+	 * work item instead of busy-waiting on the status register.
+	 */
+	struct k_delayed_work async_work;
+	const struct device *dev;
+	struct k_poll_signal *async_signal;
+	const uint8_t *async_src;	/* NULL for an erase */
+	off_t async_addr;
+	size_t async_size;
+#endif /* CONFIG_FLASH_ASYNC */
 #if DT_INST_SPI_DEV_HAS_CS_GPIOS(0)
 	struct spi_cs_control cs_ctrl;
 #endif /* DT_INST_SPI_DEV_HAS_CS_GPIOS(0) */
@@ -578,6 +589,240 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 	return ret;
 }
 
+#ifdef CONFIG_FLASH_ASYNC
+
+/* Poll period for WIP while an asynchronous operation is in flight */
+#define SPI_NOR_ASYNC_POLL_INTERVAL K_MSEC(1)
+
+/* Issue the next program or erase command of the pending asynchronous
+ * operation.
+ *
+ * @return 1 if a command was issued, 0 if the operation is complete,
+ * negative errno code on failure.
+ */
+static int spi_nor_async_step(const struct device *dev)
+{
+	struct spi_nor_data *data = dev->data;
+	int ret;
+
+	if (data->async_size == 0U) {
+		return 0;
+	}
+
+	spi_nor_cmd_write(dev, SPI_NOR_CMD_WREN);
+
+	if (data->async_src != NULL) {
+		const uint16_t page_size = dev_page_size(dev);
+		size_t to_write = data->async_size;
+
+		/* Don't write more than a page. */
+		if (to_write >= page_size) {
+			to_write = page_size;
+		}
+
+		/* Don't write across a page boundary */
+		if (((data->async_addr + to_write - 1U) / page_size)
+		    != (data->async_addr / page_size)) {
+			to_write = page_size - (data->async_addr % page_size);
+		}
+
+		ret = spi_nor_cmd_addr_write(dev, SPI_NOR_CMD_PP,
+					     data->async_addr,
+					     data->async_src, to_write);
+		if (ret != 0) {
+			return ret;
+		}
+
+		data->async_addr += to_write;
+		data->async_src += to_write;
+		data->async_size -= to_write;
+	} else if (data->async_size == dev_flash_size(dev)) {
+		/* chip erase */
+		spi_nor_cmd_write(dev, SPI_NOR_CMD_CE);
+		data->async_size = 0U;
+	} else {
+		const struct jesd216_erase_type *erase_types =
+			dev_erase_types(dev);
+		const struct jesd216_erase_type *bet = NULL;
+
+		for (uint8_t ei = 0; ei < JESD216_NUM_ERASE_TYPES; ++ei) {
+			const struct jesd216_erase_type *etp =
+				&erase_types[ei];
+
+			if ((etp->exp != 0)
+			    && SPI_NOR_IS_ALIGNED(data->async_addr, etp->exp)
+			    && SPI_NOR_IS_ALIGNED(data->async_size, etp->exp)
+			    && ((bet == NULL)
+				|| (etp->exp > bet->exp))) {
+				bet = etp;
+			}
+		}
+		if (bet == NULL) {
+			LOG_DBG("Can't erase %zu at 0x%lx",
+				data->async_size, (long)data->async_addr);
+			return -EINVAL;
+		}
+		spi_nor_cmd_addr_write(dev, bet->cmd, data->async_addr,
+				       NULL, 0);
+		data->async_addr += BIT(bet->exp);
+		data->async_size -= BIT(bet->exp);
+	}
+
+	return 1;
+}
+
+static void spi_nor_async_done(const struct device *dev, int result)
+{
+	struct spi_nor_data *data = dev->data;
+	struct k_poll_signal *sig = data->async_signal;
+
+	data->async_signal = NULL;
+	data->async_src = NULL;
+	data->async_size = 0U;
+
+	release_device(dev);
+
+	if (sig != NULL) {
+		k_poll_signal_raise(sig, result);
+	}
+}
+
+static void spi_nor_async_poll(struct k_work *work)
+{
+	struct k_delayed_work *dwork =
+		CONTAINER_OF(work, struct k_delayed_work, work);
+	struct spi_nor_data *data =
+		CONTAINER_OF(dwork, struct spi_nor_data, async_work);
+	const struct device *dev = data->dev;
+	uint8_t reg;
+	int ret;
+
+	ret = spi_nor_cmd_read(dev, SPI_NOR_CMD_RDSR, &reg, 1);
+	if ((ret == 0) && ((reg & SPI_NOR_WIP_BIT) != 0U)) {
+		k_delayed_work_submit(&data->async_work,
+				      SPI_NOR_ASYNC_POLL_INTERVAL);
+		return;
+	}
+
+	if (ret == 0) {
+		ret = spi_nor_async_step(dev);
+		if (ret > 0) {
+			k_delayed_work_submit(&data->async_work,
+					      SPI_NOR_ASYNC_POLL_INTERVAL);
+			return;
+		}
+	}
+
+	spi_nor_async_done(dev, ret);
+}
+
+/* Take the device for an asynchronous operation without blocking */
+static int acquire_device_async(const struct device *dev)
+{
+	if (IS_ENABLED(CONFIG_MULTITHREADING)) {
+		struct spi_nor_data *const driver_data = dev->data;
+
+		if (k_sem_take(&driver_data->sem, K_NO_WAIT) != 0) {
+			return -EBUSY;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_SPI_NOR_IDLE_IN_DPD)) {
+		exit_dpd(dev);
+	}
+
+	return 0;
+}
+
+static int spi_nor_start_async(const struct device *dev,
+			       struct k_poll_signal *async)
+{
+	struct spi_nor_data *data = dev->data;
+	int ret;
+
+	data->async_signal = async;
+
+	ret = spi_nor_async_step(dev);
+	if (ret < 0) {
+		data->async_signal = NULL;
+		data->async_src = NULL;
+		data->async_size = 0U;
+		release_device(dev);
+		return ret;
+	}
+
+	if (ret == 0) {
+		/* Nothing to do, complete right away. */
+		spi_nor_async_done(dev, 0);
+		return 0;
+	}
+
+	k_delayed_work_submit(&data->async_work, SPI_NOR_ASYNC_POLL_INTERVAL);
+
+	return 0;
+}
+
+static int spi_nor_write_async(const struct device *dev, off_t addr,
+			       const void *src, size_t size,
+			       struct k_poll_signal *async)
+{
+	const size_t flash_size = dev_flash_size(dev);
+	struct spi_nor_data *data = dev->data;
+	int ret;
+
+	/* should be between 0 and flash size */
+	if ((addr < 0) || ((size + addr) > flash_size)) {
+		return -EINVAL;
+	}
+
+	ret = acquire_device_async(dev);
+	if (ret != 0) {
+		return ret;
+	}
+
+	data->async_src = src;
+	data->async_addr = addr;
+	data->async_size = size;
+
+	return spi_nor_start_async(dev, async);
+}
+
+static int spi_nor_erase_async(const struct device *dev, off_t addr,
+			       size_t size, struct k_poll_signal *async)
+{
+	const size_t flash_size = dev_flash_size(dev);
+	struct spi_nor_data *data = dev->data;
+	int ret;
+
+	/* erase area must be subregion of device */
+	if ((addr < 0) || ((size + addr) > flash_size)) {
+		return -ENODEV;
+	}
+
+	/* address must be sector-aligned */
+	if (!SPI_NOR_IS_SECTOR_ALIGNED(addr)) {
+		return -EINVAL;
+	}
+
+	/* size must be a multiple of sectors */
+	if ((size % SPI_NOR_SECTOR_SIZE) != 0) {
+		return -EINVAL;
+	}
+
+	ret = acquire_device_async(dev);
+	if (ret != 0) {
+		return ret;
+	}
+
+	data->async_src = NULL;
+	data->async_addr = addr;
+	data->async_size = size;
+
+	return spi_nor_start_async(dev, async);
+}
+
+#endif /* CONFIG_FLASH_ASYNC */
+
 static int spi_nor_write_protection_set(const struct device *dev,
 					bool write_protect)
 {
@@ -926,6 +1171,16 @@ static int spi_nor_init(const struct device *dev)
 		k_sem_init(&driver_data->sem, 1, UINT_MAX);
 	}
 
+#ifdef CONFIG_FLASH_ASYNC
+	{
+		struct spi_nor_data *const driver_data = dev->data;
+
+		driver_data->dev = dev;
+		k_delayed_work_init(&driver_data->async_work,
+				    spi_nor_async_poll);
+	}
+#endif /* CONFIG_FLASH_ASYNC */
+
 	return spi_nor_configure(dev);
 }
 
@@ -972,6 +1227,10 @@ static const struct flash_driver_api spi_nor_api = {
 	.sfdp_read = spi_nor_sfdp_read,
 	.read_jedec_id = spi_nor_read_jedec_id,
 #endif
+#if defined(CONFIG_FLASH_ASYNC)
+	.write_async = spi_nor_write_async,
+	.erase_async = spi_nor_erase_async,
+#endif
 };
 
 #ifndef CONFIG_SPI_NOR_SFDP_RUNTIME
@@ -339,14 +339,15 @@ static int gpio_stm32_port_set_masked_raw(const struct device *dev,
 {
 	const struct gpio_stm32_config *cfg = dev->config;
 	GPIO_TypeDef *gpio = (GPIO_TypeDef *)cfg->base;
-	uint32_t port_value;
 
-	z_stm32_hsem_lock(CFG_HW_GPIO_SEMID, HSEM_LOCK_DEFAULT_RETRY);
-
-	port_value = LL_GPIO_ReadOutputPort(gpio);
-	LL_GPIO_WriteOutputPort(gpio, (port_value & ~mask) | (mask & value));
-
-	z_stm32_hsem_unlock(CFG_HW_GPIO_SEMID);
+	/*
+	 * BSRR sets (low half) and resets (high half) output bits in one
+	 * atomic register write, so masked updates need neither the
+	 * ODR read-modify-write nor the cross-core lock protecting it.
+	 * Valid on all series, including F1.
+	 */
+	WRITE_REG(gpio->BSRR, (mask & value & 0x0000ffffU) |
+			      ((mask & ~value & 0x0000ffffU) << 16));
 
 	return 0;
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2015 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Generic asynchronous I2C transfer support.  Controllers providing
+ * the transfer_async driver API get their transfers chained under
+ * interrupt/DMA control; for all other controllers, submitted
+ * transfers are queued here and issued one at a time from a common
+ * low-priority thread, so callers never block in i2c_transfer().
+ */
+
+#include <kernel.h>
+#include <drivers/i2c.h>
+
+struct i2c_async_txn {
+	void *fifo_reserved;
+	const struct device *dev;
+	struct i2c_msg *msgs;
+	uint8_t num_msgs;
+	uint16_t addr;
+	i2c_callback_t cb;
+	void *userdata;
+};
+
+K_MEM_SLAB_DEFINE(i2c_async_slab, sizeof(struct i2c_async_txn),
+		  CONFIG_I2C_ASYNC_QUEUE_SIZE, 4);
+
+K_FIFO_DEFINE(i2c_async_fifo);
+
+static void i2c_async_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct i2c_async_txn *txn =
+			k_fifo_get(&i2c_async_fifo, K_FOREVER);
+		const struct device *dev = txn->dev;
+		i2c_callback_t cb = txn->cb;
+		void *userdata = txn->userdata;
+		int ret;
+
+		ret = i2c_transfer(dev, txn->msgs, txn->num_msgs, txn->addr);
+
+		k_mem_slab_free(&i2c_async_slab, (void **)&txn);
+
+		if (cb != NULL) {
+			cb(dev, ret, userdata);
+		}
+	}
+}
+
+K_THREAD_DEFINE(i2c_async_tid, CONFIG_I2C_ASYNC_THREAD_STACK_SIZE,
+		i2c_async_thread, NULL, NULL, NULL,
+		CONFIG_I2C_ASYNC_THREAD_PRIORITY, 0, 0);
+
+int i2c_transfer_async(const struct device *dev,
+		       struct i2c_msg *msgs, uint8_t num_msgs,
+		       uint16_t addr, i2c_callback_t cb, void *userdata)
+{
+	const struct i2c_driver_api *api =
+		(const struct i2c_driver_api *)dev->api;
+	struct i2c_async_txn *txn;
+
+	if (api->transfer_async != NULL) {
+		return api->transfer_async(dev, msgs, num_msgs, addr,
+					   cb, userdata);
+	}
+
+	if (k_mem_slab_alloc(&i2c_async_slab, (void **)&txn,
+			     K_NO_WAIT) != 0) {
+		return -EAGAIN;
+	}
+
+	txn->dev = dev;
+	txn->msgs = msgs;
+	txn->num_msgs = num_msgs;
+	txn->addr = addr;
+	txn->cb = cb;
+	txn->userdata = userdata;
+
+	k_fifo_put(&i2c_async_fifo, txn);
+
+	return 0;
+}
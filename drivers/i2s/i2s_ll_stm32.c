@@ -562,6 +562,46 @@ rx_disable:
 	rx_stream_disable(stream, dev);
 }
 
+#ifdef CONFIG_I2S_STM32_TX_UNDERRUN_SILENCE
+/*
+ * Re-prime the interface with an all-zero block instead of stopping it,
+ * so playback resumes seamlessly once the application catches up.
+ */
+static int tx_get_silence_block(struct stream *stream)
+{
+	int ret;
+
+	ret = k_mem_slab_alloc(stream->cfg.mem_slab, &stream->mem_block,
+			       K_NO_WAIT);
+	if (ret < 0) {
+		return ret;
+	}
+
+	memset(stream->mem_block, 0, stream->cfg.block_size);
+
+	if (!stream->underrun) {
+		stream->underrun = true;
+		LOG_WRN("TX underrun, re-priming with silence");
+	}
+
+	return 0;
+}
+
+static void tx_underrun_clear(struct stream *stream)
+{
+	stream->underrun = false;
+}
+#else
+static int tx_get_silence_block(struct stream *stream)
+{
+	return -EIO;
+}
+
+static void tx_underrun_clear(struct stream *stream)
+{
+}
+#endif /* CONFIG_I2S_STM32_TX_UNDERRUN_SILENCE */
+
 static void dma_tx_callback(const struct device *dma_dev, void *arg,
 			    uint32_t channel, int status)
 {
@@ -602,12 +642,19 @@ static void dma_tx_callback(const struct device *dma_dev, void *arg,
 	if (ret < 0) {
 		if (stream->state == I2S_STATE_STOPPING) {
 			stream->state = I2S_STATE_READY;
-		} else {
+			goto tx_disable;
+		}
+
+		ret = tx_get_silence_block(stream);
+		if (ret < 0) {
 			stream->state = I2S_STATE_ERROR;
+			goto tx_disable;
 		}
-		goto tx_disable;
+		mem_block_size = stream->cfg.block_size;
+	} else {
+		tx_underrun_clear(stream);
+		k_sem_give(&stream->sem);
 	}
-	k_sem_give(&stream->sem);
 
 	/* Assure cache coherency before DMA read operation */
 	DCACHE_CLEAN(stream->mem_block, mem_block_size);
@@ -92,6 +92,9 @@ struct stream {
 	void *mem_block;
 	bool last_block;
 	bool master;
+#ifdef CONFIG_I2S_STM32_TX_UNDERRUN_SILENCE
+	bool underrun;
+#endif
 	int (*stream_start)(struct stream *, const struct device *dev);
 	void (*stream_disable)(struct stream *, const struct device *dev);
 	void (*queue_drop)(struct stream *);
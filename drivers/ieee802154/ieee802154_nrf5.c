@@ -82,89 +82,110 @@ static void nrf5_get_eui64(uint8_t *mac)
 	memcpy(mac + index, &factoryAddress, sizeof(factoryAddress) - index);
 }
 
-static void nrf5_rx_thread(void *arg1, void *arg2, void *arg3)
+static struct net_pkt *nrf5_rx_frame_to_pkt(struct nrf5_802154_data *nrf5_radio,
+					    struct nrf5_802154_rx_frame *rx_frame)
 {
-	struct nrf5_802154_data *nrf5_radio = (struct nrf5_802154_data *)arg1;
 	struct net_pkt *pkt;
-	struct nrf5_802154_rx_frame *rx_frame;
 	uint8_t pkt_len;
 
-	ARG_UNUSED(arg2);
-	ARG_UNUSED(arg3);
+	__ASSERT_NO_MSG(rx_frame->psdu);
 
-	while (1) {
-		pkt = NULL;
-		rx_frame = NULL;
+	/* rx_mpdu contains length, psdu, fcs|lqi
+	 * The last 2 bytes contain LQI or FCS, depending if
+	 * automatic CRC handling is enabled or not, respectively.
+	 */
+	if (IS_ENABLED(CONFIG_IEEE802154_RAW_MODE) ||
+	    IS_ENABLED(CONFIG_NET_L2_OPENTHREAD)) {
+		pkt_len = rx_frame->psdu[0];
+	} else {
+		pkt_len = rx_frame->psdu[0] -  NRF5_FCS_LENGTH;
+	}
 
-		LOG_DBG("Waiting for frame");
+	__ASSERT_NO_MSG(pkt_len <= CONFIG_NET_BUF_DATA_SIZE);
 
-		rx_frame = k_fifo_get(&nrf5_radio->rx_fifo, K_FOREVER);
+	LOG_DBG("Frame received");
 
-		__ASSERT_NO_MSG(rx_frame->psdu);
+	pkt = net_pkt_alloc_with_buffer(nrf5_radio->iface, pkt_len,
+					AF_UNSPEC, 0, K_NO_WAIT);
+	if (!pkt) {
+		LOG_ERR("No pkt available");
+		return NULL;
+	}
 
-		/* rx_mpdu contains length, psdu, fcs|lqi
-		 * The last 2 bytes contain LQI or FCS, depending if
-		 * automatic CRC handling is enabled or not, respectively.
-		 */
-		if (IS_ENABLED(CONFIG_IEEE802154_RAW_MODE) ||
-		    IS_ENABLED(CONFIG_NET_L2_OPENTHREAD)) {
-			pkt_len = rx_frame->psdu[0];
-		} else {
-			pkt_len = rx_frame->psdu[0] -  NRF5_FCS_LENGTH;
-		}
+	if (net_pkt_write(pkt, rx_frame->psdu + 1, pkt_len)) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
 
-		__ASSERT_NO_MSG(pkt_len <= CONFIG_NET_BUF_DATA_SIZE);
+	net_pkt_set_ieee802154_lqi(pkt, rx_frame->lqi);
+	net_pkt_set_ieee802154_rssi(pkt, rx_frame->rssi);
+	net_pkt_set_ieee802154_ack_fpb(pkt, rx_frame->ack_fpb);
 
-		LOG_DBG("Frame received");
+#if defined(CONFIG_NET_PKT_TIMESTAMP)
+	struct net_ptp_time timestamp = {
+		.second = rx_frame->time / USEC_PER_SEC,
+		.nanosecond =
+			(rx_frame->time % USEC_PER_SEC) * NSEC_PER_USEC
+	};
 
-		pkt = net_pkt_alloc_with_buffer(nrf5_radio->iface, pkt_len,
-						AF_UNSPEC, 0, K_NO_WAIT);
-		if (!pkt) {
-			LOG_ERR("No pkt available");
-			goto drop;
-		}
+	net_pkt_set_timestamp(pkt, &timestamp);
+#endif
 
-		if (net_pkt_write(pkt, rx_frame->psdu + 1, pkt_len)) {
-			goto drop;
-		}
+	LOG_DBG("Caught a packet (%u) (LQI: %u)",
+		 pkt_len, rx_frame->lqi);
 
-		net_pkt_set_ieee802154_lqi(pkt, rx_frame->lqi);
-		net_pkt_set_ieee802154_rssi(pkt, rx_frame->rssi);
-		net_pkt_set_ieee802154_ack_fpb(pkt, rx_frame->ack_fpb);
+	return pkt;
+}
 
-#if defined(CONFIG_NET_PKT_TIMESTAMP)
-		struct net_ptp_time timestamp = {
-			.second = rx_frame->time / USEC_PER_SEC,
-			.nanosecond =
-				(rx_frame->time % USEC_PER_SEC) * NSEC_PER_USEC
-		};
+static void nrf5_rx_thread(void *arg1, void *arg2, void *arg3)
+{
+	struct nrf5_802154_data *nrf5_radio = (struct nrf5_802154_data *)arg1;
+	struct net_pkt *pkts[NRF_802154_RX_BUFFERS];
+	struct nrf5_802154_rx_frame *rx_frame;
+	uint32_t cnt;
 
-		net_pkt_set_timestamp(pkt, &timestamp);
-#endif
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
 
-		LOG_DBG("Caught a packet (%u) (LQI: %u)",
-			 pkt_len, rx_frame->lqi);
+	while (1) {
+		LOG_DBG("Waiting for frame");
 
-		if (net_recv_data(nrf5_radio->iface, pkt) < 0) {
-			LOG_ERR("Packet dropped by NET stack");
-			goto drop;
-		}
+		rx_frame = k_fifo_get(&nrf5_radio->rx_fifo, K_FOREVER);
 
-		nrf_802154_buffer_free_raw(rx_frame->psdu);
-		rx_frame->psdu = NULL;
+		/* Drain every frame queued by the ISR into a batch,
+		 * returning each radio buffer as soon as its payload is
+		 * copied out. This way the radio regains its buffers at
+		 * copy speed and can keep receiving during a burst,
+		 * instead of holding them across the per-packet trip
+		 * through the net stack.
+		 */
+		cnt = 0U;
+		do {
+			pkts[cnt] = nrf5_rx_frame_to_pkt(nrf5_radio, rx_frame);
 
-		if (LOG_LEVEL >= LOG_LEVEL_DBG) {
-			log_stack_usage(&nrf5_radio->rx_thread);
-		}
+			nrf_802154_buffer_free_raw(rx_frame->psdu);
+			rx_frame->psdu = NULL;
+
+			if (pkts[cnt] != NULL) {
+				cnt++;
+			}
 
-		continue;
+			if (cnt == ARRAY_SIZE(pkts)) {
+				break;
+			}
 
-drop:
-		nrf_802154_buffer_free_raw(rx_frame->psdu);
-		rx_frame->psdu = NULL;
+			rx_frame = k_fifo_get(&nrf5_radio->rx_fifo, K_NO_WAIT);
+		} while (rx_frame != NULL);
 
-		if (pkt) {
-			net_pkt_unref(pkt);
+		for (uint32_t i = 0; i < cnt; i++) {
+			if (net_recv_data(nrf5_radio->iface, pkts[i]) < 0) {
+				LOG_ERR("Packet dropped by NET stack");
+				net_pkt_unref(pkts[i]);
+			}
+		}
+
+		if (LOG_LEVEL >= LOG_LEVEL_DBG) {
+			log_stack_usage(&nrf5_radio->rx_thread);
 		}
 	}
 }
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT zephyr_ipm_shm
+
+#include <errno.h>
+#include <string.h>
+#include <device.h>
+#include <drivers/ipm.h>
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(ipm_shm, CONFIG_IPM_LOG_LEVEL);
+
+/*
+ * Virtual IPM device moving message payloads through descriptor rings
+ * in shared memory. The backing mailbox is used only as a doorbell:
+ * the sender publishes descriptors and rings once per burst, and the
+ * receive side drains every pending descriptor from a single
+ * interrupt. Doorbells are further suppressed with a virtqueue-style
+ * armed flag, so a receiver that is already draining is not
+ * interrupted again.
+ *
+ * The shared region is split in two halves holding one ring each; the
+ * core with the "primary" devicetree property set transmits on the
+ * first half and receives on the second, the remote core does the
+ * opposite. Each core initializes only the fields it produces, so
+ * boot order does not matter. The region must be mapped uncached (or
+ * be coherent) on both cores.
+ */
+
+struct ipm_shm_desc {
+	uint32_t id;
+	uint32_t len;
+	uint8_t data[CONFIG_IPM_SHM_SLOT_SIZE];
+};
+
+struct ipm_shm_ring {
+	/* free-running producer index, written by the sending core */
+	volatile uint32_t head;
+	/* free-running consumer index, written by the receiving core */
+	volatile uint32_t tail;
+	/* consumer wants a doorbell for the next publish */
+	volatile uint32_t armed;
+	struct ipm_shm_desc descs[];
+};
+
+struct ipm_shm_config {
+	uintptr_t shm_addr;
+	size_t shm_size;
+	const char *mbox_name;
+	bool primary;
+};
+
+struct ipm_shm_data {
+	const struct device *dev;
+	const struct device *mbox;
+	struct ipm_shm_ring *tx;
+	struct ipm_shm_ring *rx;
+	/* descriptors per ring; indices are taken modulo this */
+	uint32_t slots;
+	ipm_callback_t callback;
+	void *callback_ctx;
+};
+
+static inline uint32_t ring_used(const struct ipm_shm_ring *ring)
+{
+	return ring->head - ring->tail;
+}
+
+static void ipm_shm_doorbell_cb(const struct device *mbox, void *user_data,
+				uint32_t id, volatile void *mbox_data)
+{
+	struct ipm_shm_data *data = user_data;
+	struct ipm_shm_ring *rx = data->rx;
+
+	ARG_UNUSED(mbox);
+	ARG_UNUSED(id);
+	ARG_UNUSED(mbox_data);
+
+	/* drain the whole burst from this one interrupt; re-arm and
+	 * re-check before leaving so a descriptor published after the
+	 * final drain pass cannot be left without a doorbell
+	 */
+	do {
+		rx->armed = 0;
+		compiler_barrier();
+
+		while (ring_used(rx) != 0U) {
+			struct ipm_shm_desc *desc =
+				&rx->descs[rx->tail % data->slots];
+
+			if (data->callback) {
+				data->callback(data->dev, data->callback_ctx,
+					       desc->id, desc->data);
+			}
+
+			compiler_barrier();
+			rx->tail = rx->tail + 1U;
+		}
+
+		rx->armed = 1;
+		compiler_barrier();
+	} while (ring_used(rx) != 0U);
+}
+
+static int ipm_shm_send(const struct device *d, int wait, uint32_t id,
+			const void *data, int size)
+{
+	struct ipm_shm_data *drv_data = d->data;
+	struct ipm_shm_ring *tx = drv_data->tx;
+	struct ipm_shm_desc *desc;
+	uint32_t doorbell = 1U;
+
+	if (size < 0 || size > CONFIG_IPM_SHM_SLOT_SIZE) {
+		return -EMSGSIZE;
+	}
+
+	while (ring_used(tx) >= drv_data->slots) {
+		if (!wait) {
+			return -EBUSY;
+		}
+	}
+
+	desc = &tx->descs[tx->head % drv_data->slots];
+	desc->id = id;
+	desc->len = size;
+	memcpy(desc->data, data, size);
+
+	/* publish the descriptor only after its payload is in place */
+	compiler_barrier();
+	tx->head = tx->head + 1U;
+	compiler_barrier();
+
+	/* one doorbell per burst: ring only while the remote asks */
+	if (tx->armed != 0U) {
+		tx->armed = 0;
+		return ipm_send(drv_data->mbox, wait, 0,
+				&doorbell, sizeof(doorbell));
+	}
+
+	return 0;
+}
+
+static int ipm_shm_max_data_size_get(const struct device *d)
+{
+	ARG_UNUSED(d);
+	return CONFIG_IPM_SHM_SLOT_SIZE;
+}
+
+static uint32_t ipm_shm_max_id_val_get(const struct device *d)
+{
+	ARG_UNUSED(d);
+	/* full 32-bit id travels in the descriptor */
+	return UINT32_MAX;
+}
+
+static void ipm_shm_register_callback(const struct device *d,
+				      ipm_callback_t cb, void *context)
+{
+	struct ipm_shm_data *data = d->data;
+
+	data->callback = cb;
+	data->callback_ctx = context;
+}
+
+static int ipm_shm_set_enabled(const struct device *d, int enable)
+{
+	struct ipm_shm_data *data = d->data;
+
+	return ipm_set_enabled(data->mbox, enable);
+}
+
+static int ipm_shm_init(const struct device *dev)
+{
+	const struct ipm_shm_config *config = dev->config;
+	struct ipm_shm_data *data = dev->data;
+	size_t half = config->shm_size / 2U;
+	struct ipm_shm_ring *first = (struct ipm_shm_ring *)config->shm_addr;
+	struct ipm_shm_ring *second =
+		(struct ipm_shm_ring *)(config->shm_addr + half);
+
+	data->slots = (half - sizeof(struct ipm_shm_ring)) /
+		      sizeof(struct ipm_shm_desc);
+	if (data->slots == 0U) {
+		LOG_ERR("shared region too small for a descriptor");
+		return -ENOMEM;
+	}
+
+	data->mbox = device_get_binding(config->mbox_name);
+	if (data->mbox == NULL) {
+		LOG_ERR("doorbell mailbox %s not found", config->mbox_name);
+		return -ENODEV;
+	}
+
+	data->dev = dev;
+	data->tx = config->primary ? first : second;
+	data->rx = config->primary ? second : first;
+
+	/* initialize only the fields this core produces */
+	data->tx->head = 0;
+	data->rx->tail = 0;
+	data->rx->armed = 1;
+
+	ipm_register_callback(data->mbox, ipm_shm_doorbell_cb, data);
+
+	return 0;
+}
+
+static const struct ipm_driver_api ipm_shm_driver_api = {
+	.send = ipm_shm_send,
+	.register_callback = ipm_shm_register_callback,
+	.max_data_size_get = ipm_shm_max_data_size_get,
+	.max_id_val_get = ipm_shm_max_id_val_get,
+	.set_enabled = ipm_shm_set_enabled
+};
+
+#define IPM_SHM_INIT(index)						\
+	static const struct ipm_shm_config ipm_shm_##index##_config = {	\
+		.shm_addr = DT_INST_REG_ADDR(index),			\
+		.shm_size = DT_INST_REG_SIZE(index),			\
+		.mbox_name = DT_LABEL(DT_INST_PHANDLE(index, mailbox)),	\
+		.primary = DT_INST_PROP(index, primary),		\
+	};								\
+									\
+	static struct ipm_shm_data ipm_shm_##index##_data;		\
+									\
+	DEVICE_AND_API_INIT(ipm_shm_##index, DT_INST_LABEL(index),	\
+			    &ipm_shm_init,				\
+			    &ipm_shm_##index##_data,			\
+			    &ipm_shm_##index##_config,			\
+			    POST_KERNEL,				\
+			    CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,	\
+			    &ipm_shm_driver_api);
+
+DT_INST_FOREACH_STATUS_OKAY(IPM_SHM_INIT)
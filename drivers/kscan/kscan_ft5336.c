@@ -97,10 +97,11 @@ static int ft5336_process(const struct device *dev)
 		return r;
 	}
 
+	/* during multi-touch keep tracking the first point rather than
+	 * dropping the cycle, so batching consumers (see the kscan event
+	 * ring) get full-rate samples
+	 */
 	points = (points >> TOUCH_POINTS_POS) & TOUCH_POINTS_MSK;
-	if (points != 0U && points != 1U) {
-		return 0;
-	}
 
 	/* obtain first point X, Y coordinates and event from:
 	 * REG_P1_XH, REG_P1_XL, REG_P1_YH, REG_P1_YL.
@@ -116,7 +117,8 @@ static int ft5336_process(const struct device *dev)
 	col = ((coords[2] & POSITION_H_MSK) << 8U) | coords[3];
 	pressed = (event == EVENT_PRESS_DOWN) || (event == EVENT_CONTACT);
 
-	LOG_DBG("event: %d, row: %d, col: %d", event, row, col);
+	LOG_DBG("points: %d, event: %d, row: %d, col: %d",
+		points, event, row, col);
 
 	data->callback(dev, row, col, pressed);
 
@@ -205,6 +205,35 @@ static int process_cmd(struct modem_cmd *cmd, size_t match_len,
 	return ret;
 }
 
+/*
+ * (re)build the first-character dispatch map of a command array; an
+ * "empty" command matches any line, so it sets every bit
+ */
+static void rebuild_cmd_map(struct modem_cmd_handler_data *data, int j)
+{
+	uint8_t first;
+	int i;
+
+	memset(data->cmds_map[j], 0, sizeof(data->cmds_map[j]));
+
+	for (i = 0; i < data->cmds_len[j]; i++) {
+		if (data->cmds[j][i].cmd_len == 0U) {
+			memset(data->cmds_map[j], 0xff,
+			       sizeof(data->cmds_map[j]));
+			return;
+		}
+
+		first = (uint8_t)data->cmds[j][i].cmd[0];
+		data->cmds_map[j][first >> 5] |= BIT(first & 0x1f);
+	}
+}
+
+static bool cmd_map_hit(struct modem_cmd_handler_data *data, int j,
+			uint8_t first)
+{
+	return (data->cmds_map[j][first >> 5] & BIT(first & 0x1f)) != 0U;
+}
+
 /*
  * check 3 arrays of commands for a match in match_buf:
  * - response handlers[0]
@@ -213,6 +242,7 @@ static int process_cmd(struct modem_cmd *cmd, size_t match_len,
  */
 static struct modem_cmd *find_cmd_match(struct modem_cmd_handler_data *data)
 {
+	uint8_t first = (uint8_t)data->match_buf[0];
 	int j, i;
 
 	for (j = 0; j < ARRAY_SIZE(data->cmds); j++) {
@@ -220,9 +250,14 @@ static struct modem_cmd *find_cmd_match(struct modem_cmd_handler_data *data)
 			continue;
 		}
 
+		/* no command in this array starts with this character */
+		if (!cmd_map_hit(data, j, first)) {
+			continue;
+		}
+
 		for (i = 0; i < data->cmds_len[j]; i++) {
 			/* match on "empty" cmd */
-			if (strlen(data->cmds[j][i].cmd) == 0 ||
+			if (data->cmds[j][i].cmd_len == 0U ||
 			    strncmp(data->match_buf, data->cmds[j][i].cmd,
 				    data->cmds[j][i].cmd_len) == 0) {
 				return &data->cmds[j][i];
@@ -236,6 +271,7 @@ static struct modem_cmd *find_cmd_match(struct modem_cmd_handler_data *data)
 static struct modem_cmd *find_cmd_direct_match(
 		struct modem_cmd_handler_data *data)
 {
+	uint8_t first = *data->rx_buf->data;
 	int j, i;
 
 	for (j = 0; j < ARRAY_SIZE(data->cmds); j++) {
@@ -243,6 +279,10 @@ static struct modem_cmd *find_cmd_direct_match(
 			continue;
 		}
 
+		if (!cmd_map_hit(data, j, first)) {
+			continue;
+		}
+
 		for (i = 0; i < data->cmds_len[j]; i++) {
 			/* match start of cmd */
 			if (data->cmds[j][i].direct &&
@@ -431,6 +471,7 @@ int modem_cmd_handler_update_cmds(struct modem_cmd_handler_data *data,
 
 	data->cmds[CMD_HANDLER] = handler_cmds;
 	data->cmds_len[CMD_HANDLER] = handler_cmds_len;
+	rebuild_cmd_map(data, CMD_HANDLER);
 	if (reset_error_flag) {
 		data->last_error = 0;
 	}
@@ -617,6 +658,8 @@ void modem_cmd_handler_tx_unlock(struct modem_cmd_handler *handler)
 int modem_cmd_handler_init(struct modem_cmd_handler *handler,
 			   struct modem_cmd_handler_data *data)
 {
+	int i;
+
 	if (!handler || !data) {
 		return -EINVAL;
 	}
@@ -631,6 +674,10 @@ int modem_cmd_handler_init(struct modem_cmd_handler *handler,
 		data->eol_len = strlen(data->eol);
 	}
 
+	for (i = 0; i < ARRAY_SIZE(data->cmds); i++) {
+		rebuild_cmd_map(data, i);
+	}
+
 	handler->cmd_handler_data = data;
 	handler->process = cmd_handler_process;
 
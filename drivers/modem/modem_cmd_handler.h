@@ -80,6 +80,12 @@ struct modem_cmd_handler_data {
 	struct modem_cmd *cmds[CMD_MAX];
 	size_t cmds_len[CMD_MAX];
 
+	/* bitmap of first command characters per command array, (re)built
+	 * when commands are attached; lets the parser skip a whole array
+	 * without any string comparisons when no command in it can match
+	 */
+	uint32_t cmds_map[CMD_MAX][256 / 32];
+
 	char *read_buf;
 	size_t read_buf_len;
 
@@ -19,6 +19,7 @@ LOG_MODULE_REGISTER(modem_iface_uart, CONFIG_MODEM_LOG_LEVEL);
 #include "modem_context.h"
 #include "modem_iface_uart.h"
 
+#if !defined(CONFIG_MODEM_IFACE_UART_ASYNC)
 /**
  * @brief  Drains UART.
  *
@@ -36,7 +37,87 @@ static void modem_iface_uart_flush(struct modem_iface *iface)
 		continue;
 	}
 }
+#endif /* !CONFIG_MODEM_IFACE_UART_ASYNC */
 
+#if defined(CONFIG_MODEM_IFACE_UART_ASYNC)
+/**
+ * @brief  Modem interface async UART event handler.
+ *
+ * @note   Moves received chunks into the interface ring buffer and keeps
+ *         reception running by handing the idle ping-pong buffer back to
+ *         the UART driver. When the ring buffer is full the data is
+ *         discarded.
+ *
+ * @param  *uart_dev: uart device.
+ * @param  *evt: uart event.
+ * @param  *user_data: modem interface reference.
+ *
+ * @retval None.
+ */
+static void modem_iface_uart_async_cb(const struct device *uart_dev,
+				      struct uart_event *evt, void *user_data)
+{
+	struct modem_iface *iface = (struct modem_iface *)user_data;
+	struct modem_iface_uart_data *data;
+	uint32_t written;
+
+	if (!iface || !iface->iface_data) {
+		return;
+	}
+
+	data = (struct modem_iface_uart_data *)(iface->iface_data);
+
+	switch (evt->type) {
+	case UART_RX_RDY:
+		written = ring_buf_put(&data->rx_rb,
+				       evt->data.rx.buf + evt->data.rx.offset,
+				       evt->data.rx.len);
+		if (written != evt->data.rx.len) {
+			LOG_ERR("Rx buffer doesn't have enough space");
+		}
+
+		if (written > 0) {
+			k_sem_give(&data->rx_sem);
+		}
+
+		break;
+	case UART_RX_BUF_REQUEST:
+		uart_rx_buf_rsp(uart_dev, data->rx_dma_buf[data->rx_dma_next],
+				sizeof(data->rx_dma_buf[0]));
+		data->rx_dma_next = !data->rx_dma_next;
+		break;
+	case UART_RX_DISABLED:
+		/* Reception stopped (e.g. on an error): restart it */
+		data->rx_dma_next = 1U;
+		if (uart_rx_enable(uart_dev, data->rx_dma_buf[0],
+				   sizeof(data->rx_dma_buf[0]),
+				   CONFIG_MODEM_IFACE_UART_ASYNC_RX_TIMEOUT_MS) < 0) {
+			LOG_ERR("Cannot re-enable UART reception");
+		}
+
+		break;
+	default:
+		break;
+	}
+}
+
+static int modem_iface_uart_rx_start(struct modem_iface *iface)
+{
+	struct modem_iface_uart_data *data =
+		(struct modem_iface_uart_data *)(iface->iface_data);
+	int ret;
+
+	ret = uart_callback_set(iface->dev, modem_iface_uart_async_cb, iface);
+	if (ret < 0) {
+		return ret;
+	}
+
+	data->rx_dma_next = 1U;
+	return uart_rx_enable(iface->dev, data->rx_dma_buf[0],
+			      sizeof(data->rx_dma_buf[0]),
+			      CONFIG_MODEM_IFACE_UART_ASYNC_RX_TIMEOUT_MS);
+}
+#else /* CONFIG_MODEM_IFACE_UART_ASYNC */
 /**
  * @brief  Modem interface interrupt handler.
  *
@@ -100,6 +181,7 @@ static void modem_iface_uart_isr(const struct device *uart_dev,
 		k_sem_give(&data->rx_sem);
 	}
 }
+#endif /* CONFIG_MODEM_IFACE_UART_ASYNC */
 
 static int modem_iface_uart_read(struct modem_iface *iface,
 				 uint8_t *buf, size_t size, size_t *bytes_read)
@@ -118,9 +200,11 @@ static int modem_iface_uart_read(struct modem_iface *iface,
 	data = (struct modem_iface_uart_data *)(iface->iface_data);
 	*bytes_read = ring_buf_get(&data->rx_rb, buf, size);
 
+#if !defined(CONFIG_MODEM_IFACE_UART_ASYNC)
 	if (data->hw_flow_control && *bytes_read == 0) {
 		uart_irq_rx_enable(iface->dev);
 	}
+#endif
 
 	return 0;
 }
@@ -175,6 +259,18 @@ int modem_iface_uart_init_dev(struct modem_iface *iface,
 		return -ENODEV;
 	}
 
+#if defined(CONFIG_MODEM_IFACE_UART_ASYNC)
+	/* If there's already a device inited to this iface, stop reception
+	 * on it before switching.
+	 */
+	if (prev) {
+		uart_rx_disable(prev);
+	}
+
+	iface->dev = dev;
+
+	return modem_iface_uart_rx_start(iface);
+#else
 	/* Check if there's already a device inited to this iface. If so,
 	 * interrupts needs to be disabled on that too before switching to avoid
 	 * race conditions with modem_iface_uart_isr.
@@ -197,6 +293,7 @@ int modem_iface_uart_init_dev(struct modem_iface *iface,
 	}
 
 	return 0;
+#endif
 }
 
 int modem_iface_uart_init(struct modem_iface *iface,
@@ -32,6 +32,14 @@ struct modem_iface_uart_data {
 
 	/* rx semaphore */
 	struct k_sem rx_sem;
+
+#if defined(CONFIG_MODEM_IFACE_UART_ASYNC)
+	/* ping-pong reception buffers handed to the UART driver */
+	uint8_t rx_dma_buf[2][CONFIG_MODEM_IFACE_UART_ASYNC_RX_BUFFER_SIZE];
+
+	/* index of the buffer handed out on the next buffer request */
+	uint8_t rx_dma_next;
+#endif
 };
 
 /**
@@ -155,6 +155,66 @@ out_of_mem:
 	return -ENOMEM;
 }
 
+static int ppp_save_bytes(struct ppp_driver_context *ppp,
+			  const uint8_t *data, size_t len)
+{
+	size_t chunk;
+	int ret;
+
+	while (len > 0) {
+		if (!ppp->pkt) {
+			ppp->pkt = net_pkt_rx_alloc_with_buffer(
+				ppp->iface,
+				CONFIG_NET_BUF_DATA_SIZE,
+				AF_UNSPEC, 0, K_NO_WAIT);
+			if (!ppp->pkt) {
+				LOG_ERR("[%p] cannot allocate pkt", ppp);
+				return -ENOMEM;
+			}
+
+			net_pkt_cursor_init(ppp->pkt);
+
+			ppp->available = net_pkt_available_buffer(ppp->pkt);
+		}
+
+		/* As with ppp_save_byte(), allocate a new buffer before
+		 * writing to the last available cursor position.
+		 */
+		if (ppp->available <= 1) {
+			ret = net_pkt_alloc_buffer(ppp->pkt,
+						   CONFIG_NET_BUF_DATA_SIZE,
+						   AF_UNSPEC, K_NO_WAIT);
+			if (ret < 0) {
+				LOG_ERR("[%p] cannot allocate new data buffer",
+					ppp);
+				goto out_of_mem;
+			}
+
+			ppp->available = net_pkt_available_buffer(ppp->pkt);
+		}
+
+		chunk = MIN(len, ppp->available - 1);
+
+		ret = net_pkt_write(ppp->pkt, data, chunk);
+		if (ret < 0) {
+			LOG_ERR("[%p] Cannot write to pkt %p (%d)",
+				ppp, ppp->pkt, ret);
+			goto out_of_mem;
+		}
+
+		ppp->available -= chunk;
+		data += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+
+out_of_mem:
+	net_pkt_unref(ppp->pkt);
+	ppp->pkt = NULL;
+	return -ENOMEM;
+}
+
 static const char *ppp_driver_state_str(enum ppp_driver_state state)
 {
 #if (CONFIG_NET_PPP_LOG_LEVEL >= LOG_LEVEL_DBG)
@@ -265,6 +325,41 @@ static void ppp_handle_client(struct ppp_driver_context *ppp, uint8_t byte)
 }
 #endif
 
+/* Consume as many frame data bytes as possible in one go. Only runs that
+ * contain neither the flag (0x7e) nor the escape (0x7d) byte are taken,
+ * using memchr() to scan word-wide instead of pushing every byte through
+ * the HDLC state machine. The state machine handles the special bytes.
+ * Returns the number of bytes consumed.
+ */
+static size_t ppp_input_block(struct ppp_driver_context *ppp,
+			      const uint8_t *data, size_t len)
+{
+	const uint8_t *special;
+	size_t run;
+
+	if (ppp->state != STATE_HDLC_FRAME_DATA || ppp->next_escaped) {
+		return 0;
+	}
+
+	special = memchr(data, 0x7e, len);
+	run = special ? (size_t)(special - data) : len;
+
+	special = memchr(data, 0x7d, run);
+	if (special) {
+		run = special - data;
+	}
+
+	if (run == 0) {
+		return 0;
+	}
+
+	if (ppp_save_bytes(ppp, data, run) < 0) {
+		ppp_change_state(ppp, STATE_HDLC_FRAME_START);
+	}
+
+	return run;
+}
+
 static int ppp_input_byte(struct ppp_driver_context *ppp, uint8_t byte)
 {
 	int ret = -EAGAIN;
@@ -449,6 +544,11 @@ static uint8_t *ppp_recv_cb(uint8_t *buf, size_t *off)
 			LOG_DBG("[%zd] %02x", i, buf[i]);
 		}
 
+		i += ppp_input_block(ppp, &buf[i], *off - i);
+		if (i == *off) {
+			break;
+		}
+
 		if (ppp_input_byte(ppp, buf[i]) == 0) {
 			/* Ignore empty or too short frames */
 			if (ppp->pkt && net_pkt_get_len(ppp->pkt) > 3) {
@@ -664,6 +764,14 @@ static int ppp_consume_ringbuf(struct ppp_driver_context *ppp)
 	tmp = len;
 
 	do {
+		size_t skip = ppp_input_block(ppp, data, tmp);
+
+		data += skip;
+		tmp -= skip;
+		if (tmp == 0) {
+			break;
+		}
+
 		if (ppp_input_byte(ppp, *data++) == 0) {
 			/* Ignore empty or too short frames */
 			if (ppp->pkt && net_pkt_get_len(ppp->pkt) > 3) {
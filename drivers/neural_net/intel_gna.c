@@ -48,6 +48,38 @@ static struct intel_gna_config_desc __aligned(GNA_PG_SIZE_IN_BYTES)
 static struct intel_gna_page_table __aligned(GNA_PG_SIZE_IN_BYTES)
 	gna_page_table[GNA_NUM_PG_TABLES_NEEDED];
 
+/*
+ * Start scoring the request at the head of the request queue. The entry
+ * stays queued while it is being scored; the interrupt handler removes it
+ * on completion. Must be called with the accelerator idle and interrupts
+ * locked (or from the interrupt handler itself).
+ */
+static void intel_gna_start_pending(struct intel_gna_data *gna)
+{
+	volatile struct intel_gna_regs *regs = gna->regs;
+	struct intel_gna_pending_req pending_req;
+	struct gna_model_header *header;
+
+	if (k_msgq_peek(&gna->request_queue, &pending_req) != 0) {
+		return;
+	}
+
+	/* stage input into the model's input buffer */
+	memcpy(pending_req.model->input, pending_req.input,
+			pending_req.input_len);
+	SOC_DCACHE_FLUSH(pending_req.model->input, pending_req.input_len);
+
+	/* assign layer descriptor base address to configuration descriptor */
+	header = pending_req.model->model.header;
+	gna_config_desc.labase = (uint32_t)pending_req.model->vabase;
+	gna_config_desc.lacnt = (uint16_t)header->layer_count;
+	SOC_DCACHE_FLUSH(&gna_config_desc, sizeof(gna_config_desc));
+
+	gna->state = GNA_STATE_ACTIVE;
+	regs->gnactrl = (regs->gnactrl & ~GNA_CTRL_INTR_DISABLE) |
+		GNA_CTRL_ACCEL_START | GNA_CTRL_STATS_ENABLE_STALL;
+}
+
 static void intel_gna_interrupt_handler(const struct device *dev)
 {
 	struct intel_gna_data *const gna = DEV_DATA(dev);
@@ -107,6 +139,12 @@ static void intel_gna_interrupt_handler(const struct device *dev)
 	/* clear GNA operation and disable interrupt */
 	regs->gnactrl |= GNA_CTRL_INTR_DISABLE | GNA_CTRL_ABORT_CLEAR;
 	gna->state = GNA_STATE_IDLE;
+
+	/* start the next queued request, if any, right away so the
+	 * accelerator does not sit idle while the application handles
+	 * the result that was just delivered
+	 */
+	intel_gna_start_pending(gna);
 }
 
 static void gna_work_handler(struct k_work *work)
@@ -405,12 +443,12 @@ static int intel_gna_infer(const struct device *dev,
 			   gna_callback callback)
 {
 	struct intel_gna_data *const gna = DEV_DATA(dev);
-	volatile struct intel_gna_regs *regs = gna->regs;
 	struct intel_gna_pending_req pending_req;
 	struct gna_model_header *header;
 	struct intel_gna_model *handle;
 	struct gna_model_info *model;
 	size_t input_size;
+	unsigned int key;
 	int ret;
 
 	LOG_DBG("device %p", dev);
@@ -446,34 +484,31 @@ static int intel_gna_infer(const struct device *dev,
 	input_size = header->bytes_per_input * header->num_input_nodes;
 
 	pending_req.model = handle;
+	pending_req.input = req->input;
+	pending_req.input_len = input_size;
 	pending_req.output = req->output;
 	pending_req.output_len = header->bytes_per_output *
 		header->num_output_nodes;
 	pending_req.callback = callback;
 
+	/* NOTE: the input buffer is read when the request is started, which
+	 * may happen from the completion interrupt of the previous request;
+	 * it must stay valid until this request's callback runs
+	 */
+	key = irq_lock();
+
 	ret = k_msgq_put(&gna->request_queue, &pending_req, K_NO_WAIT);
 	if (ret) {
+		irq_unlock(key);
 		LOG_ERR("Unable to queue request (code %d)", ret);
 		return ret;
 	}
 
-	if (gna->state != GNA_STATE_IDLE) {
-		/* multiple pending requests are not yet supported */
-		return -EBUSY;
+	if (gna->state == GNA_STATE_IDLE) {
+		intel_gna_start_pending(gna);
 	}
 
-	/* copy input */
-	memcpy(handle->input, req->input, input_size);
-	SOC_DCACHE_FLUSH(handle->input, input_size);
-
-	/* assign layer descriptor base address to configuration descriptor */
-	gna_config_desc.labase = (uint32_t)handle->vabase;
-	gna_config_desc.lacnt = (uint16_t)header->layer_count;
-	SOC_DCACHE_FLUSH(&gna_config_desc, sizeof(gna_config_desc));
-
-	gna->state = GNA_STATE_ACTIVE;
-	regs->gnactrl = (regs->gnactrl & ~GNA_CTRL_INTR_DISABLE) |
-		GNA_CTRL_ACCEL_START | GNA_CTRL_STATS_ENABLE_STALL;
+	irq_unlock(key);
 
 	return 0;
 }
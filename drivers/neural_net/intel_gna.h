@@ -163,6 +163,8 @@ struct intel_gna_model {
 
 struct intel_gna_pending_req {
 	struct intel_gna_model	*model;
+	void			*input;
+	size_t			input_len;
 	void			*output;
 	size_t			output_len;
 	gna_callback		callback;
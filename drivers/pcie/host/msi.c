@@ -5,6 +5,7 @@
  */
 
 #include <stdbool.h>
+#include <sys/device_mmio.h>
 #include <drivers/pcie/pcie.h>
 #include <drivers/pcie/msi.h>
 
@@ -66,3 +67,57 @@ bool pcie_set_msi(pcie_bdf_t bdf, unsigned int irq)
 
 	return success;
 }
+
+#ifdef CONFIG_PCIE_MSIX
+
+bool pcie_set_msix(pcie_bdf_t bdf, const unsigned int *irqs,
+		   unsigned int n_vector)
+{
+	volatile uint32_t *entry;
+	uintptr_t bar;
+	mm_reg_t table;
+	uint32_t base;
+	uint32_t mcr;
+	uint32_t tr;
+	unsigned int i;
+
+	base = pcie_get_cap(bdf, PCIE_MSIX_CAP_ID);
+	if (base == 0U) {
+		return false;
+	}
+
+	mcr = pcie_conf_read(bdf, base + PCIE_MSIX_MCR);
+	if (n_vector > ((mcr & PCIE_MSIX_MCR_TSIZE)
+			>> PCIE_MSIX_MCR_TSIZE_SHIFT) + 1U) {
+		return false;
+	}
+
+	tr = pcie_conf_read(bdf, base + PCIE_MSIX_TR);
+	bar = pcie_get_mbar(bdf, tr & PCIE_MSIX_TR_BIR);
+	if (bar == PCIE_CONF_BAR_NONE) {
+		return false;
+	}
+
+	device_map(&table, bar + (tr & PCIE_MSIX_TR_OFFSET),
+		   n_vector * PCIE_MSIX_ENTRY_SIZE, K_MEM_CACHE_NONE);
+	entry = (volatile uint32_t *)table;
+
+	/* mask the function while the table is being programmed */
+	pcie_conf_write(bdf, base + PCIE_MSIX_MCR,
+			mcr | PCIE_MSIX_MCR_EN | PCIE_MSIX_MCR_FMASK);
+
+	for (i = 0U; i < n_vector; i++, entry += 4) {
+		entry[PCIE_MSIX_ENTRY_MAP0] =
+			pcie_msix_map(irqs[i], i % CONFIG_MP_NUM_CPUS);
+		entry[PCIE_MSIX_ENTRY_MAP1] = 0U;
+		entry[PCIE_MSIX_ENTRY_MDR] = pcie_msi_mdr(irqs[i]);
+		entry[PCIE_MSIX_ENTRY_VCTRL] = 0U;
+	}
+
+	pcie_conf_write(bdf, base + PCIE_MSIX_MCR, mcr | PCIE_MSIX_MCR_EN);
+	pcie_set_cmd(bdf, PCIE_CONF_CMDSTAT_MASTER, true);
+
+	return true;
+}
+
+#endif /* CONFIG_PCIE_MSIX */
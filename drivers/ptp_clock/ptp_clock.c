@@ -29,4 +29,26 @@ int z_vrfy_ptp_clock_get(const struct device *dev,
 	return ret;
 }
 #include <syscalls/ptp_clock_get_mrsh.c>
+
+int z_vrfy_ptp_clock_get_cross(const struct device *dev,
+			       struct ptp_cross_timestamp *xts)
+{
+	struct ptp_cross_timestamp cross;
+	int ret;
+
+	Z_OOPS(Z_SYSCALL_DRIVER_PTP_CLOCK(dev, get));
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(xts, sizeof(struct ptp_cross_timestamp)));
+
+	ret = z_impl_ptp_clock_get_cross((const struct device *)dev, &cross);
+	if (ret != 0) {
+		return 0;
+	}
+
+	if (z_user_to_copy((void *)xts, &cross, sizeof(cross)) != 0) {
+		return 0;
+	}
+
+	return ret;
+}
+#include <syscalls/ptp_clock_get_cross_mrsh.c>
 #endif /* CONFIG_USERSPACE */
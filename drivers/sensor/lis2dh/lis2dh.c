@@ -214,6 +214,137 @@ static int lis2dh_acc_range_set(const struct device *dev, int32_t range)
 }
 #endif
 
+#ifdef CONFIG_LIS2DH_FIFO
+static int lis2dh_fifo_watermark_set(const struct device *dev,
+				     const struct sensor_value *val)
+{
+	struct lis2dh_data *lis2dh = dev->data;
+	int wm = val->val1;
+	int status;
+
+	if (wm < 0 || wm > LIS2DH_FIFO_MAX_DEPTH) {
+		return -EINVAL;
+	}
+
+	if (wm == 0) {
+		status = lis2dh->hw_tf->update_reg(dev, LIS2DH_REG_CTRL5,
+						   LIS2DH_FIFO_EN_BIT, 0);
+		if (status < 0) {
+			return status;
+		}
+
+		return lis2dh->hw_tf->write_reg(dev, LIS2DH_REG_FIFO_CTRL,
+						LIS2DH_FIFO_MODE_BYPASS);
+	}
+
+	/* the watermark flag raises when the fill level exceeds FTH */
+	status = lis2dh->hw_tf->write_reg(dev, LIS2DH_REG_FIFO_CTRL,
+					  LIS2DH_FIFO_MODE_STREAM |
+					  ((wm - 1) & LIS2DH_FIFO_FTH_MASK));
+	if (status < 0) {
+		return status;
+	}
+
+	return lis2dh->hw_tf->update_reg(dev, LIS2DH_REG_CTRL5,
+					 LIS2DH_FIFO_EN_BIT,
+					 LIS2DH_FIFO_EN_BIT);
+}
+
+static int lis2dh_batch_fetch(const struct device *dev,
+			      enum sensor_channel chan,
+			      struct sensor_batch *batch)
+{
+	struct lis2dh_data *lis2dh = dev->data;
+	size_t max_samples = batch->size / LIS2DH_FIFO_SAMPLE_SIZE;
+	int16_t *raw = batch->buf;
+	uint8_t fifo_src;
+	size_t avail;
+	size_t i;
+	int status;
+
+	if (chan != SENSOR_CHAN_ALL && chan != SENSOR_CHAN_ACCEL_XYZ) {
+		return -ENOTSUP;
+	}
+
+	batch->sample_size = LIS2DH_FIFO_SAMPLE_SIZE;
+	batch->count = 0;
+
+	status = lis2dh->hw_tf->read_reg(dev, LIS2DH_REG_FIFO_SRC,
+					 &fifo_src);
+	if (status < 0) {
+		return status;
+	}
+
+	avail = fifo_src & LIS2DH_FIFO_SRC_FSS_MASK;
+	if ((fifo_src & LIS2DH_FIFO_SRC_OVRN) != 0U) {
+		avail = LIS2DH_FIFO_MAX_DEPTH;
+	}
+
+	avail = MIN(avail, max_samples);
+	if (avail == 0) {
+		return 0;
+	}
+
+	/* reading the output registers pops the FIFO, so all pending
+	 * samples drain in one burst read
+	 */
+	status = lis2dh->hw_tf->read_data(dev, LIS2DH_REG_ACCEL_X_LSB,
+					  batch->buf,
+					  avail * LIS2DH_FIFO_SAMPLE_SIZE);
+	if (status < 0) {
+		LOG_WRN("Could not read accel FIFO data");
+		return status;
+	}
+
+	for (i = 0; i < avail * 3; i++) {
+		raw[i] = sys_le16_to_cpu(raw[i]);
+	}
+
+	batch->count = avail;
+
+	return 0;
+}
+
+static int lis2dh_batch_get(const struct device *dev,
+			    enum sensor_channel chan,
+			    const struct sensor_batch *batch,
+			    size_t idx,
+			    struct sensor_value *val)
+{
+	struct lis2dh_data *lis2dh = dev->data;
+	const int16_t *sample =
+		(const int16_t *)((const uint8_t *)batch->buf +
+				  idx * batch->sample_size);
+	int ofs_start;
+	int ofs_end;
+	int i;
+
+	switch (chan) {
+	case SENSOR_CHAN_ACCEL_X:
+		ofs_start = ofs_end = 0;
+		break;
+	case SENSOR_CHAN_ACCEL_Y:
+		ofs_start = ofs_end = 1;
+		break;
+	case SENSOR_CHAN_ACCEL_Z:
+		ofs_start = ofs_end = 2;
+		break;
+	case SENSOR_CHAN_ACCEL_XYZ:
+		ofs_start = 0;
+		ofs_end = 2;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	for (i = ofs_start; i <= ofs_end; i++, val++) {
+		lis2dh_convert(sample[i], lis2dh->scale, val);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_LIS2DH_FIFO */
+
 static int lis2dh_acc_config(const struct device *dev,
 			     enum sensor_channel chan,
 			     enum sensor_attribute attr,
@@ -232,6 +363,10 @@ static int lis2dh_acc_config(const struct device *dev,
 	case SENSOR_ATTR_SLOPE_TH:
 	case SENSOR_ATTR_SLOPE_DUR:
 		return lis2dh_acc_slope_config(dev, attr, val);
+#endif
+#ifdef CONFIG_LIS2DH_FIFO
+	case SENSOR_ATTR_FIFO_WATERMARK:
+		return lis2dh_fifo_watermark_set(dev, val);
 #endif
 	default:
 		LOG_DBG("Accel attribute not supported.");
@@ -266,6 +401,10 @@ static const struct sensor_driver_api lis2dh_driver_api = {
 #endif
 	.sample_fetch = lis2dh_sample_fetch,
 	.channel_get = lis2dh_channel_get,
+#ifdef CONFIG_LIS2DH_FIFO
+	.batch_fetch = lis2dh_batch_fetch,
+	.batch_get = lis2dh_batch_get,
+#endif
 };
 
 int lis2dh_init(const struct device *dev)
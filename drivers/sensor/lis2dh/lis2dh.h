@@ -91,6 +91,8 @@
 #define LIS2DH_REG_CTRL3		0x22
 #define LIS2DH_EN_DRDY1_INT1_SHIFT	4
 #define LIS2DH_EN_DRDY1_INT1		BIT(LIS2DH_EN_DRDY1_INT1_SHIFT)
+#define LIS2DH_EN_WTM_INT1_SHIFT	2
+#define LIS2DH_EN_WTM_INT1		BIT(LIS2DH_EN_WTM_INT1_SHIFT)
 
 #define LIS2DH_REG_CTRL4		0x23
 #define LIS2DH_FS_SHIFT			4
@@ -118,6 +120,8 @@
 #define LIS2DH_REG_CTRL5		0x24
 #define LIS2DH_LIR_INT2_SHIFT		1
 #define LIS2DH_EN_LIR_INT2		BIT(LIS2DH_LIR_INT2_SHIFT)
+#define LIS2DH_FIFO_EN_SHIFT		6
+#define LIS2DH_FIFO_EN_BIT		BIT(LIS2DH_FIFO_EN_SHIFT)
 
 #define LIS2DH_REG_CTRL6		0x25
 #define LIS2DH_EN_INT2_INT2_SHIFT	5
@@ -144,6 +148,22 @@
 #define LIS2DH_REG_ACCEL_Y_MSB		0x2B
 #define LIS2DH_REG_ACCEL_Z_MSB		0x2D
 
+#define LIS2DH_REG_FIFO_CTRL		0x2e
+#define LIS2DH_FIFO_MODE_SHIFT		6
+#define LIS2DH_FIFO_MODE_MASK		(BIT_MASK(2) << LIS2DH_FIFO_MODE_SHIFT)
+#define LIS2DH_FIFO_MODE_BYPASS		(0 << LIS2DH_FIFO_MODE_SHIFT)
+#define LIS2DH_FIFO_MODE_STREAM		(2 << LIS2DH_FIFO_MODE_SHIFT)
+#define LIS2DH_FIFO_FTH_MASK		BIT_MASK(5)
+
+#define LIS2DH_REG_FIFO_SRC		0x2f
+#define LIS2DH_FIFO_SRC_WTM		BIT(7)
+#define LIS2DH_FIFO_SRC_OVRN		BIT(6)
+#define LIS2DH_FIFO_SRC_EMPTY		BIT(5)
+#define LIS2DH_FIFO_SRC_FSS_MASK	BIT_MASK(5)
+
+#define LIS2DH_FIFO_MAX_DEPTH		32
+#define LIS2DH_FIFO_SAMPLE_SIZE		(3 * sizeof(int16_t))
+
 #define LIS2DH_REG_INT1_CFG		0x30
 #define LIS2DH_REG_INT2_CFG		0x34
 #define LIS2DH_AOI_CFG			BIT(7)
@@ -239,6 +259,9 @@ struct lis2dh_data {
 
 	sensor_trigger_handler_t handler_drdy;
 	sensor_trigger_handler_t handler_anymotion;
+#ifdef CONFIG_LIS2DH_FIFO
+	sensor_trigger_handler_t handler_wtm;
+#endif
 	atomic_t trig_flags;
 	enum sensor_channel chan_drdy;
 
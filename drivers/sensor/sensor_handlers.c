@@ -57,3 +57,32 @@ static inline int z_vrfy_sensor_channel_get(const struct device *dev,
 					 (struct sensor_value *)val);
 }
 #include <syscalls/sensor_channel_get_mrsh.c>
+
+static inline int z_vrfy_sensor_batch_fetch(const struct device *dev,
+					    enum sensor_channel chan,
+					    struct sensor_batch *batch)
+{
+	Z_OOPS(Z_SYSCALL_DRIVER_SENSOR(dev, batch_fetch));
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(batch, sizeof(struct sensor_batch)));
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(batch->buf, batch->size));
+	return z_impl_sensor_batch_fetch((const struct device *)dev, chan,
+					 (struct sensor_batch *)batch);
+}
+#include <syscalls/sensor_batch_fetch_mrsh.c>
+
+static inline int z_vrfy_sensor_batch_get(const struct device *dev,
+					  enum sensor_channel chan,
+					  const struct sensor_batch *batch,
+					  size_t idx,
+					  struct sensor_value *val)
+{
+	Z_OOPS(Z_SYSCALL_DRIVER_SENSOR(dev, batch_get));
+	Z_OOPS(Z_SYSCALL_MEMORY_READ(batch, sizeof(struct sensor_batch)));
+	Z_OOPS(Z_SYSCALL_MEMORY_READ(batch->buf, batch->size));
+	/* vectorial channels write up to three values */
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(val, 3 * sizeof(struct sensor_value)));
+	return z_impl_sensor_batch_get((const struct device *)dev, chan,
+				       (const struct sensor_batch *)batch,
+				       idx, (struct sensor_value *)val);
+}
+#include <syscalls/sensor_batch_get_mrsh.c>
@@ -14,6 +14,10 @@
 
 #include <drivers/pinmux.h>
 
+#ifdef CONFIG_UART_ASYNC_API
+#include <drivers/dma.h>
+#endif
+
 /* device config */
 struct uart_stm32_config {
 	struct uart_device_config uconf;
@@ -27,6 +31,27 @@ struct uart_stm32_config {
 	size_t pinctrl_list_size;
 };
 
+#ifdef CONFIG_UART_ASYNC_API
+/* Single DMA stream (RX or TX) used by the asynchronous API */
+struct uart_dma_stream {
+	const char *dma_name;
+	const struct device *dma_dev;
+	uint32_t dma_channel;
+	struct dma_config dma_cfg;
+	bool src_addr_increment;
+	bool dst_addr_increment;
+	int fifo_threshold;
+	struct dma_block_config blk_cfg;
+	uint8_t *buffer;
+	size_t buffer_length;
+	size_t offset;
+	volatile size_t counter;
+	int32_t timeout;
+	struct k_delayed_work timeout_work;
+	bool enabled;
+};
+#endif
+
 /* driver data */
 struct uart_stm32_data {
 	/* Baud rate */
@@ -37,6 +62,15 @@ struct uart_stm32_data {
 	uart_irq_callback_user_data_t user_cb;
 	void *user_data;
 #endif
+#ifdef CONFIG_UART_ASYNC_API
+	const struct device *uart_dev;
+	uart_callback_t async_cb;
+	void *async_user_data;
+	struct uart_dma_stream dma_rx;
+	struct uart_dma_stream dma_tx;
+	uint8_t *rx_next_buffer;
+	size_t rx_next_buffer_len;
+#endif
 };
 
 #endif	/* ZEPHYR_DRIVERS_SERIAL_UART_STM32_H_ */
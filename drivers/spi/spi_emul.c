@@ -84,6 +84,31 @@ static int spi_emul_io(const struct device *dev,
 	return api->io(emul, config, tx_bufs, rx_bufs);
 }
 
+#ifdef CONFIG_SPI_BATCH
+static int spi_emul_io_batch(const struct device *dev,
+			     const struct spi_config *config,
+			     const struct spi_batch_entry *entries,
+			     size_t count,
+			     struct k_poll_signal *async)
+{
+	int ret = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		ret = spi_emul_io(dev, config, entries[i].tx_bufs,
+				  entries[i].rx_bufs);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	if (async != NULL) {
+		k_poll_signal_raise(async, ret);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_SPI_BATCH */
+
 /**
  * Set up a new emulator and add it to the list
  *
@@ -115,6 +140,9 @@ int spi_emul_register(const struct device *dev, const char *name,
 
 static struct spi_driver_api spi_emul_api = {
 	.transceive = spi_emul_io,
+#ifdef CONFIG_SPI_BATCH
+	.transceive_batch = spi_emul_io_batch,
+#endif
 };
 
 #define EMUL_LINK_AND_COMMA(node_id) {		\
@@ -188,11 +188,7 @@ void z_clock_set_timeout(int32_t ticks, bool idle)
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	uint32_t pending = elapsed();
-
-	cycle_count += pending;
-	overflow_cyc = 0U;
-
-	uint32_t unannounced = cycle_count - announced_cycles;
+	uint32_t unannounced = cycle_count + pending - announced_cycles;
 
 	if ((int32_t)unannounced < 0) {
 		/* We haven't announced for more than half the 32-bit
@@ -213,11 +209,31 @@ void z_clock_set_timeout(int32_t ticks, bool idle)
 		delay -= unannounced;
 		delay = MAX(delay, MIN_DELAY);
 		if (delay > MAX_CYCLES) {
-			last_load = MAX_CYCLES;
-		} else {
-			last_load = delay;
+			delay = MAX_CYCLES;
+		}
+
+		/* Timeout churn coalescing: when the counter is already
+		 * programmed to fire at exactly the requested deadline
+		 * (both deltas are measured from the same elapsed()
+		 * snapshot, so equality is exact when the deadline is
+		 * unchanged), leave the hardware alone.  The scheduler
+		 * re-sets an unchanged earliest deadline often enough
+		 * under timeout churn that this saves most reprograms.
+		 * The MIN_DELAY floor applied above remains the guard
+		 * against programming a too-imminent deadline.
+		 */
+		if (last_load != TIMER_STOPPED &&
+		    (last_load - pending) == delay) {
+			k_spin_unlock(&lock, key);
+			return;
 		}
+
+		last_load = delay;
 	}
+
+	cycle_count += pending;
+	overflow_cyc = 0U;
+
 	SysTick->LOAD = last_load - 1;
 	SysTick->VAL = 0; /* resets timer to last_load */
 
@@ -23,6 +23,33 @@ static uint64_t tick_period; /* System tick period in microseconds */
 /* Time (microseconds since boot) of the last timer tick interrupt */
 static uint64_t last_tick_time;
 
+#ifdef CONFIG_HIRES_TIMER
+/* Absolute time (microseconds since boot) of the pending hires alarm,
+ * UINT64_MAX when none. The HW cycle counter of this board counts
+ * microseconds, so cycle targets translate directly.
+ */
+static uint64_t hires_alarm_time = UINT64_MAX;
+
+void z_clock_hires_alarm_set(uint32_t cycle)
+{
+	uint64_t now = hwm_get_time();
+	int32_t delta = (int32_t)(cycle - (uint32_t)now);
+
+	if (delta < 0) {
+		delta = 0;
+	}
+
+	hires_alarm_time = now + delta;
+	hwtimer_hires_alarm(hires_alarm_time);
+}
+
+void z_clock_hires_alarm_cancel(void)
+{
+	hires_alarm_time = UINT64_MAX;
+	hwtimer_hires_alarm(UINT64_MAX);
+}
+#endif /* CONFIG_HIRES_TIMER */
+
 /**
  * Return the current HW cycle counter
  * (number of microseconds since boot in 32bits)
@@ -44,6 +71,14 @@ static void np_timer_isr(const void *arg)
 	int32_t elapsed_ticks = (now - last_tick_time)/tick_period;
 
 	last_tick_time += elapsed_ticks*tick_period;
+
+#ifdef CONFIG_HIRES_TIMER
+	if (now >= hires_alarm_time) {
+		hires_alarm_time = UINT64_MAX;
+		z_hires_timer_expire();
+	}
+#endif
+
 	z_clock_announce(elapsed_ticks);
 }
 
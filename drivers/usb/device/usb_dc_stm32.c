@@ -146,6 +146,12 @@ static const struct soc_gpio_pinctrl usb_pinctrl[] =
 /* Size of a USB SETUP packet */
 #define SETUP_SIZE 8
 
+/* Size of the per-endpoint read buffer. Bulk OUT endpoints may collect
+ * several packets per programmed transfer (CONFIG_USB_DC_STM32_READ_PACKETS),
+ * other endpoint types always use single-packet reads.
+ */
+#define EP_BUF_SIZE (EP_MPS * CONFIG_USB_DC_STM32_READ_PACKETS)
+
 /* Helper macros to make it easier to work with endpoint numbers */
 #define EP0_IDX 0
 #define EP0_IN (EP0_IDX | USB_EP_DIR_IN)
@@ -169,7 +175,7 @@ struct usb_dc_stm32_state {
 	usb_dc_status_callback status_cb; /* Status callback */
 	struct usb_dc_stm32_ep_state out_ep_state[USB_NUM_BIDIR_ENDPOINTS];
 	struct usb_dc_stm32_ep_state in_ep_state[USB_NUM_BIDIR_ENDPOINTS];
-	uint8_t ep_buf[USB_NUM_BIDIR_ENDPOINTS][EP_MPS];
+	uint8_t ep_buf[USB_NUM_BIDIR_ENDPOINTS][EP_BUF_SIZE];
 
 #ifdef USB
 	uint32_t pma_offset;
@@ -531,6 +537,24 @@ int usb_dc_set_address(const uint8_t addr)
 	return 0;
 }
 
+/* Maximum read size programmed per transfer. Bulk OUT endpoints may use
+ * the whole read buffer: the HAL reports completion once the buffer is
+ * filled or a short packet terminates the transfer, so only one
+ * DataOutStageCallback is handled for up to
+ * CONFIG_USB_DC_STM32_READ_PACKETS packets. Control endpoints keep
+ * single-packet reads, which the EP0 state handling relies on.
+ */
+static uint32_t usb_dc_stm32_read_size(uint8_t ep)
+{
+	struct usb_dc_stm32_ep_state *ep_state = usb_dc_stm32_get_ep_state(ep);
+
+	if (ep_state && ep_state->ep_type == EP_TYPE_BULK) {
+		return EP_BUF_SIZE;
+	}
+
+	return EP_MPS;
+}
+
 int usb_dc_ep_start_read(uint8_t ep, uint8_t *data, uint32_t max_data_len)
 {
 	HAL_StatusTypeDef status;
@@ -543,8 +567,8 @@ int usb_dc_ep_start_read(uint8_t ep, uint8_t *data, uint32_t max_data_len)
 		return -EINVAL;
 	}
 
-	if (max_data_len > EP_MPS) {
-		max_data_len = EP_MPS;
+	if (max_data_len > usb_dc_stm32_read_size(ep)) {
+		max_data_len = usb_dc_stm32_read_size(ep);
 	}
 
 	status = HAL_PCD_EP_Receive(&usb_dc_stm32_state.pcd, ep,
@@ -725,7 +749,7 @@ int usb_dc_ep_enable(const uint8_t ep)
 	if (USB_EP_DIR_IS_OUT(ep) && ep != EP0_OUT) {
 		return usb_dc_ep_start_read(ep,
 					  usb_dc_stm32_state.ep_buf[USB_EP_GET_IDX(ep)],
-					  EP_MPS);
+					  usb_dc_stm32_read_size(ep));
 	}
 
 	return 0;
@@ -864,7 +888,7 @@ int usb_dc_ep_read_continue(uint8_t ep)
 	 */
 	if (!ep_state->read_count) {
 		usb_dc_ep_start_read(ep, usb_dc_stm32_state.ep_buf[USB_EP_GET_IDX(ep)],
-				     EP_MPS);
+				     usb_dc_stm32_read_size(ep));
 	}
 
 	return 0;
@@ -47,6 +47,34 @@ struct video_buffer *video_buffer_alloc(size_t size)
 	return vbuf;
 }
 
+struct video_buffer *video_buffer_attach(uint8_t *buffer, size_t size)
+{
+	struct video_buffer *vbuf = NULL;
+	int i;
+
+	if (buffer == NULL || size == 0) {
+		return NULL;
+	}
+
+	/* find available video buffer */
+	for (i = 0; i < ARRAY_SIZE(video_buf); i++) {
+		if (video_buf[i].buffer == NULL) {
+			vbuf = &video_buf[i];
+			break;
+		}
+	}
+
+	if (vbuf == NULL) {
+		return NULL;
+	}
+
+	vbuf->buffer = buffer;
+	vbuf->size = size;
+	vbuf->bytesused = 0;
+
+	return vbuf;
+}
+
 void video_buffer_release(struct video_buffer *vbuf)
 {
 	struct k_mem_block *block = NULL;
@@ -61,5 +89,9 @@ void video_buffer_release(struct video_buffer *vbuf)
 	}
 
 	vbuf->buffer = NULL;
-	k_mem_pool_free(block);
+
+	/* attached buffers have no pool memory to give back */
+	if (block != NULL) {
+		k_mem_pool_free(block);
+	}
 }
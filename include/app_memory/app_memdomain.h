@@ -10,6 +10,16 @@
 #include <sys/dlist.h>
 #include <kernel.h>
 
+/* Alignment used by the cache-line aware placement macros below.  Only
+ * some arches publish their line size as a Kconfig symbol; 64 bytes
+ * covers every SMP target we build for.
+ */
+#ifdef CONFIG_CACHE_LINE_SIZE
+#define K_APP_MEM_ALIGN CONFIG_CACHE_LINE_SIZE
+#else
+#define K_APP_MEM_ALIGN 64
+#endif
+
 #ifdef CONFIG_USERSPACE
 
 /**
@@ -53,6 +63,31 @@
  */
 #define K_APP_BMEM(id) Z_GENERIC_SECTION(K_APP_BMEM_SECTION(id))
 
+/**
+ * @brief Place data in a partition's data section, on its own cache line
+ *
+ * Like K_APP_DMEM(), but additionally aligns the data to the start of a
+ * data cache line. Use this for hot data accessed from one thread (or
+ * CPU) when other threads' data lives in the same partition, so that
+ * writes to neighbouring variables do not ping-pong the shared line on
+ * SMP targets. To fully isolate a variable, tag the neighbouring hot
+ * variables in the partition with this macro as well; alignment of the
+ * next symbol is what pads out the tail of the line.
+ *
+ * @param id Name of the memory partition to associate this data
+ */
+#define K_APP_DMEM_ALIGNED(id) K_APP_DMEM(id) __aligned(K_APP_MEM_ALIGN)
+
+/**
+ * @brief Place data in a partition's bss section, on its own cache line
+ *
+ * Like K_APP_BMEM(), but additionally aligns the data to the start of a
+ * data cache line; see K_APP_DMEM_ALIGNED().
+ *
+ * @param id Name of the memory partition to associate this data
+ */
+#define K_APP_BMEM_ALIGNED(id) K_APP_BMEM(id) __aligned(K_APP_MEM_ALIGN)
+
 struct z_app_region {
 	void *bss_start;
 	size_t bss_size;
@@ -137,6 +172,8 @@ struct z_app_region {
 
 #define K_APP_BMEM(ptn)
 #define K_APP_DMEM(ptn)
+#define K_APP_DMEM_ALIGNED(ptn) __aligned(K_APP_MEM_ALIGN)
+#define K_APP_BMEM_ALIGNED(ptn) __aligned(K_APP_MEM_ALIGN)
 #define K_APP_DMEM_SECTION(ptn) .data
 #define K_APP_BMEM_SECTION(ptn) .bss
 #define K_APPMEM_PARTITION_DEFINE(name)
@@ -88,6 +88,10 @@ struct k_mem_domain {
 	sys_dlist_t mem_domain_q;
 	/** number of active partitions in the domain */
 	uint8_t num_partitions;
+	/** change sequence number, bumped whenever the partition set is
+	 * modified so that cached views of the domain can be invalidated
+	 */
+	uint32_t generation;
 #ifdef CONFIG_ARCH_MEM_DOMAIN_DATA
 	struct arch_mem_domain arch;
 #endif /* CONFIG_ARCH_MEM_DOMAIN_DATA */
@@ -29,6 +29,22 @@ extern "C" {
  */
 void bt_ctlr_set_public_addr(const uint8_t *addr);
 
+/** @brief Read connection event utilization counters
+ *
+ *  Returns the counters accumulated since boot or since the last call to
+ *  bt_ctlr_conn_metrics_reset(). Only available with
+ *  CONFIG_BT_CTLR_CONN_METRICS.
+ *
+ *  @param events     Completed connection events.
+ *  @param events_trx Connection events that carried at least one PDU pair.
+ *  @param trx        Total PDU pairs exchanged across all events.
+ */
+void bt_ctlr_conn_metrics_get(uint32_t *events, uint32_t *events_trx,
+			      uint32_t *trx);
+
+/** @brief Clear connection event utilization counters */
+void bt_ctlr_conn_metrics_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
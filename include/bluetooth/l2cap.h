@@ -121,6 +121,8 @@ struct bt_l2cap_le_endpoint {
 	uint16_t				mps;
 	/** Endpoint initial credits */
 	uint16_t				init_credits;
+	/** Endpoint credits consumed but not yet replenished */
+	uint16_t				pending_credits;
 	/** Endpoint credits */
 	atomic_t			credits;
 };
@@ -221,6 +221,9 @@ static inline int cipher_block_op(struct cipher_ctx *ctx,
  * @param  iv        Initialization Vector (IV) for the operation. Same
  *			 IV value should not be reused across multiple
  *			 operations (within a session context) for security.
+ *			 On sessions opened with CAP_MULTIPART_OPS a NULL
+ *			 IV continues the chaining state of the previous
+ *			 call, allowing multi-part operation.
  *
  * @return 0 on success, negative errno code on fail.
  */
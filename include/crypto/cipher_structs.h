@@ -197,6 +197,13 @@ struct cipher_ctx {
 /** Don't prefix IV to cipher blocks */
 #define CAP_NO_IV_PREFIX		BIT(8)
 
+/** Whether the driver supports multi-part operations: on a session opened
+ * with this flag, passing a NULL IV to cipher_cbc_op()/cipher_ctr_op()
+ * continues the running cipher state from the previous call, so a large
+ * message can be processed in pieces without per-piece setup cost.
+ */
+#define CAP_MULTIPART_OPS		BIT(9)
+
 /* More flags to be added as necessary */
 
 
@@ -592,6 +592,136 @@ int json_obj_parse(char *json, size_t len,
 	const struct json_obj_descr *descr, size_t descr_len,
 	void *val);
 
+/**
+ * @brief Parses a JSON object using a cached field-name hash table
+ *
+ * Behaves exactly like json_obj_parse(), but dispatches object keys to
+ * descriptor fields through a table of field-name hashes instead of
+ * comparing every candidate name. The table is filled on the first
+ * call and reused afterwards, so repeatedly decoding the same fixed
+ * schema skips almost all of the per-field string comparisons; a
+ * matching hash is still verified with a string comparison, so
+ * collisions only cost the comparison the generic path would have done
+ * anyway. Nested objects are decoded through the generic path.
+ *
+ * @param json Pointer to JSON-encoded value to be parsed
+ *
+ * @param len Length of JSON-encoded value
+ *
+ * @param descr Pointer to the descriptor array
+ *
+ * @param descr_len Number of elements in the descriptor array. Must be
+ * less than 31 due to implementation detail reasons (if more fields are
+ * necessary, use two descriptors)
+ *
+ * @param hashes Caller-provided array of descr_len words associated
+ * with this descriptor array. Must be zero-initialized (typically by
+ * static storage duration) and must not be shared between different
+ * descriptor arrays.
+ *
+ * @param val Pointer to the struct to hold the decoded values
+ *
+ * @return < 0 if error, bitmap of decoded fields on success (bit 0
+ * is set if first field in the descriptor has been properly decoded, etc).
+ */
+int json_obj_parse_hashed(char *json, size_t len,
+	const struct json_obj_descr *descr, size_t descr_len,
+	uint32_t *hashes, void *val);
+
+/**
+ * @brief Token reported by the streaming parser.
+ *
+ * For JSON_TOK_STRING the view excludes the surrounding quotes and, as
+ * with json_obj_parse(), is not unescaped. The view points either into
+ * the chunk passed to json_stream_feed() - valid only for the duration
+ * of the callback - or, for tokens split across chunks, into the
+ * scratch buffer supplied to json_stream_init().
+ */
+struct json_stream_token {
+	enum json_tokens type;
+	const char *start;
+	size_t len;
+};
+
+/**
+ * @brief Function pointer type for tokens reported by the streaming
+ * parser.
+ *
+ * @param token Token being reported
+ * @param user_data User-provided pointer
+ *
+ * @return This callback function should return a negative number on
+ * error (which will be propagated to the return value of
+ * json_stream_feed()), or 0 on success.
+ */
+typedef int (*json_stream_cb_t)(const struct json_stream_token *token,
+				void *user_data);
+
+struct json_stream {
+	json_stream_cb_t callback;
+	void *user_data;
+	char *scratch;
+	size_t scratch_size;
+	size_t scratch_len;
+	/* Container bit-stack: one bit per nesting level, set for
+	 * objects, clear for arrays.
+	 */
+	uint32_t stack;
+	uint8_t depth;
+	uint8_t state;
+	bool escaped;
+};
+
+/**
+ * @brief Initializes a streaming JSON parser
+ *
+ * @param stream Streaming parser state to initialize
+ *
+ * @param callback Callback invoked for every token
+ *
+ * @param user_data Pointer passed through to the callback
+ *
+ * @param scratch Buffer used to reassemble tokens that are split
+ * across json_stream_feed() chunks; must remain valid while the
+ * stream is in use. Size it for the longest expected string or number
+ * token; tokens contained in a single chunk do not use it.
+ *
+ * @param scratch_size Size of the buffer scratch points to
+ */
+void json_stream_init(struct json_stream *stream, json_stream_cb_t callback,
+		      void *user_data, char *scratch, size_t scratch_size);
+
+/**
+ * @brief Feeds a chunk of a JSON document to the streaming parser
+ *
+ * Parses as much of the chunk as possible, invoking the token callback
+ * for every complete token: object/list start and end, strings,
+ * numbers, booleans and null. Colons, commas and whitespace are
+ * consumed silently. String and number views point into the caller's
+ * chunk (zero copy) unless the token straddles a chunk boundary, in
+ * which case it is reassembled in the scratch buffer. May be called
+ * repeatedly as data arrives, e.g. straight from a socket receive
+ * buffer; parsing thus overlaps reception and the document never needs
+ * to be resident in RAM as a whole.
+ *
+ * The same liberties documented for json_obj_parse() apply: strings
+ * are not unescaped and no UTF-8 validation is performed. A top-level
+ * bare primitive is only reported once a delimiter (e.g. trailing
+ * whitespace) follows it.
+ *
+ * @param stream Streaming parser state
+ *
+ * @param data Chunk of JSON-encoded data
+ *
+ * @param len Length of the chunk
+ *
+ * @return 0 on success, -EINVAL on malformed input, -ENOMEM if a
+ * split token does not fit in the scratch buffer, or any negative
+ * value returned by the token callback (parsing stops at the first
+ * error).
+ */
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len);
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
@@ -12,9 +12,13 @@
 #include <toolchain.h>
 #include <arch/cpu.h>
 #include <sys/byteorder.h>
+#include <sys/types.h>
 
 #define Z_COREDUMP_HDR_VER		1
 
+/* Everything following the coredump header is compressed */
+#define Z_COREDUMP_HDR_FLAG_COMPRESSED	0x1
+
 #define	Z_COREDUMP_ARCH_HDR_ID		'A'
 
 #define	Z_COREDUMP_MEM_HDR_ID		'M'
@@ -80,6 +84,32 @@ void z_coredump(unsigned int reason, const z_arch_esf_t *esf,
 void z_coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr);
 int z_coredump_buffer_output(uint8_t *buf, size_t buflen);
 
+#ifdef CONFIG_DEBUG_COREDUMP_BACKEND_FLASH_PARTITION
+/**
+ * @brief Get the size of the dump stored in a flash slot.
+ *
+ * @param slot Slot index.
+ *
+ * @return Number of dump data bytes stored in the slot,
+ *         -ENOENT if the slot holds no valid dump,
+ *         other negative error code on flash access failure.
+ */
+int z_coredump_flash_dump_size(uint8_t slot);
+
+/**
+ * @brief Read dump data stored in a flash slot.
+ *
+ * @param slot Slot index.
+ * @param offset Offset into the stored dump data.
+ * @param dst Destination buffer.
+ * @param len Number of bytes to read.
+ *
+ * @return 0 if successful, negative error code otherwise.
+ */
+int z_coredump_flash_dump_read(uint8_t slot, off_t offset,
+			       uint8_t *dst, size_t len);
+#endif /* CONFIG_DEBUG_COREDUMP_BACKEND_FLASH_PARTITION */
+
 #else
 
 void z_coredump(unsigned int reason, const z_arch_esf_t *esf,
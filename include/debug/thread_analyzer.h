@@ -29,6 +29,14 @@ struct thread_analyzer_info {
 	size_t stack_size;
 	/** Stack size in used */
 	size_t stack_used;
+#ifdef CONFIG_TRACING_THREAD_PROFILER
+	/** Accumulated execution time in hardware cycles */
+	uint64_t cycles;
+	/** Number of times the thread has been switched in */
+	uint32_t switches;
+	/** Maximum scheduling latency in hardware cycles */
+	uint32_t max_latency;
+#endif
 };
 
 /** @brief Thread analyzer stack size callback function
@@ -21,6 +21,7 @@
 
 #include <init.h>
 #include <sys/device_mmio.h>
+#include <devicetree.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -126,7 +127,7 @@ extern "C" {
 #define DEVICE_DEFINE(dev_name, drv_name, init_fn, pm_control_fn,	\
 		      data_ptr, cfg_ptr, level, prio, api_ptr)		\
 	Z_DEVICE_DEFINE_PM(dev_name)					\
-	static const Z_DECL_ALIGN(struct device)			\
+	const Z_DECL_ALIGN(struct device)				\
 		DEVICE_NAME_GET(dev_name) __used			\
 	__attribute__((__section__(".device_" #level STRINGIFY(prio)))) = { \
 		.name = drv_name,					\
@@ -167,7 +168,155 @@ extern "C" {
  *
  * @param name Device name
  */
-#define DEVICE_DECLARE(name) static const struct device DEVICE_NAME_GET(name)
+#define DEVICE_DECLARE(name) extern const struct device DEVICE_NAME_GET(name)
+
+/* Synthesize a unique dev_name from the devicetree dependency ordinal;
+ * node paths are not valid C identifiers and node labels are not
+ * guaranteed to be unique.
+ */
+#define Z_DEVICE_DT_DEV_NAME(node_id) _CONCAT(dts_ord_, DT_DEP_ORD(node_id))
+
+/**
+ * @def DEVICE_DT_NAME
+ *
+ * @brief Return a string name for a devicetree node.
+ *
+ * @details The name is the devicetree node's label property, if it has
+ * one. Otherwise it is derived from the node's dependency ordinal,
+ * e.g. "dts_ord_7".
+ *
+ * @param node_id The devicetree node identifier.
+ *
+ * @return The string name for the node, for use as the device name.
+ */
+#define DEVICE_DT_NAME(node_id) \
+	DT_PROP_OR(node_id, label, STRINGIFY(Z_DEVICE_DT_DEV_NAME(node_id)))
+
+/**
+ * @def DEVICE_DT_DEFINE
+ *
+ * @brief Like DEVICE_DEFINE but taking metadata from a devicetree node.
+ *
+ * @details This macro defines a device object that is automatically
+ * configured by the kernel during system initialization, using a
+ * dev_name derived from the devicetree node's dependency ordinal. The
+ * device object can be retrieved at build time with DEVICE_DT_GET(),
+ * without any runtime name lookup.
+ *
+ * @param node_id The devicetree node identifier.
+ *
+ * @param init_fn Address to the init function of the driver.
+ *
+ * @param pm_control_fn Pointer to device_pm_control function.
+ * Can be empty function (device_pm_control_nop) if not implemented.
+ *
+ * @param data_ptr Pointer to the device's private data.
+ *
+ * @param cfg_ptr The address to the structure containing the
+ * configuration information for this instance of the driver.
+ *
+ * @param level The initialization level.  See SYS_INIT() for
+ * details.
+ *
+ * @param prio Priority within the selected initialization level. See
+ * SYS_INIT() for details.
+ *
+ * @param api_ptr Provides an initial pointer to the API function struct
+ * used by the driver. Can be NULL.
+ */
+#define DEVICE_DT_DEFINE(node_id, init_fn, pm_control_fn,		\
+			 data_ptr, cfg_ptr, level, prio, api_ptr)	\
+	DEVICE_DEFINE(Z_DEVICE_DT_DEV_NAME(node_id),			\
+		      DEVICE_DT_NAME(node_id), init_fn, pm_control_fn,	\
+		      data_ptr, cfg_ptr, level, prio, api_ptr)
+
+/**
+ * @def DEVICE_DT_INST_DEFINE
+ *
+ * @brief Like DEVICE_DT_DEFINE for an instance of a DT_DRV_COMPAT compatible
+ *
+ * @param inst instance number.  This is replaced by
+ * <tt>DT_DRV_COMPAT(inst)</tt> in the call to DEVICE_DT_DEFINE.
+ *
+ * @param ... other parameters as expected by DEVICE_DT_DEFINE.
+ */
+#define DEVICE_DT_INST_DEFINE(inst, ...) \
+	DEVICE_DT_DEFINE(DT_DRV_INST(inst), __VA_ARGS__)
+
+/**
+ * @def DEVICE_DT_NAME_GET
+ *
+ * @brief The name of the struct device object for @p node_id
+ *
+ * @details Return the full name of a device object symbol created by
+ * DEVICE_DT_DEFINE(), using the dev_name derived from @p node_id
+ *
+ * The ordinary device access API, e.g. device_get_binding(), cannot be
+ * used before the kernel initializes. You can use this name to get a
+ * reference to a device structure before it is initialized.
+ *
+ * @param node_id The same as node_id provided to DEVICE_DT_DEFINE()
+ *
+ * @return The expanded name of the device object created by
+ * DEVICE_DT_DEFINE()
+ */
+#define DEVICE_DT_NAME_GET(node_id) \
+	DEVICE_NAME_GET(Z_DEVICE_DT_DEV_NAME(node_id))
+
+/**
+ * @def DEVICE_DT_GET
+ *
+ * @brief Obtain a pointer to a device object by @p node_id
+ *
+ * @details Return the address of a device object created by
+ * DEVICE_DT_DEFINE(), using the dev_name derived from @p node_id. The
+ * reference is resolved at build time; no runtime string lookup is
+ * involved.
+ *
+ * @param node_id The same as node_id provided to DEVICE_DT_DEFINE()
+ *
+ * @return A pointer to the device object created by DEVICE_DT_DEFINE()
+ */
+#define DEVICE_DT_GET(node_id) (&DEVICE_DT_NAME_GET(node_id))
+
+/**
+ * @def DEVICE_DT_INST_GET
+ *
+ * @brief Obtain a pointer to a device object for an instance of a
+ *        DT_DRV_COMPAT compatible
+ *
+ * @param inst instance number
+ */
+#define DEVICE_DT_INST_GET(inst) DEVICE_DT_GET(DT_DRV_INST(inst))
+
+/**
+ * @def DEVICE_DT_DECLARE
+ *
+ * @brief Declare a device object associated with @p node_id
+ *
+ * This macro can be used at the top-level to declare a device, such
+ * that DEVICE_DT_GET() may be used before the full declaration in
+ * DEVICE_DT_DEFINE().
+ *
+ * This is often useful when configuring interrupts statically in a
+ * device's init or per-instance config function, as the init function
+ * itself is required by DEVICE_DT_DEFINE() and use of DEVICE_DT_GET()
+ * inside it creates a circular dependency.
+ *
+ * @param node_id The devicetree node identifier.
+ */
+#define DEVICE_DT_DECLARE(node_id) \
+	DEVICE_DECLARE(Z_DEVICE_DT_DEV_NAME(node_id))
+
+/**
+ * @def DEVICE_DT_INST_DECLARE
+ *
+ * @brief Declare a device object for an instance of a DT_DRV_COMPAT
+ *        compatible
+ *
+ * @param inst instance number
+ */
+#define DEVICE_DT_INST_DECLARE(inst) DEVICE_DT_DECLARE(DT_DRV_INST(inst))
 
 typedef void (*device_pm_cb)(const struct device *dev,
 			     int status, void *context, void *arg);
@@ -247,6 +396,33 @@ size_t z_device_get_all_static(const struct device * *devices);
  */
 bool z_device_ready(const struct device *dev);
 
+#ifdef CONFIG_DEVICE_DEFERRED_INIT
+/** @brief Initialize a DEFERRED level device.
+ *
+ * Runs the init function of a device defined at the DEFERRED init level,
+ * unless it has already run. Called implicitly by device_get_binding();
+ * only needed when the device pointer is obtained another way, e.g. with
+ * DEVICE_DT_GET().
+ *
+ * @param dev pointer to the device in question.
+ *
+ * @retval 0 if the device is initialized and ready for use.
+ * @retval -ENXIO if the device is not a DEFERRED level device.
+ * @retval -EIO if the device init function failed.
+ */
+int device_deferred_init(const struct device *dev);
+#endif
+
+#ifdef CONFIG_DEVICE_INIT_TIMING
+/** @brief Get the time spent initializing a device.
+ *
+ * @param dev pointer to the device in question.
+ *
+ * @return number of hardware cycles spent in the device init function.
+ */
+uint32_t device_init_time_get(const struct device *dev);
+#endif
+
 /**
  * @}
  */
@@ -10,14 +10,40 @@
 
 #include <storage/stream_flash.h>
 
+#ifdef CONFIG_IMG_STREAM_HASH
+#include <tinycrypt/sha256.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#ifdef CONFIG_IMG_STREAM_HASH
+/**
+ * @typedef flash_img_progress_cb_t
+ * @brief Called as image verification advances.
+ *
+ * @param bytes_checked Number of image bytes verified so far.
+ * @param total Total number of image bytes to verify.
+ */
+typedef void (*flash_img_progress_cb_t)(size_t bytes_checked, size_t total);
+#endif
+
 struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
+#ifdef CONFIG_IMG_STREAM_HASH
+	/* Running hash of the data streamed through
+	 * flash_img_buffered_write() and the cached digest of the
+	 * completed image.
+	 */
+	struct tc_sha256_state_struct sha;
+	uint8_t hash[TC_SHA256_DIGEST_SIZE];
+	size_t hash_bytes;
+	bool hash_valid;
+	flash_img_progress_cb_t progress_cb;
+#endif
 };
 
 #if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK)
@@ -98,6 +124,22 @@ int flash_img_check(struct flash_img_context *ctx,
 		    uint8_t area_id);
 #endif
 
+#ifdef CONFIG_IMG_STREAM_HASH
+/**
+ * @brief Set the verification progress callback.
+ *
+ * The callback is invoked from flash_img_check() after each block when
+ * the image has to be read back from flash, and once with the full
+ * length when verification is served from the hash computed while the
+ * image streamed through flash_img_buffered_write().
+ *
+ * @param ctx context
+ * @param cb callback, NULL to disable
+ */
+void flash_img_progress_cb_set(struct flash_img_context *ctx,
+			       flash_img_progress_cb_t cb);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
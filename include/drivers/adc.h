@@ -228,6 +228,29 @@ typedef enum adc_action (*adc_sequence_callback)(const struct device *dev,
 						 const struct adc_sequence *sequence,
 						 uint16_t sampling_index);
 
+#ifdef CONFIG_ADC_STREAM
+/**
+ * @brief Type definition of the callback invoked in continuous capture mode
+ *        each time one of the two buffers has been filled.
+ *
+ * The driver keeps sampling into the other buffer while this callback runs,
+ * so it must return (and the filled buffer must be consumed) before that
+ * buffer is needed again, otherwise samples are overwritten. It may be called
+ * from ISR context.
+ *
+ * @param dev      Pointer to the device structure for the driver instance.
+ * @param sequence Pointer to the sequence structure that triggered the
+ *                 capture.
+ * @param buffer   Pointer to the buffer that has just been filled.
+ *
+ * @returns ADC_ACTION_FINISH to stop the capture, any other value to
+ *          continue it.
+ */
+typedef enum adc_action (*adc_stream_callback)(const struct device *dev,
+					       const struct adc_sequence *sequence,
+					       void *buffer);
+#endif /* CONFIG_ADC_STREAM */
+
 /**
  * @brief Structure defining additional options for an ADC sampling sequence.
  */
@@ -254,6 +277,28 @@ struct adc_sequence_options {
 	 * is 1 + extra_samplings).
 	 */
 	uint16_t extra_samplings;
+
+#ifdef CONFIG_ADC_STREAM
+	/**
+	 * Pointer to a second sample buffer of the same size as the one
+	 * pointed by adc_sequence.buffer. When not NULL, the sequence runs
+	 * in continuous capture mode: the driver cycles between the two
+	 * buffers, filling each with 1 + extra_samplings samplings, and
+	 * invokes stream_callback each time a buffer has been filled. The
+	 * sequence does not terminate on its own; the callback stops it by
+	 * returning ADC_ACTION_FINISH. The per-sampling callback above is
+	 * not invoked in this mode.
+	 * Drivers that do not support continuous capture reject sequences
+	 * with this field set with -ENOTSUP.
+	 */
+	void *buffer2;
+
+	/**
+	 * Callback function to be called after each filled buffer in
+	 * continuous capture mode. Ignored unless buffer2 is set.
+	 */
+	adc_stream_callback stream_callback;
+#endif /* CONFIG_ADC_STREAM */
 };
 
 /**
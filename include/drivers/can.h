@@ -255,6 +255,18 @@ typedef void (*can_tx_callback_t)(uint32_t error_flags, void *arg);
  */
 typedef void (*can_rx_callback_t)(struct zcan_frame *msg, void *arg);
 
+/**
+ * @typedef can_rx_batch_callback_t
+ * @brief Define the application callback handler function signature
+ *        for batched receiving.
+ *
+ * @param msgs array of received messages
+ * @param msg_cnt number of messages in the array
+ * @param arg argument that was passed when the filter was attached
+ */
+typedef void (*can_rx_batch_callback_t)(struct zcan_frame *msgs, int msg_cnt,
+					void *arg);
+
 /**
  * @typedef can_state_change_isr_t
  * @brief Defines the state change isr handler function signature
@@ -312,6 +324,7 @@ struct zcan_work {
 	struct k_work_q *work_queue;
 	struct can_frame_buffer buf;
 	can_rx_callback_t cb;
+	can_rx_batch_callback_t batch_cb;
 	void *cb_arg;
 };
 
@@ -435,6 +448,31 @@ int can_attach_workq(const struct device *dev, struct k_work_q  *work_q,
 		     can_rx_callback_t callback, void *callback_arg,
 		     const struct zcan_filter *filter);
 
+/**
+ * @brief Attach a CAN work queue to a filter with batched delivery.
+ *
+ * This routine behaves like can_attach_workq(), except that the callback
+ * is handed the longest contiguous run of buffered frames at once instead
+ * of being called once per frame. This amortizes the per-frame callback
+ * overhead on busy buses.
+ *
+ * @param dev          Pointer to the device structure for the driver instance.
+ * @param work_q       Pointer to the already initialized work queue.
+ * @param work         Pointer to a zcan_work. The work will be initialized.
+ * @param callback     This function is called by workq with an array of
+ *                     received messages.
+ * @param callback_arg Is passed to the callback when called.
+ * @param filter       Pointer to a zcan_filter structure defining the id
+ *                     filtering.
+ *
+ * @retval filter_id on success.
+ * @retval CAN_NO_FREE_FILTER if there is no filter left.
+ */
+int can_attach_workq_batch(const struct device *dev, struct k_work_q *work_q,
+			   struct zcan_work *work,
+			   can_rx_batch_callback_t callback, void *callback_arg,
+			   const struct zcan_filter *filter);
+
 /**
  * @brief Attach a message queue to a single or group of identifiers.
  *
@@ -487,6 +525,30 @@ static inline int can_attach_isr(const struct device *dev,
 	return api->attach_isr(dev, isr, callback_arg, filter);
 }
 
+/**
+ * @brief Attach an isr callback function to a group of filters at once.
+ *
+ * This routine attaches the same isr callback to an array of filters,
+ * typically the full set of identifiers an application listens to. Either
+ * all filters are attached or, if the controller runs out of filters
+ * part-way, the ones attached so far are detached again, so the call
+ * never leaves a partial registration behind.
+ *
+ * @param dev          Pointer to the device structure for the driver instance.
+ * @param isr          Callback function pointer.
+ * @param callback_arg This will be passed whenever the isr is called.
+ * @param filters      Array of zcan_filter structures.
+ * @param filter_cnt   Number of elements in the filters array.
+ * @param filter_ids   Array of at least filter_cnt elements, filled with
+ *                     the filter id of each attached filter.
+ *
+ * @retval 0 on success.
+ * @retval CAN_NO_FREE_FILTER if there are not enough filters left.
+ */
+int can_attach_isr_bulk(const struct device *dev, can_rx_callback_t isr,
+			void *callback_arg, const struct zcan_filter *filters,
+			int filter_cnt, int *filter_ids);
+
 /**
  * @brief Detach an isr or message queue from the identifier filtering.
  *
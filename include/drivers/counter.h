@@ -174,6 +174,8 @@ typedef int (*counter_api_start)(const struct device *dev);
 typedef int (*counter_api_stop)(const struct device *dev);
 typedef int (*counter_api_get_value)(const struct device *dev,
 				     uint32_t *ticks);
+typedef int (*counter_api_get_value_addr)(const struct device *dev,
+					  const volatile uint32_t **addr);
 typedef int (*counter_api_set_alarm)(const struct device *dev,
 				     uint8_t chan_id,
 				     const struct counter_alarm_cfg *alarm_cfg);
@@ -194,6 +196,7 @@ __subsystem struct counter_driver_api {
 	counter_api_start start;
 	counter_api_stop stop;
 	counter_api_get_value get_value;
+	counter_api_get_value_addr get_value_addr;
 	counter_api_set_alarm set_alarm;
 	counter_api_cancel_alarm cancel_alarm;
 	counter_api_set_top_value set_top_value;
@@ -369,6 +372,36 @@ static inline int z_impl_counter_get_value(const struct device *dev,
 	return api->get_value(dev, ticks);
 }
 
+/**
+ * @brief Get the address of the running counter value register.
+ *
+ * Optional API for hot paths that read the counter at high rates: a
+ * driver whose hardware exposes the current value as a directly
+ * loadable register, already in ticks, returns its address here so
+ * subsequent reads cost one load instead of a driver call. The address
+ * stays valid for the lifetime of the device. Kernel mode only, since
+ * the returned pointer is device memory; all in-tree counters are at
+ * most 32 bits wide, so a single load is always a consistent snapshot.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param addr [out] Address of the register holding the current value.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOTSUP if the driver has no directly readable value register.
+ */
+static inline int counter_get_value_addr(const struct device *dev,
+					 const volatile uint32_t **addr)
+{
+	const struct counter_driver_api *api =
+				(struct counter_driver_api *)dev->api;
+
+	if (api->get_value_addr == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->get_value_addr(dev, addr);
+}
+
 /**
  * @brief Set a single shot alarm on a channel.
  *
@@ -157,6 +157,29 @@ typedef int (*display_write_api)(const struct device *dev, const uint16_t x,
 				 const struct display_buffer_descriptor *desc,
 				 const void *buf);
 
+/**
+ * @typedef display_write_callback_t
+ * @brief Callback invoked when an asynchronous display write completes
+ *
+ * @param dev Pointer to device structure
+ * @param result 0 on success else negative errno code
+ * @param user_data Pointer passed to display_write_async()
+ */
+typedef void (*display_write_callback_t)(const struct device *dev, int result,
+					 void *user_data);
+
+/**
+ * @typedef display_write_async_api
+ * @brief Callback API for writing data to the display without blocking
+ * See display_write_async() for argument description
+ */
+typedef int (*display_write_async_api)(const struct device *dev,
+				       const uint16_t x, const uint16_t y,
+				       const struct display_buffer_descriptor *desc,
+				       const void *buf,
+				       display_write_callback_t callback,
+				       void *user_data);
+
 /**
  * @typedef display_read_api
  * @brief Callback API for reading data from the display
@@ -217,6 +240,13 @@ typedef int (*display_set_orientation_api)(const struct device *dev,
 					   const enum display_orientation
 					   orientation);
 
+/**
+ * @typedef display_wait_vsync_api
+ * @brief Callback API to wait for the vertical synchronisation signal
+ * See display_wait_vsync() for argument description
+ */
+typedef int (*display_wait_vsync_api)(const struct device *dev);
+
 /**
  * @brief Display driver API
  * API which a display driver should expose
@@ -232,6 +262,8 @@ struct display_driver_api {
 	display_get_capabilities_api get_capabilities;
 	display_set_pixel_format_api set_pixel_format;
 	display_set_orientation_api set_orientation;
+	display_write_async_api write_async;
+	display_wait_vsync_api wait_vsync;
 };
 
 /**
@@ -256,6 +288,76 @@ static inline int display_write(const struct device *dev, const uint16_t x,
 	return api->write(dev, x, y, desc, buf);
 }
 
+/**
+ * @brief Write data to display without blocking the caller
+ *
+ * Submit a buffer region for transfer and return without waiting for it
+ * to reach the display, so the caller can prepare the next region while
+ * the previous one streams out. The buffer must remain valid until the
+ * completion callback has been invoked; the callback may run from ISR or
+ * work queue context. Drivers that cannot accept another region yet
+ * return -EBUSY. Drivers without an asynchronous path fall back to the
+ * blocking write and invoke the callback before returning.
+ *
+ * @param dev Pointer to device structure
+ * @param x x Coordinate of the upper left corner where to write the buffer
+ * @param y y Coordinate of the upper left corner where to write the buffer
+ * @param desc Pointer to a structure describing the buffer layout
+ * @param buf Pointer to buffer array
+ * @param callback Function called when the transfer completes, may be NULL
+ * @param user_data Pointer passed to the completion callback
+ *
+ * @retval 0 on success else negative errno code.
+ */
+static inline int display_write_async(const struct device *dev,
+				      const uint16_t x, const uint16_t y,
+				      const struct display_buffer_descriptor *desc,
+				      const void *buf,
+				      display_write_callback_t callback,
+				      void *user_data)
+{
+	struct display_driver_api *api =
+		(struct display_driver_api *)dev->api;
+	int ret;
+
+	if (api->write_async != NULL) {
+		return api->write_async(dev, x, y, desc, buf, callback,
+					user_data);
+	}
+
+	ret = api->write(dev, x, y, desc, buf);
+	if (callback != NULL) {
+		callback(dev, ret, user_data);
+	}
+
+	return ret;
+}
+
+/**
+ * @brief Wait for the display vertical synchronisation signal
+ *
+ * Block until the display controller signals vertical blanking (or the
+ * tearing effect line for panels that expose one), so that a subsequent
+ * write does not race the panel refresh. Displays without such a signal
+ * do not implement this call.
+ *
+ * @param dev Pointer to device structure
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if the display does not expose a vsync/tear signal.
+ */
+static inline int display_wait_vsync(const struct device *dev)
+{
+	struct display_driver_api *api =
+		(struct display_driver_api *)dev->api;
+
+	if (api->wait_vsync == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->wait_vsync(dev);
+}
+
 /**
  * @brief Read data from display
  *
@@ -62,9 +62,13 @@ typedef int (*ec_host_cmd_periph_api_send)(
 	const struct device *dev,
 	const struct ec_host_cmd_periph_tx_buf *tx_buf);
 
+typedef int (*ec_host_cmd_periph_api_get_tx_buf)(const struct device *dev,
+						 uint8_t **buf, size_t *size);
+
 __subsystem struct ec_host_cmd_periph_api {
 	ec_host_cmd_periph_api_init init;
 	ec_host_cmd_periph_api_send send;
+	ec_host_cmd_periph_api_get_tx_buf get_tx_buf;
 };
 
 /**
@@ -120,6 +124,38 @@ static inline int z_impl_ec_host_cmd_periph_send(
 	return api->send(dev, tx_buf);
 }
 
+/**
+ * @brief Get the device-owned transmit buffer
+ *
+ * Optional API: a peripheral whose transmit path is DMA based can expose
+ * its DMA-capable buffer here, so that the command framework builds the
+ * response in place and sending involves no copy. Peripherals without
+ * such a buffer leave this API unimplemented and the framework falls
+ * back to its own buffer. The buffer is owned by the device and valid
+ * for its lifetime; it may only be written between receiving a request
+ * and calling ec_host_cmd_periph_send(). Kernel mode only, since the
+ * returned pointer is device memory.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param buf [out] Address of the device transmit buffer.
+ * @param size [out] Size of the device transmit buffer in bytes.
+ *
+ * @retval 0 if successful
+ * @retval -ENOTSUP if the peripheral has no buffer of its own
+ */
+static inline int ec_host_cmd_periph_get_tx_buf(const struct device *dev,
+						uint8_t **buf, size_t *size)
+{
+	const struct ec_host_cmd_periph_api *api =
+		(const struct ec_host_cmd_periph_api *)dev->api;
+
+	if (api->get_tx_buf == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->get_tx_buf(dev, buf, size);
+}
+
 /**
  * @}
  */
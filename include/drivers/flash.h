@@ -88,6 +88,17 @@ typedef int (*flash_api_sfdp_read)(const struct device *dev, off_t offset,
 				   void *data, size_t len);
 typedef int (*flash_api_read_jedec_id)(const struct device *dev, uint8_t *id);
 
+#if defined(CONFIG_FLASH_ASYNC) || defined(__DOXYGEN__)
+struct k_poll_signal;
+
+typedef int (*flash_api_write_async)(const struct device *dev, off_t offset,
+				     const void *data, size_t len,
+				     struct k_poll_signal *async);
+typedef int (*flash_api_erase_async)(const struct device *dev, off_t offset,
+				     size_t size,
+				     struct k_poll_signal *async);
+#endif /* CONFIG_FLASH_ASYNC */
+
 __subsystem struct flash_driver_api {
 	flash_api_read read;
 	flash_api_write write;
@@ -101,6 +112,10 @@ __subsystem struct flash_driver_api {
 	flash_api_sfdp_read sfdp_read;
 	flash_api_read_jedec_id read_jedec_id;
 #endif /* CONFIG_FLASH_JESD216_API */
+#if defined(CONFIG_FLASH_ASYNC)
+	flash_api_write_async write_async;
+	flash_api_erase_async erase_async;
+#endif /* CONFIG_FLASH_ASYNC */
 };
 
 /**
@@ -192,6 +207,77 @@ static inline int z_impl_flash_erase(const struct device *dev, off_t offset,
 	return api->erase(dev, offset, size);
 }
 
+#if defined(CONFIG_FLASH_ASYNC) || defined(__DOXYGEN__)
+/**
+ *  @brief  Write buffer into flash memory without waiting for completion.
+ *
+ *  Behaves like flash_write() but returns as soon as the operation has
+ *  been handed to the device.  Completion is reported by raising the
+ *  optional @p async poll signal with the operation result.  While the
+ *  operation is in flight other accesses to the device block or, for
+ *  further asynchronous requests, fail with -EBUSY.
+ *
+ *  @note This API is available to kernel mode code only and is
+ *  optional; drivers that do not implement it return -ENOSYS.
+ *
+ *  @param  dev             : flash device
+ *  @param  offset          : starting offset for the write
+ *  @param  data            : data to write, must stay valid until completion
+ *  @param  len             : Number of bytes to write
+ *  @param  async           : signal raised on completion, may be NULL
+ *
+ *  @return  0 if the operation was started, -ENOSYS if the driver does
+ *           not support asynchronous operation, other negative errno
+ *           code on fail.
+ */
+static inline int flash_write_async(const struct device *dev, off_t offset,
+				    const void *data, size_t len,
+				    struct k_poll_signal *async)
+{
+	const struct flash_driver_api *api =
+		(const struct flash_driver_api *)dev->api;
+
+	if (api->write_async == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->write_async(dev, offset, data, len, async);
+}
+
+/**
+ *  @brief  Erase part or all of a flash memory without waiting for
+ *          completion.
+ *
+ *  Behaves like flash_erase() but returns as soon as the operation has
+ *  been handed to the device.  Completion is reported by raising the
+ *  optional @p async poll signal with the operation result.
+ *
+ *  @note This API is available to kernel mode code only and is
+ *  optional; drivers that do not implement it return -ENOSYS.
+ *
+ *  @param  dev             : flash device
+ *  @param  offset          : erase area starting offset
+ *  @param  size            : size of area to be erased
+ *  @param  async           : signal raised on completion, may be NULL
+ *
+ *  @return  0 if the operation was started, -ENOSYS if the driver does
+ *           not support asynchronous operation, other negative errno
+ *           code on fail.
+ */
+static inline int flash_erase_async(const struct device *dev, off_t offset,
+				    size_t size, struct k_poll_signal *async)
+{
+	const struct flash_driver_api *api =
+		(const struct flash_driver_api *)dev->api;
+
+	if (api->erase_async == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->erase_async(dev, offset, size, async);
+}
+#endif /* CONFIG_FLASH_ASYNC */
+
 /**
  *  @brief  Enable or disable write protection for a flash memory
  *
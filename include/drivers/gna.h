@@ -205,6 +205,11 @@ static inline int gna_deregister_model(const struct device *dev, void *model)
  * input data vector
  * A callback is provided for notification of inference completion
  *
+ * Several requests may be outstanding at a time, up to the driver's
+ * pending request limit; queued requests are scored back to back in
+ * submission order, each completion invoking its callback. The input
+ * buffer of a queued request must stay valid until its callback runs.
+ *
  * @param dev Pointer to the device structure for the driver instance.
  * @param req Information required to perform inference on a neural network
  * @param callback A callback function to notify inference completion
@@ -1033,6 +1033,12 @@ static inline int gpio_pin_toggle(const struct device *port, gpio_pin_t pin)
 
 /**
  * @brief Helper to initialize a struct gpio_callback properly
+ *
+ * A callback registered with a multi-pin mask is invoked once per
+ * interrupt with the mask of all its pins that triggered, not once per
+ * pin; registering one callback for a group of related pins is both
+ * correct and cheaper than one callback per pin.
+ *
  * @param callback A valid Application's callback structure pointer.
  * @param handler A valid handler function pointer.
  * @param pin_mask A bit mask of relevant pins for the handler
@@ -121,6 +121,21 @@ struct i2c_msg {
 	uint8_t		flags;
 };
 
+/**
+ * @typedef i2c_callback_t
+ * @brief Completion callback for an asynchronous I2C transfer.
+ *
+ * Called when a transfer submitted with i2c_transfer_async() has
+ * completed.  May be invoked from interrupt context or from a
+ * system-owned thread, so it must not block.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param result 0 on success, negative errno code otherwise.
+ * @param userdata Context pointer given at submission.
+ */
+typedef void (*i2c_callback_t)(const struct device *dev, int result,
+			       void *userdata);
+
 /**
  * @cond INTERNAL_HIDDEN
  *
@@ -169,6 +184,12 @@ typedef int (*i2c_api_full_io_t)(const struct device *dev,
 				 struct i2c_msg *msgs,
 				 uint8_t num_msgs,
 				 uint16_t addr);
+typedef int (*i2c_api_transfer_async_t)(const struct device *dev,
+					struct i2c_msg *msgs,
+					uint8_t num_msgs,
+					uint16_t addr,
+					i2c_callback_t cb,
+					void *userdata);
 typedef int (*i2c_api_slave_register_t)(const struct device *dev,
 					struct i2c_slave_config *cfg);
 typedef int (*i2c_api_slave_unregister_t)(const struct device *dev,
@@ -178,6 +199,9 @@ typedef int (*i2c_api_recover_bus_t)(const struct device *dev);
 __subsystem struct i2c_driver_api {
 	i2c_api_configure_t configure;
 	i2c_api_full_io_t transfer;
+#ifdef CONFIG_I2C_ASYNC
+	i2c_api_transfer_async_t transfer_async;
+#endif /* CONFIG_I2C_ASYNC */
 	i2c_api_slave_register_t slave_register;
 	i2c_api_slave_unregister_t slave_unregister;
 	i2c_api_recover_bus_t recover_bus;
@@ -256,6 +280,40 @@ static inline int z_impl_i2c_transfer(const struct device *dev,
 	return api->transfer(dev, msgs, num_msgs, addr);
 }
 
+#ifdef CONFIG_I2C_ASYNC
+/**
+ * @brief Perform data transfer to another I2C device asynchronously.
+ *
+ * This routine submits a transfer and returns without waiting for it
+ * to finish; @p cb is invoked with the result once the transfer has
+ * completed.  Transfers submitted while the bus is busy are queued and
+ * processed in submission order, so multiple clients can keep a bus
+ * utilized without blocking their threads.
+ *
+ * Controllers implementing the transfer_async driver API run the
+ * queued transfers under interrupt or DMA control; for other
+ * controllers the transfers are issued from a common system-owned
+ * thread.  The message array and buffers must stay valid until the
+ * callback is invoked.
+ *
+ * @note This API is available only to kernel-mode callers.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ * @param msgs Array of messages to transfer.
+ * @param num_msgs Number of messages to transfer.
+ * @param addr Address of the I2C target device.
+ * @param cb Completion callback, or NULL for fire-and-forget.
+ * @param userdata Context passed to the completion callback.
+ *
+ * @retval 0 If the transfer was successfully submitted.
+ * @retval -EAGAIN If the transaction queue is full.
+ * @retval negative On other submission errors.
+ */
+int i2c_transfer_async(const struct device *dev,
+		       struct i2c_msg *msgs, uint8_t num_msgs,
+		       uint16_t addr, i2c_callback_t cb, void *userdata);
+#endif /* CONFIG_I2C_ASYNC */
+
 /**
  * @brief Recover the I2C bus
  *
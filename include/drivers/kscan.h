@@ -19,6 +19,8 @@
 #include <zephyr/types.h>
 #include <stddef.h>
 #include <device.h>
+#include <kernel.h>
+#include <sys/util.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -129,6 +131,138 @@ static inline int z_impl_kscan_disable_callback(const struct device *dev)
 	return api->disable_callback(dev);
 }
 
+/**
+ * @brief Timestamped keyboard scan event.
+ *
+ * Record format used by the kscan event ring below. The timestamp is
+ * taken with k_cycle_get_32() when the event is queued, so consumers
+ * (e.g. gesture velocity computation) see the sample time rather than
+ * the time the UI got around to processing the event.
+ */
+struct kscan_event {
+	/** Hardware cycle count when the event was queued. */
+	uint32_t timestamp;
+	/** Row reported by the driver. */
+	uint16_t row;
+	/** Column reported by the driver. */
+	uint16_t column;
+	/** True for press/contact, false for release. */
+	bool pressed;
+};
+
+/**
+ * @brief Single-producer single-consumer ring of kscan events.
+ *
+ * Thin batching layer on top of the per-event kscan callback: the
+ * callback queues one record per invocation (from ISR, timer or work
+ * queue context) and the consumer claims runs of contiguous records in
+ * place, so a poll cycle that produced several events is processed in
+ * one pass instead of one callback round-trip per event.
+ *
+ * Indices free-run and are masked on access, ring_buffer style; the
+ * slot count must be a power of two.
+ */
+struct kscan_event_ring {
+	/** Event storage, @a size slots. */
+	struct kscan_event *events;
+	/** Number of slots, power of two. */
+	uint16_t size;
+	/** Producer index (free-running). */
+	volatile uint16_t head;
+	/** Consumer index (free-running). */
+	volatile uint16_t tail;
+};
+
+/**
+ * @brief Define and initialize a kscan event ring.
+ *
+ * @param name Name of the ring.
+ * @param size32 Number of event slots, must be a power of two.
+ */
+#define KSCAN_EVENT_RING_DEFINE(name, size32)				\
+	BUILD_ASSERT(((size32) & ((size32) - 1)) == 0,			\
+		     "kscan event ring size must be a power of two");	\
+	static struct kscan_event _ring_buf_events_##name[size32];	\
+	struct kscan_event_ring name = {				\
+		.events = _ring_buf_events_##name,			\
+		.size = (size32),					\
+	}
+
+/**
+ * @brief Queue one event, timestamped with the current cycle count.
+ *
+ * Callable from ISR context. When the ring is full the event is
+ * dropped and false is returned; sizing the ring for the scan rate
+ * times the worst-case consumer latency avoids this.
+ *
+ * @param ring Event ring.
+ * @param row Row reported by the driver.
+ * @param column Column reported by the driver.
+ * @param pressed True for press/contact, false for release.
+ *
+ * @retval true If the event was queued.
+ * @retval false If the ring was full.
+ */
+static inline bool kscan_event_ring_put(struct kscan_event_ring *ring,
+					uint16_t row, uint16_t column,
+					bool pressed)
+{
+	uint16_t mask = ring->size - 1U;
+	struct kscan_event *evt;
+
+	if ((uint16_t)(ring->head - ring->tail) >= ring->size) {
+		return false;
+	}
+
+	evt = &ring->events[ring->head & mask];
+	evt->timestamp = k_cycle_get_32();
+	evt->row = row;
+	evt->column = column;
+	evt->pressed = pressed;
+
+	ring->head++;
+
+	return true;
+}
+
+/**
+ * @brief Claim a contiguous batch of queued events for processing.
+ *
+ * Returns a pointer to the oldest queued events without copying them
+ * out. The batch may be shorter than the number of queued events when
+ * the data wraps around the end of the ring; claim again after
+ * releasing to get the remainder.
+ *
+ * @param ring Event ring.
+ * @param events [out] Set to the start of the claimed batch.
+ *
+ * @return Number of events claimed, zero if the ring is empty.
+ */
+static inline uint16_t kscan_event_ring_claim(struct kscan_event_ring *ring,
+					      struct kscan_event **events)
+{
+	uint16_t mask = ring->size - 1U;
+	uint16_t tail = ring->tail;
+	uint16_t used = (uint16_t)(ring->head - tail);
+	uint16_t run = ring->size - (tail & mask);
+
+	*events = &ring->events[tail & mask];
+
+	return MIN(used, run);
+}
+
+/**
+ * @brief Release events claimed with kscan_event_ring_claim().
+ *
+ * @param ring Event ring.
+ * @param count Number of events processed, at most the claimed count.
+ */
+static inline void kscan_event_ring_release(struct kscan_event_ring *ring,
+					    uint16_t count)
+{
+	ring->tail += count;
+}
+
 #ifdef __cplusplus
 }
 #endif
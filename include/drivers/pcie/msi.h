@@ -72,6 +72,42 @@ extern uint16_t pcie_msi_mdr(unsigned int irq);
  */
 extern bool pcie_set_msi(pcie_bdf_t bdf, unsigned int irq);
 
+#ifdef CONFIG_PCIE_MSIX
+
+/**
+ * @brief Compute the target address for an MSI-X posted write.
+ *
+ * This function is exported by the arch, board or SoC code. It is the
+ * MSI-X counterpart of pcie_msi_map(), with the write directed at a
+ * specific CPU so each vector of a multi-vector endpoint can be
+ * serviced on its own CPU. On non-SMP targets the cpu argument is
+ * ignored and the result equals pcie_msi_map().
+ *
+ * @param irq The IRQ we wish to trigger via MSI-X.
+ * @param cpu The CPU which should service the vector.
+ * @return A (32-bit) value for the MSI-X message address.
+ */
+extern uint32_t pcie_msix_map(unsigned int irq, unsigned int cpu);
+
+/**
+ * @brief Configure the given PCI endpoint to generate MSI-X.
+ *
+ * Programs the endpoint's MSI-X table so that vector n triggers
+ * irqs[n], unmasks the vectors and enables MSI-X. On SMP targets the
+ * vectors are spread round-robin over the available CPUs, so e.g. RX
+ * and TX completions of a network endpoint are serviced in parallel.
+ *
+ * @param bdf the target PCI endpoint
+ * @param irqs array of IRQs, one per vector, in table order
+ * @param n_vector number of vectors to program
+ * @return true if the endpoint supports at least n_vector MSI-X
+ *	   vectors, false otherwise.
+ */
+extern bool pcie_set_msix(pcie_bdf_t bdf, const unsigned int *irqs,
+			  unsigned int n_vector);
+
+#endif /* CONFIG_PCIE_MSIX */
+
 /*
  * MSI capability IDs in the PCI configuration capability list.
  */
@@ -100,6 +136,40 @@ extern bool pcie_set_msi(pcie_bdf_t bdf, unsigned int irq);
 #define PCIE_MSI_MDR_32		2U
 #define PCIE_MSI_MDR_64		3U
 
+/*
+ * The first word of the MSI-X capability is laid out like the MSI MCR:
+ * capability ID and list link in the low 16 bits, the MXC in the high
+ * 16 bits. The second word locates the vector table: a BAR indicator
+ * in the low 3 bits and a (8-byte aligned) offset into that BAR.
+ */
+
+#define PCIE_MSIX_MCR		0U
+
+#define PCIE_MSIX_MCR_EN	0x80000000U  /* enable MSI-X */
+#define PCIE_MSIX_MCR_FMASK	0x40000000U  /* function mask */
+#define PCIE_MSIX_MCR_TSIZE	0x07FF0000U  /* table size - 1 */
+#define PCIE_MSIX_MCR_TSIZE_SHIFT	16
+
+#define PCIE_MSIX_TR		1U
+
+#define PCIE_MSIX_TR_BIR	0x00000007U  /* BAR indicator */
+#define PCIE_MSIX_TR_OFFSET	0xFFFFFFF8U  /* offset into the BAR */
+
+/*
+ * Each vector table entry is four words: message address (low, high),
+ * message data and vector control. Bit 0 of the vector control word
+ * masks the vector.
+ */
+
+#define PCIE_MSIX_ENTRY_SIZE	16U
+
+#define PCIE_MSIX_ENTRY_MAP0	0U
+#define PCIE_MSIX_ENTRY_MAP1	1U
+#define PCIE_MSIX_ENTRY_MDR	2U
+#define PCIE_MSIX_ENTRY_VCTRL	3U
+
+#define PCIE_MSIX_VCTRL_MASK	0x00000001U
+
 #ifdef __cplusplus
 }
 #endif
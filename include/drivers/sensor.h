@@ -233,6 +233,14 @@ enum sensor_trigger_type {
 	/** Trigger fires when a free fall is detected. */
 	SENSOR_TRIG_FREEFALL,
 
+	/**
+	 * Trigger fires when the hardware FIFO fill level reaches the
+	 * watermark configured via the @ref SENSOR_ATTR_FIFO_WATERMARK
+	 * attribute.  The accumulated samples are typically retrieved
+	 * from the handler with sensor_batch_fetch().
+	 */
+	SENSOR_TRIG_FIFO_WATERMARK,
+
 	/**
 	 * Number of all common sensor triggers.
 	 */
@@ -294,6 +302,12 @@ enum sensor_attribute {
 	 * algorithms to calibrate itself on a certain axis, or all of them.
 	 */
 	SENSOR_ATTR_CALIB_TARGET,
+	/**
+	 * Number of samples the hardware FIFO accumulates before the
+	 * @ref SENSOR_TRIG_FIFO_WATERMARK trigger fires.  Setting 0
+	 * disables use of the FIFO.
+	 */
+	SENSOR_ATTR_FIFO_WATERMARK,
 
 	/**
 	 * Number of all common sensor attributes.
@@ -322,6 +336,25 @@ enum sensor_attribute {
 typedef void (*sensor_trigger_handler_t)(const struct device *dev,
 					 struct sensor_trigger *trigger);
 
+/**
+ * @brief Batch of raw sensor samples.
+ *
+ * Describes a caller-provided buffer that sensor_batch_fetch() fills
+ * with unscaled samples in the sensor's native encoding.  Scaling is
+ * deferred: individual samples are converted on demand with
+ * sensor_batch_get().
+ */
+struct sensor_batch {
+	/** Caller-provided buffer receiving the raw samples. */
+	void *buf;
+	/** Size of the buffer, in bytes. */
+	size_t size;
+	/** Size of one raw sample in bytes, filled in by the driver. */
+	size_t sample_size;
+	/** Number of samples placed in the buffer by the driver. */
+	size_t count;
+};
+
 /**
  * @typedef sensor_attr_set_t
  * @brief Callback API upon setting a sensor's attributes
@@ -371,12 +404,35 @@ typedef int (*sensor_channel_get_t)(const struct device *dev,
 				    enum sensor_channel chan,
 				    struct sensor_value *val);
 
+/**
+ * @typedef sensor_batch_fetch_t
+ * @brief Callback API for fetching a batch of raw samples
+ *
+ * See sensor_batch_fetch() for argument description
+ */
+typedef int (*sensor_batch_fetch_t)(const struct device *dev,
+				    enum sensor_channel chan,
+				    struct sensor_batch *batch);
+/**
+ * @typedef sensor_batch_get_t
+ * @brief Callback API for scaling one sample of a fetched batch
+ *
+ * See sensor_batch_get() for argument description
+ */
+typedef int (*sensor_batch_get_t)(const struct device *dev,
+				  enum sensor_channel chan,
+				  const struct sensor_batch *batch,
+				  size_t idx,
+				  struct sensor_value *val);
+
 __subsystem struct sensor_driver_api {
 	sensor_attr_set_t attr_set;
 	sensor_attr_get_t attr_get;
 	sensor_trigger_set_t trigger_set;
 	sensor_sample_fetch_t sample_fetch;
 	sensor_channel_get_t channel_get;
+	sensor_batch_fetch_t batch_fetch;
+	sensor_batch_get_t batch_get;
 };
 
 /**
@@ -566,6 +622,87 @@ static inline int z_impl_sensor_channel_get(const struct device *dev,
 	return api->channel_get(dev, chan, val);
 }
 
+/**
+ * @brief Fetch a batch of raw samples from the sensor FIFO.
+ *
+ * Reads as many accumulated samples as fit in the batch buffer in a
+ * single bus transaction, without scaling them.  This is meant to be
+ * used with hardware FIFOs, typically from a @ref
+ * SENSOR_TRIG_FIFO_WATERMARK trigger handler, so that a high-rate
+ * stream costs one transaction and one wakeup per watermark instead
+ * of per sample.
+ *
+ * The driver fills in the batch sample_size and count fields; samples
+ * are stored oldest first in the sensor's native encoding and are
+ * converted on demand with sensor_batch_get().
+ *
+ * @param dev Pointer to the sensor device
+ * @param chan The channel to read, or SENSOR_CHAN_ALL
+ * @param batch Batch descriptor with buf and size filled in
+ *
+ * @return 0 if successful, -ENOTSUP if the driver has no FIFO
+ *         support, negative errno code on other failure.
+ */
+__syscall int sensor_batch_fetch(const struct device *dev,
+				 enum sensor_channel chan,
+				 struct sensor_batch *batch);
+
+static inline int z_impl_sensor_batch_fetch(const struct device *dev,
+					    enum sensor_channel chan,
+					    struct sensor_batch *batch)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->batch_fetch == NULL) {
+		return -ENOTSUP;
+	}
+
+	return api->batch_fetch(dev, chan, batch);
+}
+
+/**
+ * @brief Scale one raw sample of a previously fetched batch.
+ *
+ * Converts sample @p idx of @p batch to scaled sensor_value
+ * representation, exactly as sensor_channel_get() would have done at
+ * sampling time.  For vectorial channels (_XYZ suffix) the result is
+ * returned at val[0], val[1] and val[2].
+ *
+ * @param dev Pointer to the sensor device
+ * @param chan The channel to convert
+ * @param batch Batch previously filled by sensor_batch_fetch()
+ * @param idx Index of the sample within the batch
+ * @param val Where to store the value(s)
+ *
+ * @return 0 if successful, negative errno code if failure.
+ */
+__syscall int sensor_batch_get(const struct device *dev,
+			       enum sensor_channel chan,
+			       const struct sensor_batch *batch,
+			       size_t idx,
+			       struct sensor_value *val);
+
+static inline int z_impl_sensor_batch_get(const struct device *dev,
+					  enum sensor_channel chan,
+					  const struct sensor_batch *batch,
+					  size_t idx,
+					  struct sensor_value *val)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->batch_get == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (idx >= batch->count) {
+		return -EINVAL;
+	}
+
+	return api->batch_get(dev, chan, batch, idx, val);
+}
+
 /**
  * @brief The value of gravitational constant in micro m/s^2.
  */
@@ -200,6 +200,28 @@ struct spi_buf_set {
 	size_t count;
 };
 
+/**
+ * @brief Batched SPI transaction flags
+ */
+/* Keep CS asserted between this entry and the next one of a batch */
+#define SPI_BATCH_CS_HOLD	BIT(0)
+
+/**
+ * @brief One transfer of a batched SPI transaction
+ *
+ * @param tx_bufs is a valid pointer on a spi_buf_set to transmit,
+ *    or NULL if none.
+ * @param rx_bufs is a valid pointer on a spi_buf_set to receive into,
+ *    or NULL if none.
+ * @param flags is a bit field of SPI_BATCH_* flags applying to this
+ *    entry only.
+ */
+struct spi_batch_entry {
+	const struct spi_buf_set *tx_bufs;
+	const struct spi_buf_set *rx_bufs;
+	uint16_t flags;
+};
+
 /**
  * @typedef spi_api_io
  * @brief Callback API for I/O
@@ -221,6 +243,17 @@ typedef int (*spi_api_io_async)(const struct device *dev,
 				const struct spi_buf_set *rx_bufs,
 				struct k_poll_signal *async);
 
+/**
+ * @typedef spi_api_io_batch
+ * @brief Callback API for batched I/O
+ * See spi_transceive_batch() for argument descriptions
+ */
+typedef int (*spi_api_io_batch)(const struct device *dev,
+				const struct spi_config *config,
+				const struct spi_batch_entry *entries,
+				size_t count,
+				struct k_poll_signal *async);
+
 /**
  * @typedef spi_api_release
  * @brief Callback API for unlocking SPI device.
@@ -239,6 +272,9 @@ __subsystem struct spi_driver_api {
 #ifdef CONFIG_SPI_ASYNC
 	spi_api_io_async transceive_async;
 #endif /* CONFIG_SPI_ASYNC */
+#ifdef CONFIG_SPI_BATCH
+	spi_api_io_batch transceive_batch;
+#endif /* CONFIG_SPI_BATCH */
 	spi_api_release release;
 };
 
@@ -418,6 +454,73 @@ static inline int spi_write_async(const struct device *dev,
 	return spi_transceive_async(dev, config, tx_bufs, NULL, async);
 }
 
+/**
+ * @brief Submit a batch of transfers as one transaction.
+ *
+ * All entries of the batch share the given configuration and are
+ * processed in order; @p async is signaled once when the whole batch
+ * has completed.  Controllers implementing this call natively chain
+ * the entries through their DMA engine, so no CPU involvement is
+ * needed between transfers; on other controllers the entries are
+ * processed as consecutive synchronous transceive calls and the
+ * per-entry SPI_BATCH_CS_HOLD flag is not honored (CS follows the
+ * configuration, as for spi_transceive).
+ *
+ * @param dev Pointer to the device structure for the driver instance
+ * @param config Pointer to a valid spi_config structure instance.
+ *        Pointer-comparison may be used to detect changes from
+ *        previous operations.
+ * @param entries Array of transfers making up the batch.  The array
+ *        and all referenced buffers must stay valid until completion.
+ * @param count Number of entries in the array.
+ * @param async A pointer to a valid and ready to be signaled
+ *        struct k_poll_signal, signaled once for the whole batch.
+ *        (Note: if NULL this function will not notify the end of the
+ *        transaction, and whether it went successfully or not).
+ *
+ * @retval 0 If the batch was successfully submitted, negative errno
+ *         code otherwise.
+ */
+static inline int spi_transceive_batch(const struct device *dev,
+				       const struct spi_config *config,
+				       const struct spi_batch_entry *entries,
+				       size_t count,
+				       struct k_poll_signal *async)
+{
+#ifdef CONFIG_SPI_BATCH
+	const struct spi_driver_api *api =
+		(const struct spi_driver_api *)dev->api;
+	int ret = 0;
+
+	if (api->transceive_batch != NULL) {
+		return api->transceive_batch(dev, config, entries, count,
+					     async);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		ret = api->transceive(dev, config, entries[i].tx_bufs,
+				      entries[i].rx_bufs);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	if (async != NULL) {
+		k_poll_signal_raise(async, ret);
+	}
+
+	return ret;
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(config);
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+	ARG_UNUSED(async);
+
+	return -ENOTSUP;
+#endif /* CONFIG_SPI_BATCH */
+}
+
 /**
  * @brief Release the SPI device locked on by the current config
  *
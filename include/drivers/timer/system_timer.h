@@ -126,6 +126,41 @@ extern void z_clock_announce(int32_t ticks);
  */
 extern uint32_t z_clock_elapsed(void);
 
+#ifdef CONFIG_HIRES_TIMER
+/**
+ * @brief Program the high resolution alarm comparator
+ *
+ * Requests an interrupt when the free-running cycle counter (the one
+ * read through z_timer_cycle_get_32()) reaches the given value,
+ * independent of the tick period.  Only one alarm is pending at a
+ * time; a new call replaces the previous target.  The driver must call
+ * z_hires_timer_expire() from its interrupt handler once the target
+ * has been reached or passed.  Targets in the past (modulo 2^32) must
+ * fire as soon as possible.
+ *
+ * Implemented only by drivers that select TIMER_HAS_HIRES_ALARM.
+ *
+ * @param cycle Absolute cycle counter value to interrupt at
+ */
+extern void z_clock_hires_alarm_set(uint32_t cycle);
+
+/**
+ * @brief Cancel the pending high resolution alarm, if any
+ *
+ * A spurious z_hires_timer_expire() call after cancellation is
+ * permitted; the kernel re-checks expiry times itself.
+ */
+extern void z_clock_hires_alarm_cancel(void);
+
+/**
+ * @brief Announce high resolution alarm expiry to the kernel
+ *
+ * Called by the timer driver from interrupt context when the alarm
+ * programmed with z_clock_hires_alarm_set() has been reached.
+ */
+extern void z_hires_timer_expire(void);
+#endif /* CONFIG_HIRES_TIMER */
+
 #ifdef __cplusplus
 }
 #endif
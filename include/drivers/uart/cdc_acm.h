@@ -46,6 +46,148 @@ typedef void (*cdc_dte_rate_callback_t)(const struct device *dev,
 int cdc_acm_dte_rate_callback_set(const struct device *dev,
 				  cdc_dte_rate_callback_t callback);
 
+/**
+ * @brief CDC ACM ring buffer events.
+ */
+enum cdc_acm_event {
+	/** TX ring buffer free space rose to the configured watermark */
+	CDC_ACM_EVENT_TX_SPACE,
+	/** RX ring buffer fill level rose to the configured watermark */
+	CDC_ACM_EVENT_RX_DATA,
+};
+
+/**
+ * @typedef cdc_acm_event_callback_t
+ * @brief A function that is called when a ring buffer watermark is
+ * crossed.
+ *
+ * The callback is invoked from the USB work queue.
+ *
+ * @param dev       CDC ACM device structure.
+ * @param event     Event that triggered the callback.
+ * @param user_data User data given to cdc_acm_event_callback_set().
+ */
+typedef void (*cdc_acm_event_callback_t)(const struct device *dev,
+					 enum cdc_acm_event event,
+					 void *user_data);
+
+/**
+ * @brief Set the callback for ring buffer watermark events.
+ *
+ * @note This function is available only when
+ * CONFIG_CDC_ACM_RINGBUF_API is enabled.
+ *
+ * @param dev       CDC ACM device structure.
+ * @param callback  Event handler.
+ * @param user_data User data passed to the handler.
+ *
+ * @return	    0 on success.
+ */
+int cdc_acm_event_callback_set(const struct device *dev,
+			       cdc_acm_event_callback_t callback,
+			       void *user_data);
+
+/**
+ * @brief Set the TX free space watermark.
+ *
+ * A CDC_ACM_EVENT_TX_SPACE event is delivered whenever the free space
+ * in the TX ring buffer rises to at least @a space bytes. A value of
+ * zero (the default) disables the event.
+ *
+ * @note This function is available only when
+ * CONFIG_CDC_ACM_RINGBUF_API is enabled.
+ *
+ * @param dev   CDC ACM device structure.
+ * @param space Watermark in bytes.
+ *
+ * @return	0 on success, -EINVAL if the watermark exceeds the
+ *		ring buffer capacity.
+ */
+int cdc_acm_tx_watermark_set(const struct device *dev, uint32_t space);
+
+/**
+ * @brief Set the RX fill level watermark.
+ *
+ * A CDC_ACM_EVENT_RX_DATA event is delivered whenever the amount of
+ * data in the RX ring buffer rises to at least @a level bytes. A value
+ * of zero (the default) disables the event.
+ *
+ * @note This function is available only when
+ * CONFIG_CDC_ACM_RINGBUF_API is enabled.
+ *
+ * @param dev   CDC ACM device structure.
+ * @param level Watermark in bytes.
+ *
+ * @return	0 on success, -EINVAL if the watermark exceeds the
+ *		ring buffer capacity.
+ */
+int cdc_acm_rx_watermark_set(const struct device *dev, uint32_t level);
+
+/**
+ * @brief Claim a contiguous region of the TX ring buffer.
+ *
+ * The region can be filled in place, without the byte copy of the UART
+ * FIFO emulation path, and is handed to the USB stack with
+ * cdc_acm_tx_commit(). The region may be smaller than requested when
+ * it wraps or the buffer is nearly full; claim again for the rest.
+ *
+ * @note This function is available only when
+ * CONFIG_CDC_ACM_RINGBUF_API is enabled.
+ *
+ * @param dev        CDC ACM device structure.
+ * @param[out] data  Pointer to the claimed region.
+ * @param size       Number of bytes to claim.
+ *
+ * @return	     Number of bytes claimed, can be 0.
+ */
+uint32_t cdc_acm_tx_claim(const struct device *dev, uint8_t **data,
+			  uint32_t size);
+
+/**
+ * @brief Commit bytes written to a claimed TX region and start sending.
+ *
+ * @note This function is available only when
+ * CONFIG_CDC_ACM_RINGBUF_API is enabled.
+ *
+ * @param dev  CDC ACM device structure.
+ * @param size Number of bytes written, up to the claimed amount.
+ *
+ * @return     0 on success, negative errno code on fail.
+ */
+int cdc_acm_tx_commit(const struct device *dev, uint32_t size);
+
+/**
+ * @brief Claim a contiguous region of received data for reading.
+ *
+ * The data can be consumed in place; release it with
+ * cdc_acm_rx_finish(). The region may be smaller than the amount of
+ * buffered data when it wraps; claim again for the rest.
+ *
+ * @note This function is available only when
+ * CONFIG_CDC_ACM_RINGBUF_API is enabled.
+ *
+ * @param dev        CDC ACM device structure.
+ * @param[out] data  Pointer to the claimed region.
+ * @param size       Maximum number of bytes to claim.
+ *
+ * @return	     Number of bytes claimed, can be 0.
+ */
+uint32_t cdc_acm_rx_claim(const struct device *dev, uint8_t **data,
+			  uint32_t size);
+
+/**
+ * @brief Release a claimed RX region.
+ *
+ * @note This function is available only when
+ * CONFIG_CDC_ACM_RINGBUF_API is enabled.
+ *
+ * @param dev  CDC ACM device structure.
+ * @param size Number of bytes consumed, up to the claimed amount.
+ *
+ * @return     0 on success, negative errno code on fail.
+ */
+int cdc_acm_rx_finish(const struct device *dev, uint32_t size);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
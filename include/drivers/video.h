@@ -297,7 +297,12 @@ static inline int video_get_format(const struct device *dev,
  * @brief Enqueue a video buffer.
  *
  * Enqueue an empty (capturing) or filled (output) video buffer in the driver’s
- * endpoint incoming queue.
+ * endpoint incoming queue. Ownership of the buffer passes to the driver: the
+ * application must not touch the buffer memory until the buffer is handed
+ * back by video_dequeue(). Several buffers are typically kept rotating
+ * between application and driver this way, so the device always has a
+ * buffer to transfer into (or from) while the application processes the
+ * previous one, without any intermediate copy.
  *
  * @param dev Pointer to the device structure for the driver instance.
  * @param ep Endpoint ID.
@@ -325,7 +330,8 @@ static inline int video_enqueue(const struct device *dev,
  * @brief Dequeue a video buffer.
  *
  * Dequeue a filled (capturing) or displayed (output) buffer from the driver’s
- * enpoint outgoing queue.
+ * enpoint outgoing queue. Ownership of the buffer returns to the
+ * application, which re-enqueues it once done with the content.
  *
  * @param dev Pointer to the device structure for the driver instance.
  * @param ep Endpoint ID.
@@ -540,6 +546,24 @@ static inline int video_set_signal(const struct device *dev,
  */
 struct video_buffer *video_buffer_alloc(size_t size);
 
+/**
+ * @brief Attach external memory as a video buffer.
+ *
+ * Wrap caller-owned memory in a video buffer so the device transfers
+ * directly into (or from) it, e.g. the input buffer of a downstream
+ * encoder, avoiding a copy per frame. The memory must satisfy the
+ * device's alignment and placement constraints (DMA reachability, cache
+ * line alignment) and must stay valid until the buffer is released.
+ * video_buffer_release() only puts the tracking structure back, it never
+ * frees attached memory.
+ *
+ * @param buffer Pointer to the externally allocated memory.
+ * @param size Size of the memory in bytes.
+ *
+ * @retval pointer to the video buffer, NULL if no buffer available.
+ */
+struct video_buffer *video_buffer_attach(uint8_t *buffer, size_t size);
+
 /**
  * @brief Release a video buffer.
  *
@@ -101,6 +101,13 @@ struct fcb {
 	struct flash_sector *f_sectors;
 	/**< Array of sectors, must be contiguous */
 
+	uint16_t *f_entry_cnts;
+	/**< Optional array of f_sector_cnt entry counters. When not NULL
+	 * FCB keeps the number of valid entries per sector in RAM, so
+	 * walks like fcb_offset_last_n() skip whole sectors instead of
+	 * reading every entry header from flash.
+	 */
+
 	/* Flash circular buffer internal state */
 	struct k_mutex f_mtx;
 	/**< Locking for accessing the FCB data, internal state */
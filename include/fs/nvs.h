@@ -57,6 +57,12 @@ struct nvs_fs {
 	struct k_mutex nvs_lock;
 	const struct device *flash_device;
 	const struct flash_parameters *flash_parameters;
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+#endif
+#if defined(CONFIG_NVS_BACKGROUND_GC)
+	struct k_work gc_work;	/* proactive sector close and gc */
+#endif
 };
 
 /**
@@ -49,15 +49,67 @@ struct init_entry {
 	 * if the init entry is not used for a device driver but a services.
 	 */
 	const struct device *dev;
+#ifdef CONFIG_PARALLEL_SYS_INIT
+	/** Initialization priority within the level, needed at runtime
+	 * to delimit the groups of entries that may run concurrently.
+	 */
+	uint8_t prio;
+#endif
+#ifdef CONFIG_BOOT_TIME_LOG_NAMES
+	/** Name of the init entry, for attributing boot time log records
+	 * to a specific init function without a map file.
+	 */
+	const char *name;
+#endif
 };
 
 void z_sys_init_run_level(int32_t _level);
 
+#ifdef CONFIG_BOOT_TIME_LOG
+/**
+ * @brief One record of the boot time log
+ *
+ * One record is appended for every init entry executed during boot when
+ * CONFIG_BOOT_TIME_LOG is enabled.
+ */
+struct init_time_record {
+	/** Init entry that was executed. */
+	const struct init_entry *entry;
+	/** Cycle counter value when the init function was entered. */
+	uint32_t start;
+	/** Hardware cycles spent in the init function. */
+	uint32_t duration;
+	/** Init level the entry ran at (_SYS_INIT_LEVEL_*). */
+	uint8_t level;
+};
+
+/**
+ * @brief Get the boot time log
+ *
+ * @param records Where to store the pointer to the record table.
+ *
+ * @return Number of valid records.
+ */
+size_t init_time_log_get(const struct init_time_record **records);
+#endif
+
 /* A counter is used to avoid issues when two or more system devices
  * are declared in the same C file with the same init function.
  */
 #define Z_SYS_NAME(_init_fn) _CONCAT(_CONCAT(sys_init_, _init_fn), __COUNTER__)
 
+#ifdef CONFIG_PARALLEL_SYS_INIT
+#define Z_INIT_PRIO_FIELD(_prio) .prio = (_prio),
+#else
+#define Z_INIT_PRIO_FIELD(_prio)
+#endif
+
+#ifdef CONFIG_BOOT_TIME_LOG_NAMES
+#define Z_INIT_NAME_FIELD(_entry_name) .name = STRINGIFY(_entry_name),
+#else
+#define Z_INIT_NAME_FIELD(_entry_name)
+#endif
+
 /**
  * @def Z_INIT_ENTRY_DEFINE
  *
@@ -88,6 +140,8 @@ void z_sys_init_run_level(int32_t _level);
 	__attribute__((__section__(".init_" #_level STRINGIFY(_prio)))) = { \
 		.init = (_init_fn),					\
 		.dev = (_device),					\
+		Z_INIT_PRIO_FIELD(_prio)				\
+		Z_INIT_NAME_FIELD(_entry_name)				\
 	}
 
 /**
@@ -123,6 +177,11 @@ void z_sys_init_run_level(int32_t _level);
  * \li APPLICATION: Used for application components (i.e. non-kernel components)
  * that need automatic configuration. These objects can use all services
  * provided by the kernel during configuration.
+ * \n
+ * \li DEFERRED: Requires CONFIG_DEVICE_DEFERRED_INIT. Entries at this level
+ * are not run during system initialization; the init function runs on the
+ * first device_get_binding() lookup naming the device (or on an explicit
+ * device_deferred_init() call) instead.
  *
  * @param _prio The initialization priority of the object, relative to
  * other objects of the same initialization level. Specified as an integer
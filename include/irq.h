@@ -178,6 +178,39 @@ irq_connect_dynamic(unsigned int irq, unsigned int priority,
  */
 #define ISR_DIRECT_DECLARE(name) ARCH_ISR_DIRECT_DECLARE(name)
 
+/**
+ * @brief Declare a direct ISR wrapping a regular ISR with a constant argument.
+ *
+ * Generates a direct interrupt service routine named @a name that calls
+ * @a isr_p with @a isr_param_p and then takes the normal end-of-interrupt
+ * path (power management idle exit and a scheduling check), so the handler
+ * keeps full kernel integration while being dispatched straight from the
+ * vector table: no software ISR table indirection and no argument load
+ * from RAM, since a constant @a isr_param_p folds into an immediate.
+ *
+ * Use together with IRQ_DIRECT_CONNECT() where IRQ_CONNECT() would have
+ * been used with the same constant arguments:
+ *
+ * ISR_DIRECT_DECLARE_PARAM(my_dev_isr_direct, my_dev_isr, &my_dev_data);
+ * ...
+ * IRQ_DIRECT_CONNECT(MY_IRQ, MY_PRIO, my_dev_isr_direct, 0);
+ *
+ * All limitations of direct interrupts other than parameter passing and
+ * rescheduling still apply, see IRQ_DIRECT_CONNECT().
+ *
+ * @param name symbol name of the generated direct ISR
+ * @param isr_p Address of interrupt service routine.
+ * @param isr_param_p Parameter passed to interrupt service routine, must be
+ *        a compile-time constant expression.
+ */
+#define ISR_DIRECT_DECLARE_PARAM(name, isr_p, isr_param_p)	\
+	ISR_DIRECT_DECLARE(name)				\
+	{							\
+		ISR_DIRECT_PM();				\
+		isr_p(isr_param_p);				\
+		return 1;					\
+	}
+
 /**
  * @brief Lock interrupts.
  * @def irq_lock()
@@ -254,6 +254,27 @@ struct _thread_stack_info {
 typedef struct _thread_stack_info _thread_stack_info_t;
 #endif /* CONFIG_THREAD_STACK_INFO */
 
+#if defined(CONFIG_TRACING_THREAD_PROFILER)
+/* Counters maintained by the thread profiler tracing hooks */
+struct _thread_profiler_stats {
+	/* Accumulated execution time in hardware cycles */
+	uint64_t cycles;
+
+	/* Number of times the thread has been switched in */
+	uint32_t switches;
+
+	/* Largest observed delay between becoming ready and being
+	 * switched in, in hardware cycles
+	 */
+	uint32_t max_latency;
+
+	/* Cycle stamp taken when the thread was made ready, consumed
+	 * when it is switched in; zero when no stamp is pending
+	 */
+	uint32_t ready_cycle;
+};
+#endif /* CONFIG_TRACING_THREAD_PROFILER */
+
 #if defined(CONFIG_USERSPACE)
 struct _mem_domain_info {
 	/** memory domain queue node */
@@ -343,6 +364,11 @@ struct k_thread {
 	struct _thread_stack_info stack_info;
 #endif /* CONFIG_THREAD_STACK_INFO */
 
+#if defined(CONFIG_TRACING_THREAD_PROFILER)
+	/** thread profiler counters */
+	struct _thread_profiler_stats profiler;
+#endif /* CONFIG_TRACING_THREAD_PROFILER */
+
 #if defined(CONFIG_USERSPACE)
 	/** memory domain info of the thread */
 	struct _mem_domain_info mem_domain_info;
@@ -488,6 +514,17 @@ extern void k_thread_foreach_unlocked(
  */
 #define K_INHERIT_PERMS (BIT(3))
 
+/**
+ * @brief Recycled stack
+ *
+ * @details
+ * Indicates that the stack object is being reused from a previous thread
+ * whose lifetime has ended, so the debug repainting of the stack buffer
+ * performed under @option{CONFIG_INIT_STACKS} is skipped. Set internally
+ * by k_thread_pool_spawn(); not intended for direct use.
+ */
+#define K_STACK_RECYCLED (BIT(4))
+
 #ifdef CONFIG_X86
 /* x86 Bitmask definitions for threads user options */
 
@@ -2075,6 +2112,32 @@ extern int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list);
  */
 __syscall void *k_queue_get(struct k_queue *queue, k_timeout_t timeout);
 
+/**
+ * @brief Get a batch of elements from a queue.
+ *
+ * This routine removes up to @a count data items from @a queue into
+ * @a array under a single lock hold, so drain loops pay the
+ * synchronization cost once per batch instead of once per item. If the
+ * queue is empty the routine waits like k_queue_get() for the first
+ * item, then tops the batch up with whatever was enqueued alongside it
+ * without waiting again.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param queue Address of the queue.
+ * @param array Array of @a count data item pointers to fill in.
+ * @param count Maximum number of data items to remove.
+ * @param timeout Non-negative waiting period to obtain the first data
+ *                item or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of data items placed in @a array; zero if returned
+ * without waiting, or waiting period timed out. -EINVAL on bad
+ * parameters.
+ */
+__syscall int k_queue_get_batch(struct k_queue *queue, void **array,
+				int count, k_timeout_t timeout);
+
 /**
  * @brief Remove an element from a queue.
  *
@@ -2408,6 +2471,27 @@ struct k_fifo {
 #define k_fifo_get(fifo, timeout) \
 	k_queue_get(&(fifo)->_queue, timeout)
 
+/**
+ * @brief Get a batch of elements from a FIFO queue.
+ *
+ * This routine removes up to @a count data items from @a fifo in a
+ * "first in, first out" manner under a single lock hold, see
+ * k_queue_get_batch().
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param fifo Address of the FIFO queue.
+ * @param array Array of @a count data item pointers to fill in.
+ * @param count Maximum number of data items to remove.
+ * @param timeout Waiting period to obtain the first data item,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items placed in @a array; zero if returned
+ * without waiting, or waiting period timed out.
+ */
+#define k_fifo_get_batch(fifo, array, count, timeout) \
+	k_queue_get_batch(&(fifo)->_queue, array, count, timeout)
+
 /**
  * @brief Query a FIFO queue to see if it has data available.
  *
@@ -2558,6 +2642,27 @@ struct k_lifo {
 #define k_lifo_get(lifo, timeout) \
 	k_queue_get(&(lifo)->_queue, timeout)
 
+/**
+ * @brief Get a batch of elements from a LIFO queue.
+ *
+ * This routine removes up to @a count data items from @a lifo in a
+ * "last in, first out" manner under a single lock hold, see
+ * k_queue_get_batch().
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param lifo Address of the LIFO queue.
+ * @param array Array of @a count data item pointers to fill in.
+ * @param count Maximum number of data items to remove.
+ * @param timeout Waiting period to obtain the first data item,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items placed in @a array; zero if returned
+ * without waiting, or waiting period timed out.
+ */
+#define k_lifo_get_batch(lifo, array, count, timeout) \
+	k_queue_get_batch(&(lifo)->_queue, array, count, timeout)
+
 /**
  * @brief Statically define and initialize a LIFO queue.
  *
@@ -2742,13 +2847,45 @@ typedef void (*k_work_handler_t)(struct k_work *work);
  * @cond INTERNAL_HIDDEN
  */
 
+/* Defined here rather than with the rest of the semaphore code so
+ * that struct k_work_q can embed one.
+ */
+struct k_sem {
+	_wait_q_t wait_q;
+	uint32_t count;
+	uint32_t limit;
+	_POLL_EVENT;
+
+	_OBJECT_TRACING_NEXT_PTR(k_sem)
+	_OBJECT_TRACING_LINKED_FLAG
+};
+
+#define Z_SEM_INITIALIZER(obj, initial_count, count_limit) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.count = initial_count, \
+	.limit = count_limit, \
+	_POLL_EVENT_OBJ_INIT(obj) \
+	_OBJECT_TRACING_INIT \
+	}
+
 struct k_work_q {
 	struct k_queue queue;
 	struct k_thread thread;
+#ifdef CONFIG_WORK_Q_MPSC_SUBMIT
+	/* Lock-free submission list (newest item first) and the
+	 * semaphore the workqueue thread sleeps on when it is empty.
+	 */
+	atomic_ptr_t mpsc_head;
+	struct k_sem mpsc_sem;
+#endif
 };
 
 enum {
 	K_WORK_STATE_PENDING,	/* Work item pending state */
+#ifdef CONFIG_WORK_Q_MPSC_SUBMIT
+	K_WORK_STATE_MPSC_LINKED, /* Still on a lock-free submission list */
+#endif
 };
 
 struct k_work {
@@ -2836,11 +2973,20 @@ static inline void k_work_init(struct k_work *work, k_work_handler_t handler)
  *
  * @return N/A
  */
+#ifdef CONFIG_WORK_Q_MPSC_SUBMIT
+extern void z_work_submit_mpsc(struct k_work_q *work_q, struct k_work *work);
+extern void z_work_wake_mpsc(struct k_work_q *work_q);
+#endif
+
 static inline void k_work_submit_to_queue(struct k_work_q *work_q,
 					  struct k_work *work)
 {
 	if (!atomic_test_and_set_bit(work->flags, K_WORK_STATE_PENDING)) {
+#ifdef CONFIG_WORK_Q_MPSC_SUBMIT
+		z_work_submit_mpsc(work_q, work);
+#else
 		k_queue_append(&work_q->queue, work);
+#endif
 	}
 }
 
@@ -2878,6 +3024,14 @@ static inline int k_work_submit_to_user_queue(struct k_work_q *work_q,
 		if (ret != 0) {
 			atomic_clear_bit(work->flags, K_WORK_STATE_PENDING);
 		}
+#ifdef CONFIG_WORK_Q_MPSC_SUBMIT
+		else {
+			/* Wake a workqueue thread sleeping on the
+			 * lock-free submission path.
+			 */
+			z_work_wake_mpsc(work_q);
+		}
+#endif
 	}
 
 	return ret;
@@ -3281,6 +3435,98 @@ static inline int k_work_poll_submit(struct k_work_poll *work,
  */
 extern int k_work_poll_cancel(struct k_work_poll *work);
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+struct k_prio_work_q {
+	struct k_spinlock lock;
+	sys_dlist_t pending;
+	struct k_sem sem;
+	struct k_thread thread;
+};
+
+struct k_prio_work {
+	struct k_work work;
+	sys_dnode_t node;
+	int priority;
+};
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Start a priority-ordered workqueue.
+ *
+ * This works like k_work_q_start() except that the queue drains
+ * pending items in priority order rather than submission order: the
+ * item with the numerically lowest priority value (following the
+ * thread priority convention) runs first, with submission order
+ * breaking ties.  A long-running low-priority handler still delays
+ * urgent items that arrive while it runs; what this queue removes is
+ * the queueing delay behind earlier low-priority submissions.
+ *
+ * @param work_q Address of priority workqueue.
+ * @param stack Pointer to work queue thread's stack space.
+ * @param stack_size Size of the work queue thread's stack (in bytes).
+ * @param prio Priority of the work queue's thread.
+ *
+ * @return N/A
+ */
+extern void k_prio_work_q_start(struct k_prio_work_q *work_q,
+				k_thread_stack_t *stack,
+				size_t stack_size, int prio);
+
+/**
+ * @brief Initialize a priority work item.
+ *
+ * @param work Address of priority work item.
+ * @param handler Function to invoke each time work item is processed.
+ * @param priority Priority of the work item; lower values run first.
+ *
+ * @return N/A
+ */
+static inline void k_prio_work_init(struct k_prio_work *work,
+				    k_work_handler_t handler, int priority)
+{
+	k_work_init(&work->work, handler);
+	sys_dnode_init(&work->node);
+	work->priority = priority;
+}
+
+/**
+ * @brief Submit a priority work item.
+ *
+ * If the work item is already pending in a priority workqueue, this
+ * routine has no effect (the item keeps the priority it was first
+ * submitted with).
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param work_q Address of priority workqueue.
+ * @param work Address of priority work item.
+ *
+ * @return N/A
+ */
+extern void k_prio_work_submit_to_queue(struct k_prio_work_q *work_q,
+					struct k_prio_work *work);
+
+/**
+ * @brief Cancel a pending priority work item.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param work_q Address of priority workqueue.
+ * @param work Address of priority work item.
+ *
+ * @retval 0 Work item was cancelled before it ran.
+ * @retval -EINVAL Work item was not pending (never submitted, already
+ *	   run, or currently running).
+ */
+extern int k_prio_work_cancel(struct k_prio_work_q *work_q,
+			      struct k_prio_work *work);
+
 /** @} */
 /**
  * @defgroup mutex_apis Mutex APIs
@@ -3405,24 +3651,9 @@ __syscall int k_mutex_unlock(struct k_mutex *mutex);
  * @cond INTERNAL_HIDDEN
  */
 
-struct k_sem {
-	_wait_q_t wait_q;
-	uint32_t count;
-	uint32_t limit;
-	_POLL_EVENT;
-
-	_OBJECT_TRACING_NEXT_PTR(k_sem)
-	_OBJECT_TRACING_LINKED_FLAG
-};
-
-#define Z_SEM_INITIALIZER(obj, initial_count, count_limit) \
-	{ \
-	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
-	.count = initial_count, \
-	.limit = count_limit, \
-	_POLL_EVENT_OBJ_INIT(obj) \
-	_OBJECT_TRACING_INIT \
-	}
+/* struct k_sem itself is defined above the workqueue code, which
+ * embeds one in struct k_work_q.
+ */
 
 /**
  * INTERNAL_HIDDEN @endcond
@@ -3481,6 +3712,25 @@ __syscall int k_sem_take(struct k_sem *sem, k_timeout_t timeout);
  */
 __syscall void k_sem_give(struct k_sem *sem);
 
+/**
+ * @brief Give a semaphore multiple times.
+ *
+ * This routine performs the equivalent of @a count k_sem_give() operations
+ * as a single operation: up to @a count waiting threads are woken (with a
+ * single reschedule point), and any remainder is credited to the semaphore
+ * count, subject to its maximum permitted count. Giving a batch of items
+ * to consumers this way is cheaper than giving the semaphore repeatedly,
+ * particularly from user mode where each give is a system call.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param sem Address of the semaphore.
+ * @param count Number of times to give the semaphore.
+ *
+ * @return N/A
+ */
+__syscall void k_sem_give_count(struct k_sem *sem, unsigned int count);
+
 /**
  * @brief Reset a semaphore's count to zero.
  *
@@ -3538,6 +3788,105 @@ static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 
 /** @} */
 
+/**
+ * @defgroup thread_pool_apis Thread Pool APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Thread pool slot
+ *
+ * Pairs a thread object with its stack so both can be recycled together.
+ * All fields are managed by the thread pool implementation.
+ */
+struct k_thread_pool_slot {
+	sys_snode_t node;
+	struct k_thread thread;
+	k_thread_stack_t *stack;
+	struct k_thread_pool *pool;
+	bool warm;
+};
+
+/**
+ * @brief Thread pool structure
+ *
+ * Caches dead threads' stacks and kernel objects for reuse, so that
+ * respawning a worker skips stack repainting and object setup. Use
+ * K_THREAD_POOL_DEFINE() to create one.
+ */
+struct k_thread_pool {
+	struct k_spinlock lock;
+	sys_slist_t free;
+	struct k_sem sem;
+	struct k_thread_pool_slot *slots;
+	k_thread_stack_t *stacks;
+	size_t stack_stride;
+	size_t stack_size;
+	uint32_t num_slots;
+	bool initialized;
+};
+
+/**
+ * @brief Spawn a thread from a thread pool.
+ *
+ * This routine starts a worker thread on an idle pool slot, reusing the
+ * slot's thread object and stack from earlier workers where possible.
+ * The worker starts immediately and its slot is returned to the pool
+ * automatically when it exits, whether by returning from @a entry or by
+ * being aborted.
+ *
+ * Pool workers always run in supervisor mode; the @c K_USER option must
+ * not be set.
+ *
+ * @param pool Address of the thread pool.
+ * @param entry Thread entry function.
+ * @param p1 1st entry point parameter.
+ * @param p2 2nd entry point parameter.
+ * @param p3 3rd entry point parameter.
+ * @param prio Thread priority.
+ * @param options Thread options.
+ * @param timeout Maximum time to wait for an idle slot, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return ID of the new thread, or NULL if no slot became available
+ *         within the waiting period.
+ */
+extern k_tid_t k_thread_pool_spawn(struct k_thread_pool *pool,
+				   k_thread_entry_t entry,
+				   void *p1, void *p2, void *p3,
+				   int prio, uint32_t options,
+				   k_timeout_t timeout);
+
+/**
+ * @brief Statically define and initialize a thread pool.
+ *
+ * The thread pool can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct k_thread_pool <name>; @endcode
+ *
+ * @param name Name of the thread pool.
+ * @param pool_num_slots Number of worker slots in the pool.
+ * @param pool_stack_size Usable stack size of each worker, in bytes.
+ */
+#define K_THREAD_POOL_DEFINE(name, pool_num_slots, pool_stack_size) \
+	static K_KERNEL_STACK_ARRAY_DEFINE(_k_pool_stacks_##name, \
+					   pool_num_slots, pool_stack_size); \
+	static struct k_thread_pool_slot _k_pool_slots_##name[pool_num_slots]; \
+	struct k_thread_pool name = { \
+		.free = SYS_SLIST_STATIC_INIT(&name.free), \
+		.sem = Z_SEM_INITIALIZER(name.sem, pool_num_slots, \
+					 pool_num_slots), \
+		.slots = _k_pool_slots_##name, \
+		.stacks = _k_pool_stacks_##name[0], \
+		.stack_stride = sizeof(_k_pool_stacks_##name[0]), \
+		.stack_size = pool_stack_size, \
+		.num_slots = pool_num_slots, \
+	}
+
+/** @} */
+
 /**
  * @defgroup msgq_apis Message Queue APIs
  * @ingroup kernel_apis
@@ -3751,6 +4100,101 @@ __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
  */
 __syscall int k_msgq_peek(struct k_msgq *msgq, void *data);
 
+/**
+ * @brief Reserve the next message slot of a message queue.
+ *
+ * This routine hands out a pointer to the next free slot of the ring
+ * buffer of message queue @a msgq, so a message can be built in place
+ * without an intermediate copy.  The message is not visible to
+ * receivers until it is published with k_msgq_commit().
+ *
+ * Zero-copy senders must be the only senders on the queue: mixing
+ * k_msgq_reserve() with k_msgq_put(), or reserving a second slot
+ * before committing the first, yields unpredictable message content.
+ * Receivers may use either k_msgq_get() or the zero-copy receive
+ * calls.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ * @note Can not be called from user mode.
+ *
+ * @param msgq Address of the message queue.
+ * @param msg Address of area to hold the slot pointer.
+ * @param timeout Non-negative waiting period for a slot to become
+ *                free, or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Slot reserved; the area pointed at by @a msg holds a
+ *	   pointer to msg_size writable bytes.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+extern int k_msgq_reserve(struct k_msgq *msgq, void **msg,
+			  k_timeout_t timeout);
+
+/**
+ * @brief Publish a message built in a reserved slot.
+ *
+ * This routine makes the message built in the slot obtained from
+ * k_msgq_reserve() available to receivers.  @a msg must be the
+ * pointer returned by the matching reserve call.
+ *
+ * @note Can be called by ISRs.
+ * @note Can not be called from user mode.
+ *
+ * @param msgq Address of the message queue.
+ * @param msg Slot pointer returned by k_msgq_reserve().
+ *
+ * @return N/A
+ */
+extern void k_msgq_commit(struct k_msgq *msgq, void *msg);
+
+/**
+ * @brief Claim the oldest message of a message queue in place.
+ *
+ * This routine hands out a pointer to the oldest message in the ring
+ * buffer of message queue @a msgq, so it can be consumed without an
+ * intermediate copy.  The slot is not recycled until the message is
+ * returned with k_msgq_release(); until then the claiming context
+ * owns the message bytes.
+ *
+ * Zero-copy receivers must be the only receivers on the queue:
+ * mixing k_msgq_peek_claim() with k_msgq_get() or claiming a second
+ * message before releasing the first yields unpredictable results.
+ * Senders may use either k_msgq_put() or the zero-copy send calls.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ * @note Can not be called from user mode.
+ *
+ * @param msgq Address of the message queue.
+ * @param msg Address of area to hold the message pointer.
+ * @param timeout Waiting period for a message to arrive, or one of
+ *                the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed; the area pointed at by @a msg holds a
+ *	   pointer to the message.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+extern int k_msgq_peek_claim(struct k_msgq *msgq, void **msg,
+			     k_timeout_t timeout);
+
+/**
+ * @brief Release a claimed message slot back to a message queue.
+ *
+ * This routine removes the message claimed with k_msgq_peek_claim()
+ * from message queue @a msgq and recycles its slot.  @a msg must be
+ * the pointer returned by the matching claim call.
+ *
+ * @note Can be called by ISRs.
+ * @note Can not be called from user mode.
+ *
+ * @param msgq Address of the message queue.
+ * @param msg Message pointer returned by k_msgq_peek_claim().
+ *
+ * @return N/A
+ */
+extern void k_msgq_release(struct k_msgq *msgq, void *msg);
+
 /**
  * @brief Purge a message queue.
  *
@@ -3819,6 +4263,32 @@ static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
  * @{
  */
 
+/**
+ * @typedef k_mbox_async_cb_t
+ * @brief Mailbox asynchronous send completion callback.
+ *
+ * Invoked once the message has been both received and completely processed
+ * by the receiver. The callback runs in the context of the receiving thread,
+ * so it must not block.
+ *
+ * @param user_data Argument registered when the message was sent.
+ */
+typedef void (*k_mbox_async_cb_t)(void *user_data);
+
+/**
+ * @brief Mailbox scatter-gather region descriptor.
+ *
+ * Describes one of the non-contiguous data regions making up a message
+ * sent with @c tx_sg. Regions are gathered into the receiver's buffer
+ * in array order.
+ */
+struct k_mbox_sg_region {
+	/** region data */
+	const void *data;
+	/** region length (in bytes) */
+	size_t len;
+};
+
 /**
  * @brief Mailbox Message Structure
  *
@@ -3836,6 +4306,13 @@ struct k_mbox_msg {
 	void *_rx_data;
 	/** message data block descriptor */
 	struct k_mem_block tx_block;
+	/** sender's scatter-gather region array, or NULL; only examined
+	 * when neither tx_data nor tx_block supply the message data and
+	 * size is non-zero
+	 */
+	const struct k_mbox_sg_region *tx_sg;
+	/** number of entries in tx_sg */
+	uint32_t tx_sg_count;
 	/** source thread id */
 	k_tid_t rx_source_thread;
 	/** target thread id */
@@ -3845,8 +4322,27 @@ struct k_mbox_msg {
 #if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
 	/** internal use only - semaphore used during asynchronous send */
 	struct k_sem *_async_sem;
+	/** internal use only - callback invoked when asynchronous send
+	 * completes
+	 */
+	k_mbox_async_cb_t _async_cb;
+	/** internal use only - callback argument */
+	void *_async_cb_data;
 #endif
 };
+
+/**
+ * @brief Mailbox asynchronous message descriptor.
+ *
+ * Applications only define arrays of these (to size the storage passed to
+ * k_mbox_async_pool_init()); the contents are managed by the kernel.
+ */
+struct k_mbox_async {
+	struct _thread_base thread;	/* dummy thread object */
+	struct k_mbox_msg tx_msg;	/* transmit message descriptor */
+	struct k_stack *pool;		/* descriptor pool to free to */
+};
+
 /**
  * @brief Mailbox Structure
  *
@@ -3857,6 +4353,10 @@ struct k_mbox {
 	/** Receive message queue */
 	_wait_q_t rx_msg_queue;
 	struct k_spinlock lock;
+#if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
+	/** Private asynchronous message descriptor pool (optional) */
+	struct k_stack *async_pool;
+#endif
 
 	_OBJECT_TRACING_NEXT_PTR(k_mbox)
 	_OBJECT_TRACING_LINKED_FLAG
@@ -3940,6 +4440,47 @@ extern int k_mbox_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
 extern void k_mbox_async_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
 			     struct k_sem *sem);
 
+/**
+ * @brief Send a mailbox message asynchronously, with completion callback.
+ *
+ * This routine is identical to k_mbox_async_put(), except that completion
+ * is signalled by invoking @a cb (from the context of the receiving thread)
+ * instead of giving a semaphore.
+ *
+ * @param mbox Address of the mailbox.
+ * @param tx_msg Address of the transmit message descriptor.
+ * @param cb Completion callback, or NULL if none is needed.
+ * @param user_data Argument passed to @a cb.
+ *
+ * @return N/A
+ */
+extern void k_mbox_async_put_cb(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
+				k_mbox_async_cb_t cb, void *user_data);
+
+/**
+ * @brief Assign a private asynchronous message descriptor pool to a mailbox.
+ *
+ * By default all mailboxes share the CONFIG_NUM_MBOX_ASYNC_MSGS descriptors
+ * used by asynchronous sends, so a burst of sends on one mailbox can leave
+ * senders on unrelated mailboxes waiting for a free descriptor. This routine
+ * gives @a mbox its own pool of @a num_msgs descriptors, drawn from (and
+ * returned to) @a pool instead of the shared pool.
+ *
+ * The caller provides the descriptor storage and a stack defined with
+ * K_STACK_DEFINE(name, num_msgs); both must remain valid for the lifetime
+ * of the mailbox.
+ *
+ * @param mbox Address of the mailbox.
+ * @param pool Address of the stack that governs access to the descriptors.
+ * @param msgs Array of asynchronous message descriptors.
+ * @param num_msgs Number of entries in @a msgs.
+ *
+ * @return N/A
+ */
+extern void k_mbox_async_pool_init(struct k_mbox *mbox, struct k_stack *pool,
+				   struct k_mbox_async *msgs,
+				   uint32_t num_msgs);
+
 /**
  * @brief Receive a mailbox message.
  *
@@ -4210,6 +4751,98 @@ __syscall size_t k_pipe_read_avail(struct k_pipe *pipe);
  */
 __syscall size_t k_pipe_write_avail(struct k_pipe *pipe);
 
+/**
+ * @brief Claim a contiguous region of @a pipe's buffer for writing.
+ *
+ * This routine hands out a pointer to the free space at the pipe's
+ * write index, so data can be produced directly into the pipe buffer
+ * (e.g. by a DMA engine) without an intermediate copy.  The region
+ * stays invisible to readers until it is committed with
+ * k_pipe_write_finish().  The claimable region is limited by both the
+ * free space and the end of the circular buffer; claim again after
+ * finishing to continue past the wrap point.
+ *
+ * Like the ring_buf claim calls this assumes a single producer:
+ * concurrent writers (including k_pipe_put()) would hand out the same
+ * region.  Readers of any kind may run concurrently.
+ *
+ * @note Can be called by ISRs.
+ * @note Can not be called from user mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the claimed region pointer.
+ * @param size Number of bytes to claim.
+ *
+ * @return Number of writable bytes in the claimed region, which may
+ *	   be less than @a size or zero; zero for unbuffered pipes.
+ */
+extern size_t k_pipe_write_claim(struct k_pipe *pipe, void **data,
+				 size_t size);
+
+/**
+ * @brief Commit bytes written to a claimed pipe buffer region.
+ *
+ * This routine makes @a size bytes written to the region claimed with
+ * k_pipe_write_claim() available to readers, waking any blocked
+ * readers the new data satisfies.
+ *
+ * @note Can be called by ISRs.
+ * @note Can not be called from user mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written, up to the claimed size.
+ *
+ * @retval 0 Data committed.
+ * @retval -EINVAL @a size exceeds the claimable region.
+ */
+extern int k_pipe_write_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim a contiguous region of @a pipe's buffer for reading.
+ *
+ * This routine hands out a pointer to the oldest data in the pipe
+ * buffer, so it can be consumed in place (e.g. fed to a DMA engine)
+ * without an intermediate copy.  The data is not removed from the
+ * pipe until it is returned with k_pipe_read_finish().  The claimable
+ * region is limited by both the available data and the end of the
+ * circular buffer; claim again after finishing to continue past the
+ * wrap point.
+ *
+ * Like the ring_buf claim calls this assumes a single consumer:
+ * concurrent readers (including k_pipe_get()) would consume the same
+ * region.  Writers of any kind may run concurrently.
+ *
+ * @note Can be called by ISRs.
+ * @note Can not be called from user mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the claimed region pointer.
+ * @param size Number of bytes to claim.
+ *
+ * @return Number of readable bytes in the claimed region, which may
+ *	   be less than @a size or zero; zero for unbuffered pipes.
+ */
+extern size_t k_pipe_read_claim(struct k_pipe *pipe, void **data,
+				size_t size);
+
+/**
+ * @brief Return consumed bytes of a claimed pipe buffer region.
+ *
+ * This routine removes @a size bytes of the region claimed with
+ * k_pipe_read_claim() from the pipe, recycling the space and waking
+ * any blocked writers that can now make progress.
+ *
+ * @note Can be called by ISRs.
+ * @note Can not be called from user mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed, up to the claimed size.
+ *
+ * @retval 0 Space recycled.
+ * @retval -EINVAL @a size exceeds the claimable region.
+ */
+extern int k_pipe_read_finish(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
@@ -4221,13 +4854,34 @@ struct k_mem_slab {
 	uint32_t num_blocks;
 	size_t block_size;
 	char *buffer;
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	/* Free list head: block index plus ABA counter, CAS-managed */
+	atomic_t free_head;
+	atomic_t num_waiters;
+	atomic_t num_used;
+#else
 	char *free_list;
 	uint32_t num_used;
+#endif
 
 	_OBJECT_TRACING_NEXT_PTR(k_mem_slab)
 	_OBJECT_TRACING_LINKED_FLAG
 };
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+#define Z_MEM_SLAB_INITIALIZER(obj, slab_buffer, slab_block_size, \
+			       slab_num_blocks) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.num_blocks = slab_num_blocks, \
+	.block_size = slab_block_size, \
+	.buffer = slab_buffer, \
+	.free_head = ATOMIC_INIT(0), \
+	.num_waiters = ATOMIC_INIT(0), \
+	.num_used = ATOMIC_INIT(0), \
+	_OBJECT_TRACING_INIT \
+	}
+#else
 #define Z_MEM_SLAB_INITIALIZER(obj, slab_buffer, slab_block_size, \
 			       slab_num_blocks) \
 	{ \
@@ -4239,6 +4893,7 @@ struct k_mem_slab {
 	.num_used = 0, \
 	_OBJECT_TRACING_INIT \
 	}
+#endif
 
 
 /**
@@ -4883,6 +5538,89 @@ __syscall void k_poll_signal_check(struct k_poll_signal *signal,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *signal, int result);
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+struct k_poll_eq {
+	struct _poller poller;	/* shared by all registered events */
+	sys_dlist_t ready;	/* events whose condition has fired */
+	_wait_q_t wait_q;	/* thread waiting in k_poll_eq_wait() */
+};
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Initialize an event queue.
+ *
+ * An event queue is a persistent interest list for poll events, in
+ * the style of epoll: events are registered once with
+ * k_poll_eq_add(), and each k_poll_eq_wait() call only touches the
+ * events that are actually ready, rather than re-registering and
+ * re-scanning the whole set the way k_poll() does.  The cost of a
+ * wakeup is thus proportional to the number of ready events, not the
+ * number of registered ones.
+ *
+ * @param eq The event queue to initialize.
+ *
+ * @return N/A
+ */
+extern void k_poll_eq_init(struct k_poll_eq *eq);
+
+/**
+ * @brief Register a poll event with an event queue.
+ *
+ * The registration is persistent: the event remains watched across
+ * k_poll_eq_wait() calls until it is removed with k_poll_eq_remove().
+ * The event must have been initialized with k_poll_event_init() and
+ * must not be concurrently used with k_poll().
+ *
+ * @param eq The event queue.
+ * @param event The event to watch.
+ *
+ * @retval 0 Event registered.
+ * @retval -EADDRINUSE Event is already registered somewhere.
+ */
+extern int k_poll_eq_add(struct k_poll_eq *eq, struct k_poll_event *event);
+
+/**
+ * @brief Remove a poll event from an event queue.
+ *
+ * @param eq The event queue.
+ * @param event The event to stop watching.
+ *
+ * @return N/A
+ */
+extern void k_poll_eq_remove(struct k_poll_eq *eq,
+			     struct k_poll_event *event);
+
+/**
+ * @brief Wait for registered events to become ready.
+ *
+ * Fills @a events with pointers to up to @a num_events registered
+ * events whose conditions are met, waiting up to @a timeout for at
+ * least one.  Readiness is level-triggered: an event whose condition
+ * is still met when k_poll_eq_wait() is called again is returned
+ * again, and each returned event's state field holds the
+ * K_POLL_STATE_xxx value that fired.
+ *
+ * Only one thread may wait on a given event queue at a time.
+ *
+ * @param eq The event queue.
+ * @param events Output array of ready event pointers.
+ * @param num_events Capacity of @a events.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval n The number of ready events stored, when positive.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+extern int k_poll_eq_wait(struct k_poll_eq *eq,
+			  struct k_poll_event **events, int num_events,
+			  k_timeout_t timeout);
+
 /**
  * @internal
  */
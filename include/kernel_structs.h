@@ -128,6 +128,13 @@ struct _cpu {
 	/* True when _current is allowed to context switch */
 	uint8_t swap_ok;
 #endif
+
+#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+	/* With pinned threads, each CPU owns its own run queue and
+	 * never looks at the global one.
+	 */
+	struct _ready_q ready_q;
+#endif
 };
 
 typedef struct _cpu _cpu_t;
@@ -144,6 +151,11 @@ struct z_kernel {
 	int32_t idle; /* Number of ticks for kernel idling */
 #endif
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	/* A scheduling IPI is needed at the next scheduling point */
+	bool pending_ipi;
+#endif
+
 	/*
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
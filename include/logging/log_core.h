@@ -260,12 +260,19 @@ static inline char z_log_minimal_level_to_char(int level)
 #define __LOG(_level, _id, _filter, ...)				       \
 	do {								       \
 		if (Z_LOG_CONST_LEVEL_CHECK(_level)) {			       \
-			bool is_user_context = _is_user_context();	       \
-									       \
 			if (IS_ENABLED(CONFIG_LOG_MINIMAL)) {		       \
 				Z_LOG_TO_PRINTK(_level, __VA_ARGS__);	       \
-			} else if (LOG_CHECK_CTX_LVL_FILTER(is_user_context, \
-					_level, _filter)) {  \
+			} else {					       \
+				/* Check the runtime filter before the	       \
+				 * timestamp is taken or any argument is       \
+				 * marshalled.				       \
+				 */					       \
+				bool is_user_context = _is_user_context();     \
+									       \
+				if (!LOG_CHECK_CTX_LVL_FILTER(is_user_context, \
+						_level, _filter)) {	       \
+					break;				       \
+				}					       \
 				struct log_msg_ids src_level = {	       \
 					.level = _level,		       \
 					.domain_id = CONFIG_LOG_DOMAIN_ID,     \
@@ -282,7 +289,6 @@ static inline char z_log_minimal_level_to_char(int level)
 						       src_level,	       \
 						       __VA_ARGS__);	       \
 				}					       \
-			} else {						       \
 			}					       \
 		}							       \
 		if (false) {						       \
@@ -314,15 +320,21 @@ static inline char z_log_minimal_level_to_char(int level)
 #define __LOG_HEXDUMP(_level, _id, _filter, _data, _length, _str)	       \
 	do {								       \
 		if (Z_LOG_CONST_LEVEL_CHECK(_level)) {			       \
-			bool is_user_context = _is_user_context();	       \
-									       \
 			if (IS_ENABLED(CONFIG_LOG_MINIMAL)) {		       \
 				Z_LOG_TO_PRINTK(_level, "%s", _str);	       \
 				log_minimal_hexdump_print(_level,	       \
 							  (const char *)_data, \
 							  _length);	       \
-			} else if (LOG_CHECK_CTX_LVL_FILTER(is_user_context,\
-					_level, _filter)) {  \
+			} else {					       \
+				/* Check the runtime filter before the	       \
+				 * timestamp is taken or any data is copied.   \
+				 */					       \
+				bool is_user_context = _is_user_context();     \
+									       \
+				if (!LOG_CHECK_CTX_LVL_FILTER(is_user_context, \
+						_level, _filter)) {	       \
+					break;				       \
+				}					       \
 				struct log_msg_ids src_level = {	       \
 					.level = _level,		       \
 					.domain_id = CONFIG_LOG_DOMAIN_ID,     \
@@ -342,7 +354,6 @@ static inline char z_log_minimal_level_to_char(int level)
 						    _length,		       \
 						    src_level);		       \
 				}					       \
-			} else {				       \
 			}						       \
 		}							       \
 	} while (false)
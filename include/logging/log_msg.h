@@ -163,6 +163,13 @@ union log_msg_chunk {
 /** @brief Function for initialization of the log message pool. */
 void log_msg_pool_init(void);
 
+/** @brief Function for getting the number of allocated chunks in the log
+ *         message pool.
+ *
+ *  @return Number of chunks currently in use.
+ */
+uint32_t log_msg_mem_used_get(void);
+
 /** @brief Function for indicating that message is in use.
  *
  *  @details Message can be used (read) by multiple users. Internal reference
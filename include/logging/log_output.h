@@ -50,6 +50,11 @@ extern "C" {
  */
 #define LOG_OUTPUT_FLAG_FORMAT_SYST		BIT(7)
 
+/** @brief Flag forcing dictionary format, binary records decoded on the
+ *         host with the ELF file of the build.
+ */
+#define LOG_OUTPUT_FLAG_FORMAT_DICTIONARY	BIT(8)
+
 /**
  * @brief Prototype of the function processing output data.
  *
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_LOGGING_LOG_OUTPUT_DICT_H_
+#define ZEPHYR_INCLUDE_LOGGING_LOG_OUTPUT_DICT_H_
+
+#include <logging/log_output.h>
+#include <zephyr/types.h>
+#include <toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Dictionary based logging output
+ * @defgroup log_output_dict Dictionary based logging output
+ * @ingroup log_output
+ * @{
+ */
+
+/** @brief Types of dictionary log records. */
+enum log_dict_output_msg_type {
+	LOG_DICT_TYPE_STD = 1,
+	LOG_DICT_TYPE_HEXDUMP = 2,
+	LOG_DICT_TYPE_RAW_STR = 3,
+	LOG_DICT_TYPE_DROPPED = 4,
+};
+
+/** @brief Common header of a dictionary log record.
+ *
+ * A record is the header followed by a payload selected by the type:
+ *
+ * - @ref LOG_DICT_TYPE_STD: number of arguments (1 byte) and the raw
+ *   arguments (one word each), followed by any transient string
+ *   arguments, each as argument index (1 byte), length (2 bytes) and
+ *   the characters. The transient string list is terminated by the
+ *   index 0xff.
+ * - @ref LOG_DICT_TYPE_HEXDUMP and @ref LOG_DICT_TYPE_RAW_STR: data
+ *   length (2 bytes) followed by the bytes.
+ * - @ref LOG_DICT_TYPE_DROPPED: number of dropped messages (4 bytes).
+ *
+ * The fmt field holds the address of the format string within the
+ * image; the host side decoder recovers the characters from the ELF
+ * file of the build, which also determines the word size.
+ */
+struct log_dict_output_msg_hdr {
+	uint8_t type;
+	uint8_t level;
+	uint8_t domain_id;
+	uint16_t source_id;
+	uint32_t timestamp;
+	uintptr_t fmt;
+} __packed;
+
+/** @brief Process log message to a binary dictionary record.
+ *
+ * @param output Log output instance.
+ * @param msg Log message.
+ * @param flags Formatting flags, unused in this format.
+ */
+void log_output_msg_dict_process(const struct log_output *output,
+				 struct log_msg *msg, uint32_t flags);
+
+/** @brief Process dropped messages indication to a binary record.
+ *
+ * @param output Log output instance.
+ * @param cnt Number of dropped messages.
+ */
+void log_output_dict_dropped_process(const struct log_output *output,
+				     uint32_t cnt);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_LOGGING_LOG_OUTPUT_DICT_H_ */
@@ -835,6 +835,14 @@ struct net_buf_pool {
 
 	/** Start of buffer storage array */
 	struct net_buf * const __bufs;
+
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+	/** Per-CPU front-end cache of free buffers */
+	atomic_ptr_t cache[CONFIG_MP_NUM_CPUS][CONFIG_NET_BUF_CPU_CACHE_SIZE];
+
+	/** Number of allocators blocked on the free LIFO */
+	atomic_t blocked;
+#endif
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -1023,6 +1031,15 @@ extern const struct net_buf_data_cb net_buf_var_cb;
  */
 struct net_buf_pool *net_buf_pool_get(int id);
 
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+/** @cond INTERNAL_HIDDEN */
+/** Return a free buffer through the per-CPU cache; used by
+ *  net_buf_destroy(), not meant to be called directly.
+ */
+void net_buf_cache_put(struct net_buf_pool *pool, struct net_buf *buf);
+/** @endcond */
+#endif
+
 /**
  * @brief Get a zero-based index for a buffer.
  *
@@ -1160,7 +1177,11 @@ static inline void net_buf_destroy(struct net_buf *buf)
 {
 	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
 
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+	net_buf_cache_put(pool, buf);
+#else
 	k_lifo_put(&pool->free, buf);
+#endif
 }
 
 /**
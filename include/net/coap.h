@@ -237,6 +237,7 @@ typedef int (*coap_reply_t)(const struct coap_packet *response,
  * @brief Represents a request awaiting for an acknowledgment (ACK).
  */
 struct coap_pending {
+	sys_snode_t list;
 	struct sockaddr addr;
 	uint32_t t0;
 	uint32_t timeout;
@@ -351,6 +352,31 @@ int coap_packet_init(struct coap_packet *cpkt, uint8_t *data, uint16_t max_len,
 		     uint8_t ver, uint8_t type, uint8_t token_len,
 		     uint8_t *token, uint8_t code, uint16_t id);
 
+/**
+ * @brief Creates a new CoAP Packet from a serialized template, replacing
+ * only the per-recipient header fields.
+ *
+ * The options and payload of @a src are copied verbatim, so an observe
+ * notification can be serialized once and then cloned cheaply for each
+ * observer, with only the message type, token and message id differing
+ * per clone.
+ *
+ * @param cpkt New packet to be initialized using the storage from @a data.
+ * @param data Data that will contain a CoAP packet information
+ * @param max_len Maximum allowable length of data
+ * @param src Serialized packet used as the template
+ * @param type CoAP header type of the clone
+ * @param token_len CoAP header token length of the clone
+ * @param token CoAP header token of the clone
+ * @param id CoAP header message id of the clone
+ *
+ * @return 0 in case of success or negative in case of error.
+ */
+int coap_packet_clone(struct coap_packet *cpkt, uint8_t *data,
+		      uint16_t max_len, const struct coap_packet *src,
+		      uint8_t type, uint8_t token_len, uint8_t *token,
+		      uint16_t id);
+
 /**
  * @brief Returns a randomly generated array of 8 bytes, that can be
  * used as a message's token.
@@ -794,6 +820,43 @@ void coap_pending_clear(struct coap_pending *pending);
  */
 void coap_pendings_clear(struct coap_pending *pendings, size_t len);
 
+/**
+ * @brief Adds a pending request to a retransmit queue kept sorted by
+ * expiry time.
+ *
+ * With a queue the next request to expire is found in constant time
+ * with coap_pending_queue_next_to_expire(), instead of scanning the
+ * whole pending array for every timer tick.
+ *
+ * The queued entry must be removed with coap_pending_queue_remove()
+ * before anything that changes its expiry, i.e. coap_pending_cycle()
+ * or coap_pending_clear(), and added again afterwards.
+ *
+ * @param queue Queue of pending requests, sorted by expiry
+ * @param pending Pending representation to add
+ */
+void coap_pending_queue_add(sys_slist_t *queue, struct coap_pending *pending);
+
+/**
+ * @brief Removes a pending request from a retransmit queue.
+ *
+ * @param queue Queue of pending requests, sorted by expiry
+ * @param pending Pending representation to remove
+ *
+ * @return true if the entry was found and removed.
+ */
+bool coap_pending_queue_remove(sys_slist_t *queue,
+			       struct coap_pending *pending);
+
+/**
+ * @brief Returns the queued pending closest to expiry.
+ *
+ * @param queue Queue of pending requests, sorted by expiry
+ *
+ * @return The next #coap_pending to expire, NULL if the queue is empty.
+ */
+struct coap_pending *coap_pending_queue_next_to_expire(sys_slist_t *queue);
+
 /**
  * @brief Cancels awaiting for this reply, so it becomes available
  * again. User responsibility to free the memory associated with data.
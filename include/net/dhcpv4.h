@@ -35,6 +35,7 @@ extern "C" {
 enum net_dhcpv4_state {
 	NET_DHCPV4_DISABLED,
 	NET_DHCPV4_INIT,
+	NET_DHCPV4_INIT_REBOOT,
 	NET_DHCPV4_SELECTING,
 	NET_DHCPV4_REQUESTING,
 	NET_DHCPV4_RENEWING,
@@ -285,6 +285,29 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+/**
+ * @brief Do multiple HTTP requests over one connection. All the requests
+ * are sent back to back before any response is read, so the server can
+ * already process the next request while the previous response is in
+ * flight. The responses are then read and parsed in request order, with
+ * each request's callbacks called just like in http_client_req().
+ * The caller must have created a connection to the server before calling
+ * this function, and the server must support HTTP/1.1 persistent
+ * connections with pipelining.
+ *
+ * @param sock Socket id of the connection.
+ * @param reqs Array of pointers to HTTP request information.
+ * @param num_reqs Number of requests in the array.
+ * @param timeout Max timeout to wait for the data of one response. The
+ *        timeout value cannot be 0 as there would be no time to receive
+ *        the data. The timeout value is in milliseconds.
+ * @param user_data User specified data that is passed to the callbacks.
+ *
+ * @return <0 if error, >=0 total amount of data sent to the server
+ */
+int http_client_pipeline(int sock, struct http_request **reqs, size_t num_reqs,
+			 int32_t timeout, void *user_data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -589,6 +589,26 @@ int mqtt_connect(struct mqtt_client *client);
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to publish a batch of messages with a single transport write.
+ *
+ * Encodes up to @option{CONFIG_MQTT_PUBLISH_BATCH_MAX} publish messages
+ * into the transmit buffer and hands them to the transport as one vectored
+ * write, so that small messages published together share a single TCP
+ * segment instead of each paying the full per-send cost.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] param Array of publish message parameters, one entry per
+ *                  message. Shall not be NULL.
+ * @param[in] count Number of entries in the param array.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_publish_multiple(struct mqtt_client *client,
+			  const struct mqtt_publish_param *param,
+			  size_t count);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
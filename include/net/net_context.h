@@ -286,6 +286,28 @@ __net_socket struct net_context {
 	int can_filter_id;
 #endif /* CONFIG_NET_SOCKETS_CAN */
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_CACHE)
+	/** Cached IP + UDP header template for the connected peer.
+	 * Built from the headers of the first datagram sent after
+	 * connecting; len is zero while the template is stale.
+	 */
+	struct {
+#if defined(CONFIG_NET_IPV6)
+		uint8_t data[NET_IPV6UDPH_LEN];
+#else
+		uint8_t data[NET_IPV4UDPH_LEN];
+#endif
+		uint8_t len;
+	} udp_hdr_cache;
+#endif /* CONFIG_NET_CONTEXT_UDP_HDR_CACHE */
+
+#if defined(CONFIG_NET_CONTEXT_RCVBUF)
+	/** Bytes currently queued on the receive queue, counted against
+	 * the receive buffer limit.
+	 */
+	atomic_t recv_q_bytes;
+#endif /* CONFIG_NET_CONTEXT_RCVBUF */
+
 	/** Option values */
 	struct {
 #if defined(CONFIG_NET_CONTEXT_PRIORITY)
@@ -298,6 +320,10 @@ __net_socket struct net_context {
 #if defined(CONFIG_NET_CONTEXT_TXTIME)
 		bool txtime;
 #endif
+#if defined(CONFIG_NET_CONTEXT_RCVBUF)
+		/** Receive buffer limit in bytes, zero means unlimited */
+		int rcvbuf;
+#endif
 #if defined(CONFIG_SOCKS)
 		struct {
 			struct sockaddr addr;
@@ -637,6 +663,97 @@ static inline void net_context_set_iface(struct net_context *context,
 	context->iface = net_if_get_by_iface(iface);
 }
 
+/**
+ * @brief Invalidate the cached UDP header template of a context.
+ *
+ * @details The template caches header fields, so it must be dropped
+ * whenever something it was built from (remote address, TTL/hop limit)
+ * changes. No-op when the cache support is not enabled.
+ *
+ * @param context Network context.
+ */
+static inline void net_context_udp_hdr_cache_invalidate(
+	struct net_context *context)
+{
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_CACHE)
+	context->udp_hdr_cache.len = 0U;
+#else
+	ARG_UNUSED(context);
+#endif
+}
+
+/**
+ * @brief Charge received bytes against the receive buffer limit.
+ *
+ * @details Called at demux time before data is queued on the context.
+ * If the bytes already queued plus @p bytes would exceed the receive
+ * buffer limit, nothing is charged and false is returned so that the
+ * caller can drop the packet early. Always succeeds when no limit is
+ * set or when the support is not enabled.
+ *
+ * @param context Network context.
+ * @param bytes Number of payload bytes about to be queued.
+ *
+ * @return True if the bytes fit into the budget, false otherwise.
+ */
+static inline bool net_context_rcvbuf_charge(struct net_context *context,
+					     size_t bytes)
+{
+#if defined(CONFIG_NET_CONTEXT_RCVBUF)
+	atomic_val_t queued;
+
+	if (context->options.rcvbuf <= 0) {
+		return true;
+	}
+
+	do {
+		queued = atomic_get(&context->recv_q_bytes);
+
+		if (queued + (atomic_val_t)bytes >
+		    (atomic_val_t)context->options.rcvbuf) {
+			return false;
+		}
+	} while (!atomic_cas(&context->recv_q_bytes, queued,
+			     queued + (atomic_val_t)bytes));
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(bytes);
+#endif
+	return true;
+}
+
+/**
+ * @brief Return previously charged bytes to the receive buffer budget.
+ *
+ * @details Called when the application has consumed queued data or the
+ * receive queue is flushed. The counter saturates at zero so that a
+ * limit set while packets were already queued cannot make it wrap.
+ *
+ * @param context Network context.
+ * @param bytes Number of payload bytes released.
+ */
+static inline void net_context_rcvbuf_uncharge(struct net_context *context,
+					       size_t bytes)
+{
+#if defined(CONFIG_NET_CONTEXT_RCVBUF)
+	atomic_val_t queued;
+	atomic_val_t new_queued;
+
+	do {
+		queued = atomic_get(&context->recv_q_bytes);
+
+		if (queued > (atomic_val_t)bytes) {
+			new_queued = queued - (atomic_val_t)bytes;
+		} else {
+			new_queued = 0;
+		}
+	} while (!atomic_cas(&context->recv_q_bytes, queued, new_queued));
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(bytes);
+#endif
+}
+
 static inline uint8_t net_context_get_ipv4_ttl(struct net_context *context)
 {
 	return context->ipv4_ttl;
@@ -645,6 +762,8 @@ static inline uint8_t net_context_get_ipv4_ttl(struct net_context *context)
 static inline void net_context_set_ipv4_ttl(struct net_context *context,
 					    uint8_t ttl)
 {
+	net_context_udp_hdr_cache_invalidate(context);
+
 	context->ipv4_ttl = ttl;
 }
 
@@ -656,6 +775,8 @@ static inline uint8_t net_context_get_ipv6_hop_limit(struct net_context *context
 static inline void net_context_set_ipv6_hop_limit(struct net_context *context,
 						  uint8_t hop_limit)
 {
+	net_context_udp_hdr_cache_invalidate(context);
+
 	context->ipv6_hop_limit = hop_limit;
 }
 
@@ -949,6 +1070,81 @@ int net_context_sendto(struct net_context *context,
 		       k_timeout_t timeout,
 		       void *user_data);
 
+#if defined(CONFIG_NET_CONTEXT_SENDBUF)
+struct net_buf;
+
+/**
+ * @brief Send a net_buf backed payload to a peer without copying it.
+ *
+ * @details This function can be used to send a payload that the application
+ * has filled in place in net_buf buffers, typically allocated from an
+ * application defined pool created with NET_BUF_POOL_DEFINE(). The buffer
+ * chain is appended to the outgoing packet as is, so the payload is never
+ * copied into the network stack. The context must be connected; this works
+ * for UDP and TCP contexts. For UDP the whole chain must fit into one
+ * datagram.
+ *
+ * On success the stack takes over the buffer reference and releases it
+ * back to its pool once it is no longer needed: after the packet has been
+ * processed by the network interface for UDP, or after the data has been
+ * acknowledged by the peer for TCP. The pool destroy callback can thus be
+ * used as the transmit completion notification. If an error is returned,
+ * the buffer has not been queued and stays with the caller.
+ *
+ * @param context The network context to use.
+ * @param buffer The net_buf chain holding the payload to send. The
+ *        length of each fragment must have been set by the caller.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Currently this value is not used.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, a negative errno otherwise
+ */
+int net_context_send_buf(struct net_context *context,
+			 struct net_buf *buffer,
+			 net_context_send_cb_t cb,
+			 k_timeout_t timeout,
+			 void *user_data);
+#endif /* CONFIG_NET_CONTEXT_SENDBUF */
+
+#if defined(CONFIG_NET_CONTEXT_SPLICE)
+/**
+ * @brief Splice two connected contexts together.
+ *
+ * @details After a successful call, payload received on either context is
+ * forwarded to the other one directly in the network RX thread: the net_buf
+ * chain of the received packet is detached and loaned to the sending side,
+ * so the payload is neither copied nor delivered to the application. This
+ * is meant for proxies (e.g. SOCKS5 gateways) and port forwarders that
+ * would otherwise relay the data through user space.
+ *
+ * Both contexts must be connected. The splice replaces any receive
+ * callback installed on the contexts, so the application no longer sees
+ * the forwarded data. Forwarding is best effort: payload that cannot be
+ * queued to the peer (e.g. out of buffers) is dropped, for TCP the normal
+ * retransmission by the remote end then recovers the data.
+ *
+ * @param ctx_a First network context.
+ * @param ctx_b Second network context.
+ *
+ * @return 0 on success, a negative errno otherwise
+ */
+int net_context_splice(struct net_context *ctx_a, struct net_context *ctx_b);
+
+/**
+ * @brief Remove the splice from a context.
+ *
+ * @details Stops forwarding data received on this context. The peer
+ * context keeps forwarding until it is unspliced as well. After this the
+ * application can install its own receive callback again.
+ *
+ * @param context Network context to unsplice.
+ *
+ * @return 0 on success, a negative errno otherwise
+ */
+int net_context_unsplice(struct net_context *context);
+#endif /* CONFIG_NET_CONTEXT_SPLICE */
+
 /**
  * @brief Send data in iovec to a peer specified in msghdr struct.
  *
@@ -1043,6 +1239,7 @@ enum net_context_option {
 	NET_OPT_TIMESTAMP	= 2,
 	NET_OPT_TXTIME		= 3,
 	NET_OPT_SOCKS5		= 4,
+	NET_OPT_RCVBUF		= 5,
 };
 
 /**
@@ -187,6 +187,17 @@ enum net_if_flag {
 	 */
 	NET_IF_FORWARD_MULTICASTS,
 
+	/** The hardware checksums transmitted packets. Cached from the
+	 * Ethernet hardware capabilities when the interface is initialized
+	 * so that the TX fast path does not query the driver per packet.
+	 */
+	NET_IF_CHKSUM_OFFLOAD_TX,
+
+	/** The hardware verifies the checksums of received packets.
+	 * Cached like NET_IF_CHKSUM_OFFLOAD_TX.
+	 */
+	NET_IF_CHKSUM_OFFLOAD_RX,
+
 /** @cond INTERNAL_HIDDEN */
 	/* Total number of flags - must be at the end of the enum */
 	NET_IF_NUM_FLAGS
@@ -305,6 +316,13 @@ struct net_if_dhcpv4 {
 
 	/** Number of attempts made for REQUEST and RENEWAL messages */
 	uint8_t attempts;
+
+#if defined(CONFIG_NET_DHCPV4_INIT_REBOOT)
+	/** True when the lease fields above were restored from the
+	 *  settings subsystem and INIT-REBOOT can be attempted.
+	 */
+	bool lease_restored;
+#endif
 };
 #endif /* CONFIG_NET_DHCPV4 */
 
@@ -435,6 +453,11 @@ struct net_if_dev {
 	/** The hardware MTU */
 	uint16_t mtu;
 
+	/** Worst-case TX header space (L2 + L3 + L4) for this interface,
+	 * resolved once at interface init.
+	 */
+	uint16_t tx_headroom;
+
 #if defined(CONFIG_NET_SOCKETS_OFFLOAD)
 	/** Indicate whether interface is offloaded at socket level. */
 	bool offloaded;
@@ -761,6 +784,34 @@ static inline void net_if_set_mtu(struct net_if *iface,
 	iface->if_dev->mtu = mtu;
 }
 
+/**
+ * @brief Get a network interface's precomputed worst-case TX header space
+ *
+ * The value covers the L2 header plus the largest L3 and L4 headers the
+ * enabled protocols can prepend, and is resolved once when the interface
+ * is initialized.
+ *
+ * @param iface Pointer to a network interface structure
+ *
+ * @return the TX header space in bytes
+ */
+static inline uint16_t net_if_get_tx_headroom(struct net_if *iface)
+{
+	return iface->if_dev->tx_headroom;
+}
+
+/**
+ * @brief Set a network interface's worst-case TX header space
+ *
+ * @param iface Pointer to a network interface structure
+ * @param headroom New TX header space in bytes
+ */
+static inline void net_if_set_tx_headroom(struct net_if *iface,
+					  uint16_t headroom)
+{
+	iface->if_dev->tx_headroom = headroom;
+}
+
 /**
  * @brief Set the infinite status of the network interface address
  *
@@ -822,6 +873,18 @@ static inline void net_if_router_rm(struct net_if_router *router)
  */
 struct net_if *net_if_get_default(void);
 
+/**
+ * @brief Set the default network interface at runtime.
+ *
+ * This overrides the build time default interface selection until it is
+ * called again. Passing NULL restores the build time selection.
+ *
+ * @param iface Interface to use as the default or NULL.
+ *
+ * @return 0 if ok, -EINVAL if the interface is not valid.
+ */
+int net_if_set_default(struct net_if *iface);
+
 /**
  * @brief Get the first network interface according to its type.
  *
@@ -120,6 +120,15 @@ struct net_pkt {
 	};
 #endif /* CONFIG_NET_PKT_TIMESTAMP */
 
+#if defined(CONFIG_NET_PKT_TX_CHKSUM_CACHE)
+	/** One's complement sum of the last tx_chksum_len bytes of the
+	 * packet, folded in while the TX payload was copied in so that
+	 * checksum finalization does not walk the payload again.
+	 */
+	uint16_t tx_chksum;
+	uint16_t tx_chksum_len;
+#endif /* CONFIG_NET_PKT_TX_CHKSUM_CACHE */
+
 #if defined(CONFIG_NET_PKT_TXTIME)
 	/** Network packet TX time in the future (in nanoseconds) */
 	uint64_t txtime;
@@ -190,6 +199,17 @@ struct net_pkt {
 					*/
 #endif
 
+#if defined(CONFIG_NET_TC_TX_BATCH)
+	uint8_t tx_more           : 1; /* For outgoing packet: at least one
+					* more packet for the same interface
+					* follows immediately in the same TX
+					* batch. A driver may use this as a
+					* hint to chain its TX descriptor and
+					* postpone kicking the hardware until
+					* a packet without this hint is sent.
+					*/
+#endif
+
 	union {
 		/* IPv6 hop limit or IPv4 ttl for this network packet.
 		 * The value is shared between IPv6 and IPv4.
@@ -382,6 +402,27 @@ static inline void net_pkt_set_tcp_1st_msg(struct net_pkt *pkt, bool is_1st)
 #endif
 }
 
+static inline uint8_t net_pkt_tx_more(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_TC_TX_BATCH)
+	return pkt->tx_more;
+#else
+	ARG_UNUSED(pkt);
+
+	return false;
+#endif
+}
+
+static inline void net_pkt_set_tx_more(struct net_pkt *pkt, bool more)
+{
+#if defined(CONFIG_NET_TC_TX_BATCH)
+	pkt->tx_more = more;
+#else
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(more);
+#endif
+}
+
 #if defined(CONFIG_NET_SOCKETS)
 static inline uint8_t net_pkt_eof(struct net_pkt *pkt)
 {
@@ -823,6 +864,47 @@ static inline void net_pkt_set_txtime(struct net_pkt *pkt, uint64_t txtime)
 }
 #endif /* CONFIG_NET_PKT_TXTIME */
 
+#if defined(CONFIG_NET_PKT_TX_CHKSUM_CACHE)
+static inline uint16_t net_pkt_tx_chksum(struct net_pkt *pkt)
+{
+	return pkt->tx_chksum;
+}
+
+static inline uint16_t net_pkt_tx_chksum_len(struct net_pkt *pkt)
+{
+	return pkt->tx_chksum_len;
+}
+
+static inline void net_pkt_set_tx_chksum(struct net_pkt *pkt,
+					 uint16_t chksum, uint16_t length)
+{
+	pkt->tx_chksum = chksum;
+	pkt->tx_chksum_len = length;
+}
+#else
+static inline uint16_t net_pkt_tx_chksum(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline uint16_t net_pkt_tx_chksum_len(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_tx_chksum(struct net_pkt *pkt,
+					 uint16_t chksum, uint16_t length)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(chksum);
+	ARG_UNUSED(length);
+}
+#endif /* CONFIG_NET_PKT_TX_CHKSUM_CACHE */
+
 #if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL) || \
 	defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
 static inline uint32_t *net_pkt_stats_tick(struct net_pkt *pkt)
@@ -1442,6 +1524,15 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer_debug(struct net_if *iface,
 	net_pkt_rx_alloc_with_buffer_debug(_iface, _size, _family,	\
 					   _proto, _timeout,		\
 					   __func__, __LINE__)
+
+struct net_pkt *net_pkt_rx_alloc_from_buffer_debug(struct net_if *iface,
+						   struct net_buf *buffer,
+						   k_timeout_t timeout,
+						   const char *caller,
+						   int line);
+#define net_pkt_rx_alloc_from_buffer(_iface, _buffer, _timeout)		\
+	net_pkt_rx_alloc_from_buffer_debug(_iface, _buffer, _timeout,	\
+					   __func__, __LINE__)
 #endif /* NET_PKT_DEBUG_ENABLED */
 /** @endcond */
 
@@ -1557,6 +1648,33 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer(struct net_if *iface,
 					     k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Wrap a driver filled buffer into an RX net_pkt, without copying
+ *
+ * @details This is the hand-over half of the zero-copy RX contract for
+ *          drivers which DMA directly into network buffers: the driver
+ *          claims buffers with net_pkt_get_reserve_rx_data(), posts each
+ *          buffer's data pointer into its RX descriptor ring, and once the
+ *          hardware has written a complete frame it sets the length of
+ *          every fragment (net_buf_add()) and passes the fragment chain
+ *          here. Only packet metadata is allocated; the received data is
+ *          never copied. On allocation failure the buffer chain is left
+ *          untouched and still belongs to the caller. The buffer size of
+ *          the RX data pool must of course be compatible with the
+ *          hardware's descriptor segment size.
+ *
+ * @param iface   The network interface the packet was received on.
+ * @param buffer  Driver filled buffer chain holding the frame.
+ * @param timeout Maximum time to wait for a packet allocation.
+ *
+ * @return a pointer to a newly allocated net_pkt on success, NULL otherwise.
+ */
+#if !defined(NET_PKT_DEBUG_ENABLED)
+struct net_pkt *net_pkt_rx_alloc_from_buffer(struct net_if *iface,
+					     struct net_buf *buffer,
+					     k_timeout_t timeout);
+#endif
+
 /**
  * @brief Append a buffer in packet
  *
@@ -1701,6 +1819,36 @@ int net_pkt_copy(struct net_pkt *pkt_dst,
 		 struct net_pkt *pkt_src,
 		 size_t length);
 
+/**
+ * @brief Copy data from a packet into another one, folding the copied
+ *        bytes into the destination packet's TX checksum cache.
+ *
+ * @details Behaves as net_pkt_copy(). Additionally, when
+ *          CONFIG_NET_PKT_TX_CHKSUM_CACHE is enabled and the interface
+ *          needs the TX checksum to be computed in software, the one's
+ *          complement sum of the copied data is accumulated into the
+ *          destination packet so that the transport layer checksum
+ *          finalization does not need to walk the payload again.
+ *
+ * @param pkt_dst Destination network packet.
+ * @param pkt_src Source network packet.
+ * @param length  Length of data to be copied.
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+#if defined(CONFIG_NET_PKT_TX_CHKSUM_CACHE)
+int net_pkt_copy_chksum(struct net_pkt *pkt_dst,
+			struct net_pkt *pkt_src,
+			size_t length);
+#else
+static inline int net_pkt_copy_chksum(struct net_pkt *pkt_dst,
+				      struct net_pkt *pkt_src,
+				      size_t length)
+{
+	return net_pkt_copy(pkt_dst, pkt_src, length);
+}
+#endif /* CONFIG_NET_PKT_TX_CHKSUM_CACHE */
+
 /**
  * @brief Clone pkt and its buffer.
  *
@@ -1800,6 +1948,34 @@ int net_pkt_read_be32(struct net_pkt *pkt, uint32_t *data);
  */
 int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length);
 
+/**
+ * @brief Write data into a net_pkt, folding the written bytes into the
+ *        packet's TX checksum cache.
+ *
+ * @details Behaves as net_pkt_write(). Additionally, when
+ *          CONFIG_NET_PKT_TX_CHKSUM_CACHE is enabled and the interface
+ *          needs the TX checksum to be computed in software, the one's
+ *          complement sum of the written data is accumulated into the
+ *          packet so that the transport layer checksum finalization
+ *          does not need to walk the payload again.
+ *
+ * @param pkt    The network packet where to write
+ * @param data   Data to be written
+ * @param length Length of the data to be written
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+#if defined(CONFIG_NET_PKT_TX_CHKSUM_CACHE)
+int net_pkt_write_chksum(struct net_pkt *pkt, const void *data,
+			 size_t length);
+#else
+static inline int net_pkt_write_chksum(struct net_pkt *pkt, const void *data,
+				       size_t length)
+{
+	return net_pkt_write(pkt, data, length);
+}
+#endif /* CONFIG_NET_PKT_TX_CHKSUM_CACHE */
+
 /* Write uint8_t data into a net_pkt. */
 static inline int net_pkt_write_u8(struct net_pkt *pkt, uint8_t data)
 {
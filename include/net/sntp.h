@@ -48,6 +48,18 @@ struct sntp_time {
 	uint32_t fraction;
 };
 
+/** Slew-based clock discipline state, see sntp_clock_discipline() */
+struct sntp_clock {
+	/** Milliseconds added to the local uptime clock */
+	int64_t offset_ms;
+	/** Uptime (ms) when the slew was last folded into the offset */
+	int64_t last_update;
+	/** Rate correction currently applied on top of the offset */
+	int32_t slew_ppm;
+	/** True once the clock has been set from a measurement */
+	bool initialized;
+};
+
 /**
  * @brief Initialize SNTP context
  *
@@ -96,6 +108,62 @@ void sntp_close(struct sntp_ctx *ctx);
 int sntp_simple(const char *server, uint32_t timeout,
 		struct sntp_time *time);
 
+/**
+ * @brief Query SNTP in a burst and filter the samples
+ *
+ * Like sntp_simple(), but sends a burst of queries over one socket and
+ * reports the sample with the median clock offset, so that a single
+ * outlier round trip time cannot skew the result. The timeout covers
+ * the whole burst.
+ *
+ * @param server Address of server in format addr[:port]
+ * @param timeout Overall timeout for the burst
+ * @param samples Number of queries to send (clamped to an internal
+ * maximum of 16); with fewer than 3 the filtering degenerates to
+ * sntp_simple() behavior.
+ * @param time Timestamp including integer and fractional seconds since
+ * 1 Jan 1970 (output).
+ *
+ * @return 0 if ok, <0 if error (-ETIMEDOUT if no sample was received
+ * in time).
+ */
+int sntp_simple_burst(const char *server, uint32_t timeout, uint8_t samples,
+		      struct sntp_time *time);
+
+/**
+ * @brief Discipline a local clock towards a measured timestamp
+ *
+ * Feeds one timestamp measurement (e.g. from sntp_simple_burst()) into
+ * the clock state. Small errors are corrected by slewing: the clock
+ * rate is adjusted so that the error is amortized over
+ * CONFIG_SNTP_CLOCK_SLEW_PERIOD seconds instead of the time jumping.
+ * Errors larger than CONFIG_SNTP_CLOCK_STEP_THRESHOLD milliseconds, and
+ * the very first measurement, step the clock. The slew rate is limited
+ * to CONFIG_SNTP_CLOCK_MAX_SLEW_PPM.
+ *
+ * The state must be zero-initialized before the first call.
+ *
+ * @param clock Clock discipline state.
+ * @param time Measured timestamp, seconds and fraction since
+ * 1 Jan 1970.
+ *
+ * @return The measured clock error in milliseconds (zero for the first
+ * measurement).
+ */
+int64_t sntp_clock_discipline(struct sntp_clock *clock,
+			      const struct sntp_time *time);
+
+/**
+ * @brief Read the disciplined clock
+ *
+ * @param clock Clock discipline state.
+ * @param time Current timestamp estimate, seconds and fraction since
+ * 1 Jan 1970 (output).
+ *
+ * @return 0 if ok, -EAGAIN if the clock has not been disciplined yet.
+ */
+int sntp_clock_get(const struct sntp_clock *clock, struct sntp_time *time);
+
 #ifdef __cplusplus
 }
 #endif
@@ -125,6 +125,19 @@ struct zsock_pollfd {
  *  the TLS handshake.
  */
 #define TLS_ALPN_LIST 7
+/** Socket option to control TLS session caching on a socket. A client
+ *  socket with caching enabled stores the negotiated session after a
+ *  successful handshake and resumes it on the next handshake with the same
+ *  peer and credentials, which makes reconnections considerably cheaper.
+ *  Accepted values:
+ *    - 0 - Disabled.
+ *    - 1 - Enabled.
+ */
+#define TLS_SESSION_CACHE 8
+/** Write-only socket option to purge the whole TLS session cache. This
+ *  option accepts any value.
+ */
+#define TLS_SESSION_CACHE_PURGE 9
 
 /** @} */
 
@@ -137,6 +150,10 @@ struct zsock_pollfd {
 #define TLS_DTLS_ROLE_CLIENT 0 /**< Client role in a DTLS session. */
 #define TLS_DTLS_ROLE_SERVER 1 /**< Server role in a DTLS session. */
 
+/* Valid values for TLS_SESSION_CACHE option */
+#define TLS_SESSION_CACHE_DISABLED 0 /**< Disable TLS session caching. */
+#define TLS_SESSION_CACHE_ENABLED 1  /**< Enable TLS session caching. */
+
 struct zsock_addrinfo {
 	struct zsock_addrinfo *ai_next;
 	int ai_flags;
@@ -222,6 +239,85 @@ __syscall int zsock_socket(int family, int type, int proto);
  */
 __syscall int zsock_socketpair(int family, int type, int proto, int *sv);
 
+/**
+ * @brief Claim buffer space on a socketpair for a zero-copy write
+ *
+ * @details
+ * Zephyr specific extension to socketpair(). Claims a contiguous region
+ * of the peer's receive buffer so that the caller can produce data
+ * directly into it, avoiding the copy made by zsock_send(). The claim
+ * must be completed with zsock_socketpair_put_finish() before the data
+ * becomes visible to the reader; only one write claim may be
+ * outstanding per direction.
+ *
+ * The claimed region may be shorter than requested (or even empty) when
+ * the buffer is short of contiguous space; the caller is expected to
+ * poll for @ref ZSOCK_POLLOUT or claim the remainder later. As the
+ * returned pointer refers to socket-internal memory, this interface is
+ * not usable from user mode threads.
+ *
+ * @param sock socketpair file descriptor
+ * @param data where to store the address of the claimed region
+ * @param size requested region size, in bytes
+ *
+ * @return the number of bytes claimed (possibly 0) on success
+ * @return -1 on error, with @ref errno set appropriately.
+ */
+ssize_t zsock_socketpair_put_claim(int sock, uint8_t **data, size_t size);
+
+/**
+ * @brief Complete a zero-copy socketpair write
+ *
+ * @details
+ * Makes @p size bytes of the region claimed with
+ * zsock_socketpair_put_claim() visible to the reader and wakes the
+ * reader once the @ref SO_RCVLOWAT watermark is met. @p size may be
+ * less than what was claimed.
+ *
+ * @param sock socketpair file descriptor
+ * @param size number of claimed bytes actually written
+ *
+ * @return 0 on success
+ * @return -1 on error, with @ref errno set appropriately.
+ */
+int zsock_socketpair_put_finish(int sock, size_t size);
+
+/**
+ * @brief Claim queued socketpair data for a zero-copy read
+ *
+ * @details
+ * Counterpart to zsock_socketpair_put_claim() for the receiving side:
+ * returns a pointer to a contiguous run of queued bytes so that they
+ * can be consumed in place without the copy made by zsock_recv(). The
+ * bytes remain queued until released with
+ * zsock_socketpair_get_finish().
+ *
+ * @param sock socketpair file descriptor
+ * @param data where to store the address of the claimed region
+ * @param size maximum number of bytes to claim
+ *
+ * @return the number of bytes claimed (possibly 0) on success
+ * @return -1 on error, with @ref errno set appropriately.
+ */
+ssize_t zsock_socketpair_get_claim(int sock, uint8_t **data, size_t size);
+
+/**
+ * @brief Complete a zero-copy socketpair read
+ *
+ * @details
+ * Releases @p size bytes of the region claimed with
+ * zsock_socketpair_get_claim(), freeing the space for the writer and
+ * waking a writer blocked on a full buffer. @p size may be less than
+ * what was claimed.
+ *
+ * @param sock socketpair file descriptor
+ * @param size number of claimed bytes actually consumed
+ *
+ * @return 0 on success
+ * @return -1 on error, with @ref errno set appropriately.
+ */
+int zsock_socketpair_get_finish(int sock, size_t size);
+
 /**
  * @brief Close a network socket
  *
@@ -357,6 +453,24 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+#if defined(CONFIG_NET_CONTEXT_SENDBUF)
+struct net_buf;
+
+/**
+ * @brief Send a net_buf backed payload to a connected peer without copying
+ *
+ * @details The application fills net_buf buffers, typically allocated from
+ * its own pool created with NET_BUF_POOL_DEFINE(), in place and hands the
+ * chain over to the socket; the payload is never copied into the network
+ * stack. On success the stack owns the buffer and releases it back to its
+ * pool once it is no longer needed, so the pool destroy callback serves as
+ * the transmit completion notification. On error the buffer stays with the
+ * caller. The socket must be connected and the call is only available from
+ * kernel mode. See net_context_send_buf() for details.
+ */
+ssize_t zsock_sendbuf(int sock, struct net_buf *buffer);
+#endif /* CONFIG_NET_CONTEXT_SENDBUF */
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -806,6 +920,18 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 /** sockopt: Don't support IPv4 access (ignored, for compatibility) */
 #define IPV6_V6ONLY 26
 
+/** sockopt: Size of the receive buffer in bytes (zero means unlimited) */
+#define SO_RCVBUF 8
+
+/** sockopt: Minimum number of queued bytes before a reader is woken.
+ * Takes an int between 1 and the receive buffer capacity, default 1.
+ * A writer then wakes the blocked or polling reader only once the
+ * watermark has been accumulated, batching the scheduler round trips
+ * when many small writes are made. Currently only implemented for
+ * socketpair() sockets.
+ */
+#define SO_RCVLOWAT 18
+
 /** sockopt: Socket priority */
 #define SO_PRIORITY 12
 
@@ -817,6 +943,15 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 /** sockopt: Enable SOCKS5 for Socket */
 #define SO_SOCKS5 60
 
+/** sockopt: Busy poll the receive queue instead of sleeping on it.
+ * Takes an int, any non-zero value enables the mode. A blocking receive
+ * will then spin (yielding between polls) until data arrives, trading
+ * CPU time for not paying the sleep/wakeup latency of the receiving
+ * thread. The receiving thread must not have a higher priority than the
+ * network RX thread or the data will never be delivered.
+ */
+#define SO_BUSY_POLL 46
+
 /** @cond INTERNAL_HIDDEN */
 /**
  * @brief Registration information for a given BSD socket family.
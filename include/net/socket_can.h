@@ -38,6 +38,10 @@ extern "C" {
 
 enum {
 	CAN_RAW_FILTER = 1,
+	/** Read-only uint32_t: number of frames this socket missed
+	 *  because no buffer could be allocated for them.
+	 */
+	CAN_RAW_DROPPED_FRAMES,
 };
 
 /* Socket CAN MTU size */
@@ -19,9 +19,29 @@
 extern "C" {
 #endif
 
+/* @brief Streaming sink for received file data.
+ *
+ * Called once per received block, in order. When the callback is set in
+ * struct tftpc, the data is handed to it directly instead of being
+ * accumulated in user_buf, so peak RAM use does not scale with the file
+ * size (e.g. the callback can feed the blocks straight to stream_flash).
+ *
+ * @param data      Received block payload.
+ * @param len       Length of the payload in bytes.
+ * @param user_data User data given in struct tftpc.
+ *
+ * @return 0 on success, negative value to abort the transfer.
+ */
+typedef int (*tftpc_data_cb_t)(const uint8_t *data, size_t len,
+			       void *user_data);
+
 struct tftpc {
 	uint8_t   *user_buf;
 	uint32_t  user_buf_size;
+
+	/* Optional streaming sink: when set, user_buf is not used. */
+	tftpc_data_cb_t data_cb;
+	void      *user_data;
 };
 
 /* TFTP Client Error codes. */
@@ -31,6 +51,7 @@ struct tftpc {
 #define TFTPC_UNKNOWN_FAILURE    -3
 #define TFTPC_REMOTE_ERROR       -4
 #define TFTPC_RETRIES_EXHAUSTED  -5
+#define TFTPC_SINK_FAILURE       -6
 
 /* @brief This function gets "file" from the remote server.
  *
@@ -43,6 +64,7 @@ struct tftpc {
  *         TFTPC_BUFFER_OVERFLOW if the file is larger than the user buffer.
  *         TFTPC_REMOTE_ERROR if the server failed to process our request.
  *         TFTPC_RETRIES_EXHAUSTED if the client timed out waiting for server.
+ *         TFTPC_SINK_FAILURE if the streaming data callback rejected a block.
  */
 int tftp_get(struct sockaddr *server, struct tftpc *client,
 	     const char *remote_file, const char *mode);
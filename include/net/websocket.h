@@ -172,6 +172,29 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		       uint32_t *message_type, uint64_t *remaining,
 		       int32_t timeout);
 
+/**
+ * @brief Receive websocket msg from peer without copying the payload.
+ *
+ * @details The function will automatically remove websocket header from the
+ * message and unmask the payload in place. Instead of copying the payload
+ * into a user supplied buffer, a pointer into the temporary buffer given
+ * in websocket_connect() is returned. The pointer stays valid until the
+ * next receive call is made for this websocket.
+ *
+ * @param ws_sock Websocket id returned by websocket_connect().
+ * @param buf Where the pointer to the received data is stored.
+ * @param message_type Type of the message.
+ * @param remaining How much there is data left in the message after this read.
+ * @param timeout How long to try to receive the message.
+ *        The value is in milliseconds. Value SYS_FOREVER_MS means to wait
+ *        forever.
+ *
+ * @return <0 if error, >=0 amount of bytes received
+ */
+int websocket_recv_msg_inplace(int ws_sock, uint8_t **buf,
+			       uint32_t *message_type, uint64_t *remaining,
+			       int32_t timeout);
+
 /**
  * @brief Close websocket.
  *
@@ -55,6 +55,10 @@ typedef struct pthread_mutex {
 	uint16_t lock_count;
 	int type;
 	_wait_q_t wait_q;
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+	/* 0 unlocked, 1 locked, 2 locked with (possible) waiters */
+	atomic_t val;
+#endif
 } pthread_mutex_t;
 
 typedef struct pthread_mutexattr {
@@ -64,6 +68,9 @@ typedef struct pthread_mutexattr {
 /* Condition variables */
 typedef struct pthread_cond {
 	_wait_q_t wait_q;
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+	atomic_t waiters;
+#endif
 } pthread_cond_t;
 
 typedef struct pthread_condattr {
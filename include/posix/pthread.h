@@ -88,6 +88,9 @@ static inline int pthread_cond_init(pthread_cond_t *cv,
 {
 	ARG_UNUSED(att);
 	z_waitq_init(&cv->wait_q);
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+	atomic_set(&cv->waiters, 0);
+#endif
 	return 0;
 }
 
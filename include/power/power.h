@@ -9,6 +9,7 @@
 
 #include <zephyr/types.h>
 #include <stdbool.h>
+#include <sys/slist.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -214,6 +215,66 @@ bool sys_pm_ctrl_is_state_enabled(enum power_states state);
 
 #endif /* CONFIG_SYS_PM_STATE_LOCK */
 
+#ifdef CONFIG_SYS_PM_LATENCY_QOS
+
+/** Value reported when no wakeup latency QoS request is registered. */
+#define SYS_PM_LATENCY_UNLIMITED UINT32_MAX
+
+/**
+ * @brief Wakeup latency QoS request
+ *
+ * @details Registered by subsystems and applications to express the
+ *	    maximum wakeup latency they can tolerate. The memory is
+ *	    provided by the requester and must remain valid until the
+ *	    request is removed.
+ */
+struct sys_pm_latency_request {
+	sys_snode_t node;
+	uint32_t value_us;
+};
+
+/**
+ * @brief Register a wakeup latency QoS request
+ *
+ * @details While the request is registered, power management policies
+ *	    honoring latency QoS will not select sleep states whose exit
+ *	    latency exceeds @p value_us microseconds.
+ *
+ * @param [in] req Request to be registered.
+ * @param [in] value_us Maximum tolerable wakeup latency in microseconds.
+ */
+void sys_pm_ctrl_latency_request_add(struct sys_pm_latency_request *req,
+				     uint32_t value_us);
+
+/**
+ * @brief Change the value of a registered wakeup latency QoS request
+ *
+ * @param [in] req Request registered with
+ *	       @ref sys_pm_ctrl_latency_request_add.
+ * @param [in] value_us New maximum tolerable wakeup latency in microseconds.
+ */
+void sys_pm_ctrl_latency_request_update(struct sys_pm_latency_request *req,
+					uint32_t value_us);
+
+/**
+ * @brief Remove a wakeup latency QoS request
+ *
+ * @param [in] req Request registered with
+ *	       @ref sys_pm_ctrl_latency_request_add.
+ */
+void sys_pm_ctrl_latency_request_remove(struct sys_pm_latency_request *req);
+
+/**
+ * @brief Get the current wakeup latency constraint
+ *
+ * @return Smallest registered maximum tolerable wakeup latency in
+ *	   microseconds, or SYS_PM_LATENCY_UNLIMITED if no request is
+ *	   registered.
+ */
+uint32_t sys_pm_ctrl_max_latency_get(void);
+
+#endif /* CONFIG_SYS_PM_LATENCY_QOS */
+
 /**
  * @}
  */
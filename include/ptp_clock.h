@@ -22,11 +22,30 @@ extern "C" {
 #define PTP_CLOCK_NAME "PTP_CLOCK"
 #endif
 
+/**
+ * @brief Matched PTP clock and system cycle counter sample.
+ *
+ * Both fields refer to the same instant, so the PTP time domain can be
+ * correlated with k_cycle_get_32() without the unknown skew of two
+ * separate reads.
+ */
+struct ptp_cross_timestamp {
+	/** PTP clock time at the sampled instant */
+	struct net_ptp_time ptp;
+
+	/** System cycle counter (k_cycle_get_32() domain) at the same
+	 * instant
+	 */
+	uint32_t cycles;
+};
+
 __subsystem struct ptp_clock_driver_api {
 	int (*set)(const struct device *dev, struct net_ptp_time *tm);
 	int (*get)(const struct device *dev, struct net_ptp_time *tm);
 	int (*adjust)(const struct device *dev, int increment);
 	int (*rate_adjust)(const struct device *dev, float ratio);
+	int (*get_cross)(const struct device *dev,
+			 struct ptp_cross_timestamp *xts);
 };
 
 /**
@@ -65,6 +84,50 @@ static inline int z_impl_ptp_clock_get(const struct device *dev,
 	return api->get(dev, tm);
 }
 
+/**
+ * @brief Atomically sample the PTP clock and the system cycle counter.
+ *
+ * Drivers whose MAC supports hardware cross-timestamp capture provide
+ * the matched pair directly. For other drivers the pair is built by
+ * bracketing the PTP clock read between two cycle counter reads with
+ * interrupts locked and reporting the midpoint, which bounds the skew
+ * by half the cost of a PTP clock read.
+ *
+ * @param dev PTP clock device
+ * @param xts Where to store the matched PTP time and cycle counter
+ *            sample.
+ *
+ * @return 0 if ok, <0 if error
+ */
+__syscall int ptp_clock_get_cross(const struct device *dev,
+				  struct ptp_cross_timestamp *xts);
+
+static inline int z_impl_ptp_clock_get_cross(const struct device *dev,
+					     struct ptp_cross_timestamp *xts)
+{
+	const struct ptp_clock_driver_api *api =
+		(const struct ptp_clock_driver_api *)dev->api;
+	uint32_t before, after;
+	unsigned int key;
+	int ret;
+
+	if (api->get_cross != NULL) {
+		return api->get_cross(dev, xts);
+	}
+
+	key = irq_lock();
+
+	before = k_cycle_get_32();
+	ret = api->get(dev, &xts->ptp);
+	after = k_cycle_get_32();
+
+	irq_unlock(key);
+
+	xts->cycles = before + (after - before) / 2U;
+
+	return ret;
+}
+
 /**
  * @brief Adjust the PTP clock time.
  *
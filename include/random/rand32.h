@@ -46,6 +46,23 @@ extern "C" {
  */
 __syscall uint32_t sys_rand32_get(void);
 
+/**
+ * @brief Return a 32-bit random value from the fast, non-cryptographic
+ * generator tier.
+ *
+ * Values come from a xoshiro256++ pseudo-random generator with per-CPU
+ * state that is seeded once from the entropy driver at boot, so calls
+ * never wait on the hardware RNG. Use this for hot-path consumers
+ * (sequence numbers, identifiers, jitter) where statistical quality is
+ * sufficient; anything security sensitive must use sys_csrand_get()
+ * instead.
+ *
+ * @note Only available when CONFIG_FAST_RANDOM_GENERATOR is enabled.
+ *
+ * @return 32-bit random value.
+ */
+__syscall uint32_t sys_rand32_fast(void);
+
 /**
  * @brief Fill the destination buffer with random data values that should
  * pass general randomness tests.
@@ -44,16 +44,21 @@ void z_priq_rb_add(struct _priq_rb *pq, struct k_thread *thread);
 void z_priq_rb_remove(struct _priq_rb *pq, struct k_thread *thread);
 struct k_thread *z_priq_rb_best(struct _priq_rb *pq);
 
-/* Traditional/textbook "multi-queue" structure.  Separate lists for a
- * small number (max 32 here) of fixed priorities.  This corresponds
- * to the original Zephyr scheduler.  RAM requirements are
- * comparatively high, but performance is very fast.  Won't work with
- * features like deadline scheduling which need large priority spaces
- * to represent their requirements.
+/* Traditional/textbook "multi-queue" structure.  Separate lists for
+ * each fixed priority.  This corresponds to the original Zephyr
+ * scheduler.  RAM requirements are comparatively high, but
+ * performance is very fast.  Won't work with features like deadline
+ * scheduling which need large priority spaces to represent their
+ * requirements.
  */
+#define PRIQ_MQ_NUM_QUEUES \
+	(CONFIG_NUM_COOP_PRIORITIES + CONFIG_NUM_PREEMPT_PRIORITIES + 1)
+#define PRIQ_MQ_NUM_BITMAPS ((PRIQ_MQ_NUM_QUEUES + 31) >> 5)
+
 struct _priq_mq {
-	sys_dlist_t queues[32];
-	unsigned int bitmask; /* bit 1<<i set if queues[i] is non-empty */
+	sys_dlist_t queues[PRIQ_MQ_NUM_QUEUES];
+	/* bit i%32 of bitmask[i/32] set if queues[i] is non-empty */
+	unsigned int bitmask[PRIQ_MQ_NUM_BITMAPS];
 };
 
 void z_priq_mq_add(struct _priq_mq *pq, struct k_thread *thread);
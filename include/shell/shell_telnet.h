@@ -41,9 +41,10 @@ struct shell_telnet {
 	/** RX packet FIFO. */
 	struct k_fifo rx_fifo;
 
-	/** The delayed work is used to send non-lf terminated output that has
-	 *  been around for "too long". This will prove to be useful
-	 *  to send the shell prompt for instance.
+	/** The delayed work is used to flush buffered output that did not
+	 *  fill the line buffer, bounding the latency added by output
+	 *  coalescing. This will prove to be useful to send the shell
+	 *  prompt for instance.
 	 */
 	struct k_delayed_work send_work;
 
@@ -54,6 +54,11 @@
 #include <stddef.h>
 #include <zephyr/types.h>
 
+#ifdef CONFIG_STATS_PERCPU
+#include <kernel.h>
+#include <string.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -102,6 +107,71 @@ struct stats_hdr {
 	STATS_SECT_DECL(group__) { \
 		struct stats_hdr s_hdr;
 
+#ifdef CONFIG_STATS_PERCPU
+
+/* With CONFIG_STATS_PERCPU every statistic entry is an array with one
+ * counter bucket per CPU.  Hot-path increments only touch the bucket
+ * of the executing CPU, so they never contend on a shared cache line.
+ * Consolidated group values are read with stats_snapshot(); the raw
+ * entry offset reported by stats_walk() points at the bucket array of
+ * an entry rather than a single value.
+ */
+
+static inline unsigned int _stats_cpu_idx(void)
+{
+#ifdef CONFIG_SMP
+	return arch_curr_cpu()->id;
+#else
+	return 0U;
+#endif
+}
+
+/**
+ * @brief Declares a 32-bit stat entry inside a group struct.
+ *
+ * @param var__                 The name to assign to the entry.
+ */
+#define STATS_SECT_ENTRY(var__) uint32_t var__[CONFIG_MP_NUM_CPUS];
+
+/**
+ * @brief Declares a 16-bit stat entry inside a group struct.
+ *
+ * @param var__                 The name to assign to the entry.
+ */
+#define STATS_SECT_ENTRY16(var__) uint16_t var__[CONFIG_MP_NUM_CPUS];
+
+/**
+ * @brief Declares a 32-bit stat entry inside a group struct.
+ *
+ * @param var__                 The name to assign to the entry.
+ */
+#define STATS_SECT_ENTRY32(var__) uint32_t var__[CONFIG_MP_NUM_CPUS];
+
+/**
+ * @brief Declares a 64-bit stat entry inside a group struct.
+ *
+ * @param var__                 The name to assign to the entry.
+ */
+#define STATS_SECT_ENTRY64(var__) uint64_t var__[CONFIG_MP_NUM_CPUS];
+
+/**
+ * @brief Increases a statistic entry by the specified amount.
+ *
+ * Increases a statistic entry by the specified amount.  Compiled out if
+ * CONFIG_STATS is not defined.
+ *
+ * @param group__               The group containing the entry to increase.
+ * @param var__                 The statistic entry to increase.
+ * @param n__                   The amount to increase the statistic entry by.
+ */
+#define STATS_INCN(group__, var__, n__)	\
+	((group__).var__[_stats_cpu_idx()] += (n__))
+
+/* Number of bytes occupied by one entry in the group struct */
+#define STATS_ENTRY_SPAN(size__) ((size__) * CONFIG_MP_NUM_CPUS)
+
+#else /* CONFIG_STATS_PERCPU */
+
 /**
  * @brief Declares a 32-bit stat entry inside a group struct.
  *
@@ -143,6 +213,10 @@ struct stats_hdr {
 #define STATS_INCN(group__, var__, n__)	\
 	((group__).var__ += (n__))
 
+#define STATS_ENTRY_SPAN(size__) (size__)
+
+#endif /* CONFIG_STATS_PERCPU */
+
 /**
  * @brief Increments a statistic entry.
  *
@@ -164,8 +238,13 @@ struct stats_hdr {
  * @param group__               The group containing the entry to clear.
  * @param var__                 The statistic entry to clear.
  */
+#ifdef CONFIG_STATS_PERCPU
+#define STATS_CLEAR(group__, var__) \
+	(void)memset(&(group__).var__, 0, sizeof((group__).var__))
+#else
 #define STATS_CLEAR(group__, var__) \
 	((group__).var__ = 0)
+#endif
 
 #define STATS_SIZE_16 (sizeof(uint16_t))
 #define STATS_SIZE_32 (sizeof(uint32_t))
@@ -173,7 +252,7 @@ struct stats_hdr {
 
 #define STATS_SIZE_INIT_PARMS(group__, size__) \
 	(size__),			       \
-	((sizeof(group__)) - sizeof(struct stats_hdr)) / (size__)
+	((sizeof(group__)) - sizeof(struct stats_hdr)) / STATS_ENTRY_SPAN(size__)
 
 /**
  * @brief Initializes and registers a statistics group.
@@ -193,7 +272,8 @@ struct stats_hdr {
 	stats_init_and_reg(						 \
 		&(group__).s_hdr,					 \
 		(size__),						 \
-		(sizeof(group__) - sizeof(struct stats_hdr)) / (size__), \
+		(sizeof(group__) - sizeof(struct stats_hdr)) /		 \
+			STATS_ENTRY_SPAN(size__),			 \
 		STATS_NAME_INIT_PARMS(group__),				 \
 		(name__))
 
@@ -336,6 +416,34 @@ struct stats_hdr *stats_group_get_next(const struct stats_hdr *cur);
  */
 struct stats_hdr *stats_group_find(const char *name);
 
+/**
+ * @brief Size of the buffer required to snapshot a group.
+ *
+ * @param hdr                   The stats group to snapshot.
+ *
+ * @return                      Required buffer size, in bytes.
+ */
+size_t stats_snapshot_size(const struct stats_hdr *hdr);
+
+/**
+ * @brief Copies the consolidated values of a whole group at once.
+ *
+ * The destination buffer receives one value of the group entry size
+ * per entry, in declaration order, with the per-CPU buckets of each
+ * entry summed when CONFIG_STATS_PERCPU is enabled.  No counter value
+ * is ever read torn; increments racing with the snapshot on other
+ * CPUs may or may not be included.
+ *
+ * @param hdr                   The stats group to snapshot.
+ * @param buf                   Destination buffer.
+ * @param buf_size              Size of the destination buffer, must be
+ *                                  at least stats_snapshot_size(hdr).
+ *
+ * @return                      0 on success; -EINVAL if the buffer is
+ *                              too small.
+ */
+int stats_snapshot(struct stats_hdr *hdr, void *buf, size_t buf_size);
+
 #else /* CONFIG_STATS */
 
 #define STATS_SECT_START(group__) \
@@ -62,6 +62,14 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	uint8_t *write_buf; /* Buffer being programmed by the worker */
+	size_t write_buf_bytes; /* Number of bytes in write_buf */
+	size_t bytes_queued; /* Bytes accepted, written or in flight */
+	int write_error; /* First error reported by the worker */
+	struct k_work work; /* Programs write_buf from the work queue */
+	struct k_sem idle; /* Given when no write is in flight */
+#endif
 };
 
 /**
@@ -72,6 +80,8 @@ struct stream_flash_ctx {
  * @param buf Write buffer
  * @param buf_len Length of write buffer. Can not be larger than the page size.
  *                Must be multiple of the flash device write-block-size.
+ *                With CONFIG_STREAM_FLASH_DOUBLE_BUFFER the buffer is split
+ *                in two halves, each of which must meet these requirements.
  * @param offset Offset within flash device to start writing to
  * @param size Number of bytes available for performing buffered write.
  *             If this is '0', the size will be set to the total size
@@ -94,6 +104,25 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
  */
 size_t stream_flash_bytes_written(struct stream_flash_ctx *ctx);
 
+/**
+ * @brief Resume a stream write at a given position.
+ *
+ * Declares that the first @p bytes_written bytes of the write area already
+ * hold valid data, so subsequent writes continue after them.  This allows
+ * an interrupted transfer to be resumed from persisted progress instead of
+ * starting over.  Must be called after stream_flash_init() and before any
+ * data is written through the context.
+ *
+ * @param ctx context
+ * @param bytes_written Number of bytes already present in the write area.
+ *        Must be a multiple of the flash device write-block-size and can
+ *        not exceed the size of the write area.
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_progress_set(struct stream_flash_ctx *ctx,
+			      size_t bytes_written);
+
 /**
  * @brief  Process input buffers to be written to flash device in single blocks.
  * Will store remainder between calls.
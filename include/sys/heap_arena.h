@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_SYS_HEAP_ARENA_H_
+#define ZEPHYR_INCLUDE_SYS_HEAP_ARENA_H_
+
+#include <kernel.h>
+
+/**
+ * @brief Striped heap arena
+ *
+ * A heap arena is a set of independent k_heap "stripes" carved out of
+ * one memory region, plus a small lock-free cache of recently freed
+ * small blocks in front of each stripe.  Allocating threads are
+ * hashed onto stripes, so concurrent allocators usually contend on
+ * different heap locks, and a hot small alloc/free pair is served
+ * entirely from the cache without taking any lock.
+ *
+ * Unlike a bare k_heap, blocks must be returned through the arena
+ * they came from (each block carries a hidden stripe tag).
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+struct sys_heap_arena_stripe {
+	struct k_heap heap;
+	atomic_ptr_t cache[CONFIG_SYS_HEAP_ARENA_CACHE_SLOTS];
+};
+
+struct sys_heap_arena {
+	struct sys_heap_arena_stripe *stripes;
+	uint32_t n_stripes;
+	size_t cache_block_size;
+};
+
+/** INTERNAL_HIDDEN @endcond */
+
+/**
+ * @brief Initialize a heap arena
+ *
+ * Divides the @a bytes sized region at @a mem evenly among @a
+ * n_stripes heap stripes.  Allocations of up to @a cache_block_size
+ * bytes are rounded up to that size so freed ones can be recycled
+ * through the stripe caches; pass zero to disable caching.
+ *
+ * @param arena Arena to initialize
+ * @param stripes Backing storage for the stripe state, at least
+ *                @a n_stripes elements
+ * @param n_stripes Number of heap stripes
+ * @param mem Memory region for the heaps
+ * @param bytes Size of the memory region in bytes
+ * @param cache_block_size Largest allocation served from the stripe
+ *                         caches, in bytes
+ */
+void sys_heap_arena_init(struct sys_heap_arena *arena,
+			 struct sys_heap_arena_stripe *stripes,
+			 uint32_t n_stripes, void *mem, size_t bytes,
+			 size_t cache_block_size);
+
+/**
+ * @brief Allocate memory from a heap arena
+ *
+ * Allocates @a bytes from the calling thread's stripe, waiting up to
+ * @a timeout for memory to be freed to that stripe if it is
+ * exhausted.  Other stripes are not searched; a full stripe fails
+ * even if its neighbours have room.
+ *
+ * @note Can be called by ISRs, but then @a timeout must be K_NO_WAIT.
+ *
+ * @param arena Arena to allocate from
+ * @param bytes Number of bytes requested
+ * @param timeout How long to wait for memory, or K_NO_WAIT
+ *
+ * @return Pointer to memory, or NULL on failure
+ */
+void *sys_heap_arena_alloc(struct sys_heap_arena *arena, size_t bytes,
+			   k_timeout_t timeout);
+
+/**
+ * @brief Free memory allocated from a heap arena
+ *
+ * Returns the block to the stripe it was allocated from, or parks a
+ * small block in that stripe's cache for the next allocator.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param arena Arena the block was allocated from
+ * @param mem Block to free, or NULL (a no-op)
+ */
+void sys_heap_arena_free(struct sys_heap_arena *arena, void *mem);
+
+#endif /* ZEPHYR_INCLUDE_SYS_HEAP_ARENA_H_ */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief High-resolution sub-tick timers
+ *
+ * One-shot timers scheduled on the timer driver's free-running cycle
+ * counter through a dedicated comparator, independent of the system
+ * tick rate.  They allow microsecond-accurate events while the tick
+ * stays at a slow, power-friendly rate.  Only available with
+ * CONFIG_HIRES_TIMER, i.e. with timer drivers that implement the hires
+ * alarm hooks (see TIMER_HAS_HIRES_ALARM).
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HIRES_TIMER_H_
+#define ZEPHYR_INCLUDE_SYS_HIRES_TIMER_H_
+
+#include <kernel.h>
+#include <sys/dlist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct k_hires_timer;
+
+/**
+ * @typedef k_hires_timer_expiry_t
+ * @brief High-resolution timer expiry function
+ *
+ * Runs in interrupt context of the system timer; keep it short, as for
+ * any ISR.  The timer has already been released when it runs and may be
+ * restarted from within the expiry function.
+ *
+ * @param timer Timer that expired.
+ */
+typedef void (*k_hires_timer_expiry_t)(struct k_hires_timer *timer);
+
+struct k_hires_timer {
+	sys_dnode_t node;
+	/** Absolute hardware cycle count of the expiry point */
+	uint32_t target;
+	k_hires_timer_expiry_t expiry_fn;
+	void *user_data;
+};
+
+/**
+ * @brief Initialize a high-resolution timer
+ *
+ * @param timer Timer to initialize.
+ * @param expiry_fn Function called, from interrupt context, at expiry.
+ */
+void k_hires_timer_init(struct k_hires_timer *timer,
+			k_hires_timer_expiry_t expiry_fn);
+
+/**
+ * @brief Start a one-shot high-resolution timer
+ *
+ * The expiry function runs once the free-running cycle counter reaches
+ * the point @a delay_us microseconds from now, with the accuracy of the
+ * timer driver's comparator rather than of the system tick.  Starting a
+ * timer that is already running moves its expiry point.
+ *
+ * Delays of up to half the 32-bit cycle counter wrap period are
+ * supported (e.g. about 35 minutes at 1 MHz).
+ *
+ * @param timer Timer to start.
+ * @param delay_us Delay until expiry, in microseconds.
+ */
+void k_hires_timer_start(struct k_hires_timer *timer, uint32_t delay_us);
+
+/**
+ * @brief Stop a high-resolution timer
+ *
+ * @param timer Timer to stop.
+ *
+ * @return true if the timer was pending, false if it had already
+ *	   expired or was never started.
+ */
+bool k_hires_timer_stop(struct k_hires_timer *timer);
+
+/**
+ * @brief Time until expiry of a running timer
+ *
+ * @param timer Timer to query.
+ *
+ * @return Microseconds until the expiry point, 0 if the timer is not
+ *	   pending or already due.
+ */
+uint32_t k_hires_timer_remaining_us(const struct k_hires_timer *timer);
+
+/**
+ * @brief Associate user-specific data with a timer
+ *
+ * @param timer Timer to modify.
+ * @param user_data User data to associate with the timer.
+ */
+static inline void k_hires_timer_user_data_set(struct k_hires_timer *timer,
+					       void *user_data)
+{
+	timer->user_data = user_data;
+}
+
+/**
+ * @brief Retrieve the user-specific data from a timer
+ *
+ * @param timer Timer to query.
+ *
+ * @return The user data.
+ */
+static inline void *k_hires_timer_user_data_get(
+	const struct k_hires_timer *timer)
+{
+	return timer->user_data;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HIRES_TIMER_H_ */
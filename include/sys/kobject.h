@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <errno.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -312,6 +313,62 @@ static inline void k_object_free(void *obj)
 /* LCOV_EXCL_STOP */
 #endif /* CONFIG_DYNAMIC_OBJECTS */
 
+/**
+ * @brief System call batch entry
+ *
+ * Describes one system call to be dispatched by k_syscall_batch().
+ * The @a id field holds a K_SYSCALL_ identifier from the generated
+ * syscall list, and @a args holds the call's arguments exactly as the
+ * architecture system call glue would pass them (i.e. already
+ * marshalled; calls taking more than six arguments pass a pointer to
+ * the excess in the final slot).
+ */
+struct k_syscall_batch_entry {
+	/** Syscall identifier (K_SYSCALL_ value) */
+	uintptr_t id;
+	/** Marshalled syscall arguments */
+	uintptr_t args[6];
+	/** Return value, filled in after dispatch */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Execute a batch of system calls in a single privilege transition
+ *
+ * This routine dispatches @a count system calls described by @a entries
+ * in order, storing each call's return value in its entry. From a user
+ * thread this costs one kernel trap regardless of the number of calls,
+ * which matters for tight sequences of small calls where the
+ * transition overhead dominates.
+ *
+ * Each entry is validated exactly as if the call had been made
+ * individually; a faulting entry terminates the thread the same way a
+ * bad direct system call would. Batches may not be nested.
+ *
+ * Supervisor-mode callers have no transition to amortize and should
+ * make the calls directly.
+ *
+ * @param entries Array of batch entries, updated with return values
+ * @param count Number of entries
+ * @retval 0 on success
+ * @retval -ENOSYS if invoked from supervisor mode
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries,
+			      size_t count);
+
+#ifndef CONFIG_USERSPACE
+/* LCOV_EXCL_START */
+static inline int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	return -ENOSYS;
+}
+/* LCOV_EXCL_STOP */
+#endif /* !CONFIG_USERSPACE */
+
 /** @} */
 
 #include <syscalls/kobject.h>
@@ -87,6 +87,56 @@ extern "C" {
 void z_mem_map(uint8_t **linear_addr, uintptr_t phys_addr, size_t size,
 	       uint32_t flags);
 
+/**
+ * Reserve a virtual memory region without mapping it
+ *
+ * Carves a page-aligned region out of the kernel's virtual address space
+ * without creating any mappings for it. Touching the region faults until
+ * pages are populated with z_mem_commit(), which allows regions such as
+ * thread stacks to be sized for the worst case while only committing
+ * physical pages as they are actually needed.
+ *
+ * If there is insufficient virtual address space for the reservation,
+ * this will generate a kernel panic.
+ *
+ * This API is only available if CONFIG_MMU is enabled.
+ *
+ * This API is part of infrastructure still under development and may
+ * change.
+ *
+ * @param virt_addr [out] Output linear address storage location
+ * @param size Size of the region to reserve
+ */
+void z_mem_reserve(uint8_t **virt_addr, size_t size);
+
+/**
+ * Map physical pages into a previously reserved virtual region
+ *
+ * Populates part of a region obtained from z_mem_reserve() with actual
+ * mappings. Intended to be callable from fault handling context, so an
+ * architecture taking a page fault inside a reserved region (for example
+ * below the high-water mark of a demand-mapped stack) can map pages on
+ * first touch and resume the faulting thread.
+ *
+ * All addresses and the size must be aligned to CONFIG_MMU_PAGE_SIZE.
+ *
+ * This API is only available if CONFIG_MMU is enabled.
+ *
+ * This API is part of infrastructure still under development and may
+ * change.
+ *
+ * @param virt_addr Page-aligned virtual address within a reserved region
+ * @param phys_addr Page-aligned physical address base to map
+ * @param size Page-aligned size of the region to populate
+ * @param flags Caching mode and access flags, see K_MAP_* macros
+ * @retval 0 Success
+ * @retval -ENOTSUP Unsupported cache mode with no suitable fallback, or
+ *	   unsupported flags
+ * @retval -ENOMEM Memory for additional paging structures unavailable
+ */
+int z_mem_commit(uint8_t *virt_addr, uintptr_t phys_addr, size_t size,
+		 uint32_t flags);
+
 /**
  * Given an arbitrary region, provide a aligned region that covers it
  *
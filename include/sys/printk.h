@@ -12,6 +12,7 @@
 #include <stddef.h>
 #include <stdarg.h>
 #include <inttypes.h>
+#include <sys/util_macro.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -60,6 +61,51 @@ static inline __printf_like(1, 0) void vprintk(const char *fmt, va_list ap)
 }
 #endif
 
+/** @brief Maximum number of arguments printk_deferred() can capture. */
+#define PRINTK_DEFERRED_MAX_ARGS 6
+
+#ifdef CONFIG_PRINTK_DEFERRED
+/**
+ *
+ * @brief Capture a debugging message for deferred formatting.
+ *
+ * Stores the format string pointer and the raw argument words in a
+ * ring buffer instead of formatting on the calling context, bounding
+ * the cost on hot paths and in ISRs. Messages are formatted and sent
+ * to the console when printk_deferred_flush() is called.
+ *
+ * The format string and any \%s arguments must point to storage that
+ * is still valid at flush time (string literals, static buffers).
+ * Arguments are captured as machine words, so integer, pointer and
+ * string conversions are supported but floating point and (on 32-bit
+ * targets) 64-bit conversions are not. At most
+ * PRINTK_DEFERRED_MAX_ARGS arguments may be captured; messages with
+ * more arguments, or messages that do not fit in the buffer, are
+ * counted and reported as dropped by the next flush.
+ *
+ * @param ... Format string followed by optional format arguments.
+ *
+ * @return N/A
+ */
+#define printk_deferred(...) \
+	z_printk_deferred(NUM_VA_ARGS_LESS_1(__VA_ARGS__), __VA_ARGS__)
+
+extern __printf_like(2, 3) void z_printk_deferred(int nargs,
+						  const char *fmt, ...);
+
+/**
+ *
+ * @brief Format and output all captured deferred messages.
+ *
+ * Drains the printk_deferred() ring buffer, formatting each captured
+ * message and sending it to the console. Meant to be called from a
+ * background thread, not from the hot path that captured the messages.
+ *
+ * @return Number of messages flushed.
+ */
+extern int printk_deferred_flush(void);
+#endif /* CONFIG_PRINTK_DEFERRED */
+
 extern __printf_like(3, 4) int snprintk(char *str, size_t size,
 					const char *fmt, ...);
 extern __printf_like(3, 0) int vsnprintk(char *str, size_t size,
@@ -44,9 +44,14 @@
 #define ZEPHYR_INCLUDE_SYS_RB_H_
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 struct rbnode {
 	struct rbnode *children[2];
+#ifdef CONFIG_RBTREE_ORDER_STATS
+	uint32_t subtree; /**< Number of nodes in the subtree rooted here */
+#endif
 };
 
 /* Theoretical maximum depth of tree based on pointer size. If memory
@@ -129,6 +134,53 @@ static inline struct rbnode *rb_get_max(struct rbtree *tree)
  */
 bool rb_contains(struct rbtree *tree, struct rbnode *node);
 
+#ifdef CONFIG_RBTREE_ORDER_STATS
+/**
+ * @brief Returns the number of nodes in the tree
+ *
+ * O(1); reads the subtree size stored in the root.
+ */
+static inline uint32_t rb_size(struct rbtree *tree)
+{
+	return tree->root == NULL ? 0 : tree->root->subtree;
+}
+
+/**
+ * @brief Returns the node with the given rank (order statistic select)
+ *
+ * Ranks are zero-based and count upward in sorted order, so
+ * rb_select(t, 0) is equivalent to rb_get_min(t).  Runs in O(log2(N))
+ * by descending the stored subtree sizes.
+ *
+ * @return The node of the given rank, or NULL if rank >= rb_size(tree)
+ */
+struct rbnode *rb_select(struct rbtree *tree, uint32_t rank);
+
+/**
+ * @brief Returns the rank of a node in the tree
+ *
+ * The inverse of rb_select(): computes in O(log2(N)) the number of
+ * nodes in the tree that sort strictly before the given node.
+ *
+ * @return The zero-based rank of node, or -1 if node is not in the tree
+ */
+int rb_rank(struct rbtree *tree, struct rbnode *node);
+#endif
+
+#ifndef CONFIG_MISRA_SANE
+/**
+ * @brief Rebuild a tree from a sorted array of nodes
+ *
+ * Replaces the contents of the tree with the count nodes in the
+ * provided array, which must already be sorted in ascending order per
+ * the tree's lessthan_fn.  The result is a complete (minimum-height)
+ * tree built in O(N), without the rebalancing work that inserting the
+ * nodes one at a time would do.  The previous contents of the tree,
+ * if any, are simply forgotten; the caller still owns those nodes.
+ */
+void rb_build(struct rbtree *tree, struct rbnode **nodes, size_t count);
+#endif
+
 #ifndef CONFIG_MISRA_SANE
 /**
  * @brief Walk/enumerate a rbtree
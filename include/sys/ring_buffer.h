@@ -405,6 +405,106 @@ int ring_buf_get_finish(struct ring_buf *buf, uint32_t size);
  */
 uint32_t ring_buf_get(struct ring_buf *buf, uint8_t *data, uint32_t size);
 
+/* Alignment used to keep producer and consumer cursors of an MPMC ring
+ * on separate cache lines.  Only x86 and ARC publish their line size as
+ * a Kconfig symbol; 64 bytes covers every SMP target we build for.
+ */
+#ifdef CONFIG_CACHE_LINE_SIZE
+#define RING_BUF_MPMC_ALIGN CONFIG_CACHE_LINE_SIZE
+#else
+#define RING_BUF_MPMC_ALIGN 64
+#endif
+
+/**
+ * @brief Cell of a multi-producer/multi-consumer ring buffer.
+ *
+ * Each cell carries a sequence number that encodes whether it currently
+ * belongs to producers or consumers, plus one word of payload.
+ */
+struct ring_buf_mpmc_cell {
+	atomic_t seq;
+	uintptr_t data;
+};
+
+/**
+ * @brief A multi-producer/multi-consumer lock-free ring buffer.
+ *
+ * Unlike struct ring_buf, which requires external locking when several
+ * contexts put or get concurrently, this ring may be used from any
+ * number of producers and consumers (threads or ISRs, on any CPU)
+ * without a lock.  Each element is a single machine word, typically a
+ * pointer to a message.  Producer and consumer cursors live on separate
+ * cache lines so writers on different CPUs do not false-share.
+ */
+struct ring_buf_mpmc {
+	uint32_t mask;   /**< Modulo mask; cell count is mask + 1 */
+	struct ring_buf_mpmc_cell *cells; /**< Cell array, mask + 1 entries */
+	atomic_t enq __aligned(RING_BUF_MPMC_ALIGN); /**< Producer cursor */
+	atomic_t deq __aligned(RING_BUF_MPMC_ALIGN); /**< Consumer cursor */
+};
+
+/**
+ * @brief Statically define and initialize an MPMC ring buffer.
+ *
+ * The ring contains 2^pow cells of one word each.
+ *
+ * The ring buffer can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct ring_buf_mpmc <name>; @endcode
+ *
+ * @param name Name of the ring buffer.
+ * @param pow Ring buffer size exponent.
+ */
+#define RING_BUF_MPMC_DECLARE(name, pow) \
+	static struct ring_buf_mpmc_cell _ring_buffer_cells_##name[BIT(pow)]; \
+	struct ring_buf_mpmc name = { \
+		.mask = BIT(pow) - 1, \
+		.cells = _ring_buffer_cells_##name, \
+	}
+
+/**
+ * @brief Initialize an MPMC ring buffer.
+ *
+ * This routine initializes an MPMC ring buffer, prior to its first use.
+ * It is only used for ring buffers not defined using
+ * RING_BUF_MPMC_DECLARE.  It must not race with any put or get.
+ *
+ * @param buf Address of ring buffer.
+ * @param size Number of cells; must be a power of 2.
+ * @param cells Cell array (struct ring_buf_mpmc_cell cells[size]).
+ */
+void ring_buf_mpmc_init(struct ring_buf_mpmc *buf, uint32_t size,
+			struct ring_buf_mpmc_cell *cells);
+
+/**
+ * @brief Write a word to an MPMC ring buffer.
+ *
+ * Safe to call concurrently from any number of producers; never blocks
+ * and never spins on another context's progress.
+ *
+ * @param buf Address of ring buffer.
+ * @param data Word to write (typically a pointer to a message).
+ *
+ * @retval 0 Data written.
+ * @retval -ENOSPC Ring buffer full.
+ */
+int ring_buf_mpmc_put(struct ring_buf_mpmc *buf, uintptr_t data);
+
+/**
+ * @brief Read a word from an MPMC ring buffer.
+ *
+ * Safe to call concurrently from any number of consumers.  Words are
+ * returned in the order their producers claimed slots.
+ *
+ * @param buf Address of ring buffer.
+ * @param data Output location for the word read.
+ *
+ * @retval 0 Data read.
+ * @retval -EAGAIN Ring buffer empty.
+ */
+int ring_buf_mpmc_get(struct ring_buf_mpmc *buf, uintptr_t *data);
+
 /**
  * @}
  */
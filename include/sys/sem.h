@@ -110,6 +110,24 @@ int sys_sem_init(struct sys_sem *sem, unsigned int initial_count,
  */
 int sys_sem_give(struct sys_sem *sem);
 
+/**
+ * @brief Give a semaphore multiple times.
+ *
+ * This routine gives @a sem @a count times as a single operation, waking
+ * waiters with at most one kernel entry instead of one per give. Use it
+ * when a producer publishes a batch of items at once. Any gives beyond
+ * the maximum permitted count are discarded.
+ *
+ * @param sem Address of the semaphore.
+ * @param count Number of times to give the semaphore.
+ *
+ * @retval 0 Semaphore given.
+ * @retval -EINVAL Parameter address not recognized or count is zero.
+ * @retval -EACCES Caller does not have enough access.
+ * @retval -EAGAIN Count already at maximum permitted count.
+ */
+int sys_sem_give_count(struct sys_sem *sem, unsigned int count);
+
 /**
  * @brief Take a sys_sem.
  *
@@ -179,4 +179,26 @@ void sys_heap_stress(void *(*alloc)(void *arg, size_t bytes),
  */
 void sys_heap_dump(struct sys_heap *h);
 
+#ifdef CONFIG_SYS_HEAP_PROFILE
+
+/** @brief Dump recorded allocation statistics to the console
+ *
+ * Print one line per recorded allocating call site (identified by its
+ * return address), listing the number of allocations and frees plus
+ * the live and peak sampled byte counts, followed by drop counters if
+ * the fixed-size recording tables overflowed.  With a sampling ratio
+ * above one (CONFIG_SYS_HEAP_PROFILE_SAMPLE) the numbers are a
+ * statistical estimate.
+ */
+void sys_heap_profile_dump(void);
+
+/** @brief Clear recorded allocation statistics
+ *
+ * Discard all recorded call sites, live allocation records and drop
+ * counters, e.g. to profile a particular phase of execution.
+ */
+void sys_heap_profile_reset(void);
+
+#endif /* CONFIG_SYS_HEAP_PROFILE */
+
 #endif /* ZEPHYR_INCLUDE_SYS_SYS_HEAP_H_ */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_TIMING_TIMING_SCOPE_H_
+#define ZEPHYR_INCLUDE_TIMING_TIMING_SCOPE_H_
+
+#include <kernel.h>
+#include <timing/timing.h>
+
+/**
+ * @brief Scoped Timing Measurement APIs
+ * @defgroup timing_scope_api Scoped Timing APIs
+ * @ingroup timing_api
+ * @{
+ */
+
+/** Number of log2 histogram buckets per measurement site. */
+#define TIMING_SCOPE_NUM_BUCKETS 32
+
+/**
+ * @brief Histogram of cycle deltas gathered at one measurement site.
+ *
+ * Instances are registered at compile time by TIMING_SCOPE() and
+ * gathered into an iterable section; they are not created directly.
+ */
+struct timing_scope {
+	/** Site name, as given to TIMING_SCOPE(). */
+	const char *name;
+
+	/** Total number of recorded deltas. */
+	uint32_t count;
+
+	/** Sum of all recorded deltas, in cycles. */
+	uint64_t total_cycles;
+
+	/** Largest recorded delta, in cycles. */
+	uint64_t max_cycles;
+
+	/**
+	 * Per-CPU hit counts; bucket N counts deltas whose highest set
+	 * bit is bit N, i.e. deltas in [2^N, 2^(N+1)).  Bucket 0 also
+	 * counts zero-cycle deltas, and deltas too large for the last
+	 * bucket are clamped into it.
+	 */
+	uint32_t hits[CONFIG_MP_NUM_CPUS][TIMING_SCOPE_NUM_BUCKETS];
+};
+
+#ifdef CONFIG_TIMING_SCOPE
+
+/**
+ * @brief Measure the cycle count of the statement that follows.
+ *
+ * Prefix a statement (typically a braced block) to record the number of
+ * timing cycles it takes into a histogram registered for this site:
+ *
+ *     TIMING_SCOPE(rx_handler) {
+ *             process_packet(pkt);
+ *     }
+ *
+ * The per-site bookkeeping on the hot path is one counter read before
+ * the statement and one read plus a histogram update after it; the
+ * update only locks out interrupts on the local CPU.  Recorded
+ * histograms can be printed with the "timing_scope" shell command or
+ * walked with timing_scope_foreach().
+ *
+ * @param scope_name Site name; also used as part of an identifier, so
+ *                   it must be a plain token unique within the function.
+ */
+#define TIMING_SCOPE(scope_name)					    \
+	static Z_STRUCT_SECTION_ITERABLE(timing_scope,			    \
+					 _timing_scope_##scope_name) = {    \
+		.name = STRINGIFY(scope_name),				    \
+	};								    \
+	for (timing_t _scope_start = timing_counter_get(), _scope_once = 0; \
+	     !_scope_once;						    \
+	     timing_scope_record(&_timing_scope_##scope_name,		    \
+				 _scope_start),				    \
+	     _scope_once = 1)
+
+#else
+
+#define TIMING_SCOPE(scope_name)
+
+#endif /* CONFIG_TIMING_SCOPE */
+
+/**
+ * @brief Record one delta into a measurement site histogram.
+ *
+ * Called by TIMING_SCOPE() on scope exit; may also be used directly
+ * when the measured region does not nest as a statement.
+ *
+ * @param scope Measurement site to update.
+ * @param start Counter value sampled at the start of the region.
+ */
+void timing_scope_record(struct timing_scope *scope, timing_t start);
+
+/**
+ * @brief Zero the histograms of all registered measurement sites.
+ */
+void timing_scope_reset(void);
+
+/**
+ * @brief Invoke a callback for each registered measurement site.
+ *
+ * @param cb Callback invoked with each site and @p user_data.
+ * @param user_data Context passed to the callback.
+ */
+void timing_scope_foreach(void (*cb)(const struct timing_scope *scope,
+				     void *user_data),
+			  void *user_data);
+
+/**
+ * @}
+ */
+#endif /* ZEPHYR_INCLUDE_TIMING_TIMING_SCOPE_H_ */
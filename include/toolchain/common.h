@@ -215,4 +215,15 @@
 		iterator < _CONCAT(_##struct_type, _list_end); }); \
 	     iterator++)
 
+/* Curated hot-path placement: when CONFIG_HOT_CODE_PLACEMENT is enabled
+ * the annotated function is linked into the fast code memory of the SoC
+ * (ITCM/SRAM) through the .ramfunc machinery; otherwise the annotation
+ * is a no-op and the function stays where it is.
+ */
+#ifdef CONFIG_HOT_CODE_PLACEMENT
+#define __hot_code __ramfunc
+#else
+#define __hot_code
+#endif
+
 #endif /* ZEPHYR_INCLUDE_TOOLCHAIN_COMMON_H_ */
@@ -25,6 +25,9 @@
 #elif defined CONFIG_TRACING_CPU_STATS
 #include "tracing_cpu_stats.h"
 
+#elif defined CONFIG_TRACING_THREAD_PROFILER
+#include "tracing_thread_profiler.h"
+
 #elif defined CONFIG_TRACING_CTF
 #include "tracing_ctf.h"
 
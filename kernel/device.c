@@ -25,12 +25,295 @@ extern const struct device __device_end[];
 
 extern uint32_t __device_init_status_start[];
 
+#ifdef CONFIG_DEVICE_NAME_HASH
+extern uint32_t __device_name_hash_start[];
+
+static bool device_name_hashes_ready;
+
+/* djb2 string hash */
+static uint32_t device_name_hash(const char *name)
+{
+	uint32_t hash = 5381U;
+
+	while (*name != '\0') {
+		hash = (hash * 33U) + (uint8_t)*name++;
+	}
+
+	return hash;
+}
+
+/* Device names are in ROM, so the hashes are computed once, on the
+ * first lookup that gets past the pointer comparison fast path. A
+ * concurrent first lookup recomputes the same values, which is
+ * harmless.
+ */
+static void device_name_hashes_compute(void)
+{
+	const struct device *dev;
+
+	for (dev = __device_start; dev != __device_end; dev++) {
+		__device_name_hash_start[dev - __device_start] =
+			device_name_hash(dev->name);
+	}
+
+	device_name_hashes_ready = true;
+}
+#endif /* CONFIG_DEVICE_NAME_HASH */
+
+#ifdef CONFIG_DEVICE_INIT_TIMING
+extern uint32_t __device_init_time_start[];
+#endif
+
+#ifdef CONFIG_BOOT_TIME_LOG
+static struct init_time_record init_time_log[CONFIG_BOOT_TIME_LOG_SIZE];
+static atomic_t init_time_log_count;
+static uint8_t init_time_level;
+
+size_t init_time_log_get(const struct init_time_record **records)
+{
+	*records = init_time_log;
+	return MIN((size_t)atomic_get(&init_time_log_count),
+		   ARRAY_SIZE(init_time_log));
+}
+
+/* The atomic claim keeps records intact when PARALLEL_SYS_INIT workers
+ * finish entries concurrently.
+ */
+static void init_time_log_add(const struct init_entry *entry,
+			      uint32_t start, uint32_t duration)
+{
+	atomic_val_t idx = atomic_inc(&init_time_log_count);
+
+	if (idx >= (atomic_val_t)ARRAY_SIZE(init_time_log)) {
+		return;
+	}
+
+	init_time_log[idx].entry = entry;
+	init_time_log[idx].start = start;
+	init_time_log[idx].duration = duration;
+	init_time_log[idx].level = init_time_level;
+}
+#endif /* CONFIG_BOOT_TIME_LOG */
+
+#ifdef CONFIG_DEVICE_DEFERRED_INIT
+extern const struct init_entry __init_DEFERRED_start[];
+extern const struct init_entry __init_DEFERRED_end[];
+extern uint32_t __device_deferred_started[];
+extern uint32_t __device_deferred_done[];
+#endif
+
 #ifdef CONFIG_DEVICE_POWER_MANAGEMENT
 extern uint32_t __device_busy_start[];
 extern uint32_t __device_busy_end[];
 #define DEVICE_BUSY_SIZE (__device_busy_end - __device_busy_start)
 #endif
 
+/**
+ * @brief Execute a single init entry and record the outcome
+ *
+ * @param entry init entry to run.
+ */
+static void z_sys_init_run_entry(const struct init_entry *entry)
+{
+	const struct device *dev = entry->dev;
+	int rc;
+#if defined(CONFIG_DEVICE_INIT_TIMING) || defined(CONFIG_BOOT_TIME_LOG)
+	uint32_t start;
+	uint32_t elapsed;
+#endif
+
+	if (dev != NULL) {
+		z_object_init(dev);
+	}
+
+#if defined(CONFIG_DEVICE_INIT_TIMING) || defined(CONFIG_BOOT_TIME_LOG)
+	start = k_cycle_get_32();
+#endif
+	rc = entry->init(dev);
+#if defined(CONFIG_DEVICE_INIT_TIMING) || defined(CONFIG_BOOT_TIME_LOG)
+	elapsed = k_cycle_get_32() - start;
+#endif
+#ifdef CONFIG_DEVICE_INIT_TIMING
+	if (dev != NULL) {
+		__device_init_time_start[dev - __device_start] = elapsed;
+	}
+#endif
+#ifdef CONFIG_BOOT_TIME_LOG
+	init_time_log_add(entry, start, elapsed);
+#endif
+
+	if ((rc != 0) && (dev != NULL)) {
+		/* Initialization failed.
+		 * Set the init status bit so device is not declared ready.
+		 */
+#ifdef CONFIG_PARALLEL_SYS_INIT
+		/* Workers may set other bits of the same word concurrently,
+		 * so the atomic variant is required here.
+		 */
+		atomic_set_bit((atomic_t *)__device_init_status_start,
+			       (dev - __device_start));
+#else
+		sys_bitfield_set_bit(
+			(mem_addr_t) __device_init_status_start,
+			(dev - __device_start));
+#endif
+	}
+}
+
+#ifdef CONFIG_PARALLEL_SYS_INIT
+static K_KERNEL_STACK_ARRAY_DEFINE(pinit_stacks,
+				   CONFIG_PARALLEL_SYS_INIT_THREADS - 1,
+				   CONFIG_PARALLEL_SYS_INIT_STACK_SIZE);
+static struct k_thread pinit_threads[CONFIG_PARALLEL_SYS_INIT_THREADS - 1];
+
+static const struct init_entry *pinit_group;
+static atomic_val_t pinit_count;
+static atomic_t pinit_next;
+
+static void pinit_claim(void)
+{
+	atomic_val_t idx;
+
+	while ((idx = atomic_inc(&pinit_next)) < pinit_count) {
+		z_sys_init_run_entry(&pinit_group[idx]);
+	}
+}
+
+static void pinit_worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	pinit_claim();
+}
+
+/**
+ * @brief Execute a group of same-priority init entries concurrently
+ *
+ * @details Entries sharing a level and priority have no defined ordering
+ * between them, so they may run in parallel. The calling thread acts as
+ * one of the workers; extra workers are created per group and joined
+ * before the function returns, so the ordering guarantee across priority
+ * groups is preserved.
+ *
+ * @param first first entry of the group.
+ * @param last entry one past the end of the group.
+ */
+static void z_sys_init_run_group(const struct init_entry *first,
+				 const struct init_entry *last)
+{
+	atomic_val_t count = last - first;
+	int nworkers;
+	int i;
+
+	if (count < 2) {
+		z_sys_init_run_entry(first);
+		return;
+	}
+
+	pinit_group = first;
+	pinit_count = count;
+	atomic_set(&pinit_next, 0);
+
+	nworkers = MIN(count, CONFIG_PARALLEL_SYS_INIT_THREADS) - 1;
+
+	for (i = 0; i < nworkers; i++) {
+		k_thread_create(&pinit_threads[i], pinit_stacks[i],
+				K_KERNEL_STACK_SIZEOF(pinit_stacks[i]),
+				pinit_worker, NULL, NULL, NULL,
+				k_thread_priority_get(k_current_get()),
+				0, K_NO_WAIT);
+	}
+
+	pinit_claim();
+
+	for (i = 0; i < nworkers; i++) {
+		(void)k_thread_join(&pinit_threads[i], K_FOREVER);
+	}
+}
+#endif /* CONFIG_PARALLEL_SYS_INIT */
+
+#ifdef CONFIG_DEVICE_DEFERRED_INIT
+/**
+ * @brief Run a DEFERRED init entry exactly once
+ *
+ * @details The context that claims the started bit runs the init function
+ * and then sets the done bit; any context that loses the race waits for
+ * the done bit instead, so callers never see a partially initialized
+ * device.
+ *
+ * @param entry deferred init entry to run.
+ *
+ * @return 0 if the device is ready, -EIO if its init function failed.
+ */
+static int z_device_deferred_run(const struct init_entry *entry)
+{
+	const struct device *dev = entry->dev;
+	unsigned int idx = dev - __device_start;
+
+	if (!atomic_test_and_set_bit((atomic_t *)__device_deferred_started,
+				     idx)) {
+#ifdef CONFIG_DEVICE_INIT_TIMING
+		uint32_t start = k_cycle_get_32();
+#endif
+		z_object_init(dev);
+		if (entry->init(dev) == 0) {
+			/* The not-ready bit was pre-set at boot. */
+			atomic_clear_bit((atomic_t *)__device_init_status_start,
+					 idx);
+		}
+#ifdef CONFIG_DEVICE_INIT_TIMING
+		__device_init_time_start[idx] = k_cycle_get_32() - start;
+#endif
+		atomic_set_bit((atomic_t *)__device_deferred_done, idx);
+	} else {
+		while (!atomic_test_bit((atomic_t *)__device_deferred_done,
+					idx)) {
+			if (k_is_pre_kernel() || k_is_in_isr()) {
+				k_busy_wait(1);
+			} else {
+				k_yield();
+			}
+		}
+	}
+
+	return z_device_ready(dev) ? 0 : -EIO;
+}
+
+int device_deferred_init(const struct device *dev)
+{
+	const struct init_entry *entry;
+
+	for (entry = __init_DEFERRED_start; entry < __init_DEFERRED_end;
+	     entry++) {
+		if (entry->dev == dev) {
+			return z_device_deferred_run(entry);
+		}
+	}
+
+	return -ENXIO;
+}
+
+static const struct device *z_device_deferred_get(const char *name)
+{
+	const struct init_entry *entry;
+
+	for (entry = __init_DEFERRED_start; entry < __init_DEFERRED_end;
+	     entry++) {
+		const struct device *dev = entry->dev;
+
+		if ((dev != NULL) &&
+		    ((dev->name == name) || (strcmp(name, dev->name) == 0))) {
+			return (z_device_deferred_run(entry) == 0) ?
+				dev : NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_DEVICE_DEFERRED_INIT */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -57,21 +340,47 @@ void z_sys_init_run_level(int32_t level)
 	};
 	const struct init_entry *entry;
 
-	for (entry = levels[level]; entry < levels[level+1]; entry++) {
-		const struct device *dev = entry->dev;
+#ifdef CONFIG_BOOT_TIME_LOG
+	init_time_level = level;
+#endif
 
-		if (dev != NULL) {
-			z_object_init(dev);
+#ifdef CONFIG_DEVICE_DEFERRED_INIT
+	if (level == _SYS_INIT_LEVEL_PRE_KERNEL_1) {
+		/* Deferred devices are not ready until their first use. */
+		for (entry = __init_DEFERRED_start; entry < __init_DEFERRED_end;
+		     entry++) {
+			if (entry->dev != NULL) {
+				sys_bitfield_set_bit(
+					(mem_addr_t) __device_init_status_start,
+					(entry->dev - __device_start));
+			}
 		}
+	}
+#endif
+
+#ifdef CONFIG_PARALLEL_SYS_INIT
+	/* The scheduler is up from POST_KERNEL onwards, so independent
+	 * entries within a priority group can be dispatched to workers.
+	 */
+	if (level >= _SYS_INIT_LEVEL_POST_KERNEL) {
+		entry = levels[level];
+		while (entry < levels[level+1]) {
+			const struct init_entry *group_end = entry + 1;
 
-		if ((entry->init(dev) != 0) && (dev != NULL)) {
-			/* Initialization failed.
-			 * Set the init status bit so device is not declared ready.
-			 */
-			sys_bitfield_set_bit(
-				(mem_addr_t) __device_init_status_start,
-				(dev - __device_start));
+			while ((group_end < levels[level+1]) &&
+			       (group_end->prio == entry->prio)) {
+				group_end++;
+			}
+
+			z_sys_init_run_group(entry, group_end);
+			entry = group_end;
 		}
+		return;
+	}
+#endif
+
+	for (entry = levels[level]; entry < levels[level+1]; entry++) {
+		z_sys_init_run_entry(entry);
 	}
 }
 
@@ -90,13 +399,34 @@ const struct device *z_impl_device_get_binding(const char *name)
 		}
 	}
 
+#ifdef CONFIG_DEVICE_NAME_HASH
+	uint32_t hash;
+
+	if (!device_name_hashes_ready) {
+		device_name_hashes_compute();
+	}
+
+	hash = device_name_hash(name);
+
+	for (dev = __device_start; dev != __device_end; dev++) {
+		if ((__device_name_hash_start[dev - __device_start] == hash) &&
+		    z_device_ready(dev) && (strcmp(name, dev->name) == 0)) {
+			return dev;
+		}
+	}
+#else
 	for (dev = __device_start; dev != __device_end; dev++) {
 		if (z_device_ready(dev) && (strcmp(name, dev->name) == 0)) {
 			return dev;
 		}
 	}
+#endif
 
+#ifdef CONFIG_DEVICE_DEFERRED_INIT
+	return z_device_deferred_get(name);
+#else
 	return NULL;
+#endif
 }
 
 #ifdef CONFIG_USERSPACE
@@ -120,6 +450,13 @@ size_t z_device_get_all_static(struct device const **devices)
 	return __device_end - __device_start;
 }
 
+#ifdef CONFIG_DEVICE_INIT_TIMING
+uint32_t device_init_time_get(const struct device *dev)
+{
+	return __device_init_time_start[dev - __device_start];
+}
+#endif
+
 bool z_device_ready(const struct device *dev)
 {
 	/* Set bit indicates device failed initialization */
@@ -74,6 +74,24 @@ int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+	/* A futex carries no owner identity, so instead of checking the
+	 * holder's thread state the value itself is probed: if another
+	 * CPU changes it within the spin budget, the caller can retry
+	 * its acquire path without ever pending.  The locked comparison
+	 * below remains authoritative.
+	 */
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		for (int i = 0; i < CONFIG_ADAPTIVE_SPIN_COUNT; i++) {
+			if (atomic_get(&futex->val) !=
+			    (atomic_val_t)expected) {
+				return -EAGAIN;
+			}
+			arch_nop();
+		}
+	}
+#endif
+
 	key = k_spin_lock(&futex_data->lock);
 
 	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief High-resolution sub-tick timers
+ *
+ * Pending timers are kept in a list ordered by expiry point; the timer
+ * driver's hires alarm comparator is always programmed for the head.
+ * All cycle comparisons are done as signed 32-bit differences so the
+ * free-running counter may wrap at any point.
+ */
+
+#include <kernel.h>
+#include <spinlock.h>
+#include <sys/dlist.h>
+#include <sys/hires_timer.h>
+#include <drivers/timer/system_timer.h>
+
+static struct k_spinlock lock;
+static sys_dlist_t pending = SYS_DLIST_STATIC_INIT(&pending);
+
+static inline int32_t cycles_until(uint32_t target)
+{
+	return (int32_t)(target - k_cycle_get_32());
+}
+
+/* Reprogram the driver alarm for the current head; call with the lock
+ * held.
+ */
+static void program_alarm(void)
+{
+	sys_dnode_t *head = sys_dlist_peek_head(&pending);
+
+	if (head == NULL) {
+		z_clock_hires_alarm_cancel();
+	} else {
+		z_clock_hires_alarm_set(
+			CONTAINER_OF(head, struct k_hires_timer, node)->target);
+	}
+}
+
+void k_hires_timer_init(struct k_hires_timer *timer,
+			k_hires_timer_expiry_t expiry_fn)
+{
+	sys_dnode_init(&timer->node);
+	timer->expiry_fn = expiry_fn;
+	timer->user_data = NULL;
+}
+
+void k_hires_timer_start(struct k_hires_timer *timer, uint32_t delay_us)
+{
+	uint32_t target = k_cycle_get_32() +
+		(uint32_t)(((uint64_t)delay_us *
+			    sys_clock_hw_cycles_per_sec()) / USEC_PER_SEC);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_hires_timer *pos;
+	bool inserted = false;
+
+	if (sys_dnode_is_linked(&timer->node)) {
+		sys_dlist_remove(&timer->node);
+	}
+	timer->target = target;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&pending, pos, node) {
+		if ((int32_t)(pos->target - target) > 0) {
+			sys_dlist_insert(&pos->node, &timer->node);
+			inserted = true;
+			break;
+		}
+	}
+	if (!inserted) {
+		sys_dlist_append(&pending, &timer->node);
+	}
+
+	if (sys_dlist_peek_head(&pending) == &timer->node) {
+		program_alarm();
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+bool k_hires_timer_stop(struct k_hires_timer *timer)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	bool was_pending = sys_dnode_is_linked(&timer->node);
+
+	if (was_pending) {
+		bool was_head =
+			sys_dlist_peek_head(&pending) == &timer->node;
+
+		sys_dlist_remove(&timer->node);
+		if (was_head) {
+			program_alarm();
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return was_pending;
+}
+
+uint32_t k_hires_timer_remaining_us(const struct k_hires_timer *timer)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int32_t cycles = 0;
+
+	if (sys_dnode_is_linked(&timer->node)) {
+		cycles = cycles_until(timer->target);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (cycles <= 0) {
+		return 0;
+	}
+
+	return (uint32_t)(((uint64_t)cycles * USEC_PER_SEC) /
+			  sys_clock_hw_cycles_per_sec());
+}
+
+void z_hires_timer_expire(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_peek_head(&pending)) != NULL) {
+		struct k_hires_timer *timer =
+			CONTAINER_OF(node, struct k_hires_timer, node);
+
+		if (cycles_until(timer->target) > 0) {
+			break;
+		}
+
+		sys_dlist_remove(node);
+
+		/* Expiry functions may start or stop timers; drop the
+		 * lock while they run.
+		 */
+		k_spin_unlock(&lock, key);
+		timer->expiry_fn(timer);
+		key = k_spin_lock(&lock);
+	}
+
+	program_alarm();
+	k_spin_unlock(&lock, key);
+}
@@ -61,6 +61,7 @@ void z_time_slice(int ticks);
 void z_reset_time_slice(void);
 void z_sched_abort(struct k_thread *thread);
 void z_sched_ipi(void);
+void z_signal_pending_ipi(void);
 void z_sched_start(struct k_thread *thread);
 void z_ready_thread(struct k_thread *thread);
 void z_thread_single_abort(struct k_thread *thread);
@@ -135,6 +136,20 @@ static inline bool z_is_thread_ready(struct k_thread *thread)
 		 z_is_thread_timeout_active(thread));
 }
 
+static inline bool z_is_thread_running(struct k_thread *thread)
+{
+#ifdef CONFIG_SMP
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (_kernel.cpus[i].current == thread) {
+			return true;
+		}
+	}
+	return false;
+#else
+	return thread == _current;
+#endif
+}
+
 static inline bool z_has_thread_started(struct k_thread *thread)
 {
 	return (thread->base.thread_state & _THREAD_PRESTART) == 0U;
@@ -85,6 +85,8 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 	new_thread = z_get_next_ready_thread();
 
+	z_signal_pending_ipi();
+
 #ifdef CONFIG_SMP
 	if (new_thread == old_thread) {
 		*shp = old_thread;
@@ -21,25 +21,24 @@
 
 #if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
 
-/* asynchronous message descriptor type */
-struct k_mbox_async {
-	struct _thread_base thread;		/* dummy thread object */
-	struct k_mbox_msg tx_msg;	/* transmit message descriptor */
-};
-
-/* stack of unused asynchronous message descriptors */
+/* stack of unused asynchronous message descriptors shared by all mailboxes */
 K_STACK_DEFINE(async_msg_free, CONFIG_NUM_MBOX_ASYNC_MSGS);
 
 /* allocate an asynchronous message descriptor */
-static inline void mbox_async_alloc(struct k_mbox_async **async)
+static inline void mbox_async_alloc(struct k_mbox *mbox,
+				    struct k_mbox_async **async)
 {
-	(void)k_stack_pop(&async_msg_free, (stack_data_t *)async, K_FOREVER);
+	struct k_stack *pool = (mbox->async_pool != NULL) ?
+			       mbox->async_pool : &async_msg_free;
+
+	(void)k_stack_pop(pool, (stack_data_t *)async, K_FOREVER);
+	(*async)->pool = pool;
 }
 
 /* free an asynchronous message descriptor */
 static inline void mbox_async_free(struct k_mbox_async *async)
 {
-	k_stack_push(&async_msg_free, (stack_data_t)async);
+	k_stack_push(async->pool, (stack_data_t)async);
 }
 
 #endif /* CONFIG_NUM_MBOX_ASYNC_MSGS > 0 */
@@ -102,9 +101,28 @@ void k_mbox_init(struct k_mbox *mbox_ptr)
 	z_waitq_init(&mbox_ptr->tx_msg_queue);
 	z_waitq_init(&mbox_ptr->rx_msg_queue);
 	mbox_ptr->lock = (struct k_spinlock) {};
+#if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
+	mbox_ptr->async_pool = NULL;
+#endif
 	SYS_TRACING_OBJ_INIT(k_mbox, mbox_ptr);
 }
 
+#if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
+void k_mbox_async_pool_init(struct k_mbox *mbox, struct k_stack *pool,
+			    struct k_mbox_async *msgs, uint32_t num_msgs)
+{
+	uint32_t i;
+
+	/* descriptors use the same dummy thread setup as the shared pool */
+	for (i = 0; i < num_msgs; i++) {
+		z_init_thread_base(&msgs[i].thread, 0, _THREAD_DUMMY, 0);
+		k_stack_push(pool, (stack_data_t)&msgs[i]);
+	}
+
+	mbox->async_pool = pool;
+}
+#endif
+
 /**
  * @brief Check compatibility of sender's and receiver's message descriptors.
  *
@@ -144,10 +162,16 @@ static int mbox_message_match(struct k_mbox_msg *tx_msg,
 		/* update data location fields for receiver only */
 		rx_msg->tx_data = tx_msg->tx_data;
 		rx_msg->tx_block = tx_msg->tx_block;
+		rx_msg->tx_sg = NULL;
+		rx_msg->tx_sg_count = 0;
 		if (rx_msg->tx_data != NULL) {
 			rx_msg->tx_block.data = NULL;
 		} else if (rx_msg->tx_block.data != NULL) {
 			rx_msg->tx_data = rx_msg->tx_block.data;
+		} else if (tx_msg->size > 0) {
+			/* data supplied as scatter-gather region list */
+			rx_msg->tx_sg = tx_msg->tx_sg;
+			rx_msg->tx_sg_count = tx_msg->tx_sg_count;
 		} else {
 			/* no data */
 		}
@@ -202,8 +226,13 @@ static void mbox_message_dispose(struct k_mbox_msg *rx_msg)
 	 */
 	if ((sending_thread->base.thread_state & _THREAD_DUMMY) != 0U) {
 		struct k_sem *async_sem = tx_msg->_async_sem;
+		k_mbox_async_cb_t async_cb = tx_msg->_async_cb;
+		void *async_cb_data = tx_msg->_async_cb_data;
 
 		mbox_async_free((struct k_mbox_async *)sending_thread);
+		if (async_cb != NULL) {
+			async_cb(async_cb_data);
+		}
 		if (async_sem != NULL) {
 			k_sem_give(async_sem);
 		}
@@ -314,8 +343,10 @@ int k_mbox_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
 }
 
 #if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
-void k_mbox_async_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
-		      struct k_sem *sem)
+/* common handling for both flavors of asynchronous send */
+static void mbox_async_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
+			   struct k_sem *sem, k_mbox_async_cb_t cb,
+			   void *user_data)
 {
 	struct k_mbox_async *async;
 
@@ -323,16 +354,30 @@ void k_mbox_async_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
 	 * allocate an asynchronous message descriptor, configure both parts,
 	 * then send the message asynchronously
 	 */
-	mbox_async_alloc(&async);
+	mbox_async_alloc(mbox, &async);
 
 	async->thread.prio = _current->base.prio;
 
 	async->tx_msg = *tx_msg;
 	async->tx_msg._syncing_thread = (struct k_thread *)&async->thread;
 	async->tx_msg._async_sem = sem;
+	async->tx_msg._async_cb = cb;
+	async->tx_msg._async_cb_data = user_data;
 
 	(void)mbox_message_put(mbox, &async->tx_msg, K_FOREVER);
 }
+
+void k_mbox_async_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
+		      struct k_sem *sem)
+{
+	mbox_async_put(mbox, tx_msg, sem, NULL, NULL);
+}
+
+void k_mbox_async_put_cb(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
+			 k_mbox_async_cb_t cb, void *user_data)
+{
+	mbox_async_put(mbox, tx_msg, NULL, cb, user_data);
+}
 #endif
 
 void k_mbox_data_get(struct k_mbox_msg *rx_msg, void *buffer)
@@ -347,6 +392,22 @@ void k_mbox_data_get(struct k_mbox_msg *rx_msg, void *buffer)
 	/* copy message data to buffer, then dispose of message */
 	if ((rx_msg->tx_data != NULL) && (rx_msg->size > 0)) {
 		(void)memcpy(buffer, rx_msg->tx_data, rx_msg->size);
+	} else if ((rx_msg->tx_sg != NULL) && (rx_msg->size > 0)) {
+		/* gather the sender's scatter-gather regions, in order */
+		uint8_t *dest = buffer;
+		size_t remaining = rx_msg->size;
+		uint32_t i;
+
+		for (i = 0; (i < rx_msg->tx_sg_count) && (remaining > 0);
+		     i++) {
+			size_t bytes = MIN(rx_msg->tx_sg[i].len, remaining);
+
+			(void)memcpy(dest, rx_msg->tx_sg[i].data, bytes);
+			dest += bytes;
+			remaining -= bytes;
+		}
+	} else {
+		/* no data */
 	}
 	mbox_message_dispose(rx_msg);
 }
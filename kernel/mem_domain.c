@@ -105,6 +105,10 @@ void k_mem_domain_init(struct k_mem_domain *domain, uint8_t num_parts,
 	domain->num_partitions = 0U;
 	(void)memset(domain->partitions, 0, sizeof(domain->partitions));
 	sys_dlist_init(&domain->mem_domain_q);
+	/* Never reset to zero so that re-initializing a domain also
+	 * invalidates any cached view of its previous contents.
+	 */
+	domain->generation++;
 
 #ifdef CONFIG_ARCH_MEM_DOMAIN_DATA
 	int ret = arch_mem_domain_init(domain);
@@ -168,6 +172,7 @@ void k_mem_domain_add_partition(struct k_mem_domain *domain,
 	domain->partitions[p_idx].attr = part->attr;
 
 	domain->num_partitions++;
+	domain->generation++;
 
 #ifdef CONFIG_ARCH_MEM_DOMAIN_SYNCHRONOUS_API
 	arch_mem_domain_partition_add(domain, p_idx);
@@ -207,6 +212,7 @@ void k_mem_domain_remove_partition(struct k_mem_domain *domain,
 	domain->partitions[p_idx].size = 0U;
 
 	domain->num_partitions--;
+	domain->generation++;
 
 	k_spin_unlock(&z_mem_domain_lock, key);
 }
@@ -21,6 +21,55 @@ static struct k_spinlock lock;
 struct k_mem_slab *_trace_list_k_mem_slab;
 #endif	/* CONFIG_OBJECT_TRACING */
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+/* The free list head is a single atomic word holding a block index in
+ * the low half and a modification counter in the high half.  The
+ * counter is bumped on every update, so a pop whose head block was
+ * popped and pushed back again while the next link was being read
+ * still fails its compare-and-swap (the classic ABA case).  Free
+ * blocks store the index of the next free block in their first word.
+ */
+#define SLAB_END_MARKER	0xFFFFU
+#define SLAB_IDX(head)	((uint32_t)(head) & 0xFFFFU)
+#define SLAB_TAG_INC	0x10000U
+
+static inline char *slab_block(struct k_mem_slab *slab, uint32_t idx)
+{
+	return slab->buffer + idx * slab->block_size;
+}
+
+static void *slab_pop(struct k_mem_slab *slab)
+{
+	uint32_t old, idx, next;
+
+	do {
+		old = (uint32_t)atomic_get(&slab->free_head);
+		idx = SLAB_IDX(old);
+		if (idx == SLAB_END_MARKER) {
+			return NULL;
+		}
+		next = *(uint32_t *)slab_block(slab, idx);
+	} while (!atomic_cas(&slab->free_head, (atomic_val_t)old,
+			     (atomic_val_t)(((old + SLAB_TAG_INC) &
+					     0xFFFF0000U) | next)));
+
+	return slab_block(slab, idx);
+}
+
+static void slab_push(struct k_mem_slab *slab, char *mem)
+{
+	uint32_t idx = (uint32_t)((mem - slab->buffer) / slab->block_size);
+	uint32_t old;
+
+	do {
+		old = (uint32_t)atomic_get(&slab->free_head);
+		*(uint32_t *)mem = SLAB_IDX(old);
+	} while (!atomic_cas(&slab->free_head, (atomic_val_t)old,
+			     (atomic_val_t)(((old + SLAB_TAG_INC) &
+					     0xFFFF0000U) | idx)));
+}
+#endif /* CONFIG_MEM_SLAB_LOCKFREE */
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -40,6 +89,22 @@ static int create_free_list(struct k_mem_slab *slab)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	/* block indexes must fit in the low half of the head word */
+	CHECKIF(slab->num_blocks >= SLAB_END_MARKER) {
+		return -EINVAL;
+	}
+
+	p = slab->buffer;
+	for (j = 0U; j < slab->num_blocks; j++) {
+		*(uint32_t *)p = (j == slab->num_blocks - 1U) ?
+				 SLAB_END_MARKER : (j + 1U);
+		p += slab->block_size;
+	}
+	atomic_set(&slab->free_head,
+		   (slab->num_blocks > 0U) ? 0 : SLAB_END_MARKER);
+	atomic_set(&slab->num_waiters, 0);
+#else
 	slab->free_list = NULL;
 	p = slab->buffer;
 
@@ -48,6 +113,7 @@ static int create_free_list(struct k_mem_slab *slab)
 		slab->free_list = p;
 		p += slab->block_size;
 	}
+#endif
 	return 0;
 }
 
@@ -101,6 +167,97 @@ out:
 	return rc;
 }
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	void *blk = slab_pop(slab);
+	k_spinlock_key_t key;
+	int result;
+
+	if (blk != NULL) {
+		*mem = blk;
+		(void)atomic_inc(&slab->num_used);
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for a free block to become available */
+		*mem = NULL;
+		return -ENOMEM;
+	}
+
+	/* Slab looks exhausted; fall back to the wait queue.  The
+	 * waiter count must be bumped before the pop is retried so a
+	 * concurrent free either refills the list in time for the
+	 * retry or sees the waiter and hands its block off under the
+	 * lock.
+	 */
+	(void)atomic_inc(&slab->num_waiters);
+
+	key = k_spin_lock(&lock);
+
+	blk = slab_pop(slab);
+	if (blk != NULL) {
+		(void)atomic_dec(&slab->num_waiters);
+		k_spin_unlock(&lock, key);
+		*mem = blk;
+		(void)atomic_inc(&slab->num_used);
+		return 0;
+	}
+
+	/* wait for a free block or timeout */
+	result = z_pend_curr(&lock, key, &slab->wait_q, timeout);
+	(void)atomic_dec(&slab->num_waiters);
+	if (result == 0) {
+		*mem = _current->base.swap_data;
+	}
+	return result;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	void *blk;
+
+	slab_push(slab, *mem);
+	(void)atomic_dec(&slab->num_used);
+
+	if (atomic_get(&slab->num_waiters) == 0) {
+		return;
+	}
+
+	/* A thread is (or was about to start) waiting: pop a block
+	 * back off the list and hand it over directly.  Either pop can
+	 * come up empty if another allocator got there first; that
+	 * allocator consumed the block, so there is nothing left to
+	 * wake a waiter for.
+	 */
+	key = k_spin_lock(&lock);
+
+	blk = slab_pop(slab);
+	if (blk == NULL) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	pending_thread = z_unpend_first_thread(&slab->wait_q);
+	if (pending_thread == NULL) {
+		/* waiter timed out or was woken by an earlier free */
+		slab_push(slab, blk);
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	(void)atomic_inc(&slab->num_used);
+	z_thread_return_value_set_with_data(pending_thread, 0, blk);
+	z_ready_thread(pending_thread);
+	z_reschedule(&lock, key);
+}
+
+#else /* !CONFIG_MEM_SLAB_LOCKFREE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
 	k_spinlock_key_t key = k_spin_lock(&lock);
@@ -146,3 +303,5 @@ void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 		k_spin_unlock(&lock, key);
 	}
 }
+
+#endif /* CONFIG_MEM_SLAB_LOCKFREE */
@@ -66,6 +66,51 @@ static uint8_t *mapping_limit =
 	(uint8_t *)((uintptr_t)CONFIG_SRAM_BASE_ADDRESS +
 		    KB((size_t)CONFIG_SRAM_SIZE));
 
+void z_mem_reserve(uint8_t **virt_addr, size_t size)
+{
+	size_t aligned_size = ROUND_UP(size, CONFIG_MMU_PAGE_SIZE);
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&mm_lock);
+
+	/* Carve out some unused virtual memory from the top of the
+	 * address space, but leave it unmapped; pages are populated
+	 * later with z_mem_commit().
+	 */
+	if ((mapping_pos - aligned_size) < mapping_limit) {
+		k_spin_unlock(&mm_lock, key);
+		LOG_ERR("insufficient kernel virtual address space");
+		k_panic();
+	}
+	mapping_pos -= aligned_size;
+	*virt_addr = mapping_pos;
+
+	k_spin_unlock(&mm_lock, key);
+}
+
+int z_mem_commit(uint8_t *virt_addr, uintptr_t phys_addr, size_t size,
+		 uint32_t flags)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	__ASSERT(((uintptr_t)virt_addr % CONFIG_MMU_PAGE_SIZE) == 0U,
+		 "unaligned virtual address %p", virt_addr);
+	__ASSERT((phys_addr % CONFIG_MMU_PAGE_SIZE) == 0U,
+		 "unaligned physical address 0x%lx", phys_addr);
+	__ASSERT((size % CONFIG_MMU_PAGE_SIZE) == 0U,
+		 "unaligned size %zu", size);
+
+	key = k_spin_lock(&mm_lock);
+	ret = arch_mem_map(virt_addr, phys_addr, size, flags);
+	k_spin_unlock(&mm_lock, key);
+
+	if (ret != 0) {
+		LOG_ERR("arch_mem_map() to %p returned %d", virt_addr, ret);
+	}
+	return ret;
+}
+
 size_t k_mem_region_align(uintptr_t *aligned_addr, size_t *aligned_size,
 			  uintptr_t phys_addr, size_t size, size_t align)
 {
@@ -127,9 +127,23 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 		/* message queue isn't full */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
 		if (pending_thread != NULL) {
-			/* give message to waiting thread */
-			(void)memcpy(pending_thread->base.swap_data, data,
-			       msgq->msg_size);
+			if (pending_thread->base.swap_data != NULL) {
+				/* give message to waiting thread */
+				(void)memcpy(pending_thread->base.swap_data,
+					     data, msgq->msg_size);
+			} else {
+				/* a k_msgq_peek_claim() waiter consumes
+				 * messages in place: queue the message,
+				 * then let the waiter claim it
+				 */
+				(void)memcpy(msgq->write_ptr, data,
+					     msgq->msg_size);
+				msgq->write_ptr += msgq->msg_size;
+				if (msgq->write_ptr == msgq->buffer_end) {
+					msgq->write_ptr = msgq->buffer_start;
+				}
+				msgq->used_msgs++;
+			}
 			/* wake up waiting thread */
 			arch_thread_return_value_set(pending_thread, 0);
 			z_ready_thread(pending_thread);
@@ -211,14 +225,20 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 		/* handle first thread waiting to write (if any) */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
 		if (pending_thread != NULL) {
-			/* add thread's message to queue */
-			(void)memcpy(msgq->write_ptr, pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
+			if (pending_thread->base.swap_data != NULL) {
+				/* add thread's message to queue */
+				(void)memcpy(msgq->write_ptr,
+				       pending_thread->base.swap_data,
+				       msgq->msg_size);
+				msgq->write_ptr += msgq->msg_size;
+				if (msgq->write_ptr == msgq->buffer_end) {
+					msgq->write_ptr = msgq->buffer_start;
+				}
+				msgq->used_msgs++;
 			}
-			msgq->used_msgs++;
+			/* else a k_msgq_reserve() waiter, which only
+			 * needs the slot freed above
+			 */
 
 			/* wake up waiting thread */
 			arch_thread_return_value_set(pending_thread, 0);
@@ -285,6 +305,179 @@ static inline int z_vrfy_k_msgq_peek(struct k_msgq *q, void *data)
 #include <syscalls/k_msgq_peek_mrsh.c>
 #endif
 
+int k_msgq_reserve(struct k_msgq *msgq, void **msg, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	int64_t now, end = z_timeout_end_calc(timeout);
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	while (msgq->used_msgs >= msgq->max_msgs) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			/* don't wait for message space to become available */
+			*msg = NULL;
+			k_spin_unlock(&msgq->lock, key);
+			return -ENOMSG;
+		}
+
+		now = z_tick_get();
+		if ((end - now) <= 0) {
+			k_spin_unlock(&msgq->lock, key);
+			return -EAGAIN;
+		}
+
+		/* a NULL swap_data marks this sender as a reserver: a
+		 * receiver freeing a slot wakes it instead of copying
+		 * a message out of it
+		 */
+		_current->base.swap_data = NULL;
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q,
+				     K_TICKS(end - now));
+		if (result != 0) {
+			return result;
+		}
+		key = k_spin_lock(&msgq->lock);
+	}
+
+	*msg = msgq->write_ptr;
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return 0;
+}
+
+void k_msgq_commit(struct k_msgq *msgq, void *msg)
+{
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+	struct k_thread *pending_thread;
+
+	__ASSERT(msg == msgq->write_ptr, "commit of a non-reserved slot");
+
+	/* any waiter can only be a receiver: reservation implies the
+	 * queue had room, and zero-copy senders are the only senders
+	 */
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (pending_thread != NULL &&
+	    pending_thread->base.swap_data != NULL) {
+		/* hand the message over directly, leaving the slot
+		 * free for the next reservation
+		 */
+		(void)memcpy(pending_thread->base.swap_data, msg,
+			     msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		z_reschedule(&msgq->lock, key);
+		return;
+	}
+
+	/* publish message in place */
+	msgq->write_ptr += msgq->msg_size;
+	if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs++;
+
+	if (pending_thread != NULL) {
+		/* wake a k_msgq_peek_claim() waiter to claim in place */
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		z_reschedule(&msgq->lock, key);
+		return;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+}
+
+int k_msgq_peek_claim(struct k_msgq *msgq, void **msg, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	int64_t now, end = z_timeout_end_calc(timeout);
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	while (msgq->used_msgs == 0U) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			/* don't wait for a message to become available */
+			*msg = NULL;
+			k_spin_unlock(&msgq->lock, key);
+			return -ENOMSG;
+		}
+
+		now = z_tick_get();
+		if ((end - now) <= 0) {
+			k_spin_unlock(&msgq->lock, key);
+			return -EAGAIN;
+		}
+
+		/* a NULL swap_data marks this receiver as a claimer:
+		 * senders queue their message instead of copying it
+		 * into the receive buffer
+		 */
+		_current->base.swap_data = NULL;
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q,
+				     K_TICKS(end - now));
+		if (result != 0) {
+			return result;
+		}
+		key = k_spin_lock(&msgq->lock);
+	}
+
+	*msg = msgq->read_ptr;
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return 0;
+}
+
+void k_msgq_release(struct k_msgq *msgq, void *msg)
+{
+	k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+	struct k_thread *pending_thread;
+
+	__ASSERT(msg == msgq->read_ptr, "release of an unclaimed message");
+	ARG_UNUSED(msg);
+
+	/* recycle the claimed slot */
+	msgq->read_ptr += msgq->msg_size;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs--;
+
+	/* handle first thread waiting to write (if any) */
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (pending_thread != NULL) {
+		if (pending_thread->base.swap_data != NULL) {
+			/* add thread's message to queue */
+			(void)memcpy(msgq->write_ptr,
+			       pending_thread->base.swap_data,
+			       msgq->msg_size);
+			msgq->write_ptr += msgq->msg_size;
+			if (msgq->write_ptr == msgq->buffer_end) {
+				msgq->write_ptr = msgq->buffer_start;
+			}
+			msgq->used_msgs++;
+		}
+		/* else a k_msgq_reserve() waiter, which only needs
+		 * the slot freed above
+		 */
+
+		/* wake up waiting thread */
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		z_reschedule(&msgq->lock, key);
+		return;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+}
+
 void z_impl_k_msgq_purge(struct k_msgq *msgq)
 {
 	k_spinlock_key_t key;
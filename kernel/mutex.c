@@ -127,6 +127,27 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 	sys_trace_mutex_lock(mutex);
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+	/* An owner actively running on another CPU will likely release
+	 * the mutex within a few hundred cycles, so probe a bounded
+	 * number of times before committing to a context switch.  The
+	 * subsystem lock is dropped between probes so the owner can get
+	 * through k_mutex_unlock().
+	 */
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		for (int i = 0; i < CONFIG_ADAPTIVE_SPIN_COUNT; i++) {
+			if ((mutex->lock_count == 0U) ||
+			    (mutex->owner == _current) ||
+			    !z_is_thread_running(mutex->owner)) {
+				break;
+			}
+			k_spin_unlock(&lock, key);
+			arch_nop();
+			key = k_spin_lock(&lock);
+		}
+	}
+#endif
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
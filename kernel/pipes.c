@@ -877,3 +877,172 @@ size_t z_vrfy_k_pipe_write_avail(struct k_pipe *pipe)
 }
 #include <syscalls/k_pipe_write_avail_mrsh.c>
 #endif
+
+/**
+ * @brief Contiguous free run at the pipe's write index
+ */
+static size_t pipe_write_run(struct k_pipe *pipe)
+{
+	return MIN(pipe->size - pipe->bytes_used,
+		   pipe->size - pipe->write_index);
+}
+
+/**
+ * @brief Contiguous data run at the pipe's read index
+ */
+static size_t pipe_read_run(struct k_pipe *pipe)
+{
+	return MIN(pipe->bytes_used, pipe->size - pipe->read_index);
+}
+
+size_t k_pipe_write_claim(struct k_pipe *pipe, void **data, size_t size)
+{
+	k_spinlock_key_t key;
+	size_t run;
+
+	if (pipe->buffer == NULL || pipe->size == 0U) {
+		*data = NULL;
+		return 0;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	run = MIN(size, pipe_write_run(pipe));
+	*data = (run > 0U) ? pipe->buffer + pipe->write_index : NULL;
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return run;
+}
+
+int k_pipe_write_finish(struct k_pipe *pipe, size_t size)
+{
+	struct k_thread *thread;
+	struct k_pipe_desc *desc;
+	sys_dlist_t ready_list;
+	size_t bytes_copied;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF(size > pipe_write_run(pipe)) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	/* publish the claimed bytes */
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index == pipe->size) {
+		pipe->write_index = 0;
+	}
+
+	/*
+	 * Feed blocked readers from the buffer.  As with k_pipe_put(),
+	 * a reader is only readied once its whole request is
+	 * satisfied; a partially filled one stays pended.
+	 */
+	sys_dlist_init(&ready_list);
+
+	while (pipe->bytes_used > 0U &&
+	       (thread = z_waitq_head(&pipe->wait_q.readers)) != NULL) {
+		desc = (struct k_pipe_desc *)thread->base.swap_data;
+		bytes_copied = pipe_buffer_get(pipe, desc->buffer,
+						desc->bytes_to_xfer);
+
+		desc->buffer        += bytes_copied;
+		desc->bytes_to_xfer -= bytes_copied;
+
+		if (desc->bytes_to_xfer != 0U) {
+			break;
+		}
+
+		z_unpend_thread(thread);
+		sys_dlist_append(&ready_list, &thread->base.qnode_dlist);
+	}
+
+	z_sched_lock();
+	k_spin_unlock(&pipe->lock, key);
+
+	while ((thread = (struct k_thread *)
+			 sys_dlist_get(&ready_list)) != NULL) {
+		z_ready_thread(thread);
+	}
+
+	k_sched_unlock();
+
+	return 0;
+}
+
+size_t k_pipe_read_claim(struct k_pipe *pipe, void **data, size_t size)
+{
+	k_spinlock_key_t key;
+	size_t run;
+
+	if (pipe->buffer == NULL || pipe->size == 0U) {
+		*data = NULL;
+		return 0;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	run = MIN(size, pipe_read_run(pipe));
+	*data = (run > 0U) ? pipe->buffer + pipe->read_index : NULL;
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return run;
+}
+
+int k_pipe_read_finish(struct k_pipe *pipe, size_t size)
+{
+	struct k_thread *thread;
+	struct k_pipe_desc *desc;
+	sys_dlist_t ready_list;
+	size_t bytes_copied;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF(size > pipe_read_run(pipe)) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	/* recycle the claimed bytes */
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index == pipe->size) {
+		pipe->read_index = 0;
+	}
+
+	/*
+	 * Drain blocked writers into the recycled space.  A writer is
+	 * only readied once its whole request has been absorbed.
+	 */
+	sys_dlist_init(&ready_list);
+
+	while ((thread = z_waitq_head(&pipe->wait_q.writers)) != NULL) {
+		desc = (struct k_pipe_desc *)thread->base.swap_data;
+		bytes_copied = pipe_buffer_put(pipe, desc->buffer,
+						desc->bytes_to_xfer);
+
+		desc->buffer        += bytes_copied;
+		desc->bytes_to_xfer -= bytes_copied;
+
+		if (desc->bytes_to_xfer != 0U) {
+			break;
+		}
+
+		z_unpend_thread(thread);
+		sys_dlist_append(&ready_list, &thread->base.qnode_dlist);
+	}
+
+	z_sched_lock();
+	k_spin_unlock(&pipe->lock, key);
+
+	while ((thread = (struct k_thread *)
+			 sys_dlist_get(&ready_list)) != NULL) {
+		pipe_thread_ready(thread);
+	}
+
+	k_sched_unlock();
+
+	return 0;
+}
@@ -490,6 +490,171 @@ static inline void z_vrfy_k_poll_signal_reset(struct k_poll_signal *signal)
 
 #endif
 
+/* must be called with interrupts locked */
+static void poll_eq_wake(struct k_poll_eq *eq)
+{
+	struct k_thread *thread = z_waitq_head(&eq->wait_q);
+
+	if (thread != NULL) {
+		z_unpend_thread(thread);
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+}
+
+static int poll_eq_cb(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_eq *eq = CONTAINER_OF(event->poller, struct k_poll_eq,
+					    poller);
+
+	ARG_UNUSED(state);
+
+	/* The event has already been delisted from its object, and
+	 * set_event_ready() in the caller records the state; just
+	 * park it on the ready list and kick the waiter.
+	 */
+	sys_dlist_append(&eq->ready, &event->_node);
+	poll_eq_wake(eq);
+
+	return 0;
+}
+
+void k_poll_eq_init(struct k_poll_eq *eq)
+{
+	eq->poller = (struct _poller) {
+		.is_polling = true,
+		.thread = _current,
+		.cb = poll_eq_cb,
+	};
+	sys_dlist_init(&eq->ready);
+	z_waitq_init(&eq->wait_q);
+}
+
+int k_poll_eq_add(struct k_poll_eq *eq, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t state;
+
+	if (event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EADDRINUSE;
+	}
+
+	if (is_condition_met(event, &state)) {
+		/* already ready: park it for the next wait call */
+		event->state |= state;
+		sys_dlist_append(&eq->ready, &event->_node);
+		poll_eq_wake(eq);
+		z_reschedule(&lock, key);
+		return 0;
+	}
+
+	(void)register_event(event, &eq->poller);
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+void k_poll_eq_remove(struct k_poll_eq *eq, struct k_poll_event *event)
+{
+	ARG_UNUSED(eq);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* The event sits either on its object's list or on the ready
+	 * list; either way unlinking it stops the watch.
+	 */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+
+	k_spin_unlock(&lock, key);
+}
+
+int k_poll_eq_wait(struct k_poll_eq *eq, struct k_poll_event **events,
+		   int num_events, k_timeout_t timeout)
+{
+	int64_t now, end = z_timeout_end_calc(timeout);
+	sys_dlist_t redeliver;
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+	int n = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(events != NULL, "NULL events\n");
+	__ASSERT(num_events > 0, "no room for events\n");
+
+	sys_dlist_init(&redeliver);
+
+	key = k_spin_lock(&lock);
+	eq->poller.thread = _current;
+
+	while (true) {
+		/* Only parked (ready) events are looked at: the cost
+		 * of a wakeup scales with how many fired, not with
+		 * how many are registered.
+		 */
+		while (n < num_events &&
+		       (node = sys_dlist_get(&eq->ready)) != NULL) {
+			struct k_poll_event *event =
+				CONTAINER_OF(node, struct k_poll_event,
+					     _node);
+			uint32_t state = event->state;
+
+			if ((state & K_POLL_STATE_CANCELLED) != 0U) {
+				/* delivered once, not re-armed */
+				events[n++] = event;
+				continue;
+			}
+
+			/* Level-triggered: re-check the condition; if
+			 * it still holds, deliver and keep the event
+			 * parked, otherwise re-arm it on its object.
+			 */
+			event->state = K_POLL_STATE_NOT_READY;
+			if (is_condition_met(event, &state)) {
+				event->state = state;
+				events[n++] = event;
+				sys_dlist_append(&redeliver, &event->_node);
+			} else {
+				(void)register_event(event, &eq->poller);
+			}
+		}
+
+		while ((node = sys_dlist_get(&redeliver)) != NULL) {
+			sys_dlist_append(&eq->ready, node);
+		}
+
+		if (n > 0) {
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		now = z_tick_get();
+		if ((end - now) <= 0) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		int swap_rc = z_pend_curr(&lock, key, &eq->wait_q,
+					  K_TICKS(end - now));
+
+		if (swap_rc != 0) {
+			return swap_rc;
+		}
+		key = k_spin_lock(&lock);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return n;
+}
+
 static void triggered_work_handler(struct k_work *work)
 {
 	k_work_handler_t handler;
@@ -298,6 +298,60 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	return (ret != 0) ? NULL : _current->base.swap_data;
 }
 
+/* Dequeue as many items as available, up to count, under a single lock
+ * hold. Caller holds the queue lock.
+ */
+static inline int queue_drain_locked(struct k_queue *queue, void **array,
+				     int count)
+{
+	int n = 0;
+
+	while (n < count && !sys_sflist_is_empty(&queue->data_q)) {
+		sys_sfnode_t *node;
+
+		node = sys_sflist_get_not_empty(&queue->data_q);
+		array[n] = z_queue_node_peek(node, true);
+		n++;
+	}
+
+	return n;
+}
+
+int z_impl_k_queue_get_batch(struct k_queue *queue, void **array, int count,
+			     k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int n;
+
+	CHECKIF(array == NULL || count <= 0) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&queue->lock);
+	n = queue_drain_locked(queue, array, count);
+
+	if (n > 0 || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&queue->lock, key);
+		return n;
+	}
+
+	if (z_pend_curr(&queue->lock, key, &queue->wait_q, timeout) != 0) {
+		return 0;
+	}
+
+	/* The waker handed us one item directly; top the batch up with
+	 * anything that was enqueued alongside it (e.g. via
+	 * k_queue_append_list()) without waiting again.
+	 */
+	array[0] = _current->base.swap_data;
+
+	key = k_spin_lock(&queue->lock);
+	n = 1 + queue_drain_locked(queue, &array[1], count - 1);
+	k_spin_unlock(&queue->lock, key);
+
+	return n;
+}
+
 #ifdef CONFIG_USERSPACE
 static inline void *z_vrfy_k_queue_get(struct k_queue *queue,
 				       k_timeout_t timeout)
@@ -307,6 +361,17 @@ static inline void *z_vrfy_k_queue_get(struct k_queue *queue,
 }
 #include <syscalls/k_queue_get_mrsh.c>
 
+static inline int z_vrfy_k_queue_get_batch(struct k_queue *queue,
+					   void **array, int count,
+					   k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
+	Z_OOPS(Z_SYSCALL_VERIFY(count > 0));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(array, count, sizeof(void *)));
+	return z_impl_k_queue_get_batch(queue, array, count, timeout);
+}
+#include <syscalls/k_queue_get_batch_mrsh.c>
+
 static inline int z_vrfy_k_queue_is_empty(struct k_queue *queue)
 {
 	Z_OOPS(Z_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
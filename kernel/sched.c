@@ -16,6 +16,7 @@
 #include <kernel_internal.h>
 #include <logging/log.h>
 #include <sys/atomic.h>
+#include <sys/math_extras.h>
 LOG_MODULE_DECLARE(os);
 
 /* Maximum time between the time a self-aborting thread flags itself
@@ -60,6 +61,40 @@ static struct k_spinlock sched_spinlock;
 
 static void update_cache(int);
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+/* Scheduling IPIs are coalesced: readying a thread just flags the need
+ * for an interrupt, and z_signal_pending_ipi() sends at most one at the
+ * next scheduling point.  A burst of wakeups thus costs the other CPUs
+ * a single interrupt instead of one per wakeup.
+ */
+static inline void flag_ipi(void)
+{
+	if (CONFIG_MP_NUM_CPUS > 1) {
+		_kernel.pending_ipi = true;
+	}
+}
+#else
+#define flag_ipi() do { } while (false)
+#endif
+
+void z_signal_pending_ipi(void)
+{
+	/* Synchronization note: a flag_ipi() arriving between the test
+	 * and the clear below is absorbed by the broadcast we are about
+	 * to send anyway; flags are always raised after the woken thread
+	 * is visible in the run queue (both happen inside the scheduler
+	 * lock), so an IPI can never be lost, only duplicated.
+	 */
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+	if (CONFIG_MP_NUM_CPUS > 1) {
+		if (_kernel.pending_ipi) {
+			_kernel.pending_ipi = false;
+			arch_sched_ipi();
+		}
+	}
+#endif
+}
+
 #define LOCKED(lck) for (k_spinlock_key_t __i = {},			\
 					  __key = k_spin_lock(lck);	\
 			!__i.key;					\
@@ -181,6 +216,57 @@ static ALWAYS_INLINE struct k_thread *_priq_dumb_mask_best(sys_dlist_t *pq)
 }
 #endif
 
+/* With CONFIG_SCHED_CPU_MASK_PIN_ONLY every runnable thread is pinned
+ * to exactly one CPU, so each CPU owns a private run queue and the
+ * global _kernel.ready_q goes unused.  These helpers pick the queue a
+ * given thread lives on (derived from its mask) and the queue the
+ * current CPU should pull from; everything else in this file goes
+ * through them rather than naming a queue directly.
+ */
+static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+	int cpu, m = thread->base.cpu_mask;
+
+	/* Edge case: it's legal per the API to "make runnable" a
+	 * thread with all CPUs masked off (i.e. one that isn't
+	 * actually runnable!).  Sort of a wart in the API and maybe
+	 * we should address this in docs/assertions instead to avoid
+	 * the extra test.
+	 */
+	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
+
+	return &_kernel.cpus[cpu].ready_q.runq;
+#else
+	ARG_UNUSED(thread);
+	return &_kernel.ready_q.runq;
+#endif
+}
+
+static ALWAYS_INLINE void *curr_cpu_runq(void)
+{
+#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+	return &_current_cpu->ready_q.runq;
+#else
+	return &_kernel.ready_q.runq;
+#endif
+}
+
+static ALWAYS_INLINE void runq_add(struct k_thread *thread)
+{
+	_priq_run_add(thread_runq(thread), thread);
+}
+
+static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
+{
+	_priq_run_remove(thread_runq(thread), thread);
+}
+
+static ALWAYS_INLINE struct k_thread *runq_best(void)
+{
+	return _priq_run_best(curr_cpu_runq());
+}
+
 static ALWAYS_INLINE struct k_thread *next_up(void)
 {
 	struct k_thread *thread;
@@ -192,7 +278,7 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 		return _current_cpu->idle_thread;
 	}
 
-	thread = _priq_run_best(&_kernel.ready_q.runq);
+	thread = runq_best();
 
 #if (CONFIG_NUM_METAIRQ_PRIORITIES > 0) && (CONFIG_NUM_COOP_PRIORITIES > 0)
 	/* MetaIRQs must always attempt to return back to a
@@ -262,13 +348,13 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 	/* Put _current back into the queue */
 	if (thread != _current && active &&
 		!z_is_idle_thread_object(_current) && !queued) {
-		_priq_run_add(&_kernel.ready_q.runq, _current);
+		runq_add(_current);
 		z_mark_thread_as_queued(_current);
 	}
 
 	/* Take the new _current out of the queue */
 	if (z_is_thread_queued(thread)) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
+		runq_remove(thread);
 	}
 	z_mark_thread_as_not_queued(thread);
 
@@ -279,9 +365,9 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 static void move_thread_to_end_of_prio_q(struct k_thread *thread)
 {
 	if (z_is_thread_queued(thread)) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
+		runq_remove(thread);
 	}
-	_priq_run_add(&_kernel.ready_q.runq, thread);
+	runq_add(thread);
 	z_mark_thread_as_queued(thread);
 	update_cache(thread == _current);
 }
@@ -422,12 +508,10 @@ static void ready_thread(struct k_thread *thread)
 	 */
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		sys_trace_thread_ready(thread);
-		_priq_run_add(&_kernel.ready_q.runq, thread);
+		runq_add(thread);
 		z_mark_thread_as_queued(thread);
 		update_cache(0);
-#if defined(CONFIG_SMP) &&  defined(CONFIG_SCHED_IPI_SUPPORTED)
-		arch_sched_ipi();
-#endif
+		flag_ipi();
 	}
 }
 
@@ -465,7 +549,7 @@ void z_impl_k_thread_suspend(struct k_thread *thread)
 
 	LOCKED(&sched_spinlock) {
 		if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 			z_mark_thread_as_not_queued(thread);
 		}
 		z_mark_thread_as_suspended(thread);
@@ -552,8 +636,7 @@ void z_thread_single_abort(struct k_thread *thread)
 
 		if (z_is_thread_ready(thread)) {
 			if (z_is_thread_queued(thread)) {
-				_priq_run_remove(&_kernel.ready_q.runq,
-						 thread);
+				runq_remove(thread);
 				z_mark_thread_as_not_queued(thread);
 			}
 			update_cache(thread == _current);
@@ -637,7 +720,7 @@ void z_thread_single_abort(struct k_thread *thread)
 static void unready_thread(struct k_thread *thread)
 {
 	if (z_is_thread_queued(thread)) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
+		runq_remove(thread);
 		z_mark_thread_as_not_queued(thread);
 	}
 	update_cache(thread == _current);
@@ -799,9 +882,9 @@ bool z_set_prio(struct k_thread *thread, int prio)
 		if (need_sched) {
 			/* Don't requeue on SMP if it's the running thread */
 			if (!IS_ENABLED(CONFIG_SMP) || z_is_thread_queued(thread)) {
-				_priq_run_remove(&_kernel.ready_q.runq, thread);
+				runq_remove(thread);
 				thread->base.prio = prio;
-				_priq_run_add(&_kernel.ready_q.runq, thread);
+				runq_add(thread);
 			} else {
 				thread->base.prio = prio;
 			}
@@ -819,9 +902,7 @@ void z_thread_priority_set(struct k_thread *thread, int prio)
 {
 	bool need_sched = z_set_prio(thread, prio);
 
-#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	arch_sched_ipi();
-#endif
+	flag_ipi();
 
 	if (need_sched && _current->base.sched_locked == 0) {
 		z_reschedule_unlocked();
@@ -861,6 +942,7 @@ void z_reschedule(struct k_spinlock *lock, k_spinlock_key_t key)
 		z_swap(lock, key);
 	} else {
 		k_spin_unlock(lock, key);
+		z_signal_pending_ipi();
 	}
 }
 
@@ -870,6 +952,7 @@ void z_reschedule_irqlock(uint32_t key)
 		z_swap_irqlock(key);
 	} else {
 		irq_unlock(key);
+		z_signal_pending_ipi();
 	}
 }
 
@@ -899,7 +982,7 @@ void k_sched_unlock(void)
 }
 
 #ifdef CONFIG_SMP
-struct k_thread *z_get_next_ready_thread(void)
+__hot_code struct k_thread *z_get_next_ready_thread(void)
 {
 	struct k_thread *ret = 0;
 
@@ -952,6 +1035,7 @@ void *z_get_next_switch_handle(void *interrupted)
 		}
 		old_thread->switch_handle = interrupted;
 	}
+	z_signal_pending_ipi();
 #else
 	_current->switch_handle = interrupted;
 	set_current(z_get_next_ready_thread());
@@ -1070,18 +1154,12 @@ struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 	return thread;
 }
 
-#ifdef CONFIG_SCHED_MULTIQ
-# if (K_LOWEST_THREAD_PRIO - K_HIGHEST_THREAD_PRIO) > 31
-# error Too many priorities for multiqueue scheduler (max 32)
-# endif
-#endif
-
 ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq, struct k_thread *thread)
 {
 	int priority_bit = thread->base.prio - K_HIGHEST_THREAD_PRIO;
 
 	sys_dlist_append(&pq->queues[priority_bit], &thread->base.qnode_dlist);
-	pq->bitmask |= BIT(priority_bit);
+	pq->bitmask[priority_bit / 32] |= BIT(priority_bit % 32);
 }
 
 ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq, struct k_thread *thread)
@@ -1096,22 +1174,28 @@ ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq, struct k_thread *thread
 
 	sys_dlist_remove(&thread->base.qnode_dlist);
 	if (sys_dlist_is_empty(&pq->queues[priority_bit])) {
-		pq->bitmask &= ~BIT(priority_bit);
+		pq->bitmask[priority_bit / 32] &= ~BIT(priority_bit % 32);
 	}
 }
 
 struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 {
-	if (!pq->bitmask) {
-		return NULL;
-	}
-
 	struct k_thread *thread = NULL;
-	sys_dlist_t *l = &pq->queues[__builtin_ctz(pq->bitmask)];
-	sys_dnode_t *n = sys_dlist_peek_head(l);
 
-	if (n != NULL) {
-		thread = CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+	for (int i = 0; i < PRIQ_MQ_NUM_BITMAPS; i++) {
+		if (!pq->bitmask[i]) {
+			continue;
+		}
+
+		sys_dlist_t *l =
+			&pq->queues[i * 32 + __builtin_ctz(pq->bitmask[i])];
+		sys_dnode_t *n = sys_dlist_peek_head(l);
+
+		if (n != NULL) {
+			thread = CONTAINER_OF(n, struct k_thread,
+					      base.qnode_dlist);
+		}
+		break;
 	}
 	return thread;
 }
@@ -1130,24 +1214,31 @@ int z_unpend_all(_wait_q_t *wait_q)
 	return need_sched;
 }
 
-void z_sched_init(void)
+static void init_ready_q(struct _ready_q *rq)
 {
-#ifdef CONFIG_SCHED_DUMB
-	sys_dlist_init(&_kernel.ready_q.runq);
-#endif
-
-#ifdef CONFIG_SCHED_SCALABLE
-	_kernel.ready_q.runq = (struct _priq_rb) {
+#if defined(CONFIG_SCHED_SCALABLE)
+	rq->runq = (struct _priq_rb) {
 		.tree = {
 			.lessthan_fn = z_priq_rb_lessthan,
 		}
 	};
+#elif defined(CONFIG_SCHED_MULTIQ)
+	for (int i = 0; i < ARRAY_SIZE(rq->runq.queues); i++) {
+		sys_dlist_init(&rq->runq.queues[i]);
+	}
+#else
+	sys_dlist_init(&rq->runq);
 #endif
+}
 
-#ifdef CONFIG_SCHED_MULTIQ
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
-		sys_dlist_init(&_kernel.ready_q.runq.queues[i]);
+void z_sched_init(void)
+{
+#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
+#else
+	init_ready_q(&_kernel.ready_q);
 #endif
 
 #ifdef CONFIG_TIMESLICING
@@ -1207,8 +1298,8 @@ void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 	LOCKED(&sched_spinlock) {
 		thread->base.prio_deadline = k_cycle_get_32() + deadline;
 		if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
-			_priq_run_add(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
+			runq_add(thread);
 		}
 	}
 }
@@ -1237,10 +1328,9 @@ void z_impl_k_yield(void)
 		LOCKED(&sched_spinlock) {
 			if (!IS_ENABLED(CONFIG_SMP) ||
 			    z_is_thread_queued(_current)) {
-				_priq_run_remove(&_kernel.ready_q.runq,
-						 _current);
+				runq_remove(_current);
 			}
-			_priq_run_add(&_kernel.ready_q.runq, _current);
+			runq_add(_current);
 			z_mark_thread_as_queued(_current);
 			update_cache(1);
 		}
@@ -1369,11 +1459,12 @@ void z_impl_k_wakeup(k_tid_t thread)
 	z_mark_thread_as_not_suspended(thread);
 	z_ready_thread(thread);
 
-#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	arch_sched_ipi();
-#endif
-
-	if (!arch_is_in_isr()) {
+	if (arch_is_in_isr()) {
+		/* No local scheduling point follows: flush the coalesced
+		 * IPI now rather than waiting for this CPU's next swap.
+		 */
+		z_signal_pending_ipi();
+	} else {
 		z_reschedule_unlocked();
 	}
 }
@@ -1420,7 +1511,7 @@ void z_sched_abort(struct k_thread *thread)
 			thread->base.thread_state |= _THREAD_DEAD;
 			k_spin_unlock(&sched_spinlock, key);
 		} else if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 			z_mark_thread_as_not_queued(thread);
 			thread->base.thread_state |= _THREAD_DEAD;
 			k_spin_unlock(&sched_spinlock, key);
@@ -1499,6 +1590,14 @@ static int cpu_mask_mod(k_tid_t thread, uint32_t enable_mask, uint32_t disable_m
 			ret = -EINVAL;
 		}
 	}
+
+#if defined(CONFIG_ASSERT) && defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY)
+	int m = thread->base.cpu_mask;
+
+	__ASSERT((m == 0) || ((m & (m - 1)) == 0),
+		 "Only one CPU allowed in mask when PIN_ONLY");
+#endif
+
 	return ret;
 }
 
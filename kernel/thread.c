@@ -483,7 +483,10 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 		stack_buf_size, stack_ptr);
 
 #ifdef CONFIG_INIT_STACKS
-	memset(stack_buf_start, 0xaa, stack_buf_size);
+	/* Recycled pool stacks keep their previous paint job */
+	if ((new_thread->base.user_options & K_STACK_RECYCLED) == 0U) {
+		memset(stack_buf_start, 0xaa, stack_buf_size);
+	}
 #endif
 #ifdef CONFIG_STACK_SENTINEL
 	/* Put the stack sentinel at the lowest 4 bytes of the stack area.
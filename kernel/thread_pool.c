@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <ksched.h>
+#include <wait_q.h>
+
+/* Invoked from z_thread_single_abort() once the worker is fully dead
+ * (state set to _THREAD_DEAD, monitor/object bookkeeping undone), which
+ * makes the slot immediately reusable without a k_thread_join().  Runs
+ * for both normal exit and k_thread_abort(), with no locks held.
+ */
+static void thread_pool_recycle(struct k_thread *aborted)
+{
+	struct k_thread_pool_slot *slot =
+		CONTAINER_OF(aborted, struct k_thread_pool_slot, thread);
+	struct k_thread_pool *pool = slot->pool;
+	k_spinlock_key_t key = k_spin_lock(&pool->lock);
+
+	sys_slist_append(&pool->free, &slot->node);
+	k_spin_unlock(&pool->lock, key);
+	k_sem_give(&pool->sem);
+}
+
+static void thread_pool_init(struct k_thread_pool *pool)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool->lock);
+
+	if (!pool->initialized) {
+		for (uint32_t i = 0; i < pool->num_slots; i++) {
+			struct k_thread_pool_slot *slot = &pool->slots[i];
+
+			slot->pool = pool;
+			slot->stack = (k_thread_stack_t *)
+				((char *)pool->stacks +
+				 i * pool->stack_stride);
+			slot->warm = false;
+			sys_slist_append(&pool->free, &slot->node);
+		}
+		pool->initialized = true;
+	}
+	k_spin_unlock(&pool->lock, key);
+}
+
+k_tid_t k_thread_pool_spawn(struct k_thread_pool *pool,
+			    k_thread_entry_t entry,
+			    void *p1, void *p2, void *p3,
+			    int prio, uint32_t options, k_timeout_t timeout)
+{
+	struct k_thread_pool_slot *slot;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	__ASSERT(!arch_is_in_isr(), "Threads may not be created in ISRs");
+	__ASSERT((options & K_USER) == 0U,
+		 "thread pool workers are supervisor mode only");
+
+	if (!pool->initialized) {
+		thread_pool_init(pool);
+	}
+
+	if (k_sem_take(&pool->sem, timeout) != 0) {
+		return NULL;
+	}
+
+	key = k_spin_lock(&pool->lock);
+	node = sys_slist_get(&pool->free);
+	k_spin_unlock(&pool->lock, key);
+
+	__ASSERT_NO_MSG(node != NULL);
+	slot = CONTAINER_OF(node, struct k_thread_pool_slot, node);
+
+	/* A warm slot's stack is a retained image from the previous
+	 * worker, so the CONFIG_INIT_STACKS repaint can be skipped.
+	 */
+	if (slot->warm) {
+		options |= K_STACK_RECYCLED;
+	}
+	slot->warm = true;
+
+	/* Created dormant so the recycle hook is in place before the
+	 * worker can possibly run and exit.
+	 */
+	(void)k_thread_create(&slot->thread, slot->stack, pool->stack_size,
+			      entry, p1, p2, p3, prio, options, K_FOREVER);
+	slot->thread.fn_abort = thread_pool_recycle;
+	k_thread_start(&slot->thread);
+
+	return &slot->thread;
+}
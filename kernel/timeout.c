@@ -19,7 +19,9 @@
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif
 
 static struct k_spinlock timeout_lock;
 
@@ -41,6 +43,64 @@ static inline int z_vrfy_z_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+
+/* Hashed timing wheel: timeouts hash by expiry tick into a fixed
+ * array of lists, each kept sorted by expiry.  In this mode dticks
+ * stores the absolute expiry tick rather than a delta from the
+ * previous queue entry, so add/abort touch only one (short) bucket
+ * instead of walking the whole queue.
+ */
+#define WHEEL_SIZE CONFIG_TIMEOUT_WHEEL_SIZE
+#define WHEEL_MASK (WHEEL_SIZE - 1)
+
+BUILD_ASSERT((WHEEL_SIZE & WHEEL_MASK) == 0,
+	     "TIMEOUT_WHEEL_SIZE must be a power of two");
+
+static sys_dlist_t wheel[WHEEL_SIZE];
+static bool wheel_ready;
+
+/* must be locked */
+static void wheel_init(void)
+{
+	if (!wheel_ready) {
+		for (int i = 0; i < WHEEL_SIZE; i++) {
+			sys_dlist_init(&wheel[i]);
+		}
+		wheel_ready = true;
+	}
+}
+
+static struct _timeout *first(void)
+{
+	struct _timeout *best = NULL;
+
+	if (!wheel_ready) {
+		return NULL;
+	}
+
+	for (int i = 0; i < WHEEL_SIZE; i++) {
+		sys_dnode_t *n = sys_dlist_peek_head(&wheel[i]);
+
+		if (n != NULL) {
+			struct _timeout *t =
+				CONTAINER_OF(n, struct _timeout, node);
+
+			if (best == NULL || t->dticks < best->dticks) {
+				best = t;
+			}
+		}
+	}
+	return best;
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	sys_dlist_remove(&t->node);
+}
+
+#else /* !CONFIG_TIMEOUT_WHEEL */
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -64,6 +124,8 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
 static int32_t elapsed(void)
 {
 	return announce_remaining == 0 ? z_clock_elapsed() : 0U;
@@ -73,8 +135,15 @@ static int32_t next_timeout(void)
 {
 	struct _timeout *to = first();
 	int32_t ticks_elapsed = elapsed();
+#ifdef CONFIG_TIMEOUT_WHEEL
+	int32_t ret = to == NULL ? MAX_WAIT
+		: MIN(MAX_WAIT,
+		      MAX(0, (int32_t)(to->dticks - curr_tick)
+			 - ticks_elapsed));
+#else
 	int32_t ret = to == NULL ? MAX_WAIT
 		: MIN(MAX_WAIT, MAX(0, to->dticks - ticks_elapsed));
+#endif
 
 #ifdef CONFIG_TIMESLICING
 	if (_current_cpu->slice_ticks && _current_cpu->slice_ticks < ret) {
@@ -110,6 +179,25 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	ticks = MAX(1, ticks);
 
 	LOCKED(&timeout_lock) {
+#ifdef CONFIG_TIMEOUT_WHEEL
+		struct _timeout *t;
+		sys_dlist_t *b;
+
+		wheel_init();
+		to->dticks = curr_tick + elapsed() + ticks;
+		b = &wheel[to->dticks & WHEEL_MASK];
+
+		SYS_DLIST_FOR_EACH_CONTAINER(b, t, node) {
+			if (t->dticks > to->dticks) {
+				sys_dlist_insert(&t->node, &to->node);
+				break;
+			}
+		}
+
+		if (!sys_dnode_is_linked(&to->node)) {
+			sys_dlist_append(b, &to->node);
+		}
+#else
 		struct _timeout *t;
 
 		to->dticks = ticks + elapsed();
@@ -125,6 +213,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		if (t == NULL) {
 			sys_dlist_append(&timeout_list, &to->node);
 		}
+#endif
 
 		if (to == first()) {
 			z_clock_set_timeout(next_timeout(), false);
@@ -155,12 +244,16 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 		return 0;
 	}
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	ticks = timeout->dticks - curr_tick;
+#else
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
 		ticks += t->dticks;
 		if (timeout == t) {
 			break;
 		}
 	}
+#endif
 
 	return ticks - elapsed();
 }
@@ -231,6 +324,24 @@ void z_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	uint64_t end = curr_tick + ticks;
+	struct _timeout *t;
+
+	while ((t = first()) != NULL && t->dticks <= (int64_t)end) {
+		curr_tick = t->dticks;
+		announce_remaining = end - curr_tick;
+		t->dticks = 0;
+		remove_timeout(t);
+
+		k_spin_unlock(&timeout_lock, key);
+		t->fn(t);
+		key = k_spin_lock(&timeout_lock);
+	}
+
+	curr_tick = end;
+	announce_remaining = 0;
+#else
 	while (first() != NULL && first()->dticks <= announce_remaining) {
 		struct _timeout *t = first();
 		int dt = t->dticks;
@@ -251,6 +362,7 @@ void z_clock_announce(int32_t ticks)
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
+#endif
 
 	z_clock_set_timeout(next_timeout(), false);
 
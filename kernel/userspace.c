@@ -8,7 +8,6 @@
 #include <kernel.h>
 #include <string.h>
 #include <sys/math_extras.h>
-#include <sys/rb.h>
 #include <kernel_structs.h>
 #include <sys/sys_io.h>
 #include <ksched.h>
@@ -47,7 +46,7 @@ LOG_MODULE_DECLARE(os);
  * not.
  */
 #ifdef CONFIG_DYNAMIC_OBJECTS
-static struct k_spinlock lists_lock;       /* kobj rbtree/dlist */
+static struct k_spinlock lists_lock;       /* kobj hash table/dlist */
 static struct k_spinlock objfree_lock;     /* k_object_free */
 #endif
 static struct k_spinlock obj_lock;         /* kobj struct data */
@@ -114,7 +113,6 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct z_object kobj;
 	sys_dnode_t obj_list;
-	struct rbnode node; /* must be immediately before data member */
 	uint8_t data[]; /* The object itself */
 };
 
@@ -122,15 +120,21 @@ extern struct z_object *z_object_gperf_find(const void *obj);
 extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 					     void *context);
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b);
-
 /*
- * Red/black tree of allocated kernel objects, for reasonably fast lookups
- * based on object pointer values.
+ * Open-addressed hash table of allocated kernel objects, keyed by object
+ * pointer, so that syscall object validation is O(1) for dynamic objects
+ * just as the gperf table makes it for static ones. Deleted slots leave
+ * a tombstone which is flushed on the next rehash; the table is grown
+ * (or rehashed at the same size) outside the lists_lock, in the
+ * allocation path, never during lookup.
  */
-static struct rbtree obj_rb_tree = {
-	.lessthan_fn = node_lessthan
-};
+#define OBJ_HASH_MIN_SIZE	16
+#define OBJ_HASH_TOMBSTONE	((struct dyn_obj *)1UL)
+
+static struct dyn_obj **obj_hash;
+static size_t obj_hash_size;
+static size_t obj_hash_used;	/* live entries */
+static size_t obj_hash_filled;	/* live entries plus tombstones */
 
 /*
  * Linked list of allocated kernel objects, for iteration over all allocated
@@ -138,11 +142,6 @@ static struct rbtree obj_rb_tree = {
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
-/*
- * TODO: Write some hash table code that will replace both obj_rb_tree
- * and obj_list.
- */
-
 static size_t obj_size_get(enum k_objects otype)
 {
 	size_t ret;
@@ -157,33 +156,155 @@ static size_t obj_size_get(enum k_objects otype)
 	return ret;
 }
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b)
+static size_t obj_hash_slot(const void *obj, size_t size)
 {
-	return a < b;
+	uintptr_t value = (uintptr_t)obj;
+
+	/* Fibonacci hash; object pointers are aligned, so fold the
+	 * high bits down first to keep the low ones from being all
+	 * zeroes.
+	 */
+	value ^= value >> 7;
+	return (value * 2654435761UL) & (size - 1);
 }
 
-static inline struct dyn_obj *node_to_dyn_obj(struct rbnode *node)
+/* insert into a table known to have a free slot; counters are the
+ * caller's problem. Returns true if an empty slot was consumed, false
+ * if a tombstone was recycled.
+ */
+static bool obj_hash_insert_at(struct dyn_obj **table, size_t size,
+			       struct dyn_obj *dyn)
 {
-	return CONTAINER_OF(node, struct dyn_obj, node);
+	size_t slot = obj_hash_slot(dyn->kobj.name, size);
+
+	while ((table[slot] != NULL) && (table[slot] != OBJ_HASH_TOMBSTONE)) {
+		slot = (slot + 1) & (size - 1);
+	}
+
+	bool was_empty = (table[slot] == NULL);
+
+	table[slot] = dyn;
+	return was_empty;
 }
 
-static struct dyn_obj *dyn_object_find(void *obj)
+/*
+ * Ensure the hash table can accept one more entry, growing it (or
+ * rehashing at the same size to flush tombstones) as required. Called
+ * with no locks held: the replacement table is allocated outside the
+ * lists_lock so lookups never wait on the allocator.
+ *
+ * On success a free slot is guaranteed until the reservation is consumed.
+ */
+static int obj_hash_reserve(void)
+{
+	struct dyn_obj **new_table, **old_table;
+	size_t new_size, i;
+	k_spinlock_key_t key;
+
+	for (;;) {
+		key = k_spin_lock(&lists_lock);
+		if ((obj_hash != NULL) &&
+		    ((obj_hash_filled + 1) * 4U <= obj_hash_size * 3U)) {
+			/* under 75% full, nothing to do */
+			k_spin_unlock(&lists_lock, key);
+			return 0;
+		}
+
+		if (obj_hash == NULL) {
+			new_size = OBJ_HASH_MIN_SIZE;
+		} else if ((obj_hash_used + 1) * 2U > obj_hash_size) {
+			new_size = obj_hash_size * 2U;
+		} else {
+			/* mostly tombstones: rehash at the same size */
+			new_size = obj_hash_size;
+		}
+		k_spin_unlock(&lists_lock, key);
+
+		new_table = z_thread_malloc(new_size * sizeof(*new_table));
+		if (new_table == NULL) {
+			int ret = -ENOMEM;
+
+			/* degraded mode: accept an over-full table as
+			 * long as a free slot remains
+			 */
+			key = k_spin_lock(&lists_lock);
+			if ((obj_hash != NULL) &&
+			    (obj_hash_filled < obj_hash_size)) {
+				ret = 0;
+			}
+			k_spin_unlock(&lists_lock, key);
+			return ret;
+		}
+		(void)memset(new_table, 0, new_size * sizeof(*new_table));
+
+		key = k_spin_lock(&lists_lock);
+		if (obj_hash_size > new_size) {
+			/* another thread already grew the table further;
+			 * start over with fresh requirements
+			 */
+			k_spin_unlock(&lists_lock, key);
+			k_free(new_table);
+			continue;
+		}
+
+		old_table = obj_hash;
+		for (i = 0; i < obj_hash_size; i++) {
+			if ((old_table[i] != NULL) &&
+			    (old_table[i] != OBJ_HASH_TOMBSTONE)) {
+				(void)obj_hash_insert_at(new_table, new_size,
+							 old_table[i]);
+			}
+		}
+		obj_hash = new_table;
+		obj_hash_size = new_size;
+		obj_hash_filled = obj_hash_used;
+		k_spin_unlock(&lists_lock, key);
+
+		if (old_table != NULL) {
+			k_free(old_table);
+		}
+	}
+}
+
+static void obj_hash_remove(struct dyn_obj *dyn)
 {
-	struct rbnode *node;
-	struct dyn_obj *ret;
+	size_t slot, probes = 0;
+	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the conatining struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
-	node = (struct rbnode *)((char *)obj - sizeof(struct rbnode));
+	slot = obj_hash_slot(dyn->kobj.name, obj_hash_size);
+	while (obj_hash[slot] != dyn) {
+		if ((obj_hash[slot] == NULL) || (++probes == obj_hash_size)) {
+			/* not present */
+			k_spin_unlock(&lists_lock, key);
+			return;
+		}
+		slot = (slot + 1) & (obj_hash_size - 1);
+	}
+	obj_hash[slot] = OBJ_HASH_TOMBSTONE;
+	obj_hash_used--;
+	k_spin_unlock(&lists_lock, key);
+}
+
+static struct dyn_obj *dyn_object_find(void *obj)
+{
+	struct dyn_obj *ret = NULL;
+	size_t slot, probes = 0;
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
-	if (rb_contains(&obj_rb_tree, node)) {
-		ret = node_to_dyn_obj(node);
-	} else {
-		ret = NULL;
+
+	if (obj_hash != NULL) {
+		slot = obj_hash_slot(obj, obj_hash_size);
+		while (obj_hash[slot] != NULL) {
+			if ((obj_hash[slot] != OBJ_HASH_TOMBSTONE) &&
+			    (obj_hash[slot]->kobj.name == obj)) {
+				ret = obj_hash[slot];
+				break;
+			}
+			if (++probes == obj_hash_size) {
+				break;
+			}
+			slot = (slot + 1) & (obj_hash_size - 1);
+		}
 	}
 	k_spin_unlock(&lists_lock, key);
 
@@ -268,9 +389,18 @@ struct z_object *z_dynamic_object_create(size_t size)
 	dyn->kobj.flags = 0;
 	(void)memset(dyn->kobj.perms, 0, CONFIG_MAX_THREAD_BYTES);
 
+	if (obj_hash_reserve() != 0) {
+		LOG_ERR("could not grow kernel object table, out of memory");
+		k_free(dyn);
+		return NULL;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	rb_insert(&obj_rb_tree, &dyn->node);
+	if (obj_hash_insert_at(obj_hash, obj_hash_size, dyn)) {
+		obj_hash_filled++;
+	}
+	obj_hash_used++;
 	sys_dlist_append(&obj_list, &dyn->obj_list);
 	k_spin_unlock(&lists_lock, key);
 
@@ -343,7 +473,7 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
-		rb_remove(&obj_rb_tree, &dyn->node);
+		obj_hash_remove(dyn);
 		sys_dlist_remove(&dyn->obj_list);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
@@ -447,7 +577,7 @@ static void unref_check(struct z_object *ko, uintptr_t index)
 		break;
 	}
 
-	rb_remove(&obj_rb_tree, &dyn->node);
+	obj_hash_remove(dyn);
 	sys_dlist_remove(&dyn->obj_list);
 	k_free(dyn);
 out:
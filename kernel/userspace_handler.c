@@ -65,3 +65,54 @@ static inline void *z_vrfy_k_object_alloc(enum k_objects otype)
 	return z_impl_k_object_alloc(otype);
 }
 #include <syscalls/k_object_alloc_mrsh.c>
+
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	/* Supervisor-mode callers have no privilege transition to
+	 * amortize and can simply make the calls directly.
+	 */
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	return -ENOSYS;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	struct k_syscall_batch_entry entry;
+	void *ssf = _current->syscall_frame;
+
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(entries, count, sizeof(*entries)));
+
+	for (size_t i = 0; i < count; i++) {
+		/* Copy to the kernel stack so the id and arguments can't
+		 * change between validation and dispatch
+		 */
+		Z_OOPS(z_user_from_copy(&entry, &entries[i], sizeof(entry)));
+
+		Z_OOPS(Z_SYSCALL_VERIFY_MSG(entry.id < K_SYSCALL_BAD,
+					    "invalid syscall id %lu",
+					    (unsigned long)entry.id));
+		Z_OOPS(Z_SYSCALL_VERIFY_MSG(entry.id != K_SYSCALL_K_SYSCALL_BATCH,
+					    "nested syscall batch"));
+
+		entry.ret = _k_syscall_table[entry.id](entry.args[0],
+						       entry.args[1],
+						       entry.args[2],
+						       entry.args[3],
+						       entry.args[4],
+						       entry.args[5], ssf);
+
+		/* The marshalling glue clears the frame pointer on its way
+		 * out; restore it for the remainder of the batch
+		 */
+		_current->syscall_frame = ssf;
+
+		Z_OOPS(z_user_to_copy(&entries[i].ret, &entry.ret,
+				      sizeof(entry.ret)));
+	}
+
+	return 0;
+}
+#include <syscalls/k_syscall_batch_mrsh.c>
@@ -15,6 +15,7 @@
 #include <wait_q.h>
 #include <spinlock.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdbool.h>
 #include <sys/check.h>
 
@@ -30,6 +31,10 @@ void k_work_q_start(struct k_work_q *work_q, k_thread_stack_t *stack,
 		    size_t stack_size, int prio)
 {
 	k_queue_init(&work_q->queue);
+#ifdef CONFIG_WORK_Q_MPSC_SUBMIT
+	(void)atomic_ptr_set(&work_q->mpsc_head, NULL);
+	k_sem_init(&work_q->mpsc_sem, 0, UINT_MAX);
+#endif
 	(void)k_thread_create(&work_q->thread, stack, stack_size, z_work_q_main,
 			work_q, NULL, NULL, prio, 0, K_NO_WAIT);
 
@@ -56,10 +61,16 @@ void k_delayed_work_init(struct k_delayed_work *work, k_work_handler_t handler)
 static int work_cancel(struct k_delayed_work *work)
 {
 	if (k_work_pending(&work->work)) {
-		/* Remove from the queue if already submitted */
+#ifndef CONFIG_WORK_Q_MPSC_SUBMIT
+		/* Remove from the queue if already submitted.  With
+		 * MPSC submission there is nothing to unlink here:
+		 * clearing the pending bit below makes the workqueue
+		 * thread skip the item when it reaps the list.
+		 */
 		if (!k_queue_remove(&work->work_q->queue, &work->work)) {
 			return -EINVAL;
 		}
+#endif
 	} else {
 		int err = z_abort_timeout(&work->timeout);
 
@@ -13,6 +13,14 @@
 K_MEM_SLAB_DEFINE(cv2_mem_slab, sizeof(struct cv2_mslab),
 		  CONFIG_CMSIS_V2_MEM_SLAB_MAX_COUNT, 4);
 
+#if CONFIG_CMSIS_V2_MEM_SLAB_PREALLOC_COUNT != 0
+BUILD_ASSERT(CONFIG_CMSIS_V2_MEM_SLAB_MAX_DYNAMIC_SIZE > 0,
+	     "preallocated pool buffers need a nonzero max dynamic size");
+K_MEM_SLAB_DEFINE(cv2_mem_pool_slab,
+		  ROUND_UP(CONFIG_CMSIS_V2_MEM_SLAB_MAX_DYNAMIC_SIZE, 4),
+		  CONFIG_CMSIS_V2_MEM_SLAB_PREALLOC_COUNT, 4);
+#endif
+
 static const osMemoryPoolAttr_t init_mslab_attrs = {
 	.name = "ZephyrMemPool",
 	.attr_bits = 0,
@@ -30,9 +38,11 @@ osMemoryPoolId_t osMemoryPoolNew(uint32_t block_count, uint32_t block_size,
 {
 	struct cv2_mslab *mslab;
 
+#ifdef CONFIG_CMSIS_V2_DYNAMIC_HEAP_ALLOC
 	BUILD_ASSERT(CONFIG_HEAP_MEM_POOL_SIZE >=
 		     CONFIG_CMSIS_V2_MEM_SLAB_MAX_DYNAMIC_SIZE,
 		     "heap must be configured to be at least the max dynamic size");
+#endif
 
 	if (k_is_in_isr()) {
 		return NULL;
@@ -57,12 +67,28 @@ osMemoryPoolId_t osMemoryPoolNew(uint32_t block_count, uint32_t block_size,
 			 CONFIG_CMSIS_V2_MEM_SLAB_MAX_DYNAMIC_SIZE,
 			 "memory slab/pool size exceeds dynamic maximum");
 
-		mslab->pool = k_calloc(block_count, block_size);
+		mslab->pool = NULL;
+#if CONFIG_CMSIS_V2_MEM_SLAB_PREALLOC_COUNT != 0
+		/* Constant-time path: take a buffer from the dedicated
+		 * preallocated pool before (optionally) falling back to
+		 * the heap.
+		 */
+		if (k_mem_slab_alloc(&cv2_mem_pool_slab, &mslab->pool,
+				     K_NO_WAIT) == 0) {
+			(void)memset(mslab->pool, 0, block_count * block_size);
+			mslab->is_prealloc_pool = TRUE;
+		}
+#endif
+#ifdef CONFIG_CMSIS_V2_DYNAMIC_HEAP_ALLOC
+		if (mslab->pool == NULL) {
+			mslab->pool = k_calloc(block_count, block_size);
+			mslab->is_dynamic_allocation = TRUE;
+		}
+#endif
 		if (mslab->pool == NULL) {
 			k_mem_slab_free(&cv2_mem_slab, (void *) &mslab);
 			return NULL;
 		}
-		mslab->is_dynamic_allocation = TRUE;
 	} else {
 		mslab->pool = attr->mp_mem;
 		mslab->is_dynamic_allocation = FALSE;
@@ -233,6 +259,11 @@ osStatus_t osMemoryPoolDelete(osMemoryPoolId_t mp_id)
 	if (mslab->is_dynamic_allocation) {
 		k_free(mslab->pool);
 	}
+#if CONFIG_CMSIS_V2_MEM_SLAB_PREALLOC_COUNT != 0
+	if (mslab->is_prealloc_pool) {
+		k_mem_slab_free(&cv2_mem_pool_slab, (void *)&mslab->pool);
+	}
+#endif
 	k_mem_slab_free(&cv2_mem_slab, (void *)&mslab);
 
 	return osOK;
@@ -11,6 +11,14 @@
 K_MEM_SLAB_DEFINE(cv2_msgq_slab, sizeof(struct cv2_msgq),
 		  CONFIG_CMSIS_V2_MSGQ_MAX_COUNT, 4);
 
+#if CONFIG_CMSIS_V2_MSGQ_PREALLOC_COUNT != 0
+BUILD_ASSERT(CONFIG_CMSIS_V2_MSGQ_MAX_DYNAMIC_SIZE > 0,
+	     "preallocated queue buffers need a nonzero max dynamic size");
+K_MEM_SLAB_DEFINE(cv2_msgq_pool_slab,
+		  ROUND_UP(CONFIG_CMSIS_V2_MSGQ_MAX_DYNAMIC_SIZE, 4),
+		  CONFIG_CMSIS_V2_MSGQ_PREALLOC_COUNT, 4);
+#endif
+
 static const osMessageQueueAttr_t init_msgq_attrs = {
 	.name = "ZephyrMsgQ",
 	.attr_bits = 0,
@@ -28,9 +36,11 @@ osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size,
 {
 	struct cv2_msgq *msgq;
 
+#ifdef CONFIG_CMSIS_V2_DYNAMIC_HEAP_ALLOC
 	BUILD_ASSERT(CONFIG_HEAP_MEM_POOL_SIZE >=
 		     CONFIG_CMSIS_V2_MSGQ_MAX_DYNAMIC_SIZE,
 		     "heap must be configured to be at least the max dynamic size");
+#endif
 
 	if (k_is_in_isr()) {
 		return NULL;
@@ -55,12 +65,28 @@ osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size,
 			 CONFIG_CMSIS_V2_MSGQ_MAX_DYNAMIC_SIZE,
 			 "message queue size exceeds dynamic maximum");
 
-		msgq->pool = k_calloc(msg_count, msg_size);
+		msgq->pool = NULL;
+#if CONFIG_CMSIS_V2_MSGQ_PREALLOC_COUNT != 0
+		/* Constant-time path: take a buffer from the dedicated
+		 * preallocated pool before (optionally) falling back to
+		 * the heap.
+		 */
+		if (k_mem_slab_alloc(&cv2_msgq_pool_slab, &msgq->pool,
+				     K_NO_WAIT) == 0) {
+			(void)memset(msgq->pool, 0, msg_count * msg_size);
+			msgq->is_prealloc_pool = TRUE;
+		}
+#endif
+#ifdef CONFIG_CMSIS_V2_DYNAMIC_HEAP_ALLOC
+		if (msgq->pool == NULL) {
+			msgq->pool = k_calloc(msg_count, msg_size);
+			msgq->is_dynamic_allocation = TRUE;
+		}
+#endif
 		if (msgq->pool == NULL) {
 			k_mem_slab_free(&cv2_msgq_slab, (void *) &msgq);
 			return NULL;
 		}
-		msgq->is_dynamic_allocation = TRUE;
 	} else {
 		msgq->pool = attr->mq_mem;
 		msgq->is_dynamic_allocation = FALSE;
@@ -271,6 +297,11 @@ osStatus_t osMessageQueueDelete(osMessageQueueId_t msgq_id)
 	 * supported in Zephyr.
 	 */
 
+#if CONFIG_CMSIS_V2_MSGQ_PREALLOC_COUNT != 0
+	if (msgq->is_prealloc_pool) {
+		k_mem_slab_free(&cv2_msgq_pool_slab, (void *)&msgq->pool);
+	}
+#endif
 	if (msgq->is_dynamic_allocation) {
 		k_free(msgq->pool);
 	}
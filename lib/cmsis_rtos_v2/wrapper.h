@@ -49,6 +49,7 @@ struct cv2_mslab {
 	struct k_mem_slab z_mslab;
 	void *pool;
 	char is_dynamic_allocation;
+	char is_prealloc_pool;
 	char name[16];
 };
 
@@ -56,6 +57,7 @@ struct cv2_msgq {
 	struct k_msgq z_msgq;
 	void *pool;
 	char is_dynamic_allocation;
+	char is_prealloc_pool;
 	char name[16];
 };
 
@@ -46,4 +46,41 @@
 
 int     fnmatch(const char *, const char *, int);
 
+#ifdef CONFIG_FNMATCH_COMPILE
+
+/* Compiled pattern representation (Zephyr extension, fnmatch_compile.c).
+ *
+ * A pattern that is matched against many strings can be compiled once
+ * and executed repeatedly with fnmatch_match(), avoiding the per-call
+ * reparsing (and recursion) of fnmatch().  Only patterns using the
+ * default semantics (flags 0 or FNM_NOESCAPE) can be compiled; for
+ * anything else fnmatch_compile() returns FNM_NOSYS and the caller
+ * should fall back to fnmatch().
+ */
+
+#define FNM_COMPILE_MAX_OPS    32   /* literal/any/star elements */
+#define FNM_COMPILE_MAX_SETS   4    /* [...] bracket expressions */
+
+struct fnmatch_op {
+    unsigned char type;             /* FNM_OP_* */
+    unsigned char arg;              /* literal char or set index */
+};
+
+struct fnmatch_set {
+    unsigned char bits[256 / 8];
+};
+
+struct fnmatch_pattern {
+    unsigned char nops;
+    unsigned char nsets;
+    struct fnmatch_op ops[FNM_COMPILE_MAX_OPS];
+    struct fnmatch_set sets[FNM_COMPILE_MAX_SETS];
+};
+
+int     fnmatch_compile(const char *pattern, int flags,
+                        struct fnmatch_pattern *pc);
+int     fnmatch_match(const struct fnmatch_pattern *pc, const char *string);
+
+#endif /* CONFIG_FNMATCH_COMPILE */
+
 #endif /* !_FNMATCH_H_ */
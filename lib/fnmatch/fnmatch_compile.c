@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Compiled-pattern companion to fnmatch().
+ *
+ * fnmatch() reinterprets the pattern string on every call and recurses
+ * for each '*'.  Callers that match one pattern against many candidate
+ * strings (e.g. shell wildcard expansion walking the command tree) pay
+ * that cost per candidate.  fnmatch_compile() parses the pattern once
+ * into a flat op array; fnmatch_match() then runs it iteratively with
+ * classic single-backtrack-point glob matching, which is linear in
+ * practice and never recurses.
+ *
+ * Only the default matching semantics are supported (flags 0 or
+ * FNM_NOESCAPE).  Patterns needing FNM_PATHNAME/PERIOD/CASEFOLD
+ * handling, or with edge cases this representation does not model
+ * (trailing backslash, unterminated bracket expression), make
+ * fnmatch_compile() return FNM_NOSYS so the caller can fall back to
+ * plain fnmatch(), whose behaviour remains authoritative.
+ */
+
+#include "fnmatch.h"
+#include <string.h>
+
+#define EOS '\0'
+
+enum {
+	FNM_OP_CHAR,	/* match exactly ops[i].arg */
+	FNM_OP_ANY,	/* match any single character ('?') */
+	FNM_OP_STAR,	/* match any run of characters ('*') */
+	FNM_OP_SET,	/* match set sets[ops[i].arg] ('[...]') */
+};
+
+static void set_add(struct fnmatch_set *set, unsigned char c)
+{
+	set->bits[c / 8] |= 1U << (c % 8);
+}
+
+static int set_has(const struct fnmatch_set *set, unsigned char c)
+{
+	return (set->bits[c / 8] >> (c % 8)) & 1U;
+}
+
+/* Parses a '[...]' bracket expression (pattern points past the '[')
+ * into *set, mirroring the semantics of rangematch() in fnmatch.c.
+ * Returns the position past the closing ']', or NULL when the
+ * expression cannot be represented and the caller must fall back.
+ */
+static const char *compile_set(const char *pattern, int flags,
+			       struct fnmatch_set *set)
+{
+	int negate;
+	char c, c2;
+	int need = 1;
+
+	(void)memset(set, 0, sizeof(*set));
+
+	if ((negate = (*pattern == '!' || *pattern == '^')) != 0) {
+		++pattern;
+	}
+
+	for (; (c = *pattern++) != ']' || need;) {
+		need = 0;
+		if (c == '/') {
+			/* rangematch() has dedicated literal-'['
+			 * fallback behaviour here; punt to fnmatch()
+			 */
+			return NULL;
+		}
+		if (c == '\\' && !(flags & FNM_NOESCAPE)) {
+			c = *pattern++;
+		}
+		if (c == EOS) {
+			return NULL;
+		}
+		if (*pattern == '-' && (c2 = *(pattern + 1)) != EOS &&
+		    c2 != ']') {
+			pattern += 2;
+			if (c2 == '\\' && !(flags & FNM_NOESCAPE)) {
+				c2 = *pattern++;
+			}
+			if (c2 == EOS) {
+				return NULL;
+			}
+			for (int i = (unsigned char)c;
+			     i <= (unsigned char)c2; i++) {
+				set_add(set, (unsigned char)i);
+			}
+		} else {
+			set_add(set, (unsigned char)c);
+		}
+	}
+
+	if (negate) {
+		for (size_t i = 0; i < sizeof(set->bits); i++) {
+			set->bits[i] = (unsigned char)~set->bits[i];
+		}
+	}
+
+	return pattern;
+}
+
+int fnmatch_compile(const char *pattern, int flags, struct fnmatch_pattern *pc)
+{
+	char c;
+
+	if (pattern == NULL || pc == NULL) {
+		return FNM_NOSYS;
+	}
+
+	if ((flags & ~FNM_NOESCAPE) != 0) {
+		return FNM_NOSYS;
+	}
+
+	pc->nops = 0;
+	pc->nsets = 0;
+
+	while ((c = *pattern++) != EOS) {
+		struct fnmatch_op op;
+
+		switch (c) {
+		case '*':
+			/* Collapse multiple stars */
+			if (pc->nops > 0 &&
+			    pc->ops[pc->nops - 1].type == FNM_OP_STAR) {
+				continue;
+			}
+			op.type = FNM_OP_STAR;
+			op.arg = 0;
+			break;
+		case '?':
+			op.type = FNM_OP_ANY;
+			op.arg = 0;
+			break;
+		case '[':
+			if (pc->nsets >= FNM_COMPILE_MAX_SETS) {
+				return FNM_NORES;
+			}
+			pattern = compile_set(pattern, flags,
+					      &pc->sets[pc->nsets]);
+			if (pattern == NULL) {
+				return FNM_NOSYS;
+			}
+			op.type = FNM_OP_SET;
+			op.arg = pc->nsets++;
+			break;
+		case '\\':
+			if (!(flags & FNM_NOESCAPE)) {
+				c = *pattern++;
+				if (c == EOS) {
+					/* fnmatch() has odd trailing
+					 * backslash behaviour; punt
+					 */
+					return FNM_NOSYS;
+				}
+			}
+			/* FALLTHROUGH */
+		default:
+			op.type = FNM_OP_CHAR;
+			op.arg = (unsigned char)c;
+			break;
+		}
+
+		if (pc->nops >= FNM_COMPILE_MAX_OPS) {
+			return FNM_NORES;
+		}
+		pc->ops[pc->nops++] = op;
+	}
+
+	return 0;
+}
+
+static int op_match(const struct fnmatch_pattern *pc,
+		    const struct fnmatch_op *op, unsigned char c)
+{
+	switch (op->type) {
+	case FNM_OP_CHAR:
+		return op->arg == c;
+	case FNM_OP_ANY:
+		return 1;
+	case FNM_OP_SET:
+		return set_has(&pc->sets[op->arg], c);
+	default:
+		return 0;
+	}
+}
+
+int fnmatch_match(const struct fnmatch_pattern *pc, const char *string)
+{
+	const char *s = string;
+	const char *star_s = NULL;
+	int oi = 0;
+	int star_oi = -1;
+
+	if (pc == NULL || string == NULL) {
+		return FNM_NOMATCH;
+	}
+
+	while (*s != EOS) {
+		if (oi < pc->nops) {
+			const struct fnmatch_op *op = &pc->ops[oi];
+
+			if (op->type == FNM_OP_STAR) {
+				/* Tentatively match zero characters,
+				 * remember where to resume on failure
+				 */
+				star_oi = oi++;
+				star_s = s;
+				continue;
+			}
+			if (op_match(pc, op, (unsigned char)*s)) {
+				oi++;
+				s++;
+				continue;
+			}
+		}
+		if (star_oi >= 0) {
+			/* Backtrack: let the last star consume one
+			 * more character
+			 */
+			oi = star_oi + 1;
+			s = ++star_s;
+			continue;
+		}
+		return FNM_NOMATCH;
+	}
+
+	/* Trailing stars match the empty remainder */
+	while (oi < pc->nops && pc->ops[oi].type == FNM_OP_STAR) {
+		oi++;
+	}
+
+	return oi == pc->nops ? 0 : FNM_NOMATCH;
+}
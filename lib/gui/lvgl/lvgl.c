@@ -33,10 +33,17 @@ static lv_disp_buf_t disp_buf;
  * uint16_t * or uint32_t *, therefore buffer needs to be aligned accordingly to
  * prevent unaligned memory accesses.
  */
+#ifdef CONFIG_LVGL_VDB_CUSTOM_SECTION
+static uint8_t buf0[BUFFER_SIZE] __aligned(4) Z_GENERIC_SECTION(.lvgl_buf);
+#ifdef CONFIG_LVGL_DOUBLE_VDB
+static uint8_t buf1[BUFFER_SIZE] __aligned(4) Z_GENERIC_SECTION(.lvgl_buf);
+#endif
+#else
 static uint8_t buf0[BUFFER_SIZE] __aligned(4);
 #ifdef CONFIG_LVGL_DOUBLE_VDB
 static uint8_t buf1[BUFFER_SIZE] __aligned(4);
 #endif
+#endif /* CONFIG_LVGL_VDB_CUSTOM_SECTION */
 
 #endif /* CONFIG_LVGL_BUFFER_ALLOC_STATIC */
 
@@ -6,6 +6,40 @@
 
 #include "lvgl_display.h"
 
+#ifdef CONFIG_LVGL_ASYNC_FLUSH
+static void lvgl_flush_done_cb(const struct device *dev, int result,
+			       void *user_data)
+{
+	lv_disp_flush_ready(user_data);
+}
+#endif
+
+void lvgl_flush_display(struct _disp_drv_t *disp_drv, uint16_t x, uint16_t y,
+			const struct display_buffer_descriptor *desc,
+			void *buf)
+{
+	const struct device *display_dev =
+		(const struct device *)disp_drv->user_data;
+
+#ifdef CONFIG_LVGL_VSYNC
+	(void)display_wait_vsync(display_dev);
+#endif
+
+#ifdef CONFIG_LVGL_ASYNC_FLUSH
+	if (display_write_async(display_dev, x, y, desc, buf,
+				lvgl_flush_done_cb, disp_drv) == 0) {
+		/* lv_disp_flush_ready() is called once the region has
+		 * been shifted out; LVGL renders the next one meanwhile.
+		 */
+		return;
+	}
+#else
+	display_write(display_dev, x, y, desc, buf);
+#endif
+
+	lv_disp_flush_ready(disp_drv);
+}
+
 int set_lvgl_rendering_cb(lv_disp_drv_t *disp_drv)
 {
 	int err = 0;
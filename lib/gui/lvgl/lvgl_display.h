@@ -38,6 +38,9 @@ void lvgl_set_px_cb_32bit(struct _disp_drv_t *disp_drv,
 
 void lvgl_rounder_cb_mono(struct _disp_drv_t *disp_drv, lv_area_t *area);
 
+void lvgl_flush_display(struct _disp_drv_t *disp_drv, uint16_t x, uint16_t y,
+		const struct display_buffer_descriptor *desc, void *buf);
+
 int set_lvgl_rendering_cb(lv_disp_drv_t *disp_drv);
 
 #ifdef __cplusplus
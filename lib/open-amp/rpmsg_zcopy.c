@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020 STMicroelectronics
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <rpmsg_zcopy.h>
+
+void *rpmsg_zcopy_claim(struct rpmsg_endpoint *ept, uint32_t *size, int wait)
+{
+	return rpmsg_get_tx_payload_buffer(ept, size, wait);
+}
+
+int rpmsg_zcopy_send(struct rpmsg_endpoint *ept, void *buf, size_t len)
+{
+	return rpmsg_send_nocopy(ept, buf, len);
+}
+
+static void kick_batch_timeout(struct k_timer *timer)
+{
+	struct rpmsg_kick_batch *kb =
+		CONTAINER_OF(timer, struct rpmsg_kick_batch, timer);
+
+	rpmsg_kick_batch_flush(kb);
+}
+
+void rpmsg_kick_batch_init(struct rpmsg_kick_batch *kb,
+			   void (*kick)(void *arg), void *arg,
+			   uint32_t batch, k_timeout_t latency)
+{
+	kb->kick = kick;
+	kb->arg = arg;
+	kb->batch = batch;
+	kb->latency = latency;
+	atomic_set(&kb->pending, 0);
+	k_timer_init(&kb->timer, kick_batch_timeout, NULL);
+}
+
+void rpmsg_kick_batch_notify(struct rpmsg_kick_batch *kb)
+{
+	atomic_val_t pending = atomic_inc(&kb->pending) + 1;
+
+	if ((uint32_t)pending >= kb->batch) {
+		rpmsg_kick_batch_flush(kb);
+	} else if (pending == 1) {
+		/* First deferred notification: bound its latency */
+		k_timer_start(&kb->timer, kb->latency, K_NO_WAIT);
+	}
+}
+
+void rpmsg_kick_batch_flush(struct rpmsg_kick_batch *kb)
+{
+	/* A flush that observes no pending notifications (e.g. timer
+	 * racing a threshold flush) must not kick: the remote side
+	 * was already signalled for everything enqueued so far.
+	 */
+	if (atomic_set(&kb->pending, 0) == 0) {
+		return;
+	}
+
+	k_timer_stop(&kb->timer);
+	kb->kick(kb->arg);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020 STMicroelectronics
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef RPMSG_ZCOPY_H__
+#define RPMSG_ZCOPY_H__
+
+#include <zephyr.h>
+#include <openamp/rpmsg.h>
+
+/*
+ * Zero-copy RPMsg helpers.
+ *
+ * The usual rpmsg_send() path copies the application payload into a
+ * vring buffer and raises one inter-core interrupt per message.  For
+ * high throughput pipelines both costs dominate: the copy because the
+ * data was just produced into application memory, the interrupt
+ * because the remote core is woken for every descriptor.
+ *
+ * rpmsg_zcopy_claim()/rpmsg_zcopy_send() let the application produce
+ * its payload directly in the vring buffer, eliminating the copy.
+ * struct rpmsg_kick_batch coalesces virtqueue notifications so the
+ * IPM signal is raised once per batch (or after a bounded latency)
+ * instead of once per message.
+ */
+
+/**
+ * @brief Claim a transmit buffer for in-place payload construction
+ *
+ * Returns a pointer into the next free vring transmit buffer.  The
+ * application writes its payload directly into it and passes it to
+ * rpmsg_zcopy_send(); the buffer must not be used after that.  The
+ * pinned open-amp version has no way to return an unused claimed
+ * buffer, so claim only when a send is certain to follow.
+ *
+ * @param ept RPMsg endpoint to transmit on
+ * @param size Output: usable payload capacity of the buffer in bytes
+ * @param wait Non-zero to block until a buffer is available
+ * @return Buffer pointer, or NULL if none is available
+ */
+void *rpmsg_zcopy_claim(struct rpmsg_endpoint *ept, uint32_t *size, int wait);
+
+/**
+ * @brief Send a payload built in a claimed buffer, without copying
+ *
+ * @param ept RPMsg endpoint the buffer was claimed from
+ * @param buf Buffer returned by rpmsg_zcopy_claim()
+ * @param len Number of payload bytes written into the buffer
+ * @return Number of bytes sent on success, negative errno otherwise
+ */
+int rpmsg_zcopy_send(struct rpmsg_endpoint *ept, void *buf, size_t len);
+
+/**
+ * @brief Batched virtqueue kick state
+ *
+ * Platform glue normally raises the inter-core signal from its
+ * virtio notify callback, once per enqueued descriptor.  Route the
+ * callback through rpmsg_kick_batch_notify() instead and the signal
+ * is deferred until either @a batch descriptors have accumulated or
+ * @a latency has elapsed since the first deferred one, whichever
+ * comes first.
+ */
+struct rpmsg_kick_batch {
+	void (*kick)(void *arg);	/* raises the actual IPM signal */
+	void *arg;
+	uint32_t batch;
+	k_timeout_t latency;
+	atomic_t pending;
+	struct k_timer timer;
+};
+
+/**
+ * @brief Initialize a kick batching context
+ *
+ * @param kb Batch state to initialize
+ * @param kick Function raising the inter-core signal (e.g. an
+ *             ipm_send() wrapper)
+ * @param arg Context pointer passed back to @a kick
+ * @param batch Number of notifications that forces an immediate kick
+ * @param latency Upper bound on how long a notification may be
+ *                deferred waiting for the batch to fill
+ */
+void rpmsg_kick_batch_init(struct rpmsg_kick_batch *kb,
+			   void (*kick)(void *arg), void *arg,
+			   uint32_t batch, k_timeout_t latency);
+
+/**
+ * @brief Record a virtqueue notification, kicking when due
+ *
+ * Safe to call from any context, including the virtio notify
+ * callback.
+ *
+ * @param kb Batch state
+ */
+void rpmsg_kick_batch_notify(struct rpmsg_kick_batch *kb);
+
+/**
+ * @brief Immediately raise any deferred kick
+ *
+ * Call before waiting on the remote core (e.g. end of a burst) so
+ * that the final partial batch is not held back for the full latency
+ * window.
+ *
+ * @param kb Batch state
+ */
+void rpmsg_kick_batch_flush(struct rpmsg_kick_batch *kb);
+
+#endif /* RPMSG_ZCOPY_H__ */
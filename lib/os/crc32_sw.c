@@ -11,6 +11,70 @@ uint32_t crc32_ieee(const uint8_t *data, size_t len)
 	return crc32_ieee_update(0x0, data, len);
 }
 
+#ifdef CONFIG_CRC32_TABLE
+
+/* Slice-by-4 lookup tables, 4 KiB of .bss.  Built lazily on first use
+ * from the bitwise recurrence; regenerating the tables is idempotent,
+ * so a concurrent first call at worst repeats the work.
+ */
+static uint32_t crc32_table[4][256];
+static bool crc32_table_ready;
+
+static void crc32_table_init(void)
+{
+	for (uint32_t i = 0; i < 256; i++) {
+		uint32_t crc = i;
+
+		for (uint8_t j = 0; j < 8; j++) {
+			crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+		}
+
+		crc32_table[0][i] = crc;
+	}
+
+	for (uint32_t i = 0; i < 256; i++) {
+		for (int k = 1; k < 4; k++) {
+			crc32_table[k][i] = (crc32_table[k - 1][i] >> 8) ^
+				crc32_table[0][crc32_table[k - 1][i] & 0xff];
+		}
+	}
+
+	crc32_table_ready = true;
+}
+
+uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	if (!crc32_table_ready) {
+		crc32_table_init();
+	}
+
+	crc = ~crc;
+
+	/* Bytes are assembled into a little-endian word explicitly, so
+	 * this works regardless of target endianness or data alignment;
+	 * on little-endian targets the compiler merges the loads.
+	 */
+	while (len >= 4) {
+		crc ^= (uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+		       ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+		crc = crc32_table[3][crc & 0xff] ^
+		      crc32_table[2][(crc >> 8) & 0xff] ^
+		      crc32_table[1][(crc >> 16) & 0xff] ^
+		      crc32_table[0][(crc >> 24) & 0xff];
+		data += 4;
+		len -= 4;
+	}
+
+	while (len > 0) {
+		crc = (crc >> 8) ^ crc32_table[0][(crc ^ *data++) & 0xff];
+		len--;
+	}
+
+	return (~crc);
+}
+
+#else /* CONFIG_CRC32_TABLE */
+
 uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
 {
 	crc = ~crc;
@@ -24,3 +88,5 @@ uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
 
 	return (~crc);
 }
+
+#endif /* CONFIG_CRC32_TABLE */
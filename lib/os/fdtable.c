@@ -54,13 +54,6 @@ static struct fd_entry fdtable[CONFIG_POSIX_MAX_FDS] = {
 #endif
 };
 
-static K_MUTEX_DEFINE(fdtable_lock);
-
-static int z_fd_ref(int fd)
-{
-	return atomic_inc(&fdtable[fd].refcount) + 1;
-}
-
 static int z_fd_unref(int fd)
 {
 	atomic_val_t old_rc;
@@ -75,32 +68,24 @@ static int z_fd_unref(int fd)
 		if (!old_rc) {
 			return 0;
 		}
+
+		/* Clear the entry before the last reference is dropped,
+		 * otherwise a concurrent z_reserve_fd() could claim the
+		 * entry and have its contents overwritten afterwards.
+		 */
+		if (old_rc == 1) {
+			fdtable[fd].obj = NULL;
+			fdtable[fd].vtable = NULL;
+		}
 	} while (!atomic_cas(&fdtable[fd].refcount, old_rc, old_rc - 1));
 
 	if (old_rc != 1) {
 		return old_rc - 1;
 	}
 
-	fdtable[fd].obj = NULL;
-	fdtable[fd].vtable = NULL;
-
 	return 0;
 }
 
-static int _find_fd_entry(void)
-{
-	int fd;
-
-	for (fd = 0; fd < ARRAY_SIZE(fdtable); fd++) {
-		if (!atomic_get(&fdtable[fd].refcount)) {
-			return fd;
-		}
-	}
-
-	errno = ENFILE;
-	return -1;
-}
-
 static int _check_fd(int fd)
 {
 	if (fd < 0 || fd >= ARRAY_SIZE(fdtable)) {
@@ -154,19 +139,20 @@ int z_reserve_fd(void)
 {
 	int fd;
 
-	(void)k_mutex_lock(&fdtable_lock, K_FOREVER);
-
-	fd = _find_fd_entry();
-	if (fd >= 0) {
-		/* Mark entry as used, z_finalize_fd() will fill it in. */
-		(void)z_fd_ref(fd);
-		fdtable[fd].obj = NULL;
-		fdtable[fd].vtable = NULL;
+	for (fd = 0; fd < ARRAY_SIZE(fdtable); fd++) {
+		/* Claim the entry by taking the first reference, no lock
+		 * is needed as the zero to one transition can only be won
+		 * by one caller. z_finalize_fd() will fill the entry in.
+		 */
+		if (atomic_cas(&fdtable[fd].refcount, 0, 1)) {
+			fdtable[fd].obj = NULL;
+			fdtable[fd].vtable = NULL;
+			return fd;
+		}
 	}
 
-	k_mutex_unlock(&fdtable_lock);
-
-	return fd;
+	errno = ENFILE;
+	return -1;
 }
 
 void z_finalize_fd(int fd, void *obj, const struct fd_op_vtable *vtable)
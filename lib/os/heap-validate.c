@@ -60,7 +60,7 @@ static inline void check_nexts(struct z_heap *h, int bidx)
 {
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
-	bool emptybit = (h->avail_buckets & (1 << bidx)) == 0;
+	bool emptybit = !bucket_avail(h, bidx);
 	bool emptylist = b->next == 0;
 	bool empties_match = emptybit == emptylist;
 
@@ -107,7 +107,7 @@ bool sys_heap_validate(struct sys_heap *heap)
 			set_chunk_used(h, c, true);
 		}
 
-		bool empty = (h->avail_buckets & (1 << b)) == 0;
+		bool empty = !bucket_avail(h, b);
 		bool zero = n == 0;
 
 		if (empty != zero) {
@@ -334,8 +334,8 @@ void heap_dump(struct z_heap *h)
 			} while (curr != first);
 		}
 
-		printk("bucket %d (min %d units): %d chunks\n", i,
-		       (1 << i) - 1 + min_chunk_size(h), count);
+		printk("bucket %d (min %zd units): %d chunks\n", i,
+		       bucket_min_size(h, i), count);
 	}
 
 	for (chunkid_t c = 0; ; c = right_chunk(h, c)) {
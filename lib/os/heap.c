@@ -23,11 +23,11 @@ static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 
 	CHECK(!chunk_used(h, c));
 	CHECK(b->next != 0);
-	CHECK(h->avail_buckets & (1 << bidx));
+	CHECK(bucket_avail(h, bidx));
 
 	if (next_free_chunk(h, c) == c) {
 		/* this is the last chunk */
-		h->avail_buckets &= ~(1 << bidx);
+		clear_bucket_avail(h, bidx);
 		b->next = 0;
 	} else {
 		chunkid_t first = prev_free_chunk(h, c),
@@ -52,15 +52,15 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 	struct z_heap_bucket *b = &h->buckets[bidx];
 
 	if (b->next == 0U) {
-		CHECK((h->avail_buckets & (1 << bidx)) == 0);
+		CHECK(!bucket_avail(h, bidx));
 
 		/* Empty list, first item */
-		h->avail_buckets |= (1 << bidx);
+		set_bucket_avail(h, bidx);
 		b->next = c;
 		set_prev_free_chunk(h, c, c);
 		set_next_free_chunk(h, c, c);
 	} else {
-		CHECK(h->avail_buckets & (1 << bidx));
+		CHECK(bucket_avail(h, bidx));
 
 		/* Insert before (!) the "next" pointer */
 		chunkid_t second = b->next;
@@ -162,6 +162,10 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
+#ifdef CONFIG_SYS_HEAP_PROFILE
+	z_heap_profile_free(mem);
+#endif
+
 	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
@@ -206,10 +210,9 @@ static chunkid_t alloc_chunk(struct z_heap *h, size_t sz)
 	/* Otherwise pick the smallest non-empty bucket guaranteed to
 	 * fit and use that unconditionally.
 	 */
-	size_t bmask = h->avail_buckets & ~((1 << (bi + 1)) - 1);
+	int minbucket = next_avail_bucket(h, bi);
 
-	if ((bmask & h->avail_buckets) != 0U) {
-		int minbucket = __builtin_ctz(bmask & h->avail_buckets);
+	if (minbucket >= 0) {
 		chunkid_t c = h->buckets[minbucket].next;
 
 		free_list_remove_bidx(h, c, minbucket);
@@ -240,7 +243,13 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	set_chunk_used(h, c, true);
-	return chunk_mem(h, c);
+
+	void *mem = chunk_mem(h, c);
+
+#ifdef CONFIG_SYS_HEAP_PROFILE
+	z_heap_profile_alloc(__builtin_return_address(0), mem, bytes);
+#endif
+	return mem;
 }
 
 void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
@@ -290,6 +299,10 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	}
 
 	set_chunk_used(h, c, true);
+
+#ifdef CONFIG_SYS_HEAP_PROFILE
+	z_heap_profile_alloc(__builtin_return_address(0), mem, bytes);
+#endif
 	return mem;
 }
 
@@ -315,6 +328,11 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->chunk0_hdr_area = 0;
 	h->len = buf_sz;
 	h->avail_buckets = 0;
+#ifdef CONFIG_SYS_HEAP_TLSF
+	for (int i = 0; i < (int)ARRAY_SIZE(h->sl_avail); i++) {
+		h->sl_avail[i] = 0;
+	}
+#endif
 
 	int nb_buckets = bucket_idx(h, buf_sz) + 1;
 	size_t chunk0_size = chunksz(sizeof(struct z_heap) +
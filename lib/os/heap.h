@@ -57,10 +57,25 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+/* In the default configuration there is one free list bucket per
+ * power-of-two size category and avail_buckets holds one bit per
+ * bucket.  With CONFIG_SYS_HEAP_TLSF each power of two is subdivided
+ * into four sub-buckets keyed on the next two size bits (a "two level
+ * segregated fit" in the literature); avail_buckets then becomes the
+ * first-level bitmap (one bit per power of two) and sl_avail[] holds
+ * the four valid bits for each level.
+ */
+#ifdef CONFIG_SYS_HEAP_TLSF
+#define Z_HEAP_SL_BITS 2
+#endif
+
 struct z_heap {
 	uint64_t chunk0_hdr_area;  /* matches the largest header */
 	uint32_t len;
 	uint32_t avail_buckets;
+#ifdef CONFIG_SYS_HEAP_TLSF
+	uint8_t sl_avail[32];
+#endif
 	struct z_heap_bucket buckets[0];
 };
 
@@ -226,10 +241,125 @@ static inline int min_chunk_size(struct z_heap *h)
 static inline int bucket_idx(struct z_heap *h, size_t sz)
 {
 	size_t usable_sz = sz - min_chunk_size(h) + 1;
-	return 31 - __builtin_clz(usable_sz);
+	int fl = 31 - __builtin_clz(usable_sz);
+
+#ifdef CONFIG_SYS_HEAP_TLSF
+	int sl = fl >= Z_HEAP_SL_BITS ?
+		(int)((usable_sz >> (fl - Z_HEAP_SL_BITS)) &
+		      ((1U << Z_HEAP_SL_BITS) - 1U)) : 0;
+
+	return (fl << Z_HEAP_SL_BITS) + sl;
+#else
+	return fl;
+#endif
 }
 
+/* Smallest chunk size (in units) that maps to the given bucket */
+static inline size_t bucket_min_size(struct z_heap *h, int bidx)
+{
+#ifdef CONFIG_SYS_HEAP_TLSF
+	int fl = bidx >> Z_HEAP_SL_BITS;
+	size_t usable = (size_t)1 << fl;
+
+	if (fl >= Z_HEAP_SL_BITS) {
+		usable += (size_t)(bidx & ((1 << Z_HEAP_SL_BITS) - 1))
+			<< (fl - Z_HEAP_SL_BITS);
+	}
+
+	return usable - 1 + min_chunk_size(h);
+#else
+	return ((size_t)1 << bidx) - 1 + min_chunk_size(h);
+#endif
+}
+
+/* Accessors for the free bucket availability bitmap(s).  All buckets
+ * strictly above a given index hold only chunks that are guaranteed
+ * to satisfy a request mapping to that index, in both configurations.
+ */
+#ifdef CONFIG_SYS_HEAP_TLSF
+
+static inline bool bucket_avail(struct z_heap *h, int bidx)
+{
+	return (h->sl_avail[bidx >> Z_HEAP_SL_BITS] >>
+		(bidx & ((1 << Z_HEAP_SL_BITS) - 1))) & 1U;
+}
+
+static inline void set_bucket_avail(struct z_heap *h, int bidx)
+{
+	int fl = bidx >> Z_HEAP_SL_BITS;
+
+	h->sl_avail[fl] |= 1U << (bidx & ((1 << Z_HEAP_SL_BITS) - 1));
+	h->avail_buckets |= 1U << fl;
+}
+
+static inline void clear_bucket_avail(struct z_heap *h, int bidx)
+{
+	int fl = bidx >> Z_HEAP_SL_BITS;
+
+	h->sl_avail[fl] &= ~(1U << (bidx & ((1 << Z_HEAP_SL_BITS) - 1)));
+	if (h->sl_avail[fl] == 0U) {
+		h->avail_buckets &= ~(1U << fl);
+	}
+}
+
+/* Returns the smallest non-empty bucket with an index strictly
+ * greater than bidx, or -1 if they are all empty.  Two bitmap scans,
+ * so constant time regardless of heap state.
+ */
+static inline int next_avail_bucket(struct z_heap *h, int bidx)
+{
+	int fl = bidx >> Z_HEAP_SL_BITS;
+	int sl = bidx & ((1 << Z_HEAP_SL_BITS) - 1);
+	uint32_t slm = h->sl_avail[fl] & ~((1U << (sl + 1)) - 1U);
+
+	if (slm != 0U) {
+		return (fl << Z_HEAP_SL_BITS) + __builtin_ctz(slm);
+	}
+
+	uint32_t flm = h->avail_buckets &
+		(fl >= 31 ? 0U : ~0U << (fl + 1));
+
+	if (flm == 0U) {
+		return -1;
+	}
+
+	fl = __builtin_ctz(flm);
+	return (fl << Z_HEAP_SL_BITS) + __builtin_ctz(h->sl_avail[fl]);
+}
+
+#else /* CONFIG_SYS_HEAP_TLSF */
+
+static inline bool bucket_avail(struct z_heap *h, int bidx)
+{
+	return (h->avail_buckets & (1U << bidx)) != 0U;
+}
+
+static inline void set_bucket_avail(struct z_heap *h, int bidx)
+{
+	h->avail_buckets |= 1U << bidx;
+}
+
+static inline void clear_bucket_avail(struct z_heap *h, int bidx)
+{
+	h->avail_buckets &= ~(1U << bidx);
+}
+
+static inline int next_avail_bucket(struct z_heap *h, int bidx)
+{
+	uint32_t bmask = h->avail_buckets & ~((1U << (bidx + 1)) - 1U);
+
+	return bmask != 0U ? __builtin_ctz(bmask) : -1;
+}
+
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
 /* For debugging */
 void heap_dump(struct z_heap *h);
 
+#ifdef CONFIG_SYS_HEAP_PROFILE
+/* Allocation profiling hooks, see heap_profile.c */
+void z_heap_profile_alloc(void *site, void *mem, size_t bytes);
+void z_heap_profile_free(void *mem);
+#endif
+
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <kernel.h>
+#include <sys/heap_arena.h>
+
+/* Each block carries a hidden word ahead of the user pointer holding
+ * the index of the stripe it came from, with the low bit set when the
+ * block was rounded up to the cache block size and so may be parked
+ * in the stripe cache on free.
+ */
+#define ARENA_TAG_CACHEABLE	0x1UL
+
+static inline uintptr_t *block_tag(void *mem)
+{
+	return &((uintptr_t *)mem)[-1];
+}
+
+static inline struct sys_heap_arena_stripe *
+curr_stripe(struct sys_heap_arena *arena)
+{
+	/* Hash the thread pointer so different threads usually land
+	 * on different stripes.  Drop the low bits, which are mostly
+	 * alignment zeroes.
+	 */
+	uintptr_t hash = (uintptr_t)k_current_get() >> 6;
+
+	return &arena->stripes[hash % arena->n_stripes];
+}
+
+void sys_heap_arena_init(struct sys_heap_arena *arena,
+			 struct sys_heap_arena_stripe *stripes,
+			 uint32_t n_stripes, void *mem, size_t bytes,
+			 size_t cache_block_size)
+{
+	size_t stripe_bytes = bytes / n_stripes;
+	char *p = mem;
+
+	arena->stripes = stripes;
+	arena->n_stripes = n_stripes;
+	arena->cache_block_size = cache_block_size;
+
+	for (uint32_t i = 0; i < n_stripes; i++) {
+		k_heap_init(&stripes[i].heap, p, stripe_bytes);
+		for (int s = 0; s < CONFIG_SYS_HEAP_ARENA_CACHE_SLOTS; s++) {
+			(void)atomic_ptr_set(&stripes[i].cache[s], NULL);
+		}
+		p += stripe_bytes;
+	}
+}
+
+void *sys_heap_arena_alloc(struct sys_heap_arena *arena, size_t bytes,
+			   k_timeout_t timeout)
+{
+	struct sys_heap_arena_stripe *stripe = curr_stripe(arena);
+	uint32_t idx = stripe - arena->stripes;
+	bool cacheable = bytes <= arena->cache_block_size;
+	uintptr_t *blk;
+
+	if (cacheable) {
+		for (int s = 0; s < CONFIG_SYS_HEAP_ARENA_CACHE_SLOTS; s++) {
+			/* Exchange, not read-then-clear: two
+			 * allocators can't pop the same block.
+			 */
+			void *mem = atomic_ptr_set(&stripe->cache[s], NULL);
+
+			if (mem != NULL) {
+				return mem;
+			}
+		}
+
+		/* All cached blocks are interchangeable on this
+		 * stripe, so freed ones can satisfy any small request.
+		 */
+		bytes = arena->cache_block_size;
+	}
+
+	blk = k_heap_alloc(&stripe->heap, bytes + sizeof(uintptr_t), timeout);
+	if (blk == NULL) {
+		return NULL;
+	}
+
+	blk[0] = ((uintptr_t)idx << 1) |
+		 (cacheable ? ARENA_TAG_CACHEABLE : 0UL);
+	return &blk[1];
+}
+
+void sys_heap_arena_free(struct sys_heap_arena *arena, void *mem)
+{
+	struct sys_heap_arena_stripe *stripe;
+	uintptr_t tag;
+
+	if (mem == NULL) {
+		return;
+	}
+
+	tag = *block_tag(mem);
+	stripe = &arena->stripes[tag >> 1];
+
+	if ((tag & ARENA_TAG_CACHEABLE) != 0UL) {
+		for (int s = 0; s < CONFIG_SYS_HEAP_ARENA_CACHE_SLOTS; s++) {
+			if (atomic_ptr_cas(&stripe->cache[s], NULL, mem)) {
+				return;
+			}
+		}
+	}
+
+	k_heap_free(&stripe->heap, block_tag(mem));
+}
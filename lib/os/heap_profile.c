@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Call-site attributed sys_heap allocation profiling
+ *
+ * Records, per allocating call site (keyed by return address), the
+ * number of allocations and frees plus live and peak sampled bytes.
+ * Attribution of frees back to the allocating site goes through a
+ * small table of sampled live allocations keyed by user pointer.
+ * Both tables are fixed size; when they overflow, events are counted
+ * as dropped rather than blocking the allocator, so the numbers are
+ * a lower bound under pressure (and, with sampling, an estimate by
+ * design).
+ */
+
+#include <kernel.h>
+#include <string.h>
+#include <sys/sys_heap.h>
+#include <sys/printk.h>
+#include "heap.h"
+
+#ifdef CONFIG_SYS_HEAP_PROFILE_SHELL
+#include <shell/shell.h>
+#include <stdlib.h>
+#endif
+
+struct profile_site {
+	void *site;		/* return address of the allocating call */
+	uint32_t allocs;
+	uint32_t frees;
+	uint32_t live;		/* bytes currently allocated (sampled) */
+	uint32_t peak;		/* high watermark of live */
+};
+
+struct profile_live {
+	void *mem;
+	uint32_t bytes;
+	uint16_t site;		/* index into sites[] */
+};
+
+static struct profile_site sites[CONFIG_SYS_HEAP_PROFILE_SITES];
+static struct profile_live live[CONFIG_SYS_HEAP_PROFILE_LIVE];
+static uint32_t dropped_sites;
+static uint32_t dropped_live;
+static uint32_t sample_down = CONFIG_SYS_HEAP_PROFILE_SAMPLE;
+static struct k_spinlock profile_lock;
+
+static uint32_t ptr_hash(void *p)
+{
+	/* Fibonacci hashing; low bits of code/heap addresses are
+	 * mostly aligned zeros, so shift them out first
+	 */
+	return (uint32_t)(((uintptr_t)p >> 2) * 2654435761U);
+}
+
+/* Returns the site slot for the given return address, claiming an
+ * empty one on first sight, or -1 if the table is full.  Sites are
+ * never removed, so plain linear probing works.
+ */
+static int site_slot(void *site)
+{
+	uint32_t h = ptr_hash(site);
+
+	for (int i = 0; i < CONFIG_SYS_HEAP_PROFILE_SITES; i++) {
+		int s = (h + i) % CONFIG_SYS_HEAP_PROFILE_SITES;
+
+		if (sites[s].site == site) {
+			return s;
+		}
+		if (sites[s].site == NULL) {
+			sites[s].site = site;
+			return s;
+		}
+	}
+
+	return -1;
+}
+
+void z_heap_profile_alloc(void *site, void *mem, size_t bytes)
+{
+	if (mem == NULL) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&profile_lock);
+
+	if (--sample_down > 0) {
+		k_spin_unlock(&profile_lock, key);
+		return;
+	}
+	sample_down = CONFIG_SYS_HEAP_PROFILE_SAMPLE;
+
+	int s = site_slot(site);
+
+	if (s < 0) {
+		dropped_sites++;
+		k_spin_unlock(&profile_lock, key);
+		return;
+	}
+
+	sites[s].allocs++;
+	sites[s].live += bytes;
+	if (sites[s].live > sites[s].peak) {
+		sites[s].peak = sites[s].live;
+	}
+
+	uint32_t h = ptr_hash(mem);
+	int i;
+
+	for (i = 0; i < CONFIG_SYS_HEAP_PROFILE_LIVE; i++) {
+		int l = (h + i) % CONFIG_SYS_HEAP_PROFILE_LIVE;
+
+		if (live[l].mem == NULL) {
+			live[l].mem = mem;
+			live[l].bytes = bytes;
+			live[l].site = s;
+			break;
+		}
+	}
+	if (i == CONFIG_SYS_HEAP_PROFILE_LIVE) {
+		/* Untracked: the matching free cannot be attributed,
+		 * so this site's live count will read high
+		 */
+		dropped_live++;
+	}
+
+	k_spin_unlock(&profile_lock, key);
+}
+
+void z_heap_profile_free(void *mem)
+{
+	uint32_t h = ptr_hash(mem);
+	k_spinlock_key_t key = k_spin_lock(&profile_lock);
+
+	/* Entries are removed from the middle of probe sequences, so
+	 * a miss must scan the whole (small) table rather than stop
+	 * at the first hole.  Unsampled frees always miss; that's the
+	 * common, cheapest-possible case only when sampling is off.
+	 */
+	for (int i = 0; i < CONFIG_SYS_HEAP_PROFILE_LIVE; i++) {
+		int l = (h + i) % CONFIG_SYS_HEAP_PROFILE_LIVE;
+
+		if (live[l].mem == mem) {
+			struct profile_site *s = &sites[live[l].site];
+
+			s->frees++;
+			s->live -= live[l].bytes;
+			live[l].mem = NULL;
+			break;
+		}
+	}
+
+	k_spin_unlock(&profile_lock, key);
+}
+
+void sys_heap_profile_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&profile_lock);
+
+	(void)memset(sites, 0, sizeof(sites));
+	(void)memset(live, 0, sizeof(live));
+	dropped_sites = 0U;
+	dropped_live = 0U;
+
+	k_spin_unlock(&profile_lock, key);
+}
+
+void sys_heap_profile_dump(void)
+{
+	printk("heap profile (1 in %d allocations sampled):\n",
+	       CONFIG_SYS_HEAP_PROFILE_SAMPLE);
+
+	for (int i = 0; i < CONFIG_SYS_HEAP_PROFILE_SITES; i++) {
+		struct profile_site s;
+		k_spinlock_key_t key = k_spin_lock(&profile_lock);
+
+		s = sites[i];
+		k_spin_unlock(&profile_lock, key);
+
+		if (s.site == NULL) {
+			continue;
+		}
+
+		printk("  %p: %u allocs %u frees, live %u peak %u bytes\n",
+		       s.site, s.allocs, s.frees, s.live, s.peak);
+	}
+
+	if (dropped_sites != 0U || dropped_live != 0U) {
+		printk("  dropped: %u allocs (site table full), "
+		       "%u untracked pointers\n",
+		       dropped_sites, dropped_live);
+	}
+}
+
+#ifdef CONFIG_SYS_HEAP_PROFILE_SHELL
+
+static int cmd_heap_profile(const struct shell *shell, size_t argc,
+			    char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell, "heap profile (1 in %d allocations sampled):",
+		    CONFIG_SYS_HEAP_PROFILE_SAMPLE);
+
+	for (int i = 0; i < CONFIG_SYS_HEAP_PROFILE_SITES; i++) {
+		struct profile_site s;
+		k_spinlock_key_t key = k_spin_lock(&profile_lock);
+
+		s = sites[i];
+		k_spin_unlock(&profile_lock, key);
+
+		if (s.site == NULL) {
+			continue;
+		}
+
+		shell_print(shell,
+			    "  %p: %u allocs %u frees, live %u peak %u bytes",
+			    s.site, s.allocs, s.frees, s.live, s.peak);
+	}
+
+	if (dropped_sites != 0U || dropped_live != 0U) {
+		shell_print(shell,
+			    "  dropped: %u allocs (site table full), "
+			    "%u untracked pointers",
+			    dropped_sites, dropped_live);
+	}
+
+	return 0;
+}
+
+static int cmd_heap_profile_reset(const struct shell *shell, size_t argc,
+				  char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_heap_profile_reset();
+	shell_print(shell, "heap profile cleared");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_heap_profile,
+	SHELL_CMD(reset, NULL, "Clear recorded allocation statistics",
+		  cmd_heap_profile_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(heap_profile, &sub_heap_profile,
+		   "Dump per-call-site heap allocation statistics",
+		   cmd_heap_profile);
+
+#endif /* CONFIG_SYS_HEAP_PROFILE_SHELL */
@@ -37,6 +37,84 @@ int hex2char(uint8_t x, char *c)
 	return 0;
 }
 
+#ifdef CONFIG_HEX_FAST
+
+static const char hex_chars[16] = "0123456789abcdef";
+
+/* 255 marks a non-hex character */
+static const uint8_t hex_vals[128] = {
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255,   0,   1,
+	  2,   3,   4,   5,   6,   7,   8,   9, 255, 255,
+	255, 255, 255, 255, 255,  10,  11,  12,  13,  14,
+	 15, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255,  10,  11,  12,
+	 13,  14,  15, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255
+};
+
+size_t bin2hex(const uint8_t *buf, size_t buflen, char *hex, size_t hexlen)
+{
+	if ((hexlen + 1) < buflen * 2) {
+		return 0;
+	}
+
+	/* Straight table lookups: no per-nibble calls or branches, so
+	 * the loop compiles to a couple of loads and stores per byte.
+	 */
+	for (size_t i = 0; i < buflen; i++) {
+		hex[2 * i] = hex_chars[buf[i] >> 4];
+		hex[2 * i + 1] = hex_chars[buf[i] & 0xf];
+	}
+
+	hex[2 * buflen] = '\0';
+	return 2 * buflen;
+}
+
+size_t hex2bin(const char *hex, size_t hexlen, uint8_t *buf, size_t buflen)
+{
+	uint8_t hi, lo;
+
+	if (buflen < hexlen / 2 + hexlen % 2) {
+		return 0;
+	}
+
+	/* if hexlen is uneven, insert leading zero nibble */
+	if (hexlen % 2) {
+		lo = hex_vals[(uint8_t)hex[0] & 0x7f];
+		if (lo == 255U || ((uint8_t)hex[0] & 0x80) != 0U) {
+			return 0;
+		}
+		buf[0] = lo;
+		hex++;
+		buf++;
+	}
+
+	for (size_t i = 0; i < hexlen / 2; i++) {
+		hi = hex_vals[(uint8_t)hex[2 * i] & 0x7f];
+		lo = hex_vals[(uint8_t)hex[2 * i + 1] & 0x7f];
+
+		/* A single combined validity check per output byte; the
+		 * masking above keeps 8 bit characters from indexing
+		 * out of the table, and they decode as invalid anyway.
+		 */
+		if (hi == 255U || lo == 255U ||
+		    (((uint8_t)hex[2 * i] | (uint8_t)hex[2 * i + 1]) & 0x80) != 0U) {
+			return 0;
+		}
+
+		buf[i] = (hi << 4) | lo;
+	}
+
+	return hexlen / 2 + hexlen % 2;
+}
+
+#else /* CONFIG_HEX_FAST */
+
 size_t bin2hex(const uint8_t *buf, size_t buflen, char *hex, size_t hexlen)
 {
 	if ((hexlen + 1) < buflen * 2) {
@@ -89,3 +167,5 @@ size_t hex2bin(const char *hex, size_t hexlen, uint8_t *buf, size_t buflen)
 
 	return hexlen / 2 + hexlen % 2;
 }
+
+#endif /* CONFIG_HEX_FAST */
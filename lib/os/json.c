@@ -426,7 +426,7 @@ static bool equivalent_types(enum json_tokens type1, enum json_tokens type2)
 
 static int obj_parse(struct json_obj *obj,
 		     const struct json_obj_descr *descr, size_t descr_len,
-		     void *val);
+		     const uint32_t *hashes, void *val);
 static int arr_parse(struct json_obj *obj,
 		     const struct json_obj_descr *elem_descr,
 		     size_t max_elements, void *field, void *val);
@@ -444,7 +444,7 @@ static int decode_value(struct json_obj *obj,
 	case JSON_TOK_OBJECT_START:
 		return obj_parse(obj, descr->object.sub_descr,
 				 descr->object.sub_descr_len,
-				 field);
+				 NULL, field);
 	case JSON_TOK_LIST_START:
 		return arr_parse(obj, descr->array.element_descr,
 				 descr->array.n_elements, field, val);
@@ -536,8 +536,23 @@ static int arr_parse(struct json_obj *obj,
 	return -EINVAL;
 }
 
+/* Never returns zero, so a zeroed hash table slot can denote "not yet
+ * computed".
+ */
+static uint32_t key_hash(const char *key, size_t len)
+{
+	uint32_t hash = 5381U;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		hash = (hash * 33U) + (uint8_t)key[i];
+	}
+
+	return hash == 0U ? 1U : hash;
+}
+
 static int obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
-		     size_t descr_len, void *val)
+		     size_t descr_len, const uint32_t *hashes, void *val)
 {
 	struct json_obj_key_value kv;
 	int32_t decoded_fields = 0;
@@ -545,10 +560,16 @@ static int obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
 	int ret;
 
 	while (!obj_next(obj, &kv)) {
+		uint32_t kv_hash = 0U;
+
 		if (kv.value.type == JSON_TOK_OBJECT_END) {
 			return decoded_fields;
 		}
 
+		if (hashes != NULL) {
+			kv_hash = key_hash(kv.key, kv.key_len);
+		}
+
 		for (i = 0; i < descr_len; i++) {
 			void *decode_field = (char *)val + descr[i].offset;
 
@@ -557,6 +578,14 @@ static int obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
 				continue;
 			}
 
+			/* Cheap hash comparison first; the string
+			 * comparison below still guards against
+			 * collisions.
+			 */
+			if (hashes != NULL && hashes[i] != kv_hash) {
+				continue;
+			}
+
 			/* Check if it's the i-th field */
 			if (kv.key_len != descr[i].field_name_len) {
 				continue;
@@ -596,7 +625,244 @@ int json_obj_parse(char *payload, size_t len,
 		return ret;
 	}
 
-	return obj_parse(&obj, descr, descr_len, val);
+	return obj_parse(&obj, descr, descr_len, NULL, val);
+}
+
+int json_obj_parse_hashed(char *payload, size_t len,
+			  const struct json_obj_descr *descr, size_t descr_len,
+			  uint32_t *hashes, void *val)
+{
+	struct json_obj obj;
+	int ret;
+
+	__ASSERT_NO_MSG(descr_len < (sizeof(ret) * CHAR_BIT - 1));
+
+	if (hashes[0] == 0U) {
+		size_t i;
+
+		for (i = 0; i < descr_len; i++) {
+			hashes[i] = key_hash(descr[i].field_name,
+					     descr[i].field_name_len);
+		}
+	}
+
+	ret = obj_init(&obj, payload, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return obj_parse(&obj, descr, descr_len, hashes, val);
+}
+
+enum json_stream_state {
+	JSON_STREAM_DEFAULT,
+	JSON_STREAM_STRING,
+	JSON_STREAM_PRIMITIVE,
+};
+
+void json_stream_init(struct json_stream *stream, json_stream_cb_t callback,
+		      void *user_data, char *scratch, size_t scratch_size)
+{
+	stream->callback = callback;
+	stream->user_data = user_data;
+	stream->scratch = scratch;
+	stream->scratch_size = scratch_size;
+	stream->scratch_len = 0;
+	stream->stack = 0;
+	stream->depth = 0;
+	stream->state = JSON_STREAM_DEFAULT;
+	stream->escaped = false;
+}
+
+static int stream_scratch_append(struct json_stream *stream,
+				 const char *data, size_t len)
+{
+	if ((stream->scratch_size - stream->scratch_len) < len) {
+		return -ENOMEM;
+	}
+
+	memcpy(stream->scratch + stream->scratch_len, data, len);
+	stream->scratch_len += len;
+
+	return 0;
+}
+
+static int stream_emit(struct json_stream *stream, enum json_tokens type,
+		       const char *start, size_t len)
+{
+	struct json_stream_token token;
+
+	if (stream->scratch_len > 0) {
+		/* The token started in a previous chunk; finish
+		 * reassembling it in the scratch buffer.
+		 */
+		if (stream_scratch_append(stream, start, len) < 0) {
+			return -ENOMEM;
+		}
+
+		token.start = stream->scratch;
+		token.len = stream->scratch_len;
+		stream->scratch_len = 0;
+	} else {
+		token.start = start;
+		token.len = len;
+	}
+
+	token.type = type;
+
+	return stream->callback(&token, stream->user_data);
+}
+
+static int stream_emit_primitive(struct json_stream *stream,
+				 const char *start, size_t len)
+{
+	struct json_stream_token token;
+	int ret;
+
+	/* Merge first so classification sees the whole token */
+	if (stream->scratch_len > 0) {
+		if (stream_scratch_append(stream, start, len) < 0) {
+			return -ENOMEM;
+		}
+
+		token.start = stream->scratch;
+		token.len = stream->scratch_len;
+		stream->scratch_len = 0;
+	} else {
+		token.start = start;
+		token.len = len;
+	}
+
+	if (token.len == 0) {
+		return -EINVAL;
+	}
+
+	if (isdigit((unsigned char)token.start[0]) ||
+	    token.start[0] == '-') {
+		token.type = JSON_TOK_NUMBER;
+	} else if (token.len == 4 &&
+		   strncmp(token.start, "true", 4) == 0) {
+		token.type = JSON_TOK_TRUE;
+	} else if (token.len == 5 &&
+		   strncmp(token.start, "false", 5) == 0) {
+		token.type = JSON_TOK_FALSE;
+	} else if (token.len == 4 &&
+		   strncmp(token.start, "null", 4) == 0) {
+		token.type = JSON_TOK_NULL;
+	} else {
+		return -EINVAL;
+	}
+
+	ret = stream->callback(&token, stream->user_data);
+
+	stream->state = JSON_STREAM_DEFAULT;
+
+	return ret;
+}
+
+static bool stream_is_delimiter(char chr)
+{
+	return chr == ' ' || chr == '\t' || chr == '\r' || chr == '\n' ||
+	       chr == ',' || chr == ':' || chr == '}' || chr == ']';
+}
+
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len)
+{
+	size_t start = 0;
+	size_t i;
+	int ret;
+
+	for (i = 0; i < len; i++) {
+		char chr = data[i];
+
+		switch (stream->state) {
+		case JSON_STREAM_DEFAULT:
+			switch (chr) {
+			case ' ':
+			case '\t':
+			case '\r':
+			case '\n':
+			case ':':
+			case ',':
+				break;
+			case '{':
+			case '[':
+				if (stream->depth >=
+				    sizeof(stream->stack) * CHAR_BIT) {
+					return -EINVAL;
+				}
+				stream->stack = (stream->stack << 1) |
+						(chr == '{' ? 1U : 0U);
+				stream->depth++;
+				ret = stream_emit(stream,
+						  (enum json_tokens)chr,
+						  &data[i], 1);
+				if (ret < 0) {
+					return ret;
+				}
+				break;
+			case '}':
+			case ']':
+				if (stream->depth == 0U ||
+				    (stream->stack & 1U) !=
+				    (chr == '}' ? 1U : 0U)) {
+					return -EINVAL;
+				}
+				stream->stack >>= 1;
+				stream->depth--;
+				ret = stream_emit(stream,
+						  (enum json_tokens)chr,
+						  &data[i], 1);
+				if (ret < 0) {
+					return ret;
+				}
+				break;
+			case '"':
+				stream->state = JSON_STREAM_STRING;
+				stream->escaped = false;
+				start = i + 1;
+				break;
+			default:
+				stream->state = JSON_STREAM_PRIMITIVE;
+				start = i;
+				break;
+			}
+			break;
+		case JSON_STREAM_STRING:
+			if (stream->escaped) {
+				stream->escaped = false;
+			} else if (chr == '\\') {
+				stream->escaped = true;
+			} else if (chr == '"') {
+				ret = stream_emit(stream, JSON_TOK_STRING,
+						  &data[start], i - start);
+				if (ret < 0) {
+					return ret;
+				}
+				stream->state = JSON_STREAM_DEFAULT;
+			}
+			break;
+		case JSON_STREAM_PRIMITIVE:
+			if (stream_is_delimiter(chr)) {
+				ret = stream_emit_primitive(stream,
+							    &data[start],
+							    i - start);
+				if (ret < 0) {
+					return ret;
+				}
+				/* Reprocess the delimiter */
+				i--;
+			}
+			break;
+		}
+	}
+
+	/* Carry a token split by the chunk boundary over to the next feed */
+	if (stream->state != JSON_STREAM_DEFAULT && i > start) {
+		return stream_scratch_append(stream, &data[start], i - start);
+	}
+
+	return 0;
 }
 
 static char escape_as(char chr)
@@ -463,6 +463,116 @@ void printk(const char *fmt, ...)
 	}
 	va_end(ap);
 }
+
+#ifdef CONFIG_PRINTK_DEFERRED
+/* Deferred capture ring. Records are stored as machine words:
+ * [format string pointer][argument count][arguments...], with the
+ * indices free-running and reduced modulo the buffer size on access.
+ * A single lock keeps the capture cost bounded and ISR-safe; the
+ * expensive formatting happens in printk_deferred_flush() instead.
+ */
+static uintptr_t deferred_buf[CONFIG_PRINTK_DEFERRED_BUF_WORDS];
+static uint32_t deferred_head;
+static uint32_t deferred_tail;
+static uint32_t deferred_dropped;
+static struct k_spinlock deferred_lock;
+
+#define DEFERRED_BUF_WORDS ((uint32_t)CONFIG_PRINTK_DEFERRED_BUF_WORDS)
+
+void z_printk_deferred(int nargs, const char *fmt, ...)
+{
+	k_spinlock_key_t key;
+	uint32_t needed = (uint32_t)nargs + 2U;
+	va_list ap;
+	int i;
+
+	key = k_spin_lock(&deferred_lock);
+
+	if ((nargs > PRINTK_DEFERRED_MAX_ARGS) ||
+	    ((DEFERRED_BUF_WORDS - (deferred_head - deferred_tail)) < needed)) {
+		deferred_dropped++;
+		k_spin_unlock(&deferred_lock, key);
+		return;
+	}
+
+	deferred_buf[deferred_head++ % DEFERRED_BUF_WORDS] = (uintptr_t)fmt;
+	deferred_buf[deferred_head++ % DEFERRED_BUF_WORDS] = (uintptr_t)nargs;
+
+	va_start(ap, fmt);
+	for (i = 0; i < nargs; i++) {
+		deferred_buf[deferred_head++ % DEFERRED_BUF_WORDS] =
+			va_arg(ap, uintptr_t);
+	}
+	va_end(ap);
+
+	k_spin_unlock(&deferred_lock, key);
+}
+
+int printk_deferred_flush(void)
+{
+	int count = 0;
+
+	for (;;) {
+		uintptr_t a[PRINTK_DEFERRED_MAX_ARGS];
+		k_spinlock_key_t key;
+		const char *fmt;
+		uint32_t nargs;
+		uint32_t i;
+
+		key = k_spin_lock(&deferred_lock);
+
+		if (deferred_tail == deferred_head) {
+			uint32_t dropped = deferred_dropped;
+
+			deferred_dropped = 0U;
+			k_spin_unlock(&deferred_lock, key);
+
+			if (dropped != 0U) {
+				printk("printk_deferred: %u message(s) dropped\n",
+				       dropped);
+			}
+			return count;
+		}
+
+		fmt = (const char *)
+			deferred_buf[deferred_tail++ % DEFERRED_BUF_WORDS];
+		nargs = deferred_buf[deferred_tail++ % DEFERRED_BUF_WORDS];
+		for (i = 0U; i < nargs; i++) {
+			a[i] = deferred_buf[deferred_tail++ % DEFERRED_BUF_WORDS];
+		}
+
+		k_spin_unlock(&deferred_lock, key);
+
+		/* Arguments were captured as machine words, so they can be
+		 * handed back to printk() positionally.
+		 */
+		switch (nargs) {
+		case 0:
+			printk(fmt);
+			break;
+		case 1:
+			printk(fmt, a[0]);
+			break;
+		case 2:
+			printk(fmt, a[0], a[1]);
+			break;
+		case 3:
+			printk(fmt, a[0], a[1], a[2]);
+			break;
+		case 4:
+			printk(fmt, a[0], a[1], a[2], a[3]);
+			break;
+		case 5:
+			printk(fmt, a[0], a[1], a[2], a[3], a[4]);
+			break;
+		default:
+			printk(fmt, a[0], a[1], a[2], a[3], a[4], a[5]);
+			break;
+		}
+		count++;
+	}
+}
+#endif /* CONFIG_PRINTK_DEFERRED */
 #endif /* CONFIG_PRINTK */
 
 struct str_context {
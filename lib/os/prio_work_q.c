@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * Priority-ordered workqueue: a k_work_q variant that always drains
+ * the highest-priority pending item first instead of strict FIFO, so
+ * a backlog of slow low-priority handlers cannot delay an urgent one.
+ */
+
+#include <kernel.h>
+#include <limits.h>
+
+static void prio_work_q_main(void *work_q_ptr, void *p2, void *p3)
+{
+	struct k_prio_work_q *work_q = work_q_ptr;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct k_prio_work *work;
+		k_work_handler_t handler;
+		k_spinlock_key_t key;
+		sys_dnode_t *node;
+
+		(void)k_sem_take(&work_q->sem, K_FOREVER);
+
+		key = k_spin_lock(&work_q->lock);
+		node = sys_dlist_get(&work_q->pending);
+		k_spin_unlock(&work_q->lock, key);
+
+		if (node == NULL) {
+			continue;
+		}
+
+		work = CONTAINER_OF(node, struct k_prio_work, node);
+		handler = work->work.handler;
+		__ASSERT(handler != NULL, "handler must be provided");
+
+		/* Reset pending state so it can be resubmitted by handler */
+		if (atomic_test_and_clear_bit(work->work.flags,
+					      K_WORK_STATE_PENDING)) {
+			handler(&work->work);
+		}
+
+		/* Make sure we don't hog up the CPU if the queue never
+		 * (or very rarely) gets empty.
+		 */
+		k_yield();
+	}
+}
+
+void k_prio_work_q_start(struct k_prio_work_q *work_q,
+			 k_thread_stack_t *stack,
+			 size_t stack_size, int prio)
+{
+	sys_dlist_init(&work_q->pending);
+	k_sem_init(&work_q->sem, 0, UINT_MAX);
+	(void)k_thread_create(&work_q->thread, stack, stack_size,
+			      prio_work_q_main, work_q, NULL, NULL, prio, 0,
+			      K_NO_WAIT);
+
+	k_thread_name_set(&work_q->thread, "prio_workqueue");
+}
+
+void k_prio_work_submit_to_queue(struct k_prio_work_q *work_q,
+				 struct k_prio_work *work)
+{
+	if (atomic_test_and_set_bit(work->work.flags, K_WORK_STATE_PENDING)) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&work_q->lock);
+	struct k_prio_work *pos;
+
+	/* Sorted insert; equal priorities keep submission order */
+	SYS_DLIST_FOR_EACH_CONTAINER(&work_q->pending, pos, node) {
+		if (pos->priority > work->priority) {
+			sys_dlist_insert(&pos->node, &work->node);
+			break;
+		}
+	}
+
+	if (!sys_dnode_is_linked(&work->node)) {
+		sys_dlist_append(&work_q->pending, &work->node);
+	}
+
+	k_spin_unlock(&work_q->lock, key);
+	k_sem_give(&work_q->sem);
+}
+
+int k_prio_work_cancel(struct k_prio_work_q *work_q,
+		       struct k_prio_work *work)
+{
+	k_spinlock_key_t key = k_spin_lock(&work_q->lock);
+	int ret = -EINVAL;
+
+	if (sys_dnode_is_linked(&work->node)) {
+		sys_dlist_remove(&work->node);
+		atomic_clear_bit(work->work.flags, K_WORK_STATE_PENDING);
+		ret = 0;
+	}
+
+	k_spin_unlock(&work_q->lock, key);
+	return ret;
+}
@@ -69,6 +69,23 @@ static void set_color(struct rbnode *n, enum rb_color color)
 	*p = (*p & ~1UL) | (uint8_t)color;
 }
 
+#ifdef CONFIG_RBTREE_ORDER_STATS
+static uint32_t subtree_size(struct rbnode *n)
+{
+	return n == NULL ? 0U : n->subtree;
+}
+
+/* Recomputes a node's subtree size from its children.  Note that the
+ * "null node" used during removal carries a stored size of zero, so
+ * counting it like an ordinary child is harmless.
+ */
+static void update_size(struct rbnode *n)
+{
+	n->subtree = 1U + subtree_size(get_child(n, 0)) +
+		subtree_size(get_child(n, 1));
+}
+#endif
+
 /* Searches the tree down to a node that is either identical with the
  * "node" argument or has an empty/leaf child pointer where "node"
  * should be, leaving all nodes found in the resulting stack.  Note
@@ -146,6 +163,14 @@ static void rotate(struct rbnode **stack, int stacksz)
 	set_child(parent, side, b);
 	stack[stacksz - 2] = child;
 	stack[stacksz - 1] = parent;
+
+#ifdef CONFIG_RBTREE_ORDER_STATS
+	/* Only these two nodes changed shape; parent is now the lower
+	 * of the pair, so recompute it first
+	 */
+	update_size(parent);
+	update_size(child);
+#endif
 }
 
 /* The node at the top of the provided stack is red, and its parent is
@@ -222,6 +247,9 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 		tree->root = node;
 		tree->max_depth = 1;
 		set_color(node, BLACK);
+#ifdef CONFIG_RBTREE_ORDER_STATS
+		node->subtree = 1U;
+#endif
 		return;
 	}
 
@@ -240,6 +268,16 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 	set_child(parent, side, node);
 	set_color(node, RED);
 
+#ifdef CONFIG_RBTREE_ORDER_STATS
+	/* Every node on the search path gained a descendant; the
+	 * rotations below keep their own sizes correct
+	 */
+	node->subtree = 1U;
+	for (int i = 0; i < stacksz; i++) {
+		stack[i]->subtree++;
+	}
+#endif
+
 	stack[stacksz++] = node;
 	fix_extra_red(stack, stacksz);
 
@@ -439,8 +477,27 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 
 		set_color(node, get_color(node2));
 		set_color(node2, ctmp);
+
+#ifdef CONFIG_RBTREE_ORDER_STATS
+		/* Like the colors, subtree sizes belong to tree
+		 * positions, not nodes, so they swap too
+		 */
+		uint32_t stmp = node->subtree;
+
+		node->subtree = node2->subtree;
+		node2->subtree = stmp;
+#endif
 	}
 
+#ifdef CONFIG_RBTREE_ORDER_STATS
+	/* All remaining ancestors of the node's (final) position lose
+	 * a descendant
+	 */
+	for (int i = 0; i < stacksz - 1; i++) {
+		stack[i]->subtree--;
+	}
+#endif
+
 	CHECK(!get_child(node, 0) || !get_child(node, 1));
 
 	struct rbnode *child = get_child(node, 0);
@@ -469,6 +526,13 @@ void rb_remove(struct rbtree *tree, struct rbnode *node)
 	 */
 	if (child == NULL) {
 		if (is_black(node)) {
+#ifdef CONFIG_RBTREE_ORDER_STATS
+			/* The node stays linked in as the "null node"
+			 * while the fixup runs; a stored size of zero
+			 * keeps the recomputations in rotate() right
+			 */
+			node->subtree = 0U;
+#endif
 			fix_missing_black(stack, stacksz, node);
 		} else {
 			/* Red childless nodes can just be dropped */
@@ -597,3 +661,103 @@ struct rbnode *z_rb_foreach_next(struct rbtree *tree, struct _rb_foreach *f)
 	f->top--;
 	return f->top >= 0 ? f->stack[f->top] : NULL;
 }
+
+#ifdef CONFIG_RBTREE_ORDER_STATS
+struct rbnode *rb_select(struct rbtree *tree, uint32_t rank)
+{
+	struct rbnode *n = tree->root;
+
+	if (n == NULL || rank >= n->subtree) {
+		return NULL;
+	}
+
+	/* The loop terminates by construction: rank is always within
+	 * the subtree under n, so one of the three branches applies
+	 */
+	while (true) {
+		uint32_t lsz = subtree_size(get_child(n, 0));
+
+		if (rank < lsz) {
+			n = get_child(n, 0);
+		} else if (rank == lsz) {
+			return n;
+		} else {
+			rank -= lsz + 1U;
+			n = get_child(n, 1);
+		}
+	}
+}
+
+int rb_rank(struct rbtree *tree, struct rbnode *node)
+{
+	struct rbnode *n = tree->root;
+	uint32_t rank = 0U;
+
+	/* Same navigation as rb_contains(), accumulating the count of
+	 * nodes left behind at every rightward turn
+	 */
+	while (n != NULL && n != node) {
+		if (tree->lessthan_fn(n, node)) {
+			rank += subtree_size(get_child(n, 0)) + 1U;
+			n = get_child(n, 1);
+		} else {
+			n = get_child(n, 0);
+		}
+	}
+
+	if (n == NULL) {
+		return -1;
+	}
+
+	return (int)(rank + subtree_size(get_child(node, 0)));
+}
+#endif
+
+#ifndef CONFIG_MISRA_SANE
+/* Recursively builds the complete tree over nodes[lo..hi), coloring
+ * the bottom level (depth == red_depth) red and everything above it
+ * black.  A midpoint-split complete tree only has missing children in
+ * its bottom two levels, so every path from the root to a leaf pointer
+ * crosses the same number of black levels and the result is a valid
+ * red/black tree.
+ */
+static struct rbnode *build_subtree(struct rbnode **nodes, size_t lo,
+				    size_t hi, int depth, int red_depth)
+{
+	if (lo >= hi) {
+		return NULL;
+	}
+
+	size_t mid = lo + (hi - lo) / 2U;
+	struct rbnode *n = nodes[mid];
+
+	set_color(n, depth == red_depth ? RED : BLACK);
+	set_child(n, 0, build_subtree(nodes, lo, mid, depth + 1, red_depth));
+	set_child(n, 1, build_subtree(nodes, mid + 1U, hi, depth + 1,
+				      red_depth));
+#ifdef CONFIG_RBTREE_ORDER_STATS
+	update_size(n);
+#endif
+	return n;
+}
+
+void rb_build(struct rbtree *tree, struct rbnode **nodes, size_t count)
+{
+	int depth = 0;
+
+	if (count == 0U) {
+		tree->root = NULL;
+		tree->max_depth = 0;
+		return;
+	}
+
+	while ((count >> depth) > 1U) {
+		depth++;
+	}
+
+	/* A one-node tree is all root, which must stay black */
+	tree->root = build_subtree(nodes, 0, count, 0,
+				   count > 1U ? depth : -1);
+	tree->max_depth = depth + 1;
+}
+#endif
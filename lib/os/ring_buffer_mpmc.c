@@ -0,0 +1,111 @@
+/* ring_buffer_mpmc.c: Lock-free multi-producer/multi-consumer ring */
+
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <sys/ring_buffer.h>
+
+/* Bounded MPMC queue with per-cell sequence numbers (after D. Vyukov).
+ *
+ * Producers claim a slot by advancing the enqueue cursor with a CAS,
+ * then publish the payload by bumping the cell's sequence number;
+ * consumers mirror this on the dequeue cursor.  A context that loses a
+ * CAS race simply retries against fresh cursors, so no context ever
+ * waits on another's progress.
+ *
+ * The sequence number stored in each cell is kept relative to the
+ * cell's own index, so a zero-filled cell array (static storage, or
+ * ring_buf_mpmc_init()) is the valid empty state.  For a cell at
+ * position pos, "lap base" below is pos with the index bits removed:
+ * a cell owned by producers holds the base of the current lap, and one
+ * holding data for consumers holds base + 1.
+ */
+
+void ring_buf_mpmc_init(struct ring_buf_mpmc *buf, uint32_t size,
+			struct ring_buf_mpmc_cell *cells)
+{
+	__ASSERT(size != 0U && (size & (size - 1U)) == 0U,
+		 "size must be a power of 2");
+
+	buf->mask = size - 1U;
+	buf->cells = cells;
+	for (uint32_t i = 0; i < size; i++) {
+		atomic_set(&cells[i].seq, 0);
+	}
+	atomic_set(&buf->enq, 0);
+	atomic_set(&buf->deq, 0);
+}
+
+int ring_buf_mpmc_put(struct ring_buf_mpmc *buf, uintptr_t data)
+{
+	struct ring_buf_mpmc_cell *cell;
+	uint32_t pos = (uint32_t)atomic_get(&buf->enq);
+
+	for (;;) {
+		uint32_t base = pos - (pos & buf->mask);
+
+		cell = &buf->cells[pos & buf->mask];
+
+		int32_t dif = (int32_t)((uint32_t)atomic_get(&cell->seq) -
+					base);
+
+		if (dif == 0) {
+			if (atomic_cas(&buf->enq, (atomic_val_t)pos,
+				       (atomic_val_t)(pos + 1U))) {
+				break;
+			}
+		} else if (dif < 0) {
+			/* Cell not yet consumed a full lap ago: full (or
+			 * a consumer is mid-dequeue, in which case the
+			 * caller may retry).
+			 */
+			return -ENOSPC;
+		}
+
+		pos = (uint32_t)atomic_get(&buf->enq);
+	}
+
+	cell->data = data;
+	/* Publishes the payload: atomic_set orders the data store above
+	 * before the sequence update becomes visible.
+	 */
+	atomic_set(&cell->seq, (atomic_val_t)(pos - (pos & buf->mask) + 1U));
+
+	return 0;
+}
+
+int ring_buf_mpmc_get(struct ring_buf_mpmc *buf, uintptr_t *data)
+{
+	struct ring_buf_mpmc_cell *cell;
+	uint32_t pos = (uint32_t)atomic_get(&buf->deq);
+
+	for (;;) {
+		uint32_t base = pos - (pos & buf->mask);
+
+		cell = &buf->cells[pos & buf->mask];
+
+		int32_t dif = (int32_t)((uint32_t)atomic_get(&cell->seq) -
+					(base + 1U));
+
+		if (dif == 0) {
+			if (atomic_cas(&buf->deq, (atomic_val_t)pos,
+				       (atomic_val_t)(pos + 1U))) {
+				break;
+			}
+		} else if (dif < 0) {
+			return -EAGAIN;
+		}
+
+		pos = (uint32_t)atomic_get(&buf->deq);
+	}
+
+	*data = cell->data;
+	/* Hand the cell back to producers, one lap ahead. */
+	atomic_set(&cell->seq,
+		   (atomic_val_t)(pos - (pos & buf->mask) + buf->mask + 1U));
+
+	return 0;
+}
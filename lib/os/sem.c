@@ -79,6 +79,40 @@ int sys_sem_give(struct sys_sem *sem)
 	return ret;
 }
 
+int sys_sem_give_count(struct sys_sem *sem, unsigned int count)
+{
+	atomic_t old_value, base, new_value;
+
+	if (count == 0U) {
+		return -EINVAL;
+	}
+
+	/* credit up to 'count' gives in a single atomic update */
+	do {
+		old_value = atomic_get(&sem->futex.val);
+		if (old_value >= sem->limit) {
+			return -EAGAIN;
+		}
+
+		base = old_value < SYS_SEM_MINIMUM ?
+		       SYS_SEM_MINIMUM : old_value;
+		new_value = base + MIN((atomic_t)count, sem->limit - base);
+	} while (atomic_cas(&sem->futex.val, old_value, new_value) == 0);
+
+	if (old_value < SYS_SEM_MINIMUM) {
+		/* contended: one wake covers the whole batch */
+		int ret = k_futex_wake(&sem->futex, true);
+
+		if (ret > 0) {
+			return 0;
+		}
+
+		return ret;
+	}
+
+	return 0;
+}
+
 int sys_sem_take(struct sys_sem *sem, k_timeout_t timeout)
 {
 	int ret = 0;
@@ -120,6 +154,17 @@ int sys_sem_give(struct sys_sem *sem)
 	return 0;
 }
 
+int sys_sem_give_count(struct sys_sem *sem, unsigned int count)
+{
+	if (count == 0U) {
+		return -EINVAL;
+	}
+
+	k_sem_give_count(&sem->kernel_sem, count);
+
+	return 0;
+}
+
 int sys_sem_take(struct sys_sem *sem, k_timeout_t timeout)
 {
 	int ret_value = 0;
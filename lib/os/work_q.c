@@ -8,7 +8,116 @@
 #include <kernel.h>
 #define WORKQUEUE_THREAD_NAME	"workqueue"
 
+#ifdef CONFIG_WORK_Q_MPSC_SUBMIT
+
+void z_work_submit_mpsc(struct k_work_q *work_q, struct k_work *work)
+{
+	void *old;
+
+	/* A cancelled item may still sit on the list with its pending
+	 * bit freshly set again by this resubmission; in that case the
+	 * workqueue thread will find it via the existing link and it
+	 * must not be pushed a second time.
+	 */
+	if (!atomic_test_and_set_bit(work->flags, K_WORK_STATE_MPSC_LINKED)) {
+		do {
+			old = atomic_ptr_get(&work_q->mpsc_head);
+			work->_reserved = old;
+		} while (!atomic_ptr_cas(&work_q->mpsc_head, old, work));
+	}
+
+	k_sem_give(&work_q->mpsc_sem);
+}
+
+void z_work_wake_mpsc(struct k_work_q *work_q)
+{
+	k_sem_give(&work_q->mpsc_sem);
+}
+
+static void run_work_item(struct k_work *work)
+{
+	k_work_handler_t handler = work->handler;
+
+	__ASSERT(handler != NULL, "handler must be provided");
+
+	/* The item is now off the list, so resubmission may push it
+	 * again.  This must happen before the pending test below so a
+	 * concurrent resubmission is never lost.
+	 */
+	atomic_clear_bit(work->flags, K_WORK_STATE_MPSC_LINKED);
+
+	/* Reset pending state so it can be resubmitted by the
+	 * handler.  A cancelled item reaches here with the pending
+	 * bit already clear and is simply skipped.
+	 */
+	if (atomic_test_and_clear_bit(work->flags, K_WORK_STATE_PENDING)) {
+		handler(work);
+	}
+
+	/* Make sure we don't hog up the CPU if work never (or very
+	 * rarely) runs out.
+	 */
+	k_yield();
+}
+
+void z_work_q_main(void *work_q_ptr, void *p2, void *p3)
+{
+	struct k_work_q *work_q = work_q_ptr;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct k_work *work, *next, *batch = NULL;
+
+		/* Detach everything submitted so far in one exchange.
+		 * The list comes off newest first; reverse it so items
+		 * run in submission order.
+		 */
+		work = atomic_ptr_set(&work_q->mpsc_head, NULL);
+
+		if (work == NULL) {
+			/* Items can also arrive through the allocating
+			 * k_work_submit_to_user_queue() path, which
+			 * appends to the k_queue and gives the
+			 * semaphore like any other producer.
+			 */
+			work = k_queue_get(&work_q->queue, K_NO_WAIT);
+			if (work == NULL) {
+				(void)k_sem_take(&work_q->mpsc_sem, K_FOREVER);
+				continue;
+			}
+			run_work_item(work);
+			continue;
+		}
+
+		while (work != NULL) {
+			next = work->_reserved;
+			work->_reserved = batch;
+			batch = work;
+			work = next;
+		}
+
+		while (batch != NULL) {
+			work = batch;
+			batch = work->_reserved;
+			run_work_item(work);
+		}
+	}
+}
+
+/* User mode work queues keep the k_queue based path even with MPSC
+ * submission enabled, since their submitters go through the
+ * allocating k_work_submit_to_user_queue() and cannot touch the
+ * lock-free list from user mode.
+ */
+static void work_q_user_main(void *work_q_ptr, void *p2, void *p3)
+
+#else /* !CONFIG_WORK_Q_MPSC_SUBMIT */
+
 void z_work_q_main(void *work_q_ptr, void *p2, void *p3)
+
+#endif /* CONFIG_WORK_Q_MPSC_SUBMIT */
 {
 	struct k_work_q *work_q = work_q_ptr;
 
@@ -40,15 +149,25 @@ void z_work_q_main(void *work_q_ptr, void *p2, void *p3)
 	}
 }
 
+#ifdef CONFIG_WORK_Q_MPSC_SUBMIT
+#define WORK_Q_USER_MAIN work_q_user_main
+#else
+#define WORK_Q_USER_MAIN z_work_q_main
+#endif
+
 void k_work_q_user_start(struct k_work_q *work_q, k_thread_stack_t *stack,
 			 size_t stack_size, int prio)
 {
 	k_queue_init(&work_q->queue);
+#ifdef CONFIG_WORK_Q_MPSC_SUBMIT
+	(void)atomic_ptr_set(&work_q->mpsc_head, NULL);
+	k_sem_init(&work_q->mpsc_sem, 0, UINT_MAX);
+#endif
 
 	/* Created worker thread will inherit object permissions and memory
 	 * domain configuration of the caller
 	 */
-	k_thread_create(&work_q->thread, stack, stack_size, z_work_q_main,
+	k_thread_create(&work_q->thread, stack, stack_size, WORK_Q_USER_MAIN,
 			work_q, NULL, NULL, prio, K_USER | K_INHERIT_PERMS,
 			K_FOREVER);
 	k_object_access_grant(&work_q->queue, &work_q->thread);
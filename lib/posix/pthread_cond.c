@@ -20,9 +20,17 @@ static int cond_wait(pthread_cond_t *cv, pthread_mutex_t *mut,
 
 	mut->lock_count = 0U;
 	mut->owner = NULL;
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+	atomic_set(&mut->val, 0);
+	(void)atomic_inc(&cv->waiters);
+#endif
 	_ready_one_thread(&mut->wait_q);
 	ret = z_pend_curr_irqlock(key, &cv->wait_q, timeout);
 
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+	(void)atomic_dec(&cv->waiters);
+#endif
+
 	/* FIXME: this extra lock (and the potential context switch it
 	 * can cause) could be optimized out.  At the point of the
 	 * signal/broadcast, it's possible to detect whether or not we
@@ -49,6 +57,17 @@ static int cond_wait(pthread_cond_t *cv, pthread_mutex_t *mut,
 
 int pthread_cond_signal(pthread_cond_t *cv)
 {
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+	/* Waiters register themselves before pending, so an empty
+	 * count means there is nobody to wake and the scheduler need
+	 * not be consulted at all.  (A thread between wakeup and
+	 * decrement is already awake and loses nothing.)
+	 */
+	if (atomic_get(&cv->waiters) == 0) {
+		return 0;
+	}
+#endif
+
 	int key = irq_lock();
 
 	_ready_one_thread(&cv->wait_q);
@@ -59,6 +78,12 @@ int pthread_cond_signal(pthread_cond_t *cv)
 
 int pthread_cond_broadcast(pthread_cond_t *cv)
 {
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+	if (atomic_get(&cv->waiters) == 0) {
+		return 0;
+	}
+#endif
+
 	int key = irq_lock();
 
 	while (z_waitq_head(&cv->wait_q)) {
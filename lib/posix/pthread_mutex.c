@@ -20,6 +20,61 @@ static const pthread_mutexattr_t def_attr = {
 	.type = PTHREAD_MUTEX_DEFAULT,
 };
 
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+
+/* Futex-style locking: m->val is 0 when unlocked, 1 when locked and 2
+ * when locked with (possible) waiters.  The uncontended lock and
+ * unlock paths are a single compare-and-set each and never disable
+ * interrupts or touch the scheduler; the wait queue is only involved
+ * once the atomic says there is contention.  Writes to owner and
+ * lock_count happen only while holding the lock, so they need no
+ * further protection.
+ */
+static int acquire_mutex(pthread_mutex_t *m, k_timeout_t timeout)
+{
+	int rc, key;
+
+	if (atomic_cas(&m->val, 0, 1)) {
+		m->owner = pthread_self();
+		m->lock_count = 1U;
+		return 0;
+	}
+
+	if (m->owner == pthread_self()) {
+		if (m->type == PTHREAD_MUTEX_RECURSIVE &&
+		    m->lock_count < MUTEX_MAX_REC_LOCK) {
+			m->lock_count++;
+			return 0;
+		}
+		return m->type == PTHREAD_MUTEX_ERRORCHECK ? EDEADLK : EINVAL;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return EINVAL;
+	}
+
+	/* Mark contended before sleeping.  If the old value was 0 the
+	 * holder released it in the meantime and the swap itself took
+	 * the lock (leaving a spurious contended mark, which merely
+	 * costs the next unlock a wait queue peek).
+	 */
+	key = irq_lock();
+	while (atomic_set(&m->val, 2) != 0) {
+		rc = z_pend_curr_irqlock(key, &m->wait_q, timeout);
+		if (rc != 0) {
+			return ETIMEDOUT;
+		}
+		key = irq_lock();
+	}
+
+	m->owner = pthread_self();
+	m->lock_count = 1U;
+	irq_unlock(key);
+	return 0;
+}
+
+#else /* CONFIG_PTHREAD_IPC_FAST_PATH */
+
 static int acquire_mutex(pthread_mutex_t *m, k_timeout_t timeout)
 {
 	int rc = 0, key = irq_lock();
@@ -58,6 +113,8 @@ static int acquire_mutex(pthread_mutex_t *m, k_timeout_t timeout)
 	return rc;
 }
 
+#endif /* CONFIG_PTHREAD_IPC_FAST_PATH */
+
 /**
  * @brief Lock POSIX mutex with non-blocking call.
  *
@@ -100,6 +157,10 @@ int pthread_mutex_init(pthread_mutex_t *m,
 
 	z_waitq_init(&m->wait_q);
 
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+	atomic_set(&m->val, 0);
+#endif
+
 	return 0;
 }
 
@@ -119,6 +180,56 @@ int pthread_mutex_lock(pthread_mutex_t *m)
  *
  * See IEEE 1003.1
  */
+#ifdef CONFIG_PTHREAD_IPC_FAST_PATH
+
+int pthread_mutex_unlock(pthread_mutex_t *m)
+{
+	/* Only the owner gets past these checks, so the non-atomic
+	 * fields are stable and no locking is needed to inspect them.
+	 */
+	if (m->owner != pthread_self()) {
+		return EPERM;
+	}
+
+	if (m->lock_count == 0U) {
+		return EINVAL;
+	}
+
+	m->lock_count--;
+
+	if (m->lock_count != 0U) {
+		return 0;
+	}
+
+	m->owner = NULL;
+
+	if (atomic_cas(&m->val, 1, 0)) {
+		/* No contention was ever signalled */
+		return 0;
+	}
+
+	/* Contended (val was 2): release, then hand the CPU to the
+	 * longest waiter if there is one.  Woken threads re-compete
+	 * for the atomic rather than receiving ownership directly.
+	 */
+	atomic_set(&m->val, 0);
+
+	unsigned int key = irq_lock();
+	k_tid_t thread = z_unpend_first_thread(&m->wait_q);
+
+	if (thread != NULL) {
+		z_ready_thread(thread);
+		arch_thread_return_value_set(thread, 0);
+		z_reschedule_irqlock(key);
+		return 0;
+	}
+
+	irq_unlock(key);
+	return 0;
+}
+
+#else /* CONFIG_PTHREAD_IPC_FAST_PATH */
+
 int pthread_mutex_unlock(pthread_mutex_t *m)
 {
 	unsigned int key = irq_lock();
@@ -154,6 +265,8 @@ int pthread_mutex_unlock(pthread_mutex_t *m)
 	return 0;
 }
 
+#endif /* CONFIG_PTHREAD_IPC_FAST_PATH */
+
 /**
  * @brief Destroy POSIX mutex.
  *
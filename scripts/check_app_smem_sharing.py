@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020 Intel Corporation
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Report application shared memory symbols that share a data cache line
+
+Globals routed into application memory partitions with K_APP_DMEM or
+K_APP_BMEM are packed back-to-back by the linker. On SMP targets, two
+hot variables owned by different threads can end up in the same data
+cache line, and the resulting false sharing is invisible until it shows
+up in profiles.
+
+This script walks the final kernel ELF, collects all symbols placed in
+app shared memory input sections (the data_smem_* naming convention used
+by gen_app_partitions.py), and prints every cache line occupied by more
+than one symbol. Symbols that must not share a line can then be tagged
+with K_APP_DMEM_ALIGNED()/K_APP_BMEM_ALIGNED().
+
+The script only reports; it never fails the build. It cannot know which
+thread touches which variable, so the output lists all co-resident
+symbols and leaves the judgement to the reader.
+"""
+
+import argparse
+import sys
+from collections import defaultdict
+
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+SMEM_PREFIX = "data_smem_"
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-k", "--kernel", required=True,
+                        help="Input zephyr ELF binary")
+    parser.add_argument("-l", "--line-size", type=int, default=64,
+                        help="Data cache line size in bytes (default 64)")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="Also list lines occupied by a single symbol")
+    return parser.parse_args()
+
+
+def smem_symbols(elf):
+    """Yield (name, address, size, section name) for app smem data symbols"""
+    smem_sections = {}
+    for ndx, section in enumerate(elf.iter_sections()):
+        if section.name.startswith(SMEM_PREFIX):
+            smem_sections[ndx] = section.name
+
+    if not smem_sections:
+        return
+
+    for section in elf.iter_sections():
+        if not isinstance(section, SymbolTableSection):
+            continue
+        for sym in section.iter_symbols():
+            if sym.entry['st_shndx'] not in smem_sections:
+                continue
+            if sym.entry['st_info']['type'] != 'STT_OBJECT':
+                continue
+            if sym.entry['st_size'] == 0:
+                continue
+            yield (sym.name, sym.entry['st_value'], sym.entry['st_size'],
+                   smem_sections[sym.entry['st_shndx']])
+
+
+def main():
+    args = parse_args()
+
+    if args.line_size <= 0 or (args.line_size & (args.line_size - 1)) != 0:
+        sys.exit("line size must be a positive power of two")
+
+    lines = defaultdict(list)
+    with open(args.kernel, "rb") as fp:
+        for name, addr, size, secname in smem_symbols(ELFFile(fp)):
+            first = addr // args.line_size
+            last = (addr + size - 1) // args.line_size
+            for line in range(first, last + 1):
+                lines[line].append((name, addr, size, secname))
+
+    shared = 0
+    for line in sorted(lines):
+        syms = lines[line]
+        if len(syms) < 2 and not args.verbose:
+            continue
+        if len(syms) >= 2:
+            shared += 1
+        print("cache line 0x%x (%d bytes):" %
+              (line * args.line_size, args.line_size))
+        for name, addr, size, secname in sorted(syms, key=lambda s: s[1]):
+            print("    0x%x %-6d %-40s %s" % (addr, size, name, secname))
+
+    if shared == 0:
+        print("no app shared memory symbols share a cache line "
+              "(line size %d)" % args.line_size)
+    else:
+        print("%d cache line(s) hold more than one app shared memory symbol; "
+              "consider K_APP_DMEM_ALIGNED()/K_APP_BMEM_ALIGNED() for hot "
+              "per-thread data" % shared)
+
+
+if __name__ == "__main__":
+    main()
@@ -4,6 +4,7 @@
 #
 # SPDX-License-Identifier: Apache-2.0
 
+import io
 import logging
 import struct
 
@@ -11,6 +12,7 @@ import struct
 # Note: keep sync with C code
 Z_COREDUMP_HDR_ID = b'ZE'
 Z_COREDUMP_HDR_VER = 1
+Z_COREDUMP_HDR_FLAG_COMPRESSED = 0x1
 LOG_HDR_STRUCT = "<ccHHBBI"
 LOG_HDR_SIZE = struct.calcsize(LOG_HDR_STRUCT)
 
@@ -45,6 +47,75 @@ def reason_string(reason):
     return ret
 
 
+def decompress_lz4_block(data, raw_len):
+    """Decode one block in LZ4 block format."""
+    out = bytearray()
+    idx = 0
+
+    while idx < len(data) and len(out) < raw_len:
+        token = data[idx]
+        idx += 1
+
+        # Literals
+        length = token >> 4
+        if length == 15:
+            while True:
+                extra = data[idx]
+                idx += 1
+                length += extra
+                if extra != 255:
+                    break
+        out += data[idx:idx + length]
+        idx += length
+
+        if idx >= len(data):
+            # Last sequence of a block has no match part
+            break
+
+        # Match
+        offset = data[idx] | (data[idx + 1] << 8)
+        idx += 2
+        length = (token & 0xf) + 4
+        if (token & 0xf) == 15:
+            while True:
+                extra = data[idx]
+                idx += 1
+                length += extra
+                if extra != 255:
+                    break
+        pos = len(out) - offset
+        for _ in range(length):
+            out.append(out[pos])
+            pos += 1
+
+    return bytes(out)
+
+
+def decompress_stream(data):
+    """
+    Decode a stream of framed blocks as produced by the coredump
+    compression stage: each block is prefixed with a little-endian
+    uint16 stored size and uint16 original size; a block whose stored
+    size equals its original size is not compressed.
+    """
+    out = bytearray()
+    idx = 0
+
+    while (idx + 4) <= len(data):
+        stored_len, raw_len = struct.unpack_from("<HH", data, idx)
+        idx += 4
+
+        block = data[idx:idx + stored_len]
+        idx += stored_len
+
+        if stored_len == raw_len:
+            out += block
+        else:
+            out += decompress_lz4_block(block, raw_len)
+
+    return bytes(out)
+
+
 class CoredumpLogFile:
     """
     Process the binary coredump file for register block
@@ -142,6 +213,11 @@ class CoredumpLogFile:
         logger.info("Reason: {0}".format(reason_string(reason)))
         logger.info(f"Pointer size {ptr_size}")
 
+        if flags & Z_COREDUMP_HDR_FLAG_COMPRESSED:
+            # Everything following the header is compressed,
+            # continue parsing from the decompressed stream
+            self.fd = io.BytesIO(decompress_stream(self.fd.read()))
+
         del id1, id2, hdr_ver, tgt_code, ptr_size, flags, reason
 
         while True:
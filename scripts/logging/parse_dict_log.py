@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2020 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Decode a dictionary format log stream captured from a target built with
+CONFIG_LOG_DICTIONARY_SUPPORT.
+
+The target emits binary records which reference log strings by their
+address in the image. This script recovers the strings from the ELF
+file of the build and reconstructs the formatted messages.
+
+Usage:
+    parse_dict_log.py <zephyr.elf> <captured stream file>
+
+The record layout is described in include/logging/log_output_dict.h.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+MSG_TYPE_STD = 1
+MSG_TYPE_HEXDUMP = 2
+MSG_TYPE_RAW_STR = 3
+MSG_TYPE_DROPPED = 4
+
+TRANSIENT_STR_END = 0xff
+
+LEVELS = ["none", "err", "wrn", "inf", "dbg"]
+
+# Conversions which consume one word sized argument. %s is handled
+# separately since the argument is a string address.
+CONVERSION_RE = re.compile(r'%[-+ #0]*[0-9*]*(?:\.[0-9*]+)?(?:hh|h|l|ll|z|j|t)?([diouxXpcs%])')
+
+
+class Image:
+    """Addressable view of the loadable sections of the ELF file."""
+
+    def __init__(self, elf_path):
+        self.sections = []
+        with open(elf_path, 'rb') as fobj:
+            elf = ELFFile(fobj)
+            self.ptr_size = elf.elfclass // 8
+            self.endian = '<' if elf.little_endian else '>'
+            for section in elf.iter_sections():
+                # SHF_ALLOC sections with contents hold the log strings.
+                if section['sh_flags'] & 0x2 and section['sh_type'] != 'SHT_NOBITS':
+                    self.sections.append((section['sh_addr'],
+                                          section.data()))
+
+    def string_at(self, addr):
+        for base, data in self.sections:
+            if base <= addr < base + len(data):
+                end = data.find(b'\x00', addr - base)
+                if end < 0:
+                    return None
+                return data[addr - base:end].decode('utf-8', 'replace')
+        return None
+
+
+class Stream:
+    def __init__(self, data, endian, ptr_size):
+        self.data = data
+        self.pos = 0
+        self.endian = endian
+        self.ptr_size = ptr_size
+
+    def remaining(self):
+        return len(self.data) - self.pos
+
+    def unpack(self, fmt):
+        fmt = self.endian + fmt
+        size = struct.calcsize(fmt)
+        values = struct.unpack_from(fmt, self.data, self.pos)
+        self.pos += size
+        return values
+
+    def u8(self):
+        return self.unpack('B')[0]
+
+    def u16(self):
+        return self.unpack('H')[0]
+
+    def u32(self):
+        return self.unpack('I')[0]
+
+    def word(self):
+        return self.unpack('I' if self.ptr_size == 4 else 'Q')[0]
+
+    def bytes(self, length):
+        data = self.data[self.pos:self.pos + length]
+        self.pos += length
+        return data
+
+
+def format_message(image, fmt, args, transient):
+    """Apply C style conversions to the word sized raw arguments."""
+    out = []
+    last = 0
+    arg_idx = 0
+
+    for match in CONVERSION_RE.finditer(fmt):
+        out.append(fmt[last:match.start()])
+        last = match.end()
+        conv = match.group(1)
+
+        if conv == '%':
+            out.append('%')
+            continue
+
+        if arg_idx >= len(args):
+            out.append(match.group(0))
+            continue
+
+        arg = args[arg_idx]
+        arg_idx += 1
+
+        if conv == 's':
+            string = transient.get(arg_idx - 1)
+            if string is None:
+                string = image.string_at(arg)
+            out.append(string if string is not None
+                       else '<string at 0x%x>' % arg)
+        elif conv == 'p':
+            out.append('0x%x' % arg)
+        elif conv == 'c':
+            out.append(chr(arg & 0xff))
+        elif conv in 'di':
+            # Arguments are transferred as unsigned words.
+            bits = image.ptr_size * 8
+            if arg >= 1 << (bits - 1):
+                arg -= 1 << bits
+            out.append(str(arg))
+        elif conv == 'o':
+            out.append('%o' % arg)
+        elif conv == 'u':
+            out.append(str(arg))
+        else:
+            out.append('%x' % arg if conv == 'x' else '%X' % arg)
+
+    out.append(fmt[last:])
+    return ''.join(out)
+
+
+def level_str(level):
+    if level < len(LEVELS):
+        return LEVELS[level]
+    return str(level)
+
+
+def parse_stream(image, stream):
+    hdr_fmt = 'BBBHI' + ('I' if image.ptr_size == 4 else 'Q')
+    hdr_size = struct.calcsize('=' + hdr_fmt)
+
+    while stream.remaining() >= hdr_size:
+        msg_type, level, domain, source, timestamp, fmt_addr = \
+            stream.unpack(hdr_fmt)
+
+        if msg_type == MSG_TYPE_DROPPED:
+            count = stream.u32()
+            print('--- %d messages dropped ---' % count)
+            continue
+
+        prefix = '[%10u] <%s> %u.%u: ' % (timestamp, level_str(level),
+                                          domain, source)
+
+        if msg_type == MSG_TYPE_STD:
+            nargs = stream.u8()
+            args = [stream.word() for _ in range(nargs)]
+
+            transient = {}
+            while True:
+                idx = stream.u8()
+                if idx == TRANSIENT_STR_END:
+                    break
+                length = stream.u16()
+                transient[idx] = stream.bytes(length).decode('utf-8',
+                                                             'replace')
+
+            fmt = image.string_at(fmt_addr)
+            if fmt is None:
+                print('%s<format at 0x%x> args=%s' % (prefix, fmt_addr,
+                                                      args))
+            else:
+                print(prefix + format_message(image, fmt, args, transient))
+        elif msg_type in (MSG_TYPE_HEXDUMP, MSG_TYPE_RAW_STR):
+            length = stream.u16()
+            data = stream.bytes(length)
+
+            if msg_type == MSG_TYPE_RAW_STR:
+                sys.stdout.write(data.decode('utf-8', 'replace'))
+                continue
+
+            caption = image.string_at(fmt_addr) or ''
+            print(prefix + caption)
+            for offset in range(0, length, 16):
+                chunk = data[offset:offset + 16]
+                hexpart = ' '.join('%02x' % byte for byte in chunk)
+                text = ''.join(chr(byte) if 32 <= byte < 127 else '.'
+                               for byte in chunk)
+                print('%08x: %-47s |%s|' % (offset, hexpart, text))
+        else:
+            print('Unknown record type %d, stopping' % msg_type,
+                  file=sys.stderr)
+            return 1
+
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('elffile', help='ELF file of the build')
+    parser.add_argument('logfile', help='captured binary log stream')
+    args = parser.parse_args()
+
+    image = Image(args.elffile)
+
+    with open(args.logfile, 'rb') as fobj:
+        data = fobj.read()
+
+    return parse_stream(image, Stream(data, image.endian, image.ptr_size))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
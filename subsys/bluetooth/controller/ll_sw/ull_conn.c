@@ -8,6 +8,7 @@
 #include <zephyr.h>
 #include <device.h>
 #include <bluetooth/bluetooth.h>
+#include <bluetooth/controller.h>
 #include <sys/byteorder.h>
 
 #include "hal/ecb.h"
@@ -249,15 +250,24 @@ int ll_tx_mem_enqueue(uint16_t handle, void *tx)
 		static struct mayfly mfy = {0, 0, &link, NULL, tx_demux};
 
 #if defined(CONFIG_BT_CTLR_FORCE_MD_AUTO)
+		uint8_t previous, force_md_cnt;
+
+		/* Use the instantaneous Tx queue depth so that the connection
+		 * event under way is extended to drain the PDUs already
+		 * enqueued, and the throughput based estimate once the
+		 * incoming rate is known to saturate the Tx buffers.
+		 */
+		force_md_cnt = MFIFO_AVAIL_COUNT_GET(conn_tx);
 		if (tx_cnt >= CONFIG_BT_CTLR_TX_BUFFERS) {
-			uint8_t previous, force_md_cnt;
+			force_md_cnt = MAX(force_md_cnt,
+					   force_md_cnt_calc(&conn->lll,
+							     tx_rate));
+		}
 
-			force_md_cnt = force_md_cnt_calc(&conn->lll, tx_rate);
-			previous = lll_conn_force_md_cnt_set(force_md_cnt);
-			if (previous != force_md_cnt) {
-				BT_INFO("force_md_cnt: old= %u, new= %u.",
-					previous, force_md_cnt);
-			}
+		previous = lll_conn_force_md_cnt_set(force_md_cnt);
+		if (previous != force_md_cnt) {
+			BT_INFO("force_md_cnt: old= %u, new= %u.",
+				previous, force_md_cnt);
 		}
 #endif /* CONFIG_BT_CTLR_FORCE_MD_AUTO */
 
@@ -1003,6 +1013,29 @@ int ull_conn_llcp(struct ll_conn *conn, uint32_t ticks_at_expire, uint16_t lazy)
 	return 0;
 }
 
+#if defined(CONFIG_BT_CTLR_CONN_METRICS)
+static struct {
+	uint32_t events;
+	uint32_t events_trx;
+	uint32_t trx;
+} conn_metrics;
+
+void bt_ctlr_conn_metrics_get(uint32_t *events, uint32_t *events_trx,
+			      uint32_t *trx)
+{
+	*events = conn_metrics.events;
+	*events_trx = conn_metrics.events_trx;
+	*trx = conn_metrics.trx;
+}
+
+void bt_ctlr_conn_metrics_reset(void)
+{
+	conn_metrics.events = 0U;
+	conn_metrics.events_trx = 0U;
+	conn_metrics.trx = 0U;
+}
+#endif /* CONFIG_BT_CTLR_CONN_METRICS */
+
 void ull_conn_done(struct node_rx_event_done *done)
 {
 	struct lll_conn *lll = (void *)HDR_ULL2LLL(done->param);
@@ -1020,6 +1053,14 @@ void ull_conn_done(struct node_rx_event_done *done)
 		return;
 	}
 
+#if defined(CONFIG_BT_CTLR_CONN_METRICS)
+	conn_metrics.events++;
+	if (done->extra.trx_cnt) {
+		conn_metrics.events_trx++;
+		conn_metrics.trx += done->extra.trx_cnt;
+	}
+#endif /* CONFIG_BT_CTLR_CONN_METRICS */
+
 #if defined(CONFIG_BT_CTLR_LE_ENC)
 	/* Check authenticated payload expiry or MIC failure */
 	switch (done->extra.mic_state) {
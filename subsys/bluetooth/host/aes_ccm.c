@@ -15,6 +15,57 @@
 #define LOG_MODULE_NAME bt_aes_ccm
 #include "common/log.h"
 
+#include "crypto.h"
+
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+#include <crypto/cipher.h>
+
+static int ccm_accel_op(const uint8_t key[16], uint8_t nonce[13],
+			const uint8_t *in_msg, uint8_t *out_msg,
+			size_t msg_len, const uint8_t *aad, size_t aad_len,
+			uint8_t *tag, size_t mic_size, enum cipher_op op)
+{
+	const struct device *dev = bt_crypto_accel_dev();
+	struct cipher_ctx ctx = {
+		.keylen = 16,
+		.key.bit_stream = (uint8_t *)key,
+		.mode_params.ccm_info = {
+			.tag_len = mic_size,
+			.nonce_len = 13,
+		},
+		.flags = CAP_RAW_KEY | CAP_SYNC_OPS | CAP_SEPARATE_IO_BUFS,
+	};
+	struct cipher_pkt pkt = {
+		.in_buf = (uint8_t *)in_msg,
+		.in_len = msg_len,
+		.out_buf = out_msg,
+		.out_buf_max = msg_len,
+	};
+	struct cipher_aead_pkt aead = {
+		.pkt = &pkt,
+		.ad = (uint8_t *)aad,
+		.ad_len = aad_len,
+		.tag = tag,
+	};
+	int err;
+
+	if (!dev) {
+		return -ENODEV;
+	}
+
+	err = cipher_begin_session(dev, &ctx, CRYPTO_CIPHER_ALGO_AES,
+				   CRYPTO_CIPHER_MODE_CCM, op);
+	if (err) {
+		return err;
+	}
+
+	err = cipher_ccm_op(&ctx, &aead, nonce);
+	cipher_free_session(dev, &ctx);
+
+	return err;
+}
+#endif /* CONFIG_BT_HOST_CRYPTO_ACCEL */
+
 static inline void xor16(uint8_t *dst, const uint8_t *a, const uint8_t *b)
 {
 	dst[0] = a[0] ^ b[0];
@@ -196,6 +247,17 @@ int bt_ccm_decrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *enc_
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+	/* Fall through to the software implementation on any failure; an
+	 * authentication error fails there as well.
+	 */
+	if (!ccm_accel_op(key, nonce, enc_msg, out_msg, msg_len, aad, aad_len,
+			  (uint8_t *)(enc_msg + msg_len), mic_size,
+			  CRYPTO_CIPHER_OP_DECRYPT)) {
+		return 0;
+	}
+#endif
+
 	ccm_crypt(key, nonce, enc_msg, out_msg, msg_len);
 
 	ccm_auth(key, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
@@ -223,6 +285,13 @@ int bt_ccm_encrypt(const uint8_t key[16], uint8_t nonce[13], const uint8_t *msg,
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+	if (!ccm_accel_op(key, nonce, msg, out_msg, msg_len, aad, aad_len,
+			  mic, mic_size, CRYPTO_CIPHER_OP_ENCRYPT)) {
+		return 0;
+	}
+#endif
+
 	ccm_auth(key, nonce, out_msg, msg_len, aad, aad_len, mic, mic_size);
 
 	ccm_crypt(key, nonce, msg, out_msg, msg_len);
@@ -1118,10 +1118,9 @@ static bool send_frag(struct bt_conn *conn, struct net_buf *buf, uint8_t flags,
 	BT_DBG("conn %p buf %p len %u flags 0x%02x", conn, buf, buf->len,
 	       flags);
 
-	/* Wait until the controller can accept ACL packets */
-	k_sem_take(bt_conn_get_pkts(conn), K_FOREVER);
-
-	/* Check for disconnection while waiting for pkts_sem */
+	/* The caller has already taken a controller buffer from
+	 * bt_conn_get_pkts(conn), check only for disconnection.
+	 */
 	if (conn->state != BT_CONN_CONNECTED) {
 		goto fail;
 	}
@@ -1226,41 +1225,57 @@ static struct net_buf *create_frag(struct bt_conn *conn, struct net_buf *buf)
 
 static bool send_buf(struct bt_conn *conn, struct net_buf *buf)
 {
+	bool cont = atomic_test_bit(conn->flags, BT_CONN_TX_FRAG_CONT);
 	struct net_buf *frag;
 
 	BT_DBG("conn %p buf %p len %u", conn, buf, buf->len);
 
-	/* Send directly if the packet fits the ACL MTU */
-	if (buf->len <= conn_mtu(conn)) {
-		return send_frag(conn, buf, FRAG_SINGLE, false);
-	}
-
-	/* Create & enqueue first fragment */
-	frag = create_frag(conn, buf);
-	if (!frag) {
-		return false;
-	}
-
-	if (!send_frag(conn, frag, FRAG_START, true)) {
-		return false;
-	}
-
 	/*
 	 * Send the fragments. For the last one simply use the original
-	 * buffer (which works since we've used net_buf_pull on it.
+	 * buffer (which works since we've used net_buf_pull on it). A
+	 * controller buffer is reserved before splitting off each fragment
+	 * so that running out leaves buf intact and the remainder can be
+	 * deferred instead of blocking the TX thread, which would starve
+	 * the other connections.
 	 */
 	while (buf->len > conn_mtu(conn)) {
+		if (k_sem_take(bt_conn_get_pkts(conn), K_NO_WAIT)) {
+			goto defer;
+		}
+
 		frag = create_frag(conn, buf);
 		if (!frag) {
-			return false;
+			k_sem_give(bt_conn_get_pkts(conn));
+			goto fail;
 		}
 
-		if (!send_frag(conn, frag, FRAG_CONT, true)) {
-			return false;
+		if (!send_frag(conn, frag, cont ? FRAG_CONT : FRAG_START,
+			       true)) {
+			goto fail;
 		}
+
+		cont = true;
+		atomic_set_bit(conn->flags, BT_CONN_TX_FRAG_CONT);
+	}
+
+	if (k_sem_take(bt_conn_get_pkts(conn), K_NO_WAIT)) {
+		goto defer;
 	}
 
-	return send_frag(conn, buf, FRAG_END, false);
+	atomic_clear_bit(conn->flags, BT_CONN_TX_FRAG_CONT);
+
+	return send_frag(conn, buf, cont ? FRAG_END : FRAG_SINGLE, false);
+
+defer:
+	/* Park the remainder; conn_prepare_events() polls for returned
+	 * controller buffers and the TX thread resumes from here.
+	 */
+	conn->tx_defer = buf;
+	return true;
+
+fail:
+	atomic_clear_bit(conn->flags, BT_CONN_TX_FRAG_CONT);
+	return false;
 }
 
 static struct k_poll_signal conn_change =
@@ -1270,6 +1285,18 @@ static void conn_cleanup(struct bt_conn *conn)
 {
 	struct net_buf *buf;
 
+	/* Give back a deferred SDU remainder */
+	if (conn->tx_defer) {
+		if (tx_data(conn->tx_defer)->tx) {
+			tx_free(tx_data(conn->tx_defer)->tx);
+		}
+
+		net_buf_unref(conn->tx_defer);
+		conn->tx_defer = NULL;
+	}
+
+	atomic_clear_bit(conn->flags, BT_CONN_TX_FRAG_CONT);
+
 	/* Give back any allocated buffers */
 	while ((buf = net_buf_get(&conn->tx_queue, K_NO_WAIT))) {
 		if (tx_data(buf)->tx) {
@@ -1306,6 +1333,20 @@ static int conn_prepare_events(struct bt_conn *conn,
 
 	BT_DBG("Adding conn %p to poll list", conn);
 
+	if (conn->tx_defer) {
+		/* A partially sent SDU is parked on this connection; wait
+		 * for the controller to return buffers rather than for more
+		 * queued data, preserving fragment ordering on the link.
+		 */
+		k_poll_event_init(&events[0],
+				K_POLL_TYPE_SEM_AVAILABLE,
+				K_POLL_MODE_NOTIFY_ONLY,
+				bt_conn_get_pkts(conn));
+		events[0].tag = BT_EVENT_CONN_TX_RESUME;
+
+		return 0;
+	}
+
 	k_poll_event_init(&events[0],
 			K_POLL_TYPE_FIFO_DATA_AVAILABLE,
 			K_POLL_MODE_NOTIFY_ONLY,
@@ -1360,14 +1401,47 @@ void bt_conn_process_tx(struct bt_conn *conn)
 		return;
 	}
 
-	/* Get next ACL packet for connection */
-	buf = net_buf_get(&conn->tx_queue, K_NO_WAIT);
-	BT_ASSERT(buf);
+	/* Resume a deferred SDU remainder before taking new packets, so
+	 * that fragments are not interleaved on the link.
+	 */
+	if (conn->tx_defer) {
+		buf = conn->tx_defer;
+		conn->tx_defer = NULL;
+	} else {
+		/* Get next ACL packet for connection */
+		buf = net_buf_get(&conn->tx_queue, K_NO_WAIT);
+		BT_ASSERT(buf);
+	}
+
 	if (!send_buf(conn, buf)) {
 		net_buf_unref(buf);
 	}
 }
 
+void bt_conn_process_tx_deferred(void)
+{
+	struct bt_conn *conn;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(acl_conns); i++) {
+		conn = &acl_conns[i];
+
+		if (atomic_get(&conn->ref) && conn->tx_defer) {
+			bt_conn_process_tx(conn);
+		}
+	}
+
+#if defined(CONFIG_BT_ISO)
+	for (i = 0; i < ARRAY_SIZE(iso_conns); i++) {
+		conn = &iso_conns[i];
+
+		if (atomic_get(&conn->ref) && conn->tx_defer) {
+			bt_conn_process_tx(conn);
+		}
+	}
+#endif
+}
+
 bool bt_conn_exists_le(uint8_t id, const bt_addr_le_t *peer)
 {
 	struct bt_conn *conn = bt_conn_lookup_addr_le(id, peer);
@@ -42,6 +42,11 @@ enum {
 	 * is only needed for controllers with BT_QUIRK_NO_AUTO_DLE. */
 	BT_CONN_AUTO_DATA_LEN_COMPLETE,
 
+	/* The start of the SDU in tx_defer has been sent, the next
+	 * fragment is a continuation.
+	 */
+	BT_CONN_TX_FRAG_CONT,
+
 	/* Total number of flags - must be at the end of the enum */
 	BT_CONN_NUM_FLAGS,
 };
@@ -155,6 +160,11 @@ struct bt_conn {
 	/* Queue for outgoing ACL data */
 	struct k_fifo		tx_queue;
 
+	/* Remainder of a partially sent SDU, parked until the controller
+	 * returns buffers so that other connections can keep sending.
+	 */
+	struct net_buf		*tx_defer;
+
 	/* Active L2CAP/ISO channels */
 	sys_slist_t		channels;
 
@@ -368,3 +378,8 @@ struct k_sem *bt_conn_get_pkts(struct bt_conn *conn);
 /* k_poll related helpers for the TX thread */
 int bt_conn_prepare_events(struct k_poll_event events[]);
 void bt_conn_process_tx(struct bt_conn *conn);
+
+/* Resume connections that deferred a partially sent SDU waiting for
+ * controller buffers.
+ */
+void bt_conn_process_tx_deferred(void);
@@ -26,9 +26,82 @@
 #include "common/log.h"
 
 #include "hci_core.h"
+#include "crypto.h"
 
 static struct tc_hmac_prng_struct prng;
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+#include <crypto/cipher.h>
+
+/* Capabilities needed to off-load the one-shot AES operations */
+#define BT_CRYPTO_ACCEL_CAPS (CAP_RAW_KEY | CAP_SYNC_OPS | \
+			      CAP_SEPARATE_IO_BUFS)
+
+static const struct device *crypto_accel_dev;
+
+const struct device *bt_crypto_accel_dev(void)
+{
+	return crypto_accel_dev;
+}
+
+static void crypto_accel_init(void)
+{
+	const struct device *dev;
+	int caps;
+
+	dev = device_get_binding(CONFIG_BT_HOST_CRYPTO_ACCEL_DEV_NAME);
+	if (!dev) {
+		BT_WARN("Crypto device %s not found, using TinyCrypt",
+			CONFIG_BT_HOST_CRYPTO_ACCEL_DEV_NAME);
+		return;
+	}
+
+	caps = cipher_query_hwcaps(dev);
+	if ((caps & BT_CRYPTO_ACCEL_CAPS) != BT_CRYPTO_ACCEL_CAPS) {
+		BT_WARN("Crypto device %s lacks capabilities (got 0x%x), "
+			"using TinyCrypt",
+			CONFIG_BT_HOST_CRYPTO_ACCEL_DEV_NAME, caps);
+		return;
+	}
+
+	crypto_accel_dev = dev;
+}
+
+static int accel_encrypt_be(const uint8_t key[16], const uint8_t plaintext[16],
+			    uint8_t enc_data[16])
+{
+	struct cipher_ctx ctx = {
+		.keylen = 16,
+		.key.bit_stream = (uint8_t *)key,
+		.flags = BT_CRYPTO_ACCEL_CAPS,
+	};
+	struct cipher_pkt pkt = {
+		.in_buf = (uint8_t *)plaintext,
+		.in_len = 16,
+		.out_buf = enc_data,
+		.out_buf_max = 16,
+	};
+	int err;
+
+	if (!crypto_accel_dev) {
+		return -ENODEV;
+	}
+
+	err = cipher_begin_session(crypto_accel_dev, &ctx,
+				   CRYPTO_CIPHER_ALGO_AES,
+				   CRYPTO_CIPHER_MODE_ECB,
+				   CRYPTO_CIPHER_OP_ENCRYPT);
+	if (err) {
+		return err;
+	}
+
+	err = cipher_block_op(&ctx, &pkt);
+	cipher_free_session(crypto_accel_dev, &ctx);
+
+	return err;
+}
+#endif /* CONFIG_BT_HOST_CRYPTO_ACCEL */
+
 static int prng_reseed(struct tc_hmac_prng_struct *h)
 {
 	uint8_t seed[32];
@@ -69,6 +142,10 @@ int prng_init(void)
 	struct net_buf *rsp;
 	int ret;
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+	crypto_accel_init();
+#endif
+
 	/* Check first that HCI_LE_Rand is supported */
 	if (!BT_CMD_TEST(bt_dev.supported_commands, 27, 7)) {
 		return -ENOTSUP;
@@ -124,6 +201,22 @@ int bt_encrypt_le(const uint8_t key[16], const uint8_t plaintext[16],
 	BT_DBG("key %s", bt_hex(key, 16));
 	BT_DBG("plaintext %s", bt_hex(plaintext, 16));
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+	{
+		uint8_t key_be[16], plaintext_be[16];
+
+		sys_memcpy_swap(key_be, key, 16);
+		sys_memcpy_swap(plaintext_be, plaintext, 16);
+
+		if (!accel_encrypt_be(key_be, plaintext_be, enc_data)) {
+			sys_mem_swap(enc_data, 16);
+
+			BT_DBG("enc_data %s", bt_hex(enc_data, 16));
+			return 0;
+		}
+	}
+#endif
+
 	sys_memcpy_swap(tmp, key, 16);
 
 	if (tc_aes128_set_encrypt_key(&s, tmp) == TC_CRYPTO_FAIL) {
@@ -151,6 +244,13 @@ int bt_encrypt_be(const uint8_t key[16], const uint8_t plaintext[16],
 	BT_DBG("key %s", bt_hex(key, 16));
 	BT_DBG("plaintext %s", bt_hex(plaintext, 16));
 
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+	if (!accel_encrypt_be(key, plaintext, enc_data)) {
+		BT_DBG("enc_data %s", bt_hex(enc_data, 16));
+		return 0;
+	}
+#endif
+
 	if (tc_aes128_set_encrypt_key(&s, key) == TC_CRYPTO_FAIL) {
 		return -EINVAL;
 	}
@@ -6,3 +6,8 @@
  */
 
 int prng_init(void);
+
+#if defined(CONFIG_BT_HOST_CRYPTO_ACCEL)
+/* Crypto device used for AES dispatch, NULL when unavailable */
+const struct device *bt_crypto_accel_dev(void);
+#endif
@@ -52,6 +52,18 @@
 
 static uint16_t last_static_handle;
 
+extern struct bt_gatt_service_static _bt_gatt_service_static_list_start[];
+extern struct bt_gatt_service_static _bt_gatt_service_static_list_end[];
+
+/* Static attribute handles are assigned densely in section order, so a
+ * handle is resolved by walking the service list while summing attribute
+ * counts. ATT traffic overwhelmingly visits the database in ascending
+ * handle order, so cache where the last lookup ended and resume from
+ * there. The service index and its start handle are packed into a single
+ * atomic word so that concurrent lookups never observe a torn pair.
+ */
+static atomic_t static_svc_cache = ATOMIC_INIT(1);
+
 /* Persistent storage format for GATT CCC */
 struct ccc_store {
 	uint16_t handle;
@@ -1504,6 +1516,36 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 }
 
+static const struct bt_gatt_service_static *
+static_svc_from_handle(uint16_t handle, uint16_t *start_handle)
+{
+	const struct bt_gatt_service_static *static_svc =
+		_bt_gatt_service_static_list_start;
+	uint32_t cache = (uint32_t)atomic_get(&static_svc_cache);
+	uint16_t start = 1U;
+
+	/* Resume from the cached position when it does not overshoot */
+	if (handle >= (uint16_t)cache) {
+		static_svc += cache >> 16;
+		start = (uint16_t)cache;
+	}
+
+	for (; static_svc < _bt_gatt_service_static_list_end; static_svc++) {
+		if (handle < start + static_svc->attr_count) {
+			atomic_set(&static_svc_cache,
+				   ((uint32_t)(static_svc -
+				    _bt_gatt_service_static_list_start) << 16) |
+				   start);
+			*start_handle = start;
+			return static_svc;
+		}
+
+		start += static_svc->attr_count;
+	}
+
+	return NULL;
+}
+
 void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 			       const struct bt_uuid *uuid,
 			       const void *attr_data, uint16_t num_matches,
@@ -1516,15 +1558,14 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 	}
 
 	if (start_handle <= last_static_handle) {
-		uint16_t handle = 1;
+		const struct bt_gatt_service_static *static_svc;
+		uint16_t handle = 0U;
 
-		Z_STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
-			/* Skip ahead if start is not within service handles */
-			if (handle + static_svc->attr_count < start_handle) {
-				handle += static_svc->attr_count;
-				continue;
-			}
+		static_svc = static_svc_from_handle(MAX(start_handle, 1),
+						    &handle);
 
+		for (; static_svc && static_svc < _bt_gatt_service_static_list_end;
+		     static_svc++) {
 			for (i = 0; i < static_svc->attr_count; i++, handle++) {
 				if (gatt_foreach_iter(&static_svc->attrs[i],
 						      handle, start_handle,
@@ -1784,6 +1825,15 @@ static void notify_mult_process(struct k_work *work)
 		if (*buf) {
 			struct bt_conn *conn = bt_conn_lookup_index(i);
 
+			if (!conn) {
+				/* Connection is gone, drop the pending
+				 * notifications.
+				 */
+				net_buf_unref(*buf);
+				*buf = NULL;
+				continue;
+			}
+
 			gatt_notify_mult_send(conn, buf);
 			bt_conn_unref(conn);
 		}
@@ -1871,7 +1921,11 @@ static int gatt_notify(struct bt_conn *conn, uint16_t handle,
 		int err;
 
 		err = gatt_notify_mult(conn, handle, params);
-		if (err && err != -ENOMEM) {
+		/* Value queued into a Multiple Handle Value Notification,
+		 * only fall back to a single notification PDU if we could
+		 * not allocate the batching buffer.
+		 */
+		if (err != -ENOMEM) {
 			return err;
 		}
 	}
@@ -62,6 +62,10 @@
 static struct k_thread rx_thread_data;
 static K_KERNEL_STACK_DEFINE(rx_thread_stack, CONFIG_BT_RX_STACK_SIZE);
 #endif
+#if defined(CONFIG_BT_RX_SEGREGATE_ACL)
+static struct k_thread rx_acl_thread_data;
+static K_KERNEL_STACK_DEFINE(rx_acl_thread_stack, CONFIG_BT_RX_STACK_SIZE);
+#endif
 static struct k_thread tx_thread_data;
 static K_KERNEL_STACK_DEFINE(tx_thread_stack, CONFIG_BT_HCI_TX_STACK_SIZE);
 
@@ -82,6 +86,9 @@ struct bt_dev bt_dev = {
 #if !defined(CONFIG_BT_RECV_IS_RX_THREAD)
 	.rx_queue      = Z_FIFO_INITIALIZER(bt_dev.rx_queue),
 #endif
+#if defined(CONFIG_BT_RX_SEGREGATE_ACL)
+	.rx_acl_queue  = Z_FIFO_INITIALIZER(bt_dev.rx_acl_queue),
+#endif
 };
 
 static bt_ready_cb_t ready_cb;
@@ -5189,6 +5196,12 @@ static void process_events(struct k_poll_event *ev, int count)
 				}
 			}
 			break;
+		case K_POLL_STATE_SEM_AVAILABLE:
+			if (IS_ENABLED(CONFIG_BT_CONN) &&
+			    ev->tag == BT_EVENT_CONN_TX_RESUME) {
+				bt_conn_process_tx_deferred();
+			}
+			break;
 		case K_POLL_STATE_NOT_READY:
 			break;
 		default:
@@ -6371,6 +6384,8 @@ int bt_recv(struct net_buf *buf)
 	case BT_BUF_ACL_IN:
 #if defined(CONFIG_BT_RECV_IS_RX_THREAD)
 		hci_acl(buf);
+#elif defined(CONFIG_BT_RX_SEGREGATE_ACL)
+		net_buf_put(&bt_dev.rx_acl_queue, buf);
 #else
 		net_buf_put(&bt_dev.rx_queue, buf);
 #endif
@@ -6399,6 +6414,8 @@ int bt_recv(struct net_buf *buf)
 	case BT_BUF_ISO_IN:
 #if defined(CONFIG_BT_RECV_IS_RX_THREAD)
 		hci_iso(buf);
+#elif defined(CONFIG_BT_RX_SEGREGATE_ACL)
+		net_buf_put(&bt_dev.rx_acl_queue, buf);
 #else
 		net_buf_put(&bt_dev.rx_queue, buf);
 #endif
@@ -6498,6 +6515,42 @@ static void init_work(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_BT_RX_SEGREGATE_ACL)
+static void hci_rx_acl_thread(void)
+{
+	struct net_buf *buf;
+
+	BT_DBG("started");
+
+	while (1) {
+		buf = net_buf_get(&bt_dev.rx_acl_queue, K_FOREVER);
+
+		BT_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf),
+		       buf->len);
+
+		switch (bt_buf_get_type(buf)) {
+		case BT_BUF_ACL_IN:
+			hci_acl(buf);
+			break;
+#if defined(CONFIG_BT_ISO)
+		case BT_BUF_ISO_IN:
+			hci_iso(buf);
+			break;
+#endif /* CONFIG_BT_ISO */
+		default:
+			BT_ERR("Unknown buf type %u", bt_buf_get_type(buf));
+			net_buf_unref(buf);
+			break;
+		}
+
+		/* Make sure we don't hog the CPU if the queue never
+		 * gets empty.
+		 */
+		k_yield();
+	}
+}
+#endif /* CONFIG_BT_RX_SEGREGATE_ACL */
+
 #if !defined(CONFIG_BT_RECV_IS_RX_THREAD)
 static void hci_rx_thread(void)
 {
@@ -6582,6 +6635,16 @@ int bt_enable(bt_ready_cb_t cb)
 	k_thread_name_set(&rx_thread_data, "BT RX");
 #endif
 
+#if defined(CONFIG_BT_RX_SEGREGATE_ACL)
+	/* Dedicated thread for incoming ACL and ISO data */
+	k_thread_create(&rx_acl_thread_data, rx_acl_thread_stack,
+			K_KERNEL_STACK_SIZEOF(rx_acl_thread_stack),
+			(k_thread_entry_t)hci_rx_acl_thread, NULL, NULL, NULL,
+			K_PRIO_COOP(CONFIG_BT_RX_PRIO),
+			0, K_NO_WAIT);
+	k_thread_name_set(&rx_acl_thread_data, "BT RX ACL");
+#endif
+
 	if (IS_ENABLED(CONFIG_BT_TINYCRYPT_ECC)) {
 		bt_hci_ecc_init();
 	}
@@ -23,6 +23,7 @@
 enum {
 	BT_EVENT_CMD_TX,
 	BT_EVENT_CONN_TX_QUEUE,
+	BT_EVENT_CONN_TX_RESUME,
 };
 
 /* bt_dev flags: the flags defined here represent BT controller state */
@@ -278,6 +279,13 @@ struct bt_dev {
 	struct k_fifo		rx_queue;
 #endif
 
+#if defined(CONFIG_BT_RX_SEGREGATE_ACL)
+	/* Queue for incoming ACL and ISO data, drained by its own
+	 * thread so that bulk data does not wait for event handlers.
+	 */
+	struct k_fifo		rx_acl_queue;
+#endif
+
 	/* Queue for outgoing HCI commands */
 	struct k_fifo		cmd_tx_queue;
 
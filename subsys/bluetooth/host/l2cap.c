@@ -796,7 +796,9 @@ static void l2cap_chan_rx_init(struct bt_l2cap_le_chan *chan)
 
 	/* Use existing credits if defined */
 	if (!chan->rx.init_credits) {
-		if (chan->chan.ops->alloc_buf) {
+		if (CONFIG_BT_L2CAP_INIT_CREDITS > 0) {
+			chan->rx.init_credits = CONFIG_BT_L2CAP_INIT_CREDITS;
+		} else if (chan->chan.ops->alloc_buf) {
 			/* Auto tune credits to receive a full packet */
 			chan->rx.init_credits =
 				ceiling_fraction(chan->rx.mtu,
@@ -807,6 +809,7 @@ static void l2cap_chan_rx_init(struct bt_l2cap_le_chan *chan)
 	}
 
 	atomic_set(&chan->rx.credits,  0);
+	chan->rx.pending_credits = 0U;
 
 	if (BT_DBG_ENABLED &&
 	    chan->rx.init_credits * chan->rx.mps < chan->rx.mtu + 2) {
@@ -2024,6 +2027,29 @@ static void l2cap_chan_send_credits(struct bt_l2cap_le_chan *chan,
 	BT_DBG("chan %p credits %u", chan, atomic_get(&chan->rx.credits));
 }
 
+static void l2cap_chan_replenish_credits(struct bt_l2cap_le_chan *chan,
+					 struct net_buf *buf,
+					 uint16_t credits)
+{
+	chan->rx.pending_credits += credits;
+
+	/* Batch credit returns: keep accumulating while the remote still
+	 * has credits above the watermark and less than a full initial
+	 * window is owed, so one LE Flow Control Credit PDU replenishes
+	 * many SDUs worth of credits.
+	 */
+	if (atomic_get(&chan->rx.credits) >
+	    CONFIG_BT_L2CAP_CREDITS_WATERMARK &&
+	    chan->rx.pending_credits < chan->rx.init_credits) {
+		return;
+	}
+
+	credits = MIN(chan->rx.pending_credits, chan->rx.init_credits);
+	chan->rx.pending_credits -= credits;
+
+	l2cap_chan_send_credits(chan, buf, credits);
+}
+
 static void l2cap_chan_update_credits(struct bt_l2cap_le_chan *chan,
 				      struct net_buf *buf)
 {
@@ -2065,7 +2091,7 @@ int bt_l2cap_chan_recv_complete(struct bt_l2cap_chan *chan, struct net_buf *buf)
 	/* Restore credits used by packet */
 	memcpy(&credits, net_buf_user_data(buf), sizeof(credits));
 
-	l2cap_chan_send_credits(ch, buf, credits);
+	l2cap_chan_replenish_credits(ch, buf, credits);
 
 	net_buf_unref(buf);
 
@@ -2105,7 +2131,7 @@ static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 		return;
 	}
 
-	l2cap_chan_send_credits(chan, buf, seg);
+	l2cap_chan_replenish_credits(chan, buf, seg);
 	net_buf_unref(buf);
 }
 
@@ -59,6 +59,25 @@ static struct bt_mesh_adv *adv_alloc(int id)
 	return &adv_pool[id];
 }
 
+#if defined(CONFIG_BT_MESH_ADV_EXT)
+/* One persistent advertising set is reused for all buffers; the set is
+ * only reconfigured when the requested advertising interval changes.
+ */
+static struct bt_le_ext_adv *adv_set;
+static uint16_t adv_set_int;
+static K_SEM_DEFINE(adv_sent_sem, 0, 1);
+
+static void adv_set_sent(struct bt_le_ext_adv *adv,
+			 struct bt_le_ext_adv_sent_info *info)
+{
+	k_sem_give(&adv_sent_sem);
+}
+
+static const struct bt_le_ext_adv_cb adv_set_cb = {
+	.sent = adv_set_sent,
+};
+#endif /* CONFIG_BT_MESH_ADV_EXT */
+
 static inline void adv_send_start(uint16_t duration, int err,
 				  const struct bt_mesh_send_cb *cb,
 				  void *cb_data)
@@ -119,6 +138,57 @@ static inline void adv_send(struct net_buf *buf)
 	param.interval_min = ADV_SCAN_UNIT(adv_int);
 	param.interval_max = param.interval_min;
 
+#if defined(CONFIG_BT_MESH_ADV_EXT)
+	struct bt_le_ext_adv_start_param start = {
+		.num_events =
+			BT_MESH_TRANSMIT_COUNT(BT_MESH_ADV(buf)->xmit) + 1,
+	};
+
+	if (!adv_set) {
+		err = bt_le_ext_adv_create(&param, &adv_set_cb, &adv_set);
+	} else if (adv_int != adv_set_int) {
+		err = bt_le_ext_adv_update_param(adv_set, &param);
+	} else {
+		err = 0;
+	}
+
+	if (err) {
+		BT_ERR("Advertising set setup failed: err %d", err);
+		net_buf_unref(buf);
+		adv_send_start(duration, err, cb, cb_data);
+		return;
+	}
+
+	adv_set_int = adv_int;
+
+	err = bt_le_ext_adv_set_data(adv_set, &ad, 1, NULL, 0);
+	if (!err) {
+		k_sem_reset(&adv_sent_sem);
+		err = bt_le_ext_adv_start(adv_set, &start);
+	}
+
+	net_buf_unref(buf);
+	adv_send_start(duration, err, cb, cb_data);
+	if (err) {
+		BT_ERR("Advertising failed: err %d", err);
+		return;
+	}
+
+	BT_DBG("Advertising started. Waiting for %u events", start.num_events);
+
+	/* The sent event arrives as soon as the controller has finished
+	 * the requested number of advertising events; the computed
+	 * duration only bounds the wait.
+	 */
+	if (k_sem_take(&adv_sent_sem, K_MSEC(duration)) != 0) {
+		BT_WARN("Advertising did not finish within %ums", duration);
+		(void)bt_le_ext_adv_stop(adv_set);
+	}
+
+	adv_send_end(0, cb, cb_data);
+
+	BT_DBG("Advertising stopped");
+#else /* !CONFIG_BT_MESH_ADV_EXT */
 	err = bt_le_adv_start(&param, &ad, 1, NULL, 0);
 	net_buf_unref(buf);
 	adv_send_start(duration, err, cb, cb_data);
@@ -139,6 +209,7 @@ static inline void adv_send(struct net_buf *buf)
 	}
 
 	BT_DBG("Advertising stopped");
+#endif /* !CONFIG_BT_MESH_ADV_EXT */
 }
 
 static void adv_thread(void *p1, void *p2, void *p3)
@@ -32,10 +32,50 @@
 
 static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
+/* Hash index over replay_list. Each bucket holds a one-based entry index
+ * (zero meaning an empty bucket), with collisions chained through
+ * rpl_next, so that the source address lookup done for every received
+ * network PDU does not scan the whole list.
+ */
+static uint16_t rpl_hash[CONFIG_BT_MESH_CRPL];
+static uint16_t rpl_next[CONFIG_BT_MESH_CRPL];
+
+static uint16_t *rpl_bucket(uint16_t src)
+{
+	return &rpl_hash[src % ARRAY_SIZE(rpl_hash)];
+}
+
+static void rpl_idx_insert(struct bt_mesh_rpl *rpl)
+{
+	uint16_t *bucket = rpl_bucket(rpl->src);
+	uint16_t idx = rpl - replay_list;
+
+	rpl_next[idx] = *bucket;
+	*bucket = idx + 1;
+}
+
+static void rpl_idx_rebuild(void)
+{
+	int i;
+
+	(void)memset(rpl_hash, 0, sizeof(rpl_hash));
+
+	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (replay_list[i].src) {
+			rpl_idx_insert(&replay_list[i]);
+		}
+	}
+}
+
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
-	rpl->src = rx->ctx.addr;
+	/* Fresh entries get indexed once the source address is assigned */
+	if (!rpl->src) {
+		rpl->src = rx->ctx.addr;
+		rpl_idx_insert(rpl);
+	}
+
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
 
@@ -52,6 +92,7 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match)
 {
+	struct bt_mesh_rpl *rpl;
 	int i;
 
 	/* Don't bother checking messages from ourselves */
@@ -64,11 +105,15 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		struct bt_mesh_rpl *rpl = &replay_list[i];
+	/* Existing slot for given address */
+	rpl = bt_mesh_rpl_find(rx->ctx.addr);
+	if (rpl) {
+		if (rx->old_iv && !rpl->old_iv) {
+			return true;
+		}
 
-		/* Empty slot */
-		if (!rpl->src) {
+		if ((!rx->old_iv && rpl->old_iv) ||
+		    rpl->seq < rx->seq) {
 			if (match) {
 				*match = rpl;
 			} else {
@@ -76,26 +121,23 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 			}
 
 			return false;
+		} else {
+			return true;
 		}
+	}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
-
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				if (match) {
-					*match = rpl;
-				} else {
-					bt_mesh_rpl_update(rpl, rx);
-				}
+	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		rpl = &replay_list[i];
 
-				return false;
+		/* Empty slot */
+		if (!rpl->src) {
+			if (match) {
+				*match = rpl;
 			} else {
-				return true;
+				bt_mesh_rpl_update(rpl, rx);
 			}
+
+			return false;
 		}
 	}
 
@@ -111,17 +153,28 @@ void bt_mesh_rpl_clear(void)
 		bt_mesh_clear_rpl();
 	} else {
 		(void)memset(replay_list, 0, sizeof(replay_list));
+		(void)memset(rpl_hash, 0, sizeof(rpl_hash));
 	}
 }
 
+void bt_mesh_rpl_entry_clear(struct bt_mesh_rpl *rpl)
+{
+	(void)memset(rpl, 0, sizeof(*rpl));
+	rpl_idx_rebuild();
+}
+
 struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
 {
-	int i;
+	uint16_t cur = *rpl_bucket(src);
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		if (replay_list[i].src == src) {
-			return &replay_list[i];
+	while (cur) {
+		struct bt_mesh_rpl *rpl = &replay_list[cur - 1];
+
+		if (rpl->src == src) {
+			return rpl;
 		}
+
+		cur = rpl_next[cur - 1];
 	}
 
 	return NULL;
@@ -134,6 +187,7 @@ struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		if (!replay_list[i].src) {
 			replay_list[i].src = src;
+			rpl_idx_insert(&replay_list[i]);
 			return &replay_list[i];
 		}
 	}
@@ -172,4 +226,6 @@ void bt_mesh_rpl_reset(void)
 			}
 		}
 	}
+
+	rpl_idx_rebuild();
 }
@@ -302,7 +302,7 @@ static int rpl_set(const char *name, size_t len_rd,
 	if (len_rd == 0) {
 		BT_DBG("val (null)");
 		if (entry) {
-			(void)memset(entry, 0, sizeof(*entry));
+			bt_mesh_rpl_entry_clear(entry);
 		} else {
 			BT_WARN("Unable to find RPL entry for 0x%04x", src);
 		}
@@ -1230,7 +1230,7 @@ static void clear_rpl(struct bt_mesh_rpl *rpl, void *user_data)
 		BT_DBG("Cleared RPL");
 	}
 
-	(void)memset(rpl, 0, sizeof(*rpl));
+	bt_mesh_rpl_entry_clear(rpl);
 }
 
 static void store_pending_rpl(struct bt_mesh_rpl *rpl, void *user_data)
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <sys/util.h>
+#include <storage/flash_map.h>
+
+#include <debug/coredump.h>
+#include "coredump_internal.h"
+
+/*
+ * Backend storing core dumps in the flash partition with DTS label
+ * "coredump-partition". The partition is divided into
+ * CONFIG_DEBUG_COREDUMP_FLASH_SLOTS equally sized slots, each holding
+ * one dump behind a small header. A new dump is written to an empty
+ * slot if there is one, otherwise to the slot holding the oldest dump,
+ * so the most recent dumps survive reboots.
+ */
+
+#define FLASH_PARTITION_ID	FLASH_AREA_ID(coredump_partition)
+
+#define SLOT_COUNT		CONFIG_DEBUG_COREDUMP_FLASH_SLOTS
+
+/* Dump data starts at a fixed offset so the slot header can be
+ * written after the dump length is known without disturbing data.
+ */
+#define SLOT_DATA_OFFSET	16
+
+#define SLOT_HDR_VER		1
+
+#define SLOT_HDR_FLAG_ERROR	0x1
+
+struct flash_slot_hdr {
+	/* 'C', 'D' */
+	char		id[2];
+
+	/* Header version */
+	uint8_t		hdr_version;
+
+	/* SLOT_HDR_FLAG_* */
+	uint8_t		flags;
+
+	/* Sequence number, higher means more recent */
+	uint32_t	seq;
+
+	/* Number of dump data bytes stored in the slot */
+	uint32_t	length;
+} __packed;
+
+static const struct flash_area *flash_fa;
+static size_t slot_size;
+static off_t slot_off;
+static size_t write_len;
+static uint32_t next_seq;
+static uint8_t slot_flags;
+static int backend_error;
+
+/* Write accumulator honoring the flash write block size. Its size
+ * is a multiple of every power-of-two write alignment up to itself.
+ */
+static uint8_t write_buf[64];
+static size_t write_buf_len;
+
+static bool slot_hdr_read(int slot, struct flash_slot_hdr *hdr)
+{
+	int err;
+
+	err = flash_area_read(flash_fa, slot * slot_size, hdr, sizeof(*hdr));
+	if (err != 0) {
+		return false;
+	}
+
+	return (hdr->id[0] == 'C') && (hdr->id[1] == 'D') &&
+	       (hdr->hdr_version == SLOT_HDR_VER) &&
+	       (hdr->length <= (slot_size - SLOT_DATA_OFFSET));
+}
+
+static void coredump_flash_backend_start(void)
+{
+	struct flash_slot_hdr hdr;
+	uint32_t target_seq = UINT32_MAX;
+	uint32_t max_seq = 0;
+	int target = 0;
+
+	write_len = 0;
+	write_buf_len = 0;
+	slot_flags = 0;
+
+	backend_error = flash_area_open(FLASH_PARTITION_ID, &flash_fa);
+	if (backend_error != 0) {
+		return;
+	}
+
+	slot_size = flash_fa->fa_size / SLOT_COUNT;
+
+	for (int i = 0; i < SLOT_COUNT; i++) {
+		if (slot_hdr_read(i, &hdr)) {
+			if (hdr.seq > max_seq) {
+				max_seq = hdr.seq;
+			}
+			if (hdr.seq < target_seq) {
+				target_seq = hdr.seq;
+				target = i;
+			}
+		} else if (target_seq != 0) {
+			/* Empty or corrupted slots are overwritten first */
+			target_seq = 0;
+			target = i;
+		}
+	}
+
+	slot_off = target * slot_size;
+	next_seq = max_seq + 1;
+
+	backend_error = flash_area_erase(flash_fa, slot_off, slot_size);
+}
+
+static int flash_buf_flush(void)
+{
+	uint8_t align = flash_area_align(flash_fa);
+	size_t len = ROUND_UP(write_buf_len, align);
+	int err;
+
+	if (write_buf_len == 0) {
+		return 0;
+	}
+
+	/* Pad up to the write block size with erased flash content */
+	memset(&write_buf[write_buf_len], 0xff, len - write_buf_len);
+
+	err = flash_area_write(flash_fa,
+			       slot_off + SLOT_DATA_OFFSET + write_len,
+			       write_buf, len);
+	if (err == 0) {
+		write_len += write_buf_len;
+	}
+	write_buf_len = 0;
+
+	return err;
+}
+
+static int coredump_flash_backend_buffer_output(uint8_t *buf, size_t buflen)
+{
+	if ((buf == NULL) || (buflen == 0)) {
+		return -EINVAL;
+	}
+
+	if (backend_error != 0) {
+		return backend_error;
+	}
+
+	if ((write_len + write_buf_len + buflen) >
+	    (slot_size - SLOT_DATA_OFFSET)) {
+		backend_error = -ENOMEM;
+		return backend_error;
+	}
+
+	while (buflen > 0) {
+		size_t copy = MIN(buflen, sizeof(write_buf) - write_buf_len);
+
+		memcpy(&write_buf[write_buf_len], buf, copy);
+		write_buf_len += copy;
+		buf += copy;
+		buflen -= copy;
+
+		if (write_buf_len == sizeof(write_buf)) {
+			backend_error = flash_buf_flush();
+			if (backend_error != 0) {
+				return backend_error;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void coredump_flash_backend_end(void)
+{
+	struct flash_slot_hdr hdr = {
+		.id = { 'C', 'D' },
+		.hdr_version = SLOT_HDR_VER,
+	};
+	uint8_t hdr_buf[SLOT_DATA_OFFSET];
+	int err;
+
+	if (backend_error != 0) {
+		return;
+	}
+
+	err = flash_buf_flush();
+	if (err != 0) {
+		return;
+	}
+
+	hdr.flags = slot_flags;
+	hdr.seq = next_seq;
+	hdr.length = write_len;
+
+	memset(hdr_buf, 0xff, sizeof(hdr_buf));
+	memcpy(hdr_buf, &hdr, sizeof(hdr));
+
+	(void)flash_area_write(flash_fa, slot_off, hdr_buf, sizeof(hdr_buf));
+}
+
+static void coredump_flash_backend_error(void)
+{
+	slot_flags |= SLOT_HDR_FLAG_ERROR;
+}
+
+int z_coredump_flash_dump_size(uint8_t slot)
+{
+	struct flash_slot_hdr hdr;
+	const struct flash_area *fa;
+	int err;
+
+	if (slot >= SLOT_COUNT) {
+		return -EINVAL;
+	}
+
+	err = flash_area_open(FLASH_PARTITION_ID, &fa);
+	if (err != 0) {
+		return err;
+	}
+
+	flash_fa = fa;
+	slot_size = fa->fa_size / SLOT_COUNT;
+
+	if (!slot_hdr_read(slot, &hdr)) {
+		return -ENOENT;
+	}
+
+	return hdr.length;
+}
+
+int z_coredump_flash_dump_read(uint8_t slot, off_t offset,
+			       uint8_t *dst, size_t len)
+{
+	int size = z_coredump_flash_dump_size(slot);
+
+	if (size < 0) {
+		return size;
+	}
+
+	if ((offset + len) > (size_t)size) {
+		return -EINVAL;
+	}
+
+	return flash_area_read(flash_fa,
+			       (slot * slot_size) + SLOT_DATA_OFFSET + offset,
+			       dst, len);
+}
+
+struct z_coredump_backend_api z_coredump_backend_flash_partition = {
+	.start = coredump_flash_backend_start,
+	.end = coredump_flash_backend_end,
+	.error = coredump_flash_backend_error,
+	.buffer_output = coredump_flash_backend_buffer_output,
+};
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <toolchain.h>
+#include <sys/byteorder.h>
+#include <sys/util.h>
+
+#include "coredump_internal.h"
+
+/*
+ * Streaming compressor sitting between the coredump core and the
+ * selected backend. Output is compressed in independent LZ4 blocks of
+ * up to CONFIG_DEBUG_COREDUMP_COMPRESSION_BLOCK_SIZE input bytes, each
+ * preceded by a four byte frame header:
+ *
+ *   uint16_t little-endian stored size
+ *   uint16_t little-endian original size
+ *
+ * A block whose stored size equals its original size is not
+ * compressed. This is decoded by scripts/coredump/parser.
+ */
+
+#define BLOCK_SIZE	CONFIG_DEBUG_COREDUMP_COMPRESSION_BLOCK_SIZE
+
+#define HASH_BITS	8
+#define HASH_SIZE	(1 << HASH_BITS)
+
+/* Minimum match length of the LZ4 format */
+#define MIN_MATCH	4
+
+/* The LZ4 format requires the last five bytes of a block
+ * to be literals.
+ */
+#define LAST_LITERALS	5
+
+static uint8_t in_buf[BLOCK_SIZE];
+static uint8_t out_buf[BLOCK_SIZE];
+static uint16_t hash_tbl[HASH_SIZE];
+static size_t in_len;
+
+static uint32_t peek32(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+
+	return v;
+}
+
+static uint32_t hash32(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - HASH_BITS);
+}
+
+/* Emit a literal or match length in LZ4 form: a 4-bit field already
+ * stored in the token, then as many 255 bytes as needed plus the
+ * remainder.
+ */
+static size_t put_length(uint8_t *dst, size_t op, size_t cap, size_t len)
+{
+	while (len >= 255 && op < cap) {
+		dst[op++] = 255;
+		len -= 255;
+	}
+
+	if (op < cap) {
+		dst[op++] = len;
+	}
+
+	return op;
+}
+
+/**
+ * @brief Compress one block in LZ4 block format.
+ *
+ * @return Compressed size, or 0 if the result would not be
+ *         smaller than @a cap.
+ */
+static size_t compress_block(const uint8_t *src, size_t len,
+			     uint8_t *dst, size_t cap)
+{
+	size_t match_limit = (len > LAST_LITERALS) ? len - LAST_LITERALS : 0;
+	size_t ip = 0, anchor = 0, op = 0;
+	size_t lit;
+	uint8_t *token;
+
+	memset(hash_tbl, 0, sizeof(hash_tbl));
+
+	while ((ip + MIN_MATCH) <= match_limit) {
+		uint32_t seq = peek32(&src[ip]);
+		uint32_t h = hash32(seq);
+		size_t ref = hash_tbl[h];
+		size_t mlen;
+
+		hash_tbl[h] = ip;
+
+		/* A stale table entry is rejected by the content
+		 * compare below.
+		 */
+		if ((ref >= ip) || ((ip - ref) > UINT16_MAX) ||
+		    (peek32(&src[ref]) != seq)) {
+			ip++;
+			continue;
+		}
+
+		mlen = MIN_MATCH;
+		while (((ip + mlen) < match_limit) &&
+		       (src[ref + mlen] == src[ip + mlen])) {
+			mlen++;
+		}
+
+		lit = ip - anchor;
+		if ((op + 1 + lit + (lit / 255) + 4) >= cap) {
+			return 0;
+		}
+
+		token = &dst[op++];
+		if (lit >= 15) {
+			*token = 0xf0;
+			op = put_length(dst, op, cap, lit - 15);
+		} else {
+			*token = lit << 4;
+		}
+		memcpy(&dst[op], &src[anchor], lit);
+		op += lit;
+
+		sys_put_le16(ip - ref, &dst[op]);
+		op += 2;
+
+		if ((mlen - MIN_MATCH) >= 15) {
+			*token |= 0x0f;
+			op = put_length(dst, op, cap, mlen - MIN_MATCH - 15);
+		} else {
+			*token |= mlen - MIN_MATCH;
+		}
+
+		if (op >= cap) {
+			return 0;
+		}
+
+		ip += mlen;
+		anchor = ip;
+	}
+
+	lit = len - anchor;
+	if ((op + 1 + lit + (lit / 255)) >= cap) {
+		return 0;
+	}
+
+	token = &dst[op++];
+	if (lit >= 15) {
+		*token = 0xf0;
+		op = put_length(dst, op, cap, lit - 15);
+	} else {
+		*token = lit << 4;
+	}
+	memcpy(&dst[op], &src[anchor], lit);
+	op += lit;
+
+	return (op < cap) ? op : 0;
+}
+
+static int emit_block(void)
+{
+	uint8_t frame_hdr[4];
+	uint8_t *data = out_buf;
+	size_t size;
+	int err;
+
+	if (in_len == 0) {
+		return 0;
+	}
+
+	size = compress_block(in_buf, in_len, out_buf, in_len);
+	if (size == 0) {
+		/* Not smaller than the input, store the block raw */
+		data = in_buf;
+		size = in_len;
+	}
+
+	sys_put_le16(size, &frame_hdr[0]);
+	sys_put_le16(in_len, &frame_hdr[2]);
+
+	err = z_coredump_raw_output(frame_hdr, sizeof(frame_hdr));
+	if (err == 0) {
+		err = z_coredump_raw_output(data, size);
+	}
+
+	in_len = 0;
+
+	return err;
+}
+
+void z_coredump_compress_reset(void)
+{
+	in_len = 0;
+}
+
+int z_coredump_compress(uint8_t *buf, size_t buflen)
+{
+	int err;
+
+	while (buflen > 0) {
+		size_t copy = MIN(buflen, BLOCK_SIZE - in_len);
+
+		memcpy(&in_buf[in_len], buf, copy);
+		in_len += copy;
+		buf += copy;
+		buflen -= copy;
+
+		if (in_len == BLOCK_SIZE) {
+			err = emit_block();
+			if (err != 0) {
+				return err;
+			}
+		}
+	}
+
+	return 0;
+}
+
+int z_coredump_compress_flush(void)
+{
+	return emit_block();
+}
@@ -17,6 +17,10 @@
 extern struct z_coredump_backend_api z_coredump_backend_logging;
 static struct z_coredump_backend_api
 	*backend_api = &z_coredump_backend_logging;
+#elif defined(CONFIG_DEBUG_COREDUMP_BACKEND_FLASH_PARTITION)
+extern struct z_coredump_backend_api z_coredump_backend_flash_partition;
+static struct z_coredump_backend_api
+	*backend_api = &z_coredump_backend_flash_partition;
 #elif defined(DEBUG_COREDUMP_BACKEND_NULL)
 extern struct z_coredump_backend_api z_coredump_backend_null;
 static struct z_coredump_backend_api
@@ -45,6 +49,13 @@ static int dump_header(unsigned int reason)
 
 	hdr.tgt_code = sys_cpu_to_le16(arch_coredump_tgt_code_get());
 
+	if (IS_ENABLED(CONFIG_DEBUG_COREDUMP_COMPRESSION)) {
+		hdr.flag = Z_COREDUMP_HDR_FLAG_COMPRESSED;
+	}
+
+	/* The header itself is never compressed so parsers can
+	 * always read it.
+	 */
 	return backend_api->buffer_output((uint8_t *)&hdr, sizeof(hdr));
 }
 
@@ -122,10 +133,20 @@ void z_coredump(unsigned int reason, const z_arch_esf_t *esf,
 void z_coredump_start(void)
 {
 	backend_api->start();
+
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+	z_coredump_compress_reset();
+#endif
 }
 
 void z_coredump_end(void)
 {
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+	if (error == 0) {
+		error = z_coredump_compress_flush();
+	}
+#endif
+
 	backend_api->end();
 }
 
@@ -146,13 +167,22 @@ int z_coredump_buffer_output(uint8_t *buf, size_t buflen)
 	if ((buf == NULL) || (buflen == 0)) {
 		ret = -EINVAL;
 	} else {
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+		error = z_coredump_compress(buf, buflen);
+#else
 		error = backend_api->buffer_output(buf, buflen);
+#endif
 		ret = error;
 	}
 
 	return ret;
 }
 
+int z_coredump_raw_output(uint8_t *buf, size_t buflen)
+{
+	return backend_api->buffer_output(buf, buflen);
+}
+
 void z_coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 {
 	struct z_coredump_mem_hdr_t m;
@@ -48,6 +48,36 @@ void z_coredump_end(void);
  */
 void z_coredump_error(void);
 
+/**
+ * @brief Output to the backend, bypassing the compression stage.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int z_coredump_raw_output(uint8_t *buf, size_t buflen);
+
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESSION
+/**
+ * @brief Reset the compressor state for a new coredump session.
+ */
+void z_coredump_compress_reset(void);
+
+/**
+ * @brief Feed data into the streaming compressor.
+ *
+ * Full blocks are compressed and forwarded to the backend.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int z_coredump_compress(uint8_t *buf, size_t buflen);
+
+/**
+ * @brief Compress and forward any buffered data.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int z_coredump_compress_flush(void);
+#endif /* CONFIG_DEBUG_COREDUMP_COMPRESSION */
+
 typedef void (*z_coredump_backend_start_t)(void);
 typedef void (*z_coredump_backend_end_t)(void);
 typedef void (*z_coredump_backend_error_t)(void);
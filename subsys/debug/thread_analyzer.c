@@ -35,16 +35,34 @@ LOG_MODULE_REGISTER(thread_analyzer, CONFIG_THREAD_ANALYZER_LOG_LEVEL);
  */
 #define PTR_STR_MAXLEN (sizeof(void *) * 2 + 2)
 
+/* Totals accumulated over one analyzer pass, for the stack sizing
+ * summary printed after the per-thread lines.
+ */
+static size_t stack_size_total;
+static size_t stack_used_total;
+
 static void thread_print_cb(struct thread_analyzer_info *info)
 {
 	unsigned int pcnt = (info->stack_used * 100U) / info->stack_size;
 
+	stack_size_total += info->stack_size;
+	stack_used_total += info->stack_used;
+
 	THREAD_ANALYZER_PRINT(
 		THREAD_ANALYZER_FMT(
 			" %-20s: unused %zu usage %zu / %zu (%zu %%)"),
 		THREAD_ANALYZER_VSTR(info->name),
 		info->stack_size - info->stack_used, info->stack_used,
 		info->stack_size, pcnt);
+
+#ifdef CONFIG_TRACING_THREAD_PROFILER
+	THREAD_ANALYZER_PRINT(
+		THREAD_ANALYZER_FMT(
+			" %-20s: cpu %llu us switches %u max latency %u us"),
+		THREAD_ANALYZER_VSTR(info->name),
+		k_cyc_to_us_floor64(info->cycles), info->switches,
+		k_cyc_to_us_floor32(info->max_latency));
+#endif
 }
 
 static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
@@ -77,6 +95,11 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 	info.name = name;
 	info.stack_size = size;
 	info.stack_used = size - unused;
+#ifdef CONFIG_TRACING_THREAD_PROFILER
+	info.cycles = thread->profiler.cycles;
+	info.switches = thread->profiler.switches;
+	info.max_latency = thread->profiler.max_latency;
+#endif
 	cb(&info);
 }
 
@@ -91,8 +114,22 @@ void thread_analyzer_run(thread_analyzer_cb cb)
 
 void thread_analyzer_print(void)
 {
+	stack_size_total = 0;
+	stack_used_total = 0;
+
 	THREAD_ANALYZER_PRINT(THREAD_ANALYZER_FMT("Thread analyze:"));
 	thread_analyzer_run(thread_print_cb);
+
+	/* The high-water marks only grow, so the reclaimable figure is an
+	 * upper bound on how much the CONFIG_*_STACK_SIZE options could be
+	 * trimmed given the load observed so far.
+	 */
+	THREAD_ANALYZER_PRINT(
+		THREAD_ANALYZER_FMT(
+			" Stacks: %zu bytes configured, %zu peak used,"
+			" %zu reclaimable"),
+		stack_size_total, stack_used_total,
+		stack_size_total - stack_used_total);
 }
 
 #if IS_ENABLED(CONFIG_THREAD_ANALYZER_AUTO)
@@ -17,6 +17,10 @@
 #include <dfu/mcuboot.h>
 #endif
 
+#ifdef CONFIG_IMG_STREAM_HASH
+#include <tinycrypt/constants.h>
+#endif
+
 #include <devicetree.h>
 /* FLASH_AREA_ID() values used below are auto-generated by DT */
 #ifdef CONFIG_TRUSTED_EXECUTION_NONSECURE
@@ -37,11 +41,28 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 {
 	int rc;
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	/* Hash the data while it streams through; a failed or restarted
+	 * upload re-initializes the state in flash_img_init_id().
+	 */
+	if (tc_sha256_update(&ctx->sha, data, len) != TC_CRYPTO_SUCCESS) {
+		return -EINVAL;
+	}
+	ctx->hash_bytes += len;
+#endif
+
 	rc = stream_flash_buffered_write(&ctx->stream, data, len, flush);
 	if (!flush) {
 		return rc;
 	}
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (rc == 0 &&
+	    tc_sha256_final(ctx->hash, &ctx->sha) == TC_CRYPTO_SUCCESS) {
+		ctx->hash_valid = true;
+	}
+#endif
+
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
 	rc = stream_flash_erase_page(&ctx->stream,
 				ctx->flash_area->fa_off +
@@ -75,9 +96,21 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 
 	flash_dev = flash_area_get_device(ctx->flash_area);
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
+
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (rc == 0) {
+		if (tc_sha256_init(&ctx->sha) != TC_CRYPTO_SUCCESS) {
+			return -EINVAL;
+		}
+		ctx->hash_bytes = 0;
+		ctx->hash_valid = false;
+	}
+#endif
+
+	return rc;
 }
 
 int flash_img_init(struct flash_img_context *ctx)
@@ -86,6 +119,65 @@ int flash_img_init(struct flash_img_context *ctx)
 }
 
 #if defined(CONFIG_IMG_ENABLE_IMAGE_CHECK)
+
+#ifdef CONFIG_IMG_STREAM_HASH
+void flash_img_progress_cb_set(struct flash_img_context *ctx,
+			       flash_img_progress_cb_t cb)
+{
+	ctx->progress_cb = cb;
+}
+
+/* Full read-back pass, used when no streamed hash of the image is
+ * cached.  Mirrors flash_area_check_int_sha256() but reports progress
+ * after each block.
+ */
+static int flash_img_check_slow(struct flash_img_context *ctx,
+				const struct flash_img_check *fic)
+{
+	uint8_t hash[TC_SHA256_DIGEST_SIZE];
+	struct tc_sha256_state_struct sha;
+	size_t to_read;
+	size_t pos;
+	int rc;
+
+	if (tc_sha256_init(&sha) != TC_CRYPTO_SUCCESS) {
+		return -ESRCH;
+	}
+
+	to_read = sizeof(ctx->buf);
+
+	for (pos = 0; pos < fic->clen; pos += to_read) {
+		if (pos + to_read > fic->clen) {
+			to_read = fic->clen - pos;
+		}
+
+		rc = flash_area_read(ctx->flash_area, pos, ctx->buf, to_read);
+		if (rc != 0) {
+			return rc;
+		}
+
+		if (tc_sha256_update(&sha, ctx->buf,
+				     to_read) != TC_CRYPTO_SUCCESS) {
+			return -ESRCH;
+		}
+
+		if (ctx->progress_cb) {
+			ctx->progress_cb(pos + to_read, fic->clen);
+		}
+	}
+
+	if (tc_sha256_final(hash, &sha) != TC_CRYPTO_SUCCESS) {
+		return -ESRCH;
+	}
+
+	if (memcmp(hash, fic->match, TC_SHA256_DIGEST_SIZE)) {
+		return -EILSEQ;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_IMG_STREAM_HASH */
+
 int flash_img_check(struct flash_img_context *ctx,
 		    const struct flash_img_check *fic,
 		    uint8_t area_id)
@@ -97,19 +189,44 @@ int flash_img_check(struct flash_img_context *ctx,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	/* Confirmation right after an upload is served from the hash
+	 * computed while the image streamed through, without reading
+	 * the slot back from flash.
+	 */
+	if (ctx->hash_valid && fic->clen == ctx->hash_bytes) {
+		if (memcmp(fic->match, ctx->hash, TC_SHA256_DIGEST_SIZE)) {
+			return -EILSEQ;
+		}
+
+		if (ctx->progress_cb) {
+			ctx->progress_cb(fic->clen, fic->clen);
+		}
+
+		return 0;
+	}
+#endif
+
 	rc = flash_area_open(area_id,
 			     (const struct flash_area **)&(ctx->flash_area));
 	if (rc) {
 		return rc;
 	}
 
-	fac.match = fic->match;
-	fac.clen = fic->clen;
-	fac.off = 0;
-	fac.rbuf = ctx->buf;
-	fac.rblen = sizeof(ctx->buf);
-
-	rc = flash_area_check_int_sha256(ctx->flash_area, &fac);
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (ctx->progress_cb) {
+		rc = flash_img_check_slow(ctx, fic);
+	} else
+#endif
+	{
+		fac.match = fic->match;
+		fac.clen = fic->clen;
+		fac.off = 0;
+		fac.rbuf = ctx->buf;
+		fac.rblen = sizeof(ctx->buf);
+
+		rc = flash_area_check_int_sha256(ctx->flash_area, &fac);
+	}
 
 	flash_area_close(ctx->flash_area);
 	ctx->flash_area = NULL;
@@ -23,6 +23,233 @@ static sys_dlist_t disk_access_list;
 /* lock to protect storage layer registration */
 static struct k_mutex mutex;
 
+#ifdef CONFIG_DISK_ACCESS_CACHE
+
+#define DISK_CACHE_LINE_SECTORS	CONFIG_DISK_ACCESS_CACHE_LINE_SECTORS
+#define DISK_CACHE_SECTOR_SIZE	CONFIG_DISK_ACCESS_CACHE_SECTOR_SIZE
+
+/* Write-back cache of sector runs, shared by all registered disks.
+ * Lines are filled with whole multi-sector reads (read-ahead) and
+ * dirty sectors are written out as one multi-sector transfer when a
+ * line is evicted or the disk is synced.  Requests of a full line or
+ * more bypass the cache, they are already big enough for the medium.
+ */
+struct disk_cache_line {
+	struct disk_info *disk;		/* NULL when the line is free */
+	uint32_t sector;		/* first sector, line aligned */
+	uint32_t last_use;
+	uint16_t dirty_first;		/* dirty_first > dirty_last: clean */
+	uint16_t dirty_last;
+	uint8_t buf[DISK_CACHE_LINE_SECTORS * DISK_CACHE_SECTOR_SIZE];
+};
+
+static struct disk_cache_line disk_cache[CONFIG_DISK_ACCESS_CACHE_LINE_COUNT];
+static uint32_t disk_cache_tick;
+static struct k_mutex disk_cache_mutex;
+
+static void disk_cache_line_reset(struct disk_cache_line *cl)
+{
+	cl->disk = NULL;
+	cl->last_use = 0U;
+	cl->dirty_first = DISK_CACHE_LINE_SECTORS;
+	cl->dirty_last = 0U;
+}
+
+/* The cache only understands disks with the configured sector size
+ * that can report their geometry.
+ */
+static bool disk_cache_usable(struct disk_info *disk, uint32_t *sec_cnt)
+{
+	uint32_t sec_size;
+
+	if ((disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE,
+			      &sec_size) != 0) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT,
+			      sec_cnt) != 0)) {
+		return false;
+	}
+
+	return sec_size == DISK_CACHE_SECTOR_SIZE;
+}
+
+static int disk_cache_flush_line(struct disk_cache_line *cl)
+{
+	int rc = 0;
+
+	if ((cl->disk != NULL) && (cl->dirty_first <= cl->dirty_last)) {
+		rc = cl->disk->ops->write(cl->disk,
+			&cl->buf[cl->dirty_first * DISK_CACHE_SECTOR_SIZE],
+			cl->sector + cl->dirty_first,
+			(cl->dirty_last - cl->dirty_first) + 1U);
+	}
+	cl->dirty_first = DISK_CACHE_LINE_SECTORS;
+	cl->dirty_last = 0U;
+	return rc;
+}
+
+static int disk_cache_flush_range(struct disk_info *disk, uint32_t start_sector,
+				  uint32_t num_sector, bool discard)
+{
+	int rc = 0;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(disk_cache); i++) {
+		struct disk_cache_line *cl = &disk_cache[i];
+
+		if ((cl->disk != disk) ||
+		    (cl->sector + DISK_CACHE_LINE_SECTORS <= start_sector) ||
+		    (cl->sector >= start_sector + num_sector)) {
+			continue;
+		}
+		rc = disk_cache_flush_line(cl);
+		if (rc != 0) {
+			return rc;
+		}
+		if (discard) {
+			disk_cache_line_reset(cl);
+		}
+	}
+	return rc;
+}
+
+static void disk_cache_drop_disk(struct disk_info *disk)
+{
+	int i;
+
+	k_mutex_lock(&disk_cache_mutex, K_FOREVER);
+	for (i = 0; i < ARRAY_SIZE(disk_cache); i++) {
+		if (disk_cache[i].disk == disk) {
+			disk_cache_line_reset(&disk_cache[i]);
+		}
+	}
+	k_mutex_unlock(&disk_cache_mutex);
+}
+
+/* Return the line holding the aligned run at base, filling a
+ * least-recently-used victim from the disk on a miss.
+ */
+static struct disk_cache_line *disk_cache_get(struct disk_info *disk,
+					      uint32_t base, int *err)
+{
+	struct disk_cache_line *cl = NULL;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(disk_cache); i++) {
+		if ((disk_cache[i].disk == disk)
+		    && (disk_cache[i].sector == base)) {
+			cl = &disk_cache[i];
+			goto done;
+		}
+	}
+
+	cl = &disk_cache[0];
+	for (i = 1; i < ARRAY_SIZE(disk_cache); i++) {
+		if (disk_cache[i].last_use < cl->last_use) {
+			cl = &disk_cache[i];
+		}
+	}
+
+	*err = disk_cache_flush_line(cl);
+	if (*err == 0) {
+		*err = disk->ops->read(disk, cl->buf, base,
+				       DISK_CACHE_LINE_SECTORS);
+	}
+	if (*err != 0) {
+		disk_cache_line_reset(cl);
+		return NULL;
+	}
+	cl->disk = disk;
+	cl->sector = base;
+done:
+	cl->last_use = ++disk_cache_tick;
+	return cl;
+}
+
+static int disk_cache_io(struct disk_info *disk, uint8_t *data_buf,
+			 uint32_t start_sector, uint32_t num_sector,
+			 bool write)
+{
+	uint32_t sec_cnt;
+	int rc = 0;
+
+	if ((num_sector == 0U) || !disk_cache_usable(disk, &sec_cnt)) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&disk_cache_mutex, K_FOREVER);
+
+	if ((num_sector >= DISK_CACHE_LINE_SECTORS) ||
+	    (start_sector + num_sector > sec_cnt)) {
+		/* Big enough for the medium already, or beyond the
+		 * disk; flush overlapping lines and pass through.
+		 */
+		rc = disk_cache_flush_range(disk, start_sector, num_sector,
+					    write);
+		if (rc == 0) {
+			if (write) {
+				rc = disk->ops->write(disk, data_buf,
+						      start_sector, num_sector);
+			} else {
+				rc = disk->ops->read(disk, data_buf,
+						     start_sector, num_sector);
+			}
+		}
+		goto out;
+	}
+
+	while (num_sector > 0U) {
+		uint32_t base = ROUND_DOWN(start_sector,
+					   DISK_CACHE_LINE_SECTORS);
+		uint32_t idx = start_sector - base;
+		uint32_t cnt = MIN(num_sector, DISK_CACHE_LINE_SECTORS - idx);
+		struct disk_cache_line *cl;
+
+		cl = disk_cache_get(disk, base, &rc);
+		if (cl == NULL) {
+			goto out;
+		}
+		if (write) {
+			memcpy(&cl->buf[idx * DISK_CACHE_SECTOR_SIZE],
+			       data_buf, cnt * DISK_CACHE_SECTOR_SIZE);
+			cl->dirty_first = MIN(cl->dirty_first, (uint16_t)idx);
+			cl->dirty_last = MAX(cl->dirty_last,
+					     (uint16_t)(idx + cnt - 1U));
+		} else {
+			memcpy(data_buf,
+			       &cl->buf[idx * DISK_CACHE_SECTOR_SIZE],
+			       cnt * DISK_CACHE_SECTOR_SIZE);
+		}
+		data_buf += cnt * DISK_CACHE_SECTOR_SIZE;
+		start_sector += cnt;
+		num_sector -= cnt;
+	}
+out:
+	k_mutex_unlock(&disk_cache_mutex);
+	return rc;
+}
+
+static int disk_cache_sync(struct disk_info *disk)
+{
+	int rc = 0;
+	int i;
+
+	k_mutex_lock(&disk_cache_mutex, K_FOREVER);
+	for (i = 0; i < ARRAY_SIZE(disk_cache); i++) {
+		if (disk_cache[i].disk == disk) {
+			int rc2 = disk_cache_flush_line(&disk_cache[i]);
+
+			if (rc == 0) {
+				rc = rc2;
+			}
+		}
+	}
+	k_mutex_unlock(&disk_cache_mutex);
+	return rc;
+}
+
+#endif /* CONFIG_DISK_ACCESS_CACHE */
+
 struct disk_info *disk_access_get_di(const char *name)
 {
 	struct disk_info *disk = NULL, *itr;
@@ -60,6 +287,10 @@ int disk_access_init(const char *pdrv)
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->init != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		/* The medium may have been replaced. */
+		disk_cache_drop_disk(disk);
+#endif
 		rc = disk->ops->init(disk);
 	}
 
@@ -87,6 +318,13 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		rc = disk_cache_io(disk, data_buf, start_sector, num_sector,
+				   false);
+		if (rc != -ENOTSUP) {
+			return rc;
+		}
+#endif
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
 	}
 
@@ -101,6 +339,13 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		rc = disk_cache_io(disk, (uint8_t *)data_buf, start_sector,
+				   num_sector, true);
+		if (rc != -ENOTSUP) {
+			return rc;
+		}
+#endif
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
 	}
 
@@ -114,6 +359,14 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->ioctl != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_CACHE
+		if (cmd == DISK_IOCTL_CTRL_SYNC) {
+			rc = disk_cache_sync(disk);
+			if (rc != 0) {
+				return rc;
+			}
+		}
+#endif
 		rc = disk->ops->ioctl(disk, cmd, buf);
 	}
 
@@ -163,6 +416,9 @@ int disk_access_unregister(struct disk_info *disk)
 	}
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
+#ifdef CONFIG_DISK_ACCESS_CACHE
+	disk_cache_drop_disk(disk);
+#endif
 	LOG_DBG("disk interface(%s) unregistred", disk->name);
 unreg_err:
 	k_mutex_unlock(&mutex);
@@ -175,6 +431,12 @@ static int disk_init(const struct device *dev)
 
 	k_mutex_init(&mutex);
 	sys_dlist_init(&disk_access_list);
+#ifdef CONFIG_DISK_ACCESS_CACHE
+	k_mutex_init(&disk_cache_mutex);
+	for (int i = 0; i < ARRAY_SIZE(disk_cache); i++) {
+		disk_cache_line_reset(&disk_cache[i]);
+	}
+#endif
 	return 0;
 }
 
@@ -164,6 +164,19 @@ fcb_init(int f_area_id, struct fcb *fcb)
 			break;
 		}
 	}
+
+	if (!rc && fcb->f_entry_cnts) {
+		/* fill the RAM entry counters with a one time scan */
+		struct fcb_entry loc;
+
+		(void)memset(fcb->f_entry_cnts, 0,
+			     sizeof(fcb->f_entry_cnts[0]) * fcb->f_sector_cnt);
+		(void)memset(&loc, 0, sizeof(loc));
+		while (fcb_getnext_nolock(fcb, &loc) == 0) {
+			fcb_entry_cnt_add(fcb, loc.fe_sector);
+		}
+	}
+
 	k_mutex_init(&fcb->f_mtx);
 	return rc;
 }
@@ -297,6 +310,52 @@ fcb_offset_last_n(struct fcb *fcb, uint8_t entries,
 		entries = 1U;
 	}
 
+	if (fcb->f_entry_cnts) {
+		/* With the RAM entry counters the index of the wanted entry
+		 * is known upfront; skip whole sectors and walk only the
+		 * part of the sector holding it.
+		 */
+		struct flash_sector *sector;
+		uint32_t total = 0U;
+		uint32_t skip;
+		uint16_t cnt;
+
+		sector = fcb->f_oldest;
+		while (1) {
+			total += fcb->f_entry_cnts[sector - fcb->f_sectors];
+			if (sector == fcb->f_active.fe_sector) {
+				break;
+			}
+			sector = fcb_getnext_sector(fcb, sector);
+		}
+
+		if (total == 0U) {
+			return -ENOENT;
+		}
+
+		skip = (total > entries) ? (total - entries) : 0U;
+
+		sector = fcb->f_oldest;
+		while (sector != fcb->f_active.fe_sector) {
+			cnt = fcb->f_entry_cnts[sector - fcb->f_sectors];
+			if (skip < cnt) {
+				break;
+			}
+			skip -= cnt;
+			sector = fcb_getnext_sector(fcb, sector);
+		}
+
+		(void)memset(&loc, 0, sizeof(loc));
+		loc.fe_sector = sector;
+		for (i = 0; i <= skip; i++) {
+			if (fcb_getnext(fcb, &loc)) {
+				return -ENOENT;
+			}
+		}
+		*last_n_entry = loc;
+		return 0;
+	}
+
 	i = 0;
 	(void)memset(&loc, 0, sizeof(loc));
 	while (!fcb_getnext(fcb, &loc)) {
@@ -133,5 +133,6 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	if (rc) {
 		return -EIO;
 	}
+	fcb_entry_cnt_add(fcb, loc->fe_sector);
 	return 0;
 }
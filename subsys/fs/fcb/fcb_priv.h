@@ -35,6 +35,24 @@ static inline int fcb_len_in_flash(struct fcb *fcb, uint16_t len)
 	return (len + (fcb->f_align - 1U)) & ~(fcb->f_align - 1U);
 }
 
+/* RAM entry counter of a sector, unmaintained when f_entry_cnts is NULL */
+static inline void fcb_entry_cnt_set(struct fcb *fcb,
+				     const struct flash_sector *sector,
+				     uint16_t cnt)
+{
+	if (fcb->f_entry_cnts) {
+		fcb->f_entry_cnts[sector - fcb->f_sectors] = cnt;
+	}
+}
+
+static inline void fcb_entry_cnt_add(struct fcb *fcb,
+				     const struct flash_sector *sector)
+{
+	if (fcb->f_entry_cnts) {
+		fcb->f_entry_cnts[sector - fcb->f_sectors]++;
+	}
+}
+
 const struct flash_area *fcb_open_flash(const struct fcb *fcb);
 uint8_t fcb_get_align(const struct fcb *fcb);
 int fcb_erase_sector(const struct fcb *fcb, const struct flash_sector *sector);
@@ -78,6 +78,126 @@ static const struct fs_file_system_t *fs_type_get(int type)
 	return (ep != NULL) ? ep->fstp : NULL;
 }
 
+#ifdef CONFIG_FILE_SYSTEM_PATH_CACHE
+
+/* LRU cache of resolved paths.  An entry remembers the mount point a
+ * path resolved to and, when fs_stat() filled it, the directory entry
+ * as well.  Entries are validated against a global generation counter
+ * that every mutating operation bumps, so the hot read-only path never
+ * sees stale data.
+ */
+struct fs_path_cache_entry {
+	char path[CONFIG_FILE_SYSTEM_PATH_CACHE_PATH_LEN];
+	struct fs_mount_t *mp;		/* NULL when the entry is free */
+	struct fs_dirent dirent;
+	bool has_dirent;
+	uint32_t gen;
+	uint32_t last_use;
+};
+
+static struct fs_path_cache_entry
+	fs_path_cache[CONFIG_FILE_SYSTEM_PATH_CACHE_ENTRIES];
+static uint32_t fs_path_cache_gen;
+static uint32_t fs_path_cache_tick;
+static struct k_mutex fs_path_cache_mutex;
+
+/* Invalidate all cached paths; called whenever the tree may change */
+static void fs_path_cache_bump(void)
+{
+	k_mutex_lock(&fs_path_cache_mutex, K_FOREVER);
+	fs_path_cache_gen++;
+	k_mutex_unlock(&fs_path_cache_mutex);
+}
+
+/* Needs fs_path_cache_mutex held */
+static struct fs_path_cache_entry *fs_path_cache_find(const char *path)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(fs_path_cache); i++) {
+		struct fs_path_cache_entry *ce = &fs_path_cache[i];
+
+		if ((ce->mp != NULL) && (ce->gen == fs_path_cache_gen) &&
+		    (strcmp(ce->path, path) == 0)) {
+			ce->last_use = ++fs_path_cache_tick;
+			return ce;
+		}
+	}
+	return NULL;
+}
+
+/* Return the cached mount point for path, NULL on a miss */
+static struct fs_mount_t *fs_path_cache_get_mp(const char *path)
+{
+	struct fs_path_cache_entry *ce;
+	struct fs_mount_t *mp = NULL;
+
+	k_mutex_lock(&fs_path_cache_mutex, K_FOREVER);
+	ce = fs_path_cache_find(path);
+	if (ce != NULL) {
+		mp = ce->mp;
+	}
+	k_mutex_unlock(&fs_path_cache_mutex);
+	return mp;
+}
+
+static void fs_path_cache_add(const char *path, struct fs_mount_t *mp,
+			      const struct fs_dirent *dirent)
+{
+	struct fs_path_cache_entry *ce;
+
+	if (strlen(path) >= sizeof(ce->path)) {
+		return;
+	}
+
+	k_mutex_lock(&fs_path_cache_mutex, K_FOREVER);
+	ce = fs_path_cache_find(path);
+	if (ce == NULL) {
+		int i;
+
+		ce = &fs_path_cache[0];
+		for (i = 1; i < ARRAY_SIZE(fs_path_cache); i++) {
+			if (fs_path_cache[i].last_use < ce->last_use) {
+				ce = &fs_path_cache[i];
+			}
+		}
+		strcpy(ce->path, path);
+		ce->has_dirent = false;
+		ce->last_use = ++fs_path_cache_tick;
+	}
+	ce->mp = mp;
+	ce->gen = fs_path_cache_gen;
+	if (dirent != NULL) {
+		ce->dirent = *dirent;
+		ce->has_dirent = true;
+	}
+	k_mutex_unlock(&fs_path_cache_mutex);
+}
+
+/* Serve fs_stat() from the cache, -ENOENT on a miss */
+static int fs_path_cache_get_dirent(const char *path, struct fs_dirent *entry)
+{
+	struct fs_path_cache_entry *ce;
+	int rc = -ENOENT;
+
+	k_mutex_lock(&fs_path_cache_mutex, K_FOREVER);
+	ce = fs_path_cache_find(path);
+	if ((ce != NULL) && ce->has_dirent) {
+		*entry = ce->dirent;
+		rc = 0;
+	}
+	k_mutex_unlock(&fs_path_cache_mutex);
+	return rc;
+}
+
+#else
+
+static inline void fs_path_cache_bump(void)
+{
+}
+
+#endif /* CONFIG_FILE_SYSTEM_PATH_CACHE */
+
 static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 			    const char *name, size_t *match_len)
 {
@@ -142,11 +262,27 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_PATH_CACHE
+	if ((flags & (FS_O_WRITE | FS_O_CREATE)) != 0) {
+		/* The file may change through this handle. */
+		fs_path_cache_bump();
+	}
+	mp = fs_path_cache_get_mp(file_name);
+	if (mp == NULL) {
+		rc = fs_get_mnt_point(&mp, file_name, NULL);
+		if (rc < 0) {
+			LOG_ERR("%s:mount point not found!!", __func__);
+			return rc;
+		}
+		fs_path_cache_add(file_name, mp, NULL);
+	}
+#else
 	rc = fs_get_mnt_point(&mp, file_name, NULL);
 	if (rc < 0) {
 		LOG_ERR("%s:mount point not found!!", __func__);
 		return rc;
 	}
+#endif
 
 	zfp->mp = mp;
 
@@ -209,6 +345,7 @@ ssize_t fs_write(struct fs_file_t *zfp, const void *ptr, size_t size)
 	}
 
 	if (zfp->mp->fs->write != NULL) {
+		fs_path_cache_bump();
 		rc = zfp->mp->fs->write(zfp, ptr, size);
 		if (rc < 0) {
 			LOG_ERR("file write error (%d)", rc);
@@ -263,6 +400,7 @@ int fs_truncate(struct fs_file_t *zfp, off_t length)
 	}
 
 	if (zfp->mp->fs->truncate != NULL) {
+		fs_path_cache_bump();
 		rc = zfp->mp->fs->truncate(zfp, length);
 		if (rc < 0) {
 			LOG_ERR("file truncate error (%d)", rc);
@@ -452,6 +590,7 @@ int fs_mkdir(const char *abs_path)
 	}
 
 	if (mp->fs->mkdir != NULL) {
+		fs_path_cache_bump();
 		rc = mp->fs->mkdir(mp, abs_path);
 		if (rc < 0) {
 			LOG_ERR("failed to create directory (%d)", rc);
@@ -479,6 +618,7 @@ int fs_unlink(const char *abs_path)
 	}
 
 	if (mp->fs->unlink != NULL) {
+		fs_path_cache_bump();
 		rc = mp->fs->unlink(mp, abs_path);
 		if (rc < 0) {
 			LOG_ERR("failed to unlink path (%d)", rc);
@@ -513,6 +653,7 @@ int fs_rename(const char *from, const char *to)
 	}
 
 	if (mp->fs->rename != NULL) {
+		fs_path_cache_bump();
 		rc = mp->fs->rename(mp, from, to);
 		if (rc < 0) {
 			LOG_ERR("failed to rename file or dir (%d)", rc);
@@ -533,6 +674,12 @@ int fs_stat(const char *abs_path, struct fs_dirent *entry)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_PATH_CACHE
+	if (fs_path_cache_get_dirent(abs_path, entry) == 0) {
+		return 0;
+	}
+#endif
+
 	rc = fs_get_mnt_point(&mp, abs_path, NULL);
 	if (rc < 0) {
 		LOG_ERR("%s:mount point not found!!", __func__);
@@ -544,6 +691,11 @@ int fs_stat(const char *abs_path, struct fs_dirent *entry)
 		if (rc < 0) {
 			LOG_ERR("failed get file or dir stat (%d)", rc);
 		}
+#ifdef CONFIG_FILE_SYSTEM_PATH_CACHE
+		else {
+			fs_path_cache_add(abs_path, mp, entry);
+		}
+#endif
 	}
 	return rc;
 }
@@ -676,6 +828,7 @@ int fs_unmount(struct fs_mount_t *mp)
 
 	/* remove mount node from the list */
 	sys_dlist_remove(&mp->node);
+	fs_path_cache_bump();
 	LOG_DBG("fs unmounted from %s", log_strdup(mp->mnt_point));
 
 unmount_err:
@@ -759,6 +912,9 @@ int fs_unregister(int type, const struct fs_file_system_t *fs)
 static int fs_init(const struct device *dev)
 {
 	k_mutex_init(&mutex);
+#ifdef CONFIG_FILE_SYSTEM_PATH_CACHE
+	k_mutex_init(&fs_path_cache_mutex);
+#endif
 	sys_dlist_init(&fs_mnt_list);
 	return 0;
 }
@@ -132,14 +132,148 @@ static int errno_to_lfs(int error)
 	}
 }
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+
+/* Write-through LRU cache of whole erase blocks, shared by all mounts.
+ * Metadata traversals read the same few blocks repeatedly; serving
+ * those from RAM avoids most of the flash driver round trips.  Mounts
+ * whose erase block exceeds the configured buffer size bypass the
+ * cache entirely.
+ */
+struct block_cache_entry {
+	const struct flash_area *fa;	/* NULL when the entry is free */
+	lfs_block_t block;
+	uint32_t last_use;
+	uint8_t buf[CONFIG_FS_LITTLEFS_BLOCK_CACHE_BLOCK_SIZE];
+};
+
+static struct block_cache_entry block_cache[CONFIG_FS_LITTLEFS_BLOCK_CACHE_COUNT];
+static uint32_t block_cache_tick;
+static K_MUTEX_DEFINE(block_cache_mutex);
+
+static inline bool block_cache_usable(const struct lfs_config *c)
+{
+	return c->block_size <= sizeof(block_cache[0].buf);
+}
+
+static struct block_cache_entry *block_cache_find(const struct flash_area *fa,
+						  lfs_block_t block)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(block_cache); i++) {
+		if ((block_cache[i].fa == fa)
+		    && (block_cache[i].block == block)) {
+			return &block_cache[i];
+		}
+	}
+	return NULL;
+}
+
+static int block_cache_read(const struct lfs_config *c, lfs_block_t block,
+			    lfs_off_t off, void *buffer, lfs_size_t size)
+{
+	const struct flash_area *fa = c->context;
+	struct block_cache_entry *bce;
+	int rc = 0;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+
+	bce = block_cache_find(fa, block);
+	if (bce == NULL) {
+		int i;
+
+		/* Evict the least recently used entry and load the
+		 * whole block, the caller is about to walk it.
+		 */
+		bce = &block_cache[0];
+		for (i = 1; i < ARRAY_SIZE(block_cache); i++) {
+			if (block_cache[i].last_use < bce->last_use) {
+				bce = &block_cache[i];
+			}
+		}
+
+		rc = flash_area_read(fa, block * c->block_size, bce->buf,
+				     c->block_size);
+		if (rc < 0) {
+			bce->fa = NULL;
+			goto out;
+		}
+		bce->fa = fa;
+		bce->block = block;
+	}
+
+	bce->last_use = ++block_cache_tick;
+	memcpy(buffer, &bce->buf[off], size);
+out:
+	k_mutex_unlock(&block_cache_mutex);
+	return rc;
+}
+
+static void block_cache_update(const struct lfs_config *c, lfs_block_t block,
+			       lfs_off_t off, const void *buffer,
+			       lfs_size_t size)
+{
+	struct block_cache_entry *bce;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+
+	bce = block_cache_find(c->context, block);
+	if (bce != NULL) {
+		memcpy(&bce->buf[off], buffer, size);
+	}
+
+	k_mutex_unlock(&block_cache_mutex);
+}
+
+static void block_cache_invalidate(const struct flash_area *fa,
+				   lfs_block_t block)
+{
+	struct block_cache_entry *bce;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+
+	bce = block_cache_find(fa, block);
+	if (bce != NULL) {
+		bce->fa = NULL;
+		bce->last_use = 0U;
+	}
+
+	k_mutex_unlock(&block_cache_mutex);
+}
+
+static void block_cache_invalidate_area(const struct flash_area *fa)
+{
+	int i;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(block_cache); i++) {
+		if (block_cache[i].fa == fa) {
+			block_cache[i].fa = NULL;
+			block_cache[i].last_use = 0U;
+		}
+	}
+
+	k_mutex_unlock(&block_cache_mutex);
+}
+
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
 
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
+	int rc;
 
-	int rc = flash_area_read(fa, offset, buffer, size);
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	if (block_cache_usable(c)) {
+		return errno_to_lfs(block_cache_read(c, block, off,
+						     buffer, size));
+	}
+#endif
+	rc = flash_area_read(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
 }
@@ -152,6 +286,11 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 
 	int rc = flash_area_write(fa, offset, buffer, size);
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	if ((rc >= 0) && block_cache_usable(c)) {
+		block_cache_update(c, block, off, buffer, size);
+	}
+#endif
 	return errno_to_lfs(rc);
 }
 
@@ -162,6 +301,9 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 
 	int rc = flash_area_erase(fa, offset, c->block_size);
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	block_cache_invalidate(fa, block);
+#endif
 	return errno_to_lfs(rc);
 }
 
@@ -712,6 +854,9 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	fs_lock(fs);
 
 	lfs_unmount(&fs->lfs);
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	block_cache_invalidate_area(fs->area);
+#endif
 	flash_area_close(fs->area);
 	fs->area = NULL;
 
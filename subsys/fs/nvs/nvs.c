@@ -27,6 +27,59 @@ static inline size_t nvs_al_size(struct nvs_fs *fs, size_t len)
 	}
 	return (len + (write_block_size - 1U)) & ~(write_block_size - 1U);
 }
+
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+
+/* nvs_lookup_cache_pos scrambles the id so that consecutive ids spread
+ * over the cache entries
+ */
+static inline size_t nvs_lookup_cache_pos(uint16_t id)
+{
+	uint16_t hash = id;
+
+	hash ^= hash >> 8;
+	hash *= 0x88b5U;
+	hash ^= hash >> 7;
+	hash *= 0xdb2dU;
+	hash ^= hash >> 9;
+
+	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+}
+
+/* nvs_lookup_cache_start returns the address to start an allocation table
+ * walk for id at: the cached address of the most recently written entry
+ * among the ids sharing the cache entry, or the ate write address when
+ * nothing is cached (the walk then covers the whole allocation table).
+ */
+static inline uint32_t nvs_lookup_cache_start(struct nvs_fs *fs, uint16_t id)
+{
+	uint32_t addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+
+	if (addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		return fs->ate_wra;
+	}
+
+	return addr;
+}
+
+/* nvs_lookup_cache_invalidate removes all cache entries that point into
+ * the given sector, called before the sector is erased by gc
+ */
+static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
+{
+	uint32_t *cache_entry = fs->lookup_cache;
+	uint32_t *const cache_end =
+		&fs->lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+
+	for (; cache_entry < cache_end; ++cache_entry) {
+		if ((*cache_entry >> ADDR_SECT_SHIFT) == sector) {
+			*cache_entry = NVS_LOOKUP_CACHE_NO_ADDR;
+		}
+	}
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE */
+
 /* end basic routines */
 
 /* flash routines */
@@ -106,6 +159,13 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 
 	rc = nvs_flash_al_wrt(fs, fs->ate_wra, entry,
 			       sizeof(struct nvs_ate));
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	/* id 0xFFFF is used for sector close ates, not for data */
+	if (entry->id != 0xFFFF) {
+		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] =
+			fs->ate_wra;
+	}
+#endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
 
 	return rc;
@@ -428,6 +488,45 @@ static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate)
 	return nvs_recover_last_ate(fs, addr);
 }
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+/* rebuild the lookup cache by walking the complete allocation table,
+ * keeping the newest valid ate address for each id
+ */
+static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
+{
+	int rc;
+	uint32_t addr, ate_addr;
+	uint32_t *cache_entry;
+	struct nvs_ate ate;
+
+	(void)memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	addr = fs->ate_wra;
+
+	while (1) {
+		/* nvs_prev_ate modifies the address, keep a copy */
+		ate_addr = addr;
+		rc = nvs_prev_ate(fs, &addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
+
+		if ((ate.id != 0xFFFF) &&
+		    (*cache_entry == NVS_LOOKUP_CACHE_NO_ADDR) &&
+		    (!nvs_ate_crc8_check(&ate))) {
+			*cache_entry = ate_addr;
+		}
+
+		if (addr == fs->ate_wra) {
+			break;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NVS_LOOKUP_CACHE */
+
 static void nvs_sector_advance(struct nvs_fs *fs, uint32_t *addr)
 {
 	*addr += (1 << ADDR_SECT_SHIFT);
@@ -523,7 +622,11 @@ static int nvs_gc(struct nvs_fs *fs)
 			continue;
 		}
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+		wlk_addr = nvs_lookup_cache_start(fs, gc_ate.id);
+#else
 		wlk_addr = fs->ate_wra;
+#endif
 		do {
 			wlk_prev_addr = wlk_addr;
 			rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
@@ -566,6 +669,13 @@ static int nvs_gc(struct nvs_fs *fs)
 		}
 	} while (gc_prev_addr != stop_addr);
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	/* Entries moved by gc have already updated the cache, any cache
+	 * entry still pointing into the sector is about to be erased.
+	 */
+	nvs_lookup_cache_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
+#endif
+
 	rc = nvs_flash_erase_sector(fs, sec_addr);
 	if (rc) {
 		return rc;
@@ -573,6 +683,41 @@ static int nvs_gc(struct nvs_fs *fs)
 	return 0;
 }
 
+#if defined(CONFIG_NVS_BACKGROUND_GC)
+static K_THREAD_STACK_DEFINE(nvs_gc_stack, CONFIG_NVS_BACKGROUND_GC_STACK_SIZE);
+static struct k_work_q nvs_gc_workq;
+
+/* nvs_gc_needed returns true when the open sector has less free space
+ * left than the background gc threshold
+ */
+static bool nvs_gc_needed(struct nvs_fs *fs)
+{
+	return (fs->ate_wra - fs->data_wra) <
+	       CONFIG_NVS_BACKGROUND_GC_THRESHOLD;
+}
+
+static void nvs_gc_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	/* recheck with the lock held, a write may have run gc already */
+	if (nvs_gc_needed(fs)) {
+		rc = nvs_sector_close(fs);
+		if (!rc) {
+			rc = nvs_gc(fs);
+		}
+		if (rc) {
+			LOG_ERR("background gc failed (%d)", rc);
+		}
+	}
+
+	k_mutex_unlock(&fs->nvs_lock);
+}
+#endif /* CONFIG_NVS_BACKGROUND_GC */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -708,6 +853,10 @@ static int nvs_startup(struct nvs_fs *fs)
 		}
 	}
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	rc = nvs_lookup_cache_rebuild(fs);
+#endif
+
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
@@ -779,6 +928,24 @@ int nvs_init(struct nvs_fs *fs, const char *dev_name)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_NVS_BACKGROUND_GC)
+	{
+		static bool gc_workq_started;
+
+		k_work_init(&fs->gc_work, nvs_gc_work_handler);
+		if (!gc_workq_started) {
+			/* one low priority work queue shared by all
+			 * NVS instances
+			 */
+			k_work_q_start(&nvs_gc_workq, nvs_gc_stack,
+				       K_THREAD_STACK_SIZEOF(nvs_gc_stack),
+				       K_LOWEST_APPLICATION_THREAD_PRIO);
+			k_thread_name_set(&nvs_gc_workq.thread, "nvs_gc");
+			gc_workq_started = true;
+		}
+	}
+#endif
+
 	rc = nvs_startup(fs);
 	if (rc) {
 		return rc;
@@ -824,15 +991,24 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 		return -EINVAL;
 	}
 
+	/* Take the lock before walking the allocation table so that the
+	 * walk cannot race with garbage collection.
+	 */
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
 	/* find latest entry with same id */
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	wlk_addr = nvs_lookup_cache_start(fs, id);
+#else
 	wlk_addr = fs->ate_wra;
+#endif
 	rd_addr = wlk_addr;
 
 	while (1) {
 		rd_addr = wlk_addr;
 		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
 		if (rc) {
-			return rc;
+			goto end;
 		}
 		if ((wlk_ate.id == id) && (!nvs_ate_crc8_check(&wlk_ate))) {
 			prev_found = true;
@@ -854,20 +1030,22 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 				/* skip delete entry as it is already the
 				 * last one
 				 */
-				return 0;
+				rc = 0;
+				goto end;
 			}
 		} else if (len == wlk_ate.len) {
 			/* do not try to compare if lengths are not equal */
 			/* compare the data and if equal return 0 */
 			rc = nvs_flash_block_cmp(fs, rd_addr, data, len);
 			if (rc <= 0) {
-				return rc;
+				goto end;
 			}
 		}
 	} else {
 		/* skip delete entry for non-existing entry */
 		if (len == 0) {
-			return 0;
+			rc = 0;
+			goto end;
 		}
 	}
 
@@ -877,8 +1055,6 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 		required_space = data_size + ate_size;
 	}
 
-	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
-
 	gc_count = 0;
 	while (1) {
 		if (gc_count == fs->sector_count) {
@@ -911,6 +1087,13 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 		gc_count++;
 	}
 	rc = len;
+
+#if defined(CONFIG_NVS_BACKGROUND_GC)
+	/* reclaim the next sector before a write runs into the full one */
+	if (nvs_gc_needed(fs)) {
+		k_work_submit_to_queue(&nvs_gc_workq, &fs->gc_work);
+	}
+#endif
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
@@ -943,7 +1126,14 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 
 	cnt_his = 0U;
 
+	/* Take the lock so the walk cannot race with (background) gc */
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+#if defined(CONFIG_NVS_LOOKUP_CACHE)
+	wlk_addr = nvs_lookup_cache_start(fs, id);
+#else
 	wlk_addr = fs->ate_wra;
+#endif
 	rd_addr = wlk_addr;
 
 	while (cnt_his <= cnt) {
@@ -962,7 +1152,8 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 
 	if (((wlk_addr == fs->ate_wra) && (wlk_ate.id != id)) ||
 	    (wlk_ate.len == 0U) || (cnt_his < cnt)) {
-		return -ENOENT;
+		rc = -ENOENT;
+		goto err;
 	}
 
 	rd_addr &= ADDR_SECT_MASK;
@@ -972,9 +1163,11 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 		goto err;
 	}
 
+	k_mutex_unlock(&fs->nvs_lock);
 	return wlk_ate.len;
 
 err:
+	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
 }
 
@@ -1006,12 +1199,15 @@ ssize_t nvs_calc_free_space(struct nvs_fs *fs)
 		free_space += (fs->sector_size - ate_size);
 	}
 
+	/* Take the lock so the walk cannot race with (background) gc */
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
 	step_addr = fs->ate_wra;
 
 	while (1) {
 		rc = nvs_prev_ate(fs, &step_addr, &step_ate);
 		if (rc) {
-			return rc;
+			goto err;
 		}
 
 		wlk_addr = fs->ate_wra;
@@ -1019,7 +1215,7 @@ ssize_t nvs_calc_free_space(struct nvs_fs *fs)
 		while (1) {
 			rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
 			if (rc) {
-				return rc;
+				goto err;
 			}
 			if ((wlk_ate.id == step_ate.id) ||
 			    (wlk_addr == fs->ate_wra)) {
@@ -1039,5 +1235,10 @@ ssize_t nvs_calc_free_space(struct nvs_fs *fs)
 		}
 
 	}
+	k_mutex_unlock(&fs->nvs_lock);
 	return free_space;
+
+err:
+	k_mutex_unlock(&fs->nvs_lock);
+	return rc;
 }
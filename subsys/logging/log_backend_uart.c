@@ -15,10 +15,37 @@
 
 static const struct device *uart_dev;
 
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC
+static K_SEM_DEFINE(tx_done_sem, 0, 1);
+static bool use_async;
+static volatile bool in_panic;
+
+static void async_callback(const struct device *dev, struct uart_event *evt,
+			   void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	if ((evt->type == UART_TX_DONE) || (evt->type == UART_TX_ABORTED)) {
+		k_sem_give(&tx_done_sem);
+	}
+}
+#endif
+
 static int char_out(uint8_t *data, size_t length, void *ctx)
 {
 	ARG_UNUSED(ctx);
 
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC
+	if (use_async && !in_panic && !k_is_in_isr()) {
+		if (uart_tx(uart_dev, data, length, SYS_FOREVER_MS) == 0) {
+			k_sem_take(&tx_done_sem, K_FOREVER);
+			return length;
+		}
+		/* Transfer could not be started, poll the chunk out. */
+	}
+#endif
+
 	for (size_t i = 0; i < length; i++) {
 		uart_poll_out(uart_dev, data[i]);
 	}
@@ -26,9 +53,10 @@ static int char_out(uint8_t *data, size_t length, void *ctx)
 	return length;
 }
 
-static uint8_t uart_output_buf;
+static uint8_t uart_output_buf[CONFIG_LOG_BACKEND_UART_BUFFER_SIZE];
 
-LOG_OUTPUT_DEFINE(log_output_uart, char_out, &uart_output_buf, 1);
+LOG_OUTPUT_DEFINE(log_output_uart, char_out,
+		  uart_output_buf, sizeof(uart_output_buf));
 
 static void put(const struct log_backend *const backend,
 		struct log_msg *msg)
@@ -36,6 +64,10 @@ static void put(const struct log_backend *const backend,
 	uint32_t flag = IS_ENABLED(CONFIG_LOG_BACKEND_UART_SYST_ENABLE) ?
 		LOG_OUTPUT_FLAG_FORMAT_SYST : 0;
 
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_UART_DICTIONARY_ENABLE)) {
+		flag = LOG_OUTPUT_FLAG_FORMAT_DICTIONARY;
+	}
+
 	log_backend_std_put(&log_output_uart, flag, msg);
 }
 
@@ -43,10 +75,26 @@ static void log_backend_uart_init(void)
 {
 	uart_dev = device_get_binding(CONFIG_UART_CONSOLE_ON_DEV_NAME);
 	__ASSERT_NO_MSG((void *)uart_dev);
+
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC
+	const struct uart_driver_api *api = uart_dev->api;
+
+	/* The console driver may not implement the asynchronous API,
+	 * keep polling in that case.
+	 */
+	use_async = (api->callback_set != NULL) &&
+		    (uart_callback_set(uart_dev, async_callback, NULL) == 0);
+#endif
 }
 
 static void panic(struct log_backend const *const backend)
 {
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC
+	/* The interrupt driven transfer cannot complete anymore, poll
+	 * the remaining output out.
+	 */
+	in_panic = true;
+#endif
 	log_backend_std_panic(&log_output_uart);
 }
 
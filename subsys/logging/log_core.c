@@ -623,17 +623,13 @@ void z_vrfy_log_panic(void)
 #endif
 
 static bool msg_filter_check(struct log_backend const *backend,
-			     struct log_msg *msg)
+			     uint32_t msg_level, uint32_t filters)
 {
 	if (IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING)) {
 		uint32_t backend_level;
-		uint32_t msg_level;
 
-		backend_level = log_filter_get(backend,
-					       log_msg_domain_id_get(msg),
-					       log_msg_source_id_get(msg),
-					       true /*enum RUNTIME, COMPILETIME*/);
-		msg_level = log_msg_level_get(msg);
+		backend_level = LOG_FILTER_SLOT_GET(&filters,
+						    log_backend_id_get(backend));
 
 		return (msg_level <= backend_level);
 	} else {
@@ -644,6 +640,8 @@ static bool msg_filter_check(struct log_backend const *backend,
 static void msg_process(struct log_msg *msg, bool bypass)
 {
 	struct log_backend const *backend;
+	uint32_t msg_level = 0U;
+	uint32_t filters = 0U;
 
 	if (!bypass) {
 		if (IS_ENABLED(CONFIG_LOG_DETECT_MISSED_STRDUP) &&
@@ -651,11 +649,20 @@ static void msg_process(struct log_msg *msg, bool bypass)
 			detect_missed_strdup(msg);
 		}
 
+		if (IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING)) {
+			/* Fetch the filter word of the source once, each
+			 * backend has its slot in it.
+			 */
+			msg_level = log_msg_level_get(msg);
+			filters = *log_dynamic_filters_get(
+						log_msg_source_id_get(msg));
+		}
+
 		for (int i = 0; i < log_backend_count_get(); i++) {
 			backend = log_backend_get(i);
 
 			if (log_backend_is_active(backend) &&
-			    msg_filter_check(backend, msg)) {
+			    msg_filter_check(backend, msg_level, filters)) {
 				log_backend_put(backend, msg);
 			}
 		}
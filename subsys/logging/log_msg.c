@@ -40,15 +40,92 @@ BUILD_ASSERT((sizeof(union log_msg_head_data) ==
 #define MSG_SIZE sizeof(union log_msg_chunk)
 #define NUM_OF_MSGS (CONFIG_LOG_BUFFER_SIZE / MSG_SIZE)
 
-struct k_mem_slab log_msg_pool;
 static uint8_t __noinit __aligned(sizeof(void *))
 		log_msg_pool_buf[CONFIG_LOG_BUFFER_SIZE];
 
+#ifdef CONFIG_LOG_MSG_POOL_LOCK_FREE
+/* One bit per chunk; a set bit marks a chunk in use. A chunk is claimed
+ * with a single atomic test-and-set per probed bit, so allocation and
+ * release can run concurrently from any context, including interrupt
+ * handlers, without taking a lock or masking interrupts. The hint keeps
+ * the scan short by remembering where the last allocation succeeded.
+ */
+static ATOMIC_DEFINE(log_msg_pool_map, NUM_OF_MSGS);
+static atomic_t log_msg_pool_hint;
+static atomic_t log_msg_pool_used;
+
+void log_msg_pool_init(void)
+{
+	/* The bitmap lives in .bss; all chunks start out free. */
+}
+
+uint32_t log_msg_mem_used_get(void)
+{
+	return (uint32_t)atomic_get(&log_msg_pool_used);
+}
+
+static union log_msg_chunk *msg_pool_alloc(k_timeout_t timeout)
+{
+	uint32_t start = (uint32_t)atomic_get(&log_msg_pool_hint);
+
+	ARG_UNUSED(timeout);
+
+	for (uint32_t n = 0; n < NUM_OF_MSGS; n++) {
+		uint32_t i = start + n;
+
+		if (i >= NUM_OF_MSGS) {
+			i -= NUM_OF_MSGS;
+		}
+
+		if (!atomic_test_and_set_bit(log_msg_pool_map, i)) {
+			atomic_set(&log_msg_pool_hint,
+				   (i + 1U == NUM_OF_MSGS) ? 0 : (i + 1U));
+			atomic_inc(&log_msg_pool_used);
+			return (union log_msg_chunk *)
+				&log_msg_pool_buf[i * MSG_SIZE];
+		}
+	}
+
+	return NULL;
+}
+
+static void msg_pool_free(void *chunk)
+{
+	uint32_t i = ((uint8_t *)chunk - log_msg_pool_buf) / MSG_SIZE;
+
+	atomic_clear_bit(log_msg_pool_map, i);
+	atomic_dec(&log_msg_pool_used);
+}
+#else
+struct k_mem_slab log_msg_pool;
+
 void log_msg_pool_init(void)
 {
 	k_mem_slab_init(&log_msg_pool, log_msg_pool_buf, MSG_SIZE, NUM_OF_MSGS);
 }
 
+uint32_t log_msg_mem_used_get(void)
+{
+	return k_mem_slab_num_used_get(&log_msg_pool);
+}
+
+static union log_msg_chunk *msg_pool_alloc(k_timeout_t timeout)
+{
+	union log_msg_chunk *msg = NULL;
+
+	if (k_mem_slab_alloc(&log_msg_pool, (void **)&msg, timeout) != 0) {
+		return NULL;
+	}
+
+	return msg;
+}
+
+static void msg_pool_free(void *chunk)
+{
+	k_mem_slab_free(&log_msg_pool, (void **)&chunk);
+}
+#endif /* CONFIG_LOG_MSG_POOL_LOCK_FREE */
+
 /* Return true if interrupts were unlocked in the context of this call. */
 static bool is_irq_unlocked(void)
 {
@@ -73,13 +150,12 @@ static bool block_on_alloc(void)
 
 union log_msg_chunk *log_msg_chunk_alloc(void)
 {
-	union log_msg_chunk *msg = NULL;
-	int err = k_mem_slab_alloc(&log_msg_pool, (void **)&msg,
-		   block_on_alloc()
-		   ? K_MSEC(CONFIG_LOG_BLOCK_IN_THREAD_TIMEOUT_MS)
-		   : K_NO_WAIT);
+	union log_msg_chunk *msg =
+		msg_pool_alloc(block_on_alloc()
+			       ? K_MSEC(CONFIG_LOG_BLOCK_IN_THREAD_TIMEOUT_MS)
+			       : K_NO_WAIT);
 
-	if (err != 0) {
+	if (msg == NULL) {
 		msg = log_msg_no_space_handle();
 	}
 
@@ -97,7 +173,7 @@ static void cont_free(struct log_msg_cont *cont)
 
 	while (cont != NULL) {
 		next = cont->next;
-		k_mem_slab_free(&log_msg_pool, (void **)&cont);
+		msg_pool_free(cont);
 		cont = next;
 	}
 }
@@ -156,30 +232,27 @@ static void msg_free(struct log_msg *msg)
 		cont_free(msg->payload.ext.next);
 	}
 
-	k_mem_slab_free(&log_msg_pool, (void **)&msg);
+	msg_pool_free(msg);
 }
 
 union log_msg_chunk *log_msg_no_space_handle(void)
 {
 	union log_msg_chunk *msg = NULL;
 	bool more;
-	int err;
 
 	if (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW)) {
 		do {
 			more = log_process(true);
 			log_dropped();
-			err = k_mem_slab_alloc(&log_msg_pool,
-					       (void **)&msg,
-					       K_NO_WAIT);
-		} while ((err != 0) && more);
+			msg = msg_pool_alloc(K_NO_WAIT);
+		} while ((msg == NULL) && more);
 	} else {
 		log_dropped();
 	}
 	return msg;
 
 }
-void log_msg_put(struct log_msg *msg)
+__hot_code void log_msg_put(struct log_msg *msg)
 {
 	atomic_dec(&msg->hdr.ref_cnt);
 
@@ -57,6 +57,10 @@ extern void log_output_string_syst_process(const struct log_output *log_output,
 extern void log_output_hexdump_syst_process(const struct log_output *log_output,
 				struct log_msg_ids src_level,
 				const uint8_t *data, uint32_t length, uint32_t flag);
+extern void log_output_msg_dict_process(const struct log_output *log_output,
+				struct log_msg *msg, uint32_t flags);
+extern void log_output_dict_dropped_process(const struct log_output *log_output,
+				uint32_t cnt);
 
 /* The RFC 5424 allows very flexible mapping and suggest the value 0 being the
  * highest severity and 7 to be the lowest (debugging level) severity.
@@ -538,6 +542,12 @@ void log_output_msg_process(const struct log_output *log_output,
 		return;
 	}
 
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT) &&
+	    flags & LOG_OUTPUT_FLAG_FORMAT_DICTIONARY) {
+		log_output_msg_dict_process(log_output, msg, flags);
+		return;
+	}
+
 	prefix_offset = raw_string ?
 			0 : prefix_print(log_output, flags, std_msg, timestamp,
 					 level, domain_id, source_id);
@@ -659,6 +669,11 @@ void log_output_dropped_process(const struct log_output *log_output, uint32_t cn
 			" messages dropped ---\r\n" DROPPED_COLOR_POSTFIX;
 	log_output_func_t outf = log_output->func;
 
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_SUPPORT)) {
+		log_output_dict_dropped_process(log_output, cnt);
+		return;
+	}
+
 	cnt = MIN(cnt, 9999);
 	len = snprintk(buf, sizeof(buf), "%d", cnt);
 
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <logging/log_output.h>
+#include <logging/log_output_dict.h>
+#include <logging/log_core.h>
+#include <logging/log_msg.h>
+#include <sys/util.h>
+#include <string.h>
+
+/* Marks the end of the transient string list of a standard record. */
+#define TRANSIENT_STR_END 0xff
+
+static void dict_write(const struct log_output *output,
+		       const void *data, size_t length)
+{
+	const uint8_t *buf = data;
+	int processed;
+
+	while (length > 0) {
+		processed = output->func((uint8_t *)buf, length,
+					 output->control_block->ctx);
+		length -= processed;
+		buf += processed;
+	}
+}
+
+static void hdr_fill(struct log_dict_output_msg_hdr *hdr, struct log_msg *msg)
+{
+	hdr->level = (uint8_t)log_msg_level_get(msg);
+	hdr->domain_id = (uint8_t)log_msg_domain_id_get(msg);
+	hdr->source_id = (uint16_t)log_msg_source_id_get(msg);
+	hdr->timestamp = log_msg_timestamp_get(msg);
+}
+
+static void std_msg_process(const struct log_output *output,
+			    struct log_msg *msg)
+{
+	struct log_dict_output_msg_hdr hdr = { .type = LOG_DICT_TYPE_STD };
+	uint32_t nargs = log_msg_nargs_get(msg);
+	const char *str = log_msg_str_get(msg);
+	uint8_t nargs_byte = (uint8_t)nargs;
+	uint8_t end = TRANSIENT_STR_END;
+	uint32_t smask;
+
+	hdr_fill(&hdr, msg);
+	hdr.fmt = (uintptr_t)str;
+	dict_write(output, &hdr, sizeof(hdr));
+	dict_write(output, &nargs_byte, sizeof(nargs_byte));
+
+	for (uint32_t i = 0; i < nargs; i++) {
+		log_arg_t arg = log_msg_arg_get(msg, i);
+
+		dict_write(output, &arg, sizeof(arg));
+	}
+
+	/* Strings duplicated at the call site live in RAM and cannot be
+	 * recovered from the ELF file, append their characters.
+	 */
+	smask = nargs ? z_log_get_s_mask(str, nargs) : 0;
+
+	for (uint32_t i = 0; (smask != 0U) && (i < nargs); i++) {
+		const char *arg_str;
+		uint16_t slen;
+		uint8_t idx;
+
+		if ((smask & BIT(i)) == 0U) {
+			continue;
+		}
+
+		arg_str = (const char *)log_msg_arg_get(msg, i);
+		if (!log_is_strdup(arg_str)) {
+			continue;
+		}
+
+		idx = (uint8_t)i;
+		slen = (uint16_t)strlen(arg_str);
+		dict_write(output, &idx, sizeof(idx));
+		dict_write(output, &slen, sizeof(slen));
+		dict_write(output, arg_str, slen);
+	}
+
+	dict_write(output, &end, sizeof(end));
+}
+
+static void hexdump_msg_process(const struct log_output *output,
+				struct log_msg *msg, bool raw_string)
+{
+	struct log_dict_output_msg_hdr hdr = {
+		.type = raw_string ? LOG_DICT_TYPE_RAW_STR :
+				     LOG_DICT_TYPE_HEXDUMP
+	};
+	uint16_t len = (uint16_t)msg->hdr.params.hexdump.length;
+	size_t offset = 0;
+
+	hdr_fill(&hdr, msg);
+	hdr.fmt = raw_string ? 0 : (uintptr_t)log_msg_str_get(msg);
+	dict_write(output, &hdr, sizeof(hdr));
+	dict_write(output, &len, sizeof(len));
+
+	while (offset < len) {
+		size_t chunk = output->size;
+
+		log_msg_hexdump_data_get(msg, output->buf, &chunk, offset);
+		if (chunk == 0) {
+			break;
+		}
+
+		dict_write(output, output->buf, chunk);
+		offset += chunk;
+	}
+}
+
+void log_output_msg_dict_process(const struct log_output *output,
+				 struct log_msg *msg, uint32_t flags)
+{
+	ARG_UNUSED(flags);
+
+	if (log_msg_is_std(msg)) {
+		std_msg_process(output, msg);
+	} else {
+		bool raw_string =
+			(log_msg_level_get(msg) == LOG_LEVEL_INTERNAL_RAW_STRING);
+
+		hexdump_msg_process(output, msg, raw_string);
+	}
+}
+
+void log_output_dict_dropped_process(const struct log_output *output,
+				     uint32_t cnt)
+{
+	struct log_dict_output_msg_hdr hdr = { .type = LOG_DICT_TYPE_DROPPED };
+
+	dict_write(output, &hdr, sizeof(hdr));
+	dict_write(output, &cnt, sizeof(cnt));
+}
@@ -32,19 +32,20 @@ static uint8_t cal_checksum(const uint8_t *const buffer, const uint16_t size)
 }
 
 static void send_error_response(const struct device *const ec_host_cmd_dev,
+				uint8_t *const tx_buf,
 				const enum ec_host_cmd_status error)
 {
-	struct ec_host_cmd_response_header *const tx_header = (void *)tx_buffer;
+	struct ec_host_cmd_response_header *const tx_header = (void *)tx_buf;
 
 	tx_header->prtcl_ver = 3;
 	tx_header->result = error;
 	tx_header->data_len = 0;
 	tx_header->reserved = 0;
 	tx_header->checksum = 0;
-	tx_header->checksum = cal_checksum(tx_buffer, TX_HEADER_SIZE);
+	tx_header->checksum = cal_checksum(tx_buf, TX_HEADER_SIZE);
 
 	const struct ec_host_cmd_periph_tx_buf tx = {
-		.buf = tx_buffer,
+		.buf = tx_buf,
 		.len = TX_HEADER_SIZE,
 	};
 	ec_host_cmd_periph_send(ec_host_cmd_dev, &tx);
@@ -57,11 +58,21 @@ static void handle_host_cmds_entry(void *arg1, void *arg2, void *arg3)
 	ARG_UNUSED(arg3);
 	const struct device *ec_host_cmd_dev;
 	struct ec_host_cmd_periph_rx_ctx rx;
+	uint8_t *tx_buf = tx_buffer;
+	size_t tx_buf_size = sizeof(tx_buffer);
 
 	ec_host_cmd_dev = device_get_binding(DT_LABEL(DT_HOST_CMD_DEV));
 
 	ec_host_cmd_periph_init(ec_host_cmd_dev, &rx);
 
+	/* Requests are parsed in place in the peripheral's receive buffer;
+	 * when the peripheral also exposes its (DMA-capable) transmit
+	 * buffer, responses are built in place too and the transaction
+	 * path copies nothing.
+	 */
+	(void)ec_host_cmd_periph_get_tx_buf(ec_host_cmd_dev, &tx_buf,
+					    &tx_buf_size);
+
 	while (1) {
 		/* We have finished reading from RX buffer, so allow another
 		 * incoming msg.
@@ -73,13 +84,13 @@ static void handle_host_cmds_entry(void *arg1, void *arg2, void *arg3)
 			/* This code path should never occur due to the nature of
 			 * k_sem_take with K_FOREVER
 			 */
-			send_error_response(ec_host_cmd_dev,
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_ERROR);
 		}
 		/* rx buf and len now have valid incoming data */
 
 		if (*rx.len < RX_HEADER_SIZE) {
-			send_error_response(ec_host_cmd_dev,
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_REQUEST_TRUNCATED);
 			continue;
 		}
@@ -89,7 +100,7 @@ static void handle_host_cmds_entry(void *arg1, void *arg2, void *arg3)
 
 		/* Only support version 3 */
 		if (rx_header->prtcl_ver != 3) {
-			send_error_response(ec_host_cmd_dev,
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_INVALID_HEADER);
 			continue;
 		}
@@ -102,14 +113,14 @@ static void handle_host_cmds_entry(void *arg1, void *arg2, void *arg3)
 		 * add on extra padding bytes at the end.
 		 */
 		if (*rx.len < rx_valid_data_size) {
-			send_error_response(ec_host_cmd_dev,
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_REQUEST_TRUNCATED);
 			continue;
 		}
 
 		/* Validate checksum */
 		if (cal_checksum(rx.buf, rx_valid_data_size) != 0) {
-			send_error_response(ec_host_cmd_dev,
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_INVALID_CHECKSUM);
 			continue;
 		}
@@ -126,7 +137,7 @@ static void handle_host_cmds_entry(void *arg1, void *arg2, void *arg3)
 
 		/* No handler in this image for requested command */
 		if (found_handler == NULL) {
-			send_error_response(ec_host_cmd_dev,
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_INVALID_COMMAND);
 			continue;
 		}
@@ -138,31 +149,31 @@ static void handle_host_cmds_entry(void *arg1, void *arg2, void *arg3)
 		 */
 		memset(&rx.buf[rx_valid_data_size], 0,
 		       *rx.len - rx_valid_data_size);
-		memset(tx_buffer, 0, sizeof(tx_buffer));
+		memset(tx_buf, 0, tx_buf_size);
 
 		struct ec_host_cmd_handler_args args = {
 			.input_buf = rx.buf + RX_HEADER_SIZE,
 			.input_buf_size = rx_header->data_len,
-			.output_buf = tx_buffer + TX_HEADER_SIZE,
-			.output_buf_size = sizeof(tx_buffer) - TX_HEADER_SIZE,
+			.output_buf = tx_buf + TX_HEADER_SIZE,
+			.output_buf_size = tx_buf_size - TX_HEADER_SIZE,
 			.version = rx_header->cmd_ver,
 		};
 
 		if (found_handler->min_rqt_size > args.input_buf_size) {
-			send_error_response(ec_host_cmd_dev,
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_REQUEST_TRUNCATED);
 			continue;
 		}
 
 		if (found_handler->min_rsp_size > args.output_buf_size) {
-			send_error_response(ec_host_cmd_dev,
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_INVALID_RESPONSE);
 			continue;
 		}
 
 		if (args.version > sizeof(found_handler->version_mask) ||
 		    !(found_handler->version_mask & BIT(args.version))) {
-			send_error_response(ec_host_cmd_dev,
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_INVALID_VERSION);
 			continue;
 		}
@@ -171,12 +182,12 @@ static void handle_host_cmds_entry(void *arg1, void *arg2, void *arg3)
 			found_handler->handler(&args);
 
 		if (handler_rv != EC_HOST_CMD_SUCCESS) {
-			send_error_response(ec_host_cmd_dev, handler_rv);
+			send_error_response(ec_host_cmd_dev, tx_buf, handler_rv);
 			continue;
 		}
 
 		struct ec_host_cmd_response_header *const tx_header =
-			(void *)tx_buffer;
+			(void *)tx_buf;
 
 		tx_header->prtcl_ver = 3;
 		tx_header->result = EC_HOST_CMD_SUCCESS;
@@ -184,18 +195,18 @@ static void handle_host_cmds_entry(void *arg1, void *arg2, void *arg3)
 
 		const uint16_t tx_valid_data_size =
 			tx_header->data_len + TX_HEADER_SIZE;
-		if (tx_valid_data_size > sizeof(tx_buffer)) {
-			send_error_response(ec_host_cmd_dev,
+		if (tx_valid_data_size > tx_buf_size) {
+			send_error_response(ec_host_cmd_dev, tx_buf,
 					    EC_HOST_CMD_INVALID_RESPONSE);
 			continue;
 		}
 
 		/* Calculate checksum */
 		tx_header->checksum =
-			cal_checksum(tx_buffer, tx_valid_data_size);
+			cal_checksum(tx_buf, tx_valid_data_size);
 
 		const struct ec_host_cmd_periph_tx_buf tx = {
-			.buf = tx_buffer,
+			.buf = tx_buf,
 			.len = tx_valid_data_size,
 		};
 		ec_host_cmd_periph_send(ec_host_cmd_dev, &tx);
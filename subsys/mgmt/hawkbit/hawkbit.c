@@ -26,6 +26,7 @@ LOG_MODULE_REGISTER(hawkbit);
 #include <net/dns_resolve.h>
 #include <logging/log_ctrl.h>
 #include <storage/flash_map.h>
+#include <storage/stream_flash.h>
 
 #include "hawkbit_priv.h"
 #include "hawkbit_device.h"
@@ -38,6 +39,7 @@ LOG_MODULE_REGISTER(hawkbit);
 #endif
 
 #define ADDRESS_ID 1
+#define PROGRESS_ID 2
 
 #define CANCEL_BASE_SIZE 50
 #define RECV_BUFFER_SIZE 640
@@ -66,6 +68,10 @@ struct hawkbit_download {
 	int download_progress;
 	size_t downloaded_size;
 	size_t http_content_size;
+#ifdef CONFIG_HAWKBIT_RESUME_DOWNLOAD
+	size_t resume_offset;
+	size_t file_size;
+#endif
 };
 
 static struct hawkbit_context {
@@ -662,6 +668,44 @@ static int enum_for_http_req_string(char *userdata)
 	return 0;
 }
 
+#ifdef CONFIG_HAWKBIT_RESUME_DOWNLOAD
+struct hawkbit_dl_progress {
+	int32_t action_id;
+	size_t bytes;
+};
+
+static void hawkbit_progress_save(void)
+{
+	struct hawkbit_dl_progress prog = {
+		.action_id = hb_context.json_action_id,
+		.bytes = hb_context.dl.downloaded_size,
+	};
+
+	if (nvs_write(&fs, PROGRESS_ID, &prog, sizeof(prog)) < 0) {
+		LOG_WRN("Failed to save download progress");
+	}
+}
+
+static void hawkbit_progress_load(void)
+{
+	struct hawkbit_dl_progress prog;
+	ssize_t ret = nvs_read(&fs, PROGRESS_ID, &prog, sizeof(prog));
+
+	if (ret != sizeof(prog) ||
+	    prog.action_id != hb_context.json_action_id ||
+	    prog.bytes == 0 || prog.bytes >= hb_context.dl.file_size) {
+		return;
+	}
+
+	if (stream_flash_progress_set(&hb_context.flash_ctx.stream,
+				      prog.bytes) == 0) {
+		hb_context.dl.resume_offset = prog.bytes;
+		LOG_INF("Resuming download of action %d at %u bytes",
+			prog.action_id, (unsigned int)prog.bytes);
+	}
+}
+#endif /* CONFIG_HAWKBIT_RESUME_DOWNLOAD */
+
 static void response_cb(struct http_response *rsp,
 			enum http_final_call final_data,
 			void *userdata)
@@ -797,6 +841,33 @@ static void response_cb(struct http_response *rsp,
 			body_len = rsp->data_len;
 			body_len -= (rsp->body_start - rsp->recv_buf);
 			hb_context.dl.http_content_size = rsp->content_length;
+
+#ifdef CONFIG_HAWKBIT_RESUME_DOWNLOAD
+			if (hb_context.dl.resume_offset > 0) {
+				if (rsp->content_length >=
+				    hb_context.dl.file_size) {
+					/* The server ignored the range
+					 * request and sent the whole image;
+					 * start writing from the beginning.
+					 */
+					LOG_WRN("Range request not honored, "
+						"restarting download");
+					hb_context.dl.resume_offset = 0;
+					ret = flash_img_init(
+						&hb_context.flash_ctx);
+					if (ret < 0) {
+						LOG_ERR("flash init error");
+						hb_context.code_status =
+							HAWKBIT_DOWNLOAD_ERROR;
+						break;
+					}
+				} else {
+					/* Only the remainder is on the wire */
+					hb_context.dl.http_content_size +=
+						hb_context.dl.resume_offset;
+				}
+			}
+#endif
 		}
 
 		if ((rsp->body_found == 1) && (body_data == NULL)) {
@@ -824,6 +895,10 @@ static void response_cb(struct http_response *rsp,
 			hb_context.dl.download_progress = downloaded;
 			LOG_DBG("Download percentage: %d%% ",
 				hb_context.dl.download_progress);
+
+#ifdef CONFIG_HAWKBIT_RESUME_DOWNLOAD
+			hawkbit_progress_save();
+#endif
 		}
 
 		if (final_data == HTTP_DATA_FINAL) {
@@ -841,6 +916,10 @@ static bool send_request(enum http_method method,
 {
 	int ret = 0;
 
+#ifdef CONFIG_HAWKBIT_RESUME_DOWNLOAD
+	char range_header[32];
+	const char *range_headers[2] = { NULL, NULL };
+#endif
 	struct hawkbit_cfg cfg;
 	struct hawkbit_close close;
 	struct hawkbit_dep_fbk feedback;
@@ -995,6 +1074,15 @@ static bool send_request(enum http_method method,
 		break;
 
 	case HAWKBIT_DOWNLOAD:
+#ifdef CONFIG_HAWKBIT_RESUME_DOWNLOAD
+		if (hb_context.dl.resume_offset > 0) {
+			snprintk(range_header, sizeof(range_header),
+				 "Range: bytes=%u-\r\n",
+				 (unsigned int)hb_context.dl.resume_offset);
+			range_headers[0] = range_header;
+			hb_context.http_req.header_fields = range_headers;
+		}
+#endif
 		ret = http_client_req(hb_context.sock, &hb_context.http_req,
 				      HAWKBIT_RECV_TIMEOUT, "HAWKBIT_DOWNLOAD");
 		if (ret < 0) {
@@ -1196,6 +1284,11 @@ enum hawkbit_response hawkbit_probe(void)
 
 	flash_img_init(&hb_context.flash_ctx);
 
+#ifdef CONFIG_HAWKBIT_RESUME_DOWNLOAD
+	hb_context.dl.file_size = file_size;
+	hawkbit_progress_load();
+#endif
+
 	if (!send_request(HTTP_GET, HAWKBIT_DOWNLOAD,
 			  HAWKBIT_STATUS_FINISHED_NONE,
 			  HAWKBIT_STATUS_EXEC_NONE)) {
@@ -1208,6 +1301,11 @@ enum hawkbit_response hawkbit_probe(void)
 		goto cleanup;
 	}
 
+#ifdef CONFIG_HAWKBIT_RESUME_DOWNLOAD
+	/* The image is complete, stored progress no longer applies */
+	nvs_delete(&fs, PROGRESS_ID);
+#endif
+
 	if (boot_request_upgrade(BOOT_UPGRADE_TEST)) {
 		LOG_ERR("Download failed");
 		hb_context.code_status = HAWKBIT_DOWNLOAD_ERROR;
@@ -5,6 +5,7 @@
  */
 
 #include <zephyr.h>
+#include <init.h>
 #include "net/buf.h"
 #include "mgmt/mgmt.h"
 #include "mgmt/mcumgr/buf.h"
@@ -20,6 +21,32 @@ static mgmt_init_writer_fn zephyr_smp_init_writer;
 static mgmt_free_buf_fn zephyr_smp_free_buf;
 static smp_tx_rsp_fn zephyr_smp_tx_rsp;
 
+#ifdef CONFIG_MCUMGR_SMP_WORKQUEUE
+/* Dedicated work queue for SMP request processing.  Long-running
+ * command handlers (e.g. image upload flash writes) then do not stall
+ * the system work queue, and the transports keep receiving and
+ * queueing further requests while a handler runs.
+ */
+static K_THREAD_STACK_DEFINE(zephyr_smp_stack,
+			     CONFIG_MCUMGR_SMP_WORKQUEUE_STACK_SIZE);
+static struct k_work_q zephyr_smp_work_q;
+
+static int
+zephyr_smp_workqueue_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_work_q_start(&zephyr_smp_work_q, zephyr_smp_stack,
+		       K_THREAD_STACK_SIZEOF(zephyr_smp_stack),
+		       CONFIG_MCUMGR_SMP_WORKQUEUE_PRIO);
+	k_thread_name_set(&zephyr_smp_work_q.thread, "mcumgr_smp");
+
+	return 0;
+}
+SYS_INIT(zephyr_smp_workqueue_init, APPLICATION,
+	 CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_MCUMGR_SMP_WORKQUEUE */
+
 static const struct mgmt_streamer_cfg zephyr_smp_cbor_cfg = {
 	.alloc_rsp = zephyr_smp_alloc_rsp,
 	.trim_front = zephyr_smp_trim_front,
@@ -300,5 +327,9 @@ void
 zephyr_smp_rx_req(struct zephyr_smp_transport *zst, struct net_buf *nb)
 {
 	k_fifo_put(&zst->zst_fifo, nb);
+#ifdef CONFIG_MCUMGR_SMP_WORKQUEUE
+	k_work_submit_to_queue(&zephyr_smp_work_q, &zst->zst_work);
+#else
 	k_work_submit(&zst->zst_work);
+#endif
 }
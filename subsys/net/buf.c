@@ -55,6 +55,86 @@ static int pool_id(struct net_buf_pool *pool)
 	return pool - _net_buf_pool_list;
 }
 
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+static unsigned int cache_cpu(void)
+{
+#if defined(CONFIG_SMP)
+	/* Purely a locality hint: migrating right after the read only
+	 * costs us a remote cache access, which the atomics make safe.
+	 */
+	return arch_curr_cpu()->id;
+#else
+	return 0;
+#endif
+}
+
+/* Take a buffer from the local CPU's cache, stealing from the other
+ * CPUs' caches on a miss. Slots are emptied with an atomic exchange, so
+ * this is safe against ISRs and other CPUs without any lock.
+ */
+static struct net_buf *cache_get(struct net_buf_pool *pool)
+{
+	unsigned int first = cache_cpu();
+
+	for (unsigned int n = 0; n < CONFIG_MP_NUM_CPUS; n++) {
+		atomic_ptr_t *slots =
+			pool->cache[(first + n) % CONFIG_MP_NUM_CPUS];
+
+		for (int i = 0; i < CONFIG_NET_BUF_CPU_CACHE_SIZE; i++) {
+			struct net_buf *buf = atomic_ptr_set(&slots[i], NULL);
+
+			if (buf != NULL) {
+				return buf;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/* Move every cached buffer back to the shared LIFO, so allocators about
+ * to block on it can't miss buffers parked in the caches.
+ */
+static void cache_drain(struct net_buf_pool *pool)
+{
+	for (unsigned int n = 0; n < CONFIG_MP_NUM_CPUS; n++) {
+		for (int i = 0; i < CONFIG_NET_BUF_CPU_CACHE_SIZE; i++) {
+			struct net_buf *buf =
+				atomic_ptr_set(&pool->cache[n][i], NULL);
+
+			if (buf != NULL) {
+				k_lifo_put(&pool->free, buf);
+			}
+		}
+	}
+}
+
+void net_buf_cache_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	atomic_ptr_t *slots = pool->cache[cache_cpu()];
+
+	for (int i = 0; i < CONFIG_NET_BUF_CPU_CACHE_SIZE; i++) {
+		if (atomic_ptr_cas(&slots[i], NULL, buf)) {
+			/* Ordering argument against lost wakeups: the
+			 * insertion above and the blocked-count read
+			 * below are both sequentially consistent, as
+			 * are the count increment and cache drain in
+			 * net_buf_alloc_len(). Either we see the
+			 * blocked allocator here and drain for it, or
+			 * it drains after our insertion is visible.
+			 */
+			if (atomic_get(&pool->blocked) > 0) {
+				cache_drain(pool);
+			}
+			return;
+		}
+	}
+
+	/* Local cache full */
+	k_lifo_put(&pool->free, buf);
+}
+#endif /* CONFIG_NET_BUF_CPU_CACHE */
+
 int net_buf_id(struct net_buf *buf)
 {
 	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
@@ -242,6 +322,13 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+	buf = cache_get(pool);
+	if (buf) {
+		goto success;
+	}
+#endif
+
 	/* We need to lock interrupts temporarily to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -274,6 +361,17 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	irq_unlock(key);
 
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+	/* About to touch the shared LIFO: advertise ourselves to
+	 * net_buf_cache_put() and flush the caches so no free buffer
+	 * can sit in one while we block below.
+	 */
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		atomic_inc(&pool->blocked);
+		cache_drain(pool);
+	}
+#endif
+
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
@@ -303,6 +401,13 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #else
 	buf = k_lifo_get(&pool->free, timeout);
 #endif
+
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		atomic_dec(&pool->blocked);
+	}
+#endif
+
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
 		return NULL;
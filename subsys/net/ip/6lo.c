@@ -44,6 +44,29 @@ static inline uint8_t get_6co_cid(struct net_icmpv6_nd_opt_6co *opt)
 }
 
 static struct net_6lo_context ctx_6co[CONFIG_NET_MAX_6LO_CONTEXTS];
+
+/* Cache of recent context lookups by address prefix. Traffic typically
+ * goes to a few destinations, so remembering the result of the table
+ * scan, including the "no matching context" case, lets steady-state
+ * packets skip the prefix comparisons in compress_IPHC_header().
+ */
+#define ADDR_CTX_CACHE_SIZE 4
+
+struct addr_ctx_cache_entry {
+	struct net_if *iface;
+	uint8_t prefix[8];
+	struct net_6lo_context *ctx;
+	bool valid;
+};
+
+static struct addr_ctx_cache_entry addr_ctx_cache[ADDR_CTX_CACHE_SIZE];
+static uint8_t addr_ctx_cache_next;
+
+static void addr_ctx_cache_flush(void)
+{
+	(void)memset(addr_ctx_cache, 0, sizeof(addr_ctx_cache));
+	addr_ctx_cache_next = 0U;
+}
 #endif
 
 static const uint8_t udp_nhc_inline_size_table[] = {4, 3, 3, 1};
@@ -170,6 +193,8 @@ static inline void set_6lo_context(struct net_if *iface, uint8_t index,
 	ctx_6co[index].cid = get_6co_cid(context);
 
 	net_ipaddr_copy(&ctx_6co[index].prefix, &context->prefix);
+
+	addr_ctx_cache_flush();
 }
 
 void net_6lo_set_context(struct net_if *iface,
@@ -192,6 +217,7 @@ void net_6lo_set_context(struct net_if *iface,
 			/* Remove if lifetime is zero */
 			if (!context->lifetime) {
 				ctx_6co[i].is_used = false;
+				addr_ctx_cache_flush();
 				return;
 			}
 
@@ -233,8 +259,20 @@ get_6lo_context_by_cid(struct net_if *iface, uint8_t cid)
 static inline struct net_6lo_context *
 get_6lo_context_by_addr(struct net_if *iface, struct in6_addr *addr)
 {
+	struct addr_ctx_cache_entry *entry;
+	struct net_6lo_context *ctx = NULL;
 	uint8_t i;
 
+	for (i = 0U; i < ADDR_CTX_CACHE_SIZE; i++) {
+		entry = &addr_ctx_cache[i];
+
+		if (entry->valid && entry->iface == iface &&
+		    !memcmp(entry->prefix, addr->s6_addr,
+			    sizeof(entry->prefix))) {
+			return entry->ctx;
+		}
+	}
+
 	for (i = 0U; i < CONFIG_NET_MAX_6LO_CONTEXTS; i++) {
 		if (!ctx_6co[i].is_used) {
 			continue;
@@ -242,11 +280,23 @@ get_6lo_context_by_addr(struct net_if *iface, struct in6_addr *addr)
 
 		if (ctx_6co[i].iface == iface &&
 		    !memcmp(ctx_6co[i].prefix.s6_addr, addr->s6_addr, 8)) {
-			return &ctx_6co[i];
+			ctx = &ctx_6co[i];
+			break;
 		}
 	}
 
-	return NULL;
+	/* Cache the outcome, also when no context matched so that the
+	 * table scan is skipped for such prefixes too.
+	 */
+	entry = &addr_ctx_cache[addr_ctx_cache_next];
+	addr_ctx_cache_next = (addr_ctx_cache_next + 1) % ADDR_CTX_CACHE_SIZE;
+
+	entry->iface = iface;
+	memcpy(entry->prefix, addr->s6_addr, sizeof(entry->prefix));
+	entry->ctx = ctx;
+	entry->valid = true;
+
+	return ctx;
 }
 
 #endif
@@ -54,11 +54,106 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+/** Flags a connection must have for its end points to be fully
+ * specified, making it eligible for the hashed lookup.
+ */
+#define NET_CONN_HASHABLE		(NET_CONN_REMOTE_ADDR_SPEC |	\
+					 NET_CONN_REMOTE_PORT_SPEC |	\
+					 NET_CONN_LOCAL_PORT_SPEC)
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+/* Fully specified connections are additionally hashed on their remote
+ * address and both ports, so that received unicast packets do not need
+ * a scan over every registered handler. Wildcard listeners are only
+ * found by the ranked scan of conn_used.
+ */
+static sys_slist_t conn_hash[CONFIG_NET_CONN_HASH_BUCKETS];
+
+static uint32_t conn_hash_fold(uint32_t hash, uint32_t val)
+{
+	/* Knuth's multiplicative hash over a running xor */
+	return (hash ^ val) * 2654435761U;
+}
+
+static uint32_t conn_hash_bucket(uint16_t proto, uint8_t family,
+				 const uint8_t *remote_ip, size_t addr_len,
+				 uint16_t remote_port, uint16_t local_port)
+{
+	uint32_t hash = proto;
+	size_t i;
+
+	hash = conn_hash_fold(hash, family);
+	hash = conn_hash_fold(hash,
+			      ((uint32_t)remote_port << 16) | local_port);
+
+	for (i = 0; i < addr_len; i += sizeof(uint32_t)) {
+		uint32_t word;
+
+		memcpy(&word, remote_ip + i, sizeof(word));
+		hash = conn_hash_fold(hash, word);
+	}
+
+	return hash % CONFIG_NET_CONN_HASH_BUCKETS;
+}
+
+static bool conn_is_hashable(struct net_conn *conn)
+{
+	if (!(IS_ENABLED(CONFIG_NET_UDP) && conn->proto == IPPROTO_UDP) &&
+	    !(IS_ENABLED(CONFIG_NET_TCP) && conn->proto == IPPROTO_TCP)) {
+		return false;
+	}
+
+	/* An AF_UNSPEC connection matches any packet family, so it can
+	 * only be found by the scan.
+	 */
+	if (conn->family != conn->remote_addr.sa_family) {
+		return false;
+	}
+
+	return (conn->flags & NET_CONN_HASHABLE) == NET_CONN_HASHABLE;
+}
+
+static uint32_t conn_hash_bucket_get(struct net_conn *conn)
+{
+	const uint8_t *remote_ip;
+	size_t addr_len;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6) {
+		remote_ip = (const uint8_t *)
+			&net_sin6(&conn->remote_addr)->sin6_addr;
+		addr_len = sizeof(struct in6_addr);
+	} else {
+		remote_ip = (const uint8_t *)
+			&net_sin(&conn->remote_addr)->sin_addr;
+		addr_len = sizeof(struct in_addr);
+	}
+
+	return conn_hash_bucket(conn->proto, conn->family, remote_ip, addr_len,
+				net_sin(&conn->remote_addr)->sin_port,
+				net_sin(&conn->local_addr)->sin_port);
+}
+
+static void conn_hash_insert(struct net_conn *conn)
+{
+	if (conn_is_hashable(conn)) {
+		sys_slist_prepend(&conn_hash[conn_hash_bucket_get(conn)],
+				  &conn->hash_node);
+	}
+}
+
+static void conn_hash_remove(struct net_conn *conn)
+{
+	if (conn_is_hashable(conn)) {
+		sys_slist_find_and_remove(
+			&conn_hash[conn_hash_bucket_get(conn)],
+			&conn->hash_node);
+	}
+}
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -355,6 +450,8 @@ int net_conn_register(uint16_t proto, uint8_t family,
 
 	conn_set_used(conn);
 
+	conn_hash_insert(conn);
+
 	conn_register_debug(conn, remote_port, local_port);
 
 	return 0;
@@ -379,6 +476,8 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	sys_slist_find_and_remove(&conn_used, &conn->node);
 
+	conn_hash_remove(conn);
+
 	conn_set_unused(conn);
 
 	return 0;
@@ -505,6 +604,67 @@ static bool conn_are_end_points_valid(struct net_pkt *pkt,
 	return !(my_src_addr && (src_port == dst_port));
 }
 
+/* Look up a fully specified connection for a received unicast UDP/TCP
+ * packet. Like in the ranked scan, the first match specifying the
+ * remote port is final, so it can be delivered to directly and the
+ * scan over every handler is skipped.
+ */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port,
+					 uint16_t dst_port)
+{
+	struct net_conn *conn;
+	uint32_t bucket;
+
+	if (!(IS_ENABLED(CONFIG_NET_UDP) && proto == IPPROTO_UDP) &&
+	    !(IS_ENABLED(CONFIG_NET_TCP) && proto == IPPROTO_TCP)) {
+		return NULL;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) &&
+	    net_pkt_family(pkt) == AF_INET6) {
+		bucket = conn_hash_bucket(proto, AF_INET6,
+					  (const uint8_t *)&ip_hdr->ipv6->src,
+					  sizeof(struct in6_addr),
+					  src_port, dst_port);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   net_pkt_family(pkt) == AF_INET) {
+		bucket = conn_hash_bucket(proto, AF_INET,
+					  (const uint8_t *)&ip_hdr->ipv4->src,
+					  sizeof(struct in_addr),
+					  src_port, dst_port);
+	} else {
+		return NULL;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_hash[bucket], conn, hash_node) {
+		if (conn->proto != proto ||
+		    conn->family != net_pkt_family(pkt)) {
+			continue;
+		}
+
+		if (net_sin(&conn->remote_addr)->sin_port != src_port ||
+		    net_sin(&conn->local_addr)->sin_port != dst_port) {
+			continue;
+		}
+
+		if (!conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+			continue;
+		}
+
+		if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+			continue;
+		}
+
+		return conn;
+	}
+
+	return NULL;
+}
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -580,6 +740,14 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
+	if (!is_mcast_pkt && !is_bcast_pkt) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto,
+					      src_port, dst_port);
+		if (best_match != NULL) {
+			goto deliver;
+		}
+	}
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* For packet socket data, the proto is set to ETH_P_ALL but
 		 * the listener might have a specific protocol set. This is ok
@@ -730,6 +898,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		return NET_OK;
 	}
 
+deliver:
 	conn = best_match;
 	if (conn) {
 		NET_DBG("[%p] match found cb %p ud %p rank 0x%02x",
@@ -790,6 +959,10 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+	for (i = 0; i < CONFIG_NET_CONN_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_hash[i]);
+	}
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
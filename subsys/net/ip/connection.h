@@ -50,6 +50,11 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+	/** Internal node in the lookup hash bucket, used only when the
+	 * remote address, remote port and local port are all specified.
+	 */
+	sys_snode_t hash_node;
+
 	/** Remote IP address */
 	struct sockaddr remote_addr;
 
@@ -27,6 +27,11 @@ LOG_MODULE_REGISTER(net_dhcpv4, CONFIG_NET_DHCPV4_LOG_LEVEL);
 #include <net/dhcpv4.h>
 #include <net/dns_resolve.h>
 
+#if defined(CONFIG_NET_DHCPV4_INIT_REBOOT)
+#include <stdlib.h>
+#include <settings/settings.h>
+#endif
+
 #include "dhcpv4.h"
 #include "ipv4.h"
 
@@ -60,6 +65,149 @@ static const char *dhcpv4_msg_type_name(enum dhcpv4_msg_type msg_type)
 	return name[msg_type - 1];
 }
 
+#if defined(CONFIG_NET_DHCPV4_INIT_REBOOT)
+/* Lease information persisted through the settings subsystem so that
+ * the next boot can skip the discovery and go straight to INIT-REBOOT.
+ */
+struct dhcpv4_lease {
+	struct in_addr requested_ip;
+	struct in_addr server_id;
+	uint32_t lease_time;
+	uint32_t renewal_time;
+	uint32_t rebinding_time;
+};
+
+static void dhcpv4_lease_key(struct net_if *iface, char *buf, size_t buf_len)
+{
+	snprintk(buf, buf_len, "net/dhcpv4/lease/%d",
+		 net_if_get_by_iface(iface));
+}
+
+static void dhcpv4_lease_store(struct net_if *iface)
+{
+	struct dhcpv4_lease lease;
+	char key[32];
+	int ret;
+
+	lease.requested_ip = iface->config.dhcpv4.requested_ip;
+	lease.server_id = iface->config.dhcpv4.server_id;
+	lease.lease_time = iface->config.dhcpv4.lease_time;
+	lease.renewal_time = iface->config.dhcpv4.renewal_time;
+	lease.rebinding_time = iface->config.dhcpv4.rebinding_time;
+
+	dhcpv4_lease_key(iface, key, sizeof(key));
+
+	ret = settings_save_one(key, &lease, sizeof(lease));
+	if (ret < 0) {
+		NET_DBG("Cannot store lease (%d)", ret);
+	}
+}
+
+static void dhcpv4_lease_clear(struct net_if *iface)
+{
+	char key[32];
+	int ret;
+
+	iface->config.dhcpv4.lease_restored = false;
+
+	dhcpv4_lease_key(iface, key, sizeof(key));
+
+	ret = settings_delete(key);
+	if (ret < 0) {
+		NET_DBG("Cannot clear lease (%d)", ret);
+	}
+}
+
+static int dhcpv4_lease_set(const char *name, size_t len_rd,
+			    settings_read_cb read_cb, void *cb_arg)
+{
+	struct dhcpv4_lease lease;
+	struct net_if *iface;
+	const char *next;
+	ssize_t len;
+
+	if (!settings_name_steq(name, "lease", &next) || !next) {
+		return -ENOENT;
+	}
+
+	iface = net_if_get_by_index(strtol(next, NULL, 10));
+	if (!iface) {
+		return -ENOENT;
+	}
+
+	if (iface->config.dhcpv4.state != NET_DHCPV4_DISABLED) {
+		/* Do not clobber an ongoing negotiation */
+		return 0;
+	}
+
+	if (len_rd == 0U) {
+		iface->config.dhcpv4.lease_restored = false;
+		return 0;
+	}
+
+	len = read_cb(cb_arg, &lease, sizeof(lease));
+	if (len != sizeof(lease)) {
+		NET_DBG("Cannot read lease (%zd)", len);
+		return -EINVAL;
+	}
+
+	iface->config.dhcpv4.requested_ip = lease.requested_ip;
+	iface->config.dhcpv4.server_id = lease.server_id;
+	iface->config.dhcpv4.lease_time = lease.lease_time;
+	iface->config.dhcpv4.renewal_time = lease.renewal_time;
+	iface->config.dhcpv4.rebinding_time = lease.rebinding_time;
+	iface->config.dhcpv4.lease_restored = true;
+
+	NET_DBG("restored lease %s for iface %p",
+		log_strdup(net_sprint_ipv4_addr(
+				   &iface->config.dhcpv4.requested_ip)),
+		iface);
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(net_dhcpv4, "net/dhcpv4", NULL,
+			       dhcpv4_lease_set, NULL, NULL);
+
+static bool dhcpv4_lease_load(struct net_if *iface)
+{
+	int ret;
+
+	iface->config.dhcpv4.lease_restored = false;
+
+	ret = settings_subsys_init();
+	if (ret < 0) {
+		NET_DBG("Cannot init settings (%d)", ret);
+		return false;
+	}
+
+	ret = settings_load_subtree("net/dhcpv4");
+	if (ret < 0) {
+		NET_DBG("Cannot load lease (%d)", ret);
+		return false;
+	}
+
+	return iface->config.dhcpv4.lease_restored;
+}
+#else /* CONFIG_NET_DHCPV4_INIT_REBOOT */
+static inline void dhcpv4_lease_store(struct net_if *iface)
+{
+	ARG_UNUSED(iface);
+}
+
+static inline void dhcpv4_lease_clear(struct net_if *iface)
+{
+	ARG_UNUSED(iface);
+}
+
+static inline bool dhcpv4_lease_load(struct net_if *iface)
+{
+	ARG_UNUSED(iface);
+
+	return false;
+}
+#endif /* CONFIG_NET_DHCPV4_INIT_REBOOT */
+
 /* Add magic cookie to DCHPv4 messages */
 static inline bool dhcpv4_add_cookie(struct net_pkt *pkt)
 {
@@ -319,6 +467,13 @@ static uint32_t dhcpv4_send_request(struct net_if *iface)
 		NET_ASSERT(0, "Invalid state %s",
 			   net_dhcpv4_state_name(iface->config.dhcpv4.state));
 		break;
+	case NET_DHCPV4_INIT_REBOOT:
+		/* RFC2131 4.3.2, broadcast a REQUEST for the previously
+		 * held address with the requested IP option but without
+		 * a server identifier.
+		 */
+		with_requested_ip = true;
+		break;
 	case NET_DHCPV4_REQUESTING:
 		with_server_id = true;
 		with_requested_ip = true;
@@ -529,6 +684,11 @@ static void dhcpv4_enter_bound(struct net_if *iface)
 
 	dhcpv4_update_timeout_work(iface->config.dhcpv4.request_time);
 
+	/* Remember the lease so that the next boot can try INIT-REBOOT
+	 * instead of a full discovery.
+	 */
+	dhcpv4_lease_store(iface);
+
 	net_mgmt_event_notify_with_info(NET_EVENT_IPV4_DHCP_BOUND, iface,
 					&iface->config.dhcpv4,
 					sizeof(iface->config.dhcpv4));
@@ -552,6 +712,18 @@ static uint32_t dhcph4_manage_timers(struct net_if *iface, int64_t timeout)
 	case NET_DHCPV4_SELECTING:
 		/* Failed to get OFFER message, send DISCOVER again */
 		return dhcpv4_send_discover(iface);
+	case NET_DHCPV4_INIT_REBOOT:
+		/* The remembered lease is likely stale if nobody
+		 * answers, revert quickly to the normal discovery.
+		 */
+		if (iface->config.dhcpv4.attempts >=
+					DHCPV4_INIT_REBOOT_MAX_ATTEMPTS) {
+			NET_DBG("no reply to init-reboot, restart");
+			dhcpv4_enter_selecting(iface);
+			return dhcpv4_send_discover(iface);
+		}
+
+		return dhcpv4_send_request(iface);
 	case NET_DHCPV4_REQUESTING:
 		/* Maximum number of renewal attempts failed, so start
 		 * from the beginning.
@@ -850,6 +1022,7 @@ static inline void dhcpv4_handle_msg_offer(struct net_if *iface)
 	switch (iface->config.dhcpv4.state) {
 	case NET_DHCPV4_DISABLED:
 	case NET_DHCPV4_INIT:
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_REQUESTING:
 	case NET_DHCPV4_RENEWING:
 	case NET_DHCPV4_REBINDING:
@@ -869,6 +1042,7 @@ static void dhcpv4_handle_msg_ack(struct net_if *iface)
 	case NET_DHCPV4_SELECTING:
 	case NET_DHCPV4_BOUND:
 		break;
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_REQUESTING:
 		NET_INFO("Received: %s",
 			 log_strdup(net_sprint_ipv4_addr(
@@ -904,8 +1078,14 @@ static void dhcpv4_handle_msg_nak(struct net_if *iface)
 	case NET_DHCPV4_RENEWING:
 	case NET_DHCPV4_BOUND:
 		break;
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_REQUESTING:
 	case NET_DHCPV4_REBINDING:
+		/* The server rejected the address we asked for, so the
+		 * remembered lease is no longer valid.
+		 */
+		dhcpv4_lease_clear(iface);
+
 		/* Restart the configuration process. */
 		dhcpv4_enter_selecting(iface);
 		break;
@@ -1073,6 +1253,7 @@ const char *net_dhcpv4_state_name(enum net_dhcpv4_state state)
 	static const char * const name[] = {
 		"disabled",
 		"init",
+		"init-reboot",
 		"selecting",
 		"requesting",
 		"renewing",
@@ -1093,10 +1274,6 @@ void net_dhcpv4_start(struct net_if *iface)
 
 	switch (iface->config.dhcpv4.state) {
 	case NET_DHCPV4_DISABLED:
-		iface->config.dhcpv4.state = NET_DHCPV4_INIT;
-		NET_DBG("iface %p state=%s", iface,
-			net_dhcpv4_state_name(iface->config.dhcpv4.state));
-
 		iface->config.dhcpv4.attempts = 0U;
 		iface->config.dhcpv4.lease_time = 0U;
 		iface->config.dhcpv4.renewal_time = 0U;
@@ -1116,15 +1293,28 @@ void net_dhcpv4_start(struct net_if *iface)
 		 */
 		iface->config.dhcpv4.xid = entropy;
 
+		if (dhcpv4_lease_load(iface)) {
+			/* RFC2131 3.2, the previous lease is known so
+			 * skip the discovery and request the remembered
+			 * address right away.
+			 */
+			iface->config.dhcpv4.state = NET_DHCPV4_INIT_REBOOT;
+			timeout = 0U;
+		} else {
+			iface->config.dhcpv4.state = NET_DHCPV4_INIT;
+
+			/* RFC2131 4.1.1 requires we wait a random period
+			 * between 1 and 10 seconds before sending the initial
+			 * discover.
+			 */
+			timeout = entropy %
+					(CONFIG_NET_DHCPV4_INITIAL_DELAY_MAX -
+					  DHCPV4_INITIAL_DELAY_MIN) +
+					DHCPV4_INITIAL_DELAY_MIN;
+		}
 
-		/* RFC2131 4.1.1 requires we wait a random period
-		 * between 1 and 10 seconds before sending the initial
-		 * discover.
-		 */
-		timeout = entropy %
-				(CONFIG_NET_DHCPV4_INITIAL_DELAY_MAX -
-				  DHCPV4_INITIAL_DELAY_MIN) +
-				DHCPV4_INITIAL_DELAY_MIN;
+		NET_DBG("iface %p state=%s", iface,
+			net_dhcpv4_state_name(iface->config.dhcpv4.state));
 
 		NET_DBG("wait timeout=%us", timeout);
 
@@ -1142,6 +1332,7 @@ void net_dhcpv4_start(struct net_if *iface)
 
 		break;
 	case NET_DHCPV4_INIT:
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_SELECTING:
 	case NET_DHCPV4_REQUESTING:
 	case NET_DHCPV4_RENEWING:
@@ -1166,6 +1357,7 @@ void net_dhcpv4_stop(struct net_if *iface)
 
 		__fallthrough;
 	case NET_DHCPV4_INIT:
+	case NET_DHCPV4_INIT_REBOOT:
 	case NET_DHCPV4_SELECTING:
 	case NET_DHCPV4_REQUESTING:
 	case NET_DHCPV4_REBINDING:
@@ -106,6 +106,12 @@ enum dhcpv4_msg_type {
  */
 #define DHCPV4_MAX_NUMBER_OF_ATTEMPTS	3
 
+/* Maximum number of INIT-REBOOT REQUEST retransmits before falling
+ * back to DISCOVER. Kept short as the whole point of INIT-REBOOT is a
+ * fast time to bind; the old lease is likely stale if nobody answers.
+ */
+#define DHCPV4_INIT_REBOOT_MAX_ATTEMPTS	2
+
 /* Initial message retry timeout (s).  This timeout increases
  * exponentially on each retransmit.
  * RFC2131 4.1
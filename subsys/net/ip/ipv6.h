@@ -83,6 +83,9 @@ struct net_ipv6_nbr_data {
 	/** Any pending packet waiting ND to finish. */
 	struct net_pkt *pending;
 
+	/** Node in the neighbor hash bucket the entry is indexed by. */
+	sys_snode_t hash_node;
+
 	/** IPv6 address. */
 	struct in6_addr addr;
 
@@ -404,6 +407,9 @@ struct net_ipv6_reassembly {
 	 */
 	struct k_delayed_work timer;
 
+	/** Node in the reassembly hash bucket the slot is indexed by */
+	sys_snode_t hash_node;
+
 	/** Pointers to pending fragments */
 	struct net_pkt *pkt[NET_IPV6_FRAGMENTS_MAX_PKT];
 
@@ -46,6 +46,45 @@ static bool reassembly_init_done;
 static struct net_ipv6_reassembly
 reassembly[CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT];
 
+/* Active reassembly slots are indexed by a hash over (src, dst, id) so
+ * that the lookup done for every received fragment does not need to
+ * compare the addresses of every slot.
+ */
+#define FRAG_HASH_BUCKETS 4
+
+static sys_slist_t frag_hash[FRAG_HASH_BUCKETS];
+
+/* How many network packets the reassembly slots are currently holding.
+ * The budget keeps a fragment flood from tying up the whole RX packet
+ * pool until the reassembly timeouts expire.
+ */
+static int reass_pkt_count;
+
+static uint32_t frag_hash_bucket(const struct in6_addr *src,
+				 const struct in6_addr *dst,
+				 uint32_t id)
+{
+	uint32_t hash = id;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		hash ^= UNALIGNED_GET(&src->s6_addr32[i]);
+		hash ^= UNALIGNED_GET(&dst->s6_addr32[i]);
+	}
+
+	hash ^= hash >> 16;
+
+	return hash & (FRAG_HASH_BUCKETS - 1);
+}
+
+static void frag_hash_remove(struct net_ipv6_reassembly *reass)
+{
+	(void)sys_slist_find_and_remove(
+		&frag_hash[frag_hash_bucket(&reass->src, &reass->dst,
+					    reass->id)],
+		&reass->hash_node);
+}
+
 int net_ipv6_find_last_ext_hdr(struct net_pkt *pkt, uint16_t *next_hdr_off,
 			       uint16_t *last_hdr_off)
 {
@@ -124,23 +163,22 @@ static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 						  struct in6_addr *src,
 						  struct in6_addr *dst)
 {
+	sys_slist_t *bucket = &frag_hash[frag_hash_bucket(src, dst, id)];
+	struct net_ipv6_reassembly *reass;
 	int i, avail = -1;
 
-	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-
-		if (k_delayed_work_remaining_get(&reassembly[i].timer) &&
-		    reassembly[i].id == id &&
-		    net_ipv6_addr_cmp(src, &reassembly[i].src) &&
-		    net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
-			return &reassembly[i];
-		}
-
-		if (k_delayed_work_remaining_get(&reassembly[i].timer)) {
-			continue;
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, reass, hash_node) {
+		if (reass->id == id &&
+		    net_ipv6_addr_cmp(src, &reass->src) &&
+		    net_ipv6_addr_cmp(dst, &reass->dst)) {
+			return reass;
 		}
+	}
 
-		if (avail < 0) {
+	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
+		if (!k_delayed_work_remaining_get(&reassembly[i].timer)) {
 			avail = i;
+			break;
 		}
 	}
 
@@ -148,6 +186,11 @@ static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 		return NULL;
 	}
 
+	/* The slot might still be in a bucket if its timer expired but
+	 * the timeout handler has not run yet.
+	 */
+	frag_hash_remove(&reassembly[avail]);
+
 	k_delayed_work_submit(&reassembly[avail].timer,
 			      IPV6_REASSEMBLY_TIMEOUT);
 
@@ -156,6 +199,8 @@ static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 
 	reassembly[avail].id = id;
 
+	sys_slist_append(bucket, &reassembly[avail].hash_node);
+
 	return &reassembly[avail];
 }
 
@@ -163,40 +208,45 @@ static bool reassembly_cancel(uint32_t id,
 			      struct in6_addr *src,
 			      struct in6_addr *dst)
 {
-	int i, j;
+	sys_slist_t *bucket = &frag_hash[frag_hash_bucket(src, dst, id)];
+	struct net_ipv6_reassembly *reass;
+	int j;
 
 	NET_DBG("Cancel 0x%x", id);
 
-	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, reass, hash_node) {
 		int32_t remaining;
 
-		if (reassembly[i].id != id ||
-		    !net_ipv6_addr_cmp(src, &reassembly[i].src) ||
-		    !net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
+		if (reass->id != id ||
+		    !net_ipv6_addr_cmp(src, &reass->src) ||
+		    !net_ipv6_addr_cmp(dst, &reass->dst)) {
 			continue;
 		}
 
-		remaining = k_delayed_work_remaining_get(&reassembly[i].timer);
+		sys_slist_find_and_remove(bucket, &reass->hash_node);
+
+		remaining = k_delayed_work_remaining_get(&reass->timer);
 		if (remaining) {
-			k_delayed_work_cancel(&reassembly[i].timer);
+			k_delayed_work_cancel(&reass->timer);
 		}
 
 		NET_DBG("IPv6 reassembly id 0x%x remaining %d ms",
-			reassembly[i].id, remaining);
+			reass->id, remaining);
 
-		reassembly[i].id = 0U;
+		reass->id = 0U;
 
 		for (j = 0; j < NET_IPV6_FRAGMENTS_MAX_PKT; j++) {
-			if (!reassembly[i].pkt[j]) {
+			if (!reass->pkt[j]) {
 				continue;
 			}
 
 			NET_DBG("[%d] IPv6 reassembly pkt %p %zd bytes data",
-				j, reassembly[i].pkt[j],
-				net_pkt_get_len(reassembly[i].pkt[j]));
+				j, reass->pkt[j],
+				net_pkt_get_len(reass->pkt[j]));
 
-			net_pkt_unref(reassembly[i].pkt[j]);
-			reassembly[i].pkt[j] = NULL;
+			net_pkt_unref(reass->pkt[j]);
+			reass->pkt[j] = NULL;
+			reass_pkt_count--;
 		}
 
 		return true;
@@ -274,12 +324,16 @@ static void reassemble_packet(struct net_ipv6_reassembly *reass)
 
 		pkt->buffer = NULL;
 		reass->pkt[i] = NULL;
+		reass_pkt_count--;
 
 		net_pkt_unref(pkt);
 	}
 
+	frag_hash_remove(reass);
+
 	pkt = reass->pkt[0];
 	reass->pkt[0] = NULL;
+	reass_pkt_count--;
 
 	/* Next we need to strip away the fragment header from the first packet
 	 * and set the various pointers and values in packet.
@@ -458,6 +512,11 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		goto drop;
 	}
 
+	if (reass_pkt_count >= CONFIG_NET_IPV6_FRAGMENT_MAX_PKT_COUNT) {
+		NET_DBG("Reassembly pkt budget used, dropping pkt %p", pkt);
+		goto drop;
+	}
+
 	reass = reassembly_get(id, &hdr->src, &hdr->dst);
 	if (!reass) {
 		NET_DBG("Cannot get reassembly slot, dropping pkt %p", pkt);
@@ -471,6 +530,7 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		NET_DBG("Storing pkt %p to slot %d offset %d",
 			pkt, 0, net_pkt_ipv6_fragment_offset(pkt));
 		reass->pkt[0] = pkt;
+		reass_pkt_count++;
 
 		reassembly_info("Reassembly 1st pkt", reass);
 
@@ -499,6 +559,7 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		NET_DBG("Storing pkt %p to slot %d offset %d",
 			pkt, i, net_pkt_ipv6_fragment_offset(pkt));
 		reass->pkt[i] = pkt;
+		reass_pkt_count++;
 		found = true;
 
 		break;
@@ -538,6 +599,7 @@ enum net_verdict net_ipv6_handle_fragment_hdr(struct net_pkt *pkt,
 		/* Let the caller release the already inserted pkt */
 		if (i < NET_IPV6_FRAGMENTS_MAX_PKT) {
 			reass->pkt[i] = NULL;
+			reass_pkt_count--;
 		}
 
 		net_pkt_unref(pkt);
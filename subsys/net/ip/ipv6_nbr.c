@@ -124,17 +124,46 @@ static inline struct net_nbr *get_nbr(int idx)
 
 static inline struct net_nbr *get_nbr_from_data(struct net_ipv6_nbr_data *data)
 {
-	int i;
+	/* The data area always starts right after the generic neighbor
+	 * header, see NET_NBR_POOL_INIT().
+	 */
+	return (struct net_nbr *)((uint8_t *)data -
+				  offsetof(struct net_nbr, __nbr));
+}
 
-	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
-		struct net_nbr *nbr = get_nbr(i);
+/* The neighbor entries are indexed by the IPv6 address so that the lookup
+ * that is done when resolving the link address of every outgoing packet
+ * stays O(1) when the table grows. Hash collisions and multiple interfaces
+ * are handled by walking the short bucket chain.
+ */
+#define NBR_HASH_BUCKETS 16
 
-		if (nbr->data == (uint8_t *)data) {
-			return nbr;
-		}
-	}
+static sys_slist_t nbr_hash[NBR_HASH_BUCKETS];
 
-	return NULL;
+static sys_slist_t *nbr_hash_bucket(const struct in6_addr *addr)
+{
+	uint32_t hash;
+
+	hash = UNALIGNED_GET(&addr->s6_addr32[0]) ^
+	       UNALIGNED_GET(&addr->s6_addr32[1]) ^
+	       UNALIGNED_GET(&addr->s6_addr32[2]) ^
+	       UNALIGNED_GET(&addr->s6_addr32[3]);
+	hash ^= hash >> 16;
+
+	return &nbr_hash[hash & (NBR_HASH_BUCKETS - 1)];
+}
+
+static void nbr_hash_add(struct net_nbr *nbr)
+{
+	sys_slist_append(nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr),
+			 &net_ipv6_nbr_data(nbr)->hash_node);
+}
+
+static void nbr_hash_remove(struct net_nbr *nbr)
+{
+	(void)sys_slist_find_and_remove(
+		nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr),
+		&net_ipv6_nbr_data(nbr)->hash_node);
 }
 
 static void ipv6_nbr_set_state(struct net_nbr *nbr,
@@ -259,10 +288,13 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
-	int i;
+	sys_slist_t *bucket = nbr_hash_bucket(addr);
+	struct net_ipv6_nbr_data *data;
 
-	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
-		struct net_nbr *nbr = get_nbr(i);
+	ARG_UNUSED(table);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, data, hash_node) {
+		struct net_nbr *nbr = get_nbr_from_data(data);
 
 		if (!nbr->ref) {
 			continue;
@@ -272,7 +304,7 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 			continue;
 		}
 
-		if (net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr, addr)) {
+		if (net_ipv6_addr_cmp(&data->addr, addr)) {
 			return nbr;
 		}
 	}
@@ -431,6 +463,8 @@ static struct net_nbr *nbr_new(struct net_if *iface,
 
 	nbr_init(nbr, iface, addr, is_router, state);
 
+	nbr_hash_add(nbr);
+
 	NET_DBG("nbr %p iface %p/%d state %d IPv6 %s",
 		nbr, iface, net_if_get_by_iface(iface), state,
 		log_strdup(net_sprint_ipv6_addr(addr)));
@@ -653,7 +687,7 @@ void net_neighbor_data_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
-	return;
+	nbr_hash_remove(nbr);
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
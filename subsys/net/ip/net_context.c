@@ -936,6 +936,11 @@ int net_context_connect(struct net_context *context,
 		goto unlock;
 	}
 
+	/* The remote endpoint is about to change so any cached header
+	 * template built for the old peer is stale.
+	 */
+	net_context_udp_hdr_cache_invalidate(context);
+
 	if (IS_ENABLED(CONFIG_NET_IPV6) &&
 	    net_context_get_family(context) == AF_INET6) {
 		struct sockaddr_in6 *addr6 = (struct sockaddr_in6 *)
@@ -1207,11 +1212,30 @@ static int get_context_txtime(struct net_context *context,
 #endif
 }
 
+static int get_context_rcvbuf(struct net_context *context,
+			      void *value, size_t *len)
+{
+#if defined(CONFIG_NET_CONTEXT_RCVBUF)
+	*((int *)value) = context->options.rcvbuf;
+
+	if (len) {
+		*len = sizeof(int);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 /* If buf is not NULL, then use it. Otherwise read the data to be written
- * to net_pkt from msghdr.
+ * to net_pkt from msghdr. If chksum is set, the payload sum is folded
+ * into the packet while it is copied so the protocol checksum
+ * finalization does not need to traverse it again.
  */
 static int context_write_data(struct net_pkt *pkt, const void *buf,
-			      int buf_len, const struct msghdr *msghdr)
+			      int buf_len, const struct msghdr *msghdr,
+			      bool chksum)
 {
 	int ret = 0;
 
@@ -1219,12 +1243,19 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 		int i;
 
 		for (i = 0; i < msghdr->msg_iovlen; i++) {
-			ret = net_pkt_write(pkt, msghdr->msg_iov[i].iov_base,
-					    msghdr->msg_iov[i].iov_len);
+			ret = chksum ?
+				net_pkt_write_chksum(
+					pkt, msghdr->msg_iov[i].iov_base,
+					msghdr->msg_iov[i].iov_len) :
+				net_pkt_write(pkt,
+					      msghdr->msg_iov[i].iov_base,
+					      msghdr->msg_iov[i].iov_len);
 			if (ret < 0) {
 				break;
 			}
 		}
+	} else if (chksum) {
+		ret = net_pkt_write_chksum(pkt, buf, buf_len);
 	} else {
 		ret = net_pkt_write(pkt, buf, buf_len);
 	}
@@ -1243,6 +1274,32 @@ static int context_setup_udp_packet(struct net_context *context,
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_CACHE)
+	if (context->udp_hdr_cache.len > 0U &&
+	    dst_addr == (const struct sockaddr *)&context->remote) {
+		/* Connected-socket fast path: replay the header template
+		 * cached by a previous send to the same peer. Length
+		 * fields and checksums are patched when the packet is
+		 * finalized.
+		 */
+		ret = net_pkt_write(pkt, context->udp_hdr_cache.data,
+				    context->udp_hdr_cache.len);
+		if (ret < 0) {
+			return ret;
+		}
+
+		net_pkt_set_ip_hdr_len(pkt, context->udp_hdr_cache.len -
+					    NET_UDPH_LEN);
+
+		if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		    net_context_get_family(context) == AF_INET6) {
+			net_pkt_set_ipv6_ext_len(pkt, 0);
+		}
+
+		goto payload;
+	}
+#endif /* CONFIG_NET_CONTEXT_UDP_HDR_CACHE */
+
 	if (IS_ENABLED(CONFIG_NET_IPV6) &&
 	    net_context_get_family(context) == AF_INET6) {
 		struct sockaddr_in6 *addr6 = (struct sockaddr_in6 *)dst_addr;
@@ -1278,7 +1335,40 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
-	ret = context_write_data(pkt, buf, len, msg);
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_CACHE)
+	if (dst_addr == (const struct sockaddr *)&context->remote) {
+		/* Sending to the connected peer: remember the headers we
+		 * just built so that the next datagram can replay them.
+		 */
+		struct net_pkt_cursor backup;
+		uint16_t hdr_len = net_pkt_ip_hdr_len(pkt) + NET_UDPH_LEN;
+
+		net_pkt_cursor_backup(pkt, &backup);
+		net_pkt_cursor_init(pkt);
+		net_pkt_set_overwrite(pkt, true);
+
+		if (net_pkt_read(pkt, context->udp_hdr_cache.data,
+				 hdr_len) == 0) {
+			context->udp_hdr_cache.len = hdr_len;
+		}
+
+		net_pkt_set_overwrite(pkt, false);
+		net_pkt_cursor_restore(pkt, &backup);
+	}
+
+payload:
+#endif /* CONFIG_NET_CONTEXT_UDP_HDR_CACHE */
+
+	if (!buf && !msg) {
+		/* The payload buffer is appended by the caller */
+		return 0;
+	}
+
+	/* UDP finalizes its checksum directly from the cached payload
+	 * sum; TCP queues the data and checksums each segment separately
+	 * when it is sent, so the fold would only be thrown away there.
+	 */
+	ret = context_write_data(pkt, buf, len, msg, true);
 	if (ret) {
 		return ret;
 	}
@@ -1366,9 +1456,12 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  struct net_buf *loan)
 {
 	const struct msghdr *msghdr = NULL;
+	struct net_buf *loan_prev = NULL;
+	bool loan_attached = false;
 	struct net_pkt *pkt;
 	size_t tmp_len;
 	int ret;
@@ -1543,15 +1636,40 @@ static int context_sendto(struct net_context *context,
 		}
 	}
 
-	pkt = context_alloc_pkt(context, len, PKT_WAIT_TIME);
+	if (loan) {
+		len = net_buf_frags_len(loan);
+
+		/* The loaned payload is sent as is, so it must fit into
+		 * one datagram.
+		 */
+		if (IS_ENABLED(CONFIG_NET_UDP) &&
+		    net_context_get_ip_proto(context) == IPPROTO_UDP) {
+			size_t hdr_len;
+
+			if (net_context_get_family(context) == AF_INET6) {
+				hdr_len = NET_IPV6UDPH_LEN;
+			} else {
+				hdr_len = NET_IPV4UDPH_LEN;
+			}
+
+			if (len + hdr_len >
+			    net_if_get_mtu(net_context_get_iface(context))) {
+				return -EMSGSIZE;
+			}
+		}
+	}
+
+	pkt = context_alloc_pkt(context, loan ? 0 : len, PKT_WAIT_TIME);
 	if (!pkt) {
 		return -ENOBUFS;
 	}
 
-	tmp_len = net_pkt_available_payload_buffer(
-				pkt, net_context_get_ip_proto(context));
-	if (tmp_len < len) {
-		len = tmp_len;
+	if (!loan) {
+		tmp_len = net_pkt_available_payload_buffer(
+					pkt, net_context_get_ip_proto(context));
+		if (tmp_len < len) {
+			len = tmp_len;
+		}
 	}
 
 	context->send_cb = cb;
@@ -1610,7 +1728,12 @@ static int context_sendto(struct net_context *context,
 
 	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
 	    net_if_is_ip_offloaded(net_context_get_iface(context))) {
-		ret = context_write_data(pkt, buf, len, msghdr);
+		if (loan) {
+			ret = -EOPNOTSUPP;
+			goto fail;
+		}
+
+		ret = context_write_data(pkt, buf, len, msghdr, false);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1627,21 +1750,38 @@ static int context_sendto(struct net_context *context,
 		}
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_ip_proto(context) == IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, pkt, buf, len, msghdr,
+		ret = context_setup_udp_packet(context, pkt,
+					       loan ? NULL : buf,
+					       loan ? 0 : len, msghdr,
 					       dst_addr, addrlen);
 		if (ret < 0) {
 			goto fail;
 		}
 
+		if (loan) {
+			loan_prev = net_buf_frag_last(pkt->buffer);
+			net_pkt_append_buffer(pkt, loan);
+			loan_attached = true;
+		}
+
 		context_finalize_packet(context, pkt);
 
 		ret = net_send_data(pkt);
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_ip_proto(context) == IPPROTO_TCP) {
 
-		ret = context_write_data(pkt, buf, len, msghdr);
-		if (ret < 0) {
-			goto fail;
+		if (loan) {
+			/* Drop the empty header buffer so that only the
+			 * loaned chain gets queued.
+			 */
+			net_pkt_trim_buffer(pkt);
+			net_pkt_append_buffer(pkt, loan);
+			loan_attached = true;
+		} else {
+			ret = context_write_data(pkt, buf, len, msghdr, false);
+			if (ret < 0) {
+				goto fail;
+			}
 		}
 
 		net_pkt_cursor_init(pkt);
@@ -1653,7 +1793,7 @@ static int context_sendto(struct net_context *context,
 		ret = net_tcp_send_data(context, cb, user_data);
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_PACKET) &&
 		   net_context_get_family(context) == AF_PACKET) {
-		ret = context_write_data(pkt, buf, len, msghdr);
+		ret = context_write_data(pkt, buf, len, msghdr, false);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1664,7 +1804,7 @@ static int context_sendto(struct net_context *context,
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) &&
 		   net_context_get_family(context) == AF_CAN &&
 		   net_context_get_ip_proto(context) == CAN_RAW) {
-		ret = context_write_data(pkt, buf, len, msghdr);
+		ret = context_write_data(pkt, buf, len, msghdr, false);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -1684,6 +1824,18 @@ static int context_sendto(struct net_context *context,
 
 	return len;
 fail:
+	if (loan_attached) {
+		/* Detach the loaned buffer so that it stays with the
+		 * caller; net_tcp_queue_data() restores it to the pkt
+		 * when it could not queue the data.
+		 */
+		if (loan_prev) {
+			loan_prev->frags = NULL;
+		} else {
+			pkt->buffer = NULL;
+		}
+	}
+
 	net_pkt_unref(pkt);
 
 	return ret;
@@ -1725,7 +1877,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false, NULL);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -1744,7 +1896,7 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
 
 	k_mutex_unlock(&context->lock);
 
@@ -1765,13 +1917,157 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
 
 	k_mutex_unlock(&context->lock);
 
 	return ret;
 }
 
+#if defined(CONFIG_NET_CONTEXT_SENDBUF)
+int net_context_send_buf(struct net_context *context,
+			 struct net_buf *buffer,
+			 net_context_send_cb_t cb,
+			 k_timeout_t timeout,
+			 void *user_data)
+{
+	socklen_t addrlen;
+	int ret;
+
+	if (!buffer) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+	    !net_sin(&context->remote)->sin_port) {
+		ret = -EDESTADDRREQ;
+		goto unlock;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) &&
+	    net_context_get_family(context) == AF_INET6) {
+		addrlen = sizeof(struct sockaddr_in6);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   net_context_get_family(context) == AF_INET) {
+		addrlen = sizeof(struct sockaddr_in);
+	} else {
+		ret = -EOPNOTSUPP;
+		goto unlock;
+	}
+
+	ret = context_sendto(context, NULL, 0, &context->remote,
+			     addrlen, cb, timeout, user_data, false, buffer);
+unlock:
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_CONTEXT_SENDBUF */
+
+#if defined(CONFIG_NET_CONTEXT_SPLICE)
+static void context_splice_cb(struct net_context *context,
+			      struct net_pkt *pkt,
+			      union net_ip_header *ip_hdr,
+			      union net_proto_header *proto_hdr,
+			      int status,
+			      void *user_data)
+{
+	struct net_context *peer = user_data;
+	struct net_buf *buffer;
+	size_t hdr_len;
+	int ret;
+
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+
+	if (!pkt) {
+		/* Connection closed or error, nothing to forward. The
+		 * application owning the contexts notices this when it
+		 * closes or polls them, we just stop forwarding.
+		 */
+		return;
+	}
+
+	/* The cursor is at the payload, everything before it is protocol
+	 * headers that must not be loaned onwards.
+	 */
+	hdr_len = net_pkt_get_current_offset(pkt);
+
+	net_pkt_cursor_init(pkt);
+
+	if (hdr_len > 0 && net_pkt_pull(pkt, hdr_len)) {
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	buffer = pkt->buffer;
+	if (!buffer || net_buf_frags_len(buffer) == 0) {
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	ret = net_context_send_buf(peer, buffer, NULL, K_NO_WAIT, NULL);
+	if (ret < 0) {
+		/* Forwarding is best effort: for TCP the remote end
+		 * retransmits what we could not queue.
+		 */
+		NET_DBG("Cannot forward spliced data to context %p (%d)",
+			peer, ret);
+		net_buf_unref(buffer);
+	}
+}
+
+int net_context_splice(struct net_context *ctx_a, struct net_context *ctx_b)
+{
+	int ret;
+
+	if (!ctx_a || !ctx_b) {
+		return -EINVAL;
+	}
+
+	if (!net_context_is_used(ctx_a) || !net_context_is_used(ctx_b)) {
+		return -EBADF;
+	}
+
+	ret = net_context_recv(ctx_a, context_splice_cb, K_NO_WAIT, ctx_b);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = net_context_recv(ctx_b, context_splice_cb, K_NO_WAIT, ctx_a);
+	if (ret < 0) {
+		(void)net_context_unsplice(ctx_a);
+		return ret;
+	}
+
+	return 0;
+}
+
+int net_context_unsplice(struct net_context *context)
+{
+	if (!context || !net_context_is_used(context)) {
+		return -EBADF;
+	}
+
+	if (context->recv_cb != context_splice_cb) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	context->recv_cb = NULL;
+
+	k_mutex_unlock(&context->lock);
+
+	return 0;
+}
+#endif /* CONFIG_NET_CONTEXT_SPLICE */
+
 enum net_verdict net_context_packet_received(struct net_conn *conn,
 					     struct net_pkt *pkt,
 					     union net_ip_header *ip_hdr,
@@ -1799,6 +2095,20 @@ enum net_verdict net_context_packet_received(struct net_conn *conn,
 	if (net_context_get_ip_proto(context) == IPPROTO_TCP) {
 		net_stats_update_tcp_recv(net_pkt_iface(pkt),
 					  net_pkt_remaining_data(pkt));
+	} else if (net_context_get_type(context) == SOCK_DGRAM &&
+		   (net_context_get_family(context) == AF_INET ||
+		    net_context_get_family(context) == AF_INET6)) {
+		/* A per-context receive buffer limit (SO_RCVBUF) bounds
+		 * how much data may sit unread on the receive queue;
+		 * beyond it the datagram is dropped here, at demux time,
+		 * before it ties up more buffer pool space.
+		 */
+		if (!net_context_rcvbuf_charge(context,
+					       net_pkt_remaining_data(pkt))) {
+			NET_DBG("Context %p receive buffer full, pkt %p "
+				"dropped", context, pkt);
+			goto unlock;
+		}
 	}
 
 #if defined(CONFIG_NET_CONTEXT_SYNC_RECV)
@@ -2119,6 +2429,32 @@ static int set_context_txtime(struct net_context *context,
 #endif
 }
 
+static int set_context_rcvbuf(struct net_context *context,
+			      const void *value, size_t len)
+{
+#if defined(CONFIG_NET_CONTEXT_RCVBUF)
+	int rcvbuf_value = *((int *)value);
+
+	if (len != sizeof(int) || rcvbuf_value < 0) {
+		return -EINVAL;
+	}
+
+	context->options.rcvbuf = rcvbuf_value;
+
+	if (IS_ENABLED(CONFIG_NET_TCP) && rcvbuf_value > 0 &&
+	    net_context_get_ip_proto(context) == IPPROTO_TCP) {
+		/* Apply the new budget as the upper bound of the
+		 * advertised receive window right away.
+		 */
+		(void)net_tcp_update_recv_wnd(context, 0);
+	}
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
 static int set_context_proxy(struct net_context *context,
 			     const void *value, size_t len)
 {
@@ -2169,6 +2505,9 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_SOCKS5:
 		ret = set_context_proxy(context, value, len);
 		break;
+	case NET_OPT_RCVBUF:
+		ret = set_context_rcvbuf(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -2203,6 +2542,9 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_SOCKS5:
 		ret = get_context_proxy(context, value, len);
 		break;
+	case NET_OPT_RCVBUF:
+		ret = get_context_rcvbuf(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -54,6 +54,7 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include "ipv4_autoconf_internal.h"
 
 #include "net_stats.h"
+#include "net_tap.h"
 
 static inline enum net_verdict process_data(struct net_pkt *pkt,
 					    bool is_loopback)
@@ -300,6 +301,8 @@ int net_send_data(struct net_pkt *pkt)
 	net_pkt_trim_buffer(pkt);
 	net_pkt_cursor_init(pkt);
 
+	net_tap_record(pkt, true);
+
 	status = check_ip_addr(pkt);
 	if (status < 0) {
 		return status;
@@ -330,6 +333,8 @@ static void net_rx(struct net_if *iface, struct net_pkt *pkt)
 
 	net_stats_update_bytes_recv(iface, pkt_len);
 
+	net_tap_record(pkt, false);
+
 	if (IS_ENABLED(CONFIG_NET_LOOPBACK)) {
 #ifdef CONFIG_NET_L2_DUMMY
 		if (net_if_l2(iface) == &NET_L2_GET_NAME(DUMMY)) {
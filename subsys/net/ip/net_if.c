@@ -21,6 +21,7 @@ LOG_MODULE_REGISTER(net_if, CONFIG_NET_IF_LOG_LEVEL);
 #include <net/ethernet.h>
 
 #include "net_private.h"
+#include "tcp_internal.h"
 #include "ipv6.h"
 #include "ipv4_autoconf_internal.h"
 
@@ -348,6 +349,11 @@ static void process_tx_packet(struct k_work *work)
 {
 	struct net_if *iface;
 	struct net_pkt *pkt;
+#if defined(CONFIG_NET_TC_TX_BATCH)
+	int budget = CONFIG_NET_TC_TX_BATCH_COUNT;
+	struct net_pkt *next;
+	uint8_t tc;
+#endif
 
 	pkt = CONTAINER_OF(work, struct net_pkt, work);
 
@@ -355,11 +361,42 @@ static void process_tx_packet(struct k_work *work)
 
 	iface = net_pkt_iface(pkt);
 
+#if defined(CONFIG_NET_TC_TX_BATCH)
+	tc = net_tx_priority2tc(net_pkt_priority(pkt));
+
+	while (pkt) {
+		if (--budget > 0) {
+			next = net_tc_try_dequeue_tx(tc);
+		} else {
+			next = NULL;
+		}
+
+		/* Hint to the driver that it can chain this packet and
+		 * postpone kicking the hardware, as the next packet in
+		 * the batch goes to the same interface.
+		 */
+		net_pkt_set_tx_more(pkt, next != NULL &&
+				    net_pkt_iface(next) == iface);
+
+		net_if_tx(iface, pkt);
+
+#if defined(CONFIG_NET_POWER_MANAGEMENT)
+		iface->tx_pending--;
+#endif
+
+		pkt = next;
+		if (pkt) {
+			net_pkt_set_tx_stats_tick(pkt, k_cycle_get_32());
+			iface = net_pkt_iface(pkt);
+		}
+	}
+#else
 	net_if_tx(iface, pkt);
 
 #if defined(CONFIG_NET_POWER_MANAGEMENT)
 	iface->tx_pending--;
 #endif
+#endif /* CONFIG_NET_TC_TX_BATCH */
 }
 
 void net_if_queue_tx(struct net_if *iface, struct net_pkt *pkt)
@@ -411,6 +448,38 @@ void net_if_stats_reset_all(void)
 #endif
 }
 
+/* Worst-case header space a TX packet on this interface may need: L2
+ * header plus the largest L3/L4 combination the enabled protocols can
+ * prepend. Resolved once here so the allocation path can use a cached
+ * value instead of estimating per packet.
+ */
+static uint16_t iface_tx_headroom(struct net_if *iface)
+{
+	uint16_t headroom = 0U;
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		headroom += sizeof(struct net_eth_hdr);
+	}
+#endif
+
+	if (IS_ENABLED(CONFIG_NET_IPV6)) {
+		headroom += NET_IPV6H_LEN;
+	} else if (IS_ENABLED(CONFIG_NET_IPV4)) {
+		headroom += NET_IPV4H_LEN;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP)) {
+		headroom += NET_TCPH_LEN + NET_TCP_MAX_OPT_SIZE;
+	} else if (IS_ENABLED(CONFIG_NET_UDP)) {
+		headroom += NET_UDPH_LEN;
+	} else {
+		headroom += NET_ICMPH_LEN;
+	}
+
+	return headroom;
+}
+
 static inline void init_iface(struct net_if *iface)
 {
 	const struct net_if_api *api = net_if_get_device(iface)->api;
@@ -426,6 +495,8 @@ static inline void init_iface(struct net_if *iface)
 	z_object_init(iface);
 #endif
 
+	net_if_set_tx_headroom(iface, iface_tx_headroom(iface));
+
 	api->init(iface);
 }
 
@@ -531,6 +602,19 @@ struct net_if *net_if_lookup_by_dev(const struct device *dev)
 	return NULL;
 }
 
+static struct net_if *default_iface_override;
+
+int net_if_set_default(struct net_if *iface)
+{
+	if (iface && net_if_get_by_iface(iface) < 0) {
+		return -EINVAL;
+	}
+
+	default_iface_override = iface;
+
+	return 0;
+}
+
 struct net_if *net_if_get_default(void)
 {
 	struct net_if *iface = NULL;
@@ -539,6 +623,10 @@ struct net_if *net_if_get_default(void)
 		return NULL;
 	}
 
+	if (default_iface_override) {
+		return default_iface_override;
+	}
+
 #if defined(CONFIG_NET_DEFAULT_IF_ETHERNET)
 	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(ETHERNET));
 #endif
@@ -3506,27 +3594,31 @@ void net_if_call_link_cb(struct net_if *iface, struct net_linkaddr *lladdr,
 	}
 }
 
-static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps)
+/* The offloading capability is cached as an interface flag when the
+ * interface is initialized, querying the driver here per packet would
+ * slow down the TX/RX fast paths. Non-Ethernet interfaces never set
+ * the flags so they always calculate the checksums.
+ */
+static bool need_calc_checksum(struct net_if *iface, enum net_if_flag flag)
 {
 #if defined(CONFIG_NET_L2_ETHERNET)
-	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
-		return true;
-	}
-
-	return !(net_eth_get_hw_capabilities(iface) & caps);
+	return !net_if_flag_is_set(iface, flag);
 #else
+	ARG_UNUSED(iface);
+	ARG_UNUSED(flag);
+
 	return true;
 #endif
 }
 
 bool net_if_need_calc_tx_checksum(struct net_if *iface)
 {
-	return need_calc_checksum(iface, ETHERNET_HW_TX_CHKSUM_OFFLOAD);
+	return need_calc_checksum(iface, NET_IF_CHKSUM_OFFLOAD_TX);
 }
 
 bool net_if_need_calc_rx_checksum(struct net_if *iface)
 {
-	return need_calc_checksum(iface, ETHERNET_HW_RX_CHKSUM_OFFLOAD);
+	return need_calc_checksum(iface, NET_IF_CHKSUM_OFFLOAD_RX);
 }
 
 int net_if_get_by_iface(struct net_if *iface)
@@ -3747,8 +3839,14 @@ static void net_tx_ts_thread(void)
 
 	while (1) {
 		pkt = k_fifo_get(&tx_ts_queue, K_FOREVER);
-		if (pkt) {
+
+		/* Drain the queue before yielding the CPU so that a burst
+		 * of timestamp events is handled in one scheduling pass.
+		 */
+		while (pkt) {
 			net_if_call_timestamp_cb(pkt);
+
+			pkt = k_fifo_get(&tx_ts_queue, K_NO_WAIT);
 		}
 	}
 }
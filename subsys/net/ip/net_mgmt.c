@@ -39,8 +39,21 @@ static K_SEM_DEFINE(net_mgmt_lock, 1, 1);
 K_KERNEL_STACK_DEFINE(mgmt_stack, CONFIG_NET_MGMT_EVENT_STACK_SIZE);
 static struct k_thread mgmt_thread_data;
 static struct mgmt_event_entry events[CONFIG_NET_MGMT_EVENT_QUEUE_SIZE];
-static uint32_t global_event_mask;
-static sys_slist_t event_callbacks;
+
+/* Callbacks are bucketed by the layer of their event mask, as a callback
+ * can only ever match events of that one layer. This way high-rate events
+ * do not scan handlers registered for unrelated layers. The layer field
+ * is two bits wide, hence four buckets.
+ */
+#define NUM_LAYERS 4
+
+static uint32_t global_event_mask[NUM_LAYERS];
+static sys_slist_t event_callbacks[NUM_LAYERS];
+
+static inline sys_slist_t *get_layer_callbacks(uint32_t mgmt_event)
+{
+	return &event_callbacks[NET_MGMT_GET_LAYER(mgmt_event)];
+}
 static int16_t in_event;
 static int16_t out_event;
 
@@ -129,35 +142,42 @@ static inline void mgmt_clean_event(struct mgmt_event_entry *mgmt_event)
 
 static inline void mgmt_add_event_mask(uint32_t event_mask)
 {
-	global_event_mask |= event_mask;
+	global_event_mask[NET_MGMT_GET_LAYER(event_mask)] |= event_mask;
 }
 
 static inline void mgmt_rebuild_global_event_mask(void)
 {
 	struct net_mgmt_event_callback *cb, *tmp;
+	int layer;
 
-	global_event_mask = 0U;
+	(void)memset(global_event_mask, 0, sizeof(global_event_mask));
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
-		mgmt_add_event_mask(cb->event_mask);
+	for (layer = 0; layer < NUM_LAYERS; layer++) {
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks[layer],
+						  cb, tmp, node) {
+			mgmt_add_event_mask(cb->event_mask);
+		}
 	}
 }
 
 static inline bool mgmt_is_event_handled(uint32_t mgmt_event)
 {
+	uint32_t layer_mask = global_event_mask[NET_MGMT_GET_LAYER(mgmt_event)];
+
 	return (((NET_MGMT_GET_LAYER(mgmt_event) &
-		  NET_MGMT_GET_LAYER(global_event_mask)) ==
+		  NET_MGMT_GET_LAYER(layer_mask)) ==
 		 NET_MGMT_GET_LAYER(mgmt_event)) &&
 		((NET_MGMT_GET_LAYER_CODE(mgmt_event) &
-		  NET_MGMT_GET_LAYER_CODE(global_event_mask)) ==
+		  NET_MGMT_GET_LAYER_CODE(layer_mask)) ==
 		 NET_MGMT_GET_LAYER_CODE(mgmt_event)) &&
 		((NET_MGMT_GET_COMMAND(mgmt_event) &
-		  NET_MGMT_GET_COMMAND(global_event_mask)) ==
+		  NET_MGMT_GET_COMMAND(layer_mask)) ==
 		 NET_MGMT_GET_COMMAND(mgmt_event)));
 }
 
 static inline void mgmt_run_callbacks(struct mgmt_event_entry *mgmt_event)
 {
+	sys_slist_t *callbacks = get_layer_callbacks(mgmt_event->event);
 	sys_snode_t *prev = NULL;
 	struct net_mgmt_event_callback *cb, *tmp;
 
@@ -166,7 +186,7 @@ static inline void mgmt_run_callbacks(struct mgmt_event_entry *mgmt_event)
 		NET_MGMT_GET_LAYER_CODE(mgmt_event->event),
 		NET_MGMT_GET_COMMAND(mgmt_event->event));
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(callbacks, cb, tmp, node) {
 		if (!(NET_MGMT_GET_LAYER(mgmt_event->event) ==
 		      NET_MGMT_GET_LAYER(cb->event_mask)) ||
 		    !(NET_MGMT_GET_LAYER_CODE(mgmt_event->event) ==
@@ -203,7 +223,7 @@ static inline void mgmt_run_callbacks(struct mgmt_event_entry *mgmt_event)
 			cb->raised_event = mgmt_event->event;
 			sync_data->iface = mgmt_event->iface;
 
-			sys_slist_remove(&event_callbacks, prev, &cb->node);
+			sys_slist_remove(callbacks, prev, &cb->node);
 
 			k_sem_give(cb->sync_call);
 		} else {
@@ -314,7 +334,7 @@ void net_mgmt_add_event_callback(struct net_mgmt_event_callback *cb)
 
 	k_sem_take(&net_mgmt_lock, K_FOREVER);
 
-	sys_slist_prepend(&event_callbacks, &cb->node);
+	sys_slist_prepend(get_layer_callbacks(cb->event_mask), &cb->node);
 
 	mgmt_add_event_mask(cb->event_mask);
 
@@ -327,7 +347,8 @@ void net_mgmt_del_event_callback(struct net_mgmt_event_callback *cb)
 
 	k_sem_take(&net_mgmt_lock, K_FOREVER);
 
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
+	sys_slist_find_and_remove(get_layer_callbacks(cb->event_mask),
+				  &cb->node);
 
 	mgmt_rebuild_global_event_mask();
 
@@ -377,8 +398,13 @@ int net_mgmt_event_wait_on_iface(struct net_if *iface,
 
 void net_mgmt_event_init(void)
 {
-	sys_slist_init(&event_callbacks);
-	global_event_mask = 0U;
+	int layer;
+
+	for (layer = 0; layer < NUM_LAYERS; layer++) {
+		sys_slist_init(&event_callbacks[layer]);
+	}
+
+	(void)memset(global_event_mask, 0, sizeof(global_event_mask));
 
 	in_event = -1;
 	out_event = -1;
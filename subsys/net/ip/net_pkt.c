@@ -1123,9 +1123,20 @@ int net_pkt_alloc_buffer(struct net_pkt *pkt,
 		/* In case of no free space, it will account for header
 		 * space estimation
 		 */
-		hdr_len = pkt_estimate_headers_length(pkt,
-						      net_pkt_family(pkt),
-						      proto);
+		if (IS_ENABLED(CONFIG_NET_PKT_TX_HEADROOM) &&
+		    (net_pkt_iface(pkt) != NULL) &&
+		    (net_pkt_family(pkt) != AF_UNSPEC)) {
+			/* Use the worst-case header space resolved at
+			 * interface init, so later header insertion can
+			 * never run out of room and chain in more buffers.
+			 */
+			hdr_len = net_if_get_tx_headroom(net_pkt_iface(pkt));
+		} else {
+			hdr_len = pkt_estimate_headers_length(
+							pkt,
+							net_pkt_family(pkt),
+							proto);
+		}
 	}
 
 	/* Calculate the maximum that can be allocated depending on size */
@@ -1469,6 +1480,37 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer(struct net_if *iface,
 #endif
 }
 
+#if NET_LOG_LEVEL >= LOG_LEVEL_DBG
+struct net_pkt *net_pkt_rx_alloc_from_buffer_debug(struct net_if *iface,
+						   struct net_buf *buffer,
+						   k_timeout_t timeout,
+						   const char *caller,
+						   int line)
+#else
+struct net_pkt *net_pkt_rx_alloc_from_buffer(struct net_if *iface,
+					     struct net_buf *buffer,
+					     k_timeout_t timeout)
+#endif
+{
+	struct net_pkt *pkt;
+
+	NET_ASSERT(buffer);
+
+#if NET_LOG_LEVEL >= LOG_LEVEL_DBG
+	pkt = pkt_alloc_on_iface(&rx_pkts, iface, timeout, caller, line);
+#else
+	pkt = pkt_alloc_on_iface(&rx_pkts, iface, timeout);
+#endif
+
+	if (!pkt) {
+		return NULL;
+	}
+
+	net_pkt_append_buffer(pkt, buffer);
+
+	return pkt;
+}
+
 void net_pkt_append_buffer(struct net_pkt *pkt, struct net_buf *buffer)
 {
 	if (!pkt->buffer) {
@@ -1675,13 +1717,40 @@ int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length)
 	return net_pkt_cursor_operate(pkt, (void *)data, length, true, true);
 }
 
-int net_pkt_copy(struct net_pkt *pkt_dst,
-		 struct net_pkt *pkt_src,
-		 size_t length)
+#if defined(CONFIG_NET_PKT_TX_CHKSUM_CACHE)
+/* Append a chunk's one's complement sum to the cached payload sum.
+ * Each chunk is summed as if it started on an even offset: when the
+ * cached stream is odd so far, the chunk's octets land in the opposite
+ * lanes and its sum is byte swapped to match.
+ */
+static void pkt_chksum_fold(struct net_pkt *pkt, uint16_t chunk, size_t length)
+{
+	uint16_t sum = net_pkt_tx_chksum(pkt);
+
+	if (net_pkt_tx_chksum_len(pkt) % 2) {
+		chunk = (chunk >> 8) | (chunk << 8);
+	}
+
+	sum += chunk;
+	if (sum < chunk) {
+		sum++;
+	}
+
+	net_pkt_set_tx_chksum(pkt, sum, net_pkt_tx_chksum_len(pkt) + length);
+}
+#endif /* CONFIG_NET_PKT_TX_CHKSUM_CACHE */
+
+static int pkt_copy(struct net_pkt *pkt_dst,
+		    struct net_pkt *pkt_src,
+		    size_t length, bool chksum)
 {
 	struct net_pkt_cursor *c_dst = &pkt_dst->cursor;
 	struct net_pkt_cursor *c_src = &pkt_src->cursor;
 
+#if !defined(CONFIG_NET_PKT_TX_CHKSUM_CACHE)
+	ARG_UNUSED(chksum);
+#endif
+
 	while (c_dst->buf && c_src->buf && length) {
 		size_t s_len, d_len, len;
 
@@ -1710,6 +1779,19 @@ int net_pkt_copy(struct net_pkt *pkt_dst,
 
 		memcpy(c_dst->pos, c_src->pos, len);
 
+#if defined(CONFIG_NET_PKT_TX_CHKSUM_CACHE)
+		if (chksum) {
+			/* The freshly written bytes are still hot in the
+			 * data cache, so summing them here costs only one
+			 * pass over the payload memory.
+			 */
+			pkt_chksum_fold(pkt_dst,
+					net_calc_chksum_data(0U, c_dst->pos,
+							     len),
+					len);
+		}
+#endif /* CONFIG_NET_PKT_TX_CHKSUM_CACHE */
+
 		if (!net_pkt_is_being_overwritten(pkt_dst)) {
 			net_buf_add(c_dst->buf, len);
 		}
@@ -1728,6 +1810,41 @@ int net_pkt_copy(struct net_pkt *pkt_dst,
 	return 0;
 }
 
+int net_pkt_copy(struct net_pkt *pkt_dst,
+		 struct net_pkt *pkt_src,
+		 size_t length)
+{
+	return pkt_copy(pkt_dst, pkt_src, length, false);
+}
+
+#if defined(CONFIG_NET_PKT_TX_CHKSUM_CACHE)
+int net_pkt_copy_chksum(struct net_pkt *pkt_dst,
+			struct net_pkt *pkt_src,
+			size_t length)
+{
+	bool chksum = net_if_need_calc_tx_checksum(net_pkt_iface(pkt_dst));
+
+	return pkt_copy(pkt_dst, pkt_src, length, chksum);
+}
+
+int net_pkt_write_chksum(struct net_pkt *pkt, const void *data, size_t length)
+{
+	int ret;
+
+	ret = net_pkt_write(pkt, data, length);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt))) {
+		pkt_chksum_fold(pkt, net_calc_chksum_data(0U, data, length),
+				length);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_PKT_TX_CHKSUM_CACHE */
+
 static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 {
 	net_pkt_set_family(clone_pkt, net_pkt_family(pkt));
@@ -87,6 +87,9 @@ static inline enum net_verdict net_ipv6_input(struct net_pkt *pkt,
 }
 #endif
 extern bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt);
+#if defined(CONFIG_NET_TC_TX_BATCH)
+extern struct net_pkt *net_tc_try_dequeue_tx(uint8_t tc);
+#endif
 extern void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
@@ -158,6 +161,8 @@ extern char *net_byte_to_hex(char *ptr, uint8_t byte, char base, bool pad);
 extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 				    char *buf, int buflen);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
+extern uint16_t net_calc_chksum_data(uint16_t sum, const uint8_t *data,
+				     size_t len);
 
 /**
  * @brief Deliver the incoming packet through the recv_cb of the net_context
@@ -66,6 +66,7 @@ LOG_MODULE_REGISTER(net_shell, LOG_LEVEL_DBG);
 
 #include "net_shell.h"
 #include "net_stats.h"
+#include "net_tap.h"
 
 #include <sys/fdtable.h>
 #include "websocket/websocket_internal.h"
@@ -4058,6 +4059,8 @@ static int cmd_net_stats_all(const struct shell *shell, size_t argc,
 #if defined(CONFIG_NET_STATISTICS)
 	user_data.shell = shell;
 
+	net_stats_fold();
+
 	/* Print global network statistics */
 	net_shell_print_statistics_all(&user_data);
 #else
@@ -4861,6 +4864,230 @@ static int cmd_net_websocket(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if defined(CONFIG_NET_PKT_TAP)
+
+#define PCAPNG_BLOCK_SHB 0x0a0d0d0aUL
+#define PCAPNG_BLOCK_IDB 0x00000001UL
+#define PCAPNG_BLOCK_EPB 0x00000006UL
+#define PCAPNG_MAGIC 0x1a2b3c4dUL
+#define PCAPNG_LINKTYPE_USER0 147
+#define PCAPNG_OPT_EPB_FLAGS 2
+
+struct tap_pcapng_block {
+	size_t len;
+	uint8_t data[CONFIG_NET_PKT_TAP_SNAPLEN + 48];
+};
+
+static void tap_block_add(struct tap_pcapng_block *block, const void *data,
+			  size_t len)
+{
+	memcpy(&block->data[block->len], data, len);
+	block->len += len;
+}
+
+static void tap_block_add_u16(struct tap_pcapng_block *block, uint16_t value)
+{
+	tap_block_add(block, &value, sizeof(value));
+}
+
+static void tap_block_add_u32(struct tap_pcapng_block *block, uint32_t value)
+{
+	tap_block_add(block, &value, sizeof(value));
+}
+
+static void tap_block_print(const struct shell *shell,
+			    struct tap_pcapng_block *block)
+{
+	uint32_t total = block->len + sizeof(total);
+	size_t i;
+
+	/* pcapng carries the total length both right after the block
+	 * type and at the very end of the block.
+	 */
+	memcpy(&block->data[4], &total, sizeof(total));
+	tap_block_add_u32(block, total);
+
+	for (i = 0; i < block->len; i++) {
+		PR("%02x", block->data[i]);
+
+		if ((i % 16) == 15) {
+			PR("\n");
+		}
+	}
+
+	if ((block->len % 16) != 0) {
+		PR("\n");
+	}
+}
+
+static int cmd_net_tap_on(const struct shell *shell, size_t argc,
+			  char *argv[])
+{
+	uint32_t limit = CONFIG_NET_PKT_TAP_SLOTS;
+	int if_index = 0;
+
+	if (argc > 1) {
+		limit = strtoul(argv[1], NULL, 10);
+		if (limit == 0U) {
+			PR_ERROR("Invalid packet count %s.\n", argv[1]);
+			return -ENOEXEC;
+		}
+	}
+
+	if (argc > 2) {
+		if_index = strtol(argv[2], NULL, 10);
+		if (net_if_get_by_index(if_index) == NULL) {
+			PR_ERROR("No such interface %s.\n", argv[2]);
+			return -ENOEXEC;
+		}
+	}
+
+	net_tap_flush();
+	net_tap_enable(if_index, limit);
+
+	PR_INFO("Packet capture started for %u packets.\n", limit);
+
+	return 0;
+}
+
+static int cmd_net_tap_off(const struct shell *shell, size_t argc,
+			   char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	net_tap_disable();
+
+	PR_INFO("Packet capture stopped, %zu packets in the ring.\n",
+		net_tap_count());
+
+	return 0;
+}
+
+static int cmd_net_tap_export(const struct shell *shell, size_t argc,
+			      char *argv[])
+{
+	static struct tap_pcapng_block block;
+	struct net_tap_slot slot;
+	int max_if_index = 1;
+	uint64_t usec;
+	size_t i;
+	int j;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (net_tap_is_enabled()) {
+		PR_WARNING("Capture is running, stop it with "
+			   "\"net tap off\" first.\n");
+		return -ENOEXEC;
+	}
+
+	if (net_tap_count() == 0) {
+		PR_INFO("Nothing captured.\n");
+		return 0;
+	}
+
+	for (i = 0; net_tap_get(i, &slot); i++) {
+		if (slot.if_index > max_if_index) {
+			max_if_index = slot.if_index;
+		}
+	}
+
+	PR_INFO("Feed the hex dump below through \"xxd -r -p\" to get "
+		"a pcapng file.\n");
+
+	block.len = 0;
+	tap_block_add_u32(&block, PCAPNG_BLOCK_SHB);
+	tap_block_add_u32(&block, 0); /* patched in tap_block_print() */
+	tap_block_add_u32(&block, PCAPNG_MAGIC);
+	tap_block_add_u16(&block, 1); /* major version */
+	tap_block_add_u16(&block, 0); /* minor version */
+	tap_block_add_u32(&block, 0xffffffff); /* section length is */
+	tap_block_add_u32(&block, 0xffffffff); /* not specified      */
+	tap_block_print(shell, &block);
+
+	/* One interface description per interface index so that the
+	 * packet blocks below can refer to the right one.
+	 */
+	for (j = 0; j < max_if_index; j++) {
+		block.len = 0;
+		tap_block_add_u32(&block, PCAPNG_BLOCK_IDB);
+		tap_block_add_u32(&block, 0);
+		tap_block_add_u16(&block, PCAPNG_LINKTYPE_USER0);
+		tap_block_add_u16(&block, 0); /* reserved */
+		tap_block_add_u32(&block, CONFIG_NET_PKT_TAP_SNAPLEN);
+		tap_block_print(shell, &block);
+	}
+
+	for (i = 0; net_tap_get(i, &slot); i++) {
+		usec = k_cyc_to_us_floor64(slot.cycles);
+
+		block.len = 0;
+		tap_block_add_u32(&block, PCAPNG_BLOCK_EPB);
+		tap_block_add_u32(&block, 0);
+		tap_block_add_u32(&block,
+				  slot.if_index > 0 ? slot.if_index - 1 : 0);
+		tap_block_add_u32(&block, usec >> 32);
+		tap_block_add_u32(&block, usec & 0xffffffff);
+		tap_block_add_u32(&block, slot.cap_len);
+		tap_block_add_u32(&block, slot.orig_len);
+		tap_block_add(&block, slot.data, slot.cap_len);
+
+		while ((block.len % 4) != 0) {
+			block.data[block.len++] = 0U;
+		}
+
+		/* Direction flag option, 1 is inbound and 2 outbound */
+		tap_block_add_u16(&block, PCAPNG_OPT_EPB_FLAGS);
+		tap_block_add_u16(&block, 4);
+		tap_block_add_u32(&block, slot.is_tx ? 2 : 1);
+		tap_block_add_u32(&block, 0); /* end of options */
+
+		tap_block_print(shell, &block);
+	}
+
+	return 0;
+}
+
+static int cmd_net_tap_flush(const struct shell *shell, size_t argc,
+			     char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	net_tap_flush();
+
+	PR_INFO("Captured packets discarded.\n");
+
+	return 0;
+}
+#endif /* CONFIG_NET_PKT_TAP */
+
+static int cmd_net_tap(const struct shell *shell, size_t argc, char *argv[])
+{
+#if defined(CONFIG_NET_PKT_TAP)
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (net_tap_is_enabled()) {
+		PR("Capture running, %u packets to go.\n",
+		   net_tap_remaining());
+	} else {
+		PR("Capture stopped.\n");
+	}
+
+	PR("%zu packets of max %d in the ring, snap length %d.\n",
+	   net_tap_count(), CONFIG_NET_PKT_TAP_SLOTS,
+	   CONFIG_NET_PKT_TAP_SNAPLEN);
+#else
+	PR_INFO("Set %s to enable %s support.\n", "CONFIG_NET_PKT_TAP",
+		"packet tap");
+#endif
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_arp,
 	SHELL_CMD(flush, NULL, "Remove all entries from ARP cache.",
 		  cmd_net_arp_flush),
@@ -5120,6 +5347,27 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_stats,
 	SHELL_SUBCMD_SET_END
 );
 
+#if defined(CONFIG_NET_PKT_TAP)
+SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_tap,
+	SHELL_CMD(on, NULL,
+		  "'net tap on [<count>] [<index>]' starts capturing "
+		  "packet headers.",
+		  cmd_net_tap_on),
+	SHELL_CMD(off, NULL, "Stop capturing packet headers.",
+		  cmd_net_tap_off),
+	SHELL_CMD(export, NULL,
+		  "Dump the captured packets in pcapng format.",
+		  cmd_net_tap_export),
+	SHELL_CMD(flush, NULL, "Discard the captured packets.",
+		  cmd_net_tap_flush),
+	SHELL_SUBCMD_SET_END
+);
+
+#define TAP_CMD &net_cmd_tap
+#else
+#define TAP_CMD NULL
+#endif /* CONFIG_NET_PKT_TAP */
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_tcp,
 	SHELL_CMD(connect, NULL,
 		  "'net tcp connect <address> <port>' connects to TCP peer.",
@@ -5198,6 +5446,7 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_commands,
 		  cmd_net_stats),
 	SHELL_CMD(suspend, NULL, "Suspend a network interface",
 		  cmd_net_suspend),
+	SHELL_CMD(tap, TAP_CMD, "Capture packet headers.", cmd_net_tap),
 	SHELL_CMD(tcp, &net_cmd_tcp, "Connect/send/close TCP connection.",
 		  cmd_net_tcp),
 	SHELL_CMD(vlan, &net_cmd_vlan, "Show VLAN information.", cmd_net_vlan),
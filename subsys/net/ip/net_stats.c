@@ -29,6 +29,150 @@ LOG_MODULE_REGISTER(net_stats, NET_LOG_LEVEL);
  */
 struct net_stats net_stats = { 0 };
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+struct net_stats_cpu net_stats_shards[CONFIG_MP_NUM_CPUS];
+
+/* Fold the per CPU shards into the global statistics. Counters are
+ * accumulated and then cleared from the shard, values that are assigned
+ * rather than incremented are just copied over.
+ */
+void net_stats_fold(void)
+{
+	int cpu, i;
+
+#define STATS_FOLD(field) do {			\
+		net_stats.field += s->field;	\
+		s->field = 0;			\
+	} while (false)
+#define STATS_COPY(field) (net_stats.field = s->field)
+
+	for (cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		struct net_stats *s = &net_stats_shards[cpu].stats;
+
+		ARG_UNUSED(i);
+
+		STATS_FOLD(processing_error);
+		STATS_FOLD(bytes.sent);
+		STATS_FOLD(bytes.received);
+		STATS_FOLD(ip_errors.vhlerr);
+		STATS_FOLD(ip_errors.hblenerr);
+		STATS_FOLD(ip_errors.lblenerr);
+		STATS_FOLD(ip_errors.fragerr);
+		STATS_FOLD(ip_errors.chkerr);
+		STATS_FOLD(ip_errors.protoerr);
+
+#if defined(CONFIG_NET_STATISTICS_IPV6)
+		STATS_FOLD(ipv6.recv);
+		STATS_FOLD(ipv6.sent);
+		STATS_FOLD(ipv6.forwarded);
+		STATS_FOLD(ipv6.drop);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV4)
+		STATS_FOLD(ipv4.recv);
+		STATS_FOLD(ipv4.sent);
+		STATS_FOLD(ipv4.forwarded);
+		STATS_FOLD(ipv4.drop);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_ICMP)
+		STATS_FOLD(icmp.recv);
+		STATS_FOLD(icmp.sent);
+		STATS_FOLD(icmp.drop);
+		STATS_FOLD(icmp.typeerr);
+		STATS_FOLD(icmp.chkerr);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_TCP)
+		STATS_FOLD(tcp.bytes.sent);
+		STATS_FOLD(tcp.bytes.received);
+		STATS_FOLD(tcp.resent);
+		STATS_FOLD(tcp.recv);
+		STATS_FOLD(tcp.sent);
+		STATS_FOLD(tcp.drop);
+		STATS_FOLD(tcp.chkerr);
+		STATS_FOLD(tcp.ackerr);
+		STATS_FOLD(tcp.rsterr);
+		STATS_FOLD(tcp.rst);
+		STATS_FOLD(tcp.rexmit);
+		STATS_FOLD(tcp.conndrop);
+		STATS_FOLD(tcp.connrst);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_UDP)
+		STATS_FOLD(udp.drop);
+		STATS_FOLD(udp.recv);
+		STATS_FOLD(udp.sent);
+		STATS_FOLD(udp.chkerr);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_ND)
+		STATS_FOLD(ipv6_nd.drop);
+		STATS_FOLD(ipv6_nd.recv);
+		STATS_FOLD(ipv6_nd.sent);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_MLD)
+		STATS_FOLD(ipv6_mld.recv);
+		STATS_FOLD(ipv6_mld.sent);
+		STATS_FOLD(ipv6_mld.drop);
+#endif
+
+#if NET_TC_COUNT > 1
+		for (i = 0; i < NET_TC_TX_COUNT; i++) {
+			STATS_FOLD(tc.sent[i].tx_time.sum);
+			STATS_FOLD(tc.sent[i].tx_time.count);
+			STATS_FOLD(tc.sent[i].pkts);
+			STATS_FOLD(tc.sent[i].bytes);
+			STATS_COPY(tc.sent[i].priority);
+		}
+
+		for (i = 0; i < NET_TC_RX_COUNT; i++) {
+			STATS_FOLD(tc.recv[i].rx_time.sum);
+			STATS_FOLD(tc.recv[i].rx_time.count);
+			STATS_FOLD(tc.recv[i].pkts);
+			STATS_FOLD(tc.recv[i].bytes);
+			STATS_COPY(tc.recv[i].priority);
+		}
+#endif
+
+#if defined(CONFIG_NET_CONTEXT_TIMESTAMP) || \
+					defined(CONFIG_NET_PKT_TXTIME_STATS)
+		STATS_FOLD(tx_time.sum);
+		STATS_FOLD(tx_time.count);
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+		for (i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+			STATS_FOLD(tx_time_detail[i].sum);
+			STATS_FOLD(tx_time_detail[i].count);
+		}
+#endif
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+		for (i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+			STATS_FOLD(rx_time_detail[i].sum);
+			STATS_FOLD(rx_time_detail[i].count);
+		}
+#endif
+#endif
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS)
+		STATS_FOLD(rx_time.sum);
+		STATS_FOLD(rx_time.count);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)
+		STATS_FOLD(pm.overall_suspend_time);
+		STATS_FOLD(pm.suspend_count);
+		STATS_COPY(pm.last_suspend_time);
+		STATS_COPY(pm.start_time);
+#endif
+	}
+
+#undef STATS_FOLD
+#undef STATS_COPY
+}
+#endif /* CONFIG_NET_STATISTICS_PER_CPU */
+
 #if defined(CONFIG_NET_STATISTICS_PERIODIC_OUTPUT)
 
 #define PRINT_STATISTICS_INTERVAL (30 * MSEC_PER_SEC)
@@ -72,6 +216,8 @@ static inline void stats(struct net_if *iface)
 	int i;
 
 	if (!next_print || (abs(cmp) > PRINT_STATISTICS_INTERVAL)) {
+		net_stats_fold();
+
 		if (iface) {
 			NET_INFO("Interface %p [%d]", iface,
 				 net_if_get_by_iface(iface));
@@ -240,6 +386,8 @@ static int net_stats_get(uint32_t mgmt_request, struct net_if *iface,
 	size_t len_chk = 0;
 	void *src = NULL;
 
+	net_stats_fold();
+
 	switch (NET_MGMT_GET_COMMAND(mgmt_request)) {
 	case NET_REQUEST_STATS_CMD_GET_ALL:
 		len_chk = sizeof(struct net_stats);
@@ -372,4 +520,8 @@ void net_stats_reset(struct net_if *iface)
 
 	net_if_stats_reset_all();
 	memset(&net_stats, 0, sizeof(net_stats));
+
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+	memset(net_stats_shards, 0, sizeof(net_stats_shards));
+#endif
 }
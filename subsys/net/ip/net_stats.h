@@ -17,6 +17,29 @@
 
 extern struct net_stats net_stats;
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+/* The global statistics are sharded per CPU so that the update macros can
+ * do a plain increment without atomics or locking. The shards are folded
+ * into net_stats by net_stats_fold() just before the values are reported.
+ */
+struct net_stats_cpu {
+	struct net_stats stats;
+};
+
+extern struct net_stats_cpu net_stats_shards[CONFIG_MP_NUM_CPUS];
+
+void net_stats_fold(void);
+
+#define UPDATE_STAT_GLOBAL(cmd) \
+	(net_stats_shards[arch_curr_cpu()->id].cmd)
+#else
+static inline void net_stats_fold(void)
+{
+}
+
+#define UPDATE_STAT_GLOBAL(cmd) (net_##cmd)
+#endif
+
 #if defined(CONFIG_NET_STATISTICS_PER_INTERFACE)
 #define SET_STAT(cmd) (cmd)
 #define GET_STAT(iface, s) (iface ? iface->stats.s : net_stats.s)
@@ -27,7 +50,6 @@ extern struct net_stats net_stats;
 #define GET_STAT_ADDR(iface, s) (&GET_STAT(iface, s))
 #endif
 
-#define UPDATE_STAT_GLOBAL(cmd) (net_##cmd)
 #define UPDATE_STAT(_iface, _cmd) \
 	{ NET_ASSERT(_iface); (UPDATE_STAT_GLOBAL(_cmd)); \
 	  SET_STAT(_iface->_cmd); }
@@ -0,0 +1,157 @@
+/** @file
+ * @brief Lightweight packet capture ring
+ *
+ * Records a bounded prefix of packets passing the RX and TX tap points
+ * in net_core.c into a RAM ring buffer, without going through the
+ * logging subsystem. The captures can be exported in pcapng format
+ * from the network shell.
+ */
+
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(net_tap, CONFIG_NET_CORE_LOG_LEVEL);
+
+#include <kernel.h>
+#include <string.h>
+#include <sys/atomic.h>
+#include <net/net_pkt.h>
+#include <net/net_if.h>
+
+#include "net_tap.h"
+
+static struct net_tap_slot tap_ring[CONFIG_NET_PKT_TAP_SLOTS];
+static struct k_spinlock tap_lock;
+
+/* Number of packets still to be captured, <= 0 when the tap is off.
+ * This is the only state inspected on the fast path.
+ */
+static atomic_t tap_remaining;
+
+/* Only capture packets of this interface, 0 captures on any */
+static int tap_if_index;
+
+static uint32_t tap_next;
+static uint32_t tap_stored;
+
+void net_tap_record(struct net_pkt *pkt, bool is_tx)
+{
+	struct net_tap_slot *slot;
+	struct net_buf *buf;
+	k_spinlock_key_t key;
+	uint16_t cap = 0U;
+
+	if (atomic_get(&tap_remaining) <= 0) {
+		return;
+	}
+
+	if (tap_if_index != 0 &&
+	    net_if_get_by_iface(net_pkt_iface(pkt)) != tap_if_index) {
+		return;
+	}
+
+	if (atomic_dec(&tap_remaining) <= 0) {
+		/* Lost the race against net_tap_disable() */
+		return;
+	}
+
+	key = k_spin_lock(&tap_lock);
+
+	slot = &tap_ring[tap_next];
+	tap_next = (tap_next + 1) % CONFIG_NET_PKT_TAP_SLOTS;
+
+	if (tap_stored < CONFIG_NET_PKT_TAP_SLOTS) {
+		tap_stored++;
+	}
+
+	slot->cycles = k_cycle_get_32();
+	slot->orig_len = net_pkt_get_len(pkt);
+	slot->if_index = net_if_get_by_iface(net_pkt_iface(pkt));
+	slot->is_tx = is_tx;
+
+	/* Walk the fragments directly so that the packet cursor is
+	 * left untouched for the rest of the stack.
+	 */
+	for (buf = pkt->buffer;
+	     buf != NULL && cap < CONFIG_NET_PKT_TAP_SNAPLEN;
+	     buf = buf->frags) {
+		uint16_t len = MIN(buf->len,
+				   CONFIG_NET_PKT_TAP_SNAPLEN - cap);
+
+		memcpy(&slot->data[cap], buf->data, len);
+		cap += len;
+	}
+
+	slot->cap_len = cap;
+
+	k_spin_unlock(&tap_lock, key);
+}
+
+void net_tap_enable(int if_index, uint32_t limit)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&tap_lock);
+	tap_if_index = if_index;
+	k_spin_unlock(&tap_lock, key);
+
+	atomic_set(&tap_remaining, limit);
+}
+
+void net_tap_disable(void)
+{
+	atomic_set(&tap_remaining, 0);
+}
+
+bool net_tap_is_enabled(void)
+{
+	return atomic_get(&tap_remaining) > 0;
+}
+
+uint32_t net_tap_remaining(void)
+{
+	atomic_val_t remaining = atomic_get(&tap_remaining);
+
+	return remaining > 0 ? remaining : 0;
+}
+
+void net_tap_flush(void)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&tap_lock);
+	tap_next = 0U;
+	tap_stored = 0U;
+	k_spin_unlock(&tap_lock, key);
+}
+
+size_t net_tap_count(void)
+{
+	return tap_stored;
+}
+
+bool net_tap_get(size_t idx, struct net_tap_slot *slot)
+{
+	k_spinlock_key_t key;
+	bool found = false;
+
+	key = k_spin_lock(&tap_lock);
+
+	if (idx < tap_stored) {
+		size_t first = (tap_next + CONFIG_NET_PKT_TAP_SLOTS -
+				tap_stored) % CONFIG_NET_PKT_TAP_SLOTS;
+
+		memcpy(slot,
+		       &tap_ring[(first + idx) % CONFIG_NET_PKT_TAP_SLOTS],
+		       sizeof(*slot));
+		found = true;
+	}
+
+	k_spin_unlock(&tap_lock, key);
+
+	return found;
+}
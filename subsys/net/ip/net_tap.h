@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __NET_TAP_H__
+#define __NET_TAP_H__
+
+#include <net/net_pkt.h>
+
+#if defined(CONFIG_NET_PKT_TAP)
+
+/** One captured packet. The data is a bounded prefix of the packet as
+ *  it was seen at the tap point.
+ */
+struct net_tap_slot {
+	/** Cycle counter value when the packet hit the tap point */
+	uint32_t cycles;
+
+	/** Full length of the packet */
+	uint16_t orig_len;
+
+	/** Number of bytes stored in data */
+	uint16_t cap_len;
+
+	/** Index of the interface the packet belongs to */
+	uint8_t if_index;
+
+	/** True for packets seen in net_send_data() */
+	uint8_t is_tx;
+
+	/** Captured prefix of the packet */
+	uint8_t data[CONFIG_NET_PKT_TAP_SNAPLEN];
+};
+
+/**
+ * @brief Record the start of a packet into the capture ring.
+ *
+ * Called from the RX and TX paths in net_core.c. Does nothing but a
+ * single atomic load when the tap has not been enabled at runtime.
+ *
+ * @param pkt Network packet
+ * @param is_tx True when called from the transmit path
+ */
+void net_tap_record(struct net_pkt *pkt, bool is_tx);
+
+/**
+ * @brief Start capturing packets.
+ *
+ * @param if_index Only capture packets of this interface, 0 for any
+ * @param limit Stop automatically after this many packets
+ */
+void net_tap_enable(int if_index, uint32_t limit);
+
+/**
+ * @brief Stop capturing packets.
+ */
+void net_tap_disable(void);
+
+/**
+ * @brief Check if the tap is currently capturing.
+ *
+ * @return True if capturing
+ */
+bool net_tap_is_enabled(void);
+
+/**
+ * @brief Get the number of packets still to be captured.
+ *
+ * @return Number of packets
+ */
+uint32_t net_tap_remaining(void);
+
+/**
+ * @brief Discard all captured packets.
+ */
+void net_tap_flush(void);
+
+/**
+ * @brief Get the number of packets currently in the ring.
+ *
+ * @return Number of packets
+ */
+size_t net_tap_count(void);
+
+/**
+ * @brief Copy one captured packet out of the ring.
+ *
+ * @param idx Index of the packet, 0 is the oldest one
+ * @param slot Where to copy the capture
+ *
+ * @return True if idx referred to a captured packet
+ */
+bool net_tap_get(size_t idx, struct net_tap_slot *slot);
+
+#else /* CONFIG_NET_PKT_TAP */
+
+#define net_tap_record(pkt, is_tx)
+
+#endif /* CONFIG_NET_PKT_TAP */
+
+#endif /* __NET_TAP_H__ */
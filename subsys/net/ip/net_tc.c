@@ -48,6 +48,28 @@ bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 	return true;
 }
 
+#if defined(CONFIG_NET_TC_TX_BATCH)
+struct net_pkt *net_tc_try_dequeue_tx(uint8_t tc)
+{
+	struct k_work *work;
+
+	/* Only packets submitted by net_tc_submit_to_tx_queue() ever end
+	 * up in these queues, so anything dequeued here is the embedded
+	 * work item of a net_pkt. Mirror the workqueue thread and skip
+	 * items whose pending bit has already been cleared.
+	 */
+	while ((work = k_queue_get(&tx_classes[tc].work_q.queue,
+				   K_NO_WAIT)) != NULL) {
+		if (atomic_test_and_clear_bit(work->flags,
+					      K_WORK_STATE_PENDING)) {
+			return CONTAINER_OF(work, struct net_pkt, work);
+		}
+	}
+
+	return NULL;
+}
+#endif
+
 void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
@@ -344,6 +344,10 @@ static int tcp_conn_unref(struct tcp *conn)
 	k_delayed_work_cancel(&conn->timewait_timer);
 	k_delayed_work_cancel(&conn->fin_timer);
 
+#if defined(CONFIG_NET_TCP_TX_PACING)
+	k_delayed_work_cancel(&conn->pace_timer);
+#endif
+
 	sys_slist_find_and_remove(&tcp_conns, &conn->next);
 
 	memset(conn, 0, sizeof(*conn));
@@ -416,7 +420,7 @@ static bool tcp_send_process_no_lock(struct tcp *conn)
 	}
 
 	if (conn->in_retransmission) {
-		k_delayed_work_submit(&conn->send_timer, K_MSEC(tcp_rto));
+		k_delayed_work_submit(&conn->send_timer, K_MSEC(conn_rto(conn)));
 	}
 
 out:
@@ -460,7 +464,7 @@ static void tcp_send_timer_cancel(struct tcp *conn)
 		conn->in_retransmission = false;
 	} else {
 		conn->send_retries = tcp_retries;
-		k_delayed_work_submit(&conn->send_timer, K_MSEC(tcp_rto));
+		k_delayed_work_submit(&conn->send_timer, K_MSEC(conn_rto(conn)));
 	}
 }
 
@@ -532,6 +536,10 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+#if defined(CONFIG_NET_TCP_SACK)
+	recv_options->sack_blocks = 0;
+	recv_options->sack_permitted = false;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -575,9 +583,43 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
-			recv_options->window = opt;
+			recv_options->window = options[2];
 			recv_options->wnd_found = true;
 			break;
+#if defined(CONFIG_NET_TCP_SACK)
+		case TCPOPT_SACKOK:
+			if (opt_len != 2) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_permitted = true;
+			break;
+		case TCPOPT_SACK: {
+			int blocks = (opt_len - 2) / 8;
+			int i;
+
+			if (opt_len < 10 || ((opt_len - 2) % 8) != 0) {
+				result = false;
+				goto end;
+			}
+
+			blocks = MIN(blocks,
+				     (int)ARRAY_SIZE(recv_options->sack));
+
+			for (i = 0; i < blocks; i++) {
+				recv_options->sack[i].left = ntohl(
+					UNALIGNED_GET((uint32_t *)
+						(options + 2 + i * 8)));
+				recv_options->sack[i].right = ntohl(
+					UNALIGNED_GET((uint32_t *)
+						(options + 2 + i * 8 + 4)));
+			}
+
+			recv_options->sack_blocks = blocks;
+			break;
+		}
+#endif
 		default:
 			continue;
 		}
@@ -642,6 +684,35 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+/* Options we attach to our SYN and SYN,ACK segments, padded with end
+ * of option list bytes to a word boundary.
+ */
+#if defined(CONFIG_NET_TCP_SACK) || defined(CONFIG_NET_TCP_WINDOW_SCALING)
+#define TCP_SYN_OPTS_LEN						\
+	((((IS_ENABLED(CONFIG_NET_TCP_SACK) ? 2 : 0) +			\
+	   (IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALING) ? 3 : 0)) + 3) & ~3)
+
+static int tcp_syn_options_write(struct net_pkt *pkt)
+{
+	uint8_t opts[TCP_SYN_OPTS_LEN] = { 0 }; /* zero is TCPOPT_END */
+	int len = 0;
+
+#if defined(CONFIG_NET_TCP_SACK)
+	opts[len++] = TCPOPT_SACKOK;
+	opts[len++] = 2U;
+#endif
+#if defined(CONFIG_NET_TCP_WINDOW_SCALING)
+	opts[len++] = TCPOPT_WINDOW;
+	opts[len++] = 3U;
+	opts[len++] = 0U; /* we do not scale our modest receive window */
+#endif
+
+	return net_pkt_write(pkt, opts, sizeof(opts));
+}
+#else
+#define TCP_SYN_OPTS_LEN 0
+#endif
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -659,6 +730,9 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 	th->th_dport = conn->dst.sin.sin_port;
 
 	th->th_off = 5;
+	if (flags & SYN) {
+		th->th_off += TCP_SYN_OPTS_LEN / 4;
+	}
 	th->th_flags = flags;
 	th->th_win = htons(conn->recv_win);
 	th->th_seq = htonl(seq);
@@ -693,7 +767,8 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	struct net_pkt *pkt;
 	int ret = 0;
 
-	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr));
+	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr) +
+			    ((flags & SYN) ? TCP_SYN_OPTS_LEN : 0));
 	if (!pkt) {
 		ret = -ENOBUFS;
 		goto out;
@@ -703,6 +778,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
 		data->buffer = NULL;
+
+		/* The payload sum folded in while the segment was copied
+		 * out of the send queue moves along with the buffer.
+		 */
+		net_pkt_set_tx_chksum(pkt, net_pkt_tx_chksum(data),
+				      net_pkt_tx_chksum_len(data));
 	}
 
 	ret = ip_header_add(conn, pkt);
@@ -717,6 +798,16 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
+#if TCP_SYN_OPTS_LEN > 0
+	if (flags & SYN) {
+		ret = tcp_syn_options_write(pkt);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+#endif
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -773,12 +864,199 @@ static int tcp_pkt_peek(struct net_pkt *to, struct net_pkt *from, size_t pos,
 		net_pkt_skip(from, pos);
 	}
 
-	return net_pkt_copy(to, from, len);
+	return net_pkt_copy_chksum(to, from, len);
+}
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+#define TCP_RTO_GRANULARITY 100	/* ms, lower bound of the estimated RTO */
+#define TCP_RTO_MAX 60000	/* ms */
+
+static void tcp_ca_init(struct tcp *conn)
+{
+	conn->rto = tcp_rto;
+	tcp_cc_algo.init(conn);
+
+	NET_DBG("conn: %p %s cwnd=%u", conn, tcp_cc_algo.name,
+		conn->ca.cwnd);
+}
+
+/* RFC 6298 round-trip time estimation */
+static void tcp_rtt_sample(struct tcp *conn, int rtt_ms)
+{
+	if (conn->srtt == 0) {
+		conn->srtt = rtt_ms;
+		conn->rttvar = rtt_ms / 2;
+	} else {
+		conn->rttvar = (3 * conn->rttvar +
+				abs(conn->srtt - rtt_ms)) / 4;
+		conn->srtt = (7 * conn->srtt + rtt_ms) / 8;
+	}
+
+	conn->rto = MIN(MAX(conn->srtt + MAX(4 * conn->rttvar, 1),
+			    TCP_RTO_GRANULARITY), TCP_RTO_MAX);
+
+	NET_DBG("conn: %p rtt=%d, srtt=%d, rttvar=%d, rto=%d", conn, rtt_ms,
+		conn->srtt, conn->rttvar, conn->rto);
+}
+
+/* Arm an rtt sample on the segment ending at the current send point */
+static void tcp_rtt_start(struct tcp *conn)
+{
+	if (conn->rtt_pending || conn->data_mode != TCP_DATA_MODE_SEND) {
+		return;
+	}
+
+	conn->rtt_seq = conn->seq + conn->unacked_len;
+	conn->rtt_ts = k_uptime_get_32();
+	conn->rtt_pending = true;
+}
+
+static void tcp_ca_new_ack(struct tcp *conn, uint32_t ack, uint32_t len_acked)
+{
+	/* A sample spanning a retransmission would be ambiguous (Karn's
+	 * algorithm), data_mode still holds the mode the data was sent in.
+	 */
+	if (conn->rtt_pending && conn->data_mode == TCP_DATA_MODE_SEND &&
+	    net_tcp_seq_cmp(ack, conn->rtt_seq) >= 0) {
+		tcp_rtt_sample(conn, (int)(k_uptime_get_32() - conn->rtt_ts));
+		conn->rtt_pending = false;
+	}
+
+	tcp_cc_algo.new_ack(conn, ack, len_acked);
+}
+
+static void tcp_ca_timeout(struct tcp *conn)
+{
+	tcp_cc_algo.pkt_loss(conn);
+
+	conn->rtt_pending = false;
+	conn->rto = MIN(conn->rto << 1, TCP_RTO_MAX);
+}
+#else
+#define tcp_ca_init(_conn)
+#define tcp_rtt_start(_conn)
+#define tcp_ca_new_ack(_conn, _ack, _len_acked)
+#define tcp_ca_timeout(_conn)
+#endif
+
+#if defined(CONFIG_NET_TCP_SACK)
+static void tcp_sack_insert(struct tcp *conn, uint32_t left, uint32_t right)
+{
+	int i;
+
+	/* Extend an overlapping or adjacent range when there is one */
+	for (i = 0; i < conn->num_sacked; i++) {
+		if (net_tcp_seq_cmp(left, conn->sacked[i].right) <= 0 &&
+		    net_tcp_seq_cmp(right, conn->sacked[i].left) >= 0) {
+			if (net_tcp_seq_cmp(left,
+					    conn->sacked[i].left) < 0) {
+				conn->sacked[i].left = left;
+			}
+			if (net_tcp_seq_cmp(right,
+					    conn->sacked[i].right) > 0) {
+				conn->sacked[i].right = right;
+			}
+			return;
+		}
+	}
+
+	if (conn->num_sacked < TCP_SACK_RANGES) {
+		conn->sacked[conn->num_sacked].left = left;
+		conn->sacked[conn->num_sacked].right = right;
+		conn->num_sacked++;
+	}
+}
+
+/* Merge the sack blocks of the incoming segment into the scoreboard */
+static void tcp_sack_update(struct tcp *conn)
+{
+	uint32_t end = conn->seq + conn->send_data_total;
+	int i;
+
+	for (i = 0; i < conn->recv_options.sack_blocks; i++) {
+		uint32_t left = conn->recv_options.sack[i].left;
+		uint32_t right = conn->recv_options.sack[i].right;
+
+		if (net_tcp_seq_cmp(right, left) <= 0 ||
+		    net_tcp_seq_cmp(right, conn->seq) <= 0 ||
+		    net_tcp_seq_cmp(right, end) > 0) {
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(left, conn->seq) < 0) {
+			left = conn->seq;
+		}
+
+		tcp_sack_insert(conn, left, right);
+	}
+
+	conn->recv_options.sack_blocks = 0;
+
+	NET_DBG("conn: %p num_sacked=%hu", conn,
+		(uint16_t)conn->num_sacked);
+}
+
+/* The cumulative ack in conn->seq moved: drop repaired ranges */
+static void tcp_sack_ack(struct tcp *conn)
+{
+	int i = 0;
+
+	while (i < conn->num_sacked) {
+		if (net_tcp_seq_cmp(conn->sacked[i].right, conn->seq) <= 0) {
+			conn->sacked[i] = conn->sacked[--conn->num_sacked];
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(conn->sacked[i].left, conn->seq) < 0) {
+			conn->sacked[i].left = conn->seq;
+		}
+
+		i++;
+	}
+}
+
+/* Move the send position past any sacked range it falls into. The
+ * ranges are not sorted, so scan until no range matches anymore.
+ */
+static int tcp_sack_skip(struct tcp *conn, int pos)
+{
+	uint32_t seq = conn->seq + pos;
+	bool moved = true;
+	int i;
+
+	while (moved) {
+		moved = false;
+
+		for (i = 0; i < conn->num_sacked; i++) {
+			if (net_tcp_seq_cmp(seq, conn->sacked[i].left) >= 0 &&
+			    net_tcp_seq_cmp(seq, conn->sacked[i].right) < 0) {
+				seq = conn->sacked[i].right;
+				moved = true;
+			}
+		}
+	}
+
+	return (int)(seq - conn->seq);
+}
+#else
+#define tcp_sack_ack(_conn)
+#endif
+
+/* The peer's advertised window, capped by the congestion window */
+static uint32_t tcp_send_win(struct tcp *conn)
+{
+	uint32_t win = conn->send_win;
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+	win = MIN(win, conn->ca.cwnd);
+#endif
+
+	return win;
 }
 
 static bool tcp_window_full(struct tcp *conn)
 {
-	bool window_full = !(conn->unacked_len < conn->send_win);
+	bool window_full = !(conn->unacked_len < tcp_send_win(conn));
 
 	NET_DBG("conn: %p window_full=%hu", conn, window_full);
 
@@ -810,10 +1088,26 @@ static int tcp_send_data(struct tcp *conn)
 	struct net_pkt *pkt;
 
 	pos = conn->unacked_len;
-	len = MIN3(conn->send_data_total - conn->unacked_len,
-		   conn->send_win - conn->unacked_len,
+
+#if defined(CONFIG_NET_TCP_SACK)
+	if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+		/* Do not retransmit data the peer has already sacked */
+		pos = tcp_sack_skip(conn, pos);
+	}
+#endif
+
+	len = MIN3((int)(conn->send_data_total - pos),
+		   (int)(tcp_send_win(conn) - conn->unacked_len),
 		   conn_mss(conn));
 
+	if (len <= 0) {
+		/* Everything from the resend position up to the window
+		 * limit is sacked, wait for the cumulative ack.
+		 */
+		conn->unacked_len = pos;
+		goto out;
+	}
+
 	pkt = tcp_pkt_alloc(conn, len);
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
@@ -828,9 +1122,10 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + pos);
 	if (ret == 0) {
-		conn->unacked_len += len;
+		conn->unacked_len = pos + len;
+		tcp_rtt_start(conn);
 	}
 
 	/* The data we want to send, has been moved to the send queue so we
@@ -845,6 +1140,76 @@ static int tcp_send_data(struct tcp *conn)
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+static void tcp_ca_dup_ack(struct tcp *conn)
+{
+	if (conn->unacked_len <= 0) {
+		return;
+	}
+
+	if (!tcp_cc_algo.dup_ack(conn)) {
+		return;
+	}
+
+	/* Fast retransmit: resend from the unacked point right away,
+	 * reusing the resend machinery, and remember the recovery point
+	 * so the algorithm knows when the loss has been repaired.
+	 */
+	conn->ca.recover = conn->seq + conn->unacked_len;
+	conn->ca.in_recovery = true;
+
+	conn->data_mode = TCP_DATA_MODE_RESEND;
+	conn->unacked_len = 0;
+
+	(void)tcp_send_data(conn);
+}
+#else
+#define tcp_ca_dup_ack(_conn)
+#endif
+
+#if defined(CONFIG_NET_TCP_TX_PACING)
+static uint32_t tcp_pace_interval(struct tcp *conn)
+{
+	uint32_t interval;
+
+	if (conn->srtt == 0) {
+		return 1;
+	}
+
+	/* Spread the congestion window over a round-trip: one MSS sized
+	 * segment every srtt * mss / cwnd milliseconds.
+	 */
+	interval = (uint32_t)conn->srtt * conn_mss(conn) /
+		MAX(conn->ca.cwnd, 1);
+
+	return MIN(MAX(interval, 1), (uint32_t)conn_rto(conn));
+}
+
+static void tcp_pace_timeout(struct k_work *work)
+{
+	struct tcp *conn = CONTAINER_OF(work, struct tcp, pace_timer);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->data_mode == TCP_DATA_MODE_SEND &&
+	    tcp_unsent_len(conn) > 0 && !tcp_window_full(conn)) {
+		if (tcp_send_data(conn) == 0 &&
+		    !k_delayed_work_remaining_get(&conn->send_data_timer)) {
+			conn->send_data_retries = 0;
+			k_delayed_work_submit(&conn->send_data_timer,
+					      K_MSEC(conn_rto(conn)));
+		}
+
+		if (tcp_unsent_len(conn) > 0 && !tcp_window_full(conn)) {
+			k_delayed_work_submit(&conn->pace_timer,
+					      K_MSEC(tcp_pace_interval(conn)));
+		}
+	}
+
+	k_mutex_unlock(&conn->lock);
+}
+#endif
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -867,6 +1232,18 @@ static int tcp_send_queued_data(struct tcp *conn)
 		if (ret < 0) {
 			break;
 		}
+
+#if defined(CONFIG_NET_TCP_TX_PACING)
+		/* Only the first segment goes out back-to-back, the rest
+		 * are clocked out by the pace timer at the estimated rate
+		 * of the path.
+		 */
+		if (tcp_unsent_len(conn) > 0 && !tcp_window_full(conn)) {
+			k_delayed_work_submit(&conn->pace_timer,
+					      K_MSEC(tcp_pace_interval(conn)));
+		}
+		break;
+#endif
 	}
 
 	if (conn->unacked_len) {
@@ -887,7 +1264,8 @@ static int tcp_send_queued_data(struct tcp *conn)
 
 	if (subscribe) {
 		conn->send_data_retries = 0;
-		k_delayed_work_submit(&conn->send_data_timer, K_MSEC(tcp_rto));
+		k_delayed_work_submit(&conn->send_data_timer,
+				      K_MSEC(conn_rto(conn)));
 	}
  out:
 	return ret;
@@ -909,6 +1287,8 @@ static void tcp_resend_data(struct k_work *work)
 		goto out;
 	}
 
+	tcp_ca_timeout(conn);
+
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
 
@@ -934,7 +1314,7 @@ static void tcp_resend_data(struct k_work *work)
 		}
 	}
 
-	k_delayed_work_submit(&conn->send_data_timer, K_MSEC(tcp_rto));
+	k_delayed_work_submit(&conn->send_data_timer, K_MSEC(conn_rto(conn)));
 
  out:
 	k_mutex_unlock(&conn->lock);
@@ -991,6 +1371,8 @@ static struct tcp *tcp_conn_alloc(void)
 
 	conn->recv_win = tcp_window;
 
+	tcp_ca_init(conn);
+
 	conn->seq = (IS_ENABLED(CONFIG_NET_TEST_PROTOCOL) ||
 		     IS_ENABLED(CONFIG_NET_TEST)) ? 0 : sys_rand32_get();
 
@@ -1004,6 +1386,10 @@ static struct tcp *tcp_conn_alloc(void)
 	conn->send_data = tcp_pkt_alloc(conn, 0);
 	k_delayed_work_init(&conn->send_data_timer, tcp_resend_data);
 
+#if defined(CONFIG_NET_TCP_TX_PACING)
+	k_delayed_work_init(&conn->pace_timer, tcp_pace_timeout);
+#endif
+
 	k_sem_init(&conn->connect_sem, 0, UINT_MAX);
 	conn->in_connect = false;
 
@@ -1245,8 +1631,33 @@ static void tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	if (th) {
 		size_t max_win;
 
+#if defined(CONFIG_NET_TCP_WINDOW_SCALING)
+		if (th->th_flags & SYN) {
+			/* In effect only if both SYNs carried the option;
+			 * ours always does when this is compiled in.
+			 */
+			conn->send_win_shift = conn->recv_options.wnd_found ?
+				MIN(conn->recv_options.window, 14) : 0;
+		}
+#endif
+#if defined(CONFIG_NET_TCP_SACK)
+		if (th->th_flags & SYN) {
+			conn->sack_enabled = conn->recv_options.sack_permitted;
+		} else if (conn->sack_enabled &&
+			   conn->recv_options.sack_blocks > 0) {
+			tcp_sack_update(conn);
+		}
+#endif
+
 		conn->send_win = ntohs(th->th_win);
 
+#if defined(CONFIG_NET_TCP_WINDOW_SCALING)
+		/* The shift never applies to the window in a SYN */
+		if (!(th->th_flags & SYN)) {
+			conn->send_win <<= conn->send_win_shift;
+		}
+#endif
+
 #if IS_ENABLED(CONFIG_NET_TCP_MAX_SEND_WINDOW_SIZE)
 		if (CONFIG_NET_TCP_MAX_SEND_WINDOW_SIZE) {
 			max_win = CONFIG_NET_TCP_MAX_SEND_WINDOW_SIZE;
@@ -1384,6 +1795,9 @@ next_state:
 			conn->unacked_len -= len_acked;
 			conn_seq(conn, + len_acked);
 
+			tcp_sack_ack(conn);
+			tcp_ca_new_ack(conn, th_ack(th), len_acked);
+
 			conn_send_data_dump(conn);
 
 			if (!k_delayed_work_remaining_get(&conn->send_data_timer)) {
@@ -1414,6 +1828,10 @@ next_state:
 				conn_state(conn, TCP_CLOSED);
 				break;
 			}
+		} else if (th && len == 0 &&
+			   net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
+			/* Acknowledgement of already acked data */
+			tcp_ca_dup_ack(conn);
 		}
 
 		if (th && len) {
@@ -1540,7 +1958,7 @@ int net_tcp_put(struct net_context *context)
 			/* How long to wait until all the data has been sent?
 			 */
 			k_delayed_work_submit(&conn->send_data_timer,
-					      K_MSEC(tcp_rto));
+					      K_MSEC(conn_rto(conn)));
 		} else {
 			int ret;
 
@@ -1580,10 +1998,38 @@ int net_tcp_listen(struct net_context *context)
 
 int net_tcp_update_recv_wnd(struct net_context *context, int32_t delta)
 {
-	ARG_UNUSED(context);
-	ARG_UNUSED(delta);
+	struct tcp *conn = context->tcp;
+	int32_t max_win = UINT16_MAX;
+	int32_t new_win;
+
+	if (!conn) {
+		return -EPROTOTYPE;
+	}
+
+#if defined(CONFIG_NET_CONTEXT_RCVBUF)
+	/* The advertised window may never exceed the per-context receive
+	 * buffer budget, so the peer cannot send more than the socket is
+	 * allowed to queue.
+	 */
+	if (conn->context->options.rcvbuf > 0) {
+		max_win = MIN(max_win, conn->context->options.rcvbuf);
+	}
+#endif
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	new_win = conn->recv_win + delta;
+	if (new_win < 0) {
+		new_win = 0;
+	} else if (new_win > max_win) {
+		new_win = max_win;
+	}
 
-	return -EPROTONOSUPPORT;
+	conn->recv_win = new_win;
+
+	k_mutex_unlock(&conn->lock);
+
+	return 0;
 }
 
 /* net_context queues the outgoing data for the TCP connection */
@@ -1624,14 +2070,13 @@ int net_tcp_queue_data(struct net_context *context, struct net_pkt *pkt)
 	pkt->buffer = NULL;
 
 	ret = tcp_send_queued_data(conn);
-	if (ret < 0 && ret != -ENOBUFS) {
-		tcp_conn_unref(conn);
-		goto out;
-	}
 
-	if (ret == -ENOBUFS) {
+	if (ret < 0) {
 		/* Restore the original data so that we do not resend the pkt
-		 * data multiple times.
+		 * data multiple times, and so that the unsent data is handed
+		 * back to net_context if the connection goes away. This
+		 * matters especially for loaned (zero-copy) buffers which
+		 * stay with their owner when the send fails.
 		 */
 		conn->send_data_total -= len;
 
@@ -1642,6 +2087,10 @@ int net_tcp_queue_data(struct net_context *context, struct net_pkt *pkt)
 			pkt->buffer = conn->send_data->buffer;
 			conn->send_data->buffer = NULL;
 		}
+
+		if (ret != -ENOBUFS) {
+			tcp_conn_unref(conn);
+		}
 	} else {
 		/* We should not free the pkt if there was an error. It will be
 		 * freed in net_context.c:context_sendto()
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr.h>
+#include <net/net_pkt.h>
+#include <net/net_context.h>
+#include "net_private.h"
+#include "tcp2_priv.h"
+
+#if defined(CONFIG_NET_TCP_CONG_NEWRENO)
+
+/* NewReno congestion control, RFC 5681 and RFC 6582. The window
+ * arithmetic is done in bytes, conn->unacked_len is the flight size.
+ */
+
+static void new_reno_init(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+
+	conn->ca.cwnd = MIN(4 * mss, MAX(2 * mss, 4380));
+	conn->ca.ssthresh = UINT16_MAX;
+	conn->ca.acked = 0;
+	conn->ca.dup_acks = 0;
+	conn->ca.in_recovery = false;
+}
+
+static void new_reno_new_ack(struct tcp *conn, uint32_t ack,
+			     uint32_t len_acked)
+{
+	uint32_t mss = conn_mss(conn);
+
+	conn->ca.dup_acks = 0;
+
+	if (conn->ca.in_recovery) {
+		if (net_tcp_seq_cmp(ack, conn->ca.recover) >= 0) {
+			/* The whole outstanding flight is acked: leave fast
+			 * recovery and deflate the inflated window.
+			 */
+			conn->ca.in_recovery = false;
+			conn->ca.cwnd = conn->ca.ssthresh;
+
+			NET_DBG("conn: %p leaving recovery, cwnd=%u", conn,
+				conn->ca.cwnd);
+		}
+
+		/* On a partial ack stay in recovery; the resend machinery
+		 * retransmits from the new unacked point on its own.
+		 */
+		return;
+	}
+
+	if (conn->ca.cwnd < conn->ca.ssthresh) {
+		/* Slow start */
+		conn->ca.cwnd += MIN(len_acked, mss);
+	} else {
+		/* Congestion avoidance, about one MSS per round-trip */
+		conn->ca.acked += len_acked;
+		if (conn->ca.acked >= conn->ca.cwnd) {
+			conn->ca.acked -= conn->ca.cwnd;
+			conn->ca.cwnd += mss;
+		}
+	}
+}
+
+static bool new_reno_dup_ack(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+
+	if (conn->ca.in_recovery) {
+		/* Every further duplicate means a segment has left the
+		 * network: inflate the window.
+		 */
+		conn->ca.cwnd += mss;
+		return false;
+	}
+
+	conn->ca.dup_acks++;
+	if (conn->ca.dup_acks < 3) {
+		return false;
+	}
+
+	conn->ca.ssthresh = MAX((uint32_t)conn->unacked_len / 2, 2 * mss);
+	conn->ca.cwnd = conn->ca.ssthresh + 3 * mss;
+	conn->ca.acked = 0;
+
+	NET_DBG("conn: %p fast retransmit, ssthresh=%u cwnd=%u", conn,
+		conn->ca.ssthresh, conn->ca.cwnd);
+
+	return true;
+}
+
+static void new_reno_pkt_loss(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+
+	conn->ca.ssthresh = MAX((uint32_t)conn->unacked_len / 2, 2 * mss);
+	conn->ca.cwnd = mss;
+	conn->ca.acked = 0;
+	conn->ca.dup_acks = 0;
+	conn->ca.in_recovery = false;
+
+	NET_DBG("conn: %p retransmission timeout, ssthresh=%u cwnd=%u", conn,
+		conn->ca.ssthresh, conn->ca.cwnd);
+}
+
+const struct tcp_cc tcp_cc_algo = {
+	.name = "NewReno",
+	.init = new_reno_init,
+	.new_ack = new_reno_new_ack,
+	.dup_ack = new_reno_dup_ack,
+	.pkt_loss = new_reno_pkt_loss,
+};
+
+#endif /* CONFIG_NET_TCP_CONG_NEWRENO */
@@ -85,6 +85,12 @@
 	((_conn)->recv_options.mss_found ?		\
 	 (_conn)->recv_options.mss : NET_IPV6_MTU)
 
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+#define conn_rto(_conn) ((_conn)->rto)
+#else
+#define conn_rto(_conn) tcp_rto
+#endif
+
 #define conn_state(_conn, _s)						\
 ({									\
 	NET_DBG("%s->%s",						\
@@ -96,7 +102,7 @@
 #define conn_send_data_dump(_conn)					\
 ({									\
 	NET_DBG("conn: %p total=%zd, unacked_len=%d, "			\
-		"send_win=%hu, mss=%hu",				\
+		"send_win=%u, mss=%hu",					\
 		(_conn), net_pkt_get_len((_conn)->send_data),		\
 		conn->unacked_len, conn->send_win,			\
 		conn_mss((_conn)));					\
@@ -110,6 +116,8 @@
 #define TCPOPT_NOP	1
 #define TCPOPT_MAXSEG	2
 #define TCPOPT_WINDOW	3
+#define TCPOPT_SACKOK	4
+#define TCPOPT_SACK	5
 
 enum pkt_addr {
 	TCP_EP_SRC = 1,
@@ -171,9 +179,23 @@ union tcp_endpoint {
 	struct sockaddr_in6 sin6;
 };
 
+/* Span of sequence numbers, right is one past the last covered number */
+struct tcp_sack_range {
+	uint32_t left;
+	uint32_t right;
+};
+
+/* How many discontiguous sacked spans the send queue scoreboard keeps */
+#define TCP_SACK_RANGES 4
+
 struct tcp_options {
 	uint16_t mss;
-	uint16_t window;
+	uint16_t window; /* window scale shift count */
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack_range sack[3];
+	uint8_t sack_blocks;
+	bool sack_permitted : 1;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
 };
@@ -208,13 +230,57 @@ struct tcp { /* TCP connection */
 	uint32_t seq;
 	uint32_t ack;
 	uint16_t recv_win;
-	uint16_t send_win;
+	uint32_t send_win;
 	uint8_t send_data_retries;
+#if defined(CONFIG_NET_TCP_SACK)
+	/* Scoreboard over the send queue: spans the peer has sacked */
+	struct tcp_sack_range sacked[TCP_SACK_RANGES];
+	uint8_t num_sacked;
+	bool sack_enabled : 1;
+#endif
+#if defined(CONFIG_NET_TCP_WINDOW_SCALING)
+	uint8_t send_win_shift;
+#endif
 	bool in_retransmission : 1;
 	bool in_connect : 1;
 	bool in_close : 1;
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+	struct {
+		uint32_t cwnd;		/* congestion window, in bytes */
+		uint32_t ssthresh;	/* slow start threshold, in bytes */
+		uint32_t acked;		/* bytes acked since last cwnd bump */
+		uint32_t recover;	/* last seq sent when loss was found */
+		uint8_t dup_acks;
+		bool in_recovery : 1;
+	} ca;
+	int srtt;		/* smoothed round-trip time, in ms */
+	int rttvar;		/* round-trip time variation, in ms */
+	int rto;		/* current retransmission timeout, in ms */
+	uint32_t rtt_seq;	/* sequence whose ack ends the rtt sample */
+	uint32_t rtt_ts;	/* uptime when the timed segment was sent */
+	bool rtt_pending : 1;
+#endif
+#if defined(CONFIG_NET_TCP_TX_PACING)
+	struct k_delayed_work pace_timer;
+#endif
+};
+
+#if defined(CONFIG_NET_TCP_CONGESTION_CONTROL)
+/* Congestion control is pluggable: the algorithm selected in Kconfig
+ * provides tcp_cc_algo and keeps its state in conn->ca. dup_ack()
+ * returning true asks the stack to fast retransmit and enter recovery.
+ */
+struct tcp_cc {
+	const char *name;
+	void (*init)(struct tcp *conn);
+	void (*new_ack)(struct tcp *conn, uint32_t ack, uint32_t len_acked);
+	bool (*dup_ack)(struct tcp *conn);
+	void (*pkt_loss)(struct tcp *conn);
 };
 
+extern const struct tcp_cc tcp_cc_algo;
+#endif
+
 #define _flags(_fl, _op, _mask, _cond)					\
 ({									\
 	bool result = false;						\
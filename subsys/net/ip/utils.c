@@ -489,35 +489,75 @@ int z_vrfy_net_addr_pton(sa_family_t family, const char *src,
 #include <syscalls/net_addr_pton_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
-static uint16_t calc_chksum(uint16_t sum, const uint8_t *data, size_t len)
+/* Sum the buffer as one's complemented 16-bit big endian words. The
+ * buffer always starts the checksummed stream on an even offset, so a
+ * possible trailing byte is the high octet of its pair. The bulk is
+ * summed with aligned native 16-bit loads: a one's complement sum is
+ * invariant under a uniform byte swap of its addends, so the byte
+ * order is corrected only once at the end instead of assembling every
+ * pair byte by byte.
+ */
+uint16_t net_calc_chksum_data(uint16_t sum, const uint8_t *data, size_t len)
 {
-	const uint8_t *end;
+	const uint16_t *word;
+	uint32_t s = 0U;
 	uint16_t tmp;
+	union {
+		uint8_t b[2];
+		uint16_t w;
+	} stray = { .w = 0U };
+	bool odd = (uintptr_t)data & 1U;
 
-	end = data + len - 1;
+	if (odd && len > 0U) {
+		stray.b[1] = *data++;
+		len--;
+	}
 
-	while (data < end) {
-		tmp = (data[0] << 8) + data[1];
-		sum += tmp;
-		if (sum < tmp) {
-			sum++;
-		}
+	word = (const uint16_t *)data;
 
-		data += 2;
+	while (len >= 4 * sizeof(uint16_t)) {
+		s += word[0];
+		s += word[1];
+		s += word[2];
+		s += word[3];
+		word += 4;
+		len -= 4 * sizeof(uint16_t);
 	}
 
-	if (data == end) {
-		tmp = data[0] << 8;
-		sum += tmp;
-		if (sum < tmp) {
-			sum++;
-		}
+	while (len >= sizeof(uint16_t)) {
+		s += *word++;
+		len -= sizeof(uint16_t);
+	}
+
+	if (len > 0U) {
+		stray.b[0] = *(const uint8_t *)word;
+	}
+
+	s += stray.w;
+
+	while (s >> 16) {
+		s = (s & 0xffffU) + (s >> 16);
+	}
+
+	if (odd) {
+		s = ((s & 0xffU) << 8) | (s >> 8);
+	}
+
+	/* The native loads summed in memory byte order, the callers
+	 * accumulate the checksum as a host endian value.
+	 */
+	tmp = htons((uint16_t)s);
+
+	sum += tmp;
+	if (sum < tmp) {
+		sum++;
 	}
 
 	return sum;
 }
 
-static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
+static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum,
+				       size_t remaining)
 {
 	struct net_pkt_cursor *cur = &pkt->cursor;
 	size_t len;
@@ -528,8 +568,11 @@ static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 
 	len = cur->buf->len - (cur->pos - cur->buf->data);
 
-	while (cur->buf) {
-		sum = calc_chksum(sum, cur->pos, len);
+	while (cur->buf && remaining > 0U) {
+		len = MIN(len, remaining);
+
+		sum = net_calc_chksum_data(sum, cur->pos, len);
+		remaining -= len;
 
 		cur->buf = cur->buf->frags;
 		if (!cur->buf || !cur->buf->len) {
@@ -539,12 +582,17 @@ static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 		cur->pos = cur->buf->data;
 
 		if (len % 2) {
+			if (remaining == 0U) {
+				break;
+			}
+
 			sum += *cur->pos;
 			if (sum < *cur->pos) {
 				sum++;
 			}
 
 			cur->pos++;
+			remaining--;
 			len = cur->buf->len - 1;
 		} else {
 			len = cur->buf->len;
@@ -554,32 +602,58 @@ static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 	return sum;
 }
 
-uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
+__hot_code uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
 {
+	size_t upper_len;
+	size_t data_len = 0U;
 	size_t len = 0U;
+	uint16_t data_sum = 0U;
 	uint16_t sum = 0U;
 	struct net_pkt_cursor backup;
 	bool ow;
 
 	if (IS_ENABLED(CONFIG_NET_IPV4) &&
 	    net_pkt_family(pkt) == AF_INET) {
+		upper_len = net_pkt_get_len(pkt) -
+			net_pkt_ip_hdr_len(pkt) -
+			net_pkt_ipv4_opts_len(pkt);
+
 		if (proto != IPPROTO_ICMP) {
 			len = 2 * sizeof(struct in_addr);
-			sum = net_pkt_get_len(pkt) -
-				net_pkt_ip_hdr_len(pkt) -
-				net_pkt_ipv4_opts_len(pkt) + proto;
+			sum = upper_len + proto;
 		}
 	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
 		   net_pkt_family(pkt) == AF_INET6) {
-		len = 2 * sizeof(struct in6_addr);
-		sum =  net_pkt_get_len(pkt) -
+		upper_len = net_pkt_get_len(pkt) -
 			net_pkt_ip_hdr_len(pkt) -
-			net_pkt_ipv6_ext_len(pkt) + proto;
+			net_pkt_ipv6_ext_len(pkt);
+
+		len = 2 * sizeof(struct in6_addr);
+		sum = upper_len + proto;
 	} else {
 		NET_DBG("Unknown protocol family %d", net_pkt_family(pkt));
 		return 0;
 	}
 
+	/* If the payload sum was already folded in when the data was
+	 * copied into the packet, only the headers before it need to be
+	 * walked here.
+	 */
+	data_len = net_pkt_tx_chksum_len(pkt);
+	if (data_len > 0U && data_len <= upper_len) {
+		data_sum = net_pkt_tx_chksum(pkt);
+
+		if ((upper_len - data_len) % 2) {
+			/* The cached sum was computed as if the payload
+			 * started an even offset of the stream: an odd
+			 * offset swaps the octet lanes.
+			 */
+			data_sum = (data_sum >> 8) | (data_sum << 8);
+		}
+	} else {
+		data_len = 0U;
+	}
+
 	net_pkt_cursor_backup(pkt, &backup);
 	net_pkt_cursor_init(pkt);
 
@@ -588,10 +662,15 @@ uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
 
 	net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) - len);
 
-	sum = calc_chksum(sum, pkt->cursor.pos, len);
+	sum = net_calc_chksum_data(sum, pkt->cursor.pos, len);
 	net_pkt_skip(pkt, len + net_pkt_ip_opts_len(pkt));
 
-	sum = pkt_calc_chksum(pkt, sum);
+	sum = pkt_calc_chksum(pkt, sum, upper_len - data_len);
+
+	sum += data_sum;
+	if (sum < data_sum) {
+		sum++;
+	}
 
 	sum = (sum == 0U) ? 0xffff : htons(sum);
 
@@ -607,9 +686,9 @@ uint16_t net_calc_chksum_ipv4(struct net_pkt *pkt)
 {
 	uint16_t sum;
 
-	sum = calc_chksum(0, pkt->buffer->data,
-			  net_pkt_ip_hdr_len(pkt) +
-			  net_pkt_ipv4_opts_len(pkt));
+	sum = net_calc_chksum_data(0, pkt->buffer->data,
+				   net_pkt_ip_hdr_len(pkt) +
+				   net_pkt_ipv4_opts_len(pkt));
 
 	sum = (sum == 0U) ? 0xffff : htons(sum);
 
@@ -1154,6 +1154,14 @@ void ethernet_init(struct net_if *iface)
 		ctx->ethernet_l2_flags |= NET_L2_PROMISC_MODE;
 	}
 
+	if (net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TX_CHKSUM_OFFLOAD) {
+		net_if_flag_set(iface, NET_IF_CHKSUM_OFFLOAD_TX);
+	}
+
+	if (net_eth_get_hw_capabilities(iface) & ETHERNET_HW_RX_CHKSUM_OFFLOAD) {
+		net_if_flag_set(iface, NET_IF_CHKSUM_OFFLOAD_RX);
+	}
+
 #if defined(CONFIG_NET_VLAN)
 	if (!(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_VLAN)) {
 		return;
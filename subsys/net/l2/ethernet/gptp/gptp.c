@@ -467,6 +467,10 @@ static void gptp_init_port_ds(int port)
 
 	port_ds->neighbor_prop_delay = 0;
 	port_ds->neighbor_prop_delay_thresh = GPTP_NEIGHBOR_PROP_DELAY_THR;
+#if defined(CONFIG_NET_GPTP_FIXED_POINT)
+	port_ds->neighbor_rate_ratio_q30 = 1LL << 30;
+	port_ds->neighbor_prop_delay_ns = 0;
+#endif
 	port_ds->delay_asymmetry = 0;
 
 	port_ds->ini_log_announce_itv = CONFIG_NET_GPTP_INIT_LOG_ANNOUNCE_ITV;
@@ -559,9 +563,17 @@ static void gptp_thread(void)
 
 		pkt = k_fifo_get(&gptp_rx_queue,
 				 K_MSEC(GPTP_THREAD_WAIT_TIMEOUT_MS));
-		if (pkt) {
+
+		/* Handle all queued messages before evaluating the state
+		 * machines so that a burst of messages, for example a sync
+		 * and its follow-up arriving back to back, results in one
+		 * state machine pass instead of one pass per message.
+		 */
+		while (pkt) {
 			gptp_handle_msg(pkt);
 			net_pkt_unref(pkt);
+
+			pkt = k_fifo_get(&gptp_rx_queue, K_NO_WAIT);
 		}
 
 		gptp_state_machine();
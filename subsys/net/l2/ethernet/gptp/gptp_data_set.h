@@ -397,6 +397,14 @@ struct gptp_port_ds {
 	/** Estimate of the ratio of the frequency with the peer. */
 	double neighbor_rate_ratio;
 
+#if defined(CONFIG_NET_GPTP_FIXED_POINT)
+	/** Neighbor rate ratio in Q30 fixed-point format. */
+	int64_t neighbor_rate_ratio_q30;
+
+	/** One way propagation time on the link in nanoseconds. */
+	int64_t neighbor_prop_delay_ns;
+#endif
+
 	/** Port Identity of the port. */
 	struct gptp_port_identity port_id;
 
@@ -12,6 +12,16 @@ LOG_MODULE_DECLARE(net_gptp, CONFIG_NET_GPTP_LOG_LEVEL);
 #include "gptp_data_set.h"
 #include "gptp_private.h"
 
+#if defined(CONFIG_NET_GPTP_FIXED_POINT)
+/* Q30 fixed-point representation of the neighbor rate ratio. */
+#define GPTP_RATE_RATIO_Q	30
+#define GPTP_RATE_RATIO_UNITY	(1LL << GPTP_RATE_RATIO_Q)
+
+/* 0.998 and 1.002 in Q30, the same bounds as the double path uses. */
+#define GPTP_RATE_RATIO_LOW	((GPTP_RATE_RATIO_UNITY / 1000) * 998)
+#define GPTP_RATE_RATIO_HIGH	((GPTP_RATE_RATIO_UNITY / 1000) * 1002)
+#endif
+
 static void gptp_md_sync_prepare(struct net_pkt *pkt,
 				 struct gptp_md_sync_info *sync_send,
 				 int port_number)
@@ -99,8 +109,10 @@ static int gptp_set_md_sync_receive(int port,
 	struct gptp_hdr *sync_hdr, *fup_hdr;
 	struct gptp_follow_up *fup;
 	struct net_ptp_time *sync_ts;
+#if !defined(CONFIG_NET_GPTP_FIXED_POINT)
 	double prop_delay_rated;
 	double delay_asymmetry_rated;
+#endif
 
 	state = &GPTP_PORT_STATE(port)->sync_rcv;
 	if (!state->rcvd_sync_ptr || !state->rcvd_follow_up_ptr) {
@@ -129,6 +141,15 @@ static int gptp_set_md_sync_receive(int port,
 	sync_rcv->upstream_tx_time *= NSEC_PER_SEC;
 	sync_rcv->upstream_tx_time += sync_ts->nanosecond;
 
+#if defined(CONFIG_NET_GPTP_FIXED_POINT)
+	sync_rcv->upstream_tx_time -=
+		(port_ds->neighbor_prop_delay_ns << GPTP_RATE_RATIO_Q) /
+		port_ds->neighbor_rate_ratio_q30;
+
+	sync_rcv->upstream_tx_time -=
+		(port_ds->delay_asymmetry << GPTP_RATE_RATIO_Q) /
+		port_ds->neighbor_rate_ratio_q30;
+#else
 	prop_delay_rated = port_ds->neighbor_prop_delay;
 	prop_delay_rated /= port_ds->neighbor_rate_ratio;
 
@@ -138,6 +159,7 @@ static int gptp_set_md_sync_receive(int port,
 	delay_asymmetry_rated /= port_ds->neighbor_rate_ratio;
 
 	sync_rcv->upstream_tx_time -= delay_asymmetry_rated;
+#endif
 
 	sync_rcv->rate_ratio = ntohl(fup->tlv.cumulative_scaled_rate_offset);
 	sync_rcv->rate_ratio /= GPTP_POW2_41;
@@ -220,6 +242,9 @@ static void gptp_md_compute_pdelay_rate_ratio(int port)
 	struct net_pkt *pkt;
 	struct gptp_hdr *hdr;
 	double neighbor_rate_ratio;
+#if defined(CONFIG_NET_GPTP_FIXED_POINT)
+	int64_t ratio_q30 = GPTP_RATE_RATIO_UNITY;
+#endif
 
 	state = &GPTP_PORT_STATE(port)->pdelay_req;
 	port_ds = GPTP_PORT_DS(port);
@@ -259,11 +284,35 @@ static void gptp_md_compute_pdelay_rate_ratio(int port)
 			state->neighbor_rate_ratio_valid = false;
 			neighbor_rate_ratio = 1.0;
 		} else {
+#if defined(CONFIG_NET_GPTP_FIXED_POINT)
+			uint64_t num = resp_evt_tstamp -
+				state->ini_resp_evt_tstamp;
+			uint64_t den = ingress_tstamp -
+				state->ini_resp_ingress_tstamp;
+
+			/* Keep the numerator below 2^34 so that the Q30
+			 * shift cannot overflow 64 bits. The deltas span
+			 * one pdelay interval so this only triggers after
+			 * a long gap between responses.
+			 */
+			while (num >= BIT64(34)) {
+				num >>= 1;
+				den >>= 1;
+			}
+
+			if (den > 0U) {
+				ratio_q30 = (num << GPTP_RATE_RATIO_Q) / den;
+			}
+
+			neighbor_rate_ratio = ratio_q30 *
+				(1.0 / GPTP_RATE_RATIO_UNITY);
+#else
 			neighbor_rate_ratio =
 				(resp_evt_tstamp - state->ini_resp_evt_tstamp);
 			neighbor_rate_ratio /=
 				(ingress_tstamp -
 				 state->ini_resp_ingress_tstamp);
+#endif
 
 			/* Measure the ratio with the previously sent response.
 			 */
@@ -274,6 +323,9 @@ static void gptp_md_compute_pdelay_rate_ratio(int port)
 	}
 
 	port_ds->neighbor_rate_ratio = neighbor_rate_ratio;
+#if defined(CONFIG_NET_GPTP_FIXED_POINT)
+	port_ds->neighbor_rate_ratio_q30 = ratio_q30;
+#endif
 	port_ds->neighbor_rate_ratio_valid = state->neighbor_rate_ratio_valid;
 }
 
@@ -286,7 +338,11 @@ static void gptp_md_compute_prop_time(int port)
 	struct gptp_port_ds *port_ds;
 	struct gptp_hdr *hdr;
 	struct net_pkt *pkt;
+#if defined(CONFIG_NET_GPTP_FIXED_POINT)
+	int64_t prop_time, turn_around;
+#else
 	double prop_time, turn_around;
+#endif
 
 	state = &GPTP_PORT_STATE(port)->pdelay_req;
 	port_ds = GPTP_PORT_DS(port);
@@ -338,6 +394,20 @@ static void gptp_md_compute_prop_time(int port)
 	 * for the magic values "TODO: Are these .998 and 1.002 specifically
 	 * defined in the standard?"
 	 */
+#if defined(CONFIG_NET_GPTP_FIXED_POINT)
+	if (port_ds->neighbor_rate_ratio_q30 > GPTP_RATE_RATIO_LOW &&
+	    port_ds->neighbor_rate_ratio_q30 < GPTP_RATE_RATIO_HIGH) {
+		turn_around = (turn_around *
+			       port_ds->neighbor_rate_ratio_q30) >>
+			GPTP_RATE_RATIO_Q;
+	}
+
+	prop_time -= turn_around;
+	prop_time /= 2;
+
+	port_ds->neighbor_prop_delay_ns = prop_time;
+	port_ds->neighbor_prop_delay = prop_time;
+#else
 	if (port_ds->neighbor_rate_ratio > .998 &&
 	    port_ds->neighbor_rate_ratio < 1.002) {
 		turn_around *= port_ds->neighbor_rate_ratio;
@@ -347,6 +417,7 @@ static void gptp_md_compute_prop_time(int port)
 	prop_time /= 2;
 
 	port_ds->neighbor_prop_delay = prop_time;
+#endif
 }
 
 static void gptp_md_pdelay_compute(int port)
@@ -148,6 +148,44 @@ int coap_packet_init(struct coap_packet *cpkt, uint8_t *data,
 	return 0;
 }
 
+int coap_packet_clone(struct coap_packet *cpkt, uint8_t *data,
+		      uint16_t max_len, const struct coap_packet *src,
+		      uint8_t type, uint8_t token_len, uint8_t *token,
+		      uint16_t id)
+{
+	uint16_t body_len;
+	bool res;
+	int ret;
+
+	if (!src || src->offset < src->hdr_len) {
+		return -EINVAL;
+	}
+
+	ret = coap_packet_init(cpkt, data, max_len,
+			       coap_header_get_version(src), type,
+			       token_len, token, coap_header_get_code(src),
+			       id);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* The option and payload encoding does not depend on the token
+	 * length, so they are copied verbatim from the template.
+	 */
+	body_len = src->offset - src->hdr_len;
+	if (body_len > 0U) {
+		res = append(cpkt, src->data + src->hdr_len, body_len);
+		if (!res) {
+			return -ENOMEM;
+		}
+	}
+
+	cpkt->opt_len = src->opt_len;
+	cpkt->delta = src->delta;
+
+	return 0;
+}
+
 static void option_header_set_delta(uint8_t *opt, uint8_t delta)
 {
 	*opt = (delta & 0xF) << 4;
@@ -1243,6 +1281,44 @@ void coap_pendings_clear(struct coap_pending *pendings, size_t len)
 	}
 }
 
+void coap_pending_queue_add(sys_slist_t *queue, struct coap_pending *pending)
+{
+	struct coap_pending *p;
+	sys_snode_t *prev = NULL;
+	uint32_t expiry = pending->t0 + pending->timeout;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(queue, p, list) {
+		if ((int32_t)(p->t0 + p->timeout - expiry) > 0) {
+			break;
+		}
+
+		prev = &p->list;
+	}
+
+	if (prev) {
+		sys_slist_insert(queue, prev, &pending->list);
+	} else {
+		sys_slist_prepend(queue, &pending->list);
+	}
+}
+
+bool coap_pending_queue_remove(sys_slist_t *queue,
+			       struct coap_pending *pending)
+{
+	return sys_slist_find_and_remove(queue, &pending->list);
+}
+
+struct coap_pending *coap_pending_queue_next_to_expire(sys_slist_t *queue)
+{
+	sys_snode_t *node = sys_slist_peek_head(queue);
+
+	if (!node) {
+		return NULL;
+	}
+
+	return CONTAINER_OF(node, struct coap_pending, list);
+}
+
 struct coap_reply *coap_response_received(
 	const struct coap_packet *response,
 	const struct sockaddr *from,
@@ -13,6 +13,9 @@ LOG_MODULE_REGISTER(conn_mgr, CONFIG_NET_CONNECTION_MANAGER_LOG_LEVEL);
 #include <net/net_core.h>
 #include <net/net_if.h>
 #include <net/net_mgmt.h>
+#if defined(CONFIG_NET_L2_ETHERNET)
+#include <net/ethernet.h>
+#endif
 
 #include <conn_mgr.h>
 
@@ -72,8 +75,62 @@ static void conn_mgr_notify_status(int index)
 	}
 }
 
+#if defined(CONFIG_NET_CONNECTION_MANAGER_AUTO_FAILOVER)
+static int conn_mgr_iface_score(int index)
+{
+	struct net_if *iface = net_if_get_by_index(index + 1);
+	int score = 1;
+
+	if (!iface || !(iface_states[index] & NET_STATE_CONNECTED)) {
+		return 0;
+	}
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	/* Prefer wired media, it has the lowest and most stable latency.
+	 * Cellular/offloaded modems act as a fallback.
+	 */
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		score += 2;
+	}
+#endif
+
+	return score;
+}
+
+static void conn_mgr_update_default_iface(void)
+{
+	struct net_if *best_iface = NULL;
+	int best_score = 0;
+	int idx;
+
+	for (idx = 0; idx < ARRAY_SIZE(iface_states); idx++) {
+		int score = conn_mgr_iface_score(idx);
+
+		if (score > best_score) {
+			best_score = score;
+			best_iface = net_if_get_by_index(idx + 1);
+		}
+	}
+
+	/* If nothing is connected, keep the current default so that
+	 * outgoing traffic still has an interface to bind to.
+	 */
+	if (!best_iface || best_iface == net_if_get_default()) {
+		return;
+	}
+
+	NET_DBG("Default iface changed to %p (%d)", best_iface,
+		net_if_get_by_iface(best_iface));
+
+	net_if_set_default(best_iface);
+}
+#else
+#define conn_mgr_update_default_iface(...)
+#endif /* CONFIG_NET_CONNECTION_MANAGER_AUTO_FAILOVER */
+
 static void conn_mgr_act_on_changes(void)
 {
+	bool notified = false;
 	int idx;
 
 	for (idx = 0; idx < ARRAY_SIZE(iface_states); idx++) {
@@ -108,13 +165,19 @@ static void conn_mgr_act_on_changes(void)
 			iface_states[idx] |= NET_STATE_CONNECTED;
 
 			conn_mgr_notify_status(idx);
+			notified = true;
 		} else if (state != NET_CONN_MGR_STATE_CONNECTED &&
 			   (iface_states[idx] & NET_STATE_CONNECTED)) {
 			iface_states[idx] &= ~NET_STATE_CONNECTED;
 
 			conn_mgr_notify_status(idx);
+			notified = true;
 		}
 	}
+
+	if (notified) {
+		conn_mgr_update_default_iface();
+	}
 }
 
 static void conn_mgr_initial_state(struct net_if *iface)
@@ -76,6 +76,189 @@ NET_BUF_POOL_DEFINE(dns_qname_pool, DNS_RESOLVER_BUF_CTR, DNS_MAX_NAME_LEN,
 
 static struct dns_resolve_context dns_default_ctx;
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+/* A cached answer. A positive entry holds one resolved address, so a name
+ * that resolves to multiple addresses occupies multiple entries. A negative
+ * entry caches a "no such name" answer and holds no address.
+ */
+struct dns_cache_entry {
+	/** Queried name, forms the lookup key together with the type */
+	char query[DNS_MAX_NAME_LEN + 1];
+
+	/** Resolved address (positive entries only) */
+	struct dns_addrinfo info;
+
+	/** Uptime (ms) when the entry expires */
+	int64_t expiry;
+
+	/** Query type (A or AAAA) */
+	enum dns_query_type query_type;
+
+	/** Entry caches a negative answer */
+	bool is_negative;
+
+	/** Entry is valid */
+	bool in_use;
+};
+
+static struct dns_cache_entry dns_cache[CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES];
+static K_MUTEX_DEFINE(dns_cache_lock);
+
+static bool dns_cache_entry_valid(struct dns_cache_entry *entry, int64_t now)
+{
+	return entry->in_use && entry->expiry > now;
+}
+
+/* Cache an answer for the given query. A NULL info caches a negative
+ * answer for CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL seconds, which also
+ * invalidates any positive entries for the name; the ttl parameter is
+ * ignored in that case.
+ */
+static void dns_cache_add(const char *query, enum dns_query_type query_type,
+			  struct dns_addrinfo *info, uint32_t ttl)
+{
+	struct dns_cache_entry *entry = NULL;
+	struct dns_cache_entry *victim = NULL;
+	int64_t now = k_uptime_get();
+	int i;
+
+	if (info == NULL) {
+		ttl = CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL;
+	}
+
+	if (ttl == 0U || strlen(query) > DNS_MAX_NAME_LEN) {
+		return;
+	}
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *cache = &dns_cache[i];
+
+		if (!dns_cache_entry_valid(cache, now)) {
+			if (entry == NULL) {
+				entry = cache;
+			}
+
+			continue;
+		}
+
+		if (cache->query_type != query_type ||
+		    strcmp(cache->query, query) != 0) {
+			if (victim == NULL || cache->expiry < victim->expiry) {
+				victim = cache;
+			}
+
+			continue;
+		}
+
+		if (info == NULL) {
+			/* The name no longer resolves, drop stale
+			 * positive entries for it.
+			 */
+			cache->in_use = false;
+			entry = cache;
+			continue;
+		}
+
+		if (cache->is_negative ||
+		    (cache->info.ai_addrlen == info->ai_addrlen &&
+		     memcmp(&cache->info.ai_addr, &info->ai_addr,
+			    info->ai_addrlen) == 0)) {
+			/* Same answer, just refresh the TTL. */
+			entry = cache;
+			break;
+		}
+	}
+
+	if (entry == NULL) {
+		entry = victim;
+	}
+
+	if (entry == NULL) {
+		goto unlock;
+	}
+
+	strcpy(entry->query, query);
+	entry->query_type = query_type;
+	entry->expiry = now + ttl * MSEC_PER_SEC;
+	entry->is_negative = (info == NULL);
+
+	if (info) {
+		memcpy(&entry->info, info, sizeof(entry->info));
+	}
+
+	entry->in_use = true;
+
+unlock:
+	k_mutex_unlock(&dns_cache_lock);
+}
+
+/* Try to answer the query from the cache. Returns the number of answers
+ * delivered through the callback, 0 if the name was not found in the cache.
+ */
+static int dns_cache_lookup(const char *query, enum dns_query_type query_type,
+			    dns_resolve_cb_t cb, void *user_data)
+{
+	int64_t now = k_uptime_get();
+	bool is_negative = false;
+	int i, found = 0;
+
+	k_mutex_lock(&dns_cache_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(dns_cache); i++) {
+		struct dns_cache_entry *cache = &dns_cache[i];
+
+		if (!dns_cache_entry_valid(cache, now) ||
+		    cache->query_type != query_type ||
+		    strcmp(cache->query, query) != 0) {
+			continue;
+		}
+
+		if (cache->is_negative) {
+			is_negative = true;
+			found = 1;
+			break;
+		}
+
+		cb(DNS_EAI_INPROGRESS, &cache->info, user_data);
+		found++;
+	}
+
+	if (found > 0) {
+		NET_DBG("Answering %s from cache%s", log_strdup(query),
+			is_negative ? " (negative)" : "");
+
+		cb(is_negative ? DNS_EAI_NODATA : DNS_EAI_ALLDONE,
+		   NULL, user_data);
+	}
+
+	k_mutex_unlock(&dns_cache_lock);
+
+	return found;
+}
+#else /* CONFIG_DNS_RESOLVER_CACHE */
+static void dns_cache_add(const char *query, enum dns_query_type query_type,
+			  struct dns_addrinfo *info, uint32_t ttl)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(query_type);
+	ARG_UNUSED(info);
+	ARG_UNUSED(ttl);
+}
+
+static int dns_cache_lookup(const char *query, enum dns_query_type query_type,
+			    dns_resolve_cb_t cb, void *user_data)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(query_type);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+
+	return 0;
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 static int dns_write(struct dns_resolve_context *ctx,
 		     int server_idx,
 		     int query_idx,
@@ -369,7 +552,7 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		     uint16_t *query_hash)
 {
 	struct dns_addrinfo info = { 0 };
-	uint32_t ttl; /* RR ttl, so far it is not passed to caller */
+	uint32_t ttl; /* RR ttl, used to limit the cached answer lifetime */
 	uint8_t *src, *addr;
 	const char *query_name;
 	int address_size;
@@ -528,6 +711,15 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 			src = dns_msg->msg + dns_msg->response_position;
 			memcpy(addr, src, address_size);
 
+			/* The query name may be unset when this function is
+			 * called directly by the unit tests.
+			 */
+			if (ctx->queries[*query_idx].query) {
+				dns_cache_add(ctx->queries[*query_idx].query,
+					ctx->queries[*query_idx].query_type,
+					&info, ttl);
+			}
+
 		query_known:
 			ctx->queries[*query_idx].cb(DNS_EAI_INPROGRESS, &info,
 					ctx->queries[*query_idx].user_data);
@@ -745,6 +937,11 @@ quit:
 		goto free_buf;
 	}
 
+	if (ret == DNS_EAI_NODATA && ctx->queries[i].query) {
+		dns_cache_add(ctx->queries[i].query,
+			      ctx->queries[i].query_type, NULL, 0);
+	}
+
 	if (k_delayed_work_remaining_get(&ctx->queries[i].timer) > 0) {
 		k_delayed_work_cancel(&ctx->queries[i].timer);
 	}
@@ -1012,6 +1209,13 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	}
 
 try_resolve:
+	/* Check the cache first so that a recently resolved name is not
+	 * queried from the server again.
+	 */
+	if (dns_cache_lookup(query, type, cb, user_data) > 0) {
+		return 0;
+	}
+
 	i = get_cb_slot(ctx);
 	if (i < 0) {
 		return -EAGAIN;
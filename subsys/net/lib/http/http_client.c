@@ -352,6 +352,12 @@ static int on_message_complete(struct http_parser *parser)
 
 	req->internal.response.message_complete = 1;
 
+	/* Pause the parser so that it does not run into a possible pipelined
+	 * response following this one in the receive buffer. The parser is
+	 * re-initialized for every request so it never needs to be resumed.
+	 */
+	http_parser_pause(parser, 1);
+
 	if (req->internal.response.cb) {
 		req->internal.response.cb(&req->internal.response,
 					  HTTP_DATA_FINAL,
@@ -453,6 +459,83 @@ static int http_wait_data(int sock, struct http_request *req)
 	return ret;
 }
 
+static int http_wait_data_pipelined(int sock, struct http_request *req,
+				    uint8_t **carry, size_t *carry_len)
+{
+	struct http_response *rsp = &req->internal.response;
+	int total_received = 0;
+	size_t offset = 0;
+	size_t parsed;
+	int received;
+
+	if (*carry_len > 0) {
+		if (*carry_len > rsp->recv_buf_len) {
+			return -ENOBUFS;
+		}
+
+		/* The carried over bytes live in the previous response
+		 * buffer, which may be this very same buffer, so move
+		 * instead of copy.
+		 */
+		memmove(rsp->recv_buf, *carry, *carry_len);
+		offset = *carry_len;
+		*carry_len = 0;
+
+		rsp->data_len += offset;
+
+		parsed = http_parser_execute(&req->internal.parser,
+					     &req->internal.parser_settings,
+					     rsp->recv_buf, offset);
+
+		total_received += offset;
+
+		if (rsp->message_complete) {
+			*carry = rsp->recv_buf + parsed;
+			*carry_len = offset - parsed;
+			return total_received;
+		}
+
+		if (offset >= rsp->recv_buf_len) {
+			offset = 0;
+		}
+	}
+
+	do {
+		received = recv(sock, rsp->recv_buf + offset,
+				rsp->recv_buf_len - offset, 0);
+		if (received == 0) {
+			/* Connection closed */
+			LOG_DBG("Connection closed");
+			return total_received;
+		} else if (received < 0) {
+			/* Socket error */
+			LOG_DBG("Connection error (%d)", errno);
+			return -errno;
+		}
+
+		rsp->data_len += received;
+
+		parsed = http_parser_execute(&req->internal.parser,
+					     &req->internal.parser_settings,
+					     rsp->recv_buf + offset,
+					     received);
+
+		total_received += received;
+
+		if (rsp->message_complete) {
+			*carry = rsp->recv_buf + offset + parsed;
+			*carry_len = received - parsed;
+			return total_received;
+		}
+
+		offset += received;
+
+		if (offset >= rsp->recv_buf_len) {
+			offset = 0;
+		}
+	} while (true);
+}
+
 static void http_timeout(struct k_work *work)
 {
 	struct http_client_internal_data *data =
@@ -461,32 +544,17 @@ static void http_timeout(struct k_work *work)
 	(void)close(data->sock);
 }
 
-int http_client_req(int sock, struct http_request *req,
-		    int32_t timeout, void *user_data)
+static int http_send_request(int sock, struct http_request *req,
+			     void *user_data)
 {
 	/* Utilize the network usage by sending data in bigger blocks */
 	char send_buf[MAX_SEND_BUF_LEN];
 	const size_t send_buf_max_len = sizeof(send_buf);
 	size_t send_buf_pos = 0;
 	int total_sent = 0;
-	int ret, total_recv, i;
+	int ret, i;
 	const char *method;
 
-	if (sock < 0 || req == NULL || req->response == NULL ||
-	    req->recv_buf == NULL || req->recv_buf_len == 0) {
-		return -EINVAL;
-	}
-
-	memset(&req->internal.response, 0, sizeof(req->internal.response));
-
-	req->internal.response.http_cb = req->http_cb;
-	req->internal.response.cb = req->response;
-	req->internal.response.recv_buf = req->recv_buf;
-	req->internal.response.recv_buf_len = req->recv_buf_len;
-	req->internal.user_data = user_data;
-	req->internal.sock = sock;
-	req->internal.timeout = SYS_TIMEOUT_MS(timeout);
-
 	method = http_method_str(req->method);
 
 	ret = http_send_data(sock, send_buf, send_buf_max_len, &send_buf_pos,
@@ -647,6 +715,45 @@ int http_client_req(int sock, struct http_request *req,
 
 	NET_DBG("Sent %d bytes", total_sent);
 
+	return total_sent;
+
+out:
+	return ret;
+}
+
+static void http_setup_internal(int sock, struct http_request *req,
+				int32_t timeout, void *user_data)
+{
+	memset(&req->internal.response, 0, sizeof(req->internal.response));
+
+	req->internal.response.http_cb = req->http_cb;
+	req->internal.response.cb = req->response;
+	req->internal.response.recv_buf = req->recv_buf;
+	req->internal.response.recv_buf_len = req->recv_buf_len;
+	req->internal.user_data = user_data;
+	req->internal.sock = sock;
+	req->internal.timeout = SYS_TIMEOUT_MS(timeout);
+}
+
+int http_client_req(int sock, struct http_request *req,
+		    int32_t timeout, void *user_data)
+{
+	int ret, total_sent, total_recv;
+
+	if (sock < 0 || req == NULL || req->response == NULL ||
+	    req->recv_buf == NULL || req->recv_buf_len == 0) {
+		return -EINVAL;
+	}
+
+	http_setup_internal(sock, req, timeout, user_data);
+
+	ret = http_send_request(sock, req, user_data);
+	if (ret < 0) {
+		return ret;
+	}
+
+	total_sent = ret;
+
 	http_client_init_parser(&req->internal.parser,
 				&req->internal.parser_settings);
 
@@ -671,7 +778,80 @@ int http_client_req(int sock, struct http_request *req,
 	}
 
 	return total_sent;
+}
 
-out:
-	return ret;
+int http_client_pipeline(int sock, struct http_request **reqs, size_t num_reqs,
+			 int32_t timeout, void *user_data)
+{
+	struct http_request *req;
+	uint8_t *carry = NULL;
+	size_t carry_len = 0;
+	int total_sent = 0;
+	int ret;
+	size_t i;
+
+	if (sock < 0 || reqs == NULL || num_reqs == 0) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < num_reqs; i++) {
+		req = reqs[i];
+
+		if (req == NULL || req->response == NULL ||
+		    req->recv_buf == NULL || req->recv_buf_len == 0) {
+			return -EINVAL;
+		}
+	}
+
+	/* Send all the requests back to back before reading anything so
+	 * that the server can already work on the next request while the
+	 * previous response is in flight.
+	 */
+	for (i = 0; i < num_reqs; i++) {
+		req = reqs[i];
+
+		http_setup_internal(sock, req, timeout, user_data);
+
+		ret = http_send_request(sock, req, user_data);
+		if (ret < 0) {
+			return ret;
+		}
+
+		total_sent += ret;
+
+		http_client_init_parser(&req->internal.parser,
+					&req->internal.parser_settings);
+	}
+
+	/* The responses arrive in the same order the requests were sent.
+	 * Bytes belonging to the next response that were received together
+	 * with the tail of the previous one are carried over to the next
+	 * parser.
+	 */
+	for (i = 0; i < num_reqs; i++) {
+		req = reqs[i];
+
+		if (!K_TIMEOUT_EQ(req->internal.timeout, K_FOREVER) &&
+		    !K_TIMEOUT_EQ(req->internal.timeout, K_NO_WAIT)) {
+			k_delayed_work_init(&req->internal.work, http_timeout);
+			(void)k_delayed_work_submit(&req->internal.work,
+						    req->internal.timeout);
+		}
+
+		ret = http_wait_data_pipelined(sock, req, &carry, &carry_len);
+
+		if (!K_TIMEOUT_EQ(req->internal.timeout, K_FOREVER) &&
+		    !K_TIMEOUT_EQ(req->internal.timeout, K_NO_WAIT)) {
+			(void)k_delayed_work_cancel(&req->internal.work);
+		}
+
+		if (ret < 0) {
+			NET_DBG("Wait data failure (%d)", ret);
+			return ret;
+		}
+
+		NET_DBG("Received %d bytes", ret);
+	}
+
+	return total_sent;
 }
@@ -123,6 +123,27 @@ static sys_slist_t engine_obj_inst_list;
 static sys_slist_t engine_observer_list;
 static sys_slist_t engine_service_list;
 
+/* Hash index over the object and object instance lists, keyed on the
+ * numeric path, so that lookups do not walk every registered entry.
+ * Bucket counts must be powers of two.
+ */
+#define ENGINE_OBJ_HASH_BUCKETS		8
+#define ENGINE_OBJ_INST_HASH_BUCKETS	16
+
+static sys_slist_t engine_obj_hash[ENGINE_OBJ_HASH_BUCKETS];
+static sys_slist_t engine_obj_inst_hash[ENGINE_OBJ_INST_HASH_BUCKETS];
+
+static inline sys_slist_t *engine_obj_bucket(int obj_id)
+{
+	return &engine_obj_hash[obj_id & (ENGINE_OBJ_HASH_BUCKETS - 1)];
+}
+
+static inline sys_slist_t *engine_obj_inst_bucket(int obj_id, int obj_inst_id)
+{
+	return &engine_obj_inst_hash[(obj_id * 31 + obj_inst_id) &
+				     (ENGINE_OBJ_INST_HASH_BUCKETS - 1)];
+}
+
 static K_KERNEL_STACK_DEFINE(engine_thread_stack,
 			      CONFIG_LWM2M_ENGINE_STACK_SIZE);
 static struct k_thread engine_thread_data;
@@ -591,19 +612,23 @@ static void engine_remove_observer_by_id(uint16_t obj_id, int32_t obj_inst_id)
 void lwm2m_register_obj(struct lwm2m_engine_obj *obj)
 {
 	sys_slist_append(&engine_obj_list, &obj->node);
+	sys_slist_append(engine_obj_bucket(obj->obj_id), &obj->hash_node);
 }
 
 void lwm2m_unregister_obj(struct lwm2m_engine_obj *obj)
 {
 	engine_remove_observer_by_id(obj->obj_id, -1);
 	sys_slist_find_and_remove(&engine_obj_list, &obj->node);
+	sys_slist_find_and_remove(engine_obj_bucket(obj->obj_id),
+				  &obj->hash_node);
 }
 
 static struct lwm2m_engine_obj *get_engine_obj(int obj_id)
 {
 	struct lwm2m_engine_obj *obj;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_list, obj, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER(engine_obj_bucket(obj_id), obj,
+				     hash_node) {
 		if (obj->obj_id == obj_id) {
 			return obj;
 		}
@@ -633,6 +658,9 @@ lwm2m_get_engine_obj_field(struct lwm2m_engine_obj *obj, int res_id)
 static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 {
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_append(engine_obj_inst_bucket(obj_inst->obj->obj_id,
+						obj_inst->obj_inst_id),
+			 &obj_inst->hash_node);
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -640,6 +668,10 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 	engine_remove_observer_by_id(
 			obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_find_and_remove(
+			engine_obj_inst_bucket(obj_inst->obj->obj_id,
+					       obj_inst->obj_inst_id),
+			&obj_inst->hash_node);
 }
 
 static struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id,
@@ -647,8 +679,9 @@ static struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id,
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst,
-				     node) {
+	SYS_SLIST_FOR_EACH_CONTAINER(engine_obj_inst_bucket(obj_id,
+							    obj_inst_id),
+				     obj_inst, hash_node) {
 		if (obj_inst->obj->obj_id == obj_id &&
 		    obj_inst->obj_inst_id == obj_inst_id) {
 			return obj_inst;
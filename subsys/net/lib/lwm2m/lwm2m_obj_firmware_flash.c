@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2017 Linaro Limited
+ * Copyright (c) 2018-2019 Foundries.io
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Default firmware package writer which streams each incoming block
+ * straight into the MCUboot secondary slot, so the image is never
+ * buffered in RAM.
+ */
+
+#define LOG_MODULE_NAME net_lwm2m_obj_firmware_flash
+#define LOG_LEVEL CONFIG_LWM2M_LOG_LEVEL
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(LOG_MODULE_NAME);
+
+#include <init.h>
+#include <dfu/flash_img.h>
+
+#include <net/lwm2m.h>
+
+static struct flash_img_context flash_ctx;
+static bool transfer_ongoing;
+
+static int firmware_flash_write(uint16_t obj_inst_id, uint16_t res_id,
+				uint16_t res_inst_id, uint8_t *data,
+				uint16_t data_len, bool last_block,
+				size_t total_size)
+{
+	int ret;
+
+	ARG_UNUSED(obj_inst_id);
+	ARG_UNUSED(res_id);
+	ARG_UNUSED(res_inst_id);
+	ARG_UNUSED(total_size);
+
+	if (!transfer_ongoing) {
+		ret = flash_img_init(&flash_ctx);
+		if (ret < 0) {
+			LOG_ERR("Cannot setup flash write context (%d)", ret);
+			return ret;
+		}
+
+		transfer_ongoing = true;
+	}
+
+	ret = flash_img_buffered_write(&flash_ctx, data, data_len,
+				       last_block);
+	if (ret < 0) {
+		LOG_ERR("Flash write failed (%d)", ret);
+		transfer_ongoing = false;
+		return ret;
+	}
+
+	if (last_block) {
+		LOG_INF("Firmware package fully written (%zd bytes)",
+			flash_img_bytes_written(&flash_ctx));
+		transfer_ongoing = false;
+	}
+
+	return 0;
+}
+
+static int firmware_flash_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	/* Applications can still override this default with
+	 * lwm2m_firmware_set_write_cb() as they initialize later.
+	 */
+	lwm2m_firmware_set_write_cb(firmware_flash_write);
+
+	return 0;
+}
+
+SYS_INIT(firmware_flash_init, APPLICATION,
+	 CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -177,6 +177,9 @@ struct lwm2m_engine_obj {
 	/* object list */
 	sys_snode_t node;
 
+	/* object id hash bucket */
+	sys_snode_t hash_node;
+
 	/* object field definitions */
 	struct lwm2m_engine_obj_field *fields;
 
@@ -347,6 +350,9 @@ struct lwm2m_engine_obj_inst {
 	/* instance list */
 	sys_snode_t node;
 
+	/* instance path hash bucket */
+	sys_snode_t hash_node;
+
 	struct lwm2m_engine_obj *obj;
 	struct lwm2m_engine_res *resources;
 
@@ -287,6 +287,83 @@ error:
 	return err_code;
 }
 
+int mqtt_publish_multiple(struct mqtt_client *client,
+			  const struct mqtt_publish_param *param,
+			  size_t count)
+{
+	int err_code;
+	struct buf_ctx packet;
+	struct iovec io_vector[2 * CONFIG_MQTT_PUBLISH_BATCH_MAX];
+	struct msghdr msg;
+	uint8_t *buf_pos;
+	size_t iov_count = 0;
+	size_t i;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(param);
+
+	if (count == 0U || count > CONFIG_MQTT_PUBLISH_BATCH_MAX) {
+		return -EINVAL;
+	}
+
+	MQTT_TRC("[CID %p]:[State 0x%02x]: >> Message count 0x%08x",
+		 client, client->internal.state, (uint32_t)count);
+
+	mqtt_mutex_lock(client);
+
+	tx_buf_init(client, &packet);
+
+	err_code = verify_tx_state(client);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	buf_pos = client->tx_buf;
+
+	for (i = 0; i < count; i++) {
+		/* Encode each message right after the previous one. The
+		 * payloads are referenced from the I/O vector and need
+		 * no room in the buffer.
+		 */
+		packet.cur = buf_pos;
+		packet.end = client->tx_buf + client->tx_buf_size;
+
+		err_code = publish_encode(&param[i], &packet);
+		if (err_code < 0) {
+			goto error;
+		}
+
+		io_vector[iov_count].iov_base = packet.cur;
+		io_vector[iov_count].iov_len = packet.end - packet.cur;
+		iov_count++;
+
+		if (param[i].message.payload.len > 0U) {
+			io_vector[iov_count].iov_base =
+					param[i].message.payload.data;
+			io_vector[iov_count].iov_len =
+					param[i].message.payload.len;
+			iov_count++;
+		}
+
+		buf_pos = packet.end;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = iov_count;
+
+	err_code = client_write_msg(client, &msg);
+
+error:
+	MQTT_TRC("[CID %p]:[State 0x%02x]: << result 0x%08x",
+		 client, client->internal.state, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
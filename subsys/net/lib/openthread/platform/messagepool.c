@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread platform abstraction
+ *   for the message pool.
+ *
+ */
+
+#include <kernel.h>
+#include <sys/__assert.h>
+
+#include <openthread/platform/messagepool.h>
+
+#define MESSAGE_POOL_SIZE CONFIG_OPENTHREAD_NUM_MESSAGE_BUFFERS
+#define MESSAGE_POOL_BUFFER_SIZE CONFIG_OPENTHREAD_MESSAGE_BUFFER_SIZE
+
+K_MEM_SLAB_DEFINE(message_pool, MESSAGE_POOL_BUFFER_SIZE,
+		  MESSAGE_POOL_SIZE, 4);
+
+void otPlatMessagePoolInit(otInstance *aInstance, uint16_t aMinNumFreeBuffers,
+			   size_t aBufferSize)
+{
+	ARG_UNUSED(aInstance);
+	ARG_UNUSED(aMinNumFreeBuffers);
+
+	__ASSERT(aBufferSize == MESSAGE_POOL_BUFFER_SIZE,
+		 "Message buffer size does not match the slab block size");
+}
+
+otMessageBuffer *otPlatMessagePoolNew(otInstance *aInstance)
+{
+	void *buffer;
+
+	ARG_UNUSED(aInstance);
+
+	if (k_mem_slab_alloc(&message_pool, &buffer, K_NO_WAIT) != 0) {
+		return NULL;
+	}
+
+	return buffer;
+}
+
+void otPlatMessagePoolFree(otInstance *aInstance, otMessageBuffer *aBuffer)
+{
+	ARG_UNUSED(aInstance);
+
+	k_mem_slab_free(&message_pool, (void **)&aBuffer);
+}
+
+uint16_t otPlatMessagePoolNumFreeBuffers(otInstance *aInstance)
+{
+	ARG_UNUSED(aInstance);
+
+	return k_mem_slab_num_free_get(&message_pool);
+}
@@ -28,6 +28,28 @@
 	CONFIG_OPENTHREAD_NUM_MESSAGE_BUFFERS
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+ *
+ * The message pool is managed by platform defined logic when this
+ * flag is set.
+ *
+ */
+#ifdef CONFIG_OPENTHREAD_PLATFORM_MESSAGE_MANAGEMENT
+#define OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
+ *
+ * The size of a message buffer in bytes.
+ *
+ */
+#ifdef CONFIG_OPENTHREAD_MESSAGE_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE                                  \
+	CONFIG_OPENTHREAD_MESSAGE_BUFFER_SIZE
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAX_STATECHANGE_HANDLERS
  *
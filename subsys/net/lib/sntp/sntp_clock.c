@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <net/sntp.h>
+
+#include "sntp_internal.h"
+
+/* Fold the slew accrued since the last update into the offset so that
+ * the rate can be changed without the already-corrected time jumping.
+ */
+static void sntp_clock_fold_slew(struct sntp_clock *clock, int64_t now)
+{
+	clock->offset_ms += ((now - clock->last_update) * clock->slew_ppm) /
+			    1000000;
+	clock->last_update = now;
+}
+
+int64_t sntp_clock_discipline(struct sntp_clock *clock,
+			      const struct sntp_time *time)
+{
+	int64_t now = k_uptime_get();
+	int64_t err;
+
+	if (!clock->initialized) {
+		/* The first measurement can only step the clock. */
+		clock->offset_ms = sntp_time_to_ms(time) - now;
+		clock->slew_ppm = 0;
+		clock->last_update = now;
+		clock->initialized = true;
+
+		return 0;
+	}
+
+	sntp_clock_fold_slew(clock, now);
+
+	err = sntp_time_to_ms(time) - (now + clock->offset_ms);
+
+	if (err > CONFIG_SNTP_CLOCK_STEP_THRESHOLD ||
+	    err < -CONFIG_SNTP_CLOCK_STEP_THRESHOLD) {
+		/* Too large to amortize in reasonable time. */
+		clock->offset_ms += err;
+		clock->slew_ppm = 0;
+	} else {
+		/* Adjust the rate so that the error is corrected over
+		 * the configured slew period instead of the time
+		 * stepping.
+		 */
+		int64_t slew = (err * 1000) / CONFIG_SNTP_CLOCK_SLEW_PERIOD;
+
+		slew = MAX(slew, -CONFIG_SNTP_CLOCK_MAX_SLEW_PPM);
+		slew = MIN(slew, CONFIG_SNTP_CLOCK_MAX_SLEW_PPM);
+
+		clock->slew_ppm = (int32_t)slew;
+	}
+
+	return err;
+}
+
+int sntp_clock_get(const struct sntp_clock *clock, struct sntp_time *time)
+{
+	int64_t now;
+	int64_t est;
+
+	if (!clock->initialized) {
+		return -EAGAIN;
+	}
+
+	now = k_uptime_get();
+	est = now + clock->offset_ms +
+	      ((now - clock->last_update) * clock->slew_ppm) / 1000000;
+
+	sntp_ms_to_time(est, time);
+
+	return 0;
+}
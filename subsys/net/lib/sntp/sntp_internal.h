@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2017 Linaro Limited
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SNTP_INTERNAL_H_
+#define SNTP_INTERNAL_H_
+
+#include <net/sntp.h>
+
+/* Upper bound for the sample buffer of sntp_simple_burst(). */
+#define SNTP_BURST_MAX_SAMPLES 16
+
+static inline int64_t sntp_time_to_ms(const struct sntp_time *time)
+{
+	return (int64_t)(time->seconds * MSEC_PER_SEC) +
+	       (int64_t)(((uint64_t)time->fraction * MSEC_PER_SEC) >> 32);
+}
+
+static inline void sntp_ms_to_time(int64_t ms, struct sntp_time *time)
+{
+	time->seconds = ms / MSEC_PER_SEC;
+	time->fraction = (uint32_t)((((uint64_t)ms % MSEC_PER_SEC) << 32) /
+				    MSEC_PER_SEC);
+}
+
+#endif /* SNTP_INTERNAL_H_ */
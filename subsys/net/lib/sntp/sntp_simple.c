@@ -8,45 +8,49 @@
 #include <net/sntp.h>
 #include <net/socketutils.h>
 
-int sntp_simple(const char *server, uint32_t timeout, struct sntp_time *time)
+#include "sntp_internal.h"
+
+static int sntp_simple_resolve(const char *server, struct addrinfo **addr)
 {
-	int res;
 	static struct addrinfo hints;
-	struct addrinfo *addr;
-	struct sntp_ctx sntp_ctx;
-	uint64_t deadline;
-	uint32_t iter_timeout;
+	int res;
 
 	hints.ai_family = AF_INET;
 	hints.ai_socktype = SOCK_DGRAM;
 	hints.ai_protocol = 0;
 	/* 123 is the standard SNTP port per RFC4330 */
-	res = net_getaddrinfo_addr_str(server, "123", &hints, &addr);
+	res = net_getaddrinfo_addr_str(server, "123", &hints, addr);
 
 	if (res < 0) {
 		/* Just in case, as namespace for getaddrinfo errors is
 		 * different from errno errors.
 		 */
 		errno = EDOM;
-		return res;
 	}
 
-	res = sntp_init(&sntp_ctx, addr->ai_addr, addr->ai_addrlen);
-	if (res < 0) {
-		goto freeaddr;
-	}
+	return res;
+}
 
+static uint64_t sntp_simple_deadline(uint32_t timeout)
+{
 	if (timeout == SYS_FOREVER_MS) {
-		deadline = (uint64_t)timeout;
-	} else {
-		deadline = k_uptime_get() + (uint64_t)timeout;
+		return (uint64_t)timeout;
 	}
 
+	return k_uptime_get() + (uint64_t)timeout;
+}
+
+static int sntp_query_backoff(struct sntp_ctx *ctx, uint64_t deadline,
+			      struct sntp_time *time)
+{
+	int res = -ETIMEDOUT;
+	uint32_t iter_timeout;
+
 	/* Timeout for current iteration */
 	iter_timeout = 100;
 
 	while (k_uptime_get() < deadline) {
-		res = sntp_query(&sntp_ctx, iter_timeout, time);
+		res = sntp_query(ctx, iter_timeout, time);
 
 		if (res != -ETIMEDOUT) {
 			break;
@@ -58,6 +62,28 @@ int sntp_simple(const char *server, uint32_t timeout, struct sntp_time *time)
 		}
 	}
 
+	return res;
+}
+
+int sntp_simple(const char *server, uint32_t timeout, struct sntp_time *time)
+{
+	int res;
+	struct addrinfo *addr;
+	struct sntp_ctx sntp_ctx;
+
+	res = sntp_simple_resolve(server, &addr);
+	if (res < 0) {
+		return res;
+	}
+
+	res = sntp_init(&sntp_ctx, addr->ai_addr, addr->ai_addrlen);
+	if (res < 0) {
+		goto freeaddr;
+	}
+
+	res = sntp_query_backoff(&sntp_ctx, sntp_simple_deadline(timeout),
+				 time);
+
 	sntp_close(&sntp_ctx);
 
 freeaddr:
@@ -65,3 +91,88 @@ freeaddr:
 
 	return res;
 }
+
+int sntp_simple_burst(const char *server, uint32_t timeout, uint8_t samples,
+		      struct sntp_time *time)
+{
+	int64_t offsets[SNTP_BURST_MAX_SAMPLES];
+	struct sntp_ctx sntp_ctx;
+	struct addrinfo *addr;
+	uint64_t deadline;
+	uint8_t count = 0U;
+	uint8_t i;
+	int res;
+
+	if (samples == 0U) {
+		return -EINVAL;
+	}
+
+	samples = MIN(samples, SNTP_BURST_MAX_SAMPLES);
+
+	res = sntp_simple_resolve(server, &addr);
+	if (res < 0) {
+		return res;
+	}
+
+	res = sntp_init(&sntp_ctx, addr->ai_addr, addr->ai_addrlen);
+	if (res < 0) {
+		goto freeaddr;
+	}
+
+	deadline = sntp_simple_deadline(timeout);
+
+	/* Collect the clock offset (server time minus local uptime) of
+	 * every successful query. The offsets, unlike the raw
+	 * timestamps, are comparable between the samples so they can be
+	 * filtered below.
+	 */
+	for (i = 0U; i < samples; i++) {
+		struct sntp_time sample;
+		int64_t offset;
+		uint8_t pos;
+
+		res = sntp_query_backoff(&sntp_ctx, deadline, &sample);
+		if (res < 0) {
+			break;
+		}
+
+		offset = sntp_time_to_ms(&sample) - k_uptime_get();
+
+		/* Insertion sort; the burst is small. */
+		for (pos = count; pos > 0U; pos--) {
+			if (offsets[pos - 1] <= offset) {
+				break;
+			}
+
+			offsets[pos] = offsets[pos - 1];
+		}
+
+		offsets[pos] = offset;
+		count++;
+	}
+
+	sntp_close(&sntp_ctx);
+
+	if (count > 0U) {
+		int64_t median;
+
+		/* The median offset discards outlier round trips; with
+		 * an even sample count the two middle offsets are
+		 * averaged.
+		 */
+		if ((count % 2U) == 1U) {
+			median = offsets[count / 2U];
+		} else {
+			median = (offsets[count / 2U - 1U] +
+				  offsets[count / 2U]) / 2;
+		}
+
+		sntp_ms_to_time(median + k_uptime_get(), time);
+		res = 0;
+	}
+
+freeaddr:
+	freeaddrinfo(addr);
+
+	return res;
+}
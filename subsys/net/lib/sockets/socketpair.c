@@ -15,6 +15,7 @@ LOG_MODULE_REGISTER(net_spair, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <syscall_handler.h>
 #include <sys/__assert.h>
 #include <sys/fdtable.h>
+#include <sys/ring_buffer.h>
 
 #include "sockets_internal.h"
 
@@ -52,13 +53,20 @@ __net_socket struct spair {
 	int remote; /**< the remote endpoint file descriptor */
 	uint32_t flags; /**< status and option bits */
 	struct k_sem sem; /**< semaphore for exclusive structure access */
-	struct k_pipe recv_q; /**< receive queue of local endpoint */
+	struct ring_buf recv_q; /**< receive queue of local endpoint */
+	/** do not wake the reader before this many bytes are queued */
+	size_t recv_watermark;
 	/** indicates write of local @a recv_q occurred */
 	struct k_poll_signal write_signal;
 	/** indicates read of local @a recv_q occurred */
 	struct k_poll_signal read_signal;
-	/** buffer for @a recv_q recv_q */
-	uint8_t buf[CONFIG_NET_SOCKETPAIR_BUFFER_SIZE];
+	/** buffer for @a recv_q
+	 *
+	 * The ring buffer reserves one byte to tell a full queue from an
+	 * empty one, so allocate one extra to keep the usable capacity at
+	 * the configured size.
+	 */
+	uint8_t buf[CONFIG_NET_SOCKETPAIR_BUFFER_SIZE + 1];
 };
 
 /* forward declaration */
@@ -106,7 +114,7 @@ static inline size_t spair_write_avail(struct spair *spair)
 		return 0;
 	}
 
-	return k_pipe_write_avail(&remote->recv_q);
+	return ring_buf_space_get(&remote->recv_q);
 }
 
 /**
@@ -117,7 +125,28 @@ static inline size_t spair_write_avail(struct spair *spair)
  */
 static inline size_t spair_read_avail(struct spair *spair)
 {
-	return k_pipe_read_avail(&spair->recv_q);
+	return ring_buf_capacity_get(&spair->recv_q) -
+	       ring_buf_space_get(&spair->recv_q);
+}
+
+/**
+ * Wake a reader blocking on @param spair
+ *
+ * The reader is only woken once at least @ref spair.recv_watermark bytes
+ * have been accumulated, so that a stream of small writes does not pay
+ * for one scheduler round trip each. The watermark defaults to one byte
+ * and can be raised with the @ref SO_RCVLOWAT socket option.
+ */
+static void spair_wake_reader(struct spair *spair)
+{
+	int res;
+
+	if (spair_read_avail(spair) < spair->recv_watermark) {
+		return;
+	}
+
+	res = k_poll_signal_raise(&spair->write_signal, SPAIR_SIG_DATA);
+	__ASSERT(res == 0, "k_poll_signal_raise() failed: %d", res);
 }
 
 /** Swap two 32-bit integers */
@@ -240,7 +269,8 @@ static struct spair *spair_new(void)
 	spair->flags = SPAIR_FLAGS_DEFAULT;
 
 	k_sem_init(&spair->sem, 1, 1);
-	k_pipe_init(&spair->recv_q, spair->buf, sizeof(spair->buf));
+	ring_buf_init(&spair->recv_q, sizeof(spair->buf), spair->buf);
+	spair->recv_watermark = 1;
 	k_poll_signal_init(&spair->write_signal);
 	k_poll_signal_init(&spair->read_signal);
 
@@ -358,14 +388,14 @@ out:
  * be set to @ref EAGAIN.
  *
  * Blocking write operations occur when the @ref O_NONBLOCK flag is @em not
- * set and there is insufficient space in the @em remote @ref spair.pipe.
+ * set and there is insufficient space in the @em remote @ref spair.recv_q.
  *
  * Such a blocking write will suspend execution of the current thread until
  * one of two possible results is received on the @em remote
  * @ref spair.read_signal:
  *
  * 1) @ref SPAIR_SIG_DATA - data has been read from the @em remote
- *    @ref spair.pipe. Thus, allowing more data to be written.
+ *    @ref spair.recv_q. Thus, allowing more data to be written.
  *
  * 2) @ref SPAIR_SIG_CANCEL - the @em remote socketpair endpoint was closed
  *    Receipt of this result is analagous to SIGPIPE from POSIX
@@ -528,12 +558,10 @@ static ssize_t spair_write(void *obj, const void *buffer, size_t count)
 		}
 	}
 
-	res = k_pipe_put(&remote->recv_q, (void *)buffer, count,
-			 &bytes_written, 1, K_NO_WAIT);
-	__ASSERT(res == 0, "k_pipe_put() failed: %d", res);
+	bytes_written = ring_buf_put(&remote->recv_q, buffer, count);
+	__ASSERT(bytes_written > 0, "ring_buf_put() wrote nothing");
 
-	res = k_poll_signal_raise(&remote->write_signal, SPAIR_SIG_DATA);
-	__ASSERT(res == 0, "k_poll_signal_raise() failed: %d", res);
+	spair_wake_reader(remote);
 
 	res = bytes_written;
 
@@ -562,16 +590,16 @@ out:
  * be set to @ref EAGAIN.
  *
  * Blocking read operations occur when the @ref O_NONBLOCK flag is @em not set
- * and there are no bytes to read in the @em local @ref spair.pipe.
+ * and there are no bytes to read in the @em local @ref spair.recv_q.
  *
  * Such a blocking read will suspend execution of the current thread until
  * one of two possible results is received on the @em local
  * @ref spair.write_signal:
  *
  * -# @ref SPAIR_SIG_DATA - data has been written to the @em local
- *    @ref spair.pipe. Thus, allowing more data to be read.
+ *    @ref spair.recv_q. Thus, allowing more data to be read.
  *
- * -# @ref SPAIR_SIG_CANCEL - read of the the @em local @spair.pipe
+ * -# @ref SPAIR_SIG_CANCEL - read of the the @em local @ref spair.recv_q
  *    must be cancelled for some reason (e.g. the file descriptor will be
  *    closed imminently). In this case, the function will return -1 and set
  *    @ref errno to @ref EINTR.
@@ -696,9 +724,8 @@ static ssize_t spair_read(void *obj, void *buffer, size_t count)
 		}
 	}
 
-	res = k_pipe_get(&spair->recv_q, (void *)buffer, count, &bytes_read,
-			 1, K_NO_WAIT);
-	__ASSERT(res == 0, "k_pipe_get() failed: %d", res);
+	bytes_read = ring_buf_get(&spair->recv_q, buffer, count);
+	__ASSERT(bytes_read > 0, "ring_buf_get() read nothing");
 
 	if (is_connected) {
 		res = k_poll_signal_raise(&spair->read_signal, SPAIR_SIG_DATA);
@@ -847,7 +874,7 @@ pollout_done:
 			goto pollin_done;
 		}
 
-		if (spair_read_avail(spair) > 0) {
+		if (spair_read_avail(spair) >= spair->recv_watermark) {
 			pfd->revents |= ZSOCK_POLLIN;
 			goto pollin_done;
 		}
@@ -1097,11 +1124,22 @@ static ssize_t spair_recvfrom(void *obj, void *buf, size_t max_len,
 static int spair_getsockopt(void *obj, int level, int optname,
 			    void *optval, socklen_t *optlen)
 {
-	ARG_UNUSED(obj);
-	ARG_UNUSED(level);
-	ARG_UNUSED(optname);
-	ARG_UNUSED(optval);
-	ARG_UNUSED(optlen);
+	struct spair *const spair = (struct spair *)obj;
+
+	if (spair == NULL || optval == NULL || optlen == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (level == SOL_SOCKET && optname == SO_RCVLOWAT) {
+		if (*optlen != sizeof(int)) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		*(int *)optval = spair->recv_watermark;
+		return 0;
+	}
 
 	errno = ENOPROTOOPT;
 	return -1;
@@ -1110,11 +1148,40 @@ static int spair_getsockopt(void *obj, int level, int optname,
 static int spair_setsockopt(void *obj, int level, int optname,
 			    const void *optval, socklen_t optlen)
 {
-	ARG_UNUSED(obj);
-	ARG_UNUSED(level);
-	ARG_UNUSED(optname);
-	ARG_UNUSED(optval);
-	ARG_UNUSED(optlen);
+	struct spair *const spair = (struct spair *)obj;
+	int res;
+	int value;
+
+	if (spair == NULL || optval == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (level == SOL_SOCKET && optname == SO_RCVLOWAT) {
+		if (optlen != sizeof(int)) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		value = *(const int *)optval;
+		if (value < 1 ||
+		    (uint32_t)value > ring_buf_capacity_get(&spair->recv_q)) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		res = k_sem_take(&spair->sem, K_FOREVER);
+		__ASSERT(res == 0, "failed to take local sem: %d", res);
+
+		spair->recv_watermark = value;
+
+		/* a blocked reader may already have enough queued */
+		spair_wake_reader(spair);
+
+		k_sem_give(&spair->sem);
+
+		return 0;
+	}
 
 	errno = ENOPROTOOPT;
 	return -1;
@@ -1153,3 +1220,148 @@ static const struct socket_op_vtable spair_fd_op_vtable = {
 	.getsockopt = spair_getsockopt,
 	.setsockopt = spair_setsockopt,
 };
+
+/**
+ * Resolve a socketpair file descriptor to a @ref spair
+ *
+ * Common argument checking for the zero-copy accessors below.
+ */
+static struct spair *spair_get(int sock, uint8_t **data, size_t size)
+{
+	struct spair *spair;
+
+	spair = z_get_fd_obj(sock,
+		(const struct fd_op_vtable *)&spair_fd_op_vtable, EBADF);
+	if (spair == NULL) {
+		return NULL;
+	}
+
+	if (data == NULL || size == 0) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return spair;
+}
+
+ssize_t zsock_socketpair_put_claim(int sock, uint8_t **data, size_t size)
+{
+	struct spair *spair;
+	struct spair *remote;
+	ssize_t res;
+
+	spair = spair_get(sock, data, size);
+	if (spair == NULL) {
+		return -1;
+	}
+
+	res = k_sem_take(&spair->sem, K_FOREVER);
+	__ASSERT(res == 0, "failed to take local sem: %d", (int)res);
+
+	remote = z_get_fd_obj(spair->remote,
+		(const struct fd_op_vtable *)&spair_fd_op_vtable, 0);
+	if (remote == NULL) {
+		k_sem_give(&spair->sem);
+		errno = EPIPE;
+		return -1;
+	}
+
+	res = k_sem_take(&remote->sem, K_FOREVER);
+	__ASSERT(res == 0, "failed to take remote sem: %d", (int)res);
+
+	res = ring_buf_put_claim(&remote->recv_q, data, size);
+
+	k_sem_give(&remote->sem);
+	k_sem_give(&spair->sem);
+
+	return res;
+}
+
+int zsock_socketpair_put_finish(int sock, size_t size)
+{
+	struct spair *spair;
+	struct spair *remote;
+	int res;
+
+	spair = z_get_fd_obj(sock,
+		(const struct fd_op_vtable *)&spair_fd_op_vtable, EBADF);
+	if (spair == NULL) {
+		return -1;
+	}
+
+	res = k_sem_take(&spair->sem, K_FOREVER);
+	__ASSERT(res == 0, "failed to take local sem: %d", res);
+
+	remote = z_get_fd_obj(spair->remote,
+		(const struct fd_op_vtable *)&spair_fd_op_vtable, 0);
+	if (remote == NULL) {
+		k_sem_give(&spair->sem);
+		errno = EPIPE;
+		return -1;
+	}
+
+	res = k_sem_take(&remote->sem, K_FOREVER);
+	__ASSERT(res == 0, "failed to take remote sem: %d", res);
+
+	res = ring_buf_put_finish(&remote->recv_q, size);
+	if (res < 0) {
+		errno = EINVAL;
+		res = -1;
+	} else {
+		spair_wake_reader(remote);
+	}
+
+	k_sem_give(&remote->sem);
+	k_sem_give(&spair->sem);
+
+	return res;
+}
+
+ssize_t zsock_socketpair_get_claim(int sock, uint8_t **data, size_t size)
+{
+	struct spair *spair;
+	ssize_t res;
+
+	spair = spair_get(sock, data, size);
+	if (spair == NULL) {
+		return -1;
+	}
+
+	res = k_sem_take(&spair->sem, K_FOREVER);
+	__ASSERT(res == 0, "failed to take local sem: %d", (int)res);
+
+	res = ring_buf_get_claim(&spair->recv_q, data, size);
+
+	k_sem_give(&spair->sem);
+
+	return res;
+}
+
+int zsock_socketpair_get_finish(int sock, size_t size)
+{
+	struct spair *spair;
+	int res;
+
+	spair = z_get_fd_obj(sock,
+		(const struct fd_op_vtable *)&spair_fd_op_vtable, EBADF);
+	if (spair == NULL) {
+		return -1;
+	}
+
+	res = k_sem_take(&spair->sem, K_FOREVER);
+	__ASSERT(res == 0, "failed to take local sem: %d", res);
+
+	res = ring_buf_get_finish(&spair->recv_q, size);
+	if (res < 0) {
+		errno = EINVAL;
+		res = -1;
+	} else if (sock_is_connected(spair)) {
+		/* wake a writer blocked on a previously full queue */
+		res = k_poll_signal_raise(&spair->read_signal, SPAIR_SIG_DATA);
+		__ASSERT(res == 0, "k_poll_signal_raise() failed: %d", res);
+	}
+
+	k_sem_give(&spair->sem);
+
+	return res;
+}
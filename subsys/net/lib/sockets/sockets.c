@@ -125,6 +125,8 @@ static void zsock_flush_queue(struct net_context *ctx)
 			net_context_put(p);
 		} else {
 			NET_DBG("discarding pkt %p", p);
+			net_context_rcvbuf_uncharge(
+				ctx, net_pkt_remaining_data(p));
 			net_pkt_unref(p);
 		}
 	}
@@ -674,6 +676,80 @@ ssize_t z_vrfy_zsock_sendto(int sock, const void *buf, size_t len, int flags,
 #include <syscalls/zsock_sendto_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#if defined(CONFIG_NET_CONTEXT_SENDBUF)
+ssize_t zsock_sendbuf_ctx(struct net_context *ctx, struct net_buf *buffer)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint64_t buf_timeout = 0;
+	int status;
+
+	if (sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		buf_timeout = z_timeout_end_calc(MAX_WAIT_BUFS);
+	}
+
+	/* Register the callback before sending in order to receive the response
+	 * from the peer.
+	 */
+	status = net_context_recv(ctx, zsock_received_cb,
+				  K_NO_WAIT, ctx->user_data);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	while (1) {
+		status = net_context_send_buf(ctx, buffer, NULL, timeout,
+					      ctx->user_data);
+		if (status < 0) {
+			if (((status == -ENOBUFS) || (status == -EAGAIN)) &&
+			    K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+				/* The loaned buffer stays with the caller on
+				 * error, so it can simply be offered again
+				 * once buffers or window space free up.
+				 */
+				int64_t remaining = buf_timeout - z_tick_get();
+
+				if (remaining <= 0) {
+					if (status == -ENOBUFS) {
+						errno = ENOMEM;
+					} else {
+						errno = ENOBUFS;
+					}
+
+					return -1;
+				}
+
+				k_sleep(WAIT_BUFS);
+				continue;
+			} else {
+				errno = -status;
+				return -1;
+			}
+		}
+
+		break;
+	}
+
+	return status;
+}
+
+ssize_t zsock_sendbuf(int sock, struct net_buf *buffer)
+{
+	struct net_context *ctx;
+
+	ctx = z_get_fd_obj(sock,
+			   (const struct fd_op_vtable *)&sock_fd_op_vtable,
+			   EOPNOTSUPP);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	return zsock_sendbuf_ctx(ctx, buffer);
+}
+#endif /* CONFIG_NET_CONTEXT_SENDBUF */
+
 ssize_t zsock_sendmsg_ctx(struct net_context *ctx, const struct msghdr *msg,
 			  int flags)
 {
@@ -920,6 +996,17 @@ void net_socket_update_tc_rx_time(struct net_pkt *pkt, uint32_t end_tick)
 	}
 }
 
+/* Busy-poll the receive queue instead of sleeping on it. Yielding lets
+ * the RX thread run and deliver the packet, the receiver just never
+ * pays for the fifo sleep/wakeup round trip.
+ */
+static void sock_busy_poll_recv_q(struct net_context *ctx)
+{
+	while (k_fifo_is_empty(&ctx->recv_q) && !sock_is_eof(ctx)) {
+		k_yield();
+	}
+}
+
 static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 				       void *buf,
 				       size_t max_len,
@@ -934,6 +1021,9 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 
 	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
 		timeout = K_NO_WAIT;
+	} else if (sock_is_busy_poll(ctx)) {
+		sock_busy_poll_recv_q(ctx);
+		timeout = K_NO_WAIT;
 	}
 
 	if (flags & ZSOCK_MSG_PEEK) {
@@ -958,6 +1048,14 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 
 	net_pkt_cursor_backup(pkt, &backup);
 
+	if (!(flags & ZSOCK_MSG_PEEK)) {
+		/* The whole datagram leaves the queue even if the
+		 * application buffer is smaller, so return all of it to
+		 * the receive buffer budget.
+		 */
+		net_context_rcvbuf_uncharge(ctx, net_pkt_remaining_data(pkt));
+	}
+
 	if (src_addr && addrlen) {
 		int rv;
 
@@ -1039,7 +1137,13 @@ static inline ssize_t zsock_recv_stream(struct net_context *ctx,
 			return 0;
 		}
 
-		res = k_fifo_wait_non_empty(&ctx->recv_q, timeout);
+		if (sock_is_busy_poll(ctx) &&
+		    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			sock_busy_poll_recv_q(ctx);
+			res = 0;
+		} else {
+			res = k_fifo_wait_non_empty(&ctx->recv_q, timeout);
+		}
 		/* EAGAIN when timeout expired, EINTR when cancelled */
 		if (res && res != -EAGAIN && res != -EINTR) {
 			errno = -res;
@@ -1486,6 +1590,21 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 	switch (level) {
 	case SOL_SOCKET:
 		switch (optname) {
+		case SO_RCVBUF:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_RCVBUF)) {
+				ret = net_context_get_option(ctx,
+							     NET_OPT_RCVBUF,
+							     optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case SO_TXTIME:
 			if (IS_ENABLED(CONFIG_NET_CONTEXT_TXTIME)) {
 				ret = net_context_get_option(ctx,
@@ -1558,6 +1677,21 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 			 */
 			return 0;
 
+		case SO_RCVBUF:
+			if (IS_ENABLED(CONFIG_NET_CONTEXT_RCVBUF)) {
+				ret = net_context_set_option(ctx,
+							     NET_OPT_RCVBUF,
+							     optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
+			break;
+
 		case SO_PRIORITY:
 			if (IS_ENABLED(CONFIG_NET_CONTEXT_PRIORITY)) {
 				ret = net_context_set_option(ctx,
@@ -1604,6 +1738,18 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 
 			break;
 
+		case SO_BUSY_POLL:
+			if (optlen != sizeof(int)) {
+				errno = EINVAL;
+				return -1;
+			}
+
+			sock_set_flag(ctx, SOCK_BUSY_POLL,
+				      *(const int *)optval ?
+						SOCK_BUSY_POLL : 0);
+
+			return 0;
+
 		case SO_SOCKS5:
 			if (IS_ENABLED(CONFIG_SOCKS)) {
 				ret = net_context_set_option(ctx,
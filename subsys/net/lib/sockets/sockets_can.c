@@ -13,6 +13,7 @@ LOG_MODULE_REGISTER(net_sock_can, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <kernel.h>
 #include <drivers/entropy.h>
 #include <sys/util.h>
+#include <sys/math_extras.h>
 #include <net/net_context.h>
 #include <net/net_pkt.h>
 #include <net/socket.h>
@@ -29,10 +30,149 @@ struct can_recv {
 	struct net_context *ctx;
 	canid_t can_id;
 	canid_t can_mask;
+	uint32_t dropped; /**< frames lost for this receiver, see
+			   *   CAN_RAW_DROPPED_FRAMES
+			   */
 };
 
 static struct can_recv receivers[CONFIG_NET_SOCKETS_CAN_RECEIVERS];
 
+/* Compiled filter dispatch table, rebuilt whenever the filters change:
+ * one group per distinct (interface, mask) pair, each holding its
+ * masked IDs sorted so that a received frame needs a single binary
+ * search per group instead of a scan over every receiver. Receivers
+ * sharing the same filter share one entry.
+ */
+BUILD_ASSERT(CONFIG_NET_SOCKETS_CAN_RECEIVERS <= 32,
+	     "receiver bitmaps are 32 bits wide");
+
+struct can_dispatch_entry {
+	canid_t match;      /**< can_id & can_mask */
+	uint32_t receivers; /**< bitmap of receivers[] indexes */
+};
+
+struct can_dispatch_group {
+	struct net_if *iface;
+	canid_t mask;
+	uint8_t start; /**< first entry in dispatch_entries[] */
+	uint8_t count;
+};
+
+static struct can_dispatch_group
+	dispatch_groups[CONFIG_NET_SOCKETS_CAN_RECEIVERS];
+static struct can_dispatch_entry
+	dispatch_entries[CONFIG_NET_SOCKETS_CAN_RECEIVERS];
+static uint8_t dispatch_group_count;
+
+static void can_dispatch_rebuild(void)
+{
+	uint8_t total = 0U;
+	int g, i, pos;
+
+	dispatch_group_count = 0U;
+
+	for (i = 0; i < ARRAY_SIZE(receivers); i++) {
+		if (receivers[i].ctx == NULL) {
+			continue;
+		}
+
+		for (g = 0; g < dispatch_group_count; g++) {
+			if (dispatch_groups[g].iface == receivers[i].iface &&
+			    dispatch_groups[g].mask == receivers[i].can_mask) {
+				break;
+			}
+		}
+
+		if (g == dispatch_group_count) {
+			dispatch_groups[g].iface = receivers[i].iface;
+			dispatch_groups[g].mask = receivers[i].can_mask;
+			dispatch_groups[g].count = 0U;
+			dispatch_group_count++;
+		}
+	}
+
+	/* The second pass keeps the entries of each group contiguous */
+	for (g = 0; g < dispatch_group_count; g++) {
+		struct can_dispatch_group *group = &dispatch_groups[g];
+		struct can_dispatch_entry *entry = &dispatch_entries[total];
+
+		group->start = total;
+
+		for (i = 0; i < ARRAY_SIZE(receivers); i++) {
+			canid_t match;
+
+			if (receivers[i].ctx == NULL ||
+			    receivers[i].iface != group->iface ||
+			    receivers[i].can_mask != group->mask) {
+				continue;
+			}
+
+			match = receivers[i].can_id & receivers[i].can_mask;
+
+			/* Insertion sort, the table is small */
+			for (pos = 0; pos < group->count; pos++) {
+				if (entry[pos].match >= match) {
+					break;
+				}
+			}
+
+			if (pos < group->count && entry[pos].match == match) {
+				entry[pos].receivers |= BIT(i);
+				continue;
+			}
+
+			memmove(&entry[pos + 1], &entry[pos],
+				(group->count - pos) * sizeof(entry[0]));
+			entry[pos].match = match;
+			entry[pos].receivers = BIT(i);
+			group->count++;
+		}
+
+		total += group->count;
+	}
+}
+
+/* Collect the bitmap of receivers matching a frame with one walk of the
+ * compiled table, regardless of how many sockets are open.
+ */
+static uint32_t can_dispatch_lookup(struct net_if *iface, canid_t can_id)
+{
+	uint32_t matched = 0U;
+	int g;
+
+	for (g = 0; g < dispatch_group_count; g++) {
+		const struct can_dispatch_group *group = &dispatch_groups[g];
+		canid_t key;
+		int lo, hi;
+
+		if (group->iface != iface) {
+			continue;
+		}
+
+		key = can_id & group->mask;
+
+		lo = group->start;
+		hi = group->start + group->count - 1;
+
+		while (lo <= hi) {
+			int mid = lo + (hi - lo) / 2;
+
+			if (dispatch_entries[mid].match == key) {
+				matched |= dispatch_entries[mid].receivers;
+				break;
+			}
+
+			if (dispatch_entries[mid].match < key) {
+				lo = mid + 1;
+			} else {
+				hi = mid - 1;
+			}
+		}
+	}
+
+	return matched;
+}
+
 extern const struct socket_op_vtable sock_fd_op_vtable;
 
 static const struct socket_op_vtable can_sock_fd_op_vtable;
@@ -77,6 +217,26 @@ int zcan_socket(int family, int type, int proto)
 	return fd;
 }
 
+static void zcan_mark_eof(struct net_context *ctx)
+{
+	struct net_pkt *last_pkt = k_fifo_peek_tail(&ctx->recv_q);
+
+	if (!last_pkt) {
+		/* If there're no packets in the queue,
+		 * recv() may be blocked waiting on it to
+		 * become non-empty, so cancel that wait.
+		 */
+		sock_set_eof(ctx);
+		k_fifo_cancel_wait(&ctx->recv_q);
+
+		NET_DBG("Marked socket %p as peer-closed", ctx);
+	} else {
+		net_pkt_set_eof(last_pkt, true);
+
+		NET_DBG("Set EOF flag on pkt %p", ctx);
+	}
+}
+
 static void zcan_received_cb(struct net_context *ctx, struct net_pkt *pkt,
 			     union net_ip_header *ip_hdr,
 			     union net_proto_header *proto_hdr,
@@ -88,81 +248,69 @@ static void zcan_received_cb(struct net_context *ctx, struct net_pkt *pkt,
 	 * same CAN id packets. That is why we need to implement the dispatcher
 	 * which will give the packet to correct net_context(s).
 	 */
-	struct net_pkt *clone = NULL;
+	struct zcan_frame *zframe;
+	struct can_frame frame;
+	uint32_t matched;
 	int i;
 
-	for (i = 0; i < ARRAY_SIZE(receivers); i++) {
-		struct zcan_frame *zframe =
-			(struct zcan_frame *)net_pkt_data(pkt);
-		struct can_frame frame;
-
-		if (!receivers[i].ctx ||
-		    receivers[i].iface != net_pkt_iface(pkt)) {
-			continue;
+	/* if pkt is NULL, EOF */
+	if (!pkt) {
+		for (i = 0; i < ARRAY_SIZE(receivers); i++) {
+			if (receivers[i].ctx != NULL) {
+				zcan_mark_eof(receivers[i].ctx);
+			}
 		}
 
-		can_copy_zframe_to_frame(zframe, &frame);
+		return;
+	}
+
+	zframe = (struct zcan_frame *)net_pkt_data(pkt);
+	can_copy_zframe_to_frame(zframe, &frame);
+
+	matched = can_dispatch_lookup(net_pkt_iface(pkt), frame.can_id);
+	if (matched == 0U) {
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	/* The original net_pkt is handed to the last recipient, every
+	 * earlier one gets a clone. A receiver whose clone cannot be
+	 * allocated misses the frame; that is accounted in its drop
+	 * counter instead of risking delivering the same net_pkt twice.
+	 */
+	while (matched != 0U) {
+		struct net_pkt *clone;
+
+		i = u32_count_trailing_zeros(matched);
+		matched &= ~BIT(i);
+
+		ctx = receivers[i].ctx;
+		if (ctx == NULL) {
+			/* Unregistered between the lookup and here */
+			if (matched == 0U) {
+				net_pkt_unref(pkt);
+			}
 
-		if ((frame.can_id & receivers[i].can_mask) !=
-		    (receivers[i].can_id & receivers[i].can_mask)) {
 			continue;
 		}
 
-		/* If there are multiple receivers configured, we use the
-		 * original net_pkt as a template, and just clone it to all
-		 * recipients. This is done like this so that we avoid the
-		 * original net_pkt being freed while we are cloning it.
-		 */
-		if (pkt != NULL && ARRAY_SIZE(receivers) > 1) {
-			/* There are multiple receivers, we need to clone
-			 * the packet.
-			 */
+		if (matched != 0U) {
 			clone = net_pkt_clone(pkt, MEM_ALLOC_TIMEOUT);
 			if (!clone) {
-				/* Sent the packet to at least one recipient
-				 * if there is no memory to clone the packet.
-				 */
-				clone = pkt;
+				receivers[i].dropped++;
+				NET_DBG("[%d] ctx %p pkt %p dropped (no mem)",
+					i, ctx, pkt);
+				continue;
 			}
 		} else {
 			clone = pkt;
 		}
 
-		ctx = receivers[i].ctx;
-
 		NET_DBG("[%d] ctx %p pkt %p st %d", i, ctx, clone, status);
 
-		/* if pkt is NULL, EOF */
-		if (!clone) {
-			struct net_pkt *last_pkt =
-				k_fifo_peek_tail(&ctx->recv_q);
-
-			if (!last_pkt) {
-				/* If there're no packets in the queue,
-				 * recv() may be blocked waiting on it to
-				 * become non-empty, so cancel that wait.
-				 */
-				sock_set_eof(ctx);
-				k_fifo_cancel_wait(&ctx->recv_q);
-
-				NET_DBG("Marked socket %p as peer-closed", ctx);
-			} else {
-				net_pkt_set_eof(last_pkt, true);
-
-				NET_DBG("Set EOF flag on pkt %p", ctx);
-			}
-
-			return;
-		} else {
-			/* Normal packet */
-			net_pkt_set_eof(clone, false);
-
-			k_fifo_put(&ctx->recv_q, clone);
-		}
-	}
+		net_pkt_set_eof(clone, false);
 
-	if (clone && clone != pkt) {
-		net_pkt_unref(pkt);
+		k_fifo_put(&ctx->recv_q, clone);
 	}
 }
 
@@ -384,6 +532,7 @@ static int can_close_socket(struct net_context *ctx)
 			struct can_filter filter;
 
 			receivers[i].ctx = NULL;
+			can_dispatch_rebuild();
 
 			filter.can_id = receivers[i].can_id;
 			filter.can_mask = receivers[i].can_mask;
@@ -488,6 +637,28 @@ static int can_sock_getsockopt_vmeth(void *obj, int level, int optname,
 			return -1;
 		}
 
+		if (optname == CAN_RAW_DROPPED_FRAMES) {
+			uint32_t dropped = 0U;
+			int i;
+
+			if (optlen == NULL || *optlen != sizeof(uint32_t)) {
+				errno = EINVAL;
+				return -1;
+			}
+
+			/* A socket may hold several filters, so sum the
+			 * counters of all its receiver slots.
+			 */
+			for (i = 0; i < ARRAY_SIZE(receivers); i++) {
+				if (receivers[i].ctx == obj) {
+					dropped += receivers[i].dropped;
+				}
+			}
+
+			*(uint32_t *)optval = dropped;
+			return 0;
+		}
+
 		iface = net_context_get_iface(obj);
 		dev = net_if_get_device(iface);
 		api = dev->api;
@@ -520,6 +691,9 @@ static int can_register_receiver(struct net_if *iface, struct net_context *ctx,
 		receivers[i].iface = iface;
 		receivers[i].can_id = can_id;
 		receivers[i].can_mask = can_mask;
+		receivers[i].dropped = 0U;
+
+		can_dispatch_rebuild();
 
 		return i;
 	}
@@ -539,6 +713,7 @@ static void can_unregister_receiver(struct net_if *iface,
 		    receivers[i].can_id == can_id &&
 		    receivers[i].can_mask == can_mask) {
 			receivers[i].ctx = NULL;
+			can_dispatch_rebuild();
 			return;
 		}
 	}
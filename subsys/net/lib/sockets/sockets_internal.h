@@ -11,6 +11,7 @@
 
 #define SOCK_EOF 1
 #define SOCK_NONBLOCK 2
+#define SOCK_BUSY_POLL 4
 
 static inline void sock_set_flag(struct net_context *ctx, uintptr_t mask,
 				 uintptr_t flag)
@@ -43,6 +44,7 @@ static inline bool net_socket_is_tls(void *obj)
 #define sock_is_eof(ctx) sock_get_flag(ctx, SOCK_EOF)
 #define sock_set_eof(ctx) sock_set_flag(ctx, SOCK_EOF, SOCK_EOF)
 #define sock_is_nonblock(ctx) sock_get_flag(ctx, SOCK_NONBLOCK)
+#define sock_is_busy_poll(ctx) sock_get_flag(ctx, SOCK_BUSY_POLL)
 
 struct socket_op_vtable {
 	struct fd_op_vtable fd_vtable;
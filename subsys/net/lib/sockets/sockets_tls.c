@@ -116,6 +116,9 @@ struct tls_context {
 		/** DTLS role, client by default. */
 		int8_t role;
 
+		/** Session cache enabled on a socket. */
+		int session_cache;
+
 		/** NULL-terminated list of allowed application layer
 		 * protocols.
 		 */
@@ -323,6 +326,162 @@ static inline bool is_handshake_complete(struct tls_context *ctx)
 	return k_sem_count_get(&ctx->tls_established) != 0;
 }
 
+/* Stored client session for TLS/DTLS session resumption. The peer address
+ * together with the credential tags forms the lookup key, so a session is
+ * only resumed towards the endpoint, and with the credentials, that it was
+ * originally established with.
+ */
+struct tls_session_cache {
+	/** Time of storing, used to pick the eviction victim. */
+	int64_t timestamp;
+
+	/** Peer address the session was established with. */
+	struct sockaddr remote_addr;
+
+	/** Peer address length, 0 for an unused entry. */
+	socklen_t remote_addrlen;
+
+	/** Credentials the session was established with. */
+	struct sec_tag_list sec_tag_list;
+
+	/** The stored session itself. */
+	mbedtls_ssl_session session;
+};
+
+static struct tls_session_cache
+	client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_SESSION_COUNT];
+
+static bool session_cache_key_match(struct tls_session_cache *entry,
+				    struct tls_context *context,
+				    const struct sockaddr *addr,
+				    socklen_t addrlen)
+{
+	struct sec_tag_list *tags = &context->options.sec_tag_list;
+
+	if (entry->remote_addrlen != addrlen ||
+	    memcmp(&entry->remote_addr, addr, addrlen) != 0) {
+		return false;
+	}
+
+	if (entry->sec_tag_list.sec_tag_count != tags->sec_tag_count ||
+	    memcmp(entry->sec_tag_list.sec_tags, tags->sec_tags,
+		   tags->sec_tag_count * sizeof(sec_tag_t)) != 0) {
+		return false;
+	}
+
+	return true;
+}
+
+static void tls_session_store(struct tls_context *context,
+			      const struct sockaddr *addr,
+			      socklen_t addrlen)
+{
+	struct tls_session_cache *entry = NULL;
+	struct tls_session_cache *oldest = &client_cache[0];
+	int i, ret;
+
+	if (context->options.session_cache != TLS_SESSION_CACHE_ENABLED ||
+	    addrlen > sizeof(struct sockaddr)) {
+		return;
+	}
+
+	k_mutex_lock(&context_lock, K_FOREVER);
+
+	/* Prefer the entry for the same peer, then an unused one, then the
+	 * oldest stored session.
+	 */
+	for (i = 0; i < ARRAY_SIZE(client_cache); i++) {
+		struct tls_session_cache *cache = &client_cache[i];
+
+		if (cache->remote_addrlen == 0) {
+			if (entry == NULL) {
+				entry = cache;
+			}
+
+			continue;
+		}
+
+		if (session_cache_key_match(cache, context, addr, addrlen)) {
+			entry = cache;
+			break;
+		}
+
+		if (cache->timestamp < oldest->timestamp) {
+			oldest = cache;
+		}
+	}
+
+	if (entry == NULL) {
+		entry = oldest;
+	}
+
+	mbedtls_ssl_session_free(&entry->session);
+	entry->remote_addrlen = 0;
+
+	ret = mbedtls_ssl_get_session(&context->ssl, &entry->session);
+	if (ret != 0) {
+		NET_DBG("Failed to store session for %p (-%x)",
+			context, -ret);
+		goto exit;
+	}
+
+	entry->timestamp = k_uptime_get();
+	memcpy(&entry->remote_addr, addr, addrlen);
+	entry->remote_addrlen = addrlen;
+	memcpy(&entry->sec_tag_list, &context->options.sec_tag_list,
+	       sizeof(entry->sec_tag_list));
+
+exit:
+	k_mutex_unlock(&context_lock);
+}
+
+static void tls_session_restore(struct tls_context *context,
+				const struct sockaddr *addr,
+				socklen_t addrlen)
+{
+	int i, ret;
+
+	if (context->options.session_cache != TLS_SESSION_CACHE_ENABLED ||
+	    addrlen > sizeof(struct sockaddr)) {
+		return;
+	}
+
+	k_mutex_lock(&context_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(client_cache); i++) {
+		struct tls_session_cache *cache = &client_cache[i];
+
+		if (cache->remote_addrlen == 0 ||
+		    !session_cache_key_match(cache, context, addr, addrlen)) {
+			continue;
+		}
+
+		ret = mbedtls_ssl_set_session(&context->ssl, &cache->session);
+		if (ret != 0) {
+			NET_DBG("Failed to restore session for %p (-%x)",
+				context, -ret);
+		}
+
+		break;
+	}
+
+	k_mutex_unlock(&context_lock);
+}
+
+static void tls_session_purge(void)
+{
+	int i;
+
+	k_mutex_lock(&context_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(client_cache); i++) {
+		mbedtls_ssl_session_free(&client_cache[i].session);
+		client_cache[i].remote_addrlen = 0;
+	}
+
+	k_mutex_unlock(&context_lock);
+}
+
 /* Allocate TLS context. */
 static struct tls_context *tls_alloc(void)
 {
@@ -1201,6 +1360,55 @@ static int tls_opt_dtls_role_set(struct tls_context *context,
 	return 0;
 }
 
+static int tls_opt_session_cache_set(struct tls_context *context,
+				     const void *optval, socklen_t optlen)
+{
+	int *val = (int *)optval;
+
+	if (!optval) {
+		return -EINVAL;
+	}
+
+	if (optlen != sizeof(int)) {
+		return -EINVAL;
+	}
+
+	if (*val != TLS_SESSION_CACHE_DISABLED &&
+	    *val != TLS_SESSION_CACHE_ENABLED) {
+		return -EINVAL;
+	}
+
+	context->options.session_cache = *val;
+
+	return 0;
+}
+
+static int tls_opt_session_cache_get(struct tls_context *context,
+				     void *optval, socklen_t *optlen)
+{
+	int cache_enabled = context->options.session_cache;
+
+	if (*optlen != sizeof(cache_enabled)) {
+		return -EINVAL;
+	}
+
+	*(int *)optval = cache_enabled;
+
+	return 0;
+}
+
+static int tls_opt_session_cache_purge_set(struct tls_context *context,
+					   const void *optval, socklen_t optlen)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(optval);
+	ARG_UNUSED(optlen);
+
+	tls_session_purge();
+
+	return 0;
+}
+
 static int protocol_check(int family, int type, int *proto)
 {
 	if (family != AF_INET && family != AF_INET6) {
@@ -1318,6 +1526,8 @@ int ztls_connect_ctx(struct tls_context *ctx, const struct sockaddr *addr,
 		/* Do not use any socket flags during the handshake. */
 		ctx->flags = 0;
 
+		tls_session_restore(ctx, addr, addrlen);
+
 		/* TODO For simplicity, TLS handshake blocks the socket
 		 * even for non-blocking socket.
 		 */
@@ -1325,6 +1535,8 @@ int ztls_connect_ctx(struct tls_context *ctx, const struct sockaddr *addr,
 		if (ret < 0) {
 			goto error;
 		}
+
+		tls_session_store(ctx, addr, addrlen);
 	} else {
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 		/* Just store the address. */
@@ -1458,6 +1670,9 @@ static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 	}
 
 	if (!is_handshake_complete(ctx)) {
+		tls_session_restore(ctx, &ctx->dtls_peer_addr,
+				    ctx->dtls_peer_addrlen);
+
 		/* TODO For simplicity, TLS handshake blocks the socket even for
 		 * non-blocking socket.
 		 */
@@ -1465,6 +1680,9 @@ static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 		if (ret < 0) {
 			goto error;
 		}
+
+		tls_session_store(ctx, &ctx->dtls_peer_addr,
+				  ctx->dtls_peer_addrlen);
 	}
 
 	return send_tls(ctx, buf, len, flags);
@@ -2005,6 +2223,10 @@ int ztls_getsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_alpn_list_get(ctx, optval, optlen);
 		break;
 
+	case TLS_SESSION_CACHE:
+		err = tls_opt_session_cache_get(ctx, optval, optlen);
+		break;
+
 	default:
 		/* Unknown or write-only option. */
 		err = -ENOPROTOOPT;
@@ -2054,6 +2276,14 @@ int ztls_setsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_alpn_list_set(ctx, optval, optlen);
 		break;
 
+	case TLS_SESSION_CACHE:
+		err = tls_opt_session_cache_set(ctx, optval, optlen);
+		break;
+
+	case TLS_SESSION_CACHE_PURGE:
+		err = tls_opt_session_cache_purge_set(ctx, optval, optlen);
+		break;
+
 	default:
 		/* Unknown or read-only option. */
 		err = -ENOPROTOOPT;
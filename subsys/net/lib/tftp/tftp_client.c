@@ -19,6 +19,12 @@ static uint32_t  tftpc_buffer_size;
 static uint32_t  tftpc_block_no;
 static uint32_t  tftpc_index;
 
+/* Negotiated RFC 7440 window size and the number of blocks received
+ * since the last acknowledgment.
+ */
+static uint16_t  tftpc_window_size;
+static uint16_t  tftpc_window_index;
+
 /* Global mutex to protect critical resources. */
 K_MUTEX_DEFINE(tftpc_lock);
 
@@ -64,6 +70,18 @@ static uint32_t make_request(const char *remote_file, const char *mode,
 	tftpc_buffer[req_size] = 0x0;
 	req_size++;
 
+#if CONFIG_TFTPC_WINDOWSIZE > 1
+	/* Ask the server for an RFC 7440 window so that it keeps several
+	 * blocks in flight per acknowledgment. Options are appended to
+	 * the request as "name" NUL "value" NUL pairs per RFC 2347.
+	 */
+	strcpy(tftpc_buffer + req_size, "windowsize");
+	req_size += sizeof("windowsize");
+
+	req_size += snprintk(tftpc_buffer + req_size, 6, "%d",
+			     CONFIG_TFTPC_WINDOWSIZE) + 1;
+#endif
+
 	return req_size;
 }
 
@@ -126,17 +144,53 @@ static int tftpc_recv_data(int sock)
  * -> TFTPC_DATA_RX_SUCCESS: data received but their is more to come.
  * -> TFTPC_SUCCESS: Block received successfully and no more data is coming.
  */
+static int tftpc_store_data(int sock, struct tftpc *client)
+{
+	/* Streaming sink: hand the block straight to the user callback
+	 * instead of accumulating the whole file in RAM.
+	 */
+	if (client->data_cb != NULL) {
+		if (client->data_cb(tftpc_buffer + TFTP_HEADER_SIZE,
+				    RECV_DATA_SIZE(),
+				    client->user_data) < 0) {
+			send_err(sock, 0x0, "Write failed");
+			return TFTPC_SINK_FAILURE;
+		}
+
+		tftpc_index += RECV_DATA_SIZE();
+		return 0;
+	}
+
+	/* Only copy block if the user buffer has enough space. */
+	if (RECV_DATA_SIZE() > (client->user_buf_size - tftpc_index)) {
+		send_err(sock, 0x3, "Buffer Overflow");
+		return TFTPC_BUFFER_OVERFLOW;
+	}
+
+	/* Perform the actual copy and update the index. */
+	memcpy(client->user_buf + tftpc_index,
+	       tftpc_buffer + TFTP_HEADER_SIZE, RECV_DATA_SIZE());
+	tftpc_index += RECV_DATA_SIZE();
+
+	return 0;
+}
+
 static int tftpc_process_resp(int sock, struct tftpc *client)
 {
 	uint16_t    block_no;
+	int         ret;
 
 	/* Get the block number as received in the packet. */
 	block_no = sys_get_be16(tftpc_buffer + 2);
-	if (tftpc_block_no > block_no) {
-		LOG_DBG("Duplicate block received: %d", block_no);
+	if (block_no != (uint16_t)tftpc_block_no) {
+		LOG_DBG("Out of order block received: %d", block_no);
 		LOG_DBG("Client waiting for Block Number: %d", tftpc_block_no);
 
-		send_ack(sock, block_no);
+		/* Re-ack the last in-order block so that the server
+		 * rewinds its window to the right place.
+		 */
+		send_ack(sock, (uint16_t)(tftpc_block_no - 1));
+		tftpc_window_index = 0;
 
 		/* Duplicate block received. */
 		return TFTPC_DUPLICATE_DATA;
@@ -145,27 +199,93 @@ static int tftpc_process_resp(int sock, struct tftpc *client)
 	/* Valid block number received. */
 	LOG_DBG("Block Number: %d received", tftpc_block_no);
 
-	/* Only copy block if the user buffer has enough space. */
-	if (RECV_DATA_SIZE() > (client->user_buf_size - tftpc_index)) {
-		send_err(sock, 0x3, "Buffer Overflow");
-		return TFTPC_BUFFER_OVERFLOW;
+	ret = tftpc_store_data(sock, client);
+	if (ret < 0) {
+		return ret;
 	}
 
-	/* Perform the actual copy and update the index. */
-	memcpy(client->user_buf + tftpc_index,
-	       tftpc_buffer + TFTP_HEADER_SIZE, RECV_DATA_SIZE());
-	tftpc_index += RECV_DATA_SIZE();
-
-	/* "block" of data received. */
-	send_ack(sock, block_no);
 	tftpc_block_no++;
+	tftpc_window_index++;
 
 	/* For RFC1350, the block size will always be 512.
 	 * -> If block_size == 512, the transfer is still in progress.
 	 * -> If block_size < 512, we will conclude the transfer.
 	 */
-	return (RECV_DATA_SIZE() == TFTP_BLOCK_SIZE) ? TFTP_BLOCK_SIZE :
-		TFTPC_SUCCESS;
+	if (RECV_DATA_SIZE() < TFTP_BLOCK_SIZE) {
+		/* The final block is acknowledged regardless of the
+		 * window position.
+		 */
+		send_ack(sock, block_no);
+		tftpc_window_index = 0;
+		return TFTPC_SUCCESS;
+	}
+
+	/* Only every "window size" blocks are acknowledged; between the
+	 * acknowledgments the server keeps the blocks coming without
+	 * waiting for a round trip.
+	 */
+	if (tftpc_window_index >= tftpc_window_size) {
+		send_ack(sock, block_no);
+		tftpc_window_index = 0;
+	}
+
+	return TFTP_BLOCK_SIZE;
+}
+
+/* Name: tftpc_process_oack
+ * Description: This function parses the Option Acknowledgment (RFC 2347)
+ * sent by the server in response to our option requests. Only the
+ * "windowsize" option is understood; an acknowledged window larger than
+ * what was asked for is a protocol error. The OACK itself is answered
+ * with an acknowledgment of block 0 to start the transfer.
+ */
+static int tftpc_process_oack(int sock)
+{
+	const char *opt = (const char *)tftpc_buffer + 2;
+	const char *end = (const char *)tftpc_buffer + tftpc_buffer_size;
+
+	while (opt < end) {
+		const char *name = opt;
+		const char *value;
+		uint16_t win = 0U;
+
+		value = memchr(opt, 0x0, end - opt);
+		if (value == NULL) {
+			break;
+		}
+		value++;
+
+		opt = memchr(value, 0x0, end - value);
+		if (opt == NULL) {
+			break;
+		}
+		opt++;
+
+		if (strcmp(name, "windowsize") != 0) {
+			/* Unknown options in an OACK are ignored. */
+			continue;
+		}
+
+		while (*value >= '0' && *value <= '9') {
+			win = win * 10U + (*value - '0');
+			value++;
+		}
+
+		if (win < 1 || win > CONFIG_TFTPC_WINDOWSIZE) {
+			send_err(sock, 0x8, "Bad windowsize");
+			return TFTPC_REMOTE_ERROR;
+		}
+
+		tftpc_window_size = win;
+		LOG_DBG("Negotiated window size: %d", tftpc_window_size);
+	}
+
+	/* Acknowledge the options; block 0 tells the server to start
+	 * sending data.
+	 */
+	send_ack(sock, 0);
+
+	return 0;
 }
 
 /* Name: tftp_send_request
@@ -231,6 +351,10 @@ int tftp_get(struct sockaddr *server, struct tftpc *client,
 	tftpc_block_no = 1;
 	tftpc_index    = 0;
 
+	/* Lock-step until the server acknowledges a larger window. */
+	tftpc_window_size  = 1;
+	tftpc_window_index = 0;
+
 	/* Create Socket for TFTP (IPv4 / UDP) */
 	sock = socket(server->sa_family, SOCK_DGRAM, IPPROTO_UDP);
 	if (sock < 0) {
@@ -252,7 +376,23 @@ int tftp_get(struct sockaddr *server, struct tftpc *client,
 	stat = tftp_send_request(sock, READ_REQUEST, remote_file, mode);
 	if (stat == ERROR_OPCODE) {
 		LOG_ERR("Server responded with error.");
-		return TFTPC_REMOTE_ERROR;
+		stat = TFTPC_REMOTE_ERROR;
+		goto req_done;
+	}
+
+	if (stat == OACK_OPCODE) {
+		/* The server acknowledged our options; a data-less reply
+		 * that we answer with an ack of block 0 before the first
+		 * data block arrives. A server without option support
+		 * responds with data directly and the transfer stays in
+		 * lock-step.
+		 */
+		stat = tftpc_process_oack(sock);
+		if (stat < 0) {
+			goto req_done;
+		}
+
+		goto tftpc_recv;
 	}
 
 process_resp:
@@ -260,6 +400,7 @@ process_resp:
 	/* Process server response. */
 	stat = tftpc_process_resp(sock, client);
 	if (stat == TFTPC_BUFFER_OVERFLOW ||
+	    stat == TFTPC_SINK_FAILURE ||
 	    stat == TFTPC_SUCCESS) {
 		goto req_done;
 	}
@@ -275,12 +416,16 @@ tftpc_recv:
 		/* Retries exhausted ? */
 		if (++retx_cnt >= TFTP_REQ_RETX) {
 			LOG_ERR("No more retransmits available. Exiting");
-			return TFTPC_RETRIES_EXHAUSTED;
+			stat = TFTPC_RETRIES_EXHAUSTED;
+			goto req_done;
 		}
 
-		/* Start Retransmission. */
+		/* Start Retransmission: re-ack the last in-order block so
+		 * the server resends its window from there.
+		 */
 		LOG_DBG("Starting Re-transmission.");
-		send_ack(sock, tftpc_block_no);
+		send_ack(sock, (uint16_t)(tftpc_block_no - 1));
+		tftpc_window_index = 0;
 		goto tftpc_recv;
 	}
 
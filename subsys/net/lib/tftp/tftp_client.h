@@ -34,6 +34,7 @@
 #define DATA_OPCODE              0x3
 #define ACK_OPCODE               0x4
 #define ERROR_OPCODE             0x5
+#define OACK_OPCODE              0x6
 
 #define RECV_DATA_SIZE()         (tftpc_buffer_size - TFTP_HEADER_SIZE)
 
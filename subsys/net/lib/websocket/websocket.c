@@ -480,6 +480,54 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
+/* Apply the masking value to the payload a word at a time instead of a
+ * byte at a time. The masking pattern repeats every 4 bytes. The offset
+ * tells how many payload bytes were already masked with this masking
+ * value in earlier calls.
+ */
+static void websocket_mask_payload(uint8_t *payload, size_t payload_len,
+				   uint32_t masking_value, size_t offset)
+{
+	uint8_t mask[4];
+	size_t i = 0;
+
+	sys_put_be32(masking_value, mask);
+
+	/* Process any unaligned head bytes so that the word sized XOR
+	 * below accesses naturally aligned memory.
+	 */
+	while (i < payload_len &&
+	       ((uintptr_t)&payload[i] % sizeof(uint64_t)) != 0) {
+		payload[i] ^= mask[(i + offset) % sizeof(mask)];
+		i++;
+	}
+
+	if (payload_len - i >= sizeof(uint64_t)) {
+		uint8_t pattern[sizeof(uint64_t)];
+		uint64_t mask_word;
+		size_t j;
+
+		/* Rotate the mask so that it lines up with the current
+		 * payload position.
+		 */
+		for (j = 0; j < sizeof(pattern); j++) {
+			pattern[j] = mask[(i + offset + j) % sizeof(mask)];
+		}
+
+		memcpy(&mask_word, pattern, sizeof(mask_word));
+
+		for (; payload_len - i >= sizeof(uint64_t);
+		     i += sizeof(uint64_t)) {
+			*(uint64_t *)&payload[i] ^= mask_word;
+		}
+	}
+
+	while (i < payload_len) {
+		payload[i] ^= mask[(i + offset) % sizeof(mask)];
+		i++;
+	}
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
@@ -550,8 +598,6 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
@@ -566,10 +612,8 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 		memcpy(data_to_send, payload, payload_len);
 
-		for (i = 0; i < payload_len; i++) {
-			data_to_send[i] ^=
-				ctx->masking_value >> (8 * (3 - i % 4));
-		}
+		websocket_mask_payload(data_to_send, payload_len,
+				       ctx->masking_value, 0);
 	}
 
 	ret = websocket_prepare_and_send(ctx, header, hdr_len,
@@ -651,10 +695,12 @@ static bool websocket_parse_header(uint8_t *buf, size_t buf_len, bool *masked,
 	return false;
 }
 
-int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
-		       uint32_t *message_type, uint64_t *remaining, int32_t timeout)
+static int websocket_recv_common(int ws_sock, uint8_t *buf, size_t buf_len,
+			  uint8_t **inplace_buf, uint32_t *message_type,
+			  uint64_t *remaining, int32_t timeout)
 {
 	struct websocket_context *ctx;
+	uint8_t *data;
 	size_t header_len = 0;
 	int recv_len = 0;
 	size_t can_copy, left;
@@ -689,6 +735,21 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 	}
 #endif /* CONFIG_NET_TEST */
 
+	/* Reclaim any temp buffer data that was handed out to the user by
+	 * a previous in-place receive call.
+	 */
+	if (ctx->tmp_buf_consumed > 0) {
+		ctx->tmp_buf_pos -= ctx->tmp_buf_consumed;
+
+		if (ctx->tmp_buf_pos > 0) {
+			memmove(ctx->tmp_buf,
+				&ctx->tmp_buf[ctx->tmp_buf_consumed],
+				ctx->tmp_buf_pos);
+		}
+
+		ctx->tmp_buf_consumed = 0;
+	}
+
 	/* If we have not received the websocket header yet, read it first */
 	if (!ctx->header_received) {
 #if defined(CONFIG_NET_TEST)
@@ -802,50 +863,64 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		ctx->tmp_buf_pos = ret;
 	}
 
-	if (ctx->tmp_buf_pos <= buf_len) {
-		/* Is there already any data in the temp buffer? If yes,
-		 * just return it to the caller.
+	if (inplace_buf != NULL) {
+		/* Hand out the data straight from the temp buffer. The
+		 * handed out bytes are reclaimed when the next receive
+		 * call is made.
 		 */
 		can_copy = MIN(ctx->message_len - ctx->total_read,
 			       ctx->tmp_buf_pos);
+
+		*inplace_buf = ctx->tmp_buf;
+		data = ctx->tmp_buf;
+		recv_len = can_copy;
+
+		ctx->tmp_buf_consumed = can_copy;
 	} else {
-		/* We have more data in tmp buffer that will fit into
-		 * user buffer.
-		 */
-		can_copy = MIN(ctx->message_len - ctx->total_read, buf_len);
-	}
+		if (ctx->tmp_buf_pos <= buf_len) {
+			/* Is there already any data in the temp buffer? If
+			 * yes, just return it to the caller.
+			 */
+			can_copy = MIN(ctx->message_len - ctx->total_read,
+				       ctx->tmp_buf_pos);
+		} else {
+			/* We have more data in tmp buffer that will fit into
+			 * user buffer.
+			 */
+			can_copy = MIN(ctx->message_len - ctx->total_read,
+				       buf_len);
+		}
 
-	left = ctx->tmp_buf_pos - can_copy;
+		left = ctx->tmp_buf_pos - can_copy;
 
-	NET_ASSERT(ctx->tmp_buf_pos >= can_copy);
+		NET_ASSERT(ctx->tmp_buf_pos >= can_copy);
 
-	memmove(buf, ctx->tmp_buf, can_copy);
-	recv_len = can_copy;
+		memmove(buf, ctx->tmp_buf, can_copy);
+		data = buf;
+		recv_len = can_copy;
 
-	if (left > 0) {
-		memmove(ctx->tmp_buf, &ctx->tmp_buf[can_copy], left);
+		if (left > 0) {
+			memmove(ctx->tmp_buf, &ctx->tmp_buf[can_copy], left);
+		}
+
+		ctx->tmp_buf_pos = left;
 	}
 
-	ctx->tmp_buf_pos = left;
 	ctx->total_read += recv_len;
 
 	/* Unmask the data */
 	if (ctx->masked) {
 		/* As we might have less than 4 received bytes, we must select
-		 * which byte from masking value to take. The mask_shift will
+		 * which byte from masking value to take. The mask offset will
 		 * tell that.
 		 */
-		int mask_shift = (ctx->total_read - recv_len) % sizeof(uint32_t);
-		int i;
-
-		for (i = 0; i < recv_len; i++) {
-			buf[i] ^= ctx->masking_value >>
-				(8 * (3 - (i + mask_shift) % 4));
-		}
+		websocket_mask_payload(data, recv_len, ctx->masking_value,
+				       (ctx->total_read - recv_len) %
+				       sizeof(uint32_t));
 	}
 
 #if HEXDUMP_RECV_PACKETS
-	LOG_HEXDUMP_DBG(buf, recv_len, "Payload");
+	LOG_HEXDUMP_DBG(data, recv_len, "Payload");
 #endif
 
 	if (remaining) {
@@ -863,6 +938,26 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 	return recv_len;
 }
 
+int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
+		       uint32_t *message_type, uint64_t *remaining,
+		       int32_t timeout)
+{
+	return websocket_recv_common(ws_sock, buf, buf_len, NULL, message_type,
+			      remaining, timeout);
+}
+
+int websocket_recv_msg_inplace(int ws_sock, uint8_t **buf,
+			       uint32_t *message_type, uint64_t *remaining,
+			       int32_t timeout)
+{
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	return websocket_recv_common(ws_sock, NULL, 0, buf, message_type,
+			      remaining, timeout);
+}
+
 static int websocket_send(struct websocket_context *ctx, const uint8_t *buf,
 			  size_t buf_len, int32_t timeout)
 {
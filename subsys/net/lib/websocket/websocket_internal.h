@@ -73,6 +73,12 @@ __net_socket struct websocket_context {
 	 */
 	size_t tmp_buf_pos;
 
+	/** Amount of data at the start of tmp_buf that was handed out to
+	 * the user by websocket_recv_msg_inplace() and that is reclaimed
+	 * when the next receive call is made.
+	 */
+	size_t tmp_buf_consumed;
+
 	/** The real TCP socket to use when sending Websocket data to peer.
 	 */
 	int real_sock;
@@ -57,8 +57,46 @@ static device_idx_t pm_devices[CONFIG_PM_MAX_DEVICES];
 /* Number of devices that support pm */
 static device_idx_t num_pm;
 
+#ifndef CONFIG_SYS_PM_BATCHED_DEVICE_PM
 /* Number of devices successfully suspended. */
 static device_idx_t num_susp;
+#endif
+
+#ifdef CONFIG_SYS_PM_BATCHED_DEVICE_PM
+/* Suspend rank of each entry in pm_devices. Lower ranks hold devices
+ * that others depend on (clocks, buses); they are transitioned last on
+ * suspend and first on resume. Devices sharing a rank have no
+ * dependency on each other and are transitioned concurrently.
+ */
+static uint8_t pm_device_rank[CONFIG_PM_MAX_DEVICES];
+static uint8_t pm_max_rank;
+
+/* Devices handed a suspend request; resume candidates. */
+static bool pm_device_susp[CONFIG_PM_MAX_DEVICES];
+
+/* Outstanding transitions in the current batch, plus one sentinel
+ * held by the dispatcher so the batch cannot drain while it is still
+ * being issued.
+ */
+static atomic_t pm_batch_pending;
+static int pm_batch_error;
+static K_SEM_DEFINE(pm_batch_done, 0, 1);
+
+/*
+ * Assign a suspend rank to a device. Without bus/child metadata in the
+ * device structures only the core devices are known to be depended
+ * upon, so by default they form rank 0 and every other device is
+ * considered independent. SoC or board code can override this weak
+ * function to describe real dependency tiers; see z_pm_core_devices.
+ */
+__weak uint8_t z_pm_device_rank(const struct device *dev, bool is_core)
+{
+	ARG_UNUSED(dev);
+
+	return is_core ? 0 : 1;
+}
+
+#endif /* CONFIG_SYS_PM_BATCHED_DEVICE_PM */
 
 const char *device_pm_state_str(uint32_t state)
 {
@@ -78,6 +116,82 @@ const char *device_pm_state_str(uint32_t state)
 	}
 }
 
+#ifdef CONFIG_SYS_PM_BATCHED_DEVICE_PM
+static void pm_batch_cb(const struct device *dev, int retval, void *context,
+			void *arg)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(arg);
+
+	if ((retval != -ENOTSUP) && (retval != 0) && (pm_batch_error == 0)) {
+		LOG_DBG("%s transition failed: %d", dev->name, retval);
+		pm_batch_error = retval;
+	}
+
+	if (atomic_dec(&pm_batch_pending) == 1) {
+		k_sem_give(&pm_batch_done);
+	}
+}
+
+/* Issue the transition of every device of the given rank and wait for
+ * all of them to complete. Drivers finish either synchronously or from
+ * their own context through the callback; independent transitions
+ * overlap instead of being serialized.
+ */
+static int pm_device_batch(uint32_t state, uint8_t rank, bool susp_only)
+{
+	int rc;
+
+	pm_batch_error = 0;
+	atomic_set(&pm_batch_pending, 1);
+
+	for (device_idx_t i = 0; i < num_pm; i++) {
+		const struct device *dev;
+
+		if (pm_device_rank[i] != rank ||
+		    (susp_only && !pm_device_susp[i])) {
+			continue;
+		}
+
+		dev = &all_devices[pm_devices[i]];
+		pm_device_susp[i] = (state != DEVICE_PM_ACTIVE_STATE);
+
+		atomic_inc(&pm_batch_pending);
+		rc = device_set_power_state(dev, state, pm_batch_cb, NULL);
+		if (rc != 0) {
+			/* The callback will not be called. */
+			atomic_dec(&pm_batch_pending);
+			if ((rc != -ENOTSUP) && (pm_batch_error == 0)) {
+				LOG_DBG("%s did not enter %s state: %d",
+					dev->name, device_pm_state_str(state),
+					rc);
+				pm_batch_error = rc;
+			}
+		}
+	}
+
+	/* Drop the sentinel; wait if transitions are still in flight */
+	if (atomic_dec(&pm_batch_pending) != 1) {
+		k_sem_take(&pm_batch_done, K_FOREVER);
+	}
+
+	return pm_batch_error;
+}
+
+static int _sys_pm_devices(uint32_t state)
+{
+	/* Dependent ranks first, the devices they rely on last */
+	for (int rank = pm_max_rank; rank >= 0; rank--) {
+		int rc = pm_device_batch(state, rank, false);
+
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+#else
 static int _sys_pm_devices(uint32_t state)
 {
 	num_susp = 0;
@@ -102,6 +216,7 @@ static int _sys_pm_devices(uint32_t state)
 
 	return 0;
 }
+#endif /* CONFIG_SYS_PM_BATCHED_DEVICE_PM */
 
 int sys_pm_suspend_devices(void)
 {
@@ -118,6 +233,15 @@ int sys_pm_force_suspend_devices(void)
 	return _sys_pm_devices(DEVICE_PM_FORCE_SUSPEND_STATE);
 }
 
+#ifdef CONFIG_SYS_PM_BATCHED_DEVICE_PM
+void sys_pm_resume_devices(void)
+{
+	/* Devices others rely on first, their dependents afterwards */
+	for (int rank = 0; rank <= pm_max_rank; rank++) {
+		(void)pm_device_batch(DEVICE_PM_ACTIVE_STATE, rank, true);
+	}
+}
+#else
 void sys_pm_resume_devices(void)
 {
 	device_idx_t pmi = num_pm - num_susp;
@@ -132,6 +256,7 @@ void sys_pm_resume_devices(void)
 		++pmi;
 	}
 }
+#endif /* CONFIG_SYS_PM_BATCHED_DEVICE_PM */
 
 void sys_pm_create_device_list(void)
 {
@@ -180,5 +305,16 @@ void sys_pm_create_device_list(void)
 			pm_devices[num_pm++] = pmi;
 		}
 	}
+
+#ifdef CONFIG_SYS_PM_BATCHED_DEVICE_PM
+	for (pmi = 0; pmi < num_pm; pmi++) {
+		pm_device_rank[pmi] =
+			z_pm_device_rank(&all_devices[pm_devices[pmi]],
+					 pmi < core_dev);
+		if (pm_device_rank[pmi] > pm_max_rank) {
+			pm_max_rank = pm_device_rank[pmi];
+		}
+	}
+#endif
 }
 #endif /* defined(CONFIG_SYS_POWER_MANAGEMENT) */
@@ -14,6 +14,7 @@
 #include <logging/log.h>
 LOG_MODULE_DECLARE(power);
 
+#ifdef CONFIG_SYS_PM_STATE_LOCK
 static atomic_t power_state_disable_count[SYS_POWER_STATE_MAX];
 
 void sys_pm_ctrl_disable_state(enum power_states state)
@@ -46,3 +47,66 @@ bool sys_pm_ctrl_is_state_enabled(enum power_states state)
 
 	return (atomic_get(&power_state_disable_count[state]) == 0);
 }
+#endif /* CONFIG_SYS_PM_STATE_LOCK */
+
+#ifdef CONFIG_SYS_PM_LATENCY_QOS
+static sys_slist_t latency_reqs;
+static struct k_spinlock latency_lock;
+static uint32_t max_latency_us = SYS_PM_LATENCY_UNLIMITED;
+
+/* Recompute the constraint after a request changed or was removed */
+static void latency_recompute(void)
+{
+	uint32_t value = SYS_PM_LATENCY_UNLIMITED;
+	struct sys_pm_latency_request *req;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&latency_reqs, req, node) {
+		if (req->value_us < value) {
+			value = req->value_us;
+		}
+	}
+
+	max_latency_us = value;
+}
+
+void sys_pm_ctrl_latency_request_add(struct sys_pm_latency_request *req,
+				     uint32_t value_us)
+{
+	k_spinlock_key_t key = k_spin_lock(&latency_lock);
+
+	req->value_us = value_us;
+	sys_slist_append(&latency_reqs, &req->node);
+
+	if (value_us < max_latency_us) {
+		max_latency_us = value_us;
+	}
+
+	k_spin_unlock(&latency_lock, key);
+}
+
+void sys_pm_ctrl_latency_request_update(struct sys_pm_latency_request *req,
+					uint32_t value_us)
+{
+	k_spinlock_key_t key = k_spin_lock(&latency_lock);
+
+	req->value_us = value_us;
+	latency_recompute();
+
+	k_spin_unlock(&latency_lock, key);
+}
+
+void sys_pm_ctrl_latency_request_remove(struct sys_pm_latency_request *req)
+{
+	k_spinlock_key_t key = k_spin_lock(&latency_lock);
+
+	(void)sys_slist_find_and_remove(&latency_reqs, &req->node);
+	latency_recompute();
+
+	k_spin_unlock(&latency_lock, key);
+}
+
+uint32_t sys_pm_ctrl_max_latency_get(void)
+{
+	return max_latency_us;
+}
+#endif /* CONFIG_SYS_PM_LATENCY_QOS */
@@ -45,9 +45,45 @@ static const unsigned int pm_min_residency[] = {
 #endif /* CONFIG_SYS_POWER_DEEP_SLEEP_STATES */
 };
 
+#ifdef CONFIG_SYS_PM_LATENCY_QOS
+/* Worst-case wakeup latency of each state, same layout as above */
+static const uint32_t pm_exit_latency_us[] = {
+#ifdef CONFIG_SYS_POWER_SLEEP_STATES
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_1
+	CONFIG_SYS_PM_EXIT_LATENCY_SLEEP_1,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_2
+	CONFIG_SYS_PM_EXIT_LATENCY_SLEEP_2,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_3
+	CONFIG_SYS_PM_EXIT_LATENCY_SLEEP_3,
+#endif
+#endif /* CONFIG_SYS_POWER_SLEEP_STATES */
+
+#ifdef CONFIG_SYS_POWER_DEEP_SLEEP_STATES
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_1
+	CONFIG_SYS_PM_EXIT_LATENCY_DEEP_SLEEP_1,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_2
+	CONFIG_SYS_PM_EXIT_LATENCY_DEEP_SLEEP_2,
+#endif
+
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_3
+	CONFIG_SYS_PM_EXIT_LATENCY_DEEP_SLEEP_3,
+#endif
+#endif /* CONFIG_SYS_POWER_DEEP_SLEEP_STATES */
+};
+#endif /* CONFIG_SYS_PM_LATENCY_QOS */
+
 enum power_states sys_pm_policy_next_state(int32_t ticks)
 {
 	int i;
+#ifdef CONFIG_SYS_PM_LATENCY_QOS
+	uint32_t max_latency_us = sys_pm_ctrl_max_latency_get();
+#endif
 
 	if ((ticks != K_TICKS_FOREVER) && (ticks < pm_min_residency[0])) {
 		LOG_DBG("Not enough time for PM operations: %d", ticks);
@@ -59,6 +95,11 @@ enum power_states sys_pm_policy_next_state(int32_t ticks)
 		if (!sys_pm_ctrl_is_state_enabled((enum power_states)(i))) {
 			continue;
 		}
+#endif
+#ifdef CONFIG_SYS_PM_LATENCY_QOS
+		if (pm_exit_latency_us[i] > max_latency_us) {
+			continue;
+		}
 #endif
 		if ((ticks == K_TICKS_FOREVER) ||
 		    (ticks >= pm_min_residency[i])) {
@@ -11,6 +11,10 @@
 #include <power/power.h>
 #include "policy/pm_policy.h"
 
+#ifdef CONFIG_SYS_PM_STATS
+#include <stats/stats.h>
+#endif
+
 #define LOG_LEVEL CONFIG_SYS_PM_LOG_LEVEL
 #include <logging/log.h>
 LOG_MODULE_REGISTER(power);
@@ -19,15 +23,7 @@ static int post_ops_done = 1;
 static enum power_states forced_pm_state = SYS_POWER_STATE_AUTO;
 static enum power_states pm_state;
 
-#ifdef CONFIG_SYS_PM_DEBUG
-
-struct pm_debug_info {
-	uint32_t count;
-	uint32_t last_res;
-	uint32_t total_res;
-};
-
-static struct pm_debug_info pm_dbg_info[SYS_POWER_STATE_MAX];
+#if defined(CONFIG_SYS_PM_DEBUG) || defined(CONFIG_SYS_PM_STATS)
 static uint32_t timer_start, timer_end;
 
 static inline void sys_pm_debug_start_timer(void)
@@ -39,6 +35,20 @@ static inline void sys_pm_debug_stop_timer(void)
 {
 	timer_end = k_cycle_get_32();
 }
+#else
+static inline void sys_pm_debug_start_timer(void) { }
+static inline void sys_pm_debug_stop_timer(void) { }
+#endif
+
+#ifdef CONFIG_SYS_PM_DEBUG
+
+struct pm_debug_info {
+	uint32_t count;
+	uint32_t last_res;
+	uint32_t total_res;
+};
+
+static struct pm_debug_info pm_dbg_info[SYS_POWER_STATE_MAX];
 
 static void sys_pm_log_debug_info(enum power_states state)
 {
@@ -58,12 +68,124 @@ void sys_pm_dump_debug_info(void)
 	}
 }
 #else
-static inline void sys_pm_debug_start_timer(void) { }
-static inline void sys_pm_debug_stop_timer(void) { }
 static void sys_pm_log_debug_info(enum power_states state) { }
 void sys_pm_dump_debug_info(void) { }
 #endif
 
+#ifdef CONFIG_SYS_PM_STATS
+STATS_SECT_START(pm_stats)
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_1
+STATS_SECT_ENTRY32(sleep_1_count)
+STATS_SECT_ENTRY32(sleep_1_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_2
+STATS_SECT_ENTRY32(sleep_2_count)
+STATS_SECT_ENTRY32(sleep_2_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_3
+STATS_SECT_ENTRY32(sleep_3_count)
+STATS_SECT_ENTRY32(sleep_3_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_1
+STATS_SECT_ENTRY32(deep_sleep_1_count)
+STATS_SECT_ENTRY32(deep_sleep_1_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_2
+STATS_SECT_ENTRY32(deep_sleep_2_count)
+STATS_SECT_ENTRY32(deep_sleep_2_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_3
+STATS_SECT_ENTRY32(deep_sleep_3_count)
+STATS_SECT_ENTRY32(deep_sleep_3_cycles)
+#endif
+STATS_SECT_END;
+
+STATS_SECT_DECL(pm_stats) pm_stats;
+
+STATS_NAME_START(pm_stats)
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_1
+STATS_NAME(pm_stats, sleep_1_count)
+STATS_NAME(pm_stats, sleep_1_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_2
+STATS_NAME(pm_stats, sleep_2_count)
+STATS_NAME(pm_stats, sleep_2_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_3
+STATS_NAME(pm_stats, sleep_3_count)
+STATS_NAME(pm_stats, sleep_3_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_1
+STATS_NAME(pm_stats, deep_sleep_1_count)
+STATS_NAME(pm_stats, deep_sleep_1_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_2
+STATS_NAME(pm_stats, deep_sleep_2_count)
+STATS_NAME(pm_stats, deep_sleep_2_cycles)
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_3
+STATS_NAME(pm_stats, deep_sleep_3_count)
+STATS_NAME(pm_stats, deep_sleep_3_cycles)
+#endif
+STATS_NAME_END(pm_stats);
+
+static void sys_pm_stats_update(enum power_states state)
+{
+	uint32_t res = timer_end - timer_start;
+
+	switch (state) {
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_1
+	case SYS_POWER_STATE_SLEEP_1:
+		STATS_INC(pm_stats, sleep_1_count);
+		STATS_INCN(pm_stats, sleep_1_cycles, res);
+		break;
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_2
+	case SYS_POWER_STATE_SLEEP_2:
+		STATS_INC(pm_stats, sleep_2_count);
+		STATS_INCN(pm_stats, sleep_2_cycles, res);
+		break;
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_SLEEP_3
+	case SYS_POWER_STATE_SLEEP_3:
+		STATS_INC(pm_stats, sleep_3_count);
+		STATS_INCN(pm_stats, sleep_3_cycles, res);
+		break;
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_1
+	case SYS_POWER_STATE_DEEP_SLEEP_1:
+		STATS_INC(pm_stats, deep_sleep_1_count);
+		STATS_INCN(pm_stats, deep_sleep_1_cycles, res);
+		break;
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_2
+	case SYS_POWER_STATE_DEEP_SLEEP_2:
+		STATS_INC(pm_stats, deep_sleep_2_count);
+		STATS_INCN(pm_stats, deep_sleep_2_cycles, res);
+		break;
+#endif
+#ifdef CONFIG_HAS_SYS_POWER_STATE_DEEP_SLEEP_3
+	case SYS_POWER_STATE_DEEP_SLEEP_3:
+		STATS_INC(pm_stats, deep_sleep_3_count);
+		STATS_INCN(pm_stats, deep_sleep_3_cycles, res);
+		break;
+#endif
+	default:
+		break;
+	}
+}
+
+static int sys_pm_stats_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return STATS_INIT_AND_REG(pm_stats, STATS_SIZE_32, "pm");
+}
+SYS_INIT(sys_pm_stats_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else
+static void sys_pm_stats_update(enum power_states state) { }
+#endif /* CONFIG_SYS_PM_STATS */
+
 __weak void sys_pm_notify_power_state_entry(enum power_states state)
 {
 	/* This function can be overridden by the application. */
@@ -155,6 +277,7 @@ enum power_states _sys_suspend(int32_t ticks)
 	}
 #endif
 	sys_pm_log_debug_info(pm_state);
+	sys_pm_stats_update(pm_state);
 
 	if (!post_ops_done) {
 		post_ops_done = 1;
@@ -11,6 +11,107 @@
 
 static const struct device *entropy_driver;
 
+#if defined(CONFIG_ENTROPY_POOL)
+/*
+ * Buffered entropy pool. Serving random number requests from this buffer
+ * makes the hot path a constant-time copy (usable from ISR context); a
+ * work item on the system work queue refills the buffer from the
+ * (potentially slow) entropy driver whenever the fill level drops below
+ * the configured threshold. The driver is only hit directly when the
+ * pool runs dry.
+ */
+static void entropy_pool_refill(struct k_work *work);
+
+static struct k_spinlock entropy_pool_lock;
+static K_WORK_DEFINE(entropy_pool_work, entropy_pool_refill);
+static uint8_t entropy_pool_buffer[CONFIG_ENTROPY_POOL_SIZE];
+static uint16_t entropy_pool_head;
+static uint16_t entropy_pool_count;
+
+static void entropy_pool_refill(struct k_work *work)
+{
+	const struct device *dev = entropy_driver;
+	uint8_t tmp[32];
+	k_spinlock_key_t key;
+	uint16_t chunk, tail;
+	int ret, i;
+
+	ARG_UNUSED(work);
+
+	if (dev == NULL) {
+		return;
+	}
+
+	for (;;) {
+		key = k_spin_lock(&entropy_pool_lock);
+		chunk = sizeof(entropy_pool_buffer) - entropy_pool_count;
+		k_spin_unlock(&entropy_pool_lock, key);
+
+		if (chunk == 0U) {
+			return;
+		}
+
+		chunk = MIN(chunk, sizeof(tmp));
+		ret = entropy_get_entropy(dev, tmp, chunk);
+		if (ret < 0) {
+			return;
+		}
+
+		key = k_spin_lock(&entropy_pool_lock);
+		for (i = 0; i < chunk; i++) {
+			if (entropy_pool_count ==
+			    sizeof(entropy_pool_buffer)) {
+				break;
+			}
+
+			tail = (entropy_pool_head + entropy_pool_count) %
+			       sizeof(entropy_pool_buffer);
+			entropy_pool_buffer[tail] = tmp[i];
+			entropy_pool_count++;
+		}
+		k_spin_unlock(&entropy_pool_lock, key);
+	}
+}
+
+static size_t entropy_pool_get(uint8_t *dst, size_t len)
+{
+	k_spinlock_key_t key;
+	size_t copied = 0;
+
+	key = k_spin_lock(&entropy_pool_lock);
+	while ((copied < len) && (entropy_pool_count > 0U)) {
+		dst[copied++] = entropy_pool_buffer[entropy_pool_head];
+		entropy_pool_head = (entropy_pool_head + 1) %
+				    sizeof(entropy_pool_buffer);
+		entropy_pool_count--;
+	}
+	k_spin_unlock(&entropy_pool_lock, key);
+
+	if (entropy_pool_count < CONFIG_ENTROPY_POOL_THRESHOLD) {
+		k_work_submit(&entropy_pool_work);
+	}
+
+	return copied;
+}
+
+static int entropy_pool_init(const struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	if (entropy_driver == NULL) {
+		entropy_driver =
+			device_get_binding(DT_CHOSEN_ZEPHYR_ENTROPY_LABEL);
+	}
+
+	/* Pre-fill the pool so early consumers do not stall. */
+	k_work_submit(&entropy_pool_work);
+
+	return 0;
+}
+
+SYS_INIT(entropy_pool_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_ENTROPY_POOL */
+
 #if defined(CONFIG_ENTROPY_DEVICE_RANDOM_GENERATOR)
 uint32_t z_impl_sys_rand32_get(void)
 {
@@ -18,6 +119,13 @@ uint32_t z_impl_sys_rand32_get(void)
 	uint32_t random_num;
 	int ret;
 
+#if defined(CONFIG_ENTROPY_POOL)
+	if (entropy_pool_get((uint8_t *)&random_num, sizeof(random_num)) ==
+	    sizeof(random_num)) {
+		return random_num;
+	}
+#endif
+
 	if (unlikely(!dev)) {
 		/* Only one entropy device exists, so this is safe even
 		 * if the whole operation isn't atomic.
@@ -64,6 +172,19 @@ static int rand_get(uint8_t *dst, size_t outlen, bool csrand)
 		entropy_driver = dev;
 	}
 
+#if defined(CONFIG_ENTROPY_POOL)
+	/* Serve from the pool first; only the remainder the pool cannot
+	 * cover goes to the driver.
+	 */
+	size_t pooled = entropy_pool_get(dst, outlen);
+
+	dst += pooled;
+	outlen -= pooled;
+	if (outlen == 0U) {
+		return 0;
+	}
+#endif
+
 	ret = entropy_get_entropy(dev, dst, outlen);
 
 	if (unlikely(ret < 0)) {
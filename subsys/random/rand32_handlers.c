@@ -14,6 +14,14 @@ static inline uint32_t z_vrfy_sys_rand32_get(void)
 }
 #include <syscalls/sys_rand32_get_mrsh.c>
 
+#if defined(CONFIG_FAST_RANDOM_GENERATOR)
+static inline uint32_t z_vrfy_sys_rand32_fast(void)
+{
+	return z_impl_sys_rand32_fast();
+}
+#include <syscalls/sys_rand32_fast_mrsh.c>
+#endif
+
 static inline void z_vrfy_sys_rand_get(void *dst, size_t len)
 {
 	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(dst, len));
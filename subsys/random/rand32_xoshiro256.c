@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ *
+ * Based on code written in 2018 by David Blackman and Sebastiano Vigna
+ * (vigna@acm.org)
+ *
+ * To the extent possible under law, the author has dedicated all copyright
+ * and related and neighboring rights to this software to the public domain
+ * worldwide. This software is distributed without any warranty.
+ *
+ * See <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+/* This is xoshiro256++ 1.0, one of our all-purpose, rock-solid generators.
+ * It has excellent (sub-ns) speed, a state (256 bits) that is large
+ * enough for any parallel application, and it passes all tests we are
+ * aware of.
+ *
+ * Unlike the XOROSHIRO_RANDOM_GENERATOR choice, which replaces
+ * sys_rand32_get(), this generator provides the separate
+ * sys_rand32_fast() tier: the regular random number APIs keep whatever
+ * strength the platform configured, while hot paths that only need
+ * statistically sound values (sequence numbers, query IDs, jitter) can
+ * avoid serializing on the entropy driver.
+ *
+ * One state instance is kept per CPU so that cores do not contend on a
+ * shared cache line. The states are seeded once from the entropy driver
+ * at boot and must not be everywhere zero.
+ */
+
+#include <init.h>
+#include <device.h>
+#include <drivers/entropy.h>
+#include <kernel.h>
+
+static uint64_t state[CONFIG_MP_NUM_CPUS][4];
+
+static inline uint64_t rotl(const uint64_t x, int k)
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+static int xoshiro256_initialize(const struct device *dev)
+{
+	dev = device_get_binding(DT_CHOSEN_ZEPHYR_ENTROPY_LABEL);
+	if (!dev) {
+		return -EINVAL;
+	}
+
+	int32_t rc = entropy_get_entropy_isr(dev, (uint8_t *)&state,
+					     sizeof(state), ENTROPY_BUSYWAIT);
+
+	if (rc == -ENOTSUP) {
+		/* Driver does not provide an ISR-specific API, assume it can
+		 * be called from ISR context
+		 */
+		rc = entropy_get_entropy(dev, (uint8_t *)&state,
+					 sizeof(state));
+	}
+
+	if (rc < 0) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static inline uint64_t *curr_cpu_state(void)
+{
+#if defined(CONFIG_SMP)
+	return state[arch_curr_cpu()->id];
+#else
+	return state[0];
+#endif
+}
+
+static uint32_t xoshiro256_next(uint64_t *s)
+{
+	const uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+	const uint64_t t = s[1] << 17;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+
+	s[2] ^= t;
+
+	s[3] = rotl(s[3], 45);
+
+	/* The upper bits have the best statistical quality */
+	return (uint32_t)(result >> 32);
+}
+
+uint32_t z_impl_sys_rand32_fast(void)
+{
+	unsigned int key;
+	uint32_t ret;
+
+	/* Lock interrupts rather than taking a spinlock: this pins us to
+	 * the current CPU's state and keeps ISRs on this CPU from
+	 * interleaving an update, without ever contending with the other
+	 * CPUs' generators.
+	 */
+	key = arch_irq_lock();
+	ret = xoshiro256_next(curr_cpu_state());
+	arch_irq_unlock(key);
+
+	return ret;
+}
+
+/* In-tree entropy drivers will initialize in PRE_KERNEL_1; ensure that they're
+ * initialized properly before initializing ourselves.
+ */
+SYS_INIT(xoshiro256_initialize, PRE_KERNEL_2,
+	 CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -24,6 +24,52 @@ sys_slist_t settings_handlers;
 
 K_MUTEX_DEFINE(settings_lock);
 
+#if defined(CONFIG_SETTINGS_SORTED_LOOKUP)
+static struct settings_handler_static
+	*settings_sorted[CONFIG_SETTINGS_SORTED_LOOKUP_MAX];
+static int settings_sorted_cnt = -1; /* -1: no index, use the linear scan */
+
+/* Build the sorted handler index, names in ascending strcmp() order */
+static void settings_sorted_build(void)
+{
+	int cnt = 0;
+
+	Z_STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		int i;
+
+		if (cnt == ARRAY_SIZE(settings_sorted)) {
+			settings_sorted_cnt = -1;
+			return;
+		}
+		for (i = cnt; i > 0 &&
+		     strcmp(settings_sorted[i - 1]->name, ch->name) > 0; i--) {
+			settings_sorted[i] = settings_sorted[i - 1];
+		}
+		settings_sorted[i] = ch;
+		cnt++;
+	}
+	settings_sorted_cnt = cnt;
+}
+
+/* Order a stored record name, which may terminate in '\0' or
+ * SETTINGS_NAME_END, against a handler name.
+ */
+static int settings_name_cmp(const char *name, const char *key)
+{
+	uint8_t nc;
+
+	while ((*key != '\0') && (*key == *name) &&
+	       (*name != '\0') && (*name != SETTINGS_NAME_END)) {
+		key++;
+		name++;
+	}
+
+	nc = ((*name == SETTINGS_NAME_END) || (*name == '\0')) ?
+	     0U : (uint8_t)*name;
+
+	return (int)nc - (int)(uint8_t)*key;
+}
+#endif /* CONFIG_SETTINGS_SORTED_LOOKUP */
 
 void settings_store_init(void);
 
@@ -32,6 +78,9 @@ void settings_init(void)
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if defined(CONFIG_SETTINGS_SORTED_LOOKUP)
+	settings_sorted_build();
+#endif
 	settings_store_init();
 }
 
@@ -145,6 +194,45 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		*next = NULL;
 	}
 
+#if defined(CONFIG_SETTINGS_SORTED_LOOKUP)
+	if (settings_sorted_cnt >= 0) {
+		int lo = 0, hi = settings_sorted_cnt - 1;
+
+		/* Every separator aligned prefix of the record name orders
+		 * at or before the record name, the longest one closest to
+		 * it. Find the last handler not ordering after the record
+		 * name and walk down from there.
+		 */
+		while (lo <= hi) {
+			int mid = (lo + hi) / 2;
+
+			if (settings_name_cmp(name,
+					      settings_sorted[mid]->name) < 0) {
+				hi = mid - 1;
+			} else {
+				lo = mid + 1;
+			}
+		}
+
+		for (; hi >= 0; hi--) {
+			struct settings_handler_static *sch =
+				settings_sorted[hi];
+
+			if (sch->name[0] != name[0]) {
+				/* prefixes share the first character */
+				break;
+			}
+			if (settings_name_steq(name, sch->name, &tmpnext)) {
+				bestmatch = sch;
+				if (next) {
+					*next = tmpnext;
+				}
+				break;
+			}
+		}
+	} else {
+#endif /* CONFIG_SETTINGS_SORTED_LOOKUP */
+
 	Z_STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
 			continue;
@@ -164,6 +252,10 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		}
 	}
 
+#if defined(CONFIG_SETTINGS_SORTED_LOOKUP)
+	}
+#endif /* CONFIG_SETTINGS_SORTED_LOOKUP */
+
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	struct settings_handler *ch;
 
@@ -40,6 +40,46 @@ static int cmd_kernel_uptime(const struct shell *shell,
 	return 0;
 }
 
+#if defined(CONFIG_BOOT_TIME_LOG)
+static int cmd_kernel_boot_log(const struct shell *shell,
+			       size_t argc, char **argv)
+{
+	static const char *const level_str[] = {
+		"PRE_KERNEL_1", "PRE_KERNEL_2", "POST_KERNEL",
+		"APPLICATION", "SMP",
+	};
+	const struct init_time_record *records;
+	size_t count;
+	size_t i;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	count = init_time_log_get(&records);
+
+	shell_print(shell, "%-12s %10s %10s %8s  %s",
+		    "level", "start", "cycles", "usec", "entry");
+
+	for (i = 0; i < count; i++) {
+		const struct init_time_record *rec = &records[i];
+		const char *name;
+
+#if defined(CONFIG_BOOT_TIME_LOG_NAMES)
+		name = rec->entry->name;
+#else
+		name = (rec->entry->dev != NULL) ?
+			rec->entry->dev->name : "(SYS_INIT)";
+#endif
+		shell_print(shell, "%-12s %10u %10u %8u  %s (%p)",
+			    level_str[rec->level], rec->start, rec->duration,
+			    (uint32_t)k_cyc_to_us_floor64(rec->duration),
+			    name, rec->entry->init);
+	}
+
+	return 0;
+}
+#endif
+
 static int cmd_kernel_cycles(const struct shell *shell,
 			      size_t argc, char **argv)
 {
@@ -198,6 +238,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_reboot,
 #endif
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
+#if defined(CONFIG_BOOT_TIME_LOG)
+	SHELL_CMD(boot_log, NULL, "Dump boot time log.", cmd_kernel_boot_log),
+#endif
 	SHELL_CMD(cycles, NULL, "Kernel cycles.", cmd_kernel_cycles),
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
@@ -14,6 +14,7 @@
 #include "shell_utils.h"
 #include "shell_vt100.h"
 #include "shell_wildcard.h"
+#include "shell_jobs.h"
 
 /* 2 == 1 char for cmd + 1 char for '\0' */
 #if (CONFIG_SHELL_CMD_BUFF_SIZE < 2)
@@ -475,7 +476,7 @@ static void partial_autocomplete(const struct shell *shell,
 }
 
 static int exec_cmd(const struct shell *shell, size_t argc, const char **argv,
-		    const struct shell_static_entry *help_entry)
+		    const struct shell_static_entry *help_entry, bool in_bg)
 {
 	int ret_val = 0;
 
@@ -508,6 +509,12 @@ static int exec_cmd(const struct shell *shell, size_t argc, const char **argv,
 	}
 
 	if (!ret_val) {
+		if (IS_ENABLED(CONFIG_SHELL_JOBS) && in_bg) {
+			return shell_jobs_submit(shell,
+						 shell->ctx->active_cmd.handler,
+						 argc, argv);
+		}
+
 		flag_cmd_ctx_set(shell, true);
 		/* Unlock thread mutex in case command would like to borrow
 		 * shell context to other thread to avoid mutex deadlock.
@@ -591,6 +598,7 @@ static int execute(const struct shell *shell)
 	const char **argvp;
 	char *cmd_buf = shell->ctx->cmd_buff;
 	bool has_last_handler = false;
+	bool in_bg = false;
 
 	shell_op_cursor_end_move(shell);
 	if (!shell_cursor_in_empty_line(shell)) {
@@ -604,6 +612,11 @@ static int execute(const struct shell *shell)
 	history_put(shell, shell->ctx->cmd_buff,
 		    shell->ctx->cmd_buff_len);
 
+	if (IS_ENABLED(CONFIG_SHELL_JOBS)) {
+		in_bg = shell_jobs_strip_marker(shell->ctx->cmd_buff,
+						&shell->ctx->cmd_buff_len);
+	}
+
 	if (IS_ENABLED(CONFIG_SHELL_WILDCARD)) {
 		shell_wildcard_prepare(shell);
 	}
@@ -745,7 +758,7 @@ static int execute(const struct shell *shell)
 	argv[cmd_lvl] = NULL;
 	/* Executing the deepest found handler. */
 	return exec_cmd(shell, cmd_lvl - cmd_with_handler_lvl,
-			&argv[cmd_with_handler_lvl], &help_entry);
+			&argv[cmd_with_handler_lvl], &help_entry, in_bg);
 }
 
 static void tab_handle(const struct shell *shell)
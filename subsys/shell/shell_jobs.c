@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "shell_jobs.h"
+#include "shell_ops.h"
+
+enum shell_job_state {
+	SHELL_JOB_FREE,
+	SHELL_JOB_RUNNING,
+	SHELL_JOB_DONE,
+};
+
+struct shell_job {
+	enum shell_job_state state;
+	char buf[CONFIG_SHELL_CMD_BUFF_SIZE];
+	const char *argv[CONFIG_SHELL_ARGC_MAX + 1];
+	size_t argc;
+	shell_cmd_handler handler;
+	const struct shell *shell;
+	int ret;
+	struct k_thread thread;
+};
+
+static struct shell_job jobs[CONFIG_SHELL_JOBS_MAX];
+static K_THREAD_STACK_ARRAY_DEFINE(job_stacks, CONFIG_SHELL_JOBS_MAX,
+				   CONFIG_SHELL_JOBS_STACK_SIZE);
+static K_MUTEX_DEFINE(jobs_mtx);
+
+bool shell_jobs_strip_marker(char *cmd, uint16_t *len)
+{
+	/* The marker is only accepted as a separate trailing token so
+	 * that arguments ending with & are left alone.
+	 */
+	if ((*len < 2) || (cmd[*len - 1] != '&') || (cmd[*len - 2] != ' ')) {
+		return false;
+	}
+
+	cmd[--(*len)] = '\0';
+	while ((*len > 0) && (cmd[*len - 1] == ' ')) {
+		cmd[--(*len)] = '\0';
+	}
+
+	return true;
+}
+
+static void job_entry(void *p1, void *p2, void *p3)
+{
+	struct shell_job *job = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	job->ret = job->handler(job->shell, job->argc, (char **)job->argv);
+	job->state = SHELL_JOB_DONE;
+}
+
+int shell_jobs_submit(const struct shell *shell, shell_cmd_handler handler,
+		      size_t argc, const char **argv)
+{
+	struct shell_job *job = NULL;
+	char *dst;
+	int idx;
+
+	k_mutex_lock(&jobs_mtx, K_FOREVER);
+
+	for (idx = 0; idx < CONFIG_SHELL_JOBS_MAX; idx++) {
+		if (jobs[idx].state == SHELL_JOB_FREE) {
+			job = &jobs[idx];
+			break;
+		}
+	}
+
+	if (job == NULL) {
+		k_mutex_unlock(&jobs_mtx);
+		shell_internal_fprintf(shell, SHELL_ERROR,
+				       "No free job slot, see jobs\n");
+		return -EBUSY;
+	}
+
+	/* Arguments point into the command buffer of the shell which is
+	 * reused for the next line, copy them to the job.
+	 */
+	dst = job->buf;
+	for (size_t i = 0; i < argc; i++) {
+		size_t arg_len = strlen(argv[i]) + 1;
+
+		__ASSERT_NO_MSG((dst - job->buf) + arg_len <=
+				sizeof(job->buf));
+		memcpy(dst, argv[i], arg_len);
+		job->argv[i] = dst;
+		dst += arg_len;
+	}
+	job->argv[argc] = NULL;
+	job->argc = argc;
+	job->handler = handler;
+	job->shell = shell;
+	job->ret = 0;
+	job->state = SHELL_JOB_RUNNING;
+
+	k_thread_create(&job->thread, job_stacks[idx],
+			K_THREAD_STACK_SIZEOF(job_stacks[idx]),
+			job_entry, job, NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+	k_thread_name_set(&job->thread, "shell_job");
+
+	k_mutex_unlock(&jobs_mtx);
+
+	shell_internal_fprintf(shell, SHELL_NORMAL, "[%d] running\n", idx);
+
+	return 0;
+}
+
+static void job_cmd_print(const struct shell *shell, struct shell_job *job)
+{
+	for (size_t i = 0; i < job->argc; i++) {
+		shell_fprintf(shell, SHELL_NORMAL, "%s%s", i ? " " : "",
+			      job->argv[i]);
+	}
+	shell_fprintf(shell, SHELL_NORMAL, "\n");
+}
+
+static int cmd_jobs(const struct shell *shell, size_t argc, char **argv)
+{
+	bool any = false;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_mutex_lock(&jobs_mtx, K_FOREVER);
+
+	for (int i = 0; i < CONFIG_SHELL_JOBS_MAX; i++) {
+		struct shell_job *job = &jobs[i];
+
+		if (job->state == SHELL_JOB_FREE) {
+			continue;
+		}
+
+		any = true;
+		if (job->state == SHELL_JOB_RUNNING) {
+			shell_fprintf(shell, SHELL_NORMAL, "[%d] running: ", i);
+			job_cmd_print(shell, job);
+		} else {
+			shell_fprintf(shell, SHELL_NORMAL,
+				      "[%d] done (ret: %d): ", i, job->ret);
+			job_cmd_print(shell, job);
+			/* Reported, release the slot. */
+			job->state = SHELL_JOB_FREE;
+		}
+	}
+
+	k_mutex_unlock(&jobs_mtx);
+
+	if (!any) {
+		shell_print(shell, "No background jobs");
+	}
+
+	return 0;
+}
+
+static int cmd_kill(const struct shell *shell, size_t argc, char **argv)
+{
+	struct shell_job *job;
+	char *end;
+	long id;
+	int ret = 0;
+
+	ARG_UNUSED(argc);
+
+	id = strtol(argv[1], &end, 10);
+	if ((*end != '\0') || (id < 0) || (id >= CONFIG_SHELL_JOBS_MAX)) {
+		shell_error(shell, "Invalid job id: %s", argv[1]);
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&jobs_mtx, K_FOREVER);
+
+	job = &jobs[id];
+	if (job->state != SHELL_JOB_RUNNING) {
+		shell_error(shell, "Job %ld is not running", id);
+		ret = -EINVAL;
+	} else {
+		k_thread_abort(&job->thread);
+		job->ret = -EINTR;
+		job->state = SHELL_JOB_DONE;
+		shell_print(shell, "[%ld] killed", id);
+	}
+
+	k_mutex_unlock(&jobs_mtx);
+
+	return ret;
+}
+
+SHELL_CMD_ARG_REGISTER(jobs, NULL,
+		       "List background jobs and release finished ones.",
+		       cmd_jobs, 1, 0);
+SHELL_CMD_ARG_REGISTER(kill, NULL,
+		       "Abort a background job.\n"
+		       "Usage: kill <job id>\n"
+		       "The job thread is aborted, resources held by the "
+		       "command may leak.",
+		       cmd_kill, 2, 0);
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SHELL_JOBS_H__
+#define SHELL_JOBS_H__
+
+#include <shell/shell.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CONFIG_SHELL_JOBS
+/* Strip a trailing " &" background marker from the command buffer.
+ * Returns true if the marker was present.
+ */
+bool shell_jobs_strip_marker(char *cmd, uint16_t *len);
+
+/* Start the command handler in a background job thread. */
+int shell_jobs_submit(const struct shell *shell, shell_cmd_handler handler,
+		      size_t argc, const char **argv);
+#else
+static inline bool shell_jobs_strip_marker(char *cmd, uint16_t *len)
+{
+	ARG_UNUSED(cmd);
+	ARG_UNUSED(len);
+
+	return false;
+}
+
+static inline int shell_jobs_submit(const struct shell *shell,
+				    shell_cmd_handler handler,
+				    size_t argc, const char **argv)
+{
+	ARG_UNUSED(shell);
+	ARG_UNUSED(handler);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	return -ENOEXEC;
+}
+#endif /* CONFIG_SHELL_JOBS */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHELL_JOBS_H__ */
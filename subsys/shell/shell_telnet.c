@@ -402,11 +402,13 @@ static int write(const struct shell_transport *transport,
 		memcpy(lb->buf + lb->len, (uint8_t *)data + *cnt, copy_len);
 		lb->len += copy_len;
 
-		/* Send the data immediately if the buffer is full or line feed
-		 * is recognized.
+		/* Send the data immediately only if the buffer is full;
+		 * coalescing consecutive lines into one segment instead of
+		 * sending a packet per line fragment. Output that does not
+		 * fill the buffer (e.g. the prompt) is flushed by the
+		 * transmission timer below.
 		 */
-		if (lb->buf[lb->len - 1] == '\n' ||
-		    lb->len == TELNET_LINE_SIZE) {
+		if (lb->len == TELNET_LINE_SIZE) {
 			err = telnet_send();
 			if (err != 0) {
 				*cnt = length;
@@ -227,16 +227,30 @@ static inline uint32_t shell_root_cmd_count(void)
 				sizeof(struct shell_cmd_entry);
 }
 
-/* Function returning pointer to parent command matching requested syntax. */
+/* Function returning pointer to parent command matching requested syntax.
+ *
+ * Root commands are placed in dedicated, per-command input sections named
+ * after the command syntax and emitted with SORT() (see common-rom.ld), so
+ * the array between __shell_root_cmds_start and __shell_root_cmds_end is
+ * ordered by syntax and can be binary searched.  Subcommand arrays carry no
+ * such guarantee and are still scanned linearly (see shell_find_cmd()).
+ */
 const struct shell_static_entry *shell_root_cmd_find(const char *syntax)
 {
-	const size_t cmd_count = shell_root_cmd_count();
-	const struct shell_cmd_entry *cmd;
+	size_t lo = 0;
+	size_t hi = shell_root_cmd_count();
 
-	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
-		cmd = shell_root_cmd_get(cmd_idx);
-		if (strcmp(syntax, cmd->u.entry->syntax) == 0) {
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		const struct shell_cmd_entry *cmd = shell_root_cmd_get(mid);
+		int cmp = strcmp(syntax, cmd->u.entry->syntax);
+
+		if (cmp == 0) {
 			return cmd->u.entry;
+		} else if (cmp < 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
 		}
 	}
 
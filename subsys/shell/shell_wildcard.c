@@ -75,10 +75,27 @@ static enum shell_wildcard_status commands_expand(const struct shell *shell,
 	struct shell_static_entry dloc;
 	size_t cmd_idx = 0;
 	size_t cnt = 0;
+	int match;
+
+#ifdef CONFIG_FNMATCH_COMPILE
+	/* The same pattern is matched against every command on this
+	 * level; compile it once instead of letting fnmatch() reparse
+	 * it per candidate.  Patterns the compiler cannot express are
+	 * matched with plain fnmatch() as before.
+	 */
+	struct fnmatch_pattern compiled;
+	bool use_compiled = fnmatch_compile(pattern, 0, &compiled) == 0;
+#endif
 
 	while ((entry = shell_cmd_get(cmd, cmd_idx++, &dloc)) != NULL) {
 
-		if (fnmatch(pattern, entry->syntax, 0) == 0) {
+#ifdef CONFIG_FNMATCH_COMPILE
+		match = use_compiled ? fnmatch_match(&compiled, entry->syntax) :
+				       fnmatch(pattern, entry->syntax, 0);
+#else
+		match = fnmatch(pattern, entry->syntax, 0);
+#endif
+		if (match == 0) {
 			ret_val = command_add(shell->ctx->temp_buff,
 					      &shell->ctx->cmd_tmp_buff_len,
 					      entry->syntax, pattern);
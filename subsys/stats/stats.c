@@ -7,6 +7,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <errno.h>
+#include <kernel.h>
 #include <zephyr/types.h>
 #include <stats/stats.h>
 
@@ -28,7 +29,7 @@ stats_get_name(const struct stats_hdr *hdr, int idx)
 	 * offset.  This annotation allows for naming only certain statistics,
 	 * and doesn't enforce ordering restrictions on the stats name map.
 	 */
-	off = sizeof(*hdr) + idx * hdr->s_size;
+	off = sizeof(*hdr) + idx * STATS_ENTRY_SPAN(hdr->s_size);
 	for (i = 0; i < hdr->s_map_cnt; i++) {
 		cur = hdr->s_map + i;
 		if (cur->snm_off == off) {
@@ -40,10 +41,19 @@ stats_get_name(const struct stats_hdr *hdr, int idx)
 	return NULL;
 }
 
+/* Number of bytes occupied by one entry in the group structure; with
+ * CONFIG_STATS_PERCPU every entry holds one bucket per CPU.
+ */
+static uint16_t
+stats_entry_span(const struct stats_hdr *hdr)
+{
+	return STATS_ENTRY_SPAN(hdr->s_size);
+}
+
 static uint16_t
 stats_get_off(const struct stats_hdr *hdr, int idx)
 {
-	return sizeof(*hdr) + idx * hdr->s_size;
+	return sizeof(*hdr) + idx * stats_entry_span(hdr);
 }
 
 /**
@@ -280,5 +290,97 @@ stats_init_and_reg(struct stats_hdr *shdr, uint8_t size, uint16_t cnt,
 void
 stats_reset(struct stats_hdr *hdr)
 {
-	(void)memset((uint8_t *)hdr + sizeof(*hdr), 0, hdr->s_size * hdr->s_cnt);
+	(void)memset((uint8_t *)hdr + sizeof(*hdr), 0,
+		     stats_entry_span(hdr) * hdr->s_cnt);
+}
+
+/**
+ * Size of the buffer required to snapshot the specified group.
+ *
+ * @param hdr The statistics header of the group.
+ *
+ * @return Required buffer size, in bytes.
+ */
+size_t
+stats_snapshot_size(const struct stats_hdr *hdr)
+{
+	return (size_t)hdr->s_cnt * hdr->s_size;
+}
+
+/**
+ * Copy the consolidated values of a whole group into a caller buffer.
+ * One value of the group entry size is written per entry, in
+ * declaration order; with CONFIG_STATS_PERCPU the per-CPU buckets of
+ * each entry are summed.
+ *
+ * @param hdr The statistics header of the group to snapshot.
+ * @param buf The destination buffer.
+ * @param buf_size The size of the destination buffer.
+ *
+ * @return 0 on success, -EINVAL if the buffer is too small.
+ */
+int
+stats_snapshot(struct stats_hdr *hdr, void *buf, size_t buf_size)
+{
+	const uint8_t *src = (const uint8_t *)hdr + sizeof(*hdr);
+	uint8_t *dst = buf;
+	unsigned int key;
+
+	if (buf_size < stats_snapshot_size(hdr)) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+
+	if (!IS_ENABLED(CONFIG_STATS_PERCPU)) {
+		memcpy(dst, src, stats_snapshot_size(hdr));
+	} else {
+		for (int i = 0; i < hdr->s_cnt; i++) {
+			switch (hdr->s_size) {
+			case sizeof(uint16_t): {
+				const uint16_t *e = (const uint16_t *)src;
+				uint16_t sum = 0;
+
+				for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS;
+				     cpu++) {
+					sum += e[cpu];
+				}
+				*(uint16_t *)dst = sum;
+				break;
+			}
+			case sizeof(uint32_t): {
+				const uint32_t *e = (const uint32_t *)src;
+				uint32_t sum = 0;
+
+				for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS;
+				     cpu++) {
+					sum += e[cpu];
+				}
+				*(uint32_t *)dst = sum;
+				break;
+			}
+			case sizeof(uint64_t): {
+				const uint64_t *e = (const uint64_t *)src;
+				uint64_t sum = 0;
+
+				for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS;
+				     cpu++) {
+					sum += e[cpu];
+				}
+				*(uint64_t *)dst = sum;
+				break;
+			}
+			default:
+				irq_unlock(key);
+				return -EINVAL;
+			}
+
+			src += stats_entry_span(hdr);
+			dst += hdr->s_size;
+		}
+	}
+
+	irq_unlock(key);
+
+	return 0;
 }
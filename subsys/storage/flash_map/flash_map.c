@@ -9,6 +9,7 @@
 
 #include <zephyr/types.h>
 #include <stddef.h>
+#include <string.h>
 #include <sys/types.h>
 #include <device.h>
 #include <storage/flash_map.h>
@@ -19,7 +20,6 @@
 #if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY)
 #include <tinycrypt/constants.h>
 #include <tinycrypt/sha256.h>
-#include <string.h>
 #endif
 
 #if defined(CONFIG_FLASH_PAGE_LAYOUT)
@@ -37,8 +37,28 @@ struct layout_data {
 extern const struct flash_area *flash_map;
 extern const int flash_map_entries;
 
+/* The distinct flash devices backing the map, bound on first use.
+ * device_get_binding() compares names against every device on each
+ * call and the DFU write path resolves the same device for every
+ * chunk, so remember the result instead.
+ */
+#define FLASH_AREA_DEVICE_CACHE_SIZE 4
+
+static struct {
+	const char *name;	/* NULL while the slot is free */
+	const struct device *dev;
+} flash_area_device_cache[FLASH_AREA_DEVICE_CACHE_SIZE];
+
 static struct flash_area const *get_flash_area_from_id(int idx)
 {
+	/* The default map assigns ids in table order; resolve those by
+	 * direct index and keep the search as fallback for custom maps.
+	 */
+	if ((idx >= 0) && (idx < flash_map_entries) &&
+	    (flash_map[idx].fa_id == idx)) {
+		return &flash_map[idx];
+	}
+
 	for (int i = 0; i < flash_map_entries; i++) {
 		if (flash_map[i].fa_id == idx) {
 			return &flash_map[i];
@@ -145,7 +165,7 @@ flash_page_cb cb, struct layout_data *cb_data)
 	cb_data->ret_len = *cnt;
 	cb_data->status = 0;
 
-	flash_dev = device_get_binding(fa->fa_dev_name);
+	flash_dev = flash_area_get_device(fa);
 	if (flash_dev == NULL) {
 		return -ENODEV;
 	}
@@ -193,7 +213,7 @@ int flash_area_read(const struct flash_area *fa, off_t off, void *dst,
 		return -EINVAL;
 	}
 
-	dev = device_get_binding(fa->fa_dev_name);
+	dev = flash_area_get_device(fa);
 
 	return flash_read(dev, fa->fa_off + off, dst, len);
 }
@@ -208,7 +228,7 @@ int flash_area_write(const struct flash_area *fa, off_t off, const void *src,
 		return -EINVAL;
 	}
 
-	flash_dev = device_get_binding(fa->fa_dev_name);
+	flash_dev = flash_area_get_device(fa);
 
 	rc = flash_write_protection_set(flash_dev, false);
 	if (rc) {
@@ -232,7 +252,7 @@ int flash_area_erase(const struct flash_area *fa, off_t off, size_t len)
 		return -EINVAL;
 	}
 
-	flash_dev = device_get_binding(fa->fa_dev_name);
+	flash_dev = flash_area_get_device(fa);
 
 	rc = flash_write_protection_set(flash_dev, false);
 	if (rc) {
@@ -251,14 +271,14 @@ uint8_t flash_area_align(const struct flash_area *fa)
 {
 	const struct device *dev;
 
-	dev = device_get_binding(fa->fa_dev_name);
+	dev = flash_area_get_device(fa);
 
 	return flash_get_write_block_size(dev);
 }
 
 int flash_area_has_driver(const struct flash_area *fa)
 {
-	if (device_get_binding(fa->fa_dev_name) == NULL) {
+	if (flash_area_get_device(fa) == NULL) {
 		return -ENODEV;
 	}
 
@@ -267,7 +287,30 @@ int flash_area_has_driver(const struct flash_area *fa)
 
 const struct device *flash_area_get_device(const struct flash_area *fa)
 {
-	return device_get_binding(fa->fa_dev_name);
+	const struct device *dev;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(flash_area_device_cache); i++) {
+		if (flash_area_device_cache[i].name == NULL) {
+			break;
+		}
+		if ((flash_area_device_cache[i].name == fa->fa_dev_name) ||
+		    (strcmp(flash_area_device_cache[i].name,
+			    fa->fa_dev_name) == 0)) {
+			return flash_area_device_cache[i].dev;
+		}
+	}
+
+	dev = device_get_binding(fa->fa_dev_name);
+	if ((dev != NULL) && (i < ARRAY_SIZE(flash_area_device_cache))) {
+		/* The device pointer must be visible before the name
+		 * marks the slot as filled.
+		 */
+		flash_area_device_cache[i].dev = dev;
+		flash_area_device_cache[i].name = fa->fa_dev_name;
+	}
+
+	return dev;
 }
 
 #if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY)
@@ -294,7 +337,7 @@ int flash_area_check_int_sha256(const struct flash_area *fa,
 		return -ESRCH;
 	}
 
-	dev = device_get_binding(fa->fa_dev_name);
+	dev = flash_area_get_device(fa);
 	to_read = fac->rblen;
 
 	for (pos = 0; pos < fac->clen; pos += to_read) {
@@ -29,9 +29,18 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 		return rc;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	/* Pages are erased ahead of the write cursor, anything at or
+	 * below the last erased page may hold written data already.
+	 */
+	if (page.start_offset <= ctx->last_erased_page_start_offset) {
+		return 0;
+	}
+#else
 	if (ctx->last_erased_page_start_offset == page.start_offset) {
 		return 0;
 	}
+#endif
 
 	ctx->last_erased_page_start_offset = page.start_offset;
 	LOG_INF("Erasing page at offset 0x%08lx", (long)page.start_offset);
@@ -49,19 +58,19 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+static int flash_sync_buf(struct stream_flash_ctx *ctx, uint8_t *buf,
+			  size_t len)
 {
 	int rc = 0;
 	size_t write_addr = ctx->offset + ctx->bytes_written;
 
 
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
-		if (ctx->buf_bytes == 0) {
+		if (len == 0) {
 			return 0;
 		}
 
-		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
+		rc = stream_flash_erase_page(ctx, write_addr + len - 1);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
 				rc, write_addr);
@@ -70,7 +79,7 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	flash_write_protection_set(ctx->fdev, false);
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, ctx->buf_bytes);
+	rc = flash_write(ctx->fdev, write_addr, buf, len);
 	flash_write_protection_set(ctx->fdev, true);
 
 	if (rc != 0) {
@@ -83,29 +92,108 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < len; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, len);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, len, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 		}
 	}
 
-	ctx->bytes_written += ctx->buf_bytes;
+	ctx->bytes_written += len;
+
+	return rc;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc = flash_sync_buf(ctx, ctx->buf, ctx->buf_bytes);
+
 	ctx->buf_bytes = 0U;
 
 	return rc;
 }
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+
+static K_THREAD_STACK_DEFINE(stream_flash_stack,
+			     CONFIG_STREAM_FLASH_DOUBLE_BUFFER_STACK_SIZE);
+static struct k_work_q stream_flash_workq;
+
+static void stream_flash_write_work(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, work);
+	int rc;
+
+	rc = flash_sync_buf(ctx, ctx->write_buf, ctx->write_buf_bytes);
+	ctx->write_buf_bytes = 0U;
+	if ((rc != 0) && (ctx->write_error == 0)) {
+		ctx->write_error = rc;
+	}
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	/* Erase the page the next buffer will end in while the
+	 * transport is still filling it.
+	 */
+	if (rc == 0) {
+		size_t next_end = ctx->offset + ctx->bytes_written +
+				  ctx->buf_len;
+
+		if (next_end <= ctx->offset + ctx->available) {
+			(void)stream_flash_erase_page(ctx, next_end - 1);
+		}
+	}
+#endif
+
+	k_sem_give(&ctx->idle);
+}
+
+/* Hand the full buffer to the work queue and continue filling the
+ * other half.  Blocks only while the previous write is still in
+ * flight.
+ */
+static int flash_swap(struct stream_flash_ctx *ctx)
+{
+	uint8_t *full = ctx->buf;
+
+	k_sem_take(&ctx->idle, K_FOREVER);
+
+	if (ctx->write_error != 0) {
+		k_sem_give(&ctx->idle);
+		return ctx->write_error;
+	}
+
+	ctx->buf = ctx->write_buf;
+	ctx->write_buf = full;
+	ctx->write_buf_bytes = ctx->buf_bytes;
+	ctx->buf_bytes = 0U;
+	ctx->bytes_queued += ctx->write_buf_bytes;
+
+	k_work_submit_to_queue(&stream_flash_workq, &ctx->work);
+
+	return 0;
+}
+
+/* Wait until no write is in flight and report any worker error */
+static int flash_drain(struct stream_flash_ctx *ctx)
+{
+	k_sem_take(&ctx->idle, K_FOREVER);
+	k_sem_give(&ctx->idle);
+
+	return ctx->write_error;
+}
+
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
 {
@@ -119,9 +207,15 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	if (ctx->bytes_queued + ctx->buf_bytes + len > ctx->available) {
+		return -ENOMEM;
+	}
+#else
 	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
 		return -ENOMEM;
 	}
+#endif
 
 	while ((len - processed) >=
 	       (buf_empty_bytes = ctx->buf_len - ctx->buf_bytes)) {
@@ -129,7 +223,11 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		       buf_empty_bytes);
 
 		ctx->buf_bytes = ctx->buf_len;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+		rc = flash_swap(ctx);
+#else
 		rc = flash_sync(ctx);
+#endif
 
 		if (rc != 0) {
 			return rc;
@@ -145,6 +243,19 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		ctx->buf_bytes += len - processed;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	if (flush) {
+		/* The trailing write below works on settled state, and a
+		 * worker error must not go unreported even when nothing
+		 * is left in the buffer.
+		 */
+		rc = flash_drain(ctx);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+#endif
+
 	if (flush && ctx->buf_bytes > 0) {
 		fill_length = flash_get_write_block_size(ctx->fdev);
 		if (ctx->buf_bytes % fill_length) {
@@ -171,6 +282,9 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 
 		rc = flash_sync(ctx);
 		ctx->bytes_written -= fill_length;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+		ctx->bytes_queued = ctx->bytes_written;
+#endif
 	}
 
 	return rc;
@@ -181,6 +295,45 @@ size_t stream_flash_bytes_written(struct stream_flash_ctx *ctx)
 	return ctx->bytes_written;
 }
 
+int stream_flash_progress_set(struct stream_flash_ctx *ctx,
+			      size_t bytes_written)
+{
+	if (!ctx) {
+		return -EFAULT;
+	}
+
+	if (bytes_written > ctx->available ||
+	    bytes_written % flash_get_write_block_size(ctx->fdev) ||
+	    ctx->buf_bytes != 0U || ctx->bytes_written != 0U) {
+		LOG_ERR("Incorrect parameter");
+		return -EFAULT;
+	}
+
+	ctx->bytes_written = bytes_written;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	ctx->bytes_queued = bytes_written;
+#endif
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	if (bytes_written > 0) {
+		int rc;
+		struct flash_pages_info page;
+		off_t off = ctx->offset + bytes_written - 1;
+
+		/* No need to erase the pages that already hold data */
+		rc = flash_get_page_info_by_offs(ctx->fdev, off, &page);
+		if (rc != 0) {
+			LOG_ERR("Error %d while getting page info", rc);
+			return rc;
+		}
+
+		ctx->last_erased_page_start_offset = page.start_offset;
+	}
+#endif
+
+	return 0;
+}
+
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		      uint8_t *buf, size_t buf_len, size_t offset, size_t size,
 		      stream_flash_callback_t cb)
@@ -199,6 +352,18 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		return -EFAULT;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	/* The buffer is split in two halves that ping-pong between the
+	 * caller and the write work queue.
+	 */
+	if ((buf_len / 2) % flash_get_write_block_size(fdev) ||
+	    (buf_len / 2) == 0) {
+		LOG_ERR("Buffer halves are not aligned to write-block-size");
+		return -EFAULT;
+	}
+	buf_len /= 2;
+#endif
+
 	/* Calculate the total size of the flash device */
 	api->page_layout(fdev, &layout, &layout_size);
 	for (int i = 0; i < layout_size; i++) {
@@ -233,5 +398,24 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 	ctx->last_erased_page_start_offset = -1;
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	static bool workq_started;
+
+	if (!workq_started) {
+		k_work_q_start(&stream_flash_workq, stream_flash_stack,
+			       K_THREAD_STACK_SIZEOF(stream_flash_stack),
+			       K_LOWEST_APPLICATION_THREAD_PRIO);
+		k_thread_name_set(&stream_flash_workq.thread, "stream_flash");
+		workq_started = true;
+	}
+
+	ctx->write_buf = buf + buf_len;
+	ctx->write_buf_bytes = 0U;
+	ctx->bytes_queued = 0U;
+	ctx->write_error = 0;
+	k_work_init(&ctx->work, stream_flash_write_work);
+	k_sem_init(&ctx->idle, 1, 1);
+#endif
+
 	return 0;
 }
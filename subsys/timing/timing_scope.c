@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <init.h>
+#include <string.h>
+#include <sys/math_extras.h>
+#include <timing/timing.h>
+#include <timing/timing_scope.h>
+
+#ifdef CONFIG_TIMING_SCOPE_SHELL
+#include <shell/shell.h>
+#include <stdlib.h>
+#endif
+
+void timing_scope_record(struct timing_scope *scope, timing_t start)
+{
+	timing_t end = timing_counter_get();
+	uint64_t cycles = timing_cycles_get(&start, &end);
+	unsigned int bucket;
+	unsigned int key;
+
+	if (cycles == 0U) {
+		bucket = 0;
+	} else {
+		bucket = 63 - u64_count_leading_zeros(cycles);
+		bucket = MIN(bucket, TIMING_SCOPE_NUM_BUCKETS - 1);
+	}
+
+	/* Aggregates are shared between CPUs but only touched under the
+	 * local IRQ lock; a lost cross-CPU update skews one sample at
+	 * worst, which is preferable to serializing every measured site
+	 * on a global lock.  The bucket counters are per CPU.
+	 */
+	key = arch_irq_lock();
+
+	scope->count++;
+	scope->total_cycles += cycles;
+	if (cycles > scope->max_cycles) {
+		scope->max_cycles = cycles;
+	}
+
+#ifdef CONFIG_SMP
+	scope->hits[arch_curr_cpu()->id][bucket]++;
+#else
+	scope->hits[0][bucket]++;
+#endif
+
+	arch_irq_unlock(key);
+}
+
+void timing_scope_reset(void)
+{
+	Z_STRUCT_SECTION_FOREACH(timing_scope, scope) {
+		unsigned int key = arch_irq_lock();
+
+		scope->count = 0;
+		scope->total_cycles = 0;
+		scope->max_cycles = 0;
+		(void)memset(scope->hits, 0, sizeof(scope->hits));
+
+		arch_irq_unlock(key);
+	}
+}
+
+void timing_scope_foreach(void (*cb)(const struct timing_scope *scope,
+				     void *user_data),
+			  void *user_data)
+{
+	Z_STRUCT_SECTION_FOREACH(timing_scope, scope) {
+		cb(scope, user_data);
+	}
+}
+
+static int timing_scope_init(const struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	timing_init();
+	timing_start();
+
+	return 0;
+}
+
+SYS_INIT(timing_scope_init, PRE_KERNEL_2, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#ifdef CONFIG_TIMING_SCOPE_SHELL
+
+static void scope_print(const struct timing_scope *scope,
+			const struct shell *shell)
+{
+	uint64_t avg_ns = 0;
+
+	if (scope->count != 0U) {
+		avg_ns = timing_cycles_to_ns_avg(scope->total_cycles,
+						 scope->count);
+	}
+
+	/* The shell formatter has no long long support */
+	shell_print(shell, "%s: %u samples, avg %u ns, max %u ns",
+		    scope->name, scope->count, (uint32_t)avg_ns,
+		    (uint32_t)timing_cycles_to_ns(scope->max_cycles));
+
+	for (int bucket = 0; bucket < TIMING_SCOPE_NUM_BUCKETS; bucket++) {
+		uint32_t hits = 0;
+
+		for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+			hits += scope->hits[cpu][bucket];
+		}
+
+		if (hits != 0U) {
+			shell_print(shell, "  < %u ns: %u",
+				    (uint32_t)timing_cycles_to_ns(2ULL <<
+								  bucket),
+				    hits);
+		}
+	}
+}
+
+static int cmd_timing_scope_dump(const struct shell *shell, size_t argc,
+				 char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	Z_STRUCT_SECTION_FOREACH(timing_scope, scope) {
+		scope_print(scope, shell);
+	}
+
+	return 0;
+}
+
+static int cmd_timing_scope_reset(const struct shell *shell, size_t argc,
+				  char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	timing_scope_reset();
+	shell_print(shell, "Timing scopes reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_timing_scope,
+	SHELL_CMD(dump, NULL, "Dump measurement site histograms",
+		  cmd_timing_scope_dump),
+	SHELL_CMD(reset, NULL, "Reset measurement site histograms",
+		  cmd_timing_scope_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(timing_scope, &sub_timing_scope,
+		   "Scoped timing measurement commands", NULL);
+
+#endif /* CONFIG_TIMING_SCOPE_SHELL */
@@ -18,6 +18,16 @@ extern "C" {
 
 #define TRACING_UNLOCK()	{ irq_unlock(key); } }
 
+/* Asynchronous producers write into a per-CPU ring buffer and only
+ * need protection against other contexts on the same CPU, so a
+ * CPU-local interrupt lock is enough and the global lock irq_lock()
+ * takes on SMP is avoided. Synchronous tracing also drives the
+ * backend under its lock and keeps using TRACING_LOCK().
+ */
+#define TRACING_CPU_LOCK()	{ unsigned int key; key = arch_irq_lock()
+
+#define TRACING_CPU_UNLOCK()	{ arch_irq_unlock(key); } }
+
 /**
  * @brief Check tracing enabled or not.
  *
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _TRACE_THREAD_PROFILER_H
+#define _TRACE_THREAD_PROFILER_H
+#include <kernel.h>
+#include <kernel_structs.h>
+#include <init.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void sys_trace_thread_switched_in(void);
+void sys_trace_thread_switched_out(void);
+void sys_trace_thread_ready(struct k_thread *thread);
+
+/**
+ * @brief Reset the profiler counters of all threads.
+ */
+void thread_profiler_reset(void);
+
+#define sys_trace_isr_enter()
+#define sys_trace_isr_exit()
+#define sys_trace_isr_exit_to_scheduler()
+#define sys_trace_idle()
+
+#define sys_trace_thread_priority_set(thread)
+#define sys_trace_thread_info(thread)
+#define sys_trace_thread_create(thread)
+#define sys_trace_thread_abort(thread)
+#define sys_trace_thread_suspend(thread)
+#define sys_trace_thread_resume(thread)
+#define sys_trace_thread_pend(thread)
+#define sys_trace_thread_name_set(thread)
+
+#define sys_trace_void(id)
+#define sys_trace_end_call(id)
+#define sys_trace_semaphore_init(sem)
+#define sys_trace_semaphore_take(sem)
+#define sys_trace_semaphore_give(sem)
+#define sys_trace_mutex_init(mutex)
+#define sys_trace_mutex_lock(mutex)
+#define sys_trace_mutex_unlock(mutex)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TRACE_THREAD_PROFILER_H */
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <tracing_thread_profiler.h>
+#include <stats/stats.h>
+#include <shell/shell.h>
+#include <debug/thread_analyzer.h>
+
+/* Cycle stamp taken when the running thread was switched in, kept per
+ * CPU as each CPU switches threads independently.
+ */
+static uint32_t switched_in_cycle[CONFIG_MP_NUM_CPUS];
+
+#ifdef CONFIG_STATS
+STATS_SECT_START(thread_profiler_stats)
+	STATS_SECT_ENTRY(context_switches)
+	STATS_SECT_ENTRY(max_latency_cyc)
+STATS_SECT_END;
+
+STATS_NAME_START(thread_profiler_stats)
+	STATS_NAME(thread_profiler_stats, context_switches)
+	STATS_NAME(thread_profiler_stats, max_latency_cyc)
+STATS_NAME_END(thread_profiler_stats);
+
+STATS_SECT_DECL(thread_profiler_stats) thread_profiler_stats;
+#endif /* CONFIG_STATS */
+
+static uint32_t *cpu_switched_in_cycle(void)
+{
+#ifdef CONFIG_SMP
+	return &switched_in_cycle[arch_curr_cpu()->id];
+#else
+	return &switched_in_cycle[0];
+#endif
+}
+
+void sys_trace_thread_ready(struct k_thread *thread)
+{
+	uint32_t cyc = k_cycle_get_32();
+
+	/* A zero stamp means no stamp is pending, avoid storing it. */
+	thread->profiler.ready_cycle = (cyc == 0U) ? 1U : cyc;
+}
+
+void sys_trace_thread_switched_in(void)
+{
+	struct k_thread *thread = k_current_get();
+	uint32_t now = k_cycle_get_32();
+	int key = irq_lock();
+
+	thread->profiler.switches++;
+
+	if (thread->profiler.ready_cycle != 0) {
+		/* The stamp may lead now by one cycle because of the
+		 * zero avoidance when it was taken, clamp to zero.
+		 */
+		int32_t delta = (int32_t)(now - thread->profiler.ready_cycle);
+		uint32_t latency = (delta > 0) ? (uint32_t)delta : 0U;
+
+		if (latency > thread->profiler.max_latency) {
+			thread->profiler.max_latency = latency;
+#ifdef CONFIG_STATS
+			if (latency > thread_profiler_stats.max_latency_cyc) {
+				thread_profiler_stats.max_latency_cyc = latency;
+			}
+#endif
+		}
+		thread->profiler.ready_cycle = 0;
+	}
+
+	*cpu_switched_in_cycle() = now;
+
+	STATS_INC(thread_profiler_stats, context_switches);
+	irq_unlock(key);
+}
+
+void sys_trace_thread_switched_out(void)
+{
+	struct k_thread *thread = k_current_get();
+	int key = irq_lock();
+
+	thread->profiler.cycles +=
+		(uint32_t)(k_cycle_get_32() - *cpu_switched_in_cycle());
+	irq_unlock(key);
+}
+
+static void thread_profiler_reset_cb(const struct k_thread *cthread,
+				     void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+
+	ARG_UNUSED(user_data);
+
+	thread->profiler.cycles = 0;
+	thread->profiler.switches = 0;
+	thread->profiler.max_latency = 0;
+}
+
+void thread_profiler_reset(void)
+{
+	k_thread_foreach(thread_profiler_reset_cb, NULL);
+
+#ifdef CONFIG_STATS
+	thread_profiler_stats.context_switches = 0;
+	thread_profiler_stats.max_latency_cyc = 0;
+#endif
+}
+
+static int thread_profiler_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		switched_in_cycle[cpu] = k_cycle_get_32();
+	}
+
+#ifdef CONFIG_STATS
+	(void)STATS_INIT_AND_REG(thread_profiler_stats, STATS_SIZE_32,
+				 "thread_profiler");
+#endif
+
+	return 0;
+}
+
+SYS_INIT(thread_profiler_init, PRE_KERNEL_1, 0);
+
+#ifdef CONFIG_TRACING_THREAD_PROFILER_SHELL
+static int cmd_profiler_dump(const struct shell *shell, size_t argc,
+			     char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	thread_analyzer_print();
+
+	return 0;
+}
+
+static int cmd_profiler_reset(const struct shell *shell, size_t argc,
+			      char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	thread_profiler_reset();
+	shell_print(shell, "Profiler counters reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_profiler,
+	SHELL_CMD(dump, NULL, "Dump per-thread cycle statistics.",
+		  cmd_profiler_dump),
+	SHELL_CMD(reset, NULL, "Reset the profiler counters of all threads.",
+		  cmd_profiler_reset),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(profiler, &sub_profiler, "Thread profiler commands", NULL);
+#endif /* CONFIG_TRACING_THREAD_PROFILER_SHELL */
@@ -4,12 +4,35 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <kernel.h>
 #include <sys/ring_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+/*
+ * Each CPU produces trace data into its own ring buffer, so producers
+ * on different CPUs never contend for buffer space and only need to be
+ * serialized against other contexts on the same CPU. Records are still
+ * built zero-copy in ring memory with the put claim/finish API. The
+ * single consumer drains one ring completely before moving to the
+ * next one, so a record which wrapped inside its ring is never
+ * interleaved with records from another CPU.
+ */
+static struct ring_buf tracing_ring_buf[CONFIG_MP_NUM_CPUS];
+static uint8_t tracing_buffer[CONFIG_MP_NUM_CPUS]
+			     [CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
+/* Ring currently drained by the consumer. */
+static uint8_t consuming_cpu;
+
+static struct ring_buf *producing_ring_buf(void)
+{
+#ifdef CONFIG_SMP
+	return &tracing_ring_buf[arch_curr_cpu()->id];
+#else
+	return &tracing_ring_buf[0];
+#endif
+}
+
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 {
 	*data = &tracing_cmd_buffer[0];
@@ -19,51 +42,84 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_put_claim(&tracing_ring_buf, data, size);
+	return ring_buf_put_claim(producing_ring_buf(), data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
-	return ring_buf_put_finish(&tracing_ring_buf, size);
+	return ring_buf_put_finish(producing_ring_buf(), size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+	return ring_buf_put(producing_ring_buf(), data, size);
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_get_claim(&tracing_ring_buf, data, size);
+	uint32_t claimed_size;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		claimed_size = ring_buf_get_claim(
+				&tracing_ring_buf[consuming_cpu], data, size);
+		if (claimed_size > 0) {
+			return claimed_size;
+		}
+
+		consuming_cpu = (consuming_cpu + 1) % CONFIG_MP_NUM_CPUS;
+	}
+
+	return 0;
 }
 
 int tracing_buffer_get_finish(uint32_t size)
 {
-	return ring_buf_get_finish(&tracing_ring_buf, size);
+	return ring_buf_get_finish(&tracing_ring_buf[consuming_cpu], size);
 }
 
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
 {
-	return ring_buf_get(&tracing_ring_buf, data, size);
+	uint32_t length;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		length = ring_buf_get(&tracing_ring_buf[consuming_cpu],
+				      data, size);
+		if (length > 0) {
+			return length;
+		}
+
+		consuming_cpu = (consuming_cpu + 1) % CONFIG_MP_NUM_CPUS;
+	}
+
+	return 0;
 }
 
 void tracing_buffer_init(void)
 {
-	ring_buf_init(&tracing_ring_buf,
-		      sizeof(tracing_buffer), tracing_buffer);
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		ring_buf_init(&tracing_ring_buf[cpu],
+			      sizeof(tracing_buffer[cpu]),
+			      tracing_buffer[cpu]);
+	}
 }
 
 bool tracing_buffer_is_empty(void)
 {
-	return ring_buf_is_empty(&tracing_ring_buf);
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[cpu])) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 uint32_t tracing_buffer_capacity_get(void)
 {
-	return ring_buf_capacity_get(&tracing_ring_buf);
+	return ring_buf_capacity_get(producing_ring_buf());
 }
 
 uint32_t tracing_buffer_space_get(void)
 {
-	return ring_buf_space_get(&tracing_ring_buf);
+	return ring_buf_space_get(producing_ring_buf());
 }
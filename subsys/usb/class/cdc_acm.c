@@ -176,6 +176,16 @@ struct cdc_acm_dev_data_t {
 	struct k_work cb_work;
 #if defined(CONFIG_CDC_ACM_DTE_RATE_CALLBACK_SUPPORT)
 	cdc_dte_rate_callback_t rate_cb;
+#endif
+#if defined(CONFIG_CDC_ACM_RINGBUF_API)
+	/* Ring buffer event callback/arg and pending event bitmap */
+	cdc_acm_event_callback_t event_cb;
+	void *event_cb_data;
+	atomic_t event_flags;
+	struct k_work event_work;
+	/* Watermark levels, zero disables the respective event */
+	uint32_t tx_watermark;
+	uint32_t rx_watermark;
 #endif
 	struct k_work tx_work;
 	/* Tx ready status. Signals when */
@@ -276,6 +286,86 @@ int cdc_acm_class_handle_req(struct usb_setup_packet *pSetup,
 	return 0;
 }
 
+#if defined(CONFIG_CDC_ACM_RINGBUF_API)
+static void cdc_acm_event_work_handler(struct k_work *work)
+{
+	struct cdc_acm_dev_data_t *dev_data =
+		CONTAINER_OF(work, struct cdc_acm_dev_data_t, event_work);
+	atomic_val_t events = atomic_clear(&dev_data->event_flags);
+
+	if (dev_data->event_cb == NULL) {
+		return;
+	}
+
+	if (events & BIT(CDC_ACM_EVENT_TX_SPACE)) {
+		dev_data->event_cb(dev_data->common.dev,
+				   CDC_ACM_EVENT_TX_SPACE,
+				   dev_data->event_cb_data);
+	}
+
+	if (events & BIT(CDC_ACM_EVENT_RX_DATA)) {
+		dev_data->event_cb(dev_data->common.dev,
+				   CDC_ACM_EVENT_RX_DATA,
+				   dev_data->event_cb_data);
+	}
+}
+
+static void cdc_acm_event_submit(struct cdc_acm_dev_data_t *dev_data,
+				 enum cdc_acm_event event)
+{
+	atomic_or(&dev_data->event_flags, BIT(event));
+	k_work_submit_to_queue(&USB_WORK_Q, &dev_data->event_work);
+}
+
+/* The watermark checks are edge triggered: only the update that crosses
+ * the configured level submits the callback work, so a busy stream does
+ * not flood the work queue. The caller passes the number of bytes the
+ * update just made available.
+ */
+static void cdc_acm_tx_space_check(struct cdc_acm_dev_data_t *dev_data,
+				   uint32_t freed)
+{
+	uint32_t watermark = dev_data->tx_watermark;
+	uint32_t space;
+
+	if (dev_data->event_cb == NULL || watermark == 0U) {
+		return;
+	}
+
+	space = ring_buf_space_get(dev_data->tx_ringbuf);
+	if (space >= watermark && space - freed < watermark) {
+		cdc_acm_event_submit(dev_data, CDC_ACM_EVENT_TX_SPACE);
+	}
+}
+
+static void cdc_acm_rx_data_check(struct cdc_acm_dev_data_t *dev_data,
+				  uint32_t wrote)
+{
+	uint32_t watermark = dev_data->rx_watermark;
+	uint32_t level;
+
+	if (dev_data->event_cb == NULL || watermark == 0U) {
+		return;
+	}
+
+	level = ring_buf_capacity_get(dev_data->rx_ringbuf) -
+		ring_buf_space_get(dev_data->rx_ringbuf);
+	if (level >= watermark && level - wrote < watermark) {
+		cdc_acm_event_submit(dev_data, CDC_ACM_EVENT_RX_DATA);
+	}
+}
+#else
+static inline void cdc_acm_tx_space_check(struct cdc_acm_dev_data_t *dev_data,
+					  uint32_t freed)
+{
+}
+
+static inline void cdc_acm_rx_data_check(struct cdc_acm_dev_data_t *dev_data,
+					 uint32_t wrote)
+{
+}
+#endif /* CONFIG_CDC_ACM_RINGBUF_API */
+
 static void cdc_acm_write_cb(uint8_t ep, int size, void *priv)
 {
 	struct cdc_acm_dev_data_t *dev_data = priv;
@@ -338,6 +428,7 @@ static void tx_work_handler(struct k_work *work)
 		     cdc_acm_write_cb, dev_data);
 
 	ring_buf_get_finish(dev_data->tx_ringbuf, len);
+	cdc_acm_tx_space_check(dev_data, len);
 }
 
 static void cdc_acm_read_cb(uint8_t ep, int size, void *priv)
@@ -357,6 +448,8 @@ static void cdc_acm_read_cb(uint8_t ep, int size, void *priv)
 		LOG_ERR("Ring buffer full, drop %zd bytes", size - wrote);
 	}
 
+	cdc_acm_rx_data_check(dev_data, wrote);
+
 done:
 	dev_data->rx_ready = true;
 
@@ -549,6 +642,9 @@ static int cdc_acm_init(const struct device *dev)
 	k_sem_init(&dev_data->poll_wait_sem, 0, UINT_MAX);
 	k_work_init(&dev_data->cb_work, cdc_acm_irq_callback_work_handler);
 	k_work_init(&dev_data->tx_work, tx_work_handler);
+#if defined(CONFIG_CDC_ACM_RINGBUF_API)
+	k_work_init(&dev_data->event_work, cdc_acm_event_work_handler);
+#endif
 
 	return ret;
 }
@@ -785,6 +881,92 @@ int cdc_acm_dte_rate_callback_set(const struct device *dev,
 }
 #endif
 
+#if defined(CONFIG_CDC_ACM_RINGBUF_API)
+int cdc_acm_event_callback_set(const struct device *dev,
+			       cdc_acm_event_callback_t callback,
+			       void *user_data)
+{
+	struct cdc_acm_dev_data_t * const dev_data = DEV_DATA(dev);
+
+	if (dev->api != &cdc_acm_driver_api) {
+		return -EINVAL;
+	}
+
+	dev_data->event_cb = callback;
+	dev_data->event_cb_data = user_data;
+
+	return 0;
+}
+
+int cdc_acm_tx_watermark_set(const struct device *dev, uint32_t space)
+{
+	struct cdc_acm_dev_data_t * const dev_data = DEV_DATA(dev);
+
+	if (dev->api != &cdc_acm_driver_api ||
+	    space > ring_buf_capacity_get(dev_data->tx_ringbuf)) {
+		return -EINVAL;
+	}
+
+	dev_data->tx_watermark = space;
+
+	return 0;
+}
+
+int cdc_acm_rx_watermark_set(const struct device *dev, uint32_t level)
+{
+	struct cdc_acm_dev_data_t * const dev_data = DEV_DATA(dev);
+
+	if (dev->api != &cdc_acm_driver_api ||
+	    level > ring_buf_capacity_get(dev_data->rx_ringbuf)) {
+		return -EINVAL;
+	}
+
+	dev_data->rx_watermark = level;
+
+	return 0;
+}
+
+uint32_t cdc_acm_tx_claim(const struct device *dev, uint8_t **data,
+			  uint32_t size)
+{
+	struct cdc_acm_dev_data_t * const dev_data = DEV_DATA(dev);
+
+	return ring_buf_put_claim(dev_data->tx_ringbuf, data, size);
+}
+
+int cdc_acm_tx_commit(const struct device *dev, uint32_t size)
+{
+	struct cdc_acm_dev_data_t * const dev_data = DEV_DATA(dev);
+	int ret;
+
+	ret = ring_buf_put_finish(dev_data->tx_ringbuf, size);
+	if (ret) {
+		return ret;
+	}
+
+	if (dev_data->configured && !dev_data->suspended) {
+		k_work_submit_to_queue(&USB_WORK_Q, &dev_data->tx_work);
+	}
+
+	return 0;
+}
+
+uint32_t cdc_acm_rx_claim(const struct device *dev, uint8_t **data,
+			  uint32_t size)
+{
+	struct cdc_acm_dev_data_t * const dev_data = DEV_DATA(dev);
+
+	return ring_buf_get_claim(dev_data->rx_ringbuf, data, size);
+}
+
+int cdc_acm_rx_finish(const struct device *dev, uint32_t size)
+{
+	struct cdc_acm_dev_data_t * const dev_data = DEV_DATA(dev);
+
+	return ring_buf_get_finish(dev_data->rx_ringbuf, size);
+}
+#endif /* CONFIG_CDC_ACM_RINGBUF_API */
+
 #ifdef CONFIG_UART_LINE_CTRL
 
 /**
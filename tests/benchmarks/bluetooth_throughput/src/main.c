@@ -0,0 +1,543 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Bluetooth LE throughput benchmark pair.
+ *
+ * Build the same application twice, once with overlay-central.conf and
+ * once with overlay-peripheral.conf, and flash each image on one of two
+ * boards in radio range. The pair then runs three phases:
+ *
+ * 1. GATT notification throughput, peripheral to central, at the
+ *    negotiated ATT MTU.
+ * 2. L2CAP connection-oriented channel goodput, central to peripheral.
+ * 3. Connection event utilization read from the controller, when the
+ *    image runs the split controller with CONFIG_BT_CTLR_CONN_METRICS.
+ *
+ * Throughput records are printed as CSV::
+ *
+ *    bench,<name>,<payload>,<bytes>,<kbps>,<phy_permille>,0
+ *
+ * where <phy_permille> is the goodput as a fraction of the raw 1M PHY
+ * line rate, so scheduling losses across releases and across connection
+ * counts can be diffed mechanically.
+ */
+
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <sys/byteorder.h>
+
+#include <bluetooth/bluetooth.h>
+#include <bluetooth/hci.h>
+#include <bluetooth/conn.h>
+#include <bluetooth/uuid.h>
+#include <bluetooth/gatt.h>
+#include <bluetooth/l2cap.h>
+#if defined(CONFIG_BT_CTLR_CONN_METRICS)
+#include <bluetooth/controller.h>
+#endif
+
+#define BENCH_DURATION_MS 5000
+#define BENCH_L2CAP_PSM   0x0080
+
+/* Raw 1M PHY line rate used as the theoretical reference. */
+#define BENCH_PHY_BPS 1000000U
+
+/* Custom service: 12340000-5678-1234-5678-123456789abc
+ * Characteristic:  12340001-5678-1234-5678-123456789abc
+ */
+#define BENCH_UUID_SVC_VAL \
+	0xbc, 0x9a, 0x78, 0x56, 0x34, 0x12, 0x78, 0x56, \
+	0x34, 0x12, 0x78, 0x56, 0x00, 0x00, 0x34, 0x12
+#define BENCH_UUID_CHR_VAL \
+	0xbc, 0x9a, 0x78, 0x56, 0x34, 0x12, 0x78, 0x56, \
+	0x34, 0x12, 0x78, 0x56, 0x01, 0x00, 0x34, 0x12
+
+static struct bt_uuid_128 bench_svc_uuid =
+	BT_UUID_INIT_128(BENCH_UUID_SVC_VAL);
+static struct bt_uuid_128 bench_chr_uuid =
+	BT_UUID_INIT_128(BENCH_UUID_CHR_VAL);
+
+static struct bt_conn *default_conn;
+static K_SEM_DEFINE(conn_sem, 0, 1);
+static K_SEM_DEFINE(disconn_sem, 0, 1);
+
+static void report(const char *name, uint32_t payload, uint32_t bytes,
+		   int64_t duration_ms)
+{
+	uint32_t kbps = 0U;
+	uint32_t permille = 0U;
+
+	if (duration_ms > 0) {
+		kbps = (uint32_t)(((uint64_t)bytes * 8U) / duration_ms);
+		permille = (uint32_t)((uint64_t)kbps * 1000U * 1000U /
+				      BENCH_PHY_BPS);
+	}
+
+	printk("bench,%s,%u,%u,%u,%u,0\n", name, payload, bytes, kbps,
+	       permille);
+}
+
+static void report_conn_metrics(void)
+{
+#if defined(CONFIG_BT_CTLR_CONN_METRICS)
+	uint32_t events;
+	uint32_t events_trx;
+	uint32_t trx;
+
+	bt_ctlr_conn_metrics_get(&events, &events_trx, &trx);
+
+	/* Utilization record: events with data as a fraction of all
+	 * scheduled events, in permille.
+	 */
+	printk("bench,conn_events,%u,%u,%u,%u,0\n", events, events_trx, trx,
+	       events ? (uint32_t)((uint64_t)events_trx * 1000U / events) : 0U);
+	bt_ctlr_conn_metrics_reset();
+#endif
+}
+
+#if defined(CONFIG_BT_PERIPHERAL)
+
+static volatile bool notify_enabled;
+static uint8_t tx_data[244];
+
+static void bench_ccc_changed(const struct bt_gatt_attr *attr, uint16_t value)
+{
+	notify_enabled = (value == BT_GATT_CCC_NOTIFY);
+}
+
+BT_GATT_SERVICE_DEFINE(bench_svc,
+	BT_GATT_PRIMARY_SERVICE(&bench_svc_uuid),
+	BT_GATT_CHARACTERISTIC(&bench_chr_uuid.uuid, BT_GATT_CHRC_NOTIFY,
+			       BT_GATT_PERM_NONE, NULL, NULL, NULL),
+	BT_GATT_CCC(bench_ccc_changed,
+		    BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
+);
+
+static const struct bt_data ad[] = {
+	BT_DATA_BYTES(BT_DATA_FLAGS, (BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR)),
+	BT_DATA_BYTES(BT_DATA_UUID128_ALL, BENCH_UUID_SVC_VAL),
+};
+
+/* L2CAP receive side; the report is printed when the channel goes down
+ * so the window covers first to last SDU only.
+ */
+static uint32_t l2cap_rx_bytes;
+static int64_t l2cap_rx_start;
+static int64_t l2cap_rx_last;
+
+static int l2cap_recv(struct bt_l2cap_chan *chan, struct net_buf *buf)
+{
+	if (l2cap_rx_bytes == 0U) {
+		l2cap_rx_start = k_uptime_get();
+	}
+
+	l2cap_rx_bytes += buf->len;
+	l2cap_rx_last = k_uptime_get();
+
+	return 0;
+}
+
+static void l2cap_disconnected(struct bt_l2cap_chan *chan)
+{
+	report("l2cap_rx", 0, l2cap_rx_bytes, l2cap_rx_last - l2cap_rx_start);
+	l2cap_rx_bytes = 0U;
+}
+
+static const struct bt_l2cap_chan_ops l2cap_ops = {
+	.recv = l2cap_recv,
+	.disconnected = l2cap_disconnected,
+};
+
+static struct bt_l2cap_le_chan le_chan;
+
+static int l2cap_accept(struct bt_conn *conn, struct bt_l2cap_chan **chan)
+{
+	le_chan.chan.ops = &l2cap_ops;
+	*chan = &le_chan.chan;
+
+	return 0;
+}
+
+static struct bt_l2cap_server l2cap_server = {
+	.psm = BENCH_L2CAP_PSM,
+	.accept = l2cap_accept,
+};
+
+static void run_role(void)
+{
+	int err;
+
+	err = bt_l2cap_server_register(&l2cap_server);
+	if (err) {
+		printk("L2CAP server register failed (err %d)\n", err);
+		return;
+	}
+
+	err = bt_le_adv_start(BT_LE_ADV_CONN_NAME, ad, ARRAY_SIZE(ad),
+			      NULL, 0);
+	if (err) {
+		printk("Advertising failed to start (err %d)\n", err);
+		return;
+	}
+
+	while (1) {
+		uint32_t payload;
+		uint32_t bytes = 0U;
+		int64_t start;
+		int64_t end;
+
+		k_sem_take(&conn_sem, K_FOREVER);
+
+		while (!notify_enabled) {
+			k_sleep(K_MSEC(10));
+		}
+
+		payload = MIN(bt_gatt_get_mtu(default_conn) - 3U,
+			      sizeof(tx_data));
+
+		start = k_uptime_get();
+		end = start + BENCH_DURATION_MS;
+		while (k_uptime_get() < end && default_conn) {
+			err = bt_gatt_notify(default_conn, &bench_svc.attrs[1],
+					     tx_data, payload);
+			if (err == -ENOMEM || err == -EAGAIN) {
+				k_sleep(K_MSEC(1));
+				continue;
+			} else if (err) {
+				break;
+			}
+
+			bytes += payload;
+		}
+
+		report("gatt_notify_tx", payload, bytes,
+		       k_uptime_get() - start);
+
+		/* The central drives the L2CAP phase and disconnects
+		 * when it is done; l2cap_disconnected() reports the
+		 * receive side.
+		 */
+		k_sem_take(&disconn_sem, K_FOREVER);
+		report_conn_metrics();
+		printk("fin\n");
+	}
+}
+
+#else /* central */
+
+static volatile bool subscribed;
+static uint32_t notify_rx_bytes;
+static uint32_t notify_rx_len;
+static int64_t notify_rx_start;
+static int64_t notify_rx_last;
+
+static struct bt_gatt_discover_params discover_params;
+static struct bt_gatt_subscribe_params subscribe_params;
+static struct bt_uuid_128 discover_uuid;
+static struct bt_uuid_16 ccc_uuid;
+
+static void start_scan(void);
+
+static uint8_t notify_func(struct bt_conn *conn,
+			   struct bt_gatt_subscribe_params *params,
+			   const void *data, uint16_t length)
+{
+	if (!data) {
+		params->value_handle = 0U;
+		return BT_GATT_ITER_STOP;
+	}
+
+	if (notify_rx_bytes == 0U) {
+		notify_rx_start = k_uptime_get();
+	}
+
+	notify_rx_bytes += length;
+	notify_rx_len = length;
+	notify_rx_last = k_uptime_get();
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+static uint8_t discover_func(struct bt_conn *conn,
+			     const struct bt_gatt_attr *attr,
+			     struct bt_gatt_discover_params *params)
+{
+	int err;
+
+	if (!attr) {
+		printk("Discover complete\n");
+		(void)memset(params, 0, sizeof(*params));
+		return BT_GATT_ITER_STOP;
+	}
+
+	if (!bt_uuid_cmp(discover_params.uuid, &bench_svc_uuid.uuid)) {
+		memcpy(&discover_uuid, &bench_chr_uuid, sizeof(discover_uuid));
+		discover_params.uuid = &discover_uuid.uuid;
+		discover_params.start_handle = attr->handle + 1;
+		discover_params.type = BT_GATT_DISCOVER_CHARACTERISTIC;
+
+		err = bt_gatt_discover(conn, &discover_params);
+		if (err) {
+			printk("Discover failed (err %d)\n", err);
+		}
+	} else if (!bt_uuid_cmp(discover_params.uuid,
+				&bench_chr_uuid.uuid)) {
+		memcpy(&ccc_uuid, BT_UUID_GATT_CCC, sizeof(ccc_uuid));
+		discover_params.uuid = &ccc_uuid.uuid;
+		discover_params.start_handle = attr->handle + 2;
+		discover_params.type = BT_GATT_DISCOVER_DESCRIPTOR;
+		subscribe_params.value_handle = bt_gatt_attr_value_handle(attr);
+
+		err = bt_gatt_discover(conn, &discover_params);
+		if (err) {
+			printk("Discover failed (err %d)\n", err);
+		}
+	} else {
+		subscribe_params.notify = notify_func;
+		subscribe_params.value = BT_GATT_CCC_NOTIFY;
+		subscribe_params.ccc_handle = attr->handle;
+
+		err = bt_gatt_subscribe(conn, &subscribe_params);
+		if (err && err != -EALREADY) {
+			printk("Subscribe failed (err %d)\n", err);
+		} else {
+			subscribed = true;
+		}
+
+		return BT_GATT_ITER_STOP;
+	}
+
+	return BT_GATT_ITER_STOP;
+}
+
+static bool eir_found(struct bt_data *data, void *user_data)
+{
+	bt_addr_le_t *addr = user_data;
+	int err;
+
+	if (data->type != BT_DATA_UUID128_ALL ||
+	    data->data_len != 16U ||
+	    memcmp(data->data, bench_svc_uuid.val, 16U) != 0) {
+		return true;
+	}
+
+	err = bt_le_scan_stop();
+	if (err) {
+		printk("Stop LE scan failed (err %d)\n", err);
+		return true;
+	}
+
+	err = bt_conn_le_create(addr, BT_CONN_LE_CREATE_CONN,
+				BT_LE_CONN_PARAM_DEFAULT, &default_conn);
+	if (err) {
+		printk("Create conn failed (err %d)\n", err);
+		start_scan();
+	}
+
+	return false;
+}
+
+static void device_found(const bt_addr_le_t *addr, int8_t rssi, uint8_t type,
+			 struct net_buf_simple *ad)
+{
+	if (type == BT_GAP_ADV_TYPE_ADV_IND ||
+	    type == BT_GAP_ADV_TYPE_ADV_DIRECT_IND) {
+		bt_data_parse(ad, eir_found, (void *)addr);
+	}
+}
+
+static void start_scan(void)
+{
+	int err;
+
+	err = bt_le_scan_start(BT_LE_SCAN_ACTIVE, device_found);
+	if (err) {
+		printk("Scanning failed to start (err %d)\n", err);
+		return;
+	}
+
+	printk("Scanning started\n");
+}
+
+/* L2CAP transmit side */
+
+#define L2CAP_TX_MTU CONFIG_BT_L2CAP_TX_MTU
+
+NET_BUF_POOL_FIXED_DEFINE(l2cap_tx_pool, 2,
+			  L2CAP_TX_MTU + BT_L2CAP_CHAN_SEND_RESERVE, NULL);
+
+static K_SEM_DEFINE(l2cap_sem, 0, 1);
+
+static void l2cap_connected(struct bt_l2cap_chan *chan)
+{
+	k_sem_give(&l2cap_sem);
+}
+
+static void l2cap_disconnected(struct bt_l2cap_chan *chan)
+{
+}
+
+static int l2cap_recv(struct bt_l2cap_chan *chan, struct net_buf *buf)
+{
+	return 0;
+}
+
+static const struct bt_l2cap_chan_ops l2cap_ops = {
+	.connected = l2cap_connected,
+	.disconnected = l2cap_disconnected,
+	.recv = l2cap_recv,
+};
+
+static struct bt_l2cap_le_chan le_chan;
+
+static void bench_l2cap_tx(void)
+{
+	uint32_t payload;
+	uint32_t bytes = 0U;
+	int64_t start;
+	int64_t end;
+	int err;
+
+	le_chan.chan.ops = &l2cap_ops;
+
+	err = bt_l2cap_chan_connect(default_conn, &le_chan.chan,
+				    BENCH_L2CAP_PSM);
+	if (err) {
+		printk("L2CAP connect failed (err %d)\n", err);
+		return;
+	}
+
+	if (k_sem_take(&l2cap_sem, K_SECONDS(10)) != 0) {
+		printk("L2CAP channel setup timeout\n");
+		return;
+	}
+
+	payload = MIN(le_chan.tx.mtu, L2CAP_TX_MTU);
+
+	start = k_uptime_get();
+	end = start + BENCH_DURATION_MS;
+	while (k_uptime_get() < end) {
+		struct net_buf *buf;
+
+		buf = net_buf_alloc(&l2cap_tx_pool, K_MSEC(100));
+		if (!buf) {
+			continue;
+		}
+
+		net_buf_reserve(buf, BT_L2CAP_CHAN_SEND_RESERVE);
+		net_buf_add(buf, payload);
+
+		err = bt_l2cap_chan_send(&le_chan.chan, buf);
+		if (err < 0) {
+			net_buf_unref(buf);
+			if (err == -EAGAIN || err == -ENOBUFS) {
+				k_sleep(K_MSEC(1));
+				continue;
+			}
+			printk("L2CAP send failed (err %d)\n", err);
+			break;
+		}
+
+		bytes += payload;
+	}
+
+	report("l2cap_tx", payload, bytes, k_uptime_get() - start);
+
+	bt_l2cap_chan_disconnect(&le_chan.chan);
+}
+
+static void run_role(void)
+{
+	int err;
+
+	start_scan();
+
+	k_sem_take(&conn_sem, K_FOREVER);
+
+	/* Subscribing triggers the peripheral's notification phase. */
+	memcpy(&discover_uuid, &bench_svc_uuid, sizeof(discover_uuid));
+	discover_params.uuid = &discover_uuid.uuid;
+	discover_params.func = discover_func;
+	discover_params.start_handle = 0x0001;
+	discover_params.end_handle = 0xffff;
+	discover_params.type = BT_GATT_DISCOVER_PRIMARY;
+
+	err = bt_gatt_discover(default_conn, &discover_params);
+	if (err) {
+		printk("Discover failed (err %d)\n", err);
+		return;
+	}
+
+	while (!subscribed) {
+		k_sleep(K_MSEC(10));
+	}
+
+	/* Let the peripheral's notification phase run to completion,
+	 * then report what was received.
+	 */
+	k_sleep(K_MSEC(BENCH_DURATION_MS + 1000));
+	report("gatt_notify_rx", notify_rx_len, notify_rx_bytes,
+	       notify_rx_last - notify_rx_start);
+
+	bench_l2cap_tx();
+
+	report_conn_metrics();
+
+	bt_conn_disconnect(default_conn, BT_HCI_ERR_REMOTE_USER_TERM_CONN);
+	k_sem_take(&disconn_sem, K_FOREVER);
+	printk("fin\n");
+}
+
+#endif /* CONFIG_BT_PERIPHERAL */
+
+static void connected(struct bt_conn *conn, uint8_t err)
+{
+	if (err) {
+		printk("Connection failed (err 0x%02x)\n", err);
+		return;
+	}
+
+	printk("Connected\n");
+
+	default_conn = bt_conn_ref(conn);
+	k_sem_give(&conn_sem);
+}
+
+static void disconnected(struct bt_conn *conn, uint8_t reason)
+{
+	printk("Disconnected (reason 0x%02x)\n", reason);
+
+	if (default_conn) {
+		bt_conn_unref(default_conn);
+		default_conn = NULL;
+	}
+
+	k_sem_give(&disconn_sem);
+}
+
+static struct bt_conn_cb conn_callbacks = {
+	.connected = connected,
+	.disconnected = disconnected,
+};
+
+void main(void)
+{
+	int err;
+
+	err = bt_enable(NULL);
+	if (err) {
+		printk("Bluetooth init failed (err %d)\n", err);
+		return;
+	}
+
+	bt_conn_cb_register(&conn_callbacks);
+
+	run_role();
+}
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Interrupt latency conformance harness.
+ *
+ * tests/benchmarks/latency_measure reports a single-shot average; this
+ * harness collects full latency distributions so a hard worst-case
+ * bound can be demonstrated. Two edges are measured with the timing
+ * API around an offloaded interrupt:
+ *
+ * - irq_to_isr: from triggering the interrupt to the first instruction
+ *   of the ISR.
+ * - isr_to_thread: from the ISR timestamp back to the interrupted
+ *   thread.
+ *
+ * Each phase reports min/avg/p99/max and a 1 us histogram, first on an
+ * idle system and then while background load runs: scheduler churn
+ * threads, timer churn, logging bursts and, where the board has a
+ * storage partition, flash erase/write cycles. Records::
+ *
+ *    bench,<name>,<p99_ns>,<count>,<avg_ns>,<min_ns>,<max_ns>
+ *    hist,<name>,<bucket_us>,<count>
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <timing/timing.h>
+#include <irq_offload.h>
+
+#if defined(CONFIG_LOG)
+#include <logging/log.h>
+LOG_MODULE_REGISTER(irq_latency, LOG_LEVEL_INF);
+#endif
+
+#if defined(CONFIG_FLASH_MAP)
+#include <storage/flash_map.h>
+#endif
+
+#define N_SAMPLES      10000
+#define HIST_BUCKET_NS 1000
+#define HIST_BUCKETS   128
+
+#define LOAD_STACK_SIZE 1024
+#define LOAD_PRIO       K_PRIO_PREEMPT(10)
+
+struct dist {
+	uint64_t total;
+	uint32_t min;
+	uint32_t max;
+	uint32_t count;
+	uint32_t hist[HIST_BUCKETS];
+};
+
+static void dist_add(struct dist *d, uint64_t ns)
+{
+	uint32_t bucket = MIN(ns / HIST_BUCKET_NS, HIST_BUCKETS - 1);
+
+	d->total += ns;
+	d->min = MIN(d->min, (uint32_t)ns);
+	d->max = MAX(d->max, (uint32_t)ns);
+	d->count++;
+	d->hist[bucket]++;
+}
+
+static uint32_t dist_p99(const struct dist *d)
+{
+	uint32_t below = 0;
+	int i;
+
+	for (i = 0; i < HIST_BUCKETS; i++) {
+		below += d->hist[i];
+		if ((uint64_t)below * 100U >= (uint64_t)d->count * 99U) {
+			/* Upper bound of the bucket */
+			return (i + 1) * HIST_BUCKET_NS;
+		}
+	}
+
+	return HIST_BUCKETS * HIST_BUCKET_NS;
+}
+
+static void dist_report(const char *name, const struct dist *d)
+{
+	int i;
+
+	printk("bench,%s,%u,%u,%u,%u,%u\n", name, dist_p99(d), d->count,
+	       (uint32_t)(d->total / d->count), d->min, d->max);
+
+	for (i = 0; i < HIST_BUCKETS; i++) {
+		if (d->hist[i] != 0U) {
+			printk("hist,%s,%d,%u\n", name, i, d->hist[i]);
+		}
+	}
+}
+
+/* Measured interrupt */
+
+static timing_t isr_stamp;
+static volatile int isr_ran;
+
+static void latency_isr(const void *unused)
+{
+	ARG_UNUSED(unused);
+
+	isr_stamp = timing_counter_get();
+	isr_ran = 1;
+}
+
+static void run_phase(const char *suffix)
+{
+	struct dist irq_to_isr = { .min = UINT32_MAX };
+	struct dist isr_to_thread = { .min = UINT32_MAX };
+	char name[32];
+	int i;
+
+	for (i = 0; i < N_SAMPLES; i++) {
+		timing_t start;
+		timing_t end;
+
+		isr_ran = 0;
+		start = timing_counter_get();
+		irq_offload(latency_isr, NULL);
+		end = timing_counter_get();
+
+		if (isr_ran != 1) {
+			printk("ISR did not run\n");
+			continue;
+		}
+
+		dist_add(&irq_to_isr, timing_cycles_to_ns(
+				 timing_cycles_get(&start, &isr_stamp)));
+		dist_add(&isr_to_thread, timing_cycles_to_ns(
+				 timing_cycles_get(&isr_stamp, &end)));
+
+		/* Leave gaps so background load makes progress and the
+		 * samples land in varying subsystem states.
+		 */
+		if ((i % 16) == 0) {
+			k_sleep(K_MSEC(1));
+		}
+	}
+
+	snprintk(name, sizeof(name), "irq_to_isr_%s", suffix);
+	dist_report(name, &irq_to_isr);
+	snprintk(name, sizeof(name), "isr_to_thread_%s", suffix);
+	dist_report(name, &isr_to_thread);
+}
+
+/* Background load */
+
+static atomic_t load_stop;
+
+static K_THREAD_STACK_ARRAY_DEFINE(churn_stacks, 2, LOAD_STACK_SIZE);
+static struct k_thread churn_threads[2];
+
+static void churn_thread(void *p1, void *p2, void *p3)
+{
+	while (!atomic_get(&load_stop)) {
+		k_busy_wait(100);
+		k_yield();
+	}
+}
+
+static K_THREAD_STACK_DEFINE(timer_stack, LOAD_STACK_SIZE);
+static struct k_thread timer_thread_data;
+static struct k_timer churn_timers[8];
+
+static void timer_thread(void *p1, void *p2, void *p3)
+{
+	int i;
+
+	while (!atomic_get(&load_stop)) {
+		for (i = 0; i < ARRAY_SIZE(churn_timers); i++) {
+			k_timer_start(&churn_timers[i], K_MSEC(2 + i), K_NO_WAIT);
+		}
+		k_sleep(K_MSEC(1));
+		for (i = 0; i < ARRAY_SIZE(churn_timers); i++) {
+			k_timer_stop(&churn_timers[i]);
+		}
+	}
+}
+
+#if defined(CONFIG_LOG)
+static K_THREAD_STACK_DEFINE(log_stack, LOAD_STACK_SIZE);
+static struct k_thread log_thread_data;
+
+static void log_thread(void *p1, void *p2, void *p3)
+{
+	int i;
+
+	while (!atomic_get(&load_stop)) {
+		for (i = 0; i < 32; i++) {
+			LOG_INF("burst %d", i);
+		}
+		k_sleep(K_MSEC(5));
+	}
+}
+#endif
+
+#if defined(CONFIG_FLASH_MAP) && FLASH_AREA_LABEL_EXISTS(storage)
+static K_THREAD_STACK_DEFINE(flash_stack, LOAD_STACK_SIZE);
+static struct k_thread flash_thread_data;
+
+static void flash_thread(void *p1, void *p2, void *p3)
+{
+	const struct flash_area *fa;
+	uint8_t buf[64];
+	off_t off = 0;
+
+	if (flash_area_open(FLASH_AREA_ID(storage), &fa) != 0) {
+		return;
+	}
+
+	(void)memset(buf, 0x5a, sizeof(buf));
+
+	while (!atomic_get(&load_stop)) {
+		if (off == 0) {
+			(void)flash_area_erase(fa, 0, fa->fa_size);
+		}
+		(void)flash_area_write(fa, off, buf, sizeof(buf));
+		off = (off + sizeof(buf)) % fa->fa_size;
+		k_sleep(K_MSEC(1));
+	}
+
+	flash_area_close(fa);
+}
+#endif
+
+static void load_start(void)
+{
+	int i;
+
+	atomic_set(&load_stop, 0);
+
+	for (i = 0; i < ARRAY_SIZE(churn_threads); i++) {
+		k_thread_create(&churn_threads[i], churn_stacks[i],
+				LOAD_STACK_SIZE, churn_thread,
+				NULL, NULL, NULL, LOAD_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(churn_timers); i++) {
+		k_timer_init(&churn_timers[i], NULL, NULL);
+	}
+	k_thread_create(&timer_thread_data, timer_stack, LOAD_STACK_SIZE,
+			timer_thread, NULL, NULL, NULL, LOAD_PRIO, 0,
+			K_NO_WAIT);
+
+#if defined(CONFIG_LOG)
+	k_thread_create(&log_thread_data, log_stack, LOAD_STACK_SIZE,
+			log_thread, NULL, NULL, NULL, LOAD_PRIO, 0,
+			K_NO_WAIT);
+#endif
+#if defined(CONFIG_FLASH_MAP) && FLASH_AREA_LABEL_EXISTS(storage)
+	k_thread_create(&flash_thread_data, flash_stack, LOAD_STACK_SIZE,
+			flash_thread, NULL, NULL, NULL, LOAD_PRIO, 0,
+			K_NO_WAIT);
+#endif
+}
+
+static void load_stop_all(void)
+{
+	int i;
+
+	atomic_set(&load_stop, 1);
+
+	for (i = 0; i < ARRAY_SIZE(churn_threads); i++) {
+		(void)k_thread_join(&churn_threads[i], K_FOREVER);
+	}
+	(void)k_thread_join(&timer_thread_data, K_FOREVER);
+#if defined(CONFIG_LOG)
+	(void)k_thread_join(&log_thread_data, K_FOREVER);
+#endif
+#if defined(CONFIG_FLASH_MAP) && FLASH_AREA_LABEL_EXISTS(storage)
+	(void)k_thread_join(&flash_thread_data, K_FOREVER);
+#endif
+}
+
+void main(void)
+{
+	printk("IRQ latency conformance harness\n");
+
+	timing_init();
+	timing_start();
+
+	run_phase("idle");
+
+	load_start();
+	run_phase("stress");
+	load_stop_all();
+
+	timing_stop();
+
+	printk("fin\n");
+}
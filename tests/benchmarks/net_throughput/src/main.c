@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(net_bench, LOG_LEVEL_ERR);
+
+#include <zephyr.h>
+#include <sys/printk.h>
+
+#include <net/socket.h>
+#include <net/net_if.h>
+#include <net/net_mgmt.h>
+#include <net/net_stats.h>
+#include <net/net_pkt.h>
+
+/* IP stack throughput/latency microbenchmark.  UDP packets are sent
+ * from one socket to another over the loopback interface (dummy L2),
+ * so the whole native stack - socket API, net_context, UDP, IPv4,
+ * the loopback driver and the RX queue - is exercised without any
+ * hardware in the way:
+ *
+ * - udp_rtt: cycles for one sendto() plus the blocking recvfrom() of
+ *   the looped back packet, per payload size.
+ *
+ * - udp_pps / udp_burst_pps: packets per second derived from the
+ *   round trip cost, and from bursts that keep several packets in
+ *   flight inside the stack at once.
+ *
+ * - pkt_slab_*_peak: how many net_pkt slab entries were in flight at
+ *   the peak of the bursts, from net_pkt_get_info().
+ *
+ * - tx_time_us/rx_time_us (+ *_detail records): the per-layer packet
+ *   traversal times collected by CONFIG_NET_PKT_TXTIME_STATS and
+ *   CONFIG_NET_PKT_RXTIME_STATS, in microseconds.
+ *
+ * Results are printed as one CSV record per measurement:
+ *
+ *   bench,<name>,<param>,<count>,<avg>,<min>,<max>
+ *
+ * so that before/after numbers for stack changes can be diffed
+ * mechanically.
+ */
+
+#define N_RUNS 1000
+#define N_SETTLE 10
+
+#define N_BURSTS 200
+#define BURST 8
+
+#define BENCH_PORT 4242
+
+/* The largest payload still fits the loopback interface MTU (536)
+ * together with the IPv4 and UDP headers.
+ */
+static const int payload_sizes[] = { 32, 256, 508 };
+
+static uint8_t tx_data[1024];
+static uint8_t rx_data[1024];
+
+static void report(const char *name, int param, uint32_t count,
+		   uint64_t total, uint32_t min, uint32_t max)
+{
+	printk("bench,%s,%d,%u,%u,%u,%u\n", name, param, count,
+	       count > 0 ? (uint32_t)(total / count) : 0, min, max);
+}
+
+static int open_and_bind(uint16_t port)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(port),
+	};
+	int sock;
+
+	sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (sock < 0) {
+		printk("Cannot create socket (%d)\n", errno);
+		return -1;
+	}
+
+	zsock_inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr);
+
+	if (zsock_bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		printk("Cannot bind socket (%d)\n", errno);
+		zsock_close(sock);
+		return -1;
+	}
+
+	return sock;
+}
+
+static uint32_t cycles_to_pps(uint32_t cycles_per_pkt)
+{
+	if (cycles_per_pkt == 0U) {
+		return 0U;
+	}
+
+	return sys_clock_hw_cycles_per_sec() / cycles_per_pkt;
+}
+
+static void bench_udp(int size)
+{
+	struct sockaddr_in dst = {
+		.sin_family = AF_INET,
+		.sin_port = htons(BENCH_PORT),
+	};
+	struct k_mem_slab *rx_slab, *tx_slab;
+	struct net_buf_pool *rx_pool, *tx_pool;
+	uint32_t min_free_rx = UINT32_MAX, min_free_tx = UINT32_MAX;
+	uint64_t total = 0U, burst_total = 0U;
+	uint32_t min = UINT32_MAX, max = 0U;
+	uint32_t t0, t1, delta;
+	int rx_sock, tx_sock;
+	int i, b;
+
+	zsock_inet_pton(AF_INET, "127.0.0.1", &dst.sin_addr);
+
+	rx_sock = open_and_bind(BENCH_PORT);
+	tx_sock = open_and_bind(BENCH_PORT + 1);
+	if (rx_sock < 0 || tx_sock < 0) {
+		return;
+	}
+
+	net_pkt_get_info(&rx_slab, &tx_slab, &rx_pool, &tx_pool);
+
+	/* Round trip latency, one packet in flight at a time */
+	for (i = 0; i < N_SETTLE + N_RUNS; i++) {
+		t0 = k_cycle_get_32();
+
+		if (zsock_sendto(tx_sock, tx_data, size, 0,
+				 (struct sockaddr *)&dst, sizeof(dst)) != size) {
+			printk("sendto failed (%d)\n", errno);
+			goto out;
+		}
+
+		if (zsock_recv(rx_sock, rx_data, sizeof(rx_data), 0) != size) {
+			printk("recv failed (%d)\n", errno);
+			goto out;
+		}
+
+		t1 = k_cycle_get_32();
+
+		if (i < N_SETTLE) {
+			continue;
+		}
+
+		delta = t1 - t0;
+		total += delta;
+		min = MIN(min, delta);
+		max = MAX(max, delta);
+	}
+
+	report("udp_rtt", size, N_RUNS, total, min, max);
+	report("udp_pps", size, N_RUNS,
+	       (uint64_t)cycles_to_pps(total / N_RUNS) * N_RUNS, 0, 0);
+
+	/* Burst throughput, BURST packets in flight inside the stack */
+	for (i = 0; i < N_BURSTS; i++) {
+		t0 = k_cycle_get_32();
+
+		for (b = 0; b < BURST; b++) {
+			if (zsock_sendto(tx_sock, tx_data, size, 0,
+					 (struct sockaddr *)&dst,
+					 sizeof(dst)) != size) {
+				printk("burst sendto failed (%d)\n", errno);
+				goto out;
+			}
+		}
+
+		min_free_rx = MIN(min_free_rx,
+				  k_mem_slab_num_free_get(rx_slab));
+		min_free_tx = MIN(min_free_tx,
+				  k_mem_slab_num_free_get(tx_slab));
+
+		for (b = 0; b < BURST; b++) {
+			if (zsock_recv(rx_sock, rx_data,
+				       sizeof(rx_data), 0) != size) {
+				printk("burst recv failed (%d)\n", errno);
+				goto out;
+			}
+		}
+
+		t1 = k_cycle_get_32();
+		burst_total += t1 - t0;
+	}
+
+	report("udp_burst_pps", size, N_BURSTS * BURST,
+	       (uint64_t)cycles_to_pps(burst_total / (N_BURSTS * BURST)) *
+	       N_BURSTS * BURST, 0, 0);
+	report("pkt_slab_rx_peak", size, 1,
+	       rx_slab->num_blocks - min_free_rx, 0, 0);
+	report("pkt_slab_tx_peak", size, 1,
+	       tx_slab->num_blocks - min_free_tx, 0, 0);
+
+out:
+	zsock_close(rx_sock);
+	zsock_close(tx_sock);
+}
+
+static void report_time_stats(void)
+{
+#if defined(CONFIG_NET_STATISTICS_USER_API)
+	static struct net_stats data;
+	int j;
+
+	if (net_mgmt(NET_REQUEST_STATS_GET_ALL, NULL, &data,
+		     sizeof(data)) != 0) {
+		printk("Cannot read network statistics\n");
+		return;
+	}
+
+	ARG_UNUSED(j);
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS)
+	if (data.tx_time.count > 0) {
+		report("tx_time_us", 0, data.tx_time.count,
+		       data.tx_time.sum, 0, 0);
+	}
+#endif
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+	for (j = 0; j < NET_PKT_DETAIL_STATS_COUNT; j++) {
+		if (data.tx_time_detail[j].count > 0) {
+			report("tx_time_detail_us", j,
+			       data.tx_time_detail[j].count,
+			       data.tx_time_detail[j].sum, 0, 0);
+		}
+	}
+#endif
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS)
+	if (data.rx_time.count > 0) {
+		report("rx_time_us", 0, data.rx_time.count,
+		       data.rx_time.sum, 0, 0);
+	}
+#endif
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+	for (j = 0; j < NET_PKT_DETAIL_STATS_COUNT; j++) {
+		if (data.rx_time_detail[j].count > 0) {
+			report("rx_time_detail_us", j,
+			       data.rx_time_detail[j].count,
+			       data.rx_time_detail[j].sum, 0, 0);
+		}
+	}
+#endif
+#endif /* CONFIG_NET_STATISTICS_USER_API */
+}
+
+void main(void)
+{
+	int i;
+
+	printk("IP stack throughput benchmark\n");
+
+	for (i = 0; i < (int)ARRAY_SIZE(payload_sizes); i++) {
+		bench_udp(payload_sizes[i]);
+	}
+
+	report_time_stats();
+
+	printk("fin\n");
+}
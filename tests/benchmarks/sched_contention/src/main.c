@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+
+/* Scheduler contention microbenchmark.  Where tests/benchmarks/sched
+ * measures the latency of individual low level scheduling primitives
+ * on an otherwise idle scheduler, this suite measures how the
+ * scheduler behaves under load:
+ *
+ * - wakeup_send/wakeup_latency: cost of waking a pending thread from
+ *   another thread, split into the time spent in the waker (on SMP
+ *   this includes sending the IPI) and the time until the wakee
+ *   actually runs (on SMP typically on another CPU).
+ *
+ * - ready_queue_yield: cost of one k_yield() while N other threads at
+ *   the same priority are runnable, i.e. a remove plus insert on a
+ *   ready queue holding N threads.  Run at several thread counts to
+ *   expose the scaling behavior of the selected SCHED_* backend.
+ *
+ * - timeout_churn: cost of adding and removing one timeout while N
+ *   other timeouts are active in kernel/timeout.c.
+ *
+ * Results are printed as one CSV record per measurement:
+ *
+ *   bench,<name>,<param>,<iterations>,<avg>,<min>,<max>
+ *
+ * with all values in hardware cycles, so that successive runs can be
+ * diffed mechanically.
+ */
+
+#define N_RUNS 1000
+#define N_SETTLE 10
+
+#define MAX_THREADS 200
+
+#define BENCH_PRIO K_PRIO_PREEMPT(5)
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, MAX_THREADS, 1024);
+static struct k_thread worker_threads[MAX_THREADS];
+
+static struct k_timer churn_timers[MAX_THREADS];
+static struct k_timer probe_timer;
+
+static K_SEM_DEFINE(wake_sem, 0, 1);
+static K_SEM_DEFINE(ack_sem, 0, 1);
+
+static K_THREAD_STACK_DEFINE(waiter_stack, 1024);
+static struct k_thread waiter_thread;
+
+static volatile uint32_t wake_stamp;
+static volatile bool workers_done;
+
+static const int thread_counts[] = { 10, 50, MAX_THREADS };
+
+static void report(const char *name, int param, uint32_t iterations,
+		   uint64_t total, uint32_t min, uint32_t max)
+{
+	printk("bench,%s,%d,%u,%u,%u,%u\n", name, param, iterations,
+	       (uint32_t)(total / iterations), min, max);
+}
+
+static void waiter_fn(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+		k_sem_take(&wake_sem, K_FOREVER);
+
+		if (workers_done) {
+			break;
+		}
+
+		wake_stamp = k_cycle_get_32();
+		k_sem_give(&ack_sem);
+	}
+}
+
+static void bench_wakeup(void)
+{
+	uint64_t total_send = 0U, total_wake = 0U;
+	uint32_t min_send = UINT32_MAX, max_send = 0U;
+	uint32_t min_wake = UINT32_MAX, max_wake = 0U;
+	uint32_t t0, t1, send, wake;
+	int i;
+
+	workers_done = false;
+
+	/* The waiter runs at cooperative priority so that it is
+	 * scheduled as soon as possible after the give; on SMP it
+	 * typically runs in parallel on another CPU woken by an IPI.
+	 */
+	k_thread_create(&waiter_thread, waiter_stack,
+			K_THREAD_STACK_SIZEOF(waiter_stack),
+			waiter_fn, NULL, NULL, NULL,
+			K_PRIO_COOP(1), 0, K_NO_WAIT);
+
+	for (i = 0; i < N_SETTLE + N_RUNS; i++) {
+		t0 = k_cycle_get_32();
+		k_sem_give(&wake_sem);
+		t1 = k_cycle_get_32();
+
+		k_sem_take(&ack_sem, K_FOREVER);
+
+		if (i < N_SETTLE) {
+			continue;
+		}
+
+		send = t1 - t0;
+		wake = wake_stamp - t0;
+
+		total_send += send;
+		min_send = MIN(min_send, send);
+		max_send = MAX(max_send, send);
+
+		total_wake += wake;
+		min_wake = MIN(min_wake, wake);
+		max_wake = MAX(max_wake, wake);
+	}
+
+	workers_done = true;
+	k_sem_give(&wake_sem);
+	k_thread_join(&waiter_thread, K_FOREVER);
+
+	report("wakeup_send", CONFIG_MP_NUM_CPUS, N_RUNS, total_send,
+	       min_send, max_send);
+	report("wakeup_latency", CONFIG_MP_NUM_CPUS, N_RUNS, total_wake,
+	       min_wake, max_wake);
+}
+
+static void yielder_fn(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (!workers_done) {
+		k_yield();
+	}
+}
+
+static void bench_ready_queue(int num_threads)
+{
+	uint64_t total = 0U;
+	uint32_t min = UINT32_MAX, max = 0U;
+	uint32_t t0, t1, delta;
+	int i;
+
+	workers_done = false;
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]),
+				yielder_fn, NULL, NULL, NULL,
+				BENCH_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (i = 0; i < N_SETTLE; i++) {
+		k_yield();
+	}
+
+	for (i = 0; i < N_RUNS; i++) {
+		t0 = k_cycle_get_32();
+		k_yield();
+		t1 = k_cycle_get_32();
+
+		delta = t1 - t0;
+		total += delta;
+		min = MIN(min, delta);
+		max = MAX(max, delta);
+	}
+
+	workers_done = true;
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_join(&worker_threads[i], K_FOREVER);
+	}
+
+	report("ready_queue_yield", num_threads, N_RUNS, total, min, max);
+}
+
+static void bench_timeout_churn(int num_timeouts)
+{
+	uint64_t total = 0U;
+	uint32_t min = UINT32_MAX, max = 0U;
+	uint32_t t0, t1, delta;
+	int i;
+
+	/* Stagger the expiries so that the probe timeout below lands
+	 * somewhere in the middle of the timeout list instead of
+	 * always at one end.
+	 */
+	for (i = 0; i < num_timeouts; i++) {
+		k_timer_start(&churn_timers[i], K_MSEC(5000 + i), K_NO_WAIT);
+	}
+
+	for (i = 0; i < N_SETTLE + N_RUNS; i++) {
+		t0 = k_cycle_get_32();
+		k_timer_start(&probe_timer, K_MSEC(5000 + num_timeouts / 2),
+			      K_NO_WAIT);
+		k_timer_stop(&probe_timer);
+		t1 = k_cycle_get_32();
+
+		if (i < N_SETTLE) {
+			continue;
+		}
+
+		delta = t1 - t0;
+		total += delta;
+		min = MIN(min, delta);
+		max = MAX(max, delta);
+	}
+
+	for (i = 0; i < num_timeouts; i++) {
+		k_timer_stop(&churn_timers[i]);
+	}
+
+	report("timeout_churn", num_timeouts, N_RUNS, total, min, max);
+}
+
+void main(void)
+{
+	int i;
+
+	printk("Scheduler contention benchmark, %d CPU(s)\n",
+	       CONFIG_MP_NUM_CPUS);
+
+	k_thread_priority_set(k_current_get(), BENCH_PRIO);
+
+	for (i = 0; i < MAX_THREADS; i++) {
+		k_timer_init(&churn_timers[i], NULL, NULL);
+	}
+	k_timer_init(&probe_timer, NULL, NULL);
+
+	bench_wakeup();
+
+	for (i = 0; i < ARRAY_SIZE(thread_counts); i++) {
+		bench_ready_queue(thread_counts[i]);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(thread_counts); i++) {
+		bench_timeout_churn(thread_counts[i]);
+	}
+
+	printk("fin\n");
+}
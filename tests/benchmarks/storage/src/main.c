@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <string.h>
+#include <device.h>
+#include <drivers/flash.h>
+#include <storage/flash_map.h>
+#include <fs/nvs.h>
+
+#if defined(CONFIG_FILE_SYSTEM_LITTLEFS)
+#include <fs/fs.h>
+#include <fs/littlefs.h>
+#endif
+
+/* Storage I/O microbenchmark.  Runs against the storage partition of
+ * the board (the flash simulator on qemu/native_posix, real flash on
+ * hardware) and measures:
+ *
+ * - flash_erase/flash_write/flash_read: raw flash driver timing per
+ *   page erase and per chunk program/read through the flash map API.
+ *
+ * - nvs_init_clean/nvs_init_used/nvs_write/nvs_read: NVS latencies.
+ *   The writes rotate through a set of ids with changing payloads so
+ *   that sectors fill up and the garbage collection cost shows up in
+ *   the max column.  nvs_init_used measures mounting a well-churned
+ *   file system, which dominates boot time in settings-heavy images.
+ *
+ * - fs_seq_write/fs_seq_read/fs_rand_read/fs_rand_write: littlefs
+ *   file throughput via the fs.c API (with the littlefs overlay).
+ *
+ * Results are printed as one CSV record per measurement:
+ *
+ *   bench,<name>,<param>,<count>,<avg>,<min>,<max>
+ *
+ * with all values in hardware cycles, so that successive runs can be
+ * diffed mechanically.
+ */
+
+#define WRITE_CHUNK 256
+
+#define NVS_ID_COUNT 16
+#define NVS_VALUE_SIZE 16
+#define NVS_WRITES 500
+#define NVS_READS 500
+
+#define FS_FILE_SIZE 8192
+#define FS_CHUNK 512
+#define FS_RAND_CHUNK 64
+#define FS_RAND_OPS 100
+
+struct lat {
+	uint64_t total;
+	uint32_t min;
+	uint32_t max;
+	uint32_t count;
+};
+
+#define LAT_INIT { 0U, UINT32_MAX, 0U, 0U }
+
+static uint8_t chunk[WRITE_CHUNK];
+static uint8_t verify[WRITE_CHUNK];
+
+static void lat_add(struct lat *lat, uint32_t delta)
+{
+	lat->total += delta;
+	lat->min = MIN(lat->min, delta);
+	lat->max = MAX(lat->max, delta);
+	lat->count++;
+}
+
+static void lat_report(const char *name, int param, const struct lat *lat)
+{
+	printk("bench,%s,%d,%u,%u,%u,%u\n", name, param, lat->count,
+	       lat->count > 0 ?
+			(uint32_t)(lat->total / lat->count) : 0,
+	       lat->min, lat->max);
+}
+
+static void bench_flash(const struct flash_area *fa, uint32_t page_size)
+{
+	struct lat erase = LAT_INIT, write = LAT_INIT, read = LAT_INIT;
+	uint32_t t0, t1;
+	off_t off;
+
+	for (off = 0; off + page_size <= fa->fa_size; off += page_size) {
+		t0 = k_cycle_get_32();
+		if (flash_area_erase(fa, off, page_size) != 0) {
+			printk("flash erase failed at 0x%lx\n", (long)off);
+			return;
+		}
+		t1 = k_cycle_get_32();
+		lat_add(&erase, t1 - t0);
+	}
+
+	for (off = 0; off + WRITE_CHUNK <= fa->fa_size; off += WRITE_CHUNK) {
+		t0 = k_cycle_get_32();
+		if (flash_area_write(fa, off, chunk, WRITE_CHUNK) != 0) {
+			printk("flash write failed at 0x%lx\n", (long)off);
+			return;
+		}
+		t1 = k_cycle_get_32();
+		lat_add(&write, t1 - t0);
+	}
+
+	for (off = 0; off + WRITE_CHUNK <= fa->fa_size; off += WRITE_CHUNK) {
+		t0 = k_cycle_get_32();
+		if (flash_area_read(fa, off, verify, WRITE_CHUNK) != 0) {
+			printk("flash read failed at 0x%lx\n", (long)off);
+			return;
+		}
+		t1 = k_cycle_get_32();
+		lat_add(&read, t1 - t0);
+	}
+
+	lat_report("flash_erase", page_size, &erase);
+	lat_report("flash_write", WRITE_CHUNK, &write);
+	lat_report("flash_read", WRITE_CHUNK, &read);
+}
+
+static void bench_nvs(const struct flash_area *fa, uint32_t page_size)
+{
+	static struct nvs_fs fs;
+	static struct nvs_fs fs_used;
+	struct lat init = LAT_INIT, init_used = LAT_INIT;
+	struct lat write = LAT_INIT, read = LAT_INIT;
+	uint8_t value[NVS_VALUE_SIZE];
+	uint32_t t0, t1;
+	uint16_t id;
+	int i;
+
+	if (flash_area_erase(fa, 0, fa->fa_size) != 0) {
+		printk("cannot erase storage area for NVS\n");
+		return;
+	}
+
+	fs.offset = fa->fa_off;
+	fs.sector_size = page_size;
+	fs.sector_count = fa->fa_size / page_size;
+
+	t0 = k_cycle_get_32();
+	if (nvs_init(&fs, fa->fa_dev_name) != 0) {
+		printk("nvs_init failed\n");
+		return;
+	}
+	t1 = k_cycle_get_32();
+	lat_add(&init, t1 - t0);
+
+	for (i = 0; i < NVS_WRITES; i++) {
+		id = 1U + (i % NVS_ID_COUNT);
+
+		/* Changing payload so that NVS cannot skip the write
+		 * as a duplicate of the stored value.
+		 */
+		memset(value, i & 0xff, sizeof(value));
+
+		t0 = k_cycle_get_32();
+		if (nvs_write(&fs, id, value, sizeof(value)) < 0) {
+			printk("nvs_write failed at %d\n", i);
+			return;
+		}
+		t1 = k_cycle_get_32();
+		lat_add(&write, t1 - t0);
+	}
+
+	for (i = 0; i < NVS_READS; i++) {
+		id = 1U + (i % NVS_ID_COUNT);
+
+		t0 = k_cycle_get_32();
+		if (nvs_read(&fs, id, value, sizeof(value)) < 0) {
+			printk("nvs_read failed at %d\n", i);
+			return;
+		}
+		t1 = k_cycle_get_32();
+		lat_add(&read, t1 - t0);
+	}
+
+	/* Mount the churned file system again, this is what an NVS or
+	 * settings backed boot pays on every startup.
+	 */
+	fs_used.offset = fa->fa_off;
+	fs_used.sector_size = page_size;
+	fs_used.sector_count = fa->fa_size / page_size;
+
+	t0 = k_cycle_get_32();
+	if (nvs_init(&fs_used, fa->fa_dev_name) != 0) {
+		printk("nvs_init on used fs failed\n");
+		return;
+	}
+	t1 = k_cycle_get_32();
+	lat_add(&init_used, t1 - t0);
+
+	lat_report("nvs_init_clean", NVS_VALUE_SIZE, &init);
+	lat_report("nvs_write", NVS_VALUE_SIZE, &write);
+	lat_report("nvs_read", NVS_VALUE_SIZE, &read);
+	lat_report("nvs_init_used", NVS_VALUE_SIZE, &init_used);
+}
+
+#if defined(CONFIG_FILE_SYSTEM_LITTLEFS)
+FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(storage);
+
+static struct fs_mount_t lfs_mnt = {
+	.type = FS_LITTLEFS,
+	.fs_data = &storage,
+	.storage_dev = (void *)FLASH_AREA_ID(storage),
+	.mnt_point = "/lfs",
+};
+
+static void bench_fs(const struct flash_area *fa)
+{
+	struct lat seq_write = LAT_INIT, seq_read = LAT_INIT;
+	struct lat rand_read = LAT_INIT, rand_write = LAT_INIT;
+	struct fs_file_t file;
+	uint32_t t0, t1;
+	off_t off;
+	int i;
+
+	if (flash_area_erase(fa, 0, fa->fa_size) != 0) {
+		printk("cannot erase storage area for littlefs\n");
+		return;
+	}
+
+	if (fs_mount(&lfs_mnt) != 0) {
+		printk("littlefs mount failed\n");
+		return;
+	}
+
+	if (fs_open(&file, "/lfs/bench.dat",
+		    FS_O_CREATE | FS_O_RDWR) != 0) {
+		printk("cannot create benchmark file\n");
+		goto unmount;
+	}
+
+	for (off = 0; off < FS_FILE_SIZE; off += FS_CHUNK) {
+		t0 = k_cycle_get_32();
+		if (fs_write(&file, chunk, FS_CHUNK) != FS_CHUNK) {
+			printk("fs_write failed at 0x%lx\n", (long)off);
+			goto close;
+		}
+		t1 = k_cycle_get_32();
+		lat_add(&seq_write, t1 - t0);
+	}
+
+	fs_seek(&file, 0, FS_SEEK_SET);
+
+	for (off = 0; off < FS_FILE_SIZE; off += FS_CHUNK) {
+		t0 = k_cycle_get_32();
+		if (fs_read(&file, verify, FS_CHUNK) != FS_CHUNK) {
+			printk("fs_read failed at 0x%lx\n", (long)off);
+			goto close;
+		}
+		t1 = k_cycle_get_32();
+		lat_add(&seq_read, t1 - t0);
+	}
+
+	for (i = 0; i < FS_RAND_OPS; i++) {
+		/* Cheap deterministic scatter over the file */
+		off = (i * 929) % (FS_FILE_SIZE - FS_RAND_CHUNK);
+
+		t0 = k_cycle_get_32();
+		if (fs_seek(&file, off, FS_SEEK_SET) != 0 ||
+		    fs_read(&file, verify, FS_RAND_CHUNK) != FS_RAND_CHUNK) {
+			printk("random read failed at 0x%lx\n", (long)off);
+			goto close;
+		}
+		t1 = k_cycle_get_32();
+		lat_add(&rand_read, t1 - t0);
+	}
+
+	for (i = 0; i < FS_RAND_OPS; i++) {
+		off = (i * 1259) % (FS_FILE_SIZE - FS_RAND_CHUNK);
+
+		t0 = k_cycle_get_32();
+		if (fs_seek(&file, off, FS_SEEK_SET) != 0 ||
+		    fs_write(&file, chunk, FS_RAND_CHUNK) != FS_RAND_CHUNK) {
+			printk("random write failed at 0x%lx\n", (long)off);
+			goto close;
+		}
+		t1 = k_cycle_get_32();
+		lat_add(&rand_write, t1 - t0);
+	}
+
+	lat_report("fs_seq_write", FS_CHUNK, &seq_write);
+	lat_report("fs_seq_read", FS_CHUNK, &seq_read);
+	lat_report("fs_rand_read", FS_RAND_CHUNK, &rand_read);
+	lat_report("fs_rand_write", FS_RAND_CHUNK, &rand_write);
+
+close:
+	fs_close(&file);
+unmount:
+	fs_unmount(&lfs_mnt);
+}
+#endif /* CONFIG_FILE_SYSTEM_LITTLEFS */
+
+void main(void)
+{
+	const struct flash_area *fa;
+	struct flash_pages_info info;
+	const struct device *dev;
+	int i;
+
+	printk("Storage I/O benchmark\n");
+
+	for (i = 0; i < WRITE_CHUNK; i++) {
+		chunk[i] = i & 0xff;
+	}
+
+	if (flash_area_open(FLASH_AREA_ID(storage), &fa) != 0) {
+		printk("cannot open storage flash area\n");
+		return;
+	}
+
+	dev = device_get_binding(fa->fa_dev_name);
+	if (dev == NULL ||
+	    flash_get_page_info_by_offs(dev, fa->fa_off, &info) != 0) {
+		printk("cannot get flash page info\n");
+		return;
+	}
+
+	bench_flash(fa, info.size);
+	bench_nvs(fa, info.size);
+
+#if defined(CONFIG_FILE_SYSTEM_LITTLEFS)
+	bench_fs(fa);
+#endif
+
+	printk("fin\n");
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <drivers/kscan.h>
+#include <ztest.h>
+
+#define RING_SIZE 8
+
+KSCAN_EVENT_RING_DEFINE(ring, RING_SIZE);
+
+static void drain(void)
+{
+	struct kscan_event *events;
+	uint16_t count;
+
+	while ((count = kscan_event_ring_claim(&ring, &events)) != 0U) {
+		kscan_event_ring_release(&ring, count);
+	}
+}
+
+static void test_put_claim_release(void)
+{
+	struct kscan_event *events;
+	uint16_t count;
+
+	drain();
+
+	zassert_true(kscan_event_ring_put(&ring, 1, 2, true), NULL);
+	zassert_true(kscan_event_ring_put(&ring, 3, 4, false), NULL);
+
+	count = kscan_event_ring_claim(&ring, &events);
+	zassert_equal(count, 2, "expected both events in one batch");
+	zassert_equal(events[0].row, 1, NULL);
+	zassert_equal(events[0].column, 2, NULL);
+	zassert_true(events[0].pressed, NULL);
+	zassert_equal(events[1].row, 3, NULL);
+	zassert_equal(events[1].column, 4, NULL);
+	zassert_false(events[1].pressed, NULL);
+
+	kscan_event_ring_release(&ring, count);
+	zassert_equal(kscan_event_ring_claim(&ring, &events), 0,
+		      "ring not empty after release");
+}
+
+static void test_full_drops_event(void)
+{
+	struct kscan_event *events;
+
+	drain();
+
+	for (int i = 0; i < RING_SIZE; i++) {
+		zassert_true(kscan_event_ring_put(&ring, i, i, true), NULL);
+	}
+	zassert_false(kscan_event_ring_put(&ring, 99, 99, true),
+		      "put on full ring must fail");
+
+	/* queued events are intact */
+	uint16_t total = 0;
+	uint16_t count;
+
+	while ((count = kscan_event_ring_claim(&ring, &events)) != 0U) {
+		for (int i = 0; i < count; i++) {
+			zassert_equal(events[i].row, total + i, NULL);
+		}
+		kscan_event_ring_release(&ring, count);
+		total += count;
+	}
+	zassert_equal(total, RING_SIZE, "lost queued events");
+}
+
+static void test_wrap_around(void)
+{
+	struct kscan_event *events;
+	uint16_t count;
+	uint16_t total = 0;
+
+	drain();
+
+	/* move the indices to two slots before the end of the ring */
+	while ((ring.head & (RING_SIZE - 1U)) != (RING_SIZE - 2U)) {
+		zassert_true(kscan_event_ring_put(&ring, 0, 0, true), NULL);
+		drain();
+	}
+
+	/* queue a batch that wraps; it must come out in two claims */
+	for (int i = 0; i < 4; i++) {
+		zassert_true(kscan_event_ring_put(&ring, i, i, true), NULL);
+	}
+
+	count = kscan_event_ring_claim(&ring, &events);
+	zassert_equal(count, 2, "expected claim to stop at the wrap");
+	while (count != 0U) {
+		for (int i = 0; i < count; i++) {
+			zassert_equal(events[i].row, total + i, NULL);
+		}
+		kscan_event_ring_release(&ring, count);
+		total += count;
+		count = kscan_event_ring_claim(&ring, &events);
+	}
+	zassert_equal(total, 4, "lost events across the wrap");
+}
+
+static void test_timestamps_monotonic(void)
+{
+	struct kscan_event *events;
+
+	drain();
+
+	zassert_true(kscan_event_ring_put(&ring, 0, 0, true), NULL);
+	k_busy_wait(10);
+	zassert_true(kscan_event_ring_put(&ring, 0, 0, false), NULL);
+
+	zassert_equal(kscan_event_ring_claim(&ring, &events), 2, NULL);
+	zassert_true((int32_t)(events[1].timestamp - events[0].timestamp) > 0,
+		     "timestamps must follow queueing order");
+	kscan_event_ring_release(&ring, 2);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(kscan_event_ring,
+			 ztest_unit_test(test_put_claim_release),
+			 ztest_unit_test(test_full_drops_event),
+			 ztest_unit_test(test_wrap_around),
+			 ztest_unit_test(test_timestamps_monotonic));
+	ztest_run_test_suite(kscan_event_ring);
+}
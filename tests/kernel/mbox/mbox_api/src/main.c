@@ -28,6 +28,9 @@ extern void test_mbox_async_put_to_waiting_get(void);
 extern void test_mbox_get_waiting_put_incorrect_tid(void);
 extern void test_mbox_async_multiple_put(void);
 extern void test_mbox_multiple_waiting_get(void);
+extern void test_mbox_put_sg_buffer(void);
+extern void test_mbox_async_put_callback(void);
+extern void test_mbox_async_pool(void);
 
 /*test case main entry*/
 void test_main(void)
@@ -57,6 +60,9 @@ void test_main(void)
 			 ztest_unit_test(
 				test_mbox_get_waiting_put_incorrect_tid),
 			 ztest_1cpu_unit_test(test_mbox_async_multiple_put),
-			 ztest_1cpu_unit_test(test_mbox_multiple_waiting_get));
+			 ztest_1cpu_unit_test(test_mbox_multiple_waiting_get),
+			 ztest_1cpu_unit_test(test_mbox_put_sg_buffer),
+			 ztest_1cpu_unit_test(test_mbox_async_put_callback),
+			 ztest_1cpu_unit_test(test_mbox_async_pool));
 	ztest_run_test_suite(mbox_api);
 }
@@ -728,3 +728,139 @@ void test_mbox_multiple_waiting_get(void)
 	info_type = MULTIPLE_WAITING_GET;
 	tmbox(&mbox);
 }
+
+/**
+ *
+ * @brief Test sending a message as a list of scatter-gather regions
+ *
+ * @details
+ * - Asynchronously send a message whose data is described by several
+ *   non-contiguous regions.
+ * - Receive it into a single buffer and verify the regions were
+ *   gathered in order.
+ *
+ */
+void test_mbox_put_sg_buffer(void)
+{
+	static const char part1[] = "send/recv msg ";
+	static const char part2[] = "using scatter-";
+	static const char part3[] = "gather regions";
+	struct k_mbox_sg_region regions[3] = {
+		{ part1, sizeof(part1) - 1 },
+		{ part2, sizeof(part2) - 1 },
+		{ part3, sizeof(part3) - 1 },
+	};
+	struct k_mbox sg_mbox;
+	struct k_mbox_msg mmsg = {0};
+	char rxdata[MAIL_LEN];
+
+	k_mbox_init(&sg_mbox);
+
+	mmsg.info = PUT_GET_BUFFER;
+	mmsg.size = sizeof(part1) + sizeof(part2) + sizeof(part3) - 3;
+	mmsg.tx_sg = regions;
+	mmsg.tx_sg_count = 3;
+	mmsg.tx_target_thread = K_ANY;
+	k_mbox_async_put(&sg_mbox, &mmsg, &sync_sema);
+
+	memset(rxdata, 0, sizeof(rxdata));
+	mmsg.size = sizeof(rxdata);
+	mmsg.rx_source_thread = K_ANY;
+	zassert_true(k_mbox_get(&sg_mbox, &mmsg, rxdata, K_NO_WAIT) == 0,
+		     NULL);
+	k_sem_take(&sync_sema, K_FOREVER);
+
+	zassert_equal(mmsg.size,
+		      sizeof(part1) + sizeof(part2) + sizeof(part3) - 3,
+		      NULL);
+	zassert_true(memcmp(rxdata, "send/recv msg using scatter-gather"
+			    " regions", mmsg.size) == 0, NULL);
+}
+
+static bool async_cb_invoked;
+
+static void mbox_async_put_callback(void *user_data)
+{
+	async_cb_invoked = true;
+	k_sem_give((struct k_sem *)user_data);
+}
+
+/**
+ *
+ * @brief Test asynchronous send completion callback
+ *
+ * @details
+ * - Asynchronously send a message registering a completion callback.
+ * - Receive and dispose of the message, then verify the callback ran.
+ *
+ */
+void test_mbox_async_put_callback(void)
+{
+	struct k_mbox cb_mbox;
+	struct k_mbox_msg mmsg = {0};
+	char rxdata[MAIL_LEN];
+
+	k_mbox_init(&cb_mbox);
+	async_cb_invoked = false;
+
+	/**TESTPOINT: mbox async put with completion callback*/
+	mmsg.info = ASYNC_PUT_GET_BUFFER;
+	mmsg.size = sizeof(data[ASYNC_PUT_GET_BUFFER]);
+	mmsg.tx_data = data[ASYNC_PUT_GET_BUFFER];
+	mmsg.tx_target_thread = K_ANY;
+	k_mbox_async_put_cb(&cb_mbox, &mmsg, mbox_async_put_callback,
+			    &sync_sema);
+
+	mmsg.size = sizeof(rxdata);
+	mmsg.rx_source_thread = K_ANY;
+	zassert_true(k_mbox_get(&cb_mbox, &mmsg, rxdata, K_NO_WAIT) == 0,
+		     NULL);
+	k_sem_take(&sync_sema, K_FOREVER);
+
+	zassert_true(async_cb_invoked, NULL);
+	zassert_true(memcmp(rxdata, data[ASYNC_PUT_GET_BUFFER],
+			    mmsg.size) == 0, NULL);
+}
+
+#define PRIV_POOL_MSGS 2
+K_STACK_DEFINE(priv_async_pool, PRIV_POOL_MSGS);
+static struct k_mbox_async priv_async_msgs[PRIV_POOL_MSGS];
+
+/**
+ *
+ * @brief Test per-mailbox asynchronous message descriptor pool
+ *
+ * @details
+ * - Give a mailbox a private pool of asynchronous message descriptors.
+ * - Cycle more asynchronous sends through the mailbox than the pool
+ *   holds, verifying descriptors are returned to the private pool on
+ *   message disposal.
+ *
+ */
+void test_mbox_async_pool(void)
+{
+	struct k_mbox pool_mbox;
+	struct k_mbox_msg mmsg;
+	char rxdata[MAIL_LEN];
+	int i;
+
+	k_mbox_init(&pool_mbox);
+	/**TESTPOINT: assign private async descriptor pool*/
+	k_mbox_async_pool_init(&pool_mbox, &priv_async_pool,
+			       priv_async_msgs, PRIV_POOL_MSGS);
+
+	for (i = 0; i < 2 * PRIV_POOL_MSGS; i++) {
+		memset(&mmsg, 0, sizeof(mmsg));
+		mmsg.info = i;
+		mmsg.size = sizeof(data[PUT_GET_BUFFER]);
+		mmsg.tx_data = data[PUT_GET_BUFFER];
+		mmsg.tx_target_thread = K_ANY;
+		k_mbox_async_put(&pool_mbox, &mmsg, NULL);
+
+		mmsg.size = sizeof(rxdata);
+		mmsg.rx_source_thread = K_ANY;
+		zassert_true(k_mbox_get(&pool_mbox, &mmsg, rxdata,
+					K_NO_WAIT) == 0, NULL);
+		zassert_equal(mmsg.info, i, NULL);
+	}
+}
@@ -490,6 +490,49 @@ void test_sem_give_limit(void)
 	} while (ret_value == -EAGAIN);
 }
 
+/**
+ * @brief Test batched semaphore give
+ */
+void test_sem_give_count(void)
+{
+	int32_t ret_value;
+	uint32_t signal_count;
+
+	sys_sem_init(&simple_sem, SEM_INIT_VAL, SEM_MAX_VAL);
+
+	ret_value = sys_sem_give_count(&simple_sem, 0U);
+	zassert_true(ret_value == -EINVAL,
+		     "sys_sem_give_count accepted a count of zero");
+
+	/* uncontended gives are credited to the count in one operation */
+	ret_value = sys_sem_give_count(&simple_sem, 4U);
+	zassert_true(ret_value == 0, "sys_sem_give_count failed");
+
+	signal_count = sys_sem_count_get(&simple_sem);
+	zassert_true(signal_count == 4U,
+		     "signal count missmatch Expected 4, got %d",
+		     signal_count);
+
+	/* gives beyond the limit are discarded */
+	ret_value = sys_sem_give_count(&simple_sem, SEM_MAX_VAL);
+	zassert_true(ret_value == 0, "sys_sem_give_count failed");
+
+	signal_count = sys_sem_count_get(&simple_sem);
+	zassert_true(signal_count == SEM_MAX_VAL,
+		     "signal count missmatch Expected %d, got %d",
+		     SEM_MAX_VAL, signal_count);
+
+	/* userspace reports -EAGAIN at the limit, kernel mode discards */
+	ret_value = sys_sem_give_count(&simple_sem, 1U);
+	zassert_true(ret_value == -EAGAIN || ret_value == 0,
+		     "sys_sem_give_count failed at the limit");
+
+	signal_count = sys_sem_count_get(&simple_sem);
+	zassert_true(signal_count == SEM_MAX_VAL,
+		     "signal count missmatch Expected %d, got %d",
+		     SEM_MAX_VAL, signal_count);
+}
+
 /**
  * @brief Test multiple semaphore take and give with wait
  */
@@ -579,6 +622,7 @@ void test_main(void)
 			ztest_1cpu_user_unit_test(test_sem_take_timeout_forever),
 			ztest_1cpu_user_unit_test(test_sem_take_multiple),
 			ztest_user_unit_test(test_sem_give_limit),
+			ztest_user_unit_test(test_sem_give_count),
 			ztest_1cpu_user_unit_test(test_sem_multiple_threads_wait));
 	ztest_run_test_suite(test_sys_sem);
 #else
@@ -594,6 +638,7 @@ void test_main(void)
 			ztest_1cpu_unit_test(test_sem_take_timeout_forever),
 			ztest_1cpu_unit_test(test_sem_take_multiple),
 			ztest_unit_test(test_sem_give_limit),
+			ztest_unit_test(test_sem_give_count),
 			ztest_1cpu_unit_test(test_sem_multiple_threads_wait));
 	ztest_run_test_suite(test_sys_sem);
 #endif
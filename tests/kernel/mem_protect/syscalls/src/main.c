@@ -383,6 +383,42 @@ void test_syscall_context(void)
 	k_thread_user_mode_enter(test_syscall_context_user, NULL, NULL, NULL);
 }
 
+static struct k_sem batch_sem;
+
+/* Show that a batch executes its calls in order with per-entry return
+ * values, in a single trap from user mode
+ */
+void test_syscall_batch_user(void)
+{
+	struct k_syscall_batch_entry entries[3] = {
+		{
+			.id = K_SYSCALL_K_SEM_GIVE,
+			.args = { (uintptr_t)&batch_sem },
+		},
+		{
+			.id = K_SYSCALL_K_SEM_GIVE,
+			.args = { (uintptr_t)&batch_sem },
+		},
+		{
+			.id = K_SYSCALL_K_SEM_COUNT_GET,
+			.args = { (uintptr_t)&batch_sem },
+		},
+	};
+
+	zassert_equal(k_syscall_batch(entries, ARRAY_SIZE(entries)), 0,
+		      "batch dispatch failed");
+	zassert_equal(entries[2].ret, 2,
+		      "batched calls not executed in order (count %lu)",
+		      (unsigned long)entries[2].ret);
+}
+
+/* Supervisor mode has no privilege transition to amortize */
+void test_syscall_batch(void)
+{
+	zassert_equal(k_syscall_batch(NULL, 0), -ENOSYS,
+		      "batch accepted from supervisor mode");
+}
+
 K_MEM_POOL_DEFINE(test_pool, BUF_SIZE, BUF_SIZE, 4 * NR_THREADS, 4);
 
 void test_main(void)
@@ -390,6 +426,8 @@ void test_main(void)
 	sprintf(kernel_string, "this is a kernel string");
 	sprintf(user_string, "this is a user string");
 	k_thread_resource_pool_assign(k_current_get(), &test_pool);
+	k_sem_init(&batch_sem, 0, 2);
+	k_thread_access_grant(k_current_get(), &batch_sem);
 
 	ztest_test_suite(syscalls,
 			 ztest_unit_test(test_string_nlen),
@@ -399,7 +437,9 @@ void test_main(void)
 			 ztest_user_unit_test(test_user_string_alloc_copy),
 			 ztest_user_unit_test(test_arg64),
 			 ztest_unit_test(test_syscall_torture),
-			 ztest_unit_test(test_syscall_context)
+			 ztest_unit_test(test_syscall_context),
+			 ztest_user_unit_test(test_syscall_batch_user),
+			 ztest_unit_test(test_syscall_batch)
 			 );
 	ztest_run_test_suite(syscalls);
 }
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2016 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+static K_THREAD_STACK_DEFINE(zstack, STACK_SIZE);
+static struct k_thread zthread;
+static char __aligned(4) zbuf[MSG_SIZE * MSGQ_LEN];
+static struct k_msgq zmsgq;
+
+/**
+ * @brief Test in-place send and receive ordering
+ *
+ * @ingroup kernel_message_queue_tests
+ *
+ * @see k_msgq_reserve(), k_msgq_commit(), k_msgq_peek_claim(),
+ * k_msgq_release()
+ */
+void test_msgq_zerocopy(void)
+{
+	uint32_t expected[MSGQ_LEN] = { MSG0, MSG1 };
+	void *slot;
+
+	k_msgq_init(&zmsgq, zbuf, MSG_SIZE, MSGQ_LEN);
+
+	/* build messages in place until the queue fills up */
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_reserve(&zmsgq, &slot, K_NO_WAIT), 0,
+			      "reserve %d failed", i);
+		*(uint32_t *)slot = expected[i];
+		k_msgq_commit(&zmsgq, slot);
+	}
+	zassert_equal(k_msgq_reserve(&zmsgq, &slot, K_NO_WAIT), -ENOMSG,
+		      "reserve on full queue did not fail");
+	zassert_is_null(slot, NULL);
+
+	/* consume them in place, in FIFO order */
+	for (int i = 0; i < MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_peek_claim(&zmsgq, &slot, K_NO_WAIT), 0,
+			      "claim %d failed", i);
+		zassert_equal(*(uint32_t *)slot, expected[i],
+			      "wrong message claimed");
+		k_msgq_release(&zmsgq, slot);
+	}
+	zassert_equal(k_msgq_peek_claim(&zmsgq, &slot, K_NO_WAIT), -ENOMSG,
+		      "claim on empty queue did not fail");
+	zassert_is_null(slot, NULL);
+}
+
+static void zerocopy_get_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t rx;
+
+	/* blocks until the main thread commits a message */
+	zassert_equal(k_msgq_get(&zmsgq, &rx, K_FOREVER), 0, NULL);
+	zassert_equal(rx, MSG0, "handed-off message corrupted");
+}
+
+static void zerocopy_put_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t tx = MSG1;
+
+	zassert_equal(k_msgq_put(&zmsgq, &tx, K_NO_WAIT), 0, NULL);
+}
+
+/**
+ * @brief Test interworking of zero-copy and copying endpoints
+ *
+ * Verify a committed message is handed off to a blocked k_msgq_get()
+ * caller, and that a blocked k_msgq_peek_claim() caller is woken by
+ * an ordinary k_msgq_put().
+ *
+ * @ingroup kernel_message_queue_tests
+ */
+void test_msgq_zerocopy_interop(void)
+{
+	void *slot;
+	k_tid_t tid;
+
+	k_msgq_init(&zmsgq, zbuf, MSG_SIZE, MSGQ_LEN);
+
+	/* zero-copy producer, copying consumer */
+	tid = k_thread_create(&zthread, zstack, STACK_SIZE,
+			      zerocopy_get_entry, NULL, NULL, NULL,
+			      k_thread_priority_get(k_current_get()) - 1,
+			      0, K_NO_WAIT);
+
+	zassert_equal(k_msgq_reserve(&zmsgq, &slot, K_NO_WAIT), 0, NULL);
+	*(uint32_t *)slot = MSG0;
+	k_msgq_commit(&zmsgq, slot);
+	k_thread_join(tid, K_FOREVER);
+
+	/* direct hand-off must leave the queue empty */
+	zassert_equal(k_msgq_num_used_get(&zmsgq), 0,
+		      "handed-off message left in queue");
+
+	/* copying producer, zero-copy consumer */
+	tid = k_thread_create(&zthread, zstack, STACK_SIZE,
+			      zerocopy_put_entry, NULL, NULL, NULL,
+			      k_thread_priority_get(k_current_get()) + 1,
+			      0, K_NO_WAIT);
+
+	zassert_equal(k_msgq_peek_claim(&zmsgq, &slot, TIMEOUT), 0,
+		      "claim was not woken by put");
+	zassert_equal(*(uint32_t *)slot, MSG1, "wrong message claimed");
+	k_msgq_release(&zmsgq, slot);
+	k_thread_join(tid, K_FOREVER);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2016 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define PIPE_SIZE 16
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+static K_THREAD_STACK_DEFINE(cstack, STACK_SIZE);
+static struct k_thread cthread;
+static unsigned char __aligned(4) cbuf[PIPE_SIZE];
+static struct k_pipe cpipe;
+
+/**
+ * @brief Test in-place pipe write and read via claim/finish
+ *
+ * @ingroup kernel_pipe_tests
+ *
+ * @see k_pipe_write_claim(), k_pipe_write_finish(),
+ * k_pipe_read_claim(), k_pipe_read_finish()
+ */
+void test_pipe_claim(void)
+{
+	void *region;
+	size_t run;
+
+	k_pipe_init(&cpipe, cbuf, PIPE_SIZE);
+
+	/* an empty pipe offers its whole buffer for writing */
+	run = k_pipe_write_claim(&cpipe, &region, PIPE_SIZE * 2);
+	zassert_equal(run, PIPE_SIZE, "bad write claim size %zu", run);
+	zassert_equal_ptr(region, cbuf, "bad write claim region");
+
+	/* produce 8 bytes in place */
+	for (int i = 0; i < 8; i++) {
+		((unsigned char *)region)[i] = i;
+	}
+	zassert_equal(k_pipe_write_finish(&cpipe, 8), 0, NULL);
+	zassert_equal(k_pipe_write_finish(&cpipe, PIPE_SIZE), -EINVAL,
+		      "oversized finish did not fail");
+	zassert_equal(k_pipe_read_avail(&cpipe), 8, NULL);
+
+	/* consume them in place */
+	run = k_pipe_read_claim(&cpipe, &region, PIPE_SIZE);
+	zassert_equal(run, 8, "bad read claim size %zu", run);
+	for (int i = 0; i < 8; i++) {
+		zassert_equal(((unsigned char *)region)[i], i,
+			      "pipe data corrupted");
+	}
+	zassert_equal(k_pipe_read_finish(&cpipe, 8), 0, NULL);
+	zassert_equal(k_pipe_read_finish(&cpipe, 1), -EINVAL,
+		      "finish of unclaimed data did not fail");
+
+	/* claims are bounded by the wrap point, then continue past it */
+	run = k_pipe_write_claim(&cpipe, &region, PIPE_SIZE);
+	zassert_equal(run, PIPE_SIZE - 8, "claim crossed the wrap point");
+	zassert_equal(k_pipe_write_finish(&cpipe, run), 0, NULL);
+	run = k_pipe_write_claim(&cpipe, &region, PIPE_SIZE);
+	zassert_equal(run, 8, "bad wrapped claim size %zu", run);
+	zassert_equal_ptr(region, cbuf, "wrapped claim not at buffer start");
+}
+
+static void claim_reader_entry(void *p1, void *p2, void *p3)
+{
+	unsigned char data[8];
+	size_t bytes_read;
+
+	/* blocks until the writer commits the whole request */
+	zassert_equal(k_pipe_get(&cpipe, data, 8, &bytes_read, 8,
+				 K_FOREVER), 0, NULL);
+	zassert_equal(bytes_read, 8, NULL);
+	for (int i = 0; i < 8; i++) {
+		zassert_equal(data[i], i, "handed-off data corrupted");
+	}
+}
+
+/**
+ * @brief Test that committed data wakes a blocked reader
+ *
+ * @ingroup kernel_pipe_tests
+ */
+void test_pipe_claim_wakes_reader(void)
+{
+	void *region;
+	k_tid_t tid;
+
+	k_pipe_init(&cpipe, cbuf, PIPE_SIZE);
+
+	tid = k_thread_create(&cthread, cstack, STACK_SIZE,
+			      claim_reader_entry, NULL, NULL, NULL,
+			      k_thread_priority_get(k_current_get()) - 1,
+			      0, K_NO_WAIT);
+
+	/* commit in two pieces: the reader only wakes on the second */
+	zassert_equal(k_pipe_write_claim(&cpipe, &region, 8), 8, NULL);
+	for (int i = 0; i < 4; i++) {
+		((unsigned char *)region)[i] = i;
+	}
+	zassert_equal(k_pipe_write_finish(&cpipe, 4), 0, NULL);
+
+	zassert_equal(k_pipe_write_claim(&cpipe, &region, 4), 4, NULL);
+	for (int i = 0; i < 4; i++) {
+		((unsigned char *)region)[i] = 4 + i;
+	}
+	zassert_equal(k_pipe_write_finish(&cpipe, 4), 0, NULL);
+
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(k_pipe_read_avail(&cpipe), 0,
+		      "handed-off data left in pipe");
+}
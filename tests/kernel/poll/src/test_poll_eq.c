@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2017 Wind River Systems, Inc.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <kernel.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+static K_THREAD_STACK_DEFINE(eq_stack, STACK_SIZE);
+static struct k_thread eq_thread;
+
+static struct k_poll_eq eq;
+static struct k_sem eq_sem;
+static struct k_poll_signal eq_signal;
+static struct k_fifo eq_fifo;
+
+static struct k_poll_event eq_events[3];
+
+/**
+ * @brief Test persistent registration and level-triggered readiness
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_eq_init(), k_poll_eq_add(), k_poll_eq_wait(),
+ * k_poll_eq_remove()
+ */
+void test_poll_eq_no_wait(void)
+{
+	static struct fifo_msg {
+		void *private;
+		uint32_t msg;
+	} msg = { NULL, 0xdeadbeef };
+	struct k_poll_event *ready[3];
+	int rc;
+
+	k_poll_eq_init(&eq);
+	k_sem_init(&eq_sem, 1, 1);
+	k_poll_signal_init(&eq_signal);
+	k_fifo_init(&eq_fifo);
+
+	k_poll_event_init(&eq_events[0], K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &eq_sem);
+	k_poll_event_init(&eq_events[1], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &eq_signal);
+	k_poll_event_init(&eq_events[2], K_POLL_TYPE_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &eq_fifo);
+
+	zassert_equal(k_poll_eq_add(&eq, &eq_events[0]), 0, NULL);
+	zassert_equal(k_poll_eq_add(&eq, &eq_events[1]), 0, NULL);
+	zassert_equal(k_poll_eq_add(&eq, &eq_events[2]), 0, NULL);
+
+	/* only the semaphore is ready, and only it is reported */
+	rc = k_poll_eq_wait(&eq, ready, 3, K_NO_WAIT);
+	zassert_equal(rc, 1, "expected 1 ready event, got %d", rc);
+	zassert_equal_ptr(ready[0], &eq_events[0], NULL);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE, NULL);
+
+	/* level-triggered: still ready on the next call */
+	rc = k_poll_eq_wait(&eq, ready, 3, K_NO_WAIT);
+	zassert_equal(rc, 1, "expected sem still ready, got %d", rc);
+
+	/* consuming the semaphore re-arms the event */
+	k_sem_take(&eq_sem, K_NO_WAIT);
+	zassert_equal(k_poll_eq_wait(&eq, ready, 3, K_NO_WAIT), -EAGAIN,
+		      NULL);
+
+	/* raising the other two events reports exactly those */
+	k_poll_signal_raise(&eq_signal, 0x55);
+	k_fifo_put(&eq_fifo, &msg);
+
+	rc = k_poll_eq_wait(&eq, ready, 3, K_NO_WAIT);
+	zassert_equal(rc, 2, "expected 2 ready events, got %d", rc);
+
+	k_poll_signal_reset(&eq_signal);
+	zassert_not_null(k_fifo_get(&eq_fifo, K_NO_WAIT), NULL);
+	zassert_equal(k_poll_eq_wait(&eq, ready, 3, K_NO_WAIT), -EAGAIN,
+		      NULL);
+
+	/* a removed event no longer reports */
+	k_sem_give(&eq_sem);
+	k_poll_eq_remove(&eq, &eq_events[0]);
+	zassert_equal(k_poll_eq_wait(&eq, ready, 3, K_NO_WAIT), -EAGAIN,
+		      NULL);
+
+	k_poll_eq_remove(&eq, &eq_events[1]);
+	k_poll_eq_remove(&eq, &eq_events[2]);
+}
+
+static void eq_raiser_entry(void *p1, void *p2, void *p3)
+{
+	k_poll_signal_raise(&eq_signal, 0xbeef);
+}
+
+/**
+ * @brief Test blocking wait woken by a registered event firing
+ *
+ * @ingroup kernel_poll_tests
+ */
+void test_poll_eq_wait(void)
+{
+	struct k_poll_event *ready[1];
+	unsigned int signaled;
+	int result, rc;
+
+	k_poll_eq_init(&eq);
+	k_poll_signal_init(&eq_signal);
+	k_poll_event_init(&eq_events[1], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &eq_signal);
+	zassert_equal(k_poll_eq_add(&eq, &eq_events[1]), 0, NULL);
+
+	/* timeout expires with nothing registered firing */
+	zassert_equal(k_poll_eq_wait(&eq, ready, 1, K_MSEC(20)), -EAGAIN,
+		      NULL);
+
+	k_thread_create(&eq_thread, eq_stack, STACK_SIZE,
+			eq_raiser_entry, NULL, NULL, NULL,
+			k_thread_priority_get(k_current_get()) + 1,
+			0, K_NO_WAIT);
+
+	rc = k_poll_eq_wait(&eq, ready, 1, K_SECONDS(1));
+	zassert_equal(rc, 1, "expected wakeup on raise, got %d", rc);
+	zassert_equal_ptr(ready[0], &eq_events[1], NULL);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED, NULL);
+
+	k_poll_signal_check(&eq_signal, &signaled, &result);
+	zassert_equal(result, 0xbeef, NULL);
+
+	k_poll_signal_reset(&eq_signal);
+	k_poll_eq_remove(&eq, &eq_events[1]);
+	k_thread_join(&eq_thread, K_FOREVER);
+}
@@ -45,6 +45,7 @@ void test_main(void)
 			 ztest_1cpu_unit_test(test_queue_loop),
 			 ztest_unit_test(test_queue_alloc),
 			 ztest_1cpu_unit_test(test_queue_poll_race),
-			 ztest_unit_test(test_multiple_queues));
+			 ztest_unit_test(test_multiple_queues),
+			 ztest_1cpu_unit_test(test_queue_get_batch));
 	ztest_run_test_suite(queue_api);
 }
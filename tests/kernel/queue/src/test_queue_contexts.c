@@ -398,3 +398,49 @@ void test_multiple_queues(void)
 		tqueue_get(&queues[i]);
 	}
 }
+
+/**
+ * @brief Verify batched dequeue from a queue
+ *
+ * @details Append several items, then drain them with
+ * k_queue_get_batch() in batches both smaller and larger than the
+ * backlog, verifying FIFO order, the leftover items and the empty/
+ * timeout behavior.
+ *
+ * @ingroup kernel_queue_tests
+ *
+ * @see k_queue_get_batch()
+ */
+#define BATCH_LEN 4
+void test_queue_get_batch(void)
+{
+	static qdata_t batch_data[BATCH_LEN];
+	void *batch[BATCH_LEN];
+
+	k_queue_init(&queue);
+
+	/**TESTPOINT: empty queue without waiting returns zero items*/
+	zassert_equal(k_queue_get_batch(&queue, batch, BATCH_LEN, K_NO_WAIT),
+		      0, NULL);
+
+	/**TESTPOINT: empty queue with timeout returns zero items*/
+	zassert_equal(k_queue_get_batch(&queue, batch, BATCH_LEN, K_MSEC(10)),
+		      0, NULL);
+
+	for (int i = 0; i < BATCH_LEN; i++) {
+		k_queue_append(&queue, (void *)&batch_data[i]);
+	}
+
+	/**TESTPOINT: batch smaller than backlog leaves the rest queued*/
+	zassert_equal(k_queue_get_batch(&queue, batch, BATCH_LEN - 1,
+					K_NO_WAIT), BATCH_LEN - 1, NULL);
+	for (int i = 0; i < BATCH_LEN - 1; i++) {
+		zassert_equal(batch[i], (void *)&batch_data[i], NULL);
+	}
+
+	/**TESTPOINT: batch larger than backlog returns what is there*/
+	zassert_equal(k_queue_get_batch(&queue, batch, BATCH_LEN, K_NO_WAIT),
+		      1, NULL);
+	zassert_equal(batch[0], (void *)&batch_data[BATCH_LEN - 1], NULL);
+	zassert_true(k_queue_is_empty(&queue), NULL);
+}
@@ -945,6 +945,66 @@ void test_sem_multiple_threads_wait(void)
 	} while (repeat_count < 2);
 }
 
+/**
+ * @brief Test batched semaphore give
+ * @ingroup kernel_semaphore_tests
+ * @see k_sem_give_count()
+ */
+void test_sem_give_count(void)
+{
+	uint32_t signal_count;
+	int32_t ret_value;
+
+	k_sem_reset(&simple_sem);
+	k_sem_reset(&multiple_thread_sem);
+
+	/* uncontended gives are credited to the count, up to the limit */
+	k_sem_give_count(&simple_sem, 4U);
+	signal_count = k_sem_count_get(&simple_sem);
+	zassert_true(signal_count == 4U,
+		     "signal count missmatch - expected 4, got %d",
+		     signal_count);
+
+	k_sem_give_count(&simple_sem, SEM_MAX_VAL);
+	signal_count = k_sem_count_get(&simple_sem);
+	zassert_true(signal_count == SEM_MAX_VAL,
+		     "signal count missmatch - expected %d, got %d",
+		     SEM_MAX_VAL, signal_count);
+
+	k_sem_reset(&simple_sem);
+
+	/* a single give wakes every thread in the batch */
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_create(&multiple_tid[i],
+				multiple_stack[i], STACK_SIZE,
+				sem_multiple_threads_wait_helper,
+				NULL, NULL, NULL,
+				K_PRIO_PREEMPT(1),
+				K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	/* giving time for the other threads to execute  */
+	k_sleep(K_MSEC(500));
+
+	k_sem_give_count(&multiple_thread_sem, TOTAL_THREADS_WAITING);
+
+	/* giving time for the other threads to execute  */
+	k_sleep(K_MSEC(500));
+
+	/* check if all the threads are done. */
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		ret_value = k_sem_take(&simple_sem, K_FOREVER);
+		zassert_true(ret_value == 0,
+			     "Some of the threads did not get multiple_thread_sem"
+			     );
+	}
+
+	signal_count = k_sem_count_get(&multiple_thread_sem);
+	zassert_true(signal_count == 0U,
+		     "signal count missmatch - expected 0, got %d",
+		     signal_count);
+}
+
 /**
  * @brief Test semaphore timeout period
  * @ingroup kernel_semaphore_tests
@@ -1229,6 +1289,7 @@ void test_main(void)
 			 ztest_unit_test(test_sem_give_take_from_isr),
 			 ztest_user_unit_test(test_k_sem_correct_count_limit),
 			 ztest_unit_test(test_sem_multiple_threads_wait),
+			 ztest_unit_test(test_sem_give_count),
 			 ztest_unit_test(test_sem_measure_timeouts),
 			 ztest_unit_test(test_sem_measure_timeout_from_thread),
 			 ztest_1cpu_unit_test(test_sem_multiple_take_and_timeouts),
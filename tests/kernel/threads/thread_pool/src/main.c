@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <kernel.h>
+
+#define POOL_SLOTS 2
+#define POOL_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define PRIO (k_thread_priority_get(k_current_get()) + 1)
+
+K_THREAD_POOL_DEFINE(pool, POOL_SLOTS, POOL_STACK_SIZE);
+
+static struct k_sem sync_sema;
+static struct k_sem hold_sema;
+
+static void worker_entry(void *p1, void *p2, void *p3)
+{
+	k_sem_give(&sync_sema);
+}
+
+static void holder_entry(void *p1, void *p2, void *p3)
+{
+	k_sem_take(&hold_sema, K_FOREVER);
+}
+
+/**
+ * @brief Test spawning workers from a thread pool
+ *
+ * @details Spawn more workers than the pool has slots, relying on slot
+ * recycling as each worker exits, and check that slots (thread objects
+ * and stacks) are reused.
+ *
+ * @ingroup kernel_thread_tests
+ *
+ * @see K_THREAD_POOL_DEFINE(), k_thread_pool_spawn()
+ */
+void test_thread_pool_spawn_recycle(void)
+{
+	k_tid_t tids[POOL_SLOTS * 3];
+	bool reused = false;
+
+	k_sem_init(&sync_sema, 0, ARRAY_SIZE(tids));
+
+	for (int i = 0; i < ARRAY_SIZE(tids); i++) {
+		tids[i] = k_thread_pool_spawn(&pool, worker_entry,
+					      NULL, NULL, NULL,
+					      PRIO, 0, K_SECONDS(1));
+		zassert_not_null(tids[i], "spawn %d failed", i);
+		zassert_equal(k_sem_take(&sync_sema, K_SECONDS(1)), 0,
+			      "worker %d did not run", i);
+	}
+
+	/* with more spawns than slots, thread objects must recycle */
+	for (int i = POOL_SLOTS; i < ARRAY_SIZE(tids); i++) {
+		for (int j = 0; j < POOL_SLOTS; j++) {
+			if (tids[i] == tids[j]) {
+				reused = true;
+			}
+		}
+	}
+	zassert_true(reused, "no pool slot was recycled");
+}
+
+/**
+ * @brief Test pool exhaustion and recycling on worker exit
+ *
+ * @details With every slot occupied, a spawn with K_NO_WAIT must fail
+ * and a blocking spawn must succeed as soon as one worker exits.
+ *
+ * @ingroup kernel_thread_tests
+ */
+void test_thread_pool_exhausted(void)
+{
+	k_tid_t tid;
+
+	k_sem_init(&hold_sema, 0, POOL_SLOTS);
+
+	for (int i = 0; i < POOL_SLOTS; i++) {
+		tid = k_thread_pool_spawn(&pool, holder_entry,
+					  NULL, NULL, NULL,
+					  PRIO, 0, K_NO_WAIT);
+		zassert_not_null(tid, "spawn %d failed", i);
+	}
+
+	zassert_is_null(k_thread_pool_spawn(&pool, holder_entry,
+					    NULL, NULL, NULL,
+					    PRIO, 0, K_NO_WAIT),
+			"spawn on exhausted pool succeeded");
+
+	/* release one holder; its slot must become spawnable again */
+	k_sem_give(&hold_sema);
+	tid = k_thread_pool_spawn(&pool, worker_entry, NULL, NULL, NULL,
+				  PRIO, 0, K_SECONDS(1));
+	zassert_not_null(tid, "spawn after worker exit failed");
+
+	k_sem_init(&sync_sema, 0, 1);
+	zassert_equal(k_sem_take(&sync_sema, K_SECONDS(1)), 0,
+		      "recycled worker did not run");
+
+	/* drain the remaining holders */
+	for (int i = 1; i < POOL_SLOTS; i++) {
+		k_sem_give(&hold_sema);
+	}
+	k_sleep(K_MSEC(100));
+}
+
+/**
+ * @brief Test that aborted workers return their slot to the pool
+ *
+ * @ingroup kernel_thread_tests
+ */
+void test_thread_pool_abort_recycle(void)
+{
+	k_tid_t tid;
+
+	k_sem_init(&hold_sema, 0, POOL_SLOTS);
+
+	for (int i = 0; i < POOL_SLOTS; i++) {
+		tid = k_thread_pool_spawn(&pool, holder_entry,
+					  NULL, NULL, NULL,
+					  PRIO, 0, K_NO_WAIT);
+		zassert_not_null(tid, "spawn %d failed", i);
+	}
+
+	k_thread_abort(tid);
+
+	tid = k_thread_pool_spawn(&pool, holder_entry, NULL, NULL, NULL,
+				  PRIO, 0, K_NO_WAIT);
+	zassert_not_null(tid, "aborted worker's slot was not recycled");
+
+	for (int i = 0; i < POOL_SLOTS; i++) {
+		k_sem_give(&hold_sema);
+	}
+	k_sleep(K_MSEC(100));
+}
+
+void test_main(void)
+{
+	ztest_test_suite(thread_pool,
+			 ztest_1cpu_unit_test(test_thread_pool_spawn_recycle),
+			 ztest_1cpu_unit_test(test_thread_pool_exhausted),
+			 ztest_1cpu_unit_test(test_thread_pool_abort_recycle));
+	ztest_run_test_suite(thread_pool);
+}
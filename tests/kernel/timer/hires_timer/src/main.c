@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <zephyr/types.h>
+#include <sys/hires_timer.h>
+
+/* The system tick is kept deliberately slow (see prj.conf) so that
+ * every delay used here is well below one tick period: each test only
+ * passes if expiry really is sub-tick.
+ */
+#define TICK_PERIOD_US (USEC_PER_SEC / CONFIG_SYS_CLOCK_TICKS_PER_SEC)
+
+static struct k_hires_timer timers[3];
+static struct k_sem expiry_sem;
+static uint32_t expiry_cycle;
+static int expiry_order[3];
+static int expiry_count;
+
+static void expiry_fn(struct k_hires_timer *timer)
+{
+	expiry_cycle = k_cycle_get_32();
+
+	if (expiry_count < ARRAY_SIZE(expiry_order)) {
+		expiry_order[expiry_count] = timer - timers;
+	}
+	expiry_count++;
+
+	k_sem_give(&expiry_sem);
+}
+
+/**
+ * @brief Test one-shot sub-tick expiry accuracy
+ *
+ * Start a timer with a delay far below the tick period and check that
+ * it fires, and that it fires at the requested cycle count rather than
+ * at the next tick boundary.
+ */
+static void test_one_shot(void)
+{
+	uint32_t delay_us = TICK_PERIOD_US / 8;
+	uint32_t cycles_per_us = sys_clock_hw_cycles_per_sec() / USEC_PER_SEC;
+	uint32_t start;
+	uint32_t elapsed_us;
+
+	k_sem_reset(&expiry_sem);
+	k_hires_timer_init(&timers[0], expiry_fn);
+
+	start = k_cycle_get_32();
+	k_hires_timer_start(&timers[0], delay_us);
+
+	zassert_equal(k_sem_take(&expiry_sem, K_MSEC(1000)), 0,
+		      "timer did not expire");
+
+	elapsed_us = (expiry_cycle - start) / cycles_per_us;
+	zassert_true(elapsed_us >= delay_us,
+		     "expired too early (%u < %u us)", elapsed_us, delay_us);
+	zassert_true(elapsed_us < TICK_PERIOD_US,
+		     "expiry quantized to the tick (%u us)", elapsed_us);
+}
+
+/**
+ * @brief Test that several timers expire in deadline order
+ */
+static void test_ordering(void)
+{
+	int i;
+
+	k_sem_reset(&expiry_sem);
+	expiry_count = 0;
+
+	for (i = 0; i < ARRAY_SIZE(timers); i++) {
+		k_hires_timer_init(&timers[i], expiry_fn);
+	}
+
+	/* Started out of deadline order on purpose */
+	k_hires_timer_start(&timers[0], 3 * TICK_PERIOD_US / 8);
+	k_hires_timer_start(&timers[1], TICK_PERIOD_US / 8);
+	k_hires_timer_start(&timers[2], 2 * TICK_PERIOD_US / 8);
+
+	for (i = 0; i < ARRAY_SIZE(timers); i++) {
+		zassert_equal(k_sem_take(&expiry_sem, K_MSEC(1000)), 0,
+			      "timer %d did not expire", i);
+	}
+
+	zassert_equal(expiry_order[0], 1, "wrong first expiry");
+	zassert_equal(expiry_order[1], 2, "wrong second expiry");
+	zassert_equal(expiry_order[2], 0, "wrong third expiry");
+}
+
+/**
+ * @brief Test stopping a pending timer
+ */
+static void test_stop(void)
+{
+	k_sem_reset(&expiry_sem);
+	k_hires_timer_init(&timers[0], expiry_fn);
+
+	k_hires_timer_start(&timers[0], TICK_PERIOD_US / 4);
+	zassert_true(k_hires_timer_stop(&timers[0]), "timer was not pending");
+	zassert_false(k_hires_timer_stop(&timers[0]),
+		      "stopped timer still pending");
+
+	zassert_equal(k_sem_take(&expiry_sem, K_MSEC(100)), -EAGAIN,
+		      "stopped timer expired");
+}
+
+/**
+ * @brief Test remaining time query and restart
+ */
+static void test_remaining(void)
+{
+	uint32_t remaining;
+
+	k_sem_reset(&expiry_sem);
+	k_hires_timer_init(&timers[0], expiry_fn);
+
+	zassert_equal(k_hires_timer_remaining_us(&timers[0]), 0,
+		      "unstarted timer has time remaining");
+
+	k_hires_timer_start(&timers[0], TICK_PERIOD_US / 2);
+	remaining = k_hires_timer_remaining_us(&timers[0]);
+	zassert_true(remaining > 0 && remaining <= TICK_PERIOD_US / 2,
+		     "bad remaining time %u us", remaining);
+
+	/* Restarting a pending timer moves its expiry point */
+	k_hires_timer_start(&timers[0], TICK_PERIOD_US / 8);
+	zassert_equal(k_sem_take(&expiry_sem, K_MSEC(1000)), 0,
+		      "restarted timer did not expire");
+	zassert_equal(k_sem_take(&expiry_sem, K_MSEC(100)), -EAGAIN,
+		      "timer expired twice");
+}
+
+void test_main(void)
+{
+	k_sem_init(&expiry_sem, 0, ARRAY_SIZE(timers));
+
+	ztest_test_suite(hires_timer,
+			 ztest_unit_test(test_one_shot),
+			 ztest_unit_test(test_ordering),
+			 ztest_unit_test(test_stop),
+			 ztest_unit_test(test_remaining));
+	ztest_run_test_suite(hires_timer);
+}
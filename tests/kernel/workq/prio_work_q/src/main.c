@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define NUM_ITEMS 4
+
+/* Queue thread runs below the test thread so submissions queue up
+ * before anything is drained.
+ */
+#define QUEUE_PRIO (CONFIG_ZTEST_THREAD_PRIORITY + 2)
+
+static K_THREAD_STACK_DEFINE(queue_stack, STACK_SIZE);
+static struct k_prio_work_q queue;
+
+static struct k_prio_work items[NUM_ITEMS];
+static struct k_sem done_sem;
+
+static int run_order[NUM_ITEMS];
+static int num_run;
+
+static void work_handler(struct k_work *work)
+{
+	struct k_prio_work *item = CONTAINER_OF(work, struct k_prio_work,
+						work);
+
+	run_order[num_run++] = item - items;
+	k_sem_give(&done_sem);
+}
+
+static void expect_order(const int *expected, int count)
+{
+	for (int i = 0; i < count; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+
+	zassert_equal(num_run, count, "expected %d items to run, got %d",
+		      count, num_run);
+
+	for (int i = 0; i < count; i++) {
+		zassert_equal(run_order[i], expected[i],
+			      "position %d: expected item %d, got item %d",
+			      i, expected[i], run_order[i]);
+	}
+}
+
+static void reset(void)
+{
+	num_run = 0;
+	k_sem_init(&done_sem, 0, NUM_ITEMS);
+}
+
+/**
+ * @brief Verify items run highest priority first, not submission order
+ *
+ * @ingroup kernel_workqueue_tests
+ */
+static void test_prio_order(void)
+{
+	reset();
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		/* Item 0 gets the highest priority value, so priority
+		 * order is the reverse of submission order.
+		 */
+		k_prio_work_init(&items[i], work_handler, NUM_ITEMS - i);
+		k_prio_work_submit_to_queue(&queue, &items[i]);
+	}
+
+	expect_order((const int[]){3, 2, 1, 0}, NUM_ITEMS);
+}
+
+/**
+ * @brief Verify submission order is kept among equal priorities
+ *
+ * @ingroup kernel_workqueue_tests
+ */
+static void test_prio_tie_fifo(void)
+{
+	reset();
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_prio_work_init(&items[i], work_handler, 1);
+		k_prio_work_submit_to_queue(&queue, &items[i]);
+	}
+
+	expect_order((const int[]){0, 1, 2, 3}, NUM_ITEMS);
+}
+
+/**
+ * @brief Verify a cancelled item does not run and cannot be
+ * cancelled twice
+ *
+ * @ingroup kernel_workqueue_tests
+ */
+static void test_prio_cancel(void)
+{
+	reset();
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_prio_work_init(&items[i], work_handler, i);
+		k_prio_work_submit_to_queue(&queue, &items[i]);
+	}
+
+	zassert_equal(k_prio_work_cancel(&queue, &items[2]), 0,
+		      "cancel of pending item failed");
+	zassert_equal(k_prio_work_cancel(&queue, &items[2]), -EINVAL,
+		      "second cancel did not fail");
+
+	expect_order((const int[]){0, 1, 3}, NUM_ITEMS - 1);
+
+	zassert_equal(k_prio_work_cancel(&queue, &items[0]), -EINVAL,
+		      "cancel of completed item did not fail");
+}
+
+void test_main(void)
+{
+	k_prio_work_q_start(&queue, queue_stack,
+			    K_THREAD_STACK_SIZEOF(queue_stack), QUEUE_PRIO);
+
+	ztest_test_suite(prio_work_q,
+			 ztest_1cpu_unit_test(test_prio_order),
+			 ztest_1cpu_unit_test(test_prio_tie_fifo),
+			 ztest_1cpu_unit_test(test_prio_cancel));
+	ztest_run_test_suite(prio_work_q);
+}
@@ -539,6 +539,162 @@ static void test_json_encode_bounds_check(void)
 	zassert_equal(ret, -ENOMEM, "Bounds check rejected");
 }
 
+static void test_json_hashed_decoding(void)
+{
+	struct telemetry {
+		int32_t temperature;
+		int32_t humidity;
+		char *unit;
+		bool valid;
+	} decoded;
+	static const struct json_obj_descr telemetry_descr[] = {
+		JSON_OBJ_DESCR_PRIM(struct telemetry, temperature,
+				    JSON_TOK_NUMBER),
+		JSON_OBJ_DESCR_PRIM(struct telemetry, humidity,
+				    JSON_TOK_NUMBER),
+		JSON_OBJ_DESCR_PRIM(struct telemetry, unit, JSON_TOK_STRING),
+		JSON_OBJ_DESCR_PRIM(struct telemetry, valid, JSON_TOK_TRUE),
+	};
+	static uint32_t telemetry_hashes[ARRAY_SIZE(telemetry_descr)];
+	char encoded[] = "{\"humidity\":55,\"temperature\":-3,"
+			 "\"unit\":\"c\",\"valid\":true}";
+	char encoded2[] = "{\"temperature\":21,\"humidity\":40,"
+			  "\"unit\":\"c\",\"valid\":false}";
+	int ret;
+
+	ret = json_obj_parse_hashed(encoded, sizeof(encoded) - 1,
+				    telemetry_descr,
+				    ARRAY_SIZE(telemetry_descr),
+				    telemetry_hashes, &decoded);
+	zassert_equal(ret, (1 << ARRAY_SIZE(telemetry_descr)) - 1,
+		      "All fields decoded");
+	zassert_equal(decoded.temperature, -3, "Temperature decoded");
+	zassert_equal(decoded.humidity, 55, "Humidity decoded");
+	zassert_true(!strcmp(decoded.unit, "c"), "Unit decoded");
+	zassert_true(decoded.valid, "Validity decoded");
+
+	/* Second message reuses the now-populated hash table */
+	ret = json_obj_parse_hashed(encoded2, sizeof(encoded2) - 1,
+				    telemetry_descr,
+				    ARRAY_SIZE(telemetry_descr),
+				    telemetry_hashes, &decoded);
+	zassert_equal(ret, (1 << ARRAY_SIZE(telemetry_descr)) - 1,
+		      "All fields decoded on reuse");
+	zassert_equal(decoded.temperature, 21, "Temperature decoded");
+	zassert_equal(decoded.humidity, 40, "Humidity decoded");
+	zassert_false(decoded.valid, "Validity decoded");
+}
+
+struct stream_record {
+	enum json_tokens type;
+	char value[32];
+};
+
+struct stream_capture {
+	struct stream_record records[24];
+	size_t count;
+};
+
+static int stream_capture_cb(const struct json_stream_token *token,
+			     void *user_data)
+{
+	struct stream_capture *capture = user_data;
+	struct stream_record *rec;
+
+	if (capture->count >= ARRAY_SIZE(capture->records)) {
+		return -ENOMEM;
+	}
+
+	rec = &capture->records[capture->count++];
+	rec->type = token->type;
+	if (token->len >= sizeof(rec->value)) {
+		return -ENOMEM;
+	}
+	memcpy(rec->value, token->start, token->len);
+	rec->value[token->len] = '\0';
+
+	return 0;
+}
+
+static void test_json_stream_parse(void)
+{
+	static const char doc[] =
+		"{\"name\":\"light\",\"on\":true,\"level\":-42,"
+		"\"tags\":[\"a\",null]}";
+	const enum json_tokens expected_types[] = {
+		JSON_TOK_OBJECT_START, JSON_TOK_STRING, JSON_TOK_STRING,
+		JSON_TOK_STRING, JSON_TOK_TRUE, JSON_TOK_STRING,
+		JSON_TOK_NUMBER, JSON_TOK_STRING, JSON_TOK_LIST_START,
+		JSON_TOK_STRING, JSON_TOK_NULL, JSON_TOK_LIST_END,
+		JSON_TOK_OBJECT_END,
+	};
+	struct stream_capture capture;
+	struct json_stream stream;
+	char scratch[16];
+	size_t chunk;
+	int ret;
+
+	/* Feed the document in every chunk size from 1 byte up, so
+	 * every possible split point is exercised.
+	 */
+	for (chunk = 1; chunk <= sizeof(doc) - 1; chunk++) {
+		size_t off;
+		size_t i;
+
+		capture.count = 0;
+		json_stream_init(&stream, stream_capture_cb, &capture,
+				 scratch, sizeof(scratch));
+
+		for (off = 0; off < sizeof(doc) - 1; off += chunk) {
+			ret = json_stream_feed(&stream, doc + off,
+					       MIN(chunk,
+						   sizeof(doc) - 1 - off));
+			zassert_equal(ret, 0, "Chunk accepted");
+		}
+
+		zassert_equal(capture.count, ARRAY_SIZE(expected_types),
+			      "All tokens reported");
+		for (i = 0; i < ARRAY_SIZE(expected_types); i++) {
+			zassert_equal(capture.records[i].type,
+				      expected_types[i], "Token type matches");
+		}
+		zassert_true(!strcmp(capture.records[1].value, "name"),
+			     "Key string value");
+		zassert_true(!strcmp(capture.records[6].value, "-42"),
+			     "Number value");
+		zassert_true(!strcmp(capture.records[9].value, "a"),
+			     "Array string value");
+	}
+}
+
+static void test_json_stream_invalid(void)
+{
+	struct stream_capture capture = { .count = 0 };
+	struct json_stream stream;
+	char scratch[16];
+	int ret;
+
+	/* Mismatched container close */
+	json_stream_init(&stream, stream_capture_cb, &capture,
+			 scratch, sizeof(scratch));
+	ret = json_stream_feed(&stream, "{]", 2);
+	zassert_equal(ret, -EINVAL, "Mismatched close rejected");
+
+	/* Invalid primitive */
+	json_stream_init(&stream, stream_capture_cb, &capture,
+			 scratch, sizeof(scratch));
+	ret = json_stream_feed(&stream, "[nul] ", 6);
+	zassert_equal(ret, -EINVAL, "Invalid keyword rejected");
+
+	/* Split token larger than the scratch buffer */
+	json_stream_init(&stream, stream_capture_cb, &capture,
+			 scratch, sizeof(scratch));
+	ret = json_stream_feed(&stream, "[\"0123456789", 12);
+	zassert_equal(ret, 0, "First chunk accepted");
+	ret = json_stream_feed(&stream, "0123456789\"]", 12);
+	zassert_equal(ret, -ENOMEM, "Scratch overflow reported");
+}
+
 void test_main(void)
 {
 	ztest_test_suite(lib_json_test,
@@ -560,7 +716,10 @@ void test_main(void)
 			 ztest_unit_test(test_json_escape_empty),
 			 ztest_unit_test(test_json_escape_no_op),
 			 ztest_unit_test(test_json_escape_bounds_check),
-			 ztest_unit_test(test_json_encode_bounds_check)
+			 ztest_unit_test(test_json_encode_bounds_check),
+			 ztest_unit_test(test_json_stream_parse),
+			 ztest_unit_test(test_json_stream_invalid),
+			 ztest_unit_test(test_json_hashed_decoding)
 			 );
 
 	ztest_run_test_suite(lib_json_test);
@@ -739,6 +739,51 @@ void test_ringbuffer_array_perf(void)
 	zassert_equal(sizeof(tp), sizeof(ringbuf_stored[0]), NULL);
 }
 
+RING_BUF_MPMC_DECLARE(ringbuf_mpmc, 3);
+
+/**
+ * @brief Test lock-free MPMC ring buffer ordering and capacity
+ *
+ * @details Fill a statically declared MPMC ring to capacity, verify the
+ * overflow and underflow return codes, FIFO ordering, and that the ring
+ * keeps working across several wrap-arounds.  Also exercises
+ * ring_buf_mpmc_init() on a runtime-initialized ring.
+ *
+ * @ingroup lib_ringbuffer_tests
+ *
+ * @see ring_buf_mpmc_put, ring_buf_mpmc_get
+ */
+void test_ringbuffer_mpmc(void)
+{
+	static struct ring_buf_mpmc_cell cells[4];
+	struct ring_buf_mpmc rtbuf;
+	uintptr_t data;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		zassert_equal(ring_buf_mpmc_put(&ringbuf_mpmc, i), 0, NULL);
+	}
+	zassert_equal(ring_buf_mpmc_put(&ringbuf_mpmc, 99), -ENOSPC, NULL);
+
+	for (i = 0; i < 8; i++) {
+		zassert_equal(ring_buf_mpmc_get(&ringbuf_mpmc, &data), 0, NULL);
+		zassert_equal(data, (uintptr_t)i, NULL);
+	}
+	zassert_equal(ring_buf_mpmc_get(&ringbuf_mpmc, &data), -EAGAIN, NULL);
+
+	ring_buf_mpmc_init(&rtbuf, ARRAY_SIZE(cells), cells);
+
+	/* several laps through a partially filled ring */
+	for (i = 0; i < 5 * ARRAY_SIZE(cells); i++) {
+		zassert_equal(ring_buf_mpmc_put(&rtbuf, i), 0, NULL);
+		zassert_equal(ring_buf_mpmc_put(&rtbuf, i + 1000), 0, NULL);
+		zassert_equal(ring_buf_mpmc_get(&rtbuf, &data), 0, NULL);
+		zassert_equal(data, (uintptr_t)i, NULL);
+		zassert_equal(ring_buf_mpmc_get(&rtbuf, &data), 0, NULL);
+		zassert_equal(data, (uintptr_t)(i + 1000), NULL);
+	}
+	zassert_equal(ring_buf_mpmc_get(&rtbuf, &data), -EAGAIN, NULL);
+}
 
 /*test case main entry*/
 void test_main(void)
@@ -759,7 +804,8 @@ void test_main(void)
 			 ztest_unit_test(test_byte_put_free),
 			 ztest_unit_test(test_byte_put_free),
 			 ztest_unit_test(test_capacity),
-			 ztest_unit_test(test_reset)
+			 ztest_unit_test(test_reset),
+			 ztest_unit_test(test_ringbuffer_mpmc)
 			 );
 	ztest_run_test_suite(test_ringbuffer_api);
 }
@@ -450,6 +450,75 @@ static void test_net_ctx_sendto_v4(void)
 		      "Context send IPv4 UDP test failed");
 }
 
+#if defined(CONFIG_NET_CONTEXT_SENDBUF)
+static bool send_buf_released;
+
+static void send_buf_destroy(struct net_buf *buf)
+{
+	send_buf_released = true;
+
+	net_buf_destroy(buf);
+}
+
+NET_BUF_POOL_DEFINE(send_buf_pool, 2, 128, 0, send_buf_destroy);
+
+static void test_net_ctx_send_buf_v4(void)
+{
+	struct net_buf *buf;
+	int ret;
+
+	buf = net_buf_alloc(&send_buf_pool, K_FOREVER);
+	zassert_not_null(buf, "Send buf allocation failed");
+
+	net_buf_add_mem(buf, test_data, strlen(test_data));
+
+	test_sending = true;
+	send_buf_released = false;
+
+	ret = net_context_send_buf(udp_v4_ctx, buf, send_cb, K_FOREVER,
+				   INT_TO_POINTER(AF_INET));
+	k_yield();
+
+	zassert_false(((ret < 0) || cb_failure),
+		      "Context send_buf IPv4 UDP test failed");
+	zassert_true(send_buf_released,
+		     "Loaned buffer was not released back to the pool");
+}
+
+static void test_net_ctx_send_buf_v6(void)
+{
+	struct net_buf *buf;
+	int ret;
+
+	buf = net_buf_alloc(&send_buf_pool, K_FOREVER);
+	zassert_not_null(buf, "Send buf allocation failed");
+
+	net_buf_add_mem(buf, test_data, strlen(test_data));
+
+	test_sending = true;
+	send_buf_released = false;
+
+	ret = net_context_send_buf(udp_v6_ctx, buf, send_cb, K_FOREVER,
+				   INT_TO_POINTER(AF_INET6));
+	k_yield();
+
+	zassert_false(((ret < 0) || cb_failure),
+		      "Context send_buf IPv6 UDP test failed");
+	zassert_true(send_buf_released,
+		     "Loaned buffer was not released back to the pool");
+}
+#else
+static void test_net_ctx_send_buf_v4(void)
+{
+	ztest_test_skip();
+}
+
+static void test_net_ctx_send_buf_v6(void)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_NET_CONTEXT_SENDBUF */
+
 static void recv_cb(struct net_context *context,
 		    struct net_pkt *pkt,
 		    union net_ip_header *ip_hdr,
@@ -500,6 +569,42 @@ static void test_net_ctx_recv_v4(void)
 	recv_cb_called = false;
 }
 
+#if defined(CONFIG_NET_CONTEXT_SPLICE)
+static bool splice_watch;
+static bool splice_forwarded;
+
+static void test_net_ctx_splice_v6(void)
+{
+	int ret;
+
+	ret = net_context_splice(udp_v6_ctx, udp_v4_ctx);
+	zassert_equal(ret, 0, "Context splice test failed");
+
+	splice_watch = true;
+	splice_forwarded = false;
+
+	/* Loop a datagram back to the IPv6 context, the splice then
+	 * forwards the payload out through the IPv4 context.
+	 */
+	test_net_ctx_sendto_v6();
+
+	k_sem_take(&wait_data, WAIT_TIME);
+
+	zassert_true(splice_forwarded, "Spliced data was not forwarded");
+
+	ret = net_context_unsplice(udp_v6_ctx);
+	zassert_equal(ret, 0, "Context unsplice test failed");
+
+	ret = net_context_unsplice(udp_v4_ctx);
+	zassert_equal(ret, 0, "Context unsplice test failed");
+}
+#else
+static void test_net_ctx_splice_v6(void)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_NET_CONTEXT_SPLICE */
+
 static bool net_ctx_sendto_v6_wrong_src(void)
 {
 	int ret;
@@ -896,6 +1001,17 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 		return -ENODATA;
 	}
 
+#if defined(CONFIG_NET_CONTEXT_SPLICE)
+	if (splice_watch && !test_sending) {
+		/* This is the packet that the splice forwarded onwards */
+		splice_forwarded = true;
+		splice_watch = false;
+		k_sem_give(&wait_data);
+
+		return 0;
+	}
+#endif
+
 	if (test_sending) {
 		/* We are now about to send data to outside but in this
 		 * test we just check what would be sent. In real life
@@ -1022,12 +1138,15 @@ void test_main(void)
 			 ztest_unit_test(test_net_ctx_send_v4),
 			 ztest_unit_test(test_net_ctx_sendto_v6),
 			 ztest_unit_test(test_net_ctx_sendto_v4),
+			 ztest_unit_test(test_net_ctx_send_buf_v6),
+			 ztest_unit_test(test_net_ctx_send_buf_v4),
 			 ztest_unit_test(test_net_ctx_recv_v6),
 			 ztest_unit_test(test_net_ctx_recv_v4),
 			 ztest_unit_test(test_net_ctx_recv_v6_fail),
 			 ztest_unit_test(test_net_ctx_recv_v4_fail),
 			 ztest_unit_test(test_net_ctx_recv_v6_again),
 			 ztest_unit_test(test_net_ctx_recv_v4_again),
+			 ztest_unit_test(test_net_ctx_splice_v6),
 			 ztest_unit_test(test_net_ctx_recv_v6_reconfig),
 			 ztest_unit_test(test_net_ctx_recv_v4_reconfig),
 			 ztest_unit_test(test_net_ctx_recv_v6_timeout),
@@ -1454,6 +1454,159 @@ done:
 	return result;
 }
 
+static int test_packet_clone(void)
+{
+	struct coap_packet template, clone;
+	const char token[] = "token";
+	const char *payload = "payload";
+	const uint8_t *clone_payload;
+	uint16_t payload_len;
+	uint8_t read_token[8];
+	uint8_t *data = NULL;
+	uint8_t *clone_data = NULL;
+	uint8_t format = 0U;
+	int result = TC_FAIL;
+	int r;
+
+	data = (uint8_t *)k_malloc(COAP_BUF_SIZE);
+	clone_data = (uint8_t *)k_malloc(COAP_BUF_SIZE);
+	if (!data || !clone_data) {
+		goto done;
+	}
+
+	/* Serialize the notification once, without a token. */
+	r = coap_packet_init(&template, data, COAP_BUF_SIZE,
+			     1, COAP_TYPE_CON, 0, NULL,
+			     COAP_RESPONSE_CODE_CONTENT, 0x1234);
+	if (r < 0) {
+		TC_PRINT("Could not initialize template packet\n");
+		goto done;
+	}
+
+	r = coap_append_option_int(&template, COAP_OPTION_OBSERVE, 2);
+	if (r < 0) {
+		TC_PRINT("Could not append observe option\n");
+		goto done;
+	}
+
+	r = coap_packet_append_option(&template, COAP_OPTION_CONTENT_FORMAT,
+				      &format, sizeof(format));
+	if (r < 0) {
+		TC_PRINT("Could not append option\n");
+		goto done;
+	}
+
+	r = coap_packet_append_payload_marker(&template);
+	if (r < 0) {
+		TC_PRINT("Failed to set the payload marker\n");
+		goto done;
+	}
+
+	r = coap_packet_append_payload(&template, (uint8_t *)payload,
+				       strlen(payload));
+	if (r < 0) {
+		TC_PRINT("Failed to append payload\n");
+		goto done;
+	}
+
+	/* Clone it with an observer specific token and message id. */
+	r = coap_packet_clone(&clone, clone_data, COAP_BUF_SIZE, &template,
+			      COAP_TYPE_NON_CON, strlen(token),
+			      (uint8_t *)token, 0x4321);
+	if (r < 0) {
+		TC_PRINT("Could not clone packet\n");
+		goto done;
+	}
+
+	r = coap_packet_parse(&clone, clone.data, clone.offset, NULL, 0);
+	if (r < 0) {
+		TC_PRINT("Cloned packet does not parse\n");
+		goto done;
+	}
+
+	if (coap_header_get_type(&clone) != COAP_TYPE_NON_CON ||
+	    coap_header_get_code(&clone) != COAP_RESPONSE_CODE_CONTENT ||
+	    coap_header_get_id(&clone) != 0x4321) {
+		TC_PRINT("Cloned packet has wrong header fields\n");
+		goto done;
+	}
+
+	if (coap_header_get_token(&clone, read_token) != strlen(token) ||
+	    memcmp(read_token, token, strlen(token))) {
+		TC_PRINT("Cloned packet has wrong token\n");
+		goto done;
+	}
+
+	if (coap_get_option_int(&clone, COAP_OPTION_OBSERVE) != 2) {
+		TC_PRINT("Cloned packet has wrong observe option\n");
+		goto done;
+	}
+
+	clone_payload = coap_packet_get_payload(&clone, &payload_len);
+	if (!clone_payload || payload_len != strlen(payload) ||
+	    memcmp(clone_payload, payload, payload_len)) {
+		TC_PRINT("Cloned packet has wrong payload\n");
+		goto done;
+	}
+
+	result = TC_PASS;
+
+done:
+	k_free(data);
+	k_free(clone_data);
+
+	TC_END_RESULT(result);
+
+	return result;
+}
+
+static int test_pending_queue(void)
+{
+	struct coap_pending queued[NUM_PENDINGS];
+	sys_slist_t queue;
+	struct coap_pending *p;
+	int result = TC_FAIL;
+	int i;
+
+	sys_slist_init(&queue);
+
+	/* Add out of expiry order, the queue must sort them. */
+	for (i = 0; i < NUM_PENDINGS; i++) {
+		memset(&queued[i], 0, sizeof(queued[i]));
+		queued[i].t0 = k_uptime_get_32();
+		queued[i].timeout = (NUM_PENDINGS - i) * 100;
+
+		coap_pending_queue_add(&queue, &queued[i]);
+	}
+
+	/* The last one added expires first. */
+	for (i = NUM_PENDINGS - 1; i >= 0; i--) {
+		p = coap_pending_queue_next_to_expire(&queue);
+		if (p != &queued[i]) {
+			TC_PRINT("Wrong pending %p, expected %p\n",
+				 p, &queued[i]);
+			goto done;
+		}
+
+		if (!coap_pending_queue_remove(&queue, p)) {
+			TC_PRINT("Could not remove pending\n");
+			goto done;
+		}
+	}
+
+	if (coap_pending_queue_next_to_expire(&queue)) {
+		TC_PRINT("Queue should be empty\n");
+		goto done;
+	}
+
+	result = TC_PASS;
+
+done:
+	TC_END_RESULT(result);
+
+	return result;
+}
+
 static const struct {
 	const char *name;
 	int (*func)(void);
@@ -1476,6 +1629,8 @@ static const struct {
 	{ "Test retransmission", test_retransmit_second_round, },
 	{ "Test observer server", test_observer_server, },
 	{ "Test observer client", test_observer_client, },
+	{ "Test packet clone", test_packet_clone, },
+	{ "Test pending queue", test_pending_queue, },
 };
 
 void main(void)
@@ -4,6 +4,11 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#define NET_LOG_LEVEL CONFIG_NET_PKT_LOG_LEVEL
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(net_test, NET_LOG_LEVEL);
+
 #include <zephyr/types.h>
 #include <stddef.h>
 #include <string.h>
@@ -16,6 +21,8 @@
 
 #include <ztest.h>
 
+#include "net_private.h"
+
 static uint8_t mac_addr[sizeof(struct net_eth_addr)];
 static struct net_if *eth_if;
 static uint8_t small_buffer[512];
@@ -785,6 +792,138 @@ void test_net_pkt_clone(void)
 	net_pkt_unref(cloned_pkt);
 }
 
+void test_rx_from_driver_buffer(void)
+{
+	struct net_buf *frags[2];
+	struct net_pkt *pkt;
+	uint8_t byte;
+	int i;
+
+	/* Mimic a zero-copy RX driver: claim data buffers, pretend the
+	 * hardware DMAs a frame into them, set the fragment lengths and
+	 * wrap the chain into an RX packet without any copying.
+	 */
+	for (i = 0; i < 2; i++) {
+		frags[i] = net_pkt_get_reserve_rx_data(K_NO_WAIT);
+		zassert_true(frags[i] != NULL, "Data buffer not allocated");
+
+		memset(frags[i]->data, 0x40 + i, frags[i]->size);
+		net_buf_add(frags[i], frags[i]->size);
+	}
+
+	net_buf_frag_add(frags[0], frags[1]);
+
+	pkt = net_pkt_rx_alloc_from_buffer(eth_if, frags[0], K_NO_WAIT);
+	zassert_true(pkt != NULL, "Pkt not allocated");
+
+	zassert_equal(net_pkt_iface(pkt), eth_if, "Pkt iface not set");
+	zassert_equal(pkt->buffer, frags[0],
+		      "Driver buffers not used as-is");
+	zassert_equal(net_pkt_get_len(pkt),
+		      (size_t)frags[0]->size + frags[1]->size,
+		      "Pkt length mismatch");
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+	net_pkt_skip(pkt, frags[0]->size);
+	zassert_true(net_pkt_read_u8(pkt, &byte) == 0, "Pkt read failed");
+	zassert_equal(byte, 0x41, "Received data mismatch");
+
+	net_pkt_unref(pkt);
+}
+
+/* Odd sized chunks exercise the octet lane handling of the cached
+ * payload sum as well as the word-at-a-time checksum kernel.
+ */
+static const uint16_t chksum_chunks[] = { 1, 2, 3, 5, 7, 259 };
+
+static struct net_pkt *chksum_test_pkt_prepare(size_t payload_len)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(eth_if, NET_IPV4H_LEN + payload_len,
+					AF_INET, IPPROTO_UDP, K_NO_WAIT);
+	if (!pkt) {
+		return NULL;
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, NET_IPV4H_LEN);
+
+	/* A dummy IPv4 header is enough here: net_calc_chksum() only
+	 * reads its last 8 bytes as the pseudo header addresses.
+	 */
+	memset(small_buffer, 0x5a, NET_IPV4H_LEN);
+
+	if (net_pkt_write(pkt, small_buffer, NET_IPV4H_LEN)) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	return pkt;
+}
+
+void test_net_pkt_chksum_cache(void)
+{
+	struct net_pkt *plain, *written, *src, *copied;
+	size_t total = 0;
+	uint16_t chksum;
+	uint8_t byte = 0;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(chksum_chunks); i++) {
+		total += chksum_chunks[i];
+	}
+
+	plain = chksum_test_pkt_prepare(total);
+	written = chksum_test_pkt_prepare(total);
+	copied = chksum_test_pkt_prepare(total);
+	src = net_pkt_alloc_with_buffer(eth_if, total, AF_UNSPEC, 0,
+					K_NO_WAIT);
+
+	zassert_true(plain && written && copied && src,
+		     "Pkt allocation failed");
+
+	for (i = 0; i < ARRAY_SIZE(chksum_chunks); i++) {
+		size_t chunk = chksum_chunks[i];
+		size_t j;
+
+		for (j = 0; j < chunk; j++) {
+			small_buffer[j] = byte++;
+		}
+
+		zassert_false(net_pkt_write(plain, small_buffer, chunk),
+			      "Pkt write failed");
+		zassert_false(net_pkt_write_chksum(written, small_buffer,
+						   chunk),
+			      "Pkt chksum write failed");
+		zassert_false(net_pkt_write(src, small_buffer, chunk),
+			      "Pkt write failed");
+	}
+
+	net_pkt_cursor_init(src);
+	zassert_false(net_pkt_copy_chksum(copied, src, total),
+		      "Pkt chksum copy failed");
+
+	if (IS_ENABLED(CONFIG_NET_PKT_TX_CHKSUM_CACHE)) {
+		zassert_equal(net_pkt_tx_chksum_len(written), total,
+			      "Payload sum not cached on write");
+		zassert_equal(net_pkt_tx_chksum_len(copied), total,
+			      "Payload sum not cached on copy");
+	}
+
+	chksum = net_calc_chksum(plain, IPPROTO_UDP);
+
+	zassert_equal(net_calc_chksum(written, IPPROTO_UDP), chksum,
+		      "Cached write checksum mismatch");
+	zassert_equal(net_calc_chksum(copied, IPPROTO_UDP), chksum,
+		      "Cached copy checksum mismatch");
+
+	net_pkt_unref(plain);
+	net_pkt_unref(written);
+	net_pkt_unref(copied);
+	net_pkt_unref(src);
+}
+
 void test_main(void)
 {
 	eth_if = net_if_get_default();
@@ -797,7 +936,9 @@ void test_main(void)
 			 ztest_unit_test(test_net_pkt_easier_rw_usage),
 			 ztest_unit_test(test_net_pkt_copy),
 			 ztest_unit_test(test_net_pkt_pull),
-			 ztest_unit_test(test_net_pkt_clone)
+			 ztest_unit_test(test_net_pkt_clone),
+			 ztest_unit_test(test_rx_from_driver_buffer),
+			 ztest_unit_test(test_net_pkt_chksum_cache)
 		);
 
 	ztest_run_test_suite(net_pkt_tests);
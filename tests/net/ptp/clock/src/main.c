@@ -548,6 +548,34 @@ static void test_ptp_clock_get_user(void)
 	test_ptp_clock_get_by_xxx("user");
 }
 
+static void test_ptp_clock_get_cross(void)
+{
+	struct ptp_cross_timestamp xts;
+	const struct device *clk;
+	uint32_t before, after;
+	int ret;
+
+	clk = net_eth_get_ptp_clock_by_index(ptp_clocks[0]);
+	zassert_not_null(clk, "Clock not found");
+
+	/* The test driver has no get_cross op, so this exercises the
+	 * generic bracketing fallback.
+	 */
+	before = k_cycle_get_32();
+	ret = ptp_clock_get_cross(clk, &xts);
+	after = k_cycle_get_32();
+
+	zassert_equal(ret, 0, "Cannot get cross timestamp (%d)", ret);
+
+	zassert_true((xts.cycles - before) <= (after - before),
+		     "Cycle sample outside bracketing reads");
+
+	(void)memset(&tm, 0, sizeof(tm));
+	ptp_clock_get(clk, &tm);
+	zassert_equal(tm.second, xts.ptp.second,
+		      "PTP time does not match cross timestamp");
+}
+
 void test_main(void)
 {
 	const struct device *clk;
@@ -566,7 +594,8 @@ void test_main(void)
 			 ztest_unit_test(test_ptp_clock_get_by_index),
 			 ztest_user_unit_test(test_ptp_clock_get_by_index_user),
 			 ztest_unit_test(test_ptp_clock_get_kernel),
-			 ztest_user_unit_test(test_ptp_clock_get_user)
+			 ztest_user_unit_test(test_ptp_clock_get_user),
+			 ztest_unit_test(test_ptp_clock_get_cross)
 			 );
 
 	ztest_run_test_suite(ptp_clock_test);
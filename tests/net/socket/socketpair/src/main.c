@@ -36,6 +36,10 @@ extern void test_socketpair_write_block(void);
 extern void test_socketpair_close_one_end_and_read_from_the_other(void);
 extern void test_socketpair_close_one_end_and_write_to_the_other(void);
 
+/* in zerocopy.c */
+extern void test_socketpair_rcvlowat(void);
+extern void test_socketpair_zerocopy(void);
+
 /* in poll.c */
 extern void test_socketpair_poll_timeout(void);
 extern void test_socketpair_poll_timeout_nonblocking(void);
@@ -90,7 +94,13 @@ void test_main(void)
 		ztest_user_unit_test(
 			test_socketpair_poll_close_remote_end_POLLIN),
 		ztest_user_unit_test(
-			test_socketpair_poll_close_remote_end_POLLOUT)
+			test_socketpair_poll_close_remote_end_POLLOUT),
+
+		/* not user mode: the claimed pointers refer to
+		 * socket-internal memory
+		 */
+		ztest_unit_test(test_socketpair_rcvlowat),
+		ztest_unit_test(test_socketpair_zerocopy)
 	);
 
 	ztest_run_test_suite(socketpair);
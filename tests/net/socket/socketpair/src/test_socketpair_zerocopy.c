@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020 Friedt Professional Engineering Services, Inc
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <logging/log.h>
+LOG_MODULE_DECLARE(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <string.h>
+#include <net/socket.h>
+#include <ztest_assert.h>
+
+void test_socketpair_rcvlowat(void)
+{
+	int res;
+	int sv[2] = {-1, -1};
+	int lowat;
+	socklen_t optlen;
+	char buf[8];
+	struct zsock_pollfd fds[1];
+
+	res = zsock_socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+	zassert_equal(res, 0, "socketpair(2) failed: %d", errno);
+
+	/* value outside of 1 .. buffer capacity is rejected */
+	lowat = 0;
+	res = zsock_setsockopt(sv[0], SOL_SOCKET, SO_RCVLOWAT, &lowat,
+			       sizeof(lowat));
+	zassert_equal(res, -1, "expected setsockopt() to fail");
+	zassert_equal(errno, EINVAL, "errno: expected: EINVAL actual: %d",
+		      errno);
+
+	lowat = CONFIG_NET_SOCKETPAIR_BUFFER_SIZE + 1;
+	res = zsock_setsockopt(sv[0], SOL_SOCKET, SO_RCVLOWAT, &lowat,
+			       sizeof(lowat));
+	zassert_equal(res, -1, "expected setsockopt() to fail");
+	zassert_equal(errno, EINVAL, "errno: expected: EINVAL actual: %d",
+		      errno);
+
+	lowat = 4;
+	res = zsock_setsockopt(sv[0], SOL_SOCKET, SO_RCVLOWAT, &lowat,
+			       sizeof(lowat));
+	zassert_equal(res, 0, "setsockopt() failed: %d", errno);
+
+	lowat = 0;
+	optlen = sizeof(lowat);
+	res = zsock_getsockopt(sv[0], SOL_SOCKET, SO_RCVLOWAT, &lowat,
+			       &optlen);
+	zassert_equal(res, 0, "getsockopt() failed: %d", errno);
+	zassert_equal(lowat, 4, "expected watermark 4, got %d", lowat);
+
+	/* below the watermark the reader is not woken.. */
+	res = zsock_send(sv[1], "xyz", 3, 0);
+	zassert_equal(res, 3, "send(2) failed: %d", errno);
+
+	fds[0].fd = sv[0];
+	fds[0].events = ZSOCK_POLLIN;
+	fds[0].revents = 0;
+	res = zsock_poll(fds, 1, 0);
+	zassert_equal(res, 0, "expected no povents, got %d", fds[0].revents);
+
+	/* ..but crossing it reports the whole batch */
+	res = zsock_send(sv[1], "w", 1, 0);
+	zassert_equal(res, 1, "send(2) failed: %d", errno);
+
+	fds[0].revents = 0;
+	res = zsock_poll(fds, 1, 0);
+	zassert_equal(res, 1, "poll() failed: %d", errno);
+	zassert_equal(fds[0].revents & ZSOCK_POLLIN, ZSOCK_POLLIN,
+		      "expected POLLIN");
+
+	res = zsock_recv(sv[0], buf, sizeof(buf), 0);
+	zassert_equal(res, 4, "recv(2) failed: %d", errno);
+	zassert_mem_equal(buf, "xyzw", 4, "unexpected data");
+
+	zsock_close(sv[0]);
+	zsock_close(sv[1]);
+}
+
+void test_socketpair_zerocopy(void)
+{
+	int res;
+	int sv[2] = {-1, -1};
+	uint8_t *claim = NULL;
+	char buf[8];
+
+	res = zsock_socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+	zassert_equal(res, 0, "socketpair(2) failed: %d", errno);
+
+	/* produce directly into the peer's receive buffer */
+	res = zsock_socketpair_put_claim(sv[0], &claim, 5);
+	zassert_equal(res, 5, "put_claim() failed: %d", errno);
+	zassert_not_null(claim, "claim is NULL");
+
+	memcpy(claim, "hello", 5);
+
+	/* committing less than what was claimed is allowed */
+	res = zsock_socketpair_put_finish(sv[0], 4);
+	zassert_equal(res, 0, "put_finish() failed: %d", errno);
+
+	res = zsock_recv(sv[1], buf, sizeof(buf), 0);
+	zassert_equal(res, 4, "recv(2) failed: %d", errno);
+	zassert_mem_equal(buf, "hell", 4, "unexpected data");
+
+	/* consume in place on the other end */
+	res = zsock_send(sv[1], "world", 5, 0);
+	zassert_equal(res, 5, "send(2) failed: %d", errno);
+
+	claim = NULL;
+	res = zsock_socketpair_get_claim(sv[0], &claim, 5);
+	zassert_equal(res, 5, "get_claim() failed: %d", errno);
+	zassert_not_null(claim, "claim is NULL");
+	zassert_mem_equal(claim, "world", 5, "unexpected data");
+
+	res = zsock_socketpair_get_finish(sv[0], 5);
+	zassert_equal(res, 0, "get_finish() failed: %d", errno);
+
+	/* the queue is drained again */
+	res = zsock_socketpair_get_claim(sv[0], &claim, 1);
+	zassert_equal(res, 0, "expected an empty queue, got %d", res);
+
+	/* claiming towards a closed peer fails */
+	zsock_close(sv[1]);
+
+	res = zsock_socketpair_put_claim(sv[0], &claim, 1);
+	zassert_equal(res, -1, "expected put_claim() to fail");
+	zassert_equal(errno, EPIPE, "errno: expected: EPIPE actual: %d",
+		      errno);
+
+	zsock_close(sv[0]);
+}
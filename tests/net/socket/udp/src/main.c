@@ -345,6 +345,124 @@ void test_so_priority(void)
 	zassert_equal(rv, 0, "close failed");
 }
 
+void test_so_busy_poll(void)
+{
+	struct sockaddr_in bind_addr, conn_addr;
+	int sock1, sock2, rv;
+	int optval = 1;
+	char buf[30];
+	ssize_t len;
+
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, 55555,
+			    &sock1, &bind_addr);
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, 55555,
+			    &sock2, &conn_addr);
+
+	rv = bind(sock1, (struct sockaddr *)&bind_addr, sizeof(bind_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = connect(sock2, (struct sockaddr *)&conn_addr, sizeof(conn_addr));
+	zassert_equal(rv, 0, "connect failed");
+
+	rv = setsockopt(sock1, SOL_SOCKET, SO_BUSY_POLL, &optval,
+			sizeof(uint8_t));
+	zassert_equal(rv, -1, "setsockopt with wrong optlen succeeded");
+	zassert_equal(errno, EINVAL, "unexpected errno %d", errno);
+
+	rv = setsockopt(sock1, SOL_SOCKET, SO_BUSY_POLL, &optval,
+			sizeof(optval));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	len = send(sock2, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	/* The busy-polled recv spins until the RX thread delivers the
+	 * datagram that is already in flight.
+	 */
+	clear_buf(buf);
+	len = recv(sock1, buf, sizeof(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+	zassert_mem_equal(buf, BUF_AND_SIZE(TEST_STR_SMALL), "wrong data");
+
+	rv = close(sock1);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(sock2);
+	zassert_equal(rv, 0, "close failed");
+}
+
+void test_so_rcvbuf(void)
+{
+	struct sockaddr_in bind_addr, conn_addr;
+	int sock1, sock2, rv;
+	int optval;
+	socklen_t optlen;
+	char buf[30];
+	ssize_t len;
+
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, 55555,
+			    &sock1, &bind_addr);
+	prepare_sock_udp_v4(CONFIG_NET_CONFIG_MY_IPV4_ADDR, 55555,
+			    &sock2, &conn_addr);
+
+	rv = bind(sock1, (struct sockaddr *)&bind_addr, sizeof(bind_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = connect(sock2, (struct sockaddr *)&conn_addr, sizeof(conn_addr));
+	zassert_equal(rv, 0, "connect failed");
+
+	optval = -1;
+	rv = setsockopt(sock1, SOL_SOCKET, SO_RCVBUF, &optval, sizeof(optval));
+	zassert_equal(rv, -1, "setsockopt with negative limit succeeded");
+	zassert_equal(errno, EINVAL, "unexpected errno %d", errno);
+
+	/* Room for one small datagram but not for two */
+	optval = STRLEN(TEST_STR_SMALL) + 1;
+	rv = setsockopt(sock1, SOL_SOCKET, SO_RCVBUF, &optval, sizeof(optval));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	optval = 0;
+	optlen = sizeof(optval);
+	rv = getsockopt(sock1, SOL_SOCKET, SO_RCVBUF, &optval, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(optval, STRLEN(TEST_STR_SMALL) + 1,
+		      "wrong limit read back");
+
+	/* The first datagram fills the budget, the second is dropped at
+	 * demux time.
+	 */
+	len = send(sock2, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+	len = send(sock2, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	k_sleep(K_MSEC(100));
+
+	clear_buf(buf);
+	len = recv(sock1, buf, sizeof(buf), MSG_DONTWAIT);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+	zassert_mem_equal(buf, BUF_AND_SIZE(TEST_STR_SMALL), "wrong data");
+
+	len = recv(sock1, buf, sizeof(buf), MSG_DONTWAIT);
+	zassert_equal(len, -1, "over-limit datagram was not dropped");
+	zassert_equal(errno, EAGAIN, "unexpected errno %d", errno);
+
+	/* Consuming the queued datagram freed the budget again */
+	len = send(sock2, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	k_sleep(K_MSEC(100));
+
+	clear_buf(buf);
+	len = recv(sock1, buf, sizeof(buf), MSG_DONTWAIT);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+	zassert_mem_equal(buf, BUF_AND_SIZE(TEST_STR_SMALL), "wrong data");
+
+	rv = close(sock1);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(sock2);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void comm_sendmsg_recvfrom(int client_sock,
 				  struct sockaddr *client_addr,
 				  socklen_t client_addrlen,
@@ -966,6 +1084,8 @@ void test_main(void)
 			 ztest_unit_test(test_v6_bind_sendto),
 			 ztest_unit_test(test_so_priority),
 			 ztest_unit_test(test_so_txtime),
+			 ztest_unit_test(test_so_busy_poll),
+			 ztest_unit_test(test_so_rcvbuf),
 			 ztest_unit_test(test_v4_sendmsg_recvfrom),
 			 ztest_user_unit_test(test_v4_sendmsg_recvfrom),
 			 ztest_unit_test(test_v4_sendmsg_recvfrom_no_aux_data),
@@ -76,6 +76,24 @@ static int test_recv_buf(uint8_t *feed_buf, size_t feed_len,
 				  msg_type, remaining, 0);
 }
 
+static int test_recv_buf_inplace(uint8_t *feed_buf, size_t feed_len,
+				 struct websocket_context *ctx,
+				 uint32_t *msg_type, uint64_t *remaining,
+				 uint8_t **recv_data)
+{
+	static struct test_data test_data;
+	int ctx_ptr;
+
+	test_data.ctx = ctx;
+	test_data.input_buf = feed_buf;
+	test_data.input_len = feed_len;
+
+	ctx_ptr = POINTER_TO_INT(&test_data);
+
+	return websocket_recv_msg_inplace(ctx_ptr, recv_data, msg_type,
+					  remaining, 0);
+}
+
 /* Websocket frame, header is 6 bytes, FIN bit is set, opcode is text (1),
  * payload length is 12, masking key is e17e8eb9,
  * unmasked data is "test message"
@@ -269,6 +287,49 @@ static void test_recv_two_msg(void)
 	test_recv_2(sizeof(frame1) + FRAME1_HDR_SIZE / 2);
 }
 
+static void test_recv_inplace(void)
+{
+	struct websocket_context ctx;
+	uint32_t msg_type = -1;
+	uint64_t remaining = -1;
+	uint8_t *data = NULL;
+	int ret;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	ctx.tmp_buf = temp_recv_buf;
+	ctx.tmp_buf_len = sizeof(temp_recv_buf);
+
+	memcpy(feed_buf, &frame2, sizeof(frame2));
+
+	/* The first message is handed out straight from the temp buffer */
+	ret = test_recv_buf_inplace(&feed_buf[0], sizeof(frame1), &ctx,
+				    &msg_type, &remaining, &data);
+
+	zassert_equal(ret, sizeof(frame1_msg) - 1,
+		      "Invalid number of bytes read (%d)", ret);
+	zassert_equal_ptr(data, ctx.tmp_buf,
+			  "Data does not point to the temp buffer");
+	zassert_mem_equal(data, frame1_msg, sizeof(frame1_msg) - 1,
+			  "Invalid message, should be '%s' was '%s'",
+			  frame1_msg, data);
+	zassert_equal(remaining, 0, "Msg not empty");
+
+	/* The handed out first message is reclaimed when the second one
+	 * is read.
+	 */
+	ret = test_recv_buf_inplace(&feed_buf[sizeof(frame1)],
+				    sizeof(frame2) - sizeof(frame1), &ctx,
+				    &msg_type, &remaining, &data);
+
+	zassert_equal(ret, sizeof(frame1_msg) - 1,
+		      "Invalid number of bytes read (%d)", ret);
+	zassert_mem_equal(data, frame1_msg, sizeof(frame1_msg) - 1,
+			  "Invalid message, should be '%s' was '%s'",
+			  frame1_msg, data);
+	zassert_equal(remaining, 0, "Msg not empty");
+}
+
 int verify_sent_and_received_msg(struct msghdr *msg, bool split_msg)
 {
 	static struct websocket_context ctx;
@@ -389,6 +450,7 @@ void test_main(void)
 			 ztest_unit_test(test_recv_12_byte),
 			 ztest_unit_test(test_recv_whole_msg),
 			 ztest_unit_test(test_recv_two_msg),
+			 ztest_unit_test(test_recv_inplace),
 			 ztest_unit_test(test_send_and_recv_lorem_ipsum),
 			 ztest_unit_test(test_recv_two_large_split_msg)
 		);
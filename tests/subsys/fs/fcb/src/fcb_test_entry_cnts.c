@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2017 Nordic Semiconductor ASA
+ * Copyright (c) 2015 Runtime Inc
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fcb_test.h"
+
+void test_fcb_entry_cnts(void)
+{
+	const uint8_t ENTRIES = 5U;
+	uint16_t entry_cnts[4];
+	struct fcb *fcb;
+	int rc;
+	struct fcb_entry loc;
+	struct fcb_entry areas[ENTRIES];
+	uint8_t test_data[128] = {0};
+	uint8_t i;
+	uint16_t total;
+
+	fcb = &test_fcb;
+	fcb->f_scratch_cnt = 1U;
+
+	/* Re-init with RAM entry counters enabled */
+	fcb->f_entry_cnts = entry_cnts;
+	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, fcb);
+	zassert_true(rc == 0, "fcb initialization failure");
+
+	/* No fcbs available */
+	rc = fcb_offset_last_n(fcb, 1, &loc);
+	zassert_true(rc != 0, "No fcbs available");
+
+	for (i = 0U; i < ENTRIES; i++) {
+		rc = fcb_append(fcb, sizeof(test_data), &loc);
+		zassert_true(rc == 0, "fcb_append call failure");
+
+		rc = flash_area_write(fcb->fap, FCB_ENTRY_FA_DATA_OFF(loc),
+				      test_data, sizeof(test_data));
+		zassert_true(rc == 0, "flash_area_write call failure");
+
+		rc = fcb_append_finish(fcb, &loc);
+		zassert_true(rc == 0, "fcb_append_finish call failure");
+
+		areas[i] = loc;
+	}
+
+	total = 0U;
+	for (i = 0U; i < fcb->f_sector_cnt; i++) {
+		total += entry_cnts[i];
+	}
+	zassert_true(total == ENTRIES, "wrong entry count after appends");
+
+	/* counted lookup matches the appended locations */
+	rc = fcb_offset_last_n(fcb, 1, &loc);
+	zassert_true(rc == 0, "fcb_offset_last_n call failure");
+	zassert_true(areas[4].fe_sector == loc.fe_sector &&
+		     areas[4].fe_data_off == loc.fe_data_off &&
+		     areas[4].fe_data_len == loc.fe_data_len,
+		     "fcb_offset_last_n: fetched wrong n-th location");
+
+	rc = fcb_offset_last_n(fcb, 3, &loc);
+	zassert_true(rc == 0, "fcb_offset_last_n call failure");
+	zassert_true(areas[2].fe_sector == loc.fe_sector &&
+		     areas[2].fe_data_off == loc.fe_data_off &&
+		     areas[2].fe_data_len == loc.fe_data_len,
+		     "fcb_offset_last_n: fetched wrong n-th location");
+
+	rc = fcb_offset_last_n(fcb, 6, &loc);
+	zassert_true(rc == 0, "fcb_offset_last_n call failure");
+	zassert_true(areas[0].fe_sector == loc.fe_sector &&
+		     areas[0].fe_data_off == loc.fe_data_off &&
+		     areas[0].fe_data_len == loc.fe_data_len,
+		     "fcb_offset_last_n: fetched wrong n-th location");
+
+	/* counters follow a rotate and survive re-init */
+	rc = fcb_rotate(fcb);
+	zassert_true(rc == 0, "fcb_rotate call failure");
+
+	total = 0U;
+	for (i = 0U; i < fcb->f_sector_cnt; i++) {
+		total += entry_cnts[i];
+	}
+
+	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, fcb);
+	zassert_true(rc == 0, "fcb re-initialization failure");
+
+	for (i = 0U; i < fcb->f_sector_cnt; i++) {
+		total -= entry_cnts[i];
+	}
+	zassert_true(total == 0U, "rescanned entry counts differ");
+}
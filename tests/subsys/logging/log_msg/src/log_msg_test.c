@@ -16,7 +16,6 @@
 #include <zephyr.h>
 #include <ztest.h>
 
-extern struct k_mem_slab log_msg_pool;
 static const char my_string[] = "test_string";
 void test_log_std_msg(void)
 {
@@ -24,7 +23,7 @@ void test_log_std_msg(void)
 		      IS_ENABLED(CONFIG_64BIT) ? 4 : 3,
 		      "test assumes following setting");
 
-	uint32_t used_slabs = k_mem_slab_num_used_get(&log_msg_pool);
+	uint32_t used_slabs = log_msg_mem_used_get();
 	log_arg_t args[] = {1, 2, 3, 4, 5, 6};
 	struct log_msg *msg;
 
@@ -50,14 +49,14 @@ void test_log_std_msg(void)
 
 		used_slabs += (i > LOG_MSG_NARGS_SINGLE_CHUNK) ? 2 : 1;
 		zassert_equal(used_slabs,
-			      k_mem_slab_num_used_get(&log_msg_pool),
+			      log_msg_mem_used_get(),
 			      "Expected mem slab allocation.");
 
 		log_msg_put(msg);
 
 		used_slabs -= (i > LOG_MSG_NARGS_SINGLE_CHUNK) ? 2 : 1;
 		zassert_equal(used_slabs,
-			      k_mem_slab_num_used_get(&log_msg_pool),
+			      log_msg_mem_used_get(),
 			      "Expected mem slab allocation.");
 	}
 }
@@ -65,7 +64,7 @@ void test_log_std_msg(void)
 void test_log_hexdump_msg(void)
 {
 
-	uint32_t used_slabs = k_mem_slab_num_used_get(&log_msg_pool);
+	uint32_t used_slabs = log_msg_mem_used_get();
 	struct log_msg *msg;
 	uint8_t data[128];
 
@@ -78,14 +77,14 @@ void test_log_hexdump_msg(void)
 				     LOG_MSG_HEXDUMP_BYTES_SINGLE_CHUNK - 4);
 
 	zassert_equal((used_slabs + 1),
-		      k_mem_slab_num_used_get(&log_msg_pool),
+		      log_msg_mem_used_get(),
 		      "Expected mem slab allocation.");
 	used_slabs++;
 
 	log_msg_put(msg);
 
 	zassert_equal((used_slabs - 1),
-		      k_mem_slab_num_used_get(&log_msg_pool),
+		      log_msg_mem_used_get(),
 		      "Expected mem slab allocation.");
 	used_slabs--;
 
@@ -94,14 +93,14 @@ void test_log_hexdump_msg(void)
 				     LOG_MSG_HEXDUMP_BYTES_SINGLE_CHUNK);
 
 	zassert_equal((used_slabs + 1),
-		      k_mem_slab_num_used_get(&log_msg_pool),
+		      log_msg_mem_used_get(),
 		      "Expected mem slab allocation.");
 	used_slabs++;
 
 	log_msg_put(msg);
 
 	zassert_equal((used_slabs - 1),
-		      k_mem_slab_num_used_get(&log_msg_pool),
+		      log_msg_mem_used_get(),
 		      "Expected mem slab allocation.");
 	used_slabs--;
 
@@ -110,14 +109,14 @@ void test_log_hexdump_msg(void)
 				     LOG_MSG_HEXDUMP_BYTES_SINGLE_CHUNK + 1);
 
 	zassert_equal((used_slabs + 2U),
-		      k_mem_slab_num_used_get(&log_msg_pool),
+		      log_msg_mem_used_get(),
 		      "Expected mem slab allocation.");
 	used_slabs += 2U;
 
 	log_msg_put(msg);
 
 	zassert_equal((used_slabs - 2U),
-		      k_mem_slab_num_used_get(&log_msg_pool),
+		      log_msg_mem_used_get(),
 		      "Expected mem slab allocation.");
 	used_slabs -= 2U;
 
@@ -127,14 +126,14 @@ void test_log_hexdump_msg(void)
 				     HEXDUMP_BYTES_CONT_MSG + 1);
 
 	zassert_equal((used_slabs + 3U),
-		      k_mem_slab_num_used_get(&log_msg_pool),
+		      log_msg_mem_used_get(),
 		      "Expected mem slab allocation.");
 	used_slabs += 3U;
 
 	log_msg_put(msg);
 
 	zassert_equal((used_slabs - 3U),
-		      k_mem_slab_num_used_get(&log_msg_pool),
+		      log_msg_mem_used_get(),
 		      "Expected mem slab allocation.");
 	used_slabs -= 3U;
 }
@@ -257,6 +257,39 @@ static void test_stream_flash_bytes_written(void)
 	VERIFY_WRITTEN(BUF_LEN, BUF_LEN);
 }
 
+static void test_stream_flash_progress_set(void)
+{
+	int rc;
+	size_t resume_offset = page_size;
+
+	init_target();
+
+	rc = stream_flash_progress_set(NULL, resume_offset);
+	zassert_true(rc < 0, "should fail as ctx is NULL");
+
+	rc = stream_flash_progress_set(&ctx, FLASH_AVAILABLE + 4);
+	zassert_true(rc < 0, "should fail as offset is out of range");
+
+	/* Write some data so that the context is no longer clean */
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, false);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_progress_set(&ctx, resume_offset);
+	zassert_true(rc < 0, "should fail after data was written");
+
+	init_target();
+
+	rc = stream_flash_progress_set(&ctx, resume_offset);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), resume_offset,
+		      "offset should be set");
+
+	/* Writes should continue after the resume offset */
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, true);
+	zassert_equal(rc, 0, "expected success");
+	VERIFY_WRITTEN(resume_offset, BUF_LEN);
+}
+
 static void test_stream_flash_buf_size_greater_than_page_size(void)
 {
 	int rc;
@@ -395,7 +428,8 @@ void test_main(void)
 	     ztest_unit_test(test_stream_flash_flush),
 	     ztest_unit_test(test_stream_flash_buffered_write_whole_page),
 	     ztest_unit_test(test_stream_flash_erase_page),
-	     ztest_unit_test(test_stream_flash_bytes_written)
+	     ztest_unit_test(test_stream_flash_bytes_written),
+	     ztest_unit_test(test_stream_flash_progress_set)
 	 );
 
 	ztest_run_test_suite(lib_stream_flash_test);
@@ -4,6 +4,10 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 #include <ztest.h>
+
+/* Exercise the order-statistics augmentation along with the base tree */
+#define CONFIG_RBTREE_ORDER_STATS 1
+
 #include <sys/rb.h>
 
 #include "../../../lib/os/rb.c"
@@ -119,6 +123,25 @@ void check_rbnode(struct rbnode *node, int blacks_above)
 	}
 }
 
+/* Validates the stored subtree sizes bottom-up, returning the actual
+ * node count of the subtree
+ */
+int check_subtree_size(struct rbnode *node)
+{
+	int size = 1;
+
+	for (int side = 0; side < 2; side++) {
+		struct rbnode *ch = z_rb_child(node, side);
+
+		if (ch) {
+			size += check_subtree_size(ch);
+		}
+	}
+
+	_CHECK(node->subtree == (uint32_t)size);
+	return size;
+}
+
 void check_rb(void)
 {
 	last_black_height = 0;
@@ -127,6 +150,7 @@ void check_rb(void)
 	_CHECK(z_rb_is_black(tree.root));
 
 	check_rbnode(tree.root, 0);
+	check_subtree_size(tree.root);
 }
 
 /* First validates the external API behavior via a walk, then checks
@@ -174,6 +198,14 @@ void _check_tree(int size, int use_foreach)
 
 	_CHECK(ni == nwalked);
 
+	/* Select and rank must agree with the in-order walk */
+	_CHECK(rb_size(&tree) == (uint32_t)nwalked);
+	for (i = 0; i < nwalked; i++) {
+		_CHECK(rb_select(&tree, i) == walked_nodes[i]);
+		_CHECK(rb_rank(&tree, walked_nodes[i]) == i);
+	}
+	_CHECK(rb_select(&tree, nwalked) == NULL);
+
 	if (tree.root) {
 		check_rb();
 	}
@@ -245,9 +277,52 @@ void test_rbtree_spam(void)
 	} while (size < MAX_NODES);
 }
 
+void test_rbtree_build(void)
+{
+	static struct rbnode *sorted[MAX_NODES];
+	int size = 1;
+
+	(void)memset(&tree, 0, sizeof(tree));
+	tree.lessthan_fn = node_lessthan;
+
+	do {
+		(void)memset(nodes, 0, sizeof(nodes));
+		(void)memset(node_mask, 0, sizeof(node_mask));
+
+		for (int i = 0; i < size; i++) {
+			sorted[i] = &nodes[i];
+			set_node_mask(i, 1);
+		}
+
+		rb_build(&tree, sorted, size);
+
+		check_tree(size);
+		_CHECK(rb_get_min(&tree) == &nodes[0]);
+		_CHECK(rb_get_max(&tree) == &nodes[size - 1]);
+
+		/* The built tree must remain maintainable with the
+		 * incremental operations
+		 */
+		rb_remove(&tree, &nodes[size / 2]);
+		set_node_mask(size / 2, 0);
+		check_tree(size);
+
+		rb_insert(&tree, &nodes[size / 2]);
+		set_node_mask(size / 2, 1);
+		check_tree(size);
+
+		size += next_rand_mod(8) + 1;
+	} while (size <= MAX_NODES);
+
+	rb_build(&tree, sorted, 0);
+	_CHECK(tree.root == NULL);
+	_CHECK(rb_size(&tree) == 0);
+}
+
 void test_main(void)
 {
 	ztest_test_suite(test_rbtree,
-			 ztest_unit_test(test_rbtree_spam));
+			 ztest_unit_test(test_rbtree_spam),
+			 ztest_unit_test(test_rbtree_build));
 	ztest_run_test_suite(test_rbtree);
 }